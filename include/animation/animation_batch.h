@@ -0,0 +1,236 @@
+/**
+ * @file animation_batch.h
+ * @brief Batched skeletal animation for crowds of characters
+ *
+ * SkeletonAnimator animates one character: it looks its clip up by name every
+ * frame, scans keyframes linearly per bone and builds T/R/S matrices per bone.
+ * AnimationBatch evaluates many characters per update instead:
+ * - Skeletons and clips are compiled once and shared. Tracks are resolved to
+ *   bone indices at load (no strings at runtime) and keys are stored SoA
+ *   (times, translations, rotations, scales in separate arrays)
+ * - Each character keeps a keyframe cursor per track, so sampling steps on
+ *   from last frame's key instead of searching (O(1) per track per frame)
+ * - Local poses are SoA vec3/quat/vec3 arrays; crossfades blend TRS (nlerp for
+ *   rotations) rather than final matrices
+ * - update() fans characters out over persistent worker threads (started on the
+ *   first update with more than one job, woken per update) and writes skinning
+ *   matrices straight into a palette, normally the mapped MeshRenderer bone
+ *   palette (see MeshRenderer::allocateBonePalette)
+ *
+ * Characters that are neither playing nor blending are skipped.
+ *
+ * Created: 2025-11-28
+ */
+
+#pragma once
+
+#include "animation/skeleton_animator.h"
+#include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @brief Bind pose and hierarchy shared by every character of one rig
+ */
+struct AnimSkeleton {
+    std::vector<int> parents;                   ///< Parent bone (-1 = root)
+    std::vector<int> evalOrder;                 ///< Bone indices, parents before children
+    std::vector<glm::vec3> bindTranslations;    ///< Local bind pose (SoA)
+    std::vector<glm::quat> bindRotations;
+    std::vector<glm::vec3> bindScales;
+    std::vector<glm::mat4> inverseBindPoses;    ///< Inverse model-space bind transform
+    std::unordered_map<std::string, int> boneNameToIndex;  ///< Used when compiling clips
+
+    size_t boneCount() const { return parents.size(); }
+};
+
+/**
+ * @brief Keyframes of one clip, compiled against a skeleton
+ *
+ * Track keys are contiguous slices [firstKey, firstKey + keyCount) of the
+ * shared key arrays, sorted by time.
+ */
+struct AnimClip {
+    struct Track {
+        int bone = 0;
+        uint32_t firstKey = 0;
+        uint32_t keyCount = 0;
+    };
+
+    float duration = 0.0f;
+    bool loop = false;
+    std::vector<Track> tracks;
+    std::vector<float> times;
+    std::vector<glm::vec3> translations;
+    std::vector<glm::quat> rotations;
+    std::vector<glm::vec3> scales;
+};
+
+/**
+ * @brief Local pose of one skeleton (SoA)
+ */
+struct AnimPose {
+    std::vector<glm::vec3> translations;
+    std::vector<glm::quat> rotations;
+    std::vector<glm::vec3> scales;
+};
+
+/**
+ * @brief Animates many characters and writes their skinning matrices
+ *
+ * Usage:
+ * @code
+ * uint32_t rig = batch.addSkeleton(*animator.getSkeleton());
+ * uint32_t walk = batch.addClip(rig, *animator.getAnimation("walk"));
+ * uint32_t base = meshRenderer.allocateBonePalette(boneCount);
+ * uint32_t mob = batch.createCharacter(rig, base);
+ * meshRenderer.setInstanceBonePalette(instanceId, base, boneCount);
+ * batch.play(mob, walk);
+ * // Every frame:
+ * batch.update(deltaTime, meshRenderer.getBonePalette());
+ * @endcode
+ */
+class AnimationBatch {
+public:
+    static constexpr size_t CHARACTERS_PER_JOB = 32;  ///< Smaller batches run on the calling thread
+    static constexpr unsigned int MAX_WORKERS = 4;    ///< Update threads besides the calling thread
+
+    AnimationBatch() = default;
+
+    /**
+     * @brief Stops and joins the update workers
+     */
+    ~AnimationBatch();
+
+    AnimationBatch(const AnimationBatch&) = delete;
+    AnimationBatch& operator=(const AnimationBatch&) = delete;
+
+    /**
+     * @brief Compiles a loaded rig
+     * @return Skeleton ID, or 0 if it has no bones or more than MAX_BONES
+     */
+    uint32_t addSkeleton(const RuntimeSkeleton& skeleton);
+
+    /**
+     * @brief Compiles a clip for a skeleton (tracks for unknown bones are dropped)
+     * @return Clip ID, or 0 if the skeleton is unknown
+     */
+    uint32_t addClip(uint32_t skeletonId, const AnimationClip& clip);
+
+    /**
+     * @brief Adds a character in its bind pose
+     * @param skeletonId Skeleton from addSkeleton()
+     * @param paletteBase First palette matrix owned by this character
+     * @return Character ID, or 0 if the skeleton is unknown
+     */
+    uint32_t createCharacter(uint32_t skeletonId, uint32_t paletteBase);
+
+    void removeCharacter(uint32_t characterId);
+
+    /**
+     * @brief Starts a clip, crossfading from the current pose
+     * @param characterId Character ID
+     * @param clipId Clip compiled for the character's skeleton
+     * @param loop Whether to loop
+     * @param blendTime Crossfade time (seconds, 0 = cut)
+     * @param speed Playback speed multiplier
+     */
+    void play(uint32_t characterId, uint32_t clipId, bool loop = true, float blendTime = 0.2f, float speed = 1.0f);
+
+    /// Freezes the character in its current pose
+    void stop(uint32_t characterId);
+
+    /// Moves the character's matrices (rewritten on the next update)
+    void setPaletteBase(uint32_t characterId, uint32_t paletteBase);
+
+    /**
+     * @brief Advances all characters and writes their skinning matrices
+     * @param deltaTime Time since last update (seconds)
+     * @param palette Matrix 0 of the palette; character bones go to palette[base + bone]
+     */
+    void update(float deltaTime, glm::mat4* palette);
+
+    size_t getCharacterCount() const { return m_characters.size(); }
+    const AnimSkeleton* getSkeleton(uint32_t skeletonId) const;
+    bool isPlaying(uint32_t characterId) const;
+    float getTime(uint32_t characterId) const;
+
+    /**
+     * @brief Samples the tracks of a clip into a pose
+     * @param clip Compiled clip
+     * @param time Clip time (seconds)
+     * @param cursors Key index per track from the previous sample (resized if needed)
+     * @param pose Pose to write; bones without a track are left untouched
+     */
+    static void sampleClip(const AnimClip& clip, float time, std::vector<uint32_t>& cursors, AnimPose& pose);
+
+    /**
+     * @brief Local pose -> skinning matrices (model * inverse bind) for one skeleton
+     * @param modelScratch Model-space transform per bone (resized if needed)
+     * @param out boneCount() matrices
+     */
+    static void computeSkinning(const AnimSkeleton& skeleton, const AnimPose& pose,
+                                std::vector<glm::mat4>& modelScratch, glm::mat4* out);
+
+private:
+    static constexpr uint32_t NO_CLIP = UINT32_MAX;
+
+    struct Character {
+        uint32_t id = 0;
+        uint32_t skeleton = 0;             ///< Index into m_skeletons
+        uint32_t clip = NO_CLIP;           ///< Index into m_clips
+        uint32_t paletteBase = 0;
+        float time = 0.0f;
+        float speed = 1.0f;
+        bool loop = false;
+        bool playing = false;
+        bool dirty = true;                 ///< Palette needs rewriting although nothing plays
+        float blendElapsed = 0.0f;
+        float blendDuration = 0.0f;
+        std::vector<uint32_t> cursors;     ///< Key cursor per track of the current clip
+        AnimPose pose;                     ///< Clip pose (untracked bones stay in bind pose)
+        AnimPose blendFrom;                ///< Pose when the crossfade started
+        AnimPose blended;                  ///< Crossfade output
+        std::vector<glm::mat4> model;      ///< Model-space scratch
+    };
+
+    struct ClipEntry {
+        uint32_t skeleton = 0;             ///< Index into m_skeletons
+        AnimClip clip;
+    };
+
+    void evaluate(Character& character, float deltaTime, glm::mat4* palette) const;
+    void startWorkers();
+    void workerThreadFunction();
+    void evaluateJobs();
+    void resetToBindPose(Character& character) const;
+    Character* findCharacter(uint32_t characterId);
+    const Character* findCharacter(uint32_t characterId) const;
+
+    std::vector<AnimSkeleton> m_skeletons;     ///< ID = index + 1
+    std::vector<ClipEntry> m_clips;            ///< ID = index + 1
+    std::vector<Character> m_characters;       ///< Dense (swap-removed) for the update loop
+    std::unordered_map<uint32_t, uint32_t> m_characterIndex;  ///< ID -> index in m_characters
+    uint32_t m_nextCharacterId = 1;
+
+    // ===== Update workers (started on the first update with more than one job) =====
+    std::vector<std::thread> m_workers;
+    std::mutex m_jobMutex;
+    std::condition_variable m_jobCV;                ///< Wakes workers for a new update or shutdown
+    std::condition_variable m_doneCV;               ///< Wakes the caller when the workers finish
+    uint64_t m_jobGeneration = 0;                   ///< Bumped once per parallel update
+    size_t m_workersBusy = 0;                       ///< Workers still on the current update
+    bool m_shuttingDown = false;
+
+    // Current update: written under m_jobMutex before the generation bump, read-only while workers run
+    float m_jobDeltaTime = 0.0f;
+    glm::mat4* m_jobPalette = nullptr;
+    size_t m_jobCount = 0;                          ///< Jobs of CHARACTERS_PER_JOB characters
+    std::atomic<size_t> m_jobNext{0};               ///< Next unclaimed job
+};
@@ -179,6 +179,15 @@ public:
      */
     RuntimeSkeleton* getSkeleton() { return m_skeleton.get(); }
 
+    /**
+     * @brief Get a loaded animation clip (e.g. to compile it into an AnimationBatch)
+     * @return Clip, or nullptr if no clip with that name was loaded
+     */
+    const AnimationClip* getAnimation(const std::string& clipName) const {
+        auto it = m_animations.find(clipName);
+        return it != m_animations.end() ? &it->second : nullptr;
+    }
+
     /**
      * @brief Get bone count
      */
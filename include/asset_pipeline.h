@@ -0,0 +1,145 @@
+/**
+ * @file asset_pipeline.h
+ * @brief Shared helpers for parallel, cached asset loading
+ *
+ * Used by the block, structure and biome registries and the texture atlas:
+ * - parallelFor(): fans independent per-file work (YAML parse, PNG decode,
+ *   content hashing) out over all cores; the caller works too
+ * - loadYamlFiles(): parses a file list in parallel, preserving order so
+ *   registries still assign IDs deterministically on one thread afterwards
+ * - hashFile()/hashBytes(): 64-bit FNV-1a content hashes for bake keys and
+ *   the pipeline cache checksum
+ * - MappedFile: read-only memory mapping of baked blobs (warm starts copy
+ *   straight from the page cache into staging memory)
+ * - writeFileAtomic(): temp file + rename, so a crash never leaves a torn blob
+ *   (bakes and the pipeline cache)
+ *
+ * Baked blobs live under BAKE_DIRECTORY and are safe to delete at any time.
+ *
+ * Created: 2025-11-28
+ */
+
+#pragma once
+
+#include <yaml-cpp/yaml.h>
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <filesystem>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace AssetPipeline {
+
+constexpr const char* BAKE_DIRECTORY = "cache";
+constexpr uint64_t HASH_SEED = 14695981039346656037ull;  ///< FNV-1a offset basis
+
+/**
+ * @brief Runs fn(i) for every i in [0, count) across worker threads
+ *
+ * Items are claimed one at a time from an atomic counter (files vary wildly in
+ * cost). The first exception thrown by fn is rethrown after all workers finish.
+ */
+template <typename Fn>
+void parallelFor(size_t count, Fn&& fn) {
+    if (count == 0) return;
+
+    const unsigned int hw = std::max(1u, std::thread::hardware_concurrency());
+    const size_t workerCount = std::min<size_t>(count, hw) - 1;  // Caller is a worker too
+
+    std::atomic<size_t> next{0};
+    std::exception_ptr firstError;
+    std::mutex errorMutex;
+
+    auto work = [&]() {
+        for (size_t i = next.fetch_add(1); i < count; i = next.fetch_add(1)) {
+            try {
+                fn(i);
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(errorMutex);
+                if (!firstError) firstError = std::current_exception();
+            }
+        }
+    };
+
+    std::vector<std::thread> workers;
+    workers.reserve(workerCount);
+    for (size_t w = 0; w < workerCount; w++) {
+        workers.emplace_back(work);
+    }
+    work();
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    if (firstError) {
+        std::rethrow_exception(firstError);
+    }
+}
+
+/**
+ * @brief Result of parsing one YAML file
+ */
+struct ParsedYaml {
+    std::filesystem::path path;
+    YAML::Node doc;      ///< Null if parsing failed
+    std::string error;   ///< Parser message if parsing failed
+};
+
+/**
+ * @brief Parses YAML files in parallel
+ * @return One entry per input path, in input order
+ */
+std::vector<ParsedYaml> loadYamlFiles(const std::vector<std::filesystem::path>& paths);
+
+/// FNV-1a over a byte range, chained from @p seed
+uint64_t hashBytes(const void* data, size_t size, uint64_t seed = HASH_SEED);
+
+/// Hashes a string's bytes (plus its length, so concatenations don't collide)
+uint64_t hashString(const std::string& str, uint64_t seed = HASH_SEED);
+
+/**
+ * @brief Content hash of a file
+ * @param exists Set to false if the file could not be read
+ */
+uint64_t hashFile(const std::string& path, bool* exists = nullptr);
+
+/**
+ * @brief Writes a file via temp file + rename, creating parent directories
+ * @param chunks Byte ranges written back to back
+ */
+bool writeFileAtomic(const std::string& path, const std::vector<std::pair<const void*, size_t>>& chunks);
+
+/**
+ * @brief Read-only memory mapping of a whole file
+ */
+class MappedFile {
+public:
+    MappedFile() = default;
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    /// Maps @p path; returns false (and stays closed) if missing or empty
+    bool open(const std::string& path);
+    void close();
+
+    const uint8_t* data() const { return m_data; }
+    size_t size() const { return m_size; }
+    bool isOpen() const { return m_data != nullptr; }
+
+private:
+    const uint8_t* m_data = nullptr;
+    size_t m_size = 0;
+#ifdef _WIN32
+    void* m_file = nullptr;
+    void* m_mapping = nullptr;
+#endif
+};
+
+}  // namespace AssetPipeline
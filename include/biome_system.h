@@ -10,6 +10,7 @@
 // Forward declarations
 class VulkanRenderer;
 struct TreeTemplate;
+namespace YAML { class Node; }
 
 /**
  * Represents the location where a biome can spawn
@@ -49,6 +50,7 @@ struct Biome {
     int biome_rarity_weight = 50;        // 1-100: how common the biome is (higher = more common)
     std::string parent_biome;            // Parent biome name (for variants based on age/activity)
     float height_multiplier = 1.0f;      // Terrain height multiplier (1.0 = normal, 2.0 = double height)
+    bool smooth_terrain = false;         // Full-detail chunks mesh smooth_terrain blocks with surface nets
 
     // Vegetation
     bool trees_spawn = true;             // Can trees spawn in this biome
@@ -167,8 +169,8 @@ public:
 private:
     BiomeRegistry() = default;
 
-    // Load a single biome from a YAML file
-    bool loadBiomeFromFile(const std::string& filepath);
+    // Load a single biome from an already-parsed YAML document (filepath is for messages)
+    bool loadBiomeFromNode(const YAML::Node& doc, const std::string& filepath);
 
     // Parse biome spawn location from string
     BiomeSpawnLocation parseSpawnLocation(const std::string& location_str);
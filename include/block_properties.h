@@ -0,0 +1,123 @@
+/**
+ * @file block_properties.h
+ * @brief Flat structure-of-arrays block property table for hot-path lookups
+ *
+ * BlockRegistry::get() returns a ~600-byte BlockDefinition (strings, YAML node,
+ * seven FaceTextures) and throws on unknown IDs, so the mesher, lighting and
+ * water code paid a bounds check, a cold cache line and a try/catch per block.
+ *
+ * This table is compiled once at the end of BlockRegistry::loadBlocks() and is
+ * immutable afterwards (safe to read from any thread without locking):
+ * - flags:      1 byte per ID (opaque, transparent, liquid, emissive, solid, ...)
+ * - lightLevel: 1 byte per ID
+ * - faceLayers: 6 texture array layers per ID, FaceDirection order,
+ *               already resolved for cube maps and clamped to the layer count
+ * - tint:       1 byte per ID (CompressedVertex tint index)
+ *
+ * Every accessor is inline and no-throw: negative, out-of-range and unregistered
+ * (gap) IDs read as flags 0, which callers treat like air.
+ *
+ * Created: 2025-11-28
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+struct BlockDefinition;
+
+/**
+ * @brief Per-ID property bits
+ */
+namespace BlockFlags {
+    constexpr uint8_t VALID       = 1 << 0;  ///< Registered block (not a gap in the ID range)
+    constexpr uint8_t SOLID       = 1 << 1;  ///< Registered, not air, not liquid (culls neighbor faces)
+    constexpr uint8_t OPAQUE      = 1 << 2;  ///< transparency == 0 (blocks skylight)
+    constexpr uint8_t TRANSPARENT = 1 << 3;  ///< transparency > 0 (leaves, glass, water)
+    constexpr uint8_t LIQUID      = 1 << 4;
+    constexpr uint8_t EMISSIVE    = 1 << 5;  ///< isEmissive && lightLevel > 0
+    constexpr uint8_t GRAVITY     = 1 << 6;  ///< Falls when unsupported (sand, gravel)
+    constexpr uint8_t CUBE_MAP    = 1 << 7;  ///< Faces use different texture layers
+}
+
+/**
+ * @brief Immutable SoA property table indexed by block ID
+ */
+class BlockPropertyTable {
+public:
+    /**
+     * @brief Rebuilds the table from registry definitions
+     *
+     * @param defs Definitions indexed by ID (entries with id == -1 are gaps)
+     * @param layerCount Texture array layers used to clamp face layers (0 = no textures)
+     */
+    void build(const std::vector<BlockDefinition>& defs, int layerCount);
+
+    /// Number of IDs covered (registry count at build time)
+    int size() const { return static_cast<int>(m_flags.size()); }
+
+    /**
+     * @brief Gets the property bits for an ID (0 for air and unknown IDs)
+     */
+    uint8_t flags(int id) const {
+        return static_cast<uint32_t>(id) < m_flags.size() ? m_flags[id] : 0;
+    }
+
+    bool isValid(int id) const { return (flags(id) & BlockFlags::VALID) != 0; }
+    bool isSolid(int id) const { return (flags(id) & BlockFlags::SOLID) != 0; }
+    bool isOpaque(int id) const { return (flags(id) & BlockFlags::OPAQUE) != 0; }
+    bool isTransparent(int id) const { return (flags(id) & BlockFlags::TRANSPARENT) != 0; }
+    bool isLiquid(int id) const { return (flags(id) & BlockFlags::LIQUID) != 0; }
+    bool isEmissive(int id) const { return (flags(id) & BlockFlags::EMISSIVE) != 0; }
+    bool hasGravity(int id) const { return (flags(id) & BlockFlags::GRAVITY) != 0; }
+
+    /**
+     * @brief Checks if an ID receives random ticks (false for unknown IDs)
+     */
+    bool hasRandomTick(int id) const {
+        return static_cast<uint32_t>(id) < m_randomTick.size() && m_randomTick[id] != 0;
+    }
+
+    /// True if any registered block receives random ticks (lets BlockTickSystem skip sampling)
+    bool anyRandomTick() const { return m_anyRandomTick; }
+
+    /**
+     * @brief Checks if an ID is smoothed in smooth terrain chunks (false for unknown IDs)
+     */
+    bool isSmooth(int id) const {
+        return static_cast<uint32_t>(id) < m_smooth.size() && m_smooth[id] != 0;
+    }
+
+    /**
+     * @brief Gets the emitted light level (0-15, 0 for unknown IDs)
+     */
+    uint8_t lightLevel(int id) const {
+        return static_cast<uint32_t>(id) < m_lightLevel.size() ? m_lightLevel[id] : 0;
+    }
+
+    /**
+     * @brief Gets the CompressedVertex tint index (TINT_WATER for liquids, else TINT_WHITE)
+     */
+    uint8_t tint(int id) const {
+        return static_cast<uint32_t>(id) < m_tint.size() ? m_tint[id] : 0;
+    }
+
+    /**
+     * @brief Gets the texture array layer for one face of a block
+     *
+     * @param id Block ID (must be valid - check flags first)
+     * @param face Face index in FaceDirection order (+X, -X, +Y, -Y, +Z, -Z)
+     * @return Layer index (stored as-is in CompressedVertex)
+     */
+    uint16_t faceLayer(int id, int face) const { return m_faceLayers[id * 6 + face]; }
+
+private:
+    std::vector<uint8_t> m_flags;           ///< BlockFlags bits per ID
+    std::vector<uint8_t> m_lightLevel;      ///< Emission level per ID
+    std::vector<uint8_t> m_tint;            ///< Vertex tint index per ID
+    std::vector<uint16_t> m_faceLayers;     ///< 6 texture array layers per ID
+    std::vector<uint8_t> m_randomTick;      ///< 1 if the ID receives random ticks
+    std::vector<uint8_t> m_smooth;          ///< 1 if the ID is surface-nets meshed (opaque solids only)
+    bool m_anyRandomTick = false;
+};
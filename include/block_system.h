@@ -13,6 +13,7 @@
 #include <glm/glm.hpp>        // for glm::vec3
 #include <yaml-cpp/yaml.h>   // for YAML::Node
 #include <imgui.h>            // for ImGui rendering
+#include "block_properties.h"
 
 // Block ID constants
 namespace BlockID {
@@ -56,11 +57,12 @@ struct BlockDefinition {
     /**
      * @brief Texture coordinates for a single block face
      *
-     * Specifies position in texture atlas and optional variation.
+     * Specifies position in texture atlas, layer in the texture array and optional variation.
      */
     struct FaceTexture {
         int atlasX = 0;                ///< X position in atlas grid (0, 1, 2, ...)
         int atlasY = 0;                ///< Y position in atlas grid (0, 1, 2, ...)
+        int layer = 0;                 ///< Layer in the block texture array (world rendering)
         float variation = 1.0f;        ///< Texture variation (1.0 = no variation, >1.0 = zoomed)
     };
 
@@ -79,6 +81,8 @@ struct BlockDefinition {
     // ========== Gameplay Properties ==========
     int durability = 0;                ///< How hard the block is to break
     bool affectedByGravity = false;    ///< If true, block falls (like sand)
+    bool randomTick = false;           ///< If true, receives random ticks (on_update, e.g. crop growth)
+    bool smoothTerrain = false;        ///< If true, surface-nets meshed in smooth terrain chunks (see chunk_smooth.h)
     int flammability = 0;              ///< How easily block catches fire
     float transparency = 0.0f;         ///< Transparency (0=opaque, 1=fully transparent)
     bool isLiquid = false;             ///< If true, no outline when targeting
@@ -154,6 +158,11 @@ struct BlockDefinition {
  * - Each texture is resized to 64x64 pixels
  * - Atlas is organized as an NxN grid
  * - UV coordinates are computed based on atlas position
+ * - Used for ImGui block icons; the world samples the texture array
+ *
+ * Texture Array System (see texture_array.h):
+ * - One 64-128px layer per unique texture, with baked mip chains
+ * - Vertices carry the layer index; greedy quads tile with REPEAT addressing
  *
  * Usage:
  * @code
@@ -238,6 +247,30 @@ public:
      */
     int getAtlasGridSize() const { return m_atlasGridSize; }
 
+    /**
+     * @brief Whether the last atlas build was served from the baked cache
+     * @return True on a warm start (no textures decoded)
+     */
+    bool isAtlasFromCache() const { return m_atlasFromCache; }
+
+    // ========== Texture Array Access ==========
+
+    /**
+     * @brief Gets the block texture array view (VK_IMAGE_VIEW_TYPE_2D_ARRAY)
+     * @return Image view, or VK_NULL_HANDLE if no textures were loaded
+     */
+    VkImageView getTextureArrayView() const { return m_layerImageView; }
+
+    /**
+     * @brief Gets the texture array sampler (REPEAT addressing, all mip levels)
+     */
+    VkSampler getTextureArraySampler() const { return m_layerSampler; }
+
+    /**
+     * @brief Gets the number of texture array layers (0 before the array is built)
+     */
+    int getTextureLayerCount() const { return m_layerCount; }
+
     // ========== Query Methods ==========
     // Used by targeting system and UI
 
@@ -273,6 +306,18 @@ public:
      */
     const std::vector<int>& getEmissiveBlockIDs() const { return m_emissiveBlockIDs; }
 
+    /**
+     * @brief Gets the flat property table for hot-path lookups
+     *
+     * PERFORMANCE: Meshing, lighting and water loops should read flags, light
+     * levels and atlas cells from here instead of get() (no throw, no bounds
+     * branch beyond one unsigned compare, 1-2 bytes per ID instead of a full
+     * BlockDefinition). Rebuilt by loadBlocks(); immutable afterwards.
+     *
+     * @return Reference to the property table (empty until blocks are loaded)
+     */
+    const BlockPropertyTable& properties() const { return m_properties; }
+
 private:
     /**
      * @brief Private constructor (singleton pattern)
@@ -285,15 +330,31 @@ private:
      * @brief Builds the texture atlas from loaded block textures
      *
      * Packs all block textures into a single GPU texture for efficient rendering.
+     * Textures are decoded in parallel and the finished atlas is baked to
+     * cache/block_atlas.bin, keyed by the face references and PNG contents;
+     * a matching bake is memory-mapped and uploaded without decoding. The
+     * mipmapped texture array is baked the same way to cache/block_layers.bin.
      *
      * @param renderer Vulkan renderer for atlas creation
+     * @param docsByID Parsed YAML document per block ID (null for empty slots)
+     */
+    void buildTextureAtlas(VulkanRenderer* renderer, const std::vector<YAML::Node>& docsByID);
+
+    /**
+     * @brief Uploads the block texture array (layers with baked mip chains)
+     *
+     * @param renderer Vulkan renderer for image creation
+     * @param pixels Layer-major mip chains (TextureArray layout)
+     * @param layerSize Level 0 edge in pixels
+     * @param layerCount Number of layers (at least 1)
      */
-    void buildTextureAtlas(VulkanRenderer* renderer);
+    void uploadTextureArray(VulkanRenderer* renderer, const uint8_t* pixels, int layerSize, int layerCount);
 
     // ========== Data Storage ==========
     std::vector<BlockDefinition> m_defs;           ///< Block definitions indexed by ID
     std::unordered_map<std::string,int> m_nameToID; ///< Name to ID lookup
     std::vector<int> m_emissiveBlockIDs;           ///< Cached list of emissive block IDs (for fast lighting scan)
+    BlockPropertyTable m_properties;               ///< Flat per-ID properties (built after loading)
 
     // ========== Texture Atlas ==========
     VkImage m_atlasImage = VK_NULL_HANDLE;         ///< Combined texture atlas
@@ -301,6 +362,14 @@ private:
     VkImageView m_atlasImageView = VK_NULL_HANDLE; ///< Atlas image view
     VkSampler m_atlasSampler = VK_NULL_HANDLE;     ///< Atlas sampler
     int m_atlasGridSize = 0;                       ///< Grid size (NxN)
+    bool m_atlasFromCache = false;                 ///< Last build used the baked atlas
+
+    // ========== Texture Array ==========
+    VkImage m_layerImage = VK_NULL_HANDLE;         ///< One layer per unique texture, full mip chains
+    VkDeviceMemory m_layerMemory = VK_NULL_HANDLE; ///< Texture array GPU memory
+    VkImageView m_layerImageView = VK_NULL_HANDLE; ///< 2D array view
+    VkSampler m_layerSampler = VK_NULL_HANDLE;     ///< Repeat, mipmapped sampler
+    int m_layerCount = 0;                          ///< Layers in the array
 };
 
 /**
@@ -0,0 +1,199 @@
+/**
+ * @file block_tick.h
+ * @brief Hierarchical timing wheel for per-chunk scheduled block ticks
+ *
+ * Each chunk owns one wheel of (local block index, block ID, due tick) entries.
+ * Three levels of 64 slots cover 1 / 64 / 4096 ticks per slot (~3.6 hours at
+ * 20 ticks/s); anything further out waits in an overflow list.
+ *
+ * - schedule: O(1) (duplicate (index, block) pairs are ignored, like Minecraft)
+ * - advance:  O(1) + due entries; higher slots cascade down every 64 / 4096 ticks
+ *
+ * Time is wheel-local: a wheel only advances while its chunk is loaded, so
+ * pending ticks pause while the chunk sits in the cache or on disk. serialize()
+ * stores remaining delays, which is all a chunk save needs.
+ *
+ * Not thread-safe; Chunk guards its wheel with m_tickMutex.
+ *
+ * Created: 2025-11-28
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <unordered_set>
+#include <vector>
+
+/**
+ * @brief A pending block tick inside one chunk
+ */
+struct ScheduledTick {
+    uint16_t localIndex;  ///< Block index inside the chunk (Chunk::tickIndex)
+    uint16_t blockID;     ///< Block the tick was scheduled for (stale if the block changed)
+    uint32_t due;         ///< Wheel-local tick at which it fires
+};
+
+class ChunkTickWheel {
+public:
+    static constexpr uint32_t SLOT_BITS = 6;
+    static constexpr uint32_t SLOTS = 1u << SLOT_BITS;   ///< Slots per level
+    static constexpr uint32_t LEVELS = 3;
+    static constexpr uint32_t HORIZON = 1u << (SLOT_BITS * LEVELS);  ///< 262144 ticks; later entries overflow
+
+    bool empty() const { return m_count == 0; }
+    size_t size() const { return m_count; }
+
+    /// Wheel-local tick the next advance() processes
+    uint32_t now() const { return m_now; }
+
+    void clear() {
+        for (auto& slot : m_slots) slot.clear();
+        m_overflow.clear();
+        m_pending.clear();
+        m_count = 0;
+        m_now = 0;
+    }
+
+    /**
+     * @brief Schedules a tick delayTicks from now (0 is treated as 1)
+     *
+     * A delay of 1 fires on the next advance(), N on the Nth.
+     *
+     * @return false if the same block at the same index is already pending
+     */
+    bool schedule(uint16_t localIndex, uint16_t blockID, uint32_t delayTicks) {
+        if (!m_pending.insert(pendingKey(localIndex, blockID)).second) {
+            return false;
+        }
+        if (delayTicks == 0) {
+            delayTicks = 1;
+        }
+        place({localIndex, blockID, m_now + delayTicks - 1});
+        m_count++;
+        return true;
+    }
+
+    /**
+     * @brief Processes one tick: appends every entry due now to out, then moves time forward
+     */
+    void advance(std::vector<ScheduledTick>& out) {
+        if (m_count == 0) {
+            m_now++;  // Nothing pending - just keep time moving
+            return;
+        }
+
+        // Cascade from the top: a level-N slot is emptied when all lower bits wrap to zero
+        if ((m_now & (SLOTS * SLOTS - 1)) == 0) {
+            cascade(slotIndex(2, (m_now >> (2 * SLOT_BITS)) & (SLOTS - 1)));
+            if (!m_overflow.empty()) {
+                pullOverflow();
+            }
+        }
+        if ((m_now & (SLOTS - 1)) == 0) {
+            cascade(slotIndex(1, (m_now >> SLOT_BITS) & (SLOTS - 1)));
+        }
+
+        std::vector<ScheduledTick>& slot = m_slots[slotIndex(0, m_now & (SLOTS - 1))];
+        for (const ScheduledTick& tick : slot) {
+            m_pending.erase(pendingKey(tick.localIndex, tick.blockID));
+            out.push_back(tick);
+        }
+        m_count -= slot.size();
+        slot.clear();
+        m_now++;
+    }
+
+    /**
+     * @brief Appends [count][index, block, remaining delay]... (little-endian, 8 bytes per entry)
+     */
+    void serialize(std::vector<uint8_t>& output) const {
+        appendU32(output, static_cast<uint32_t>(m_count));
+        auto write = [&](const ScheduledTick& tick) {
+            appendU16(output, tick.localIndex);
+            appendU16(output, tick.blockID);
+            appendU32(output, tick.due - m_now + 1);  // As a schedule() delay
+        };
+        for (const auto& slot : m_slots) {
+            for (const ScheduledTick& tick : slot) write(tick);
+        }
+        for (const ScheduledTick& tick : m_overflow) write(tick);
+    }
+
+    /**
+     * @brief Replaces the wheel contents with serialized entries
+     * @return false if the data is truncated (the wheel is left empty)
+     */
+    bool deserialize(const uint8_t* data, size_t size) {
+        clear();
+        if (size == 0) {
+            return true;  // Chunk saved with nothing pending
+        }
+        uint32_t count;
+        if (size < sizeof(uint32_t)) return false;
+        std::memcpy(&count, data, sizeof(uint32_t));
+        if (size < sizeof(uint32_t) + static_cast<size_t>(count) * 8) return false;
+
+        const uint8_t* entry = data + sizeof(uint32_t);
+        for (uint32_t i = 0; i < count; i++, entry += 8) {
+            uint16_t localIndex, blockID;
+            uint32_t delay;
+            std::memcpy(&localIndex, entry, sizeof(uint16_t));
+            std::memcpy(&blockID, entry + 2, sizeof(uint16_t));
+            std::memcpy(&delay, entry + 4, sizeof(uint32_t));
+            schedule(localIndex, blockID, delay);
+        }
+        return true;
+    }
+
+private:
+    static uint32_t pendingKey(uint16_t localIndex, uint16_t blockID) {
+        return (static_cast<uint32_t>(localIndex) << 16) | blockID;
+    }
+
+    static size_t slotIndex(uint32_t level, uint32_t slot) { return level * SLOTS + slot; }
+
+    void place(const ScheduledTick& tick) {
+        const uint32_t delta = tick.due - m_now;
+        if (delta < SLOTS) {
+            m_slots[slotIndex(0, tick.due & (SLOTS - 1))].push_back(tick);
+        } else if (delta < SLOTS * SLOTS) {
+            m_slots[slotIndex(1, (tick.due >> SLOT_BITS) & (SLOTS - 1))].push_back(tick);
+        } else if (delta < HORIZON) {
+            m_slots[slotIndex(2, (tick.due >> (2 * SLOT_BITS)) & (SLOTS - 1))].push_back(tick);
+        } else {
+            m_overflow.push_back(tick);
+        }
+    }
+
+    void cascade(size_t slot) {
+        if (m_slots[slot].empty()) return;
+        std::vector<ScheduledTick> entries;
+        entries.swap(m_slots[slot]);
+        for (const ScheduledTick& tick : entries) place(tick);
+    }
+
+    void pullOverflow() {
+        std::vector<ScheduledTick> entries;
+        entries.swap(m_overflow);
+        for (const ScheduledTick& tick : entries) place(tick);
+    }
+
+    static void appendU16(std::vector<uint8_t>& output, uint16_t value) {
+        const uint8_t* bytes = reinterpret_cast<const uint8_t*>(&value);
+        output.insert(output.end(), bytes, bytes + sizeof(uint16_t));
+    }
+
+    static void appendU32(std::vector<uint8_t>& output, uint32_t value) {
+        const uint8_t* bytes = reinterpret_cast<const uint8_t*>(&value);
+        output.insert(output.end(), bytes, bytes + sizeof(uint32_t));
+    }
+
+    std::array<std::vector<ScheduledTick>, SLOTS * LEVELS> m_slots;
+    std::vector<ScheduledTick> m_overflow;        ///< Due beyond HORIZON (re-placed every 4096 ticks)
+    std::unordered_set<uint32_t> m_pending;       ///< (index, block) keys for duplicate suppression
+    size_t m_count = 0;
+    uint32_t m_now = 0;
+};
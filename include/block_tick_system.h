@@ -0,0 +1,142 @@
+/**
+ * @file block_tick_system.h
+ * @brief Scheduled and random block ticks driven by per-chunk timing wheels
+ *
+ * Blocks schedule a tick N game ticks ahead (falling sand, scripted
+ * TRIGGER_UPDATE with a delay); each chunk keeps its pending ticks in a
+ * ChunkTickWheel that is saved with the chunk. On top of that, chunks receive a
+ * few random ticks per game tick for blocks flagged `random_tick: true`.
+ *
+ * Each game tick (20/s) runs in two phases:
+ * 1. Collect - chunks with pending ticks or with random-tick blocks (per their
+ *    brick mask, see chunk_bricks.h) are processed in batches by a few
+ *    persistent worker threads plus the main thread. Workers only read blocks
+ *    and advance their own chunk's wheel; the result per chunk is a list of
+ *    block moves and BlockUpdateEvents.
+ * 2. Apply - the main thread validates and performs the moves, reschedules
+ *    follow-up ticks and dispatches the events. Touched chunks are queued once
+ *    per frame, however many ticks ran, on the WorldStreaming mesh workers.
+ *
+ * Fluids stay in WaterSimulation; this system does not tick liquid blocks.
+ *
+ * Created: 2025-11-28
+ */
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+#include <glm/glm.hpp>
+#include "block_tick.h"
+
+class World;
+class Chunk;
+class VulkanRenderer;
+class WorldStreaming;
+
+class BlockTickSystem {
+public:
+    static constexpr int TICKS_PER_SECOND = 20;          ///< Game tick rate
+    static constexpr int MAX_TICKS_PER_FRAME = 4;        ///< Catch-up cap (extra time is dropped)
+    static constexpr int RANDOM_TICKS_PER_CHUNK = 24;    ///< Samples per 32^3 chunk (3 per 16^3 section)
+    static constexpr uint32_t FALL_DELAY = 2;            ///< Ticks between gravity block steps
+    static constexpr unsigned int MAX_WORKERS = 4;       ///< Collect threads besides the main thread
+
+    /**
+     * @brief Constructs the tick system for a world
+     *
+     * @param world Pointer to the world (not owned, must outlive BlockTickSystem)
+     */
+    explicit BlockTickSystem(World* world);
+
+    /**
+     * @brief Stops and joins the collect workers
+     */
+    ~BlockTickSystem();
+
+    BlockTickSystem(const BlockTickSystem&) = delete;
+    BlockTickSystem& operator=(const BlockTickSystem&) = delete;
+
+    /**
+     * @brief Schedules a block tick (thread-safe)
+     *
+     * The tick fires only if the block at pos is still blockID by then.
+     *
+     * @param pos World block coordinates
+     * @param blockID Block to tick
+     * @param delayTicks Game ticks from now (0 is treated as 1)
+     * @return False if the chunk isn't loaded or the tick is already pending
+     */
+    bool scheduleTick(const glm::ivec3& pos, int blockID, uint32_t delayTicks);
+
+    /**
+     * @brief Schedules the ticks a block change implies (gravity blocks at and above pos)
+     *
+     * Called by World::breakBlock/placeBlock after the block is written.
+     */
+    void onBlockChanged(const glm::ivec3& pos);
+
+    /**
+     * @brief Runs the game ticks due this frame (main thread)
+     *
+     * @param deltaTime Frame time in seconds
+     * @param renderer Renderer for uploading re-meshed chunks (sync fallback only)
+     * @param streaming WorldStreaming for async re-meshing (nullptr = sync fallback)
+     */
+    void update(float deltaTime, VulkanRenderer* renderer, WorldStreaming* streaming);
+
+    // ========== Statistics ==========
+
+    uint64_t getTickCount() const { return m_tickCount; }                ///< Game ticks run so far
+    size_t getLastActiveChunks() const { return m_lastActiveChunks; }    ///< Chunks processed by the last tick
+    size_t getLastUpdateCount() const { return m_lastUpdateCount; }      ///< Moves + events from the last tick
+
+private:
+    struct BlockMove {
+        glm::ivec3 from;
+        glm::ivec3 to;
+        int blockID;
+    };
+
+    /// Output of one chunk's collect phase (written by one worker only)
+    struct ChunkTickResult {
+        std::vector<BlockMove> moves;
+        std::vector<std::pair<glm::ivec3, int>> updates;  ///< BlockUpdateEvents (position, block)
+    };
+
+    void runTick(std::unordered_set<Chunk*>& dirtyChunks);
+    void startWorkers();
+    void workerThreadFunction();
+    void collectBatches();
+    void collectChunk(Chunk* chunk, bool randomTicks, std::vector<ScheduledTick>& due,
+                      ChunkTickResult& result) const;
+    void applyResults(std::vector<ChunkTickResult>& results, std::unordered_set<Chunk*>& dirtyChunks);
+    void markDirty(const glm::ivec3& pos, std::unordered_set<Chunk*>& dirtyChunks);
+
+    World* m_world;
+    float m_accumulator = 0.0f;
+    uint64_t m_tickCount = 0;
+    size_t m_lastActiveChunks = 0;
+    size_t m_lastUpdateCount = 0;
+
+    // ===== Collect workers (started on the first tick with enough active chunks) =====
+    std::vector<std::thread> m_workers;
+    std::mutex m_jobMutex;
+    std::condition_variable m_jobCV;                ///< Wakes workers for a new job or shutdown
+    std::condition_variable m_doneCV;               ///< Wakes the main thread when the workers finish
+    uint64_t m_jobGeneration = 0;                   ///< Bumped once per parallel collect
+    size_t m_workersBusy = 0;                       ///< Workers still on the current job
+    bool m_shuttingDown = false;
+
+    // Current job: written under m_jobMutex before the generation bump, read-only while workers run
+    const std::vector<Chunk*>* m_jobChunks = nullptr;
+    std::vector<ChunkTickResult>* m_jobResults = nullptr;
+    bool m_jobRandomTicks = false;
+    std::atomic<size_t> m_jobNext{0};               ///< Next unclaimed chunk index
+};
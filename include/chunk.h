@@ -12,14 +12,20 @@
 #include <mutex>
 #include <atomic>
 #include <algorithm>
+#include <chrono>
+#include <cmath>
 #include <vulkan/vulkan.h>
 #include <glm/glm.hpp>
 #include "voxelmath.h"
 #include "FastNoiseLite.h"
 #include "block_light.h"
+#include "block_tick.h"
+#include "chunk_bricks.h"
+#include "vulkan/upload_arena.h"
 
 // Forward declaration
 class VulkanRenderer;
+class StructureTemplate;
 
 /**
  * @brief Chunk lifecycle state machine for explicit state tracking
@@ -39,6 +45,11 @@ class VulkanRenderer;
  *   ACTIVE -> UNLOADING (chunk being removed)
  *   UNLOADING -> UNLOADED (returned to pool)
  *
+ * Shortcuts: GENERATED -> AWAITING_MESH (decoration skipped or deferred),
+ * MESHING -> ACTIVE (fully occluded), ACTIVE -> AWAITING_MESH (remesh).
+ * WorldStreaming advances the state with tryTransition at each pipeline step;
+ * every successful transition is recorded by ChunkTrace while tracing is on.
+ *
  * @note Use atomic operations for thread-safe state transitions
  */
 enum class ChunkState : uint8_t {
@@ -87,35 +98,41 @@ inline const char* chunkStateToString(ChunkState state) {
  *   posXY (uint32_t = 4 bytes): Packed position X and Y
  *     Bits 0-15:  Position X (int16, range ±32767)
  *     Bits 16-31: Position Y (int16, range ±32767)
- *   posZAtlas (uint32_t = 4 bytes): Packed position Z and atlas coords
+ *   posZAtlas (uint32_t = 4 bytes): Packed position Z and texture layer
  *     Bits 0-15:  Position Z (int16, range ±32767)
- *     Bits 16-23: Atlas X cell (0-255)
- *     Bits 24-31: Atlas Y cell (0-255)
+ *     Bits 16-31: Texture array layer (0-65535, see texture_array.h)
  *   packedB (uint32_t = 4 bytes): All other vertex data
- *     Bits 0-2:   Normal direction (0-5: +X, -X, +Y, -Y, +Z, -Z)
- *     Bits 3-7:   Quad width for UV tiling (0-31)
- *     Bits 8-12:  Quad height for UV tiling (0-31)
- *     Bits 13-14: Corner index (0-3)
- *     Bits 15-18: Sky light level (0-15)
- *     Bits 19-22: Block light level (0-15)
- *     Bits 23-26: Ambient occlusion (0-15)
- *     Bits 27-28: Color tint index (0-3)
- *     Bits 29-31: Reserved
+ *     Bits 0-3:   Previous block light level (0-15, light transition source)
+ *     Bits 4-8:   Quad width for UV tiling (0-31)
+ *     Bits 9-13:  Quad height for UV tiling (0-31)
+ *     Bits 14-15: Corner index (0-3)
+ *     Bits 16-19: Sky light level (0-15)
+ *     Bits 20-23: Block light level (0-15)
+ *     Bits 24-27: Ambient occlusion (0-15)
+ *     Bits 28-29: Color tint index (0-3)
+ *     Bit 30:     Far-LOD flag (fades against LOD distance, see chunk_lod.h)
+ *     Bit 31:     Horizon flag (RGB565 color in the layer bits, see horizon_renderer.h)
+ *
+ * SMOOTH TERRAIN (2025-11-28): Bits 30 and 31 both set mark a surface-nets vertex
+ * (see chunk_smooth.h). Its position is not on the block grid, so bits 0-11 hold
+ * 4-bit X/Y/Z fractions (1/16 block) added to the int16 position, bits 12-15 are
+ * unused and the texture is projected from world space in the fragment shader.
+ *
+ * LIGHT TRANSITIONS (2025-11-28): The vertex shader blends previous -> current
+ * block light by the per-draw ChunkPushConstants::lightBlend, replacing the
+ * per-voxel CPU interpolation. The old normal index (bits 0-2) made room - the
+ * shaders derive face normals from screen-space derivatives and never read it.
+ *
+ * TEXTURE ARRAY (2025-11-28): Bits 16-31 of posZAtlas used to hold an 8-bit atlas
+ * X/Y cell. They now hold the layer of the block texture array; quads tile by
+ * sampling (quad UV, layer) with REPEAT addressing instead of wrapping inside a cell.
  *
  * Memory savings: 48 bytes -> 12 bytes = 4x reduction!
  */
 struct CompressedVertex {
     uint32_t posXY;      ///< Position X (low 16) + Position Y (high 16)
-    uint32_t posZAtlas;  ///< Position Z (low 16) + Atlas X (bits 16-23) + Atlas Y (bits 24-31)
-    uint32_t packedB;    ///< Normal + QuadSize + Corner + Lighting + Tint
-
-    // Normal direction constants
-    static constexpr uint8_t NORMAL_POS_X = 0;
-    static constexpr uint8_t NORMAL_NEG_X = 1;
-    static constexpr uint8_t NORMAL_POS_Y = 2;
-    static constexpr uint8_t NORMAL_NEG_Y = 3;
-    static constexpr uint8_t NORMAL_POS_Z = 4;
-    static constexpr uint8_t NORMAL_NEG_Z = 5;
+    uint32_t posZAtlas;  ///< Position Z (low 16) + texture layer (high 16)
+    uint32_t packedB;    ///< Previous light + QuadSize + Corner + Lighting + Tint
 
     // Corner indices for UV calculation (matches cubeUVs order)
     // Side faces (V-flipped): vertex 0=CORNER_HEIGHT, 1=CORNER_BOTH, 2=CORNER_WIDTH, 3=CORNER_ORIGIN
@@ -131,29 +148,37 @@ struct CompressedVertex {
     static constexpr uint8_t TINT_FOLIAGE = 2;     // Foliage green
     static constexpr uint8_t TINT_GRASS = 3;       // Grass/leaves green
 
+    // Far-LOD marker (bit 30): set on downsampled terrain so the shader uses the LOD fade distance
+    static constexpr uint32_t FLAG_FAR_LOD = 1u << 30;
+
+    // Horizon marker (bit 31): heightfield terrain. The layer bits (posZAtlas 16-31)
+    // hold an RGB565 vertex color instead of a texture layer; no texture is sampled.
+    static constexpr uint32_t FLAG_HORIZON = 1u << 31;
+
+    // Smooth terrain marker (bits 30 + 31): see packSmooth()
+    static constexpr uint32_t FLAG_SMOOTH = FLAG_FAR_LOD | FLAG_HORIZON;
+
     /**
      * @brief Pack vertex data into compressed format
      * @param worldX World X position (stored as int16)
      * @param worldY World Y position (stored as int16)
      * @param worldZ World Z position (stored as int16)
-     * @param normalIndex Normal direction (0-5)
      * @param quadWidth Width of quad for UV tiling (0-31)
      * @param quadHeight Height of quad for UV tiling (0-31)
-     * @param atlasX Texture atlas X cell (0-255)
-     * @param atlasY Texture atlas Y cell (0-255)
+     * @param layer Texture array layer (0-65535)
      * @param cornerIndex Which corner of the quad (0-3)
      * @param skyLight Sky light level (0-15)
      * @param blockLight Block light level (0-15)
+     * @param prevBlockLight Block light before the last lighting change (0-15, = blockLight for none)
      * @param ao Ambient occlusion (0-15)
      * @param colorTint Color tint index (0-3)
      */
     static inline CompressedVertex pack(
         float worldX, float worldY, float worldZ,
-        uint8_t normalIndex,
         uint8_t quadWidth, uint8_t quadHeight,
-        uint8_t atlasX, uint8_t atlasY,
+        uint16_t layer,
         uint8_t cornerIndex,
-        uint8_t skyLight, uint8_t blockLight, uint8_t ao,
+        uint8_t skyLight, uint8_t blockLight, uint8_t prevBlockLight, uint8_t ao,
         uint8_t colorTint
     ) {
         CompressedVertex cv;
@@ -167,21 +192,68 @@ struct CompressedVertex {
         cv.posXY = (static_cast<uint32_t>(static_cast<uint16_t>(px)))
                  | (static_cast<uint32_t>(static_cast<uint16_t>(py)) << 16);
 
-        // Pack posZ and atlas coords into posZAtlas
+        // Pack posZ and texture layer into posZAtlas
         cv.posZAtlas = (static_cast<uint32_t>(static_cast<uint16_t>(pz)))
-                     | (static_cast<uint32_t>(atlasX) << 16)
-                     | (static_cast<uint32_t>(atlasY) << 24);
+                     | (static_cast<uint32_t>(layer) << 16);
 
         // Pack remaining data
-        cv.packedB = (static_cast<uint32_t>(normalIndex & 0x7))           // bits 0-2
-                   | (static_cast<uint32_t>(quadWidth & 0x1F) << 3)       // bits 3-7
-                   | (static_cast<uint32_t>(quadHeight & 0x1F) << 8)      // bits 8-12
-                   | (static_cast<uint32_t>(cornerIndex & 0x3) << 13)     // bits 13-14
-                   | (static_cast<uint32_t>(skyLight & 0xF) << 15)        // bits 15-18
-                   | (static_cast<uint32_t>(blockLight & 0xF) << 19)      // bits 19-22
-                   | (static_cast<uint32_t>(ao & 0xF) << 23)              // bits 23-26
-                   | (static_cast<uint32_t>(colorTint & 0x3) << 27);      // bits 27-28
+        cv.packedB = (static_cast<uint32_t>(prevBlockLight & 0xF))        // bits 0-3
+                   | (static_cast<uint32_t>(quadWidth & 0x1F) << 4)       // bits 4-8
+                   | (static_cast<uint32_t>(quadHeight & 0x1F) << 9)      // bits 9-13
+                   | (static_cast<uint32_t>(cornerIndex & 0x3) << 14)     // bits 14-15
+                   | (static_cast<uint32_t>(skyLight & 0xF) << 16)        // bits 16-19
+                   | (static_cast<uint32_t>(blockLight & 0xF) << 20)      // bits 20-23
+                   | (static_cast<uint32_t>(ao & 0xF) << 24)              // bits 24-27
+                   | (static_cast<uint32_t>(colorTint & 0x3) << 28);      // bits 28-29
+
+        return cv;
+    }
+
+    /**
+     * @brief Pack a smooth terrain vertex (off-grid position, no quad UVs)
+     *
+     * Positions are rounded to 1/16 block. There is no previous block light, so
+     * smooth vertices never take part in light transitions.
+     *
+     * @param worldX World X position
+     * @param worldY World Y position
+     * @param worldZ World Z position
+     * @param layer Texture array layer (0-65535)
+     * @param skyLight Sky light level (0-15)
+     * @param blockLight Block light level (0-15)
+     * @param ao Ambient occlusion (0-15)
+     * @param colorTint Color tint index (0-3)
+     */
+    static inline CompressedVertex packSmooth(
+        float worldX, float worldY, float worldZ,
+        uint16_t layer,
+        uint8_t skyLight, uint8_t blockLight, uint8_t ao,
+        uint8_t colorTint
+    ) {
+        // Split into int16 + 4-bit fraction (a fraction that rounds up to 16 carries)
+        auto split = [](float value, int16_t& whole) -> uint32_t {
+            const int fixed = static_cast<int>(std::lround(std::clamp(value, -32767.0f, 32766.0f) * 16.0f));
+            whole = static_cast<int16_t>(fixed >> 4);  // Arithmetic shift = floor for negatives
+            return static_cast<uint32_t>(fixed & 0xF);
+        };
+        int16_t px, py, pz;
+        const uint32_t fx = split(worldX, px);
+        const uint32_t fy = split(worldY, py);
+        const uint32_t fz = split(worldZ, pz);
 
+        CompressedVertex cv;
+        cv.posXY = (static_cast<uint32_t>(static_cast<uint16_t>(px)))
+                 | (static_cast<uint32_t>(static_cast<uint16_t>(py)) << 16);
+        cv.posZAtlas = (static_cast<uint32_t>(static_cast<uint16_t>(pz)))
+                     | (static_cast<uint32_t>(layer) << 16);
+        cv.packedB = fx                                                   // bits 0-3
+                   | (fy << 4)                                            // bits 4-7
+                   | (fz << 8)                                            // bits 8-11
+                   | (static_cast<uint32_t>(skyLight & 0xF) << 16)        // bits 16-19
+                   | (static_cast<uint32_t>(blockLight & 0xF) << 20)      // bits 20-23
+                   | (static_cast<uint32_t>(ao & 0xF) << 24)              // bits 24-27
+                   | (static_cast<uint32_t>(colorTint & 0x3) << 28)       // bits 28-29
+                   | FLAG_SMOOTH;                                         // bits 30-31
         return cv;
     }
 
@@ -209,7 +281,7 @@ struct CompressedVertex {
         attributeDescriptions[0].format = VK_FORMAT_R32_UINT;
         attributeDescriptions[0].offset = offsetof(CompressedVertex, posXY);
 
-        // posZAtlas (location = 1) - packed posZ and atlas coords as uint32
+        // posZAtlas (location = 1) - packed posZ and texture layer as uint32
         attributeDescriptions[1].binding = 0;
         attributeDescriptions[1].location = 1;
         attributeDescriptions[1].format = VK_FORMAT_R32_UINT;
@@ -330,6 +402,7 @@ class Chunk {
     friend class VulkanRenderer;
 
  static std::unique_ptr<FastNoiseLite> s_noise;  ///< Shared noise generator for terrain (RAII managed)
+ static std::atomic<UploadArena*> s_uploadArena;  ///< Arena mesh workers write into (null = CPU vectors)
 
 public:
     // ========== Static Configuration ==========
@@ -350,9 +423,22 @@ public:
      */
     static void cleanupNoise();
 
+    /**
+     * @brief Sets the upload arena finished meshes are written into
+     *
+     * With an arena, generateMesh() copies its output into a mapped arena slice and
+     * keeps no CPU-side mesh; uploads only record copy regions. Null (or a full arena)
+     * keeps meshes in CPU vectors and uploads through per-chunk staging buffers.
+     *
+     * @param arena Arena owned by the renderer, or nullptr before it is destroyed
+     */
+    static void setUploadArena(UploadArena* arena);
+
     static const int WIDTH = 32;   ///< Chunk width in blocks (X axis)
     static const int HEIGHT = 32;  ///< Chunk height in blocks (Y axis)
     static const int DEPTH = 32;   ///< Chunk depth in blocks (Z axis)
+    static_assert(WIDTH == ChunkBricks::CHUNK_SIZE && HEIGHT == ChunkBricks::CHUNK_SIZE && DEPTH == ChunkBricks::CHUNK_SIZE,
+                  "Brick occupancy assumes 32³ chunks");
 
     // ========== Construction ==========
 
@@ -390,19 +476,40 @@ public:
     /**
      * @brief Generates optimized mesh with face culling and LOD support
      *
-     * Creates vertex and index data for visible block faces only.
+     * Creates quad vertex data for visible block faces only (indices are implicit).
      * Performs face culling against adjacent chunks.
      * PERFORMANCE (2025-11-24): LOD reduces triangle count for distant chunks
      *
      * @param world World instance to query neighboring chunks
-     * @param callerHoldsLock If true, caller already holds world's chunk map lock (prevents deadlock)
-     * @param lodLevel Level of detail (0=full, 1=half, 2=quarter resolution)
+     * @param lodLevel Level of detail (0=full, 1=2x, 2=4x, 3=8x downsampled; -1=keep current level)
      * @note Must be called after all chunks are generated
+     * @note LOD levels > 0 build coarse quads with seam skirts (see chunk_lod.h)
+     * @note Smooth terrain chunks surface-net their smooth_terrain blocks (see chunk_smooth.h)
      */
-    void generateMesh(class World* world, bool callerHoldsLock = false, int lodLevel = 0);
+    void generateMesh(class World* world, int lodLevel = -1);
 
     /**
-     * @brief Creates Vulkan vertex and index buffers
+     * @brief Checks if the full-detail mesh uses smooth terrain
+     *
+     * True when the smooth_terrain convar is set or the biome at the chunk's center
+     * column has smooth_terrain: true. Smooth meshes read all 26 neighbors.
+     */
+    bool isSmoothTerrain(class World* world) const;
+
+    /**
+     * @brief Gets the LOD level of the current mesh
+     * @return 0 for full detail, 1-3 for downsampled far terrain
+     */
+    int getLodLevel() const { return m_lodLevel.load(std::memory_order_acquire); }
+
+    /**
+     * @brief Sets the LOD level used by the next generateMesh() call with lodLevel = -1
+     * @param lodLevel 0 for full detail, 1-3 for downsampled far terrain
+     */
+    void setLodLevel(int lodLevel) { m_lodLevel.store(lodLevel, std::memory_order_release); }
+
+    /**
+     * @brief Creates Vulkan vertex buffers
      *
      * Uploads mesh data to GPU. Only call if vertexCount > 0.
      *
@@ -411,11 +518,13 @@ public:
     void createVertexBuffer(VulkanRenderer* renderer);
 
     /**
-     * @brief Creates Vulkan vertex and index buffers in batched mode
+     * @brief Creates Vulkan vertex buffers in batched mode
      *
      * Like createVertexBuffer(), but uses batched buffer copying for better performance.
      * Must be called between renderer->beginBufferCopyBatch() and renderer->submitBufferCopyBatch().
      * After batch submission, call cleanupStagingBuffers() to clean up temporary staging buffers.
+     * Meshes stored in the upload arena need no staging buffers: only copy regions are recorded
+     * and the arena slice is handed to the batch.
      *
      * @param renderer Vulkan renderer for buffer creation
      */
@@ -440,10 +549,19 @@ public:
      */
     void destroyBuffers(VulkanRenderer* renderer);
 
+    /**
+     * @brief Drops a mesh that was never uploaded and marks the chunk for remeshing
+     *
+     * Frees the upload arena slice (or CPU vectors) of a finished mesh. Call before a
+     * chunk leaves the world: an unreleased slice pins the arena's ring tail.
+     */
+    void discardPendingMesh();
+
     /**
      * @brief Submits draw calls for this chunk
      *
-     * Binds vertex/index buffers and issues draw command.
+     * Binds the vertex buffer and issues the draw(s). The caller must have bound
+     * VulkanRenderer::getQuadIndexBuffer() (VK_INDEX_TYPE_UINT16).
      *
      * @param commandBuffer Vulkan command buffer for recording
      * @param transparent If true, renders transparent geometry; if false, renders opaque geometry
@@ -497,17 +615,29 @@ public:
     uint32_t getTransparentVertexCount() const { return m_transparentVertexCount; }
 
     /**
-     * @brief Gets the number of indices in this chunk's opaque mesh
+     * @brief Gets the number of indices to draw this chunk's opaque mesh
+     *
+     * Derived from the vertex count (6 per quad); no index data is stored per chunk.
+     * The indices come from the renderer's shared quad index buffer (quad_index.h).
+     *
      * @return Index count (0 if empty/no visible faces)
      */
     uint32_t getIndexCount() const { return m_indexCount; }
 
     /**
-     * @brief Gets the number of indices in this chunk's transparent mesh
+     * @brief Gets the number of indices to draw this chunk's transparent mesh
      * @return Transparent index count (0 if no transparent geometry)
      */
     uint32_t getTransparentIndexCount() const { return m_transparentIndexCount; }
 
+    /**
+     * @brief CPU-side opaque mesh (quad list, 4 vertices per quad)
+     *
+     * Only populated while the mesh has not been handed to an upload arena or
+     * uploaded to the GPU - i.e. when meshing without a renderer (tests, tools).
+     */
+    const std::vector<CompressedVertex>& getVertices() const { return m_vertices; }
+
     // ========== Indirect Drawing Getters (GPU Optimization) ==========
 
     /**
@@ -516,12 +646,6 @@ public:
      */
     VkDeviceSize getMegaBufferVertexOffset() const { return m_megaBufferVertexOffset; }
 
-    /**
-     * @brief Gets the index offset in the mega-buffer (for indirect drawing)
-     * @return Byte offset in opaque index mega-buffer
-     */
-    VkDeviceSize getMegaBufferIndexOffset() const { return m_megaBufferIndexOffset; }
-
     /**
      * @brief Gets the base vertex for indexed drawing (for indirect drawing)
      * @return Base vertex offset
@@ -534,12 +658,6 @@ public:
      */
     VkDeviceSize getMegaBufferTransparentVertexOffset() const { return m_megaBufferTransparentVertexOffset; }
 
-    /**
-     * @brief Gets the transparent index offset in the mega-buffer (for indirect drawing)
-     * @return Byte offset in transparent index mega-buffer
-     */
-    VkDeviceSize getMegaBufferTransparentIndexOffset() const { return m_megaBufferTransparentIndexOffset; }
-
     /**
      * @brief Gets the transparent base vertex for indexed drawing (for indirect drawing)
      * @return Transparent base vertex offset
@@ -593,6 +711,29 @@ public:
      */
     void setBlockMetadata(int x, int y, int z, uint8_t metadata);
 
+    /**
+     * @brief Writes the part of a template that falls inside this chunk
+     *
+     * PERFORMANCE (2025-11-28): Each span is clipped to the chunk once and
+     * filled directly into m_blocks under one lock; touched heightmap columns
+     * are rescanned once each. Does not regenerate the mesh or mark the chunk
+     * dirty (World::placeTemplate() does the latter).
+     *
+     * @param tmpl Compiled template
+     * @param origin Template-local (0,0,0) in this chunk's local coordinates
+     * @return Number of blocks written
+     */
+    int blitTemplate(const StructureTemplate& tmpl, const glm::ivec3& origin);
+
+    /**
+     * @brief Checks that every template block inside this chunk lands on air or replaceableID
+     *
+     * @param tmpl Compiled template
+     * @param origin Template-local (0,0,0) in this chunk's local coordinates
+     * @param replaceableID Block ID that may be overwritten besides air (e.g. grass for trees)
+     */
+    bool isTemplateClear(const StructureTemplate& tmpl, const glm::ivec3& origin, int replaceableID) const;
+
     // ========== Lighting ==========
 
     /**
@@ -626,42 +767,32 @@ public:
     void setSkyLight(int x, int y, int z, uint8_t value);
 
     /**
-     * @brief Gets interpolated sky light (smooth time-based transitions)
+     * @brief Gets the block light level captured when the current mesh was built
      *
-     * @param x Local X coordinate (0-31)
-     * @param y Local Y coordinate (0-31)
-     * @param z Local Z coordinate (0-31)
-     * @return Interpolated sky light level (0.0-15.0)
-     */
-    float getInterpolatedSkyLight(int x, int y, int z) const;
-
-    /**
-     * @brief Gets interpolated block light (smooth time-based transitions)
+     * Source value of the GPU light transition (see getLightTransitionBlend).
+     * Equals getBlockLight() until the chunk has been meshed once.
      *
      * @param x Local X coordinate (0-31)
      * @param y Local Y coordinate (0-31)
      * @param z Local Z coordinate (0-31)
-     * @return Interpolated block light level (0.0-15.0)
+     * @return Previous block light level (0-15), or 0 if out of bounds
      */
-    float getInterpolatedBlockLight(int x, int y, int z) const;
+    uint8_t getPreviousBlockLight(int x, int y, int z) const;
 
     /**
-     * @brief Updates interpolated lighting values toward target values
+     * @brief Gets the vertex shader blend factor for this chunk's light transition
      *
-     * Smoothly transitions lighting over time for natural-looking changes.
+     * 0.0 draws the block light of the previous mesh, 1.0 the current light.
+     * Ramps linearly over LIGHT_TRANSITION_SECONDS after the mesh is uploaded.
+     * MAIN THREAD ONLY (the start time is written by the upload functions).
      *
-     * @param deltaTime Time since last frame in seconds
-     * @param speed Interpolation speed multiplier (higher = faster transitions)
+     * @param now Frame timestamp
+     * @return Blend factor (0.0-1.0), 1.0 when no transition is running
      */
-    void updateInterpolatedLighting(float deltaTime, float speed = 5.0f);
+    float getLightTransitionBlend(std::chrono::steady_clock::time_point now) const;
 
-    /**
-     * @brief Initializes interpolated lighting to match current target values
-     *
-     * Call this after initial lighting calculation to avoid fade-in effect.
-     * Sets interpolated values = target values immediately (no transition).
-     */
-    void initializeInterpolatedLighting();
+    /// Duration of a block light transition (torch placed/broken)
+    static constexpr float LIGHT_TRANSITION_SECONDS = 0.5f;
 
     /**
      * @brief Sets the block light level at local chunk coordinates
@@ -820,6 +951,50 @@ public:
      */
     bool load(const std::string& worldPath);
 
+    /**
+     * @brief Encodes blocks, metadata and lighting with the chunk file codec
+     *
+     * Output is byte-identical to the file written by save() (RLE, version 4),
+     * so encoded chunks can be held in RAM and written to disk later without
+     * decoding (see ChunkCache warm tier).
+     *
+     * @param output Receives the encoded chunk (cleared first)
+     */
+    void encode(std::vector<uint8_t>& output) const;
+
+    /**
+     * @brief Decodes data produced by encode() or read from a chunk file
+     *
+     * Accepts all file versions (1-4). Coordinates must match this chunk.
+     * Rebuilds the heightmap and brick occupancy.
+     *
+     * @param input Encoded chunk data
+     * @return True on success, false on coordinate mismatch or corrupted data
+     */
+    bool decode(const std::vector<uint8_t>& input);
+
+    /**
+     * @brief Writes already-encoded chunk data to the chunk's file
+     * @param worldPath Path to world directory
+     * @param data Output of encode()
+     * @return True if the write succeeded
+     */
+    static bool writeEncoded(const std::string& worldPath, int chunkX, int chunkY, int chunkZ,
+                             const std::vector<uint8_t>& data);
+
+    /**
+     * @brief Deletes the chunk's file if it exists (empty chunks are not stored)
+     * @param worldPath Path to world directory
+     * @return True if no file remains
+     */
+    static bool removeSaved(const std::string& worldPath, int chunkX, int chunkY, int chunkZ);
+
+    /**
+     * @brief Estimates resident memory of this chunk (object + CPU mesh data)
+     * @return Size in bytes
+     */
+    size_t getMemoryUsage() const;
+
     // ========== Chunk Position ==========
 
     /**
@@ -862,10 +1037,9 @@ public:
      * Huge performance win for underground chunks!
      *
      * @param world World instance to query neighbors
-     * @param callerHoldsLock True if caller already holds World::m_chunkMapMutex (prevents deadlock)
      * @return True if chunk is fully occluded (all 6 neighbors are solid)
      */
-    bool isFullyOccluded(class World* world, bool callerHoldsLock = false) const;
+    bool isFullyOccluded(class World* world) const;
 
     // ========== Chunk Pooling ==========
 
@@ -882,17 +1056,54 @@ public:
      */
     void reset(int x, int y, int z);
 
+    // ========== Scheduled Block Ticks (2025-11-28) ==========
+
+    /// Packs local block coordinates into a ScheduledTick::localIndex (same layout as m_lightData)
+    static uint16_t tickIndex(int x, int y, int z) {
+        return static_cast<uint16_t>(x + y * WIDTH + z * WIDTH * HEIGHT);
+    }
+
+    /// Unpacks a ScheduledTick::localIndex into local block coordinates
+    static glm::ivec3 tickLocalPos(uint16_t index) {
+        return glm::ivec3(index % WIDTH, (index / WIDTH) % HEIGHT, index / (WIDTH * HEIGHT));
+    }
+
+    /**
+     * @brief Schedules a block tick in this chunk's timing wheel (thread-safe)
+     *
+     * @param x Local X coordinate (0-31)
+     * @param y Local Y coordinate (0-31)
+     * @param z Local Z coordinate (0-31)
+     * @param blockID Block expected at the position when the tick fires
+     * @param delayTicks Ticks from now (at BlockTickSystem::TICKS_PER_SECOND)
+     * @return False if out of bounds or already scheduled
+     */
+    bool scheduleTick(int x, int y, int z, int blockID, uint32_t delayTicks);
+
+    /**
+     * @brief Advances the timing wheel by one tick and appends the ticks now due (thread-safe)
+     */
+    void advanceTicks(std::vector<ScheduledTick>& due);
+
+    /// Checks for pending scheduled ticks without locking
+    bool hasPendingTicks() const { return m_pendingTickCount.load(std::memory_order_relaxed) > 0; }
+
+    /// Number of pending scheduled ticks
+    uint32_t getPendingTickCount() const { return m_pendingTickCount.load(std::memory_order_relaxed); }
+
     /**
      * @brief Checks if chunk is completely empty (all air)
      * @return True if all blocks are air, false otherwise
      */
-    bool isEmpty() const;
+    bool isEmpty() const { return m_bricks.isEmpty(); }
 
     /**
-     * @brief Deallocates interpolated lighting to save memory
-     * Called when chunk is unloaded to cache (saves 256KB per chunk)
+     * @brief 8³ brick occupancy (see chunk_bricks.h), kept current by every block write
+     *
+     * Lock-free read like m_blocks in the mesher: callers that scan blocks use it to
+     * skip EMPTY bricks (and OPAQUE ones when looking for non-solid blocks).
      */
-    void deallocateInterpolatedLighting();
+    const ChunkBricks& getBricks() const { return m_bricks; }
 
     // ========== Chunk State Machine ==========
 
@@ -953,6 +1164,9 @@ private:
     // ========== State Machine ==========
     std::atomic<ChunkState> m_state{ChunkState::UNLOADED}; ///< Current chunk lifecycle state (thread-safe)
 
+    // ========== Level of Detail ==========
+    std::atomic<int> m_lodLevel{0};         ///< Mesh LOD level (0 = full, 1-3 = downsampled far terrain)
+
     // ========== Position and Storage ==========
     int m_x, m_y, m_z;                      ///< Chunk coordinates in chunk space
     int m_blocks[WIDTH][HEIGHT][DEPTH];    ///< Block ID storage (32 KB)
@@ -963,70 +1177,91 @@ private:
     bool m_needsDecoration;                 ///< True if chunk is freshly generated and needs decoration
     bool m_hasLightingData;                 ///< True if chunk loaded with lighting data (Version 3), prevents re-initialization
     bool m_terrainReady;                    ///< STAGE 1 COMPLETE: Terrain generation finished (Minecraft-style multi-stage generation)
-    mutable bool m_isEmpty;                 ///< PERFORMANCE: Cached isEmpty state (avoids 32K block scans), updated on setBlock()
-    mutable bool m_isEmptyValid;            ///< True if m_isEmpty cache is valid
+    ChunkBricks m_bricks;                   ///< PERFORMANCE: 8³ brick occupancy (empty-space skipping), updated on every block write
+
+    // ========== Scheduled Ticks ==========
+    ChunkTickWheel m_tickWheel;             ///< Pending block ticks (persisted in chunk files, version 4)
+    mutable std::mutex m_tickMutex;         ///< Protects m_tickWheel (scheduling vs. tick workers vs. encode)
+    std::atomic<uint32_t> m_pendingTickCount{0};  ///< m_tickWheel.size() for lock-free polling
 
     // ========== Heightmap (PERFORMANCE: Fast sky light calculation) ==========
     std::array<int16_t, WIDTH * DEPTH> m_heightMap; ///< Highest solid block Y per XZ column (2 KB, 32x32 grid)
 
-    // ========== Interpolated Lighting (Smooth Time-Based Transitions) ==========
-    // MEMORY OPTIMIZATION (2025-11-25): Lazy-allocated to save 256KB per cached chunk
-    // Only allocated when chunk is actively rendering, deallocated when unloaded
-    struct InterpolatedLight {
-        float skyLight;    // Current interpolated sky light (0.0-15.0)
-        float blockLight;  // Current interpolated block light (0.0-15.0)
-        InterpolatedLight() : skyLight(0.0f), blockLight(0.0f) {}
-    };
-    using InterpolatedLightArray = std::array<InterpolatedLight, WIDTH * HEIGHT * DEPTH>;
-    std::unique_ptr<InterpolatedLightArray> m_interpolatedLightData; ///< Lazy-allocated smooth lighting (256 KB when allocated)
+    // ========== Light Transitions (GPU-blended, 2025-11-28) ==========
+    // Replaces the per-voxel float interpolation (256 KB per chunk, O(voxels) per frame).
+    // Block light at the last mesh build is kept as 4-bit pairs; the mesher packs it as the
+    // vertex's "previous" light and the vertex shader blends toward the current value.
+    using PackedLightArray = std::array<uint8_t, WIDTH * HEIGHT * DEPTH / 2>;
+    std::unique_ptr<PackedLightArray> m_meshedBlockLight;  ///< Block light of the last mesh (16 KB, null = all dark)
+    bool m_hasMeshedLight = false;          ///< False until first mesh (no fade-in on load)
+    bool m_lightTransitionPending = false;  ///< Last mesh changed block light (start blend on upload)
+    std::chrono::steady_clock::time_point m_lightTransitionStart{};  ///< MAIN THREAD: set on upload
+
+    /**
+     * @brief Snapshots m_lightData block light for the next mesh's "previous" values
+     */
+    void captureMeshedBlockLight();
+
+    /**
+     * @brief Builds a downsampled far-terrain mesh (generateMesh with lodLevel > 0)
+     * @param lodLevel LOD level (1-3)
+     */
+    void generateLodMesh(int lodLevel);
+
+    /**
+     * @brief Gathers the padded sample grid and appends surface-nets quads (see chunk_smooth.h)
+     * @param world World instance to query neighboring chunks
+     * @param verts Opaque vertex output (appended to)
+     */
+    void appendSmoothMesh(class World* world, std::vector<CompressedVertex>& verts);
+
+    /**
+     * @brief Stores a finished mesh: into an upload arena slice if possible, else CPU vectors
+     *
+     * Meshes are quad lists (4 vertices per quad); index counts are derived, not stored.
+     * Scratch vectors are returned to the thread-local MeshBufferPool when the arena takes the data.
+     */
+    void storeMesh(std::vector<CompressedVertex>& verts, std::vector<CompressedVertex>& transparentVerts);
 
     /**
-     * @brief Ensures interpolated lighting is allocated (lazy allocation)
-     * Called automatically by getInterpolatedXXX and initializeInterpolatedLighting
+     * @brief Returns a mesh that was never uploaded to the arena
      */
-    void ensureInterpolatedLightingAllocated();
+    void releaseArenaMesh();
 
     // ========== Mesh Data (Compressed Vertices for 6x memory savings) ==========
-    std::vector<CompressedVertex> m_vertices;         ///< CPU-side vertex data (opaque) - 8 bytes/vertex
-    std::vector<uint32_t> m_indices;                  ///< CPU-side index data (opaque)
-    std::vector<CompressedVertex> m_transparentVertices;   ///< CPU-side vertex data (transparent) - 8 bytes/vertex
-    std::vector<uint32_t> m_transparentIndices;       ///< CPU-side index data (transparent)
+    std::vector<CompressedVertex> m_vertices;         ///< CPU-side vertex data (opaque) - 12 bytes/vertex
+    std::vector<CompressedVertex> m_transparentVertices;   ///< CPU-side vertex data (transparent) - 12 bytes/vertex
+
+    // ========== Upload Arena Mesh (2025-11-28) ==========
+    // Layout within the slice: [opaque verts][transparent verts]
+    UploadArena::Allocation m_arenaMesh;              ///< Mesh awaiting upload (replaces the vectors above)
+    VkDeviceSize m_arenaTransparentVertexOffset = 0;  ///< Relative to m_arenaMesh.offset
 
     // ========== Vulkan Buffers (Opaque) ==========
     VkBuffer m_vertexBuffer;                ///< GPU vertex buffer (opaque) [LEGACY - will be replaced by mega-buffer]
     VkDeviceMemory m_vertexBufferMemory;    ///< Vertex buffer memory (opaque) [LEGACY]
-    VkBuffer m_indexBuffer;                 ///< GPU index buffer (opaque) [LEGACY]
-    VkDeviceMemory m_indexBufferMemory;     ///< Index buffer memory (opaque) [LEGACY]
     uint32_t m_vertexCount;                 ///< Number of vertices (opaque)
-    uint32_t m_indexCount;                  ///< Number of indices (opaque)
+    uint32_t m_indexCount;                  ///< Number of indices to draw (opaque, derived)
 
     // Mega-buffer offsets for indirect drawing (GPU optimization)
     VkDeviceSize m_megaBufferVertexOffset = 0;   ///< Offset in mega vertex buffer
-    VkDeviceSize m_megaBufferIndexOffset = 0;    ///< Offset in mega index buffer
     uint32_t m_megaBufferBaseVertex = 0;         ///< Base vertex for indexed drawing
 
     // ========== Vulkan Buffers (Transparent) ==========
     VkBuffer m_transparentVertexBuffer;           ///< GPU vertex buffer (transparent) [LEGACY]
     VkDeviceMemory m_transparentVertexBufferMemory; ///< Vertex buffer memory (transparent) [LEGACY]
-    VkBuffer m_transparentIndexBuffer;            ///< GPU index buffer (transparent) [LEGACY]
-    VkDeviceMemory m_transparentIndexBufferMemory; ///< Index buffer memory (transparent) [LEGACY]
     uint32_t m_transparentVertexCount;            ///< Number of vertices (transparent)
-    uint32_t m_transparentIndexCount;             ///< Number of indices (transparent)
+    uint32_t m_transparentIndexCount;             ///< Number of indices to draw (transparent, derived)
 
     // Mega-buffer offsets for transparent geometry (indirect drawing)
     VkDeviceSize m_megaBufferTransparentVertexOffset = 0;
-    VkDeviceSize m_megaBufferTransparentIndexOffset = 0;
     uint32_t m_megaBufferTransparentBaseVertex = 0;
 
     // ========== Staging Buffers (for batched uploads) ==========
     VkBuffer m_vertexStagingBuffer;               ///< Staging buffer for opaque vertices
     VkDeviceMemory m_vertexStagingBufferMemory;   ///< Staging buffer memory (opaque vertices)
-    VkBuffer m_indexStagingBuffer;                ///< Staging buffer for opaque indices
-    VkDeviceMemory m_indexStagingBufferMemory;    ///< Staging buffer memory (opaque indices)
     VkBuffer m_transparentVertexStagingBuffer;    ///< Staging buffer for transparent vertices
     VkDeviceMemory m_transparentVertexStagingBufferMemory; ///< Staging buffer memory (transparent vertices)
-    VkBuffer m_transparentIndexStagingBuffer;     ///< Staging buffer for transparent indices
-    VkDeviceMemory m_transparentIndexStagingBufferMemory;  ///< Staging buffer memory (transparent indices)
 
     // ========== Culling Data ==========
     glm::vec3 m_minBounds;                  ///< AABB minimum corner (world space)
@@ -0,0 +1,187 @@
+/**
+ * @file chunk_bricks.h
+ * @brief 8³ brick occupancy for empty-space skipping inside a chunk
+ *
+ * A chunk is split into 4x4x4 bricks of 8³ blocks. Each brick keeps three block
+ * counts (non-air, opaque, random-tick), maintained in O(1) by Chunk::setBlock,
+ * and three 64-bit masks derived from them:
+ * - occupied:   the brick holds at least one non-air block
+ * - opaque:     every block is solid and opaque (culls all faces between them)
+ * - randomTick: the brick holds a block flagged `random_tick` (BlockTickSystem
+ *               skips chunks and samples where this is clear)
+ *
+ * A brick is EMPTY (not occupied), OPAQUE, or MIXED. Hot loops skip EMPTY
+ * bricks outright, and the mesher also skips OPAQUE bricks whose 6 neighbors
+ * are OPAQUE (buried(): no face inside can be visible).
+ *
+ * Bricks are numbered x-major like Chunk::m_blocks: (bx * 4 + by) * 4 + bz.
+ * Opacity and random ticks come from the block property table at write time;
+ * the registry is loaded before any chunk is generated.
+ *
+ * Not thread-safe; Chunk updates its bricks under m_blockDataMutex.
+ *
+ * Created: 2025-11-28
+ */
+
+#pragma once
+
+#include "block_properties.h"
+#include <array>
+#include <cstdint>
+
+/// Brick classification (ChunkBricks::state)
+enum class BrickState : uint8_t {
+    EMPTY,   ///< All air
+    OPAQUE,  ///< All solid and opaque
+    MIXED    ///< Anything else
+};
+
+class ChunkBricks {
+public:
+    static constexpr int CHUNK_SIZE = 32;                    ///< Blocks per chunk edge (Chunk::WIDTH)
+    static constexpr int SHIFT = 3;
+    static constexpr int SIZE = 1 << SHIFT;                  ///< Blocks per brick edge
+    static constexpr int PER_AXIS = CHUNK_SIZE / SIZE;       ///< Bricks per chunk edge
+    static constexpr int COUNT = PER_AXIS * PER_AXIS * PER_AXIS;
+    static constexpr int VOLUME = SIZE * SIZE * SIZE;        ///< Blocks per brick
+
+    // Brick layers on each chunk face (bx, by or bz == 0 / 3)
+    static constexpr uint64_t LAYER_X0 = 0x000000000000FFFFull;
+    static constexpr uint64_t LAYER_X3 = 0xFFFF000000000000ull;
+    static constexpr uint64_t LAYER_Y0 = 0x000F000F000F000Full;
+    static constexpr uint64_t LAYER_Y3 = 0xF000F000F000F000ull;
+    static constexpr uint64_t LAYER_Z0 = 0x1111111111111111ull;
+    static constexpr uint64_t LAYER_Z3 = 0x8888888888888888ull;
+
+    static int brickIndex(int bx, int by, int bz) { return (bx * PER_AXIS + by) * PER_AXIS + bz; }
+
+    /// Brick containing local block (x, y, z)
+    static int indexOf(int x, int y, int z) { return brickIndex(x >> SHIFT, y >> SHIFT, z >> SHIFT); }
+
+    static uint64_t bit(int brick) { return uint64_t{1} << brick; }
+
+    /// Solid and opaque: the blocks that make a brick OPAQUE
+    static bool isOpaque(const BlockPropertyTable& props, int blockID) {
+        constexpr uint8_t mask = BlockFlags::SOLID | BlockFlags::OPAQUE;
+        return (props.flags(blockID) & mask) == mask;
+    }
+
+    ChunkBricks() { clear(); }
+
+    /// All air
+    void clear() {
+        m_nonAir.fill(0);
+        m_opaqueCount.fill(0);
+        m_randomTickCount.fill(0);
+        m_occupied = 0;
+        m_opaque = 0;
+        m_randomTick = 0;
+    }
+
+    /**
+     * @brief Accounts for one block change at local (x, y, z)
+     */
+    void update(const BlockPropertyTable& props, int x, int y, int z, int oldID, int newID) {
+        if (oldID == newID) return;
+        const int brick = indexOf(x, y, z);
+        m_nonAir[brick] = static_cast<uint16_t>(m_nonAir[brick] + (newID != 0) - (oldID != 0));
+        m_opaqueCount[brick] = static_cast<uint16_t>(m_opaqueCount[brick] + isOpaque(props, newID) - isOpaque(props, oldID));
+        m_randomTickCount[brick] = static_cast<uint16_t>(m_randomTickCount[brick] + props.hasRandomTick(newID) -
+                                                         props.hasRandomTick(oldID));
+        refresh(brick);
+    }
+
+    /**
+     * @brief Recounts every brick from x-major block storage (after bulk writes)
+     * @param blocks CHUNK_SIZE³ block IDs, [x][y][z] order
+     */
+    void rebuild(const BlockPropertyTable& props, const int* blocks) {
+        for (int brick = 0; brick < COUNT; brick++) {
+            const int x0 = originX(brick), y0 = originY(brick), z0 = originZ(brick);
+            uint16_t nonAir = 0;
+            uint16_t opaque = 0;
+            uint16_t randomTick = 0;
+            for (int x = x0; x < x0 + SIZE; x++) {
+                for (int y = y0; y < y0 + SIZE; y++) {
+                    const int* row = blocks + (x * CHUNK_SIZE + y) * CHUNK_SIZE + z0;
+                    for (int z = 0; z < SIZE; z++) {
+                        nonAir += (row[z] != 0);
+                        opaque += isOpaque(props, row[z]);
+                        randomTick += props.hasRandomTick(row[z]);
+                    }
+                }
+            }
+            m_nonAir[brick] = nonAir;
+            m_opaqueCount[brick] = opaque;
+            m_randomTickCount[brick] = randomTick;
+            refresh(brick);
+        }
+    }
+
+    bool isEmpty() const { return m_occupied == 0; }
+
+    /// Bit per brick holding any non-air block
+    uint64_t occupied() const { return m_occupied; }
+
+    /// Bit per brick that is entirely solid and opaque
+    uint64_t opaque() const { return m_opaque; }
+
+    /// Bit per brick holding any random-tick block
+    uint64_t randomTick() const { return m_randomTick; }
+
+    BrickState state(int brick) const {
+        if (!(m_occupied & bit(brick))) return BrickState::EMPTY;
+        return (m_opaque & bit(brick)) ? BrickState::OPAQUE : BrickState::MIXED;
+    }
+
+    /**
+     * @brief OPAQUE bricks whose 6 face neighbors are OPAQUE too
+     *
+     * No block inside such a brick has a visible face. Bricks on the chunk border
+     * use the neighbor chunk's bricks; a missing neighbor counts as air.
+     *
+     * @param neighborOpaque opaque() of the +X, -X, +Y, -Y, +Z, -Z neighbors (0 if missing)
+     */
+    uint64_t buried(const uint64_t neighborOpaque[6]) const {
+        const uint64_t posX = (m_opaque >> 16) | ((neighborOpaque[0] & LAYER_X0) << 48);
+        const uint64_t negX = (m_opaque << 16) | ((neighborOpaque[1] & LAYER_X3) >> 48);
+        const uint64_t posY = ((m_opaque >> 4) & ~LAYER_Y3) | ((neighborOpaque[2] & LAYER_Y0) << 12);
+        const uint64_t negY = ((m_opaque << 4) & ~LAYER_Y0) | ((neighborOpaque[3] & LAYER_Y3) >> 12);
+        const uint64_t posZ = ((m_opaque >> 1) & ~LAYER_Z3) | ((neighborOpaque[4] & LAYER_Z0) << 3);
+        const uint64_t negZ = ((m_opaque << 1) & ~LAYER_Z0) | ((neighborOpaque[5] & LAYER_Z3) >> 3);
+        return m_opaque & posX & negX & posY & negY & posZ & negZ;
+    }
+
+    static int originX(int brick) { return (brick / (PER_AXIS * PER_AXIS)) * SIZE; }
+    static int originY(int brick) { return ((brick / PER_AXIS) % PER_AXIS) * SIZE; }
+    static int originZ(int brick) { return (brick % PER_AXIS) * SIZE; }
+
+    /**
+     * @brief Calls fn(x, y, z) for every local block position inside the given bricks
+     */
+    template <typename Fn>
+    static void forEachBlock(uint64_t bricks, Fn&& fn) {
+        for (int brick = 0; brick < COUNT; brick++) {
+            if (!(bricks & bit(brick))) continue;
+            const int x0 = originX(brick), y0 = originY(brick), z0 = originZ(brick);
+            for (int x = x0; x < x0 + SIZE; x++)
+                for (int y = y0; y < y0 + SIZE; y++)
+                    for (int z = z0; z < z0 + SIZE; z++)
+                        fn(x, y, z);
+        }
+    }
+
+private:
+    void refresh(int brick) {
+        m_occupied = (m_nonAir[brick] != 0) ? (m_occupied | bit(brick)) : (m_occupied & ~bit(brick));
+        m_opaque = (m_opaqueCount[brick] == VOLUME) ? (m_opaque | bit(brick)) : (m_opaque & ~bit(brick));
+        m_randomTick = (m_randomTickCount[brick] != 0) ? (m_randomTick | bit(brick)) : (m_randomTick & ~bit(brick));
+    }
+
+    std::array<uint16_t, COUNT> m_nonAir;           ///< Non-air blocks per brick (0-512)
+    std::array<uint16_t, COUNT> m_opaqueCount;      ///< Solid opaque blocks per brick (0-512)
+    std::array<uint16_t, COUNT> m_randomTickCount;  ///< Random-tick blocks per brick (0-512)
+    uint64_t m_occupied;
+    uint64_t m_opaque;
+    uint64_t m_randomTick;
+};
@@ -0,0 +1,188 @@
+/**
+ * @file chunk_cache.h
+ * @brief Tiered LRU cache for unloaded chunks (hot / warm / cold)
+ *
+ * Replaces the flat unordered_map cache (arbitrary-order eviction, dirty data
+ * dropped on eviction, sized by chunk count).
+ *
+ * TIERS:
+ * - Hot:  Full Chunk objects (~200 KB each). Reload is a pointer move.
+ * - Warm: Chunk file codec bytes (RLE blocks + metadata + lighting, typically
+ *   5-15 KB). Reload decodes into a pooled chunk (~0.1 ms).
+ * - Cold: Chunk files on disk (WorldStreaming falls back to Chunk::load()).
+ *
+ * EVICTION:
+ * - Each tier is an LRU list sized by a memory budget in bytes. Hot overflow is
+ *   encoded and demoted to warm; warm overflow is dropped.
+ * - Dirty chunks are written back to disk before leaving RAM (warm eviction
+ *   writes the encoded bytes directly - no decode needed).
+ *
+ * THREAD SAFETY: Not internally synchronized - World calls it with
+ * m_chunkCacheMutex held. Statistics are atomic and may be read from any thread.
+ *
+ * Created: 2025-11-28
+ */
+
+#pragma once
+
+#include "chunk_coord.h"
+#include <atomic>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+class Chunk;
+
+/**
+ * @brief Cache tier a lookup was served from
+ */
+enum class ChunkCacheTier : uint8_t {
+    NONE,   ///< Not cached in RAM
+    HOT,    ///< Full chunk object
+    WARM    ///< Encoded bytes
+};
+
+/**
+ * @brief Snapshot of cache occupancy and hit counters
+ */
+struct ChunkCacheStats {
+    uint64_t hotHits = 0;
+    uint64_t warmHits = 0;
+    uint64_t coldHits = 0;      ///< Loaded from disk after a RAM miss
+    uint64_t misses = 0;        ///< Not cached anywhere (generated fresh)
+    uint64_t demotions = 0;     ///< Hot chunks encoded into the warm tier
+    uint64_t evictions = 0;     ///< Warm entries dropped from RAM
+    uint64_t writeBacks = 0;    ///< Dirty entries written to disk on eviction
+    size_t hotChunks = 0;
+    size_t warmChunks = 0;
+    size_t hotBytes = 0;
+    size_t warmBytes = 0;
+
+    uint64_t lookups() const { return hotHits + warmHits + coldHits + misses; }
+};
+
+/**
+ * @brief Tiered LRU cache for chunks unloaded by streaming
+ */
+class ChunkCache {
+public:
+    ChunkCache() = default;
+
+    ChunkCache(const ChunkCache&) = delete;
+    ChunkCache& operator=(const ChunkCache&) = delete;
+
+    /**
+     * @brief Sets the memory budgets (takes effect on the next insert)
+     * @param hotBytes Budget for full chunk objects
+     * @param warmBytes Budget for encoded chunks
+     */
+    void setBudgets(size_t hotBytes, size_t warmBytes);
+
+    /**
+     * @brief Sets the world directory used for dirty write-back (empty = no write-back)
+     */
+    void setWorldPath(const std::string& worldPath) { m_worldPath = worldPath; }
+
+    /**
+     * @brief Inserts an unloaded chunk at the head of the hot tier, then enforces budgets
+     *
+     * @param chunk Chunk to cache (GPU buffers already destroyed)
+     * @param dirty True if the chunk has unsaved modifications
+     * @param released Receives chunk objects freed by demotion (return them to the pool)
+     */
+    void insert(std::unique_ptr<Chunk> chunk, bool dirty, std::vector<std::unique_ptr<Chunk>>& released);
+
+    /**
+     * @brief Removes a cached chunk (caller takes ownership)
+     *
+     * Hot hits move the chunk into @p chunk; warm hits move the encoded bytes into
+     * @p encoded for the caller to decode outside the lock.
+     *
+     * @param dirty Receives the entry's dirty flag
+     * @return Tier the entry was found in (NONE on miss)
+     */
+    ChunkCacheTier take(const ChunkCoord& coord, std::unique_ptr<Chunk>& chunk,
+                        std::vector<uint8_t>& encoded, bool& dirty);
+
+    /**
+     * @brief Records the outcome of a disk lookup after a RAM miss
+     * @param found True if the chunk was loaded from disk
+     */
+    void recordColdLookup(bool found);
+
+    /**
+     * @brief Writes every dirty entry to the world directory and clears their flags
+     * @return Number of chunks written
+     */
+    int saveDirty();
+
+    /**
+     * @brief Writes every cached entry to a world directory (full world save)
+     * @return Pair of (saved, failed) counts
+     */
+    std::pair<int, int> saveAll(const std::string& worldPath) const;
+
+    ChunkCacheStats getStats() const;
+    size_t size() const { return m_hot.size() + m_warm.size(); }
+
+private:
+    struct HotEntry {
+        std::unique_ptr<Chunk> chunk;
+        size_t bytes = 0;
+        bool dirty = false;
+        std::list<ChunkCoord>::iterator lru;
+    };
+
+    struct WarmEntry {
+        std::vector<uint8_t> encoded;
+        bool dirty = false;
+        bool empty = false;                  ///< All air: saving deletes the file instead
+        std::list<ChunkCoord>::iterator lru;
+    };
+
+    /// Encodes least recently used hot chunks into the warm tier until under budget
+    void enforceHotBudget(std::vector<std::unique_ptr<Chunk>>& released);
+
+    /// Drops least recently used warm entries (writing dirty ones back) until under budget
+    void enforceWarmBudget();
+
+    /// Removes an entry from whichever tier holds it (no hit accounting)
+    ChunkCacheTier extract(const ChunkCoord& coord, std::unique_ptr<Chunk>& chunk,
+                           std::vector<uint8_t>& encoded, bool& dirty);
+
+    /// Updates the occupancy counters read by getStats()
+    void publishOccupancy();
+
+    void insertWarm(const ChunkCoord& coord, std::vector<uint8_t> encoded, bool dirty, bool empty);
+
+    /// Writes a warm entry to a world directory (empty chunks delete their file, as Chunk::save does)
+    static bool writeBack(const std::string& worldPath, const ChunkCoord& coord, const WarmEntry& entry);
+
+    std::unordered_map<ChunkCoord, HotEntry> m_hot;
+    std::list<ChunkCoord> m_hotLru;                     ///< Front = most recently unloaded
+    size_t m_hotBytes = 0;
+    size_t m_hotBudget = 256ull * 1024 * 1024;
+
+    std::unordered_map<ChunkCoord, WarmEntry> m_warm;
+    std::list<ChunkCoord> m_warmLru;                    ///< Front = most recently demoted
+    size_t m_warmBytes = 0;
+    size_t m_warmBudget = 128ull * 1024 * 1024;
+
+    std::string m_worldPath;
+
+    // Counters (atomic so DebugState can be refreshed from the main thread without the lock)
+    std::atomic<uint64_t> m_hotHits{0};
+    std::atomic<uint64_t> m_warmHits{0};
+    std::atomic<uint64_t> m_coldHits{0};
+    std::atomic<uint64_t> m_misses{0};
+    std::atomic<uint64_t> m_demotions{0};
+    std::atomic<uint64_t> m_evictions{0};
+    std::atomic<uint64_t> m_writeBacks{0};
+    std::atomic<size_t> m_hotCount{0};
+    std::atomic<size_t> m_warmCount{0};
+    std::atomic<size_t> m_hotBytesSnapshot{0};
+    std::atomic<size_t> m_warmBytesSnapshot{0};
+};
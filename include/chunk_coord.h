@@ -0,0 +1,38 @@
+/**
+ * @file chunk_coord.h
+ * @brief Chunk coordinate key shared by the world, streaming and cache containers
+ */
+
+#pragma once
+
+#include <functional>
+
+/**
+ * @brief Chunk coordinate key for spatial hash map
+ *
+ * Used as key in unordered_map for O(1) chunk lookup instead of O(n) linear search.
+ */
+struct ChunkCoord {
+    int x, y, z;
+
+    bool operator==(const ChunkCoord& other) const {
+        return x == other.x && y == other.y && z == other.z;
+    }
+};
+
+/**
+ * @brief Hash function for ChunkCoord to enable use in unordered_map
+ */
+namespace std {
+    template<>
+    struct hash<ChunkCoord> {
+        size_t operator()(const ChunkCoord& coord) const {
+            // Cantor pairing function variation for 3D coordinates
+            // Mix coordinates to distribute hash values evenly
+            size_t h1 = hash<int>()(coord.x);
+            size_t h2 = hash<int>()(coord.y);
+            size_t h3 = hash<int>()(coord.z);
+            return h1 ^ (h2 << 1) ^ (h3 << 2);
+        }
+    };
+}
@@ -22,7 +22,7 @@
 #include <cstdint>
 
 /**
- * @brief Face direction enumeration matching CompressedVertex normal indices
+ * @brief Face direction enumeration (also the face order of BlockPropertyTable::faceLayer)
  */
 enum class FaceDirection : uint8_t {
     PosX = 0,  // Right face (+X)
@@ -45,7 +45,7 @@ enum class FaceDirection : uint8_t {
 struct FaceConfig {
     // Face identification
     FaceDirection direction;        ///< Which face this is
-    uint8_t normalIndex;            ///< Index for CompressedVertex (0-5)
+    uint8_t normalIndex;            ///< Face index (0-5, FaceDirection order)
 
     // Normal vector for neighbor block queries
     glm::ivec3 normal;              ///< Direction to check for neighbor block
@@ -73,7 +73,7 @@ struct FaceConfig {
 /**
  * @brief Static configuration for all 6 cube faces
  *
- * Order matches CompressedVertex normal indices:
+ * Order matches FaceDirection:
  * 0=+X, 1=-X, 2=+Y, 3=-Y, 4=+Z, 5=-Z
  */
 static constexpr std::array<FaceConfig, 6> FACE_CONFIGS = {{
@@ -168,7 +168,7 @@ inline const FaceConfig& getFaceConfig(FaceDirection dir) {
 
 /**
  * @brief Get face configuration by normal index (0-5)
- * @param normalIndex Normal index (same as CompressedVertex)
+ * @param normalIndex Face index (FaceDirection order)
  * @return Reference to face configuration
  */
 inline const FaceConfig& getFaceConfigByNormal(uint8_t normalIndex) {
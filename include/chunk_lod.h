@@ -0,0 +1,106 @@
+/**
+ * @file chunk_lod.h
+ * @brief Hierarchical level-of-detail meshing for distant terrain chunks
+ *
+ * ARCHITECTURE:
+ * - Downsample: A chunk's 32³ block grid is reduced to a 16³ / 8³ / 4³ grid of
+ *   cells (LOD 1 / 2 / 3 = 2x / 4x / 8x). Each cell keeps the block that best
+ *   represents its exposed surface so grass stays grass at a distance.
+ * - Mesh: Exposed cell faces become coarse CompressedVertex quads. Chunk borders
+ *   emit downward "skirts" instead of walls so T-junction gaps between neighbors
+ *   at different LOD levels are hidden without stitching.
+ * - Super-chunks: LOD levels are selected per octree node (2^level chunks per
+ *   axis) instead of per chunk, so a whole node switches detail together and
+ *   seams only appear on node boundaries.
+ *
+ * Far-LOD vertices set CompressedVertex::FLAG_FAR_LOD so the fragment shader fades
+ * them against the LOD distance instead of the normal render distance.
+ *
+ * Created: 2025-11-27
+ */
+
+#pragma once
+
+#include "chunk.h"
+#include <glm/glm.hpp>
+#include <vector>
+#include <cstdint>
+
+namespace ChunkLod {
+
+constexpr int MAX_LOD_LEVEL = 3;     ///< Coarsest level: 8x8x8 blocks per cell (4³ cells per chunk)
+
+/// Vertical chunk band that receives far LOD terrain (covers sea level to mountain peaks)
+constexpr int LOD_MIN_CHUNK_Y = 0;
+constexpr int LOD_MAX_CHUNK_Y = 4;
+
+/**
+ * @brief Downsampled block grid for one chunk
+ *
+ * Cells are stored x-major to match Chunk::m_blocks ([x][y][z]).
+ */
+struct DownsampledGrid {
+    int lodLevel = 0;           ///< LOD level this grid was built for (1-3)
+    int cellSize = 1;           ///< Blocks per cell edge (2^lodLevel)
+    int dim = 0;                ///< Cells per axis (Chunk::WIDTH / cellSize)
+    std::vector<int> cells;     ///< Representative block ID per cell (0 = air)
+
+    /**
+     * @brief Gets the cell block ID, or -1 if outside the grid
+     */
+    int at(int x, int y, int z) const {
+        if (x < 0 || x >= dim || y < 0 || y >= dim || z < 0 || z >= dim) return -1;
+        return cells[(x * dim + y) * dim + z];
+    }
+};
+
+/**
+ * @brief Builds a downsampled grid from a chunk's raw block storage
+ *
+ * A cell is solid when at least half of its blocks are solid. The cell's block ID
+ * is the most common solid block on the topmost occupied layer of the cell, which
+ * keeps surface materials (grass, sand, snow) visible from above. Cells that are
+ * mostly liquid become the liquid block.
+ *
+ * @param blocks Chunk block storage ([x][y][z])
+ * @param lodLevel LOD level (clamped to 1-MAX_LOD_LEVEL)
+ * @param out Grid to fill (storage is reused between calls)
+ */
+void downsample(const int (&blocks)[Chunk::WIDTH][Chunk::HEIGHT][Chunk::DEPTH],
+                int lodLevel, DownsampledGrid& out);
+
+/**
+ * @brief Meshes a downsampled grid into coarse quads with seam skirts
+ *
+ * Opaque cells are written to verts, liquid cells to transparentVerts. Output is
+ * a quad list (4 vertices per quad, indices implicit - see quad_index.h);
+ * vectors are appended to (not cleared).
+ *
+ * @param grid Downsampled grid
+ * @param chunkX Chunk X coordinate (for world-space positions)
+ * @param chunkY Chunk Y coordinate
+ * @param chunkZ Chunk Z coordinate
+ * @param verts Opaque vertex output
+ * @param transparentVerts Transparent vertex output
+ */
+void buildMesh(const DownsampledGrid& grid, int chunkX, int chunkY, int chunkZ,
+               std::vector<CompressedVertex>& verts, std::vector<CompressedVertex>& transparentVerts);
+
+/**
+ * @brief Selects the LOD level for a chunk from its super-chunk distance
+ *
+ * Level N is used when the centre of the chunk's level-N octree node
+ * (2^N chunks per axis) lies beyond fullDetailDistance * 2^(N-1). All chunks in
+ * a node therefore share a level, and each level doubles the distance band of
+ * the previous one (bounded vertex budget per screen area).
+ *
+ * @param chunkX Chunk X coordinate
+ * @param chunkY Chunk Y coordinate
+ * @param chunkZ Chunk Z coordinate
+ * @param viewerPos Viewer position in world space
+ * @param fullDetailDistance Distance (blocks) inside which chunks are full detail
+ * @return 0 for full detail, otherwise 1-MAX_LOD_LEVEL
+ */
+int selectLodLevel(int chunkX, int chunkY, int chunkZ, const glm::vec3& viewerPos, float fullDetailDistance);
+
+}  // namespace ChunkLod
@@ -0,0 +1,116 @@
+/**
+ * @file chunk_map.h
+ * @brief Lock-sharded chunk map with RCU-style render list snapshots
+ *
+ * Replaces World's single shared_mutex over the whole chunk map. Coordinates are
+ * spatially hashed into SHARD_COUNT shards, each with its own shared_mutex, so
+ * streaming inserts/removals, decoration threads and block edits only contend
+ * when they touch the same shard.
+ *
+ * The flat chunk list used for rendering and whole-world passes is published as
+ * an immutable snapshot (shared_ptr to a vector). Readers grab the current
+ * snapshot without taking any lock and iterate it freely; a mutation only drops
+ * the published snapshot and the next reader rebuilds it once.
+ *
+ * LIFETIME: the map owns chunks. A Chunk* from find() or a snapshot stays valid
+ * until that chunk is extract()ed; World only removes chunks on the main thread,
+ * the same thread that renders, so a frame's snapshot never dangles.
+ *
+ * Created: 2025-11-28
+ */
+
+#pragma once
+
+#include "chunk_coord.h"
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+#include <vector>
+
+class Chunk;
+
+class ShardedChunkMap {
+public:
+    static constexpr size_t SHARD_COUNT = 64;                     ///< Power of two
+    using Snapshot = std::shared_ptr<const std::vector<Chunk*>>;  ///< Immutable chunk list
+
+    ShardedChunkMap();
+    ~ShardedChunkMap();
+
+    ShardedChunkMap(const ShardedChunkMap&) = delete;
+    ShardedChunkMap& operator=(const ShardedChunkMap&) = delete;
+
+    /**
+     * @brief Looks up a chunk (shared lock on one shard)
+     * @return Chunk pointer, or nullptr if not loaded
+     */
+    Chunk* find(const ChunkCoord& coord) const;
+
+    /**
+     * @brief Takes ownership of a chunk (exclusive lock on one shard)
+     *
+     * @param chunk Moved from only on success; left untouched if the coordinate is taken
+     * @return false if a chunk already exists at coord
+     */
+    bool insert(const ChunkCoord& coord, std::unique_ptr<Chunk>&& chunk);
+
+    /**
+     * @brief Removes a chunk and hands ownership back (exclusive lock on one shard)
+     * @return The chunk, or nullptr if not loaded
+     */
+    std::unique_ptr<Chunk> extract(const ChunkCoord& coord);
+
+    /// Number of loaded chunks
+    size_t size() const { return m_size.load(std::memory_order_relaxed); }
+    bool empty() const { return size() == 0; }
+
+    /**
+     * @brief Current chunk list (lock-free when unchanged since the last call)
+     *
+     * Order is unspecified. The vector never changes after publication.
+     */
+    Snapshot snapshot() const;
+
+    /**
+     * @brief Visits every chunk, one shard at a time under that shard's shared lock
+     *
+     * fn(const ChunkCoord&, Chunk*) must not insert or extract (self-deadlock on
+     * the visited shard).
+     */
+    template <typename Fn>
+    void forEach(Fn&& fn) const {
+        for (const Shard& shard : m_shards) {
+            std::shared_lock<std::shared_mutex> lock(shard.mutex);
+            for (const auto& [coord, chunk] : shard.chunks) {
+                fn(coord, chunk.get());
+            }
+        }
+    }
+
+    /// Shard owning a coordinate (spatial hash; exposed for stats and tests)
+    static size_t shardIndex(const ChunkCoord& coord) {
+        const uint32_t h = static_cast<uint32_t>(coord.x) * 73856093u
+                         ^ static_cast<uint32_t>(coord.y) * 19349663u
+                         ^ static_cast<uint32_t>(coord.z) * 83492791u;
+        return (h ^ (h >> 16)) & (SHARD_COUNT - 1);
+    }
+
+private:
+    struct alignas(64) Shard {
+        mutable std::shared_mutex mutex;
+        std::unordered_map<ChunkCoord, std::unique_ptr<Chunk>> chunks;
+    };
+
+    std::array<Shard, SHARD_COUNT> m_shards;
+    std::atomic<size_t> m_size{0};
+
+    // Flat list behind the snapshots (swap-and-pop removal). Lock order: shard -> list.
+    mutable std::mutex m_listMutex;
+    std::vector<Chunk*> m_list;
+    std::unordered_map<Chunk*, size_t> m_listIndex;
+    mutable Snapshot m_snapshot;  ///< Published list; null when stale (atomic_load/atomic_store)
+};
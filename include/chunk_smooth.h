@@ -0,0 +1,112 @@
+/**
+ * @file chunk_smooth.h
+ * @brief Surface-nets meshing for smooth terrain chunks
+ *
+ * ARCHITECTURE:
+ * - Samples: The chunk's 32³ blocks plus a 1-block border from the 26 neighbors
+ *   form a 34³ grid of block centers. Opaque solid blocks are "inside", everything
+ *   else (air, liquids, leaves) is "outside".
+ * - Cells: Every 2x2x2 group of samples with mixed inside/outside corners gets one
+ *   vertex at the mean of its crossing edge midpoints (naive surface nets on the
+ *   binary occupancy field). A flat floor lands exactly on the block top, slopes
+ *   and steps become chamfers.
+ * - Quads: Every inside/outside sample edge whose inside block is in this chunk
+ *   and flagged smooth_terrain connects the 4 cells around it. Like cube faces,
+ *   each edge belongs to the chunk of its solid block. Quads keep the cube
+ *   mesher's winding, material (face layer for the edge direction) and the light
+ *   of the outside sample, and go into the same quad-list vertex buffer.
+ *
+ * MIXED BORDERS: Blocks without smooth_terrain (logs, planks, ores) and every block
+ * of a cube-meshed neighbor chunk (SampleGrid::cubeRegions) are still cube meshed by
+ * Chunk::generateMesh. They count as inside but not smooth here, and a cell with
+ * such a corner keeps its vertex on the block corner at the cell center. The cube
+ * face of an edge spans exactly those 4 corners, so smooth quads meet cube faces
+ * without cracks. Border cells are computed from the same samples by every chunk
+ * that uses them, so the seam is closed for smooth/smooth and smooth/cube borders.
+ *
+ * Vertices use CompressedVertex::packSmooth() (1/16 block positions); the
+ * fragment shader projects the texture layer from world space.
+ *
+ * Created: 2025-11-28
+ */
+
+#pragma once
+
+#include "chunk.h"
+#include <vector>
+#include <cstdint>
+
+namespace ChunkSmooth {
+
+constexpr int PAD = Chunk::WIDTH + 2;               ///< Samples per axis (-1..32 in chunk coordinates)
+constexpr int SAMPLE_COUNT = PAD * PAD * PAD;
+
+/// Per-sample classification bits (SampleGrid::kinds)
+namespace SampleKind {
+    constexpr uint8_t INSIDE = 1 << 0;  ///< Opaque solid: inside the surface
+    constexpr uint8_t SMOOTH = 1 << 1;  ///< Inside and flagged smooth_terrain: emits quads
+    constexpr uint8_t LIT    = 1 << 2;  ///< Outside sample of a surface edge: light is read
+}
+
+/// SampleGrid::cubeRegions bit of the chunk at offset (dx, dy, dz), each -1..1
+constexpr uint32_t regionBit(int dx, int dy, int dz) {
+    return 1u << ((dx + 1) * 9 + (dy + 1) * 3 + (dz + 1));
+}
+
+/**
+ * @brief One smooth quad: an inside/outside sample edge owned by the chunk
+ */
+struct SurfaceEdge {
+    int inside;     ///< Sample index of the smooth block (material)
+    int outside;    ///< Sample index the quad faces (light)
+    int axis;       ///< Edge axis (0 = X, 1 = Y, 2 = Z)
+};
+
+/**
+ * @brief Padded block sample grid for one chunk
+ *
+ * Samples are stored x-major to match Chunk::m_blocks ([x][y][z]); padded
+ * coordinate p is chunk-local coordinate p - 1. Storage is reused between calls.
+ */
+struct SampleGrid {
+    std::vector<int> blocks;            ///< Block ID per sample (0 = air, also for missing neighbors)
+    std::vector<uint8_t> kinds;         ///< SampleKind bits (filled by prepare())
+    std::vector<uint8_t> light;         ///< Sky << 4 | block light, valid for samples in litSamples
+    std::vector<int> litSamples;        ///< Outside samples of the edges, each listed once
+    std::vector<SurfaceEdge> edges;     ///< Quads to emit (filled by prepare())
+    uint32_t cubeRegions = 0;           ///< regionBit()s of neighbor chunks that are cube meshed
+
+    /// Allocates storage (no-op once sized)
+    void resize() {
+        blocks.resize(SAMPLE_COUNT);
+        kinds.resize(SAMPLE_COUNT);
+        light.resize(SAMPLE_COUNT);
+    }
+
+    static int index(int px, int py, int pz) { return (px * PAD + py) * PAD + pz; }
+};
+
+/**
+ * @brief Classifies samples and collects the surface edges and the samples they need light for
+ *
+ * @param grid Grid with blocks and cubeRegions filled in
+ * @return Number of surface edges (0 = nothing to mesh)
+ */
+size_t prepare(SampleGrid& grid);
+
+/**
+ * @brief Meshes the smooth surface of a prepared grid
+ *
+ * Output is a quad list (4 vertices per quad, indices implicit - see quad_index.h);
+ * the vector is appended to (not cleared).
+ *
+ * @param grid Prepared grid with light filled in for grid.litSamples
+ * @param chunkX Chunk X coordinate (for world-space positions)
+ * @param chunkY Chunk Y coordinate
+ * @param chunkZ Chunk Z coordinate
+ * @param verts Opaque vertex output
+ */
+void buildMesh(const SampleGrid& grid, int chunkX, int chunkY, int chunkZ,
+               std::vector<CompressedVertex>& verts);
+
+}  // namespace ChunkSmooth
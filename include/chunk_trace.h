@@ -0,0 +1,209 @@
+/**
+ * @file chunk_trace.h
+ * @brief Per-stage latency tracing for the chunk pipeline
+ *
+ * Records every Chunk state transition (transitionTo / tryTransition) plus
+ * explicit work spans (generate, decorate, light, mesh, upload) so "chunk
+ * appears late" can be traced to the stage that caused it.
+ *
+ * ARCHITECTURE:
+ * - Recording: Each thread writes into its own fixed-size ring buffer
+ *   (single producer, single consumer). Recording is wait-free: no locks, no
+ *   allocation after the thread's first event. Full rings drop events and
+ *   count them instead of blocking a worker.
+ * - Collection: collect() (main thread, once per frame) drains all rings into
+ *   the session buffer. Rings of exited threads (std::async decoration tasks)
+ *   are released once drained.
+ * - Analysis: Time-in-state per chunk is derived from consecutive transitions
+ *   and reported as p50/p95/p99, split into queue wait states (load queue,
+ *   GENERATED, AWAITING_MESH, AWAITING_UPLOAD) and work states.
+ * - Export: Chrome trace JSON (chrome://tracing, ui.perfetto.dev). States are
+ *   async slices per chunk; work spans are complete events on their thread.
+ *
+ * Tracing is off by default; use the "chunktrace" console command.
+ *
+ * Created: 2025-11-28
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+enum class ChunkState : uint8_t;
+
+/**
+ * @brief Explicit work spans recorded alongside state transitions
+ */
+enum class ChunkTraceStage : uint8_t {
+    LOAD_QUEUE, ///< Waiting in the load queue before a worker picks the request up (wait)
+    GENERATE,   ///< Terrain generation / disk / cache load (load worker)
+    DECORATE,   ///< Tree and structure placement
+    LIGHT,      ///< Lighting initialization (mesh worker)
+    MESH,       ///< Mesh generation (mesh worker)
+    UPLOAD,     ///< GPU upload batch (main thread)
+    COUNT
+};
+
+/**
+ * @brief One recorded trace event (32 bytes)
+ */
+struct ChunkTraceEvent {
+    enum class Kind : uint8_t { TRANSITION, SPAN };
+
+    int64_t timeNs;         ///< Event (or span start) time since the trace epoch
+    int64_t durationNs;     ///< Span duration (0 for transitions)
+    int32_t x, y, z;        ///< Chunk coordinates
+    Kind kind;
+    uint8_t from;           ///< Previous ChunkState (transitions) or ChunkTraceStage (spans)
+    uint8_t to;             ///< New ChunkState (transitions)
+    uint8_t thread;         ///< Recording thread index (wraps at 256)
+};
+
+/**
+ * @brief Latency percentiles for one state or span
+ */
+struct ChunkTraceStats {
+    std::string name;       ///< State or stage name
+    bool isWait = false;    ///< True for queue waits (states and the load queue span)
+    bool isSpan = false;    ///< True for explicit work spans
+    size_t count = 0;
+    double p50Ms = 0.0;
+    double p95Ms = 0.0;
+    double p99Ms = 0.0;
+    double maxMs = 0.0;
+    double totalMs = 0.0;
+};
+
+/**
+ * @brief Singleton chunk pipeline tracer
+ */
+class ChunkTrace {
+public:
+    static constexpr size_t RING_CAPACITY = 4096;        ///< Events per thread ring (power of two)
+    static constexpr size_t MAX_SESSION_EVENTS = 1u << 20;  ///< Session buffer cap (~32 MB)
+
+    static ChunkTrace& instance();
+
+    /**
+     * @brief Starts a new session (clears previously collected events)
+     */
+    void start();
+
+    /**
+     * @brief Stops recording (collected events are kept for report/export)
+     */
+    void stop();
+
+    bool isEnabled() const { return m_enabled.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Records a successful state transition (called by Chunk)
+     */
+    void recordTransition(int x, int y, int z, ChunkState from, ChunkState to);
+
+    /**
+     * @brief Records a completed work span
+     */
+    void recordSpan(int x, int y, int z, ChunkTraceStage stage, int64_t startNs, int64_t endNs);
+
+    /**
+     * @brief Gets the trace clock (nanoseconds since the trace epoch)
+     */
+    int64_t now() const;
+
+    /**
+     * @brief Drains all thread rings into the session buffer (main thread)
+     */
+    void collect();
+
+    /**
+     * @brief Computes per-state and per-span latency percentiles for the session
+     */
+    std::vector<ChunkTraceStats> computeStats();
+
+    /**
+     * @brief Logs the latency report (Logger::info)
+     */
+    void printReport();
+
+    /**
+     * @brief Writes the session as Chrome trace / Perfetto JSON
+     * @param path Output file path
+     * @return True on success
+     */
+    bool exportChromeTrace(const std::string& path);
+
+    size_t getEventCount();
+    uint64_t getDroppedCount() const { return m_dropped.load(std::memory_order_relaxed); }
+
+private:
+    /// Single-producer single-consumer ring owned by one thread
+    struct ThreadRing {
+        ChunkTraceEvent events[RING_CAPACITY];
+        std::atomic<uint64_t> head{0};      ///< Written by the owning thread
+        std::atomic<uint64_t> tail{0};      ///< Written by collect()
+        std::atomic<bool> retired{false};   ///< Owning thread has exited
+        uint8_t threadIndex = 0;
+    };
+
+    friend struct ChunkTraceThreadSlot;
+
+    ChunkTrace();
+    ~ChunkTrace() = default;
+
+    ChunkTrace(const ChunkTrace&) = delete;
+    ChunkTrace& operator=(const ChunkTrace&) = delete;
+
+    ThreadRing* threadRing();
+    void push(const ChunkTraceEvent& event);
+
+    std::atomic<bool> m_enabled{false};
+    std::atomic<uint64_t> m_dropped{0};
+    std::chrono::steady_clock::time_point m_epoch;
+
+    std::vector<std::shared_ptr<ThreadRing>> m_rings;   ///< All live rings
+    std::mutex m_ringsMutex;                            ///< Guards m_rings (registration/collection only)
+    uint32_t m_nextThreadIndex = 0;
+
+    std::vector<ChunkTraceEvent> m_session;             ///< Collected events (main thread)
+    std::mutex m_sessionMutex;
+};
+
+/**
+ * @brief RAII work span
+ *
+ * Usage:
+ * @code
+ *   {
+ *       ChunkTraceSpan span(ChunkTraceStage::MESH, chunkX, chunkY, chunkZ);
+ *       chunk->generateMesh(world);
+ *   }  // Span recorded when destroyed (no-op while tracing is off)
+ * @endcode
+ */
+class ChunkTraceSpan {
+public:
+    ChunkTraceSpan(ChunkTraceStage stage, int x, int y, int z)
+        : m_stage(stage), m_x(x), m_y(y), m_z(z)
+        , m_start(ChunkTrace::instance().isEnabled() ? ChunkTrace::instance().now() : -1) {}
+
+    ~ChunkTraceSpan() {
+        if (m_start >= 0) {
+            ChunkTrace& trace = ChunkTrace::instance();
+            trace.recordSpan(m_x, m_y, m_z, m_stage, m_start, trace.now());
+        }
+    }
+
+    ChunkTraceSpan(const ChunkTraceSpan&) = delete;
+    ChunkTraceSpan& operator=(const ChunkTraceSpan&) = delete;
+
+private:
+    ChunkTraceStage m_stage;
+    int m_x, m_y, m_z;
+    int64_t m_start;
+};
@@ -0,0 +1,51 @@
+/**
+ * @file chunk_upload_target.h
+ * @brief Interface for the final (GPU upload) stage of the chunk pipeline
+ *
+ * WorldStreaming hands meshed chunks to a ChunkUploadTarget in batches.
+ * VulkanRenderer is the real implementation; headless tools (the streaming
+ * benchmark) substitute a stub so the full pipeline runs without a device.
+ *
+ * Created: 2025-11-28
+ */
+
+#pragma once
+
+#include <cstddef>
+
+class Chunk;
+
+/**
+ * @brief Receives batched chunk mesh uploads
+ *
+ * Pattern:
+ *   target->beginBatchedChunkUploads();
+ *   for (chunk : chunks) {
+ *       target->addChunkToBatch(chunk);
+ *   }
+ *   target->submitBatchedChunkUploads();
+ */
+class ChunkUploadTarget {
+public:
+    virtual ~ChunkUploadTarget() = default;
+
+    /**
+     * @brief Begins a multi-chunk upload batch
+     */
+    virtual void beginBatchedChunkUploads() = 0;
+
+    /**
+     * @brief Adds one meshed chunk to the current batch
+     */
+    virtual void addChunkToBatch(Chunk* chunk) = 0;
+
+    /**
+     * @brief Submits every chunk added since beginBatchedChunkUploads()
+     */
+    virtual void submitBatchedChunkUploads() = 0;
+
+    /**
+     * @brief Gets how many chunks to upload this frame (0 = backlogged, skip)
+     */
+    virtual size_t getRecommendedUploadCount() const = 0;
+};
@@ -81,6 +81,8 @@ private:
     static void cmdSpawn(const std::vector<std::string>& args);
     static void cmdEntity(const std::vector<std::string>& args);
     static void cmdFreeze(const std::vector<std::string>& args);
+    static void cmdChunkTrace(const std::vector<std::string>& args);
+    static void cmdProfiler(const std::vector<std::string>& args);
 
     // Editor commands
     static void cmd3DEditor(const std::vector<std::string>& args);
@@ -12,11 +12,13 @@ public:
     ConVar<bool> drawFPS;
     ConVar<bool> showTargetInfo;
     ConVar<bool> showCullingStats;
+    ConVar<bool> showProfiler;  ///< Show the zone profiler flame graph window
     ConVar<bool> debugCollision;
     ConVar<bool> debugWorld;  ///< Enable world/chunk debug logging
     ConVar<bool> debugWater;  ///< Enable water simulation debug logging
     ConVar<bool> wireframeMode;
     ConVar<bool> lightingEnabled;  ///< Enable/disable voxel lighting system
+    ConVar<bool> smoothTerrain;  ///< Surface-nets mesh smooth_terrain blocks in every biome
 
     // FPS tracking
     float lastFPS = 0.0f;
@@ -25,10 +27,21 @@ public:
 
     // Chunk rendering statistics
     int chunksRendered = 0;
+    int chunksRenderedLod = 0;     ///< Rendered chunks using a downsampled far-LOD mesh
     int chunksDistanceCulled = 0;
     int chunksFrustumCulled = 0;
     int chunksTotalInWorld = 0;
 
+    // Chunk cache statistics (fraction of streamed chunk loads served per tier)
+    float chunkCacheHotHitRate = 0.0f;   ///< Full chunk objects in RAM
+    float chunkCacheWarmHitRate = 0.0f;  ///< Encoded chunks in RAM
+    float chunkCacheColdHitRate = 0.0f;  ///< Chunk files on disk
+    int chunkCacheHotChunks = 0;
+    int chunkCacheWarmChunks = 0;
+    float chunkCacheHotMB = 0.0f;
+    float chunkCacheWarmMB = 0.0f;
+    int chunkCacheWriteBacks = 0;        ///< Dirty chunks written to disk on eviction
+
     void updateFPS(float deltaTime);
 
 private:
@@ -189,6 +189,28 @@ public:
      */
     BlockQueryResult getBlockAt(const glm::ivec3& pos);
 
+    /**
+     * @brief Block ID at a position, without building a BlockQueryResult
+     *
+     * Used by compiled scripts for block_is checks (no name lookup or string copy).
+     *
+     * @return Block ID, or -1 if the chunk isn't loaded
+     */
+    int getBlockID(const glm::ivec3& pos);
+
+    /**
+     * @brief Schedule a block update tick
+     *
+     * Fires a BlockUpdateEvent for the block at pos after delayTicks game ticks
+     * (20 per second), unless the block has changed by then. Pending ticks are
+     * saved with the chunk.
+     *
+     * @param pos Block position in world space
+     * @param delayTicks Game ticks to wait (0 is treated as 1)
+     * @return True if scheduled, false if the chunk isn't loaded or the tick is already pending
+     */
+    bool scheduleBlockTick(const glm::ivec3& pos, uint32_t delayTicks = 1);
+
     // ==================== AREA OPERATIONS ====================
 
     /**
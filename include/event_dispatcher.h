@@ -1,6 +1,7 @@
 #pragma once
 
 #include "event_types.h"
+#include <array>
 #include <queue>
 #include <mutex>
 #include <condition_variable>
@@ -25,6 +26,13 @@
  * - Filtered event listeners
  * - Separate main-thread queue for GPU operations
  * - Event monitoring without cancellation
+ * - Per-block-ID listener tables (subscribeBlock) for block scripts
+ *
+ * PERFORMANCE (2025-11-28): Listeners live in an immutable ListenerTable
+ * published through an atomic shared_ptr (RCU style). Dispatch takes no lock
+ * and copies nothing; subscribe/unsubscribe copy the table and swap it in.
+ * Block events look up handlers by blockID directly instead of running every
+ * block type's callback. Event objects come from EventPool (see event_pool.h).
  *
  * Usage:
  *   auto& dispatcher = EventDispatcher::instance();
@@ -75,6 +83,7 @@ struct EventListener {
     EventPriority priority;
     EventCallback callback;
     std::string owner;  // For debugging, e.g., "block:grass" or "script:mymod"
+    int blockID = -1;   // subscribeBlock() target, -1 for type-wide listeners
 };
 
 /**
@@ -136,6 +145,25 @@ public:
                                      EventPriority priority = EventPriority::NORMAL,
                                      const std::string& owner = "");
 
+    /**
+     * Subscribe to block events for one block ID only
+     *
+     * The callback runs only for events whose target block (see
+     * getEventBlockTarget) is blockID, found by direct table lookup. Events
+     * with an unknown block (-1) reach every block's listeners, merged with
+     * the type-wide ones by priority.
+     *
+     * @param type Block or neighbor event type
+     * @param blockID Block ID to listen for (>= 0)
+     * @param callback Function to call when event occurs
+     * @param priority Priority level (higher = called first)
+     * @param owner Optional owner identifier for debugging
+     * @return Handle to use for unsubscribing
+     */
+    ListenerHandle subscribeBlock(EventType type, int blockID, EventCallback callback,
+                                  EventPriority priority = EventPriority::NORMAL,
+                                  const std::string& owner = "");
+
     /**
      * Unsubscribe a specific listener
      *
@@ -242,16 +270,35 @@ private:
     std::queue<std::unique_ptr<Event>> m_mainThreadQueue;
     mutable std::mutex m_mainThreadQueueMutex;
 
-    // Listeners organized by event type, then priority
-    std::unordered_map<EventType, std::vector<EventListener>> m_listeners;
-    mutable std::mutex m_listenersMutex;
-
     // Filtered listeners
     struct FilteredListener {
         EventListener listener;
         EventFilter filter;
     };
-    std::unordered_map<EventType, std::vector<FilteredListener>> m_filteredListeners;
+
+    /**
+     * Immutable listener set, indexed by event type (every vector sorted by priority, highest first)
+     */
+    struct ListenerTable {
+        std::array<std::vector<EventListener>, EVENT_TYPE_COUNT> listeners;
+        std::array<std::vector<FilteredListener>, EVENT_TYPE_COUNT> filtered;
+        std::array<std::vector<std::vector<EventListener>>, EVENT_TYPE_COUNT> blockListeners;  ///< [type][blockID]
+    };
+    using ListenerSnapshot = std::shared_ptr<const ListenerTable>;
+
+    /**
+     * Copy the current table, apply mutate, publish the copy (serialized by m_listenersMutex)
+     */
+    void updateListeners(const std::function<void(ListenerTable&)>& mutate);
+
+    /**
+     * Current table (lock-free; never null)
+     */
+    ListenerSnapshot listenerSnapshot() const { return std::atomic_load(&m_listenerTable); }
+
+    // Listeners (RCU: readers atomic_load, writers copy + atomic_store)
+    ListenerSnapshot m_listenerTable;
+    std::mutex m_listenersMutex;  ///< Serializes writers only
 
     // Thread control
     std::thread m_handlerThread;
@@ -0,0 +1,78 @@
+/**
+ * @file event_pool.h
+ * @brief Size-class free lists backing Event::operator new/delete
+ *
+ * Every queued event used to be a fresh heap allocation (std::make_unique per
+ * dispatch) freed on the handler thread, so block-heavy frames paid malloc +
+ * cross-thread free for each BlockUpdateEvent and NeighborChangedEvent.
+ *
+ * Event overrides operator new/delete to draw from this pool, which keeps one
+ * intrusive free list per 16-byte size class (up to MAX_POOLED_SIZE) and refills
+ * from slabs of SLOTS_PER_SLAB. Call sites keep using std::make_unique<T>.
+ * Larger events fall back to the global heap.
+ *
+ * The pool is never destroyed (events can outlive any static destructor order),
+ * and slabs are only returned to the OS at process exit.
+ *
+ * Created: 2025-11-28
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+class EventPool {
+public:
+    static constexpr size_t SIZE_CLASS = 16;         ///< Granularity (>= alignof(max_align_t))
+    static constexpr size_t MAX_POOLED_SIZE = 256;   ///< Larger events use ::operator new
+    static constexpr size_t SLOTS_PER_SLAB = 64;     ///< Slots allocated per refill
+
+    static EventPool& instance();
+
+    /**
+     * @brief Allocates storage for an event of the given size (thread-safe)
+     */
+    void* allocate(size_t size);
+
+    /**
+     * @brief Returns storage to its size class (size must match allocate)
+     */
+    void deallocate(void* ptr, size_t size);
+
+    // ========== Statistics ==========
+
+    uint64_t getAllocations() const { return m_allocations.load(std::memory_order_relaxed); }
+    uint64_t getSlabRefills() const { return m_slabRefills.load(std::memory_order_relaxed); }
+    uint64_t getOversized() const { return m_oversized.load(std::memory_order_relaxed); }
+
+private:
+    EventPool() = default;
+    EventPool(const EventPool&) = delete;
+    EventPool& operator=(const EventPool&) = delete;
+
+    struct FreeNode {
+        FreeNode* next;
+    };
+
+    struct alignas(64) SizeClass {
+        std::mutex mutex;
+        FreeNode* freeList = nullptr;
+    };
+
+    static size_t classIndex(size_t size) { return (size + SIZE_CLASS - 1) / SIZE_CLASS - 1; }
+
+    std::array<SizeClass, MAX_POOLED_SIZE / SIZE_CLASS> m_classes;
+
+    std::mutex m_slabMutex;
+    std::vector<std::unique_ptr<unsigned char[]>> m_slabs;
+
+    std::atomic<uint64_t> m_allocations{0};
+    std::atomic<uint64_t> m_slabRefills{0};
+    std::atomic<uint64_t> m_oversized{0};
+};
@@ -17,6 +17,7 @@
 #pragma once
 
 #include <glm/glm.hpp>
+#include <cstddef>
 #include <string>
 #include <variant>
 #include <functional>
@@ -62,6 +63,9 @@ enum class EventType {
     CUSTOM                ///< Custom event for scripting and mods
 };
 
+/// Number of EventType values (CUSTOM must stay last); sizes the dispatcher's per-type tables
+constexpr size_t EVENT_TYPE_COUNT = static_cast<size_t>(EventType::CUSTOM) + 1;
+
 /**
  * @brief Enumeration of block break causes
  *
@@ -100,6 +104,16 @@ struct Event {
 
     virtual ~Event() = default;
 
+    /**
+     * @brief Pooled allocation for all event types (see EventPool)
+     *
+     * PERFORMANCE (2025-11-28): std::make_unique<AnyEvent>(...) draws from
+     * per-size free lists instead of the heap; deletion through Event* returns
+     * the slot using the sized delete of the dynamic type.
+     */
+    static void* operator new(std::size_t size);
+    static void operator delete(void* ptr, std::size_t size);
+
     /**
      * @brief Cancel this event
      *
@@ -273,6 +287,7 @@ struct NeighborChangedEvent : Event {
     glm::ivec3 neighborPos;    ///< World position of neighbor that changed
     int oldBlockID;            ///< Previous block ID at neighbor position
     int newBlockID;            ///< New block ID at neighbor position
+    int blockID;               ///< ID of the block receiving notification (-1 if unknown)
 
     /**
      * @brief Construct a NeighborChangedEvent
@@ -280,8 +295,9 @@ struct NeighborChangedEvent : Event {
      * @param neighbor Position of changed neighbor
      * @param oldBlock Previous block ID at neighbor position
      * @param newBlock New block ID at neighbor position
+     * @param block ID of the block at pos (-1 = unknown, delivered to every block's handlers)
      */
-    NeighborChangedEvent(glm::ivec3 pos, glm::ivec3 neighbor, int oldBlock, int newBlock);
+    NeighborChangedEvent(glm::ivec3 pos, glm::ivec3 neighbor, int oldBlock, int newBlock, int block = -1);
 };
 
 // ============================================================================
@@ -490,3 +506,13 @@ using EventCallback = std::function<void(Event&)>;
  * false if it should be skipped.
  */
 using EventFilter = std::function<bool(const Event&)>;
+
+/**
+ * @brief Gets the block a block or neighbor event is addressed to
+ *
+ * @param event Event to inspect
+ * @param position Receives the block's world position
+ * @param blockID Receives the block's ID (-1 if the event doesn't know it)
+ * @return false for non-block events (chunk, player, time, custom)
+ */
+bool getEventBlockTarget(const Event& event, glm::ivec3& position, int& blockID);
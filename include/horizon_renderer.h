@@ -0,0 +1,188 @@
+/**
+ * @file horizon_renderer.h
+ * @brief Heightmap-only distant horizon rendered straight from BiomeMap
+ *
+ * ARCHITECTURE:
+ * - Tiles: Square heightfield tiles (height + RGB565 color per sample) sampled
+ *   from BiomeMap::getTerrainHeightAt and the map preview biome colors. No chunk
+ *   or block data is generated, so a tile costs ~1 KB.
+ * - Clipmap: Up to MAX_RINGS nested rings of tiles. Each ring doubles the sample
+ *   spacing of the previous one and leaves a hole where the finer ring sits.
+ *   Ring centers snap to a grid of two tiles so the hole lines up exactly with
+ *   the coarser ring's tile grid.
+ * - Workers: Tiles are sampled on background threads and kept in an LRU cache
+ *   keyed by (ring, tileX, tileZ); recentring a ring mostly reuses cached tiles.
+ * - Rendering: Each ring is assembled into a single CompressedVertex mesh and
+ *   drawn with the chunk pipeline (one draw per ring). Vertices set
+ *   CompressedVertex::FLAG_HORIZON so the shader uses the vertex color and the
+ *   horizon fade distance.
+ *
+ * Full chunks replace the horizon as they stream in: horizon fragments are
+ * discarded inside the always-resident chunk radius, and beyond it the
+ * heightfield is sunk slightly below the true surface so streamed (or far LOD)
+ * chunks win the depth test wherever they exist.
+ *
+ * THREAD SAFETY:
+ * - Tile request queue and tile cache protected by separate mutexes
+ * - update() and render() must be called from the main (render) thread
+ *
+ * Created: 2025-11-28
+ */
+
+#pragma once
+
+#include "chunk.h"
+#include <glm/glm.hpp>
+#include <vulkan/vulkan.h>
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+// Forward declarations
+class BiomeMap;
+class VulkanRenderer;
+
+/**
+ * @brief Clipmap heightfield renderer for terrain far beyond streamed chunks
+ */
+class HorizonRenderer {
+public:
+    static constexpr int MAX_RINGS = 6;            ///< Upper bound for the configurable ring count
+    static constexpr int TILE_CELLS = 16;          ///< Quads per tile edge
+    static constexpr int TILE_SAMPLES = TILE_CELLS + 1;  ///< Samples per tile edge (shared borders)
+    static constexpr int RING_TILES = 8;           ///< Tiles per ring edge (must be a multiple of 4)
+    static constexpr int BASE_SPACING = 8;         ///< Blocks between samples on the finest ring
+    static constexpr size_t MAX_CACHED_TILES = 1024;  ///< LRU cache capacity (~1.2 MB)
+
+    /**
+     * @brief Constructs the horizon renderer
+     * @param biomeMap Terrain source (must outlive the renderer)
+     * @param renderer Vulkan renderer for buffer creation
+     * @param ringCount Number of clipmap rings (clamped to 1-MAX_RINGS)
+     */
+    HorizonRenderer(BiomeMap* biomeMap, VulkanRenderer* renderer, int ringCount = 4);
+    ~HorizonRenderer();
+
+    // Non-copyable (owns threads and GPU buffers)
+    HorizonRenderer(const HorizonRenderer&) = delete;
+    HorizonRenderer& operator=(const HorizonRenderer&) = delete;
+
+    /**
+     * @brief Starts the tile worker threads
+     * @param numWorkers Worker count (0 = auto, a quarter of the hardware threads)
+     */
+    void start(int numWorkers = 0);
+
+    /**
+     * @brief Stops workers and releases GPU buffers (blocks until workers exit)
+     */
+    void stop();
+
+    /**
+     * @brief Recentres rings, requests missing tiles and rebuilds ring meshes
+     *
+     * A ring whose tiles are all cached is rebuilt immediately; otherwise it keeps
+     * its previous mesh until the workers deliver the missing tiles.
+     *
+     * @param viewerPos Camera position in world space
+     */
+    void update(const glm::vec3& viewerPos);
+
+    /**
+     * @brief Draws all ring meshes
+     *
+     * The chunk graphics pipeline and its descriptor set must already be bound.
+     *
+     * @param commandBuffer Command buffer inside the main render pass
+     */
+    void render(VkCommandBuffer commandBuffer);
+
+    /**
+     * @brief Gets the distance the horizon reaches in every direction
+     * @return Distance in blocks (inner edge of the outermost ring's recentre slack)
+     */
+    float getHorizonDistance() const;
+
+    /**
+     * @brief Gets the number of tiles currently cached
+     */
+    size_t getCachedTileCount() const;
+
+private:
+    /// Heightfield tile sampled from BiomeMap
+    struct Tile {
+        std::array<int16_t, TILE_SAMPLES * TILE_SAMPLES> heights;   ///< Surface height per sample
+        std::array<uint16_t, TILE_SAMPLES * TILE_SAMPLES> colors;   ///< RGB565 color per sample
+        uint64_t lastUsed = 0;                                      ///< Update counter (LRU)
+    };
+
+    /// GPU mesh for one ring
+    struct RingMesh {
+        int centerX = 0;                ///< Snapped center (tile units of this ring)
+        int centerZ = 0;
+        bool valid = false;             ///< Center has been assigned at least once
+        bool dirty = true;              ///< Needs a rebuild (recentred or tiles arrived)
+        bool complete = false;          ///< All tiles were present at the last build
+        VkBuffer vertexBuffer = VK_NULL_HANDLE;
+        VkDeviceMemory vertexMemory = VK_NULL_HANDLE;
+        VkBuffer indexBuffer = VK_NULL_HANDLE;
+        VkDeviceMemory indexMemory = VK_NULL_HANDLE;
+        uint32_t indexCount = 0;
+    };
+
+    static uint64_t tileKey(int ring, int tileX, int tileZ);
+    int spacing(int ring) const { return BASE_SPACING << ring; }
+    int tileSize(int ring) const { return TILE_CELLS * spacing(ring); }
+
+    /**
+     * @brief Checks whether a tile of this ring lies inside the next finer ring
+     */
+    bool isCoveredByInnerRing(int ring, int tileX, int tileZ) const;
+
+    /**
+     * @brief Samples one tile from BiomeMap (worker thread)
+     */
+    void generateTile(int ring, int tileX, int tileZ, Tile& out) const;
+
+    /**
+     * @brief Assembles a ring mesh from cached tiles and uploads it
+     * @return True if every tile of the ring was available
+     */
+    bool rebuildRing(int ring);
+
+    void destroyRingBuffers(RingMesh& mesh);
+    void evictTiles();
+    void workerThreadFunction();
+
+    BiomeMap* m_biomeMap;
+    VulkanRenderer* m_renderer;
+    int m_ringCount;
+
+    std::array<RingMesh, MAX_RINGS> m_rings;
+    std::atomic<uint64_t> m_updateCounter{0};   ///< LRU clock (read by workers to stamp new tiles)
+
+    // Tile cache (filled by workers, read by the main thread)
+    std::unordered_map<uint64_t, Tile> m_tileCache;
+    mutable std::mutex m_tileCacheMutex;
+    std::atomic<bool> m_tilesArrived{false};
+
+    // Tile request queue
+    std::deque<glm::ivec3> m_requestQueue;          ///< (ring, tileX, tileZ)
+    std::unordered_set<uint64_t> m_requested;       ///< Queued or in progress
+    std::mutex m_requestMutex;
+    std::condition_variable m_requestCV;
+
+    std::vector<std::thread> m_workers;
+    std::atomic<bool> m_running{false};
+
+    // Reused mesh assembly buffers (main thread only)
+    std::vector<CompressedVertex> m_buildVertices;
+    std::vector<uint32_t> m_buildIndices;
+};
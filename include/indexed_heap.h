@@ -0,0 +1,216 @@
+/**
+ * @file indexed_heap.h
+ * @brief Binary min-heap with a key -> slot index for O(log n) updates and removal
+ *
+ * std::priority_queue can only push and pop the top. The streaming scheduler also
+ * has to re-key queued chunks when the player turns or speeds up, and cancel
+ * requests the player has moved away from, so the heap keeps a hash map from key
+ * to heap slot:
+ *
+ * - push / pop / update / erase: O(log n)
+ * - contains / top:             O(1)
+ * - rebuild (re-key everything): O(n) (recompute + Floyd heapify)
+ * - findWorst (eviction):        O(n/2) - scans the leaves only, no copies
+ *
+ * Not thread-safe; callers hold their queue mutex.
+ *
+ * Created: 2025-11-28
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+template <typename Key, typename Value, typename Hash = std::hash<Key>>
+class IndexedMinHeap {
+public:
+    struct Entry {
+        Key key;
+        float priority;   ///< Lower = served first
+        Value value;
+    };
+
+    bool empty() const { return m_heap.empty(); }
+    size_t size() const { return m_heap.size(); }
+    bool contains(const Key& key) const { return m_slots.find(key) != m_slots.end(); }
+
+    void reserve(size_t capacity) {
+        m_heap.reserve(capacity);
+        m_slots.reserve(capacity);
+    }
+
+    void clear() {
+        m_heap.clear();
+        m_slots.clear();
+    }
+
+    /**
+     * @brief Inserts a new key
+     * @return false if the key is already queued (use update() to re-key it)
+     */
+    bool push(const Key& key, float priority, Value value) {
+        if (contains(key)) {
+            return false;
+        }
+        m_heap.push_back({key, priority, std::move(value)});
+        m_slots[key] = m_heap.size() - 1;
+        siftUp(m_heap.size() - 1);
+        return true;
+    }
+
+    /// Entry with the lowest priority (heap must not be empty)
+    const Entry& top() const { return m_heap.front(); }
+
+    /// Removes and returns the entry with the lowest priority (heap must not be empty)
+    Entry pop() {
+        Entry result = std::move(m_heap.front());
+        removeAt(0);
+        return result;
+    }
+
+    /**
+     * @brief Changes a queued key's priority in place
+     * @return false if the key is not queued
+     */
+    bool update(const Key& key, float priority) {
+        auto it = m_slots.find(key);
+        if (it == m_slots.end()) {
+            return false;
+        }
+        const size_t slot = it->second;
+        const float old = m_heap[slot].priority;
+        m_heap[slot].priority = priority;
+        if (priority < old) {
+            siftUp(slot);
+        } else {
+            siftDown(slot);
+        }
+        return true;
+    }
+
+    /**
+     * @brief Cancels a queued key
+     * @return false if the key is not queued
+     */
+    bool erase(const Key& key) {
+        auto it = m_slots.find(key);
+        if (it == m_slots.end()) {
+            return false;
+        }
+        removeAt(it->second);
+        return true;
+    }
+
+    /**
+     * @brief Finds the entry with the highest priority value (first to evict)
+     *
+     * In a min-heap the maximum is always a leaf, so only the last n/2 slots are
+     * scanned. Used when the bounded queue is full, not on the hot path.
+     *
+     * @return nullptr if empty
+     */
+    const Entry* findWorst() const {
+        if (m_heap.empty()) {
+            return nullptr;
+        }
+        const Entry* worst = &m_heap[m_heap.size() / 2];
+        for (size_t i = m_heap.size() / 2 + 1; i < m_heap.size(); i++) {
+            if (m_heap[i].priority > worst->priority) {
+                worst = &m_heap[i];
+            }
+        }
+        return worst;
+    }
+
+    /**
+     * @brief Re-keys every entry in one pass and drops the ones fn rejects
+     *
+     * fn(const Key&, Value&, float& priority) -> bool keep. Cheaper than n
+     * update() calls when most keys change (e.g. every boundary crossing).
+     *
+     * @return Number of dropped entries
+     */
+    template <typename Fn>
+    size_t rebuild(Fn&& fn) {
+        size_t kept = 0;
+        for (size_t i = 0; i < m_heap.size(); i++) {
+            Entry& entry = m_heap[i];
+            if (fn(static_cast<const Key&>(entry.key), entry.value, entry.priority)) {
+                if (kept != i) {
+                    m_heap[kept] = std::move(entry);
+                }
+                kept++;
+            }
+        }
+        const size_t dropped = m_heap.size() - kept;
+        m_heap.resize(kept);
+
+        m_slots.clear();
+        for (size_t i = 0; i < m_heap.size(); i++) {
+            m_slots[m_heap[i].key] = i;
+        }
+        for (size_t i = m_heap.size() / 2; i-- > 0;) {
+            siftDown(i);
+        }
+        return dropped;
+    }
+
+private:
+    void removeAt(size_t slot) {
+        m_slots.erase(m_heap[slot].key);
+        const size_t last = m_heap.size() - 1;
+        if (slot != last) {
+            m_heap[slot] = std::move(m_heap[last]);
+            m_slots[m_heap[slot].key] = slot;
+            m_heap.pop_back();
+            siftDown(slot);
+            siftUp(slot);
+        } else {
+            m_heap.pop_back();
+        }
+    }
+
+    void swapSlots(size_t a, size_t b) {
+        std::swap(m_heap[a], m_heap[b]);
+        m_slots[m_heap[a].key] = a;
+        m_slots[m_heap[b].key] = b;
+    }
+
+    void siftUp(size_t slot) {
+        while (slot > 0) {
+            const size_t parent = (slot - 1) / 2;
+            if (!(m_heap[slot].priority < m_heap[parent].priority)) {
+                break;
+            }
+            swapSlots(slot, parent);
+            slot = parent;
+        }
+    }
+
+    void siftDown(size_t slot) {
+        const size_t count = m_heap.size();
+        while (true) {
+            const size_t left = slot * 2 + 1;
+            if (left >= count) {
+                break;
+            }
+            const size_t right = left + 1;
+            size_t best = left;
+            if (right < count && m_heap[right].priority < m_heap[left].priority) {
+                best = right;
+            }
+            if (!(m_heap[best].priority < m_heap[slot].priority)) {
+                break;
+            }
+            swapSlots(slot, best);
+            slot = best;
+        }
+    }
+
+    std::vector<Entry> m_heap;
+    std::unordered_map<Key, size_t, Hash> m_slots;
+};
@@ -100,6 +100,14 @@ public:
      */
     void cleanup();
 
+    /**
+     * @brief Convert biome temperature/moisture to a display color
+     *
+     * Shared with the horizon renderer so distant terrain matches the map colors.
+     * The result is pre-darkened by 40% (revealed chunks are brightened back).
+     */
+    static uint32_t biomeToColor(int temperature, int moisture, float height);
+
 private:
     /**
      * @brief Actually reveal a chunk on the map (called from animation loop)
@@ -114,11 +122,6 @@ private:
      */
     uint32_t sampleTerrainColor(float worldX, float worldZ);
 
-    /**
-     * @brief Convert biome temperature/moisture to a display color
-     */
-    uint32_t biomeToColor(int temperature, int moisture, float height);
-
     BiomeMap* m_biomeMap = nullptr;
     VulkanRenderer* m_renderer = nullptr;
 
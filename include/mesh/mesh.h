@@ -102,8 +102,9 @@ struct alignas(16) MaterialUBO {
 /**
  * @brief Mesh data structure with GPU resources
  *
- * Contains vertex/index data and manages Vulkan buffers for GPU rendering.
- * Each mesh has its own vertex/index buffers (Phase 1 - no mega-buffer yet).
+ * Contains vertex/index data. Meshes drawn by MeshRenderer live in its shared
+ * vertex/index mega-buffers (see MeshBatch); the per-mesh buffer handles below
+ * are only used by code that uploads a mesh on its own.
  */
 class Mesh {
 public:
@@ -203,39 +204,55 @@ struct MeshInstance {
 /**
  * @brief GPU-compatible instance data for vertex shader
  *
- * Uploaded to instance buffer for instanced rendering.
- * Layout: mat4 (4x vec4) + vec4 = 80 bytes per instance
+ * One slot of the persistent instance table (storage buffer, set 2 binding 1).
+ * The vertex shader fetches it by slot, and the material rides along so a single
+ * indirect draw can cover meshes with different materials.
+ * Layout: mat4 + vec4 + material (ivec2 + vec2) + skin (ivec4) = 112 bytes,
+ * matches std430 InstanceRecord in mesh.vert.
  */
 struct InstanceData {
     glm::mat4 transform;        ///< 64 bytes (4x vec4)
     glm::vec4 tintColor;        ///< 16 bytes
+    int32_t albedoTexIndex = -1;  ///< Material albedo texture (-1 = vertex color)
+    int32_t normalTexIndex = -1;  ///< Material normal map (-1 = none)
+    float metallic = 0.0f;        ///< Material metallic factor
+    float roughness = 0.5f;       ///< Material roughness factor
+    int32_t boneBase = 0;         ///< First matrix of this instance's bone palette range
+    int32_t boneCount = 0;        ///< Bones in that range (0 = shared palette)
+    int32_t _padding[2] = {0, 0}; ///< Keeps the record a multiple of 16 bytes
 
     /**
-     * @brief Get Vulkan binding description for instance buffer
-     * @return Binding description for binding 1 (per-instance data)
+     * @brief Get Vulkan binding description for the visible slot stream
+     * @return Binding description for binding 1 (one uint32 slot per drawn instance)
      */
     static VkVertexInputBindingDescription getBindingDescription();
 
     /**
-     * @brief Get Vulkan attribute descriptions for instance data
-     * @return Array of 5 attributes (mat4 transform + vec4 tint)
+     * @brief Get Vulkan attribute descriptions for the visible slot stream
+     * @return Array of 1 attribute (uint slot, location 7)
      */
     static std::vector<VkVertexInputAttributeDescription> getAttributeDescriptions();
 };
 
 /**
- * @brief Maximum number of bones for skeletal animation
+ * @brief Maximum number of bones for skeletal animation (per skeleton)
  */
 static constexpr int MAX_BONES = 64;
 
 /**
- * @brief GPU-compatible bone matrix uniform buffer
+ * @brief Skinning matrices in the bone palette (every animated character)
+ */
+static constexpr int MAX_BONE_PALETTE = 16384;
+
+/**
+ * @brief Header of the bone palette storage buffer (set 2, binding 0)
  *
- * Contains bone matrices for skeletal animation skinning.
- * Layout matches GLSL std140 alignment rules.
+ * The header is followed by MAX_BONE_PALETTE matrices. Instances with
+ * boneCount > 0 skin with their own range; the rest use the shared palette
+ * (matrices [0, MAX_BONES), written by MeshRenderer::updateBoneMatrices).
+ * Layout matches the std430 BonePalette block in mesh.vert.
  */
-struct alignas(16) BoneUBO {
-    alignas(16) glm::mat4 boneMatrices[MAX_BONES]; ///< Bone transformation matrices
-    alignas(4)  int32_t numBones = 0;              ///< Number of active bones (0 = no skinning)
-    alignas(4)  float _padding[3] = {0, 0, 0};     ///< Padding to 16-byte alignment
+struct alignas(16) BonePaletteHeader {
+    int32_t sharedBoneCount = 0;       ///< Bones in the shared palette (0 = no skinning)
+    int32_t _padding[3] = {0, 0, 0};   ///< Matrices start 16-byte aligned
 };
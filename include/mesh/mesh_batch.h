@@ -0,0 +1,211 @@
+/**
+ * @file mesh_batch.h
+ * @brief CPU bookkeeping for batched mesh rendering (mega-buffer, instance table, indirect draws)
+ *
+ * MeshRenderer used to give every mesh its own vertex/index/instance buffers and
+ * rebuilt a mesh's whole instance buffer when any of its instances changed.
+ * MeshBatch holds the state for the batched path instead:
+ * - RangeAllocator suballocates every mesh's vertices and indices from two shared
+ *   mega-buffers (first fit; freed ranges coalesce)
+ * - Instances live in a slot table mirrored 1:1 by a GPU storage buffer (one copy
+ *   per frame in flight). Edits mark their slot dirty and takeUploads() returns
+ *   coalesced slot ranges, so uploads are O(changed instances), not O(all)
+ * - buildDraws() frustum-culls each visible instance against its mesh's world AABB
+ *   and emits one VkDrawIndexedIndirectCommand per mesh with survivors. firstInstance
+ *   indexes a list of visible slots; the vertex shader fetches instanceTable[slot]
+ *
+ * No Vulkan calls here; MeshRenderer owns the buffers.
+ *
+ * Created: 2025-11-28
+ */
+
+#pragma once
+
+#include "mesh/mesh.h"
+#include "frustum.h"
+#include <glm/glm.hpp>
+#include <vulkan/vulkan.h>
+#include <cstdint>
+#include <map>
+#include <vector>
+
+/**
+ * @brief First-fit allocator for element ranges inside a fixed-capacity buffer
+ */
+class RangeAllocator {
+public:
+    static constexpr uint32_t INVALID_OFFSET = UINT32_MAX;
+
+    explicit RangeAllocator(uint32_t capacity = 0);
+
+    /**
+     * @brief Reserves count contiguous elements
+     * @return Offset of the first element, or INVALID_OFFSET if no free range is large enough
+     */
+    uint32_t allocate(uint32_t count);
+
+    /// Returns a range; adjacent free ranges merge
+    void free(uint32_t offset, uint32_t count);
+
+    /// Extends the capacity (after the backing buffer was reallocated and copied)
+    void grow(uint32_t newCapacity);
+
+    uint32_t capacity() const { return m_capacity; }
+    uint32_t used() const { return m_used; }
+    size_t freeRangeCount() const { return m_freeRanges.size(); }
+
+private:
+    std::map<uint32_t, uint32_t> m_freeRanges;  ///< offset -> count
+    uint32_t m_capacity = 0;
+    uint32_t m_used = 0;
+};
+
+/**
+ * @brief Geometry ranges, instance table and per-frame draw building for MeshRenderer
+ */
+class MeshBatch {
+public:
+    static constexpr uint32_t INVALID_SLOT = UINT32_MAX;
+
+    /// Contiguous run of instance table slots
+    struct SlotRange {
+        uint32_t first;
+        uint32_t count;
+    };
+
+    /// Where a mesh lives in the mega-buffers
+    struct MeshRange {
+        uint32_t firstVertex = 0;
+        uint32_t vertexCount = 0;
+        uint32_t firstIndex = 0;
+        uint32_t indexCount = 0;
+        glm::vec3 boundsMin{0.0f};
+        glm::vec3 boundsMax{0.0f};
+    };
+
+    /// Counters from the last buildDraws()
+    struct DrawStats {
+        uint32_t drawCount = 0;
+        uint32_t visibleInstances = 0;
+        uint32_t frustumCulled = 0;
+    };
+
+    /**
+     * @param vertexCapacity Vertices in the vertex mega-buffer
+     * @param indexCapacity Indices in the index mega-buffer
+     * @param instanceCapacity Slots in the instance table
+     * @param frameCopies GPU copies of the instance table (frames in flight)
+     */
+    MeshBatch(uint32_t vertexCapacity, uint32_t indexCapacity, uint32_t instanceCapacity, uint32_t frameCopies);
+
+    // ========== Geometry ==========
+
+    /**
+     * @brief Suballocates vertex and index ranges for a mesh
+     * @return Range, or nullptr if a mega-buffer is full (grow it and retry)
+     */
+    const MeshRange* addMesh(uint32_t meshId, uint32_t vertexCount, uint32_t indexCount,
+                             const glm::vec3& boundsMin, const glm::vec3& boundsMax);
+
+    /// Frees the mesh's geometry and every instance slot that still uses it
+    void removeMesh(uint32_t meshId);
+
+    const MeshRange* mesh(uint32_t meshId) const;
+
+    /// Replaces the culling bounds (e.g. padded for skinned meshes)
+    void setMeshBounds(uint32_t meshId, const glm::vec3& boundsMin, const glm::vec3& boundsMax);
+
+    RangeAllocator& vertexAllocator() { return m_vertices; }
+    RangeAllocator& indexAllocator() { return m_indices; }
+    const RangeAllocator& vertexAllocator() const { return m_vertices; }
+    const RangeAllocator& indexAllocator() const { return m_indices; }
+
+    // ========== Instance Table ==========
+
+    /**
+     * @brief Takes a free slot for an instance of meshId
+     * @return Slot index, or INVALID_SLOT if the mesh is unknown or the table is full
+     */
+    uint32_t addInstance(uint32_t meshId, const InstanceData& data);
+
+    /// Releases a slot (O(1); the stale record is never drawn)
+    void removeInstance(uint32_t slot);
+
+    /// Record for writing; marks the slot dirty
+    InstanceData& edit(uint32_t slot);
+
+    const InstanceData& instance(uint32_t slot) const { return m_table[slot]; }
+
+    /// Hidden instances keep their slot but are skipped by buildDraws()
+    void setVisible(uint32_t slot, bool visible);
+    bool isVisible(uint32_t slot) const;
+
+    /// Slots currently holding an instance of meshId
+    const std::vector<uint32_t>& meshSlots(uint32_t meshId) const;
+
+    /// Slot-indexed records (what the GPU table mirrors)
+    const InstanceData* table() const { return m_table.data(); }
+    uint32_t instanceCapacity() const { return static_cast<uint32_t>(m_table.size()); }
+    uint32_t instanceCount() const { return m_instanceCount; }
+
+    /**
+     * @brief Slot ranges the given GPU copy still has to receive
+     *
+     * Slots dirtied since the last call are queued for every copy, so each frame's
+     * table catches up the first time that frame is recorded again.
+     *
+     * @param frameCopy Index of the table copy about to be written
+     * @return Sorted, coalesced ranges (the copy's queue is cleared)
+     */
+    std::vector<SlotRange> takeUploads(uint32_t frameCopy);
+
+    // ========== Draw Building ==========
+
+    /**
+     * @brief Culls all visible instances and builds one indirect command per mesh
+     *
+     * Commands reference the mega-buffers (firstIndex / vertexOffset) and the visible
+     * slot list (firstInstance / instanceCount).
+     *
+     * @param frustum Camera frustum in world space
+     * @param outCommands Cleared and filled with one command per mesh with visible instances
+     * @param outVisibleSlots Cleared and filled with the instance slots to draw, grouped by mesh
+     */
+    DrawStats buildDraws(const Frustum& frustum,
+                         std::vector<VkDrawIndexedIndirectCommand>& outCommands,
+                         std::vector<uint32_t>& outVisibleSlots) const;
+
+    /**
+     * @brief World AABB of a local AABB under an affine transform
+     */
+    static void transformBounds(const glm::mat4& transform, const glm::vec3& localMin, const glm::vec3& localMax,
+                                glm::vec3& outMin, glm::vec3& outMax);
+
+private:
+    struct MeshEntry {
+        MeshRange range;
+        std::vector<uint32_t> slots;  ///< Instance slots of this mesh (unordered)
+    };
+
+    struct SlotInfo {
+        uint32_t meshId = 0;          ///< 0 = free slot
+        uint32_t listIndex = 0;       ///< Position in MeshEntry::slots (for O(1) removal)
+        bool visible = true;
+    };
+
+    void markDirty(uint32_t slot);
+
+    RangeAllocator m_vertices;
+    RangeAllocator m_indices;
+
+    std::map<uint32_t, MeshEntry> m_meshes;  ///< Ordered by mesh ID (stable draw order)
+
+    std::vector<InstanceData> m_table;
+    std::vector<SlotInfo> m_slots;
+    std::vector<uint32_t> m_freeSlots;
+    uint32_t m_instanceCount = 0;
+
+    std::vector<uint32_t> m_dirtySlots;             ///< Slots written since the last takeUploads()
+    std::vector<uint8_t> m_dirtyFlags;              ///< Per slot, dedupes m_dirtySlots
+    std::vector<std::vector<uint32_t>> m_pending;   ///< Per GPU copy: slots not yet uploaded
+};
@@ -6,10 +6,12 @@
 #pragma once
 
 #include "mesh/mesh.h"
+#include "mesh/mesh_batch.h"
 #include "mesh/mesh_loader.h"
 #include <vulkan/vulkan.h>
 #include <vector>
 #include <unordered_map>
+#include <unordered_set>
 #include <memory>
 
 // Forward declaration
@@ -23,6 +25,12 @@ class VulkanRenderer;
  * - Creating and managing materials
  * - Instancing meshes with transforms
  * - Rendering all meshes efficiently
+ *
+ * BATCHING (2025-11-28): All meshes share one vertex and one index mega-buffer,
+ * and every instance owns a slot in a persistent instance table (storage buffer,
+ * one copy per frame in flight) that is updated by dirty slot ranges only. Each
+ * frame the instances are frustum-culled on the CPU and drawn with a single
+ * vkCmdDrawIndexedIndirect (one command per mesh). See MeshBatch.
  */
 class MeshRenderer {
 public:
@@ -159,11 +167,13 @@ public:
      * @brief Render all mesh instances
      *
      * Call this during frame rendering, after binding camera descriptor set.
-     * Renders all opaque meshes with instancing.
+     * Uploads dirty instance slots, culls instances against the view frustum and
+     * draws all surviving instances with one indirect draw.
      *
      * @param cmd Command buffer to record into
+     * @param viewProj Camera view-projection matrix (for frustum culling)
      */
-    void render(VkCommandBuffer cmd);
+    void render(VkCommandBuffer cmd, const glm::mat4& viewProj);
 
     /**
      * @brief Get number of meshes
@@ -173,7 +183,12 @@ public:
     /**
      * @brief Get number of instances
      */
-    size_t getInstanceCount() const { return m_instanceCount; }
+    size_t getInstanceCount() const { return m_instances.size(); }
+
+    /**
+     * @brief Get draw and culling counters from the last render()
+     */
+    const MeshBatch::DrawStats& getDrawStats() const { return m_drawStats; }
 
     /**
      * @brief Get GPU memory usage in bytes
@@ -214,7 +229,10 @@ public:
     // ========== Skeletal Animation ==========
 
     /**
-     * @brief Update bone matrices for skeletal animation
+     * @brief Update the shared bone palette for skeletal animation
+     *
+     * Instances without a palette range of their own skin with these matrices.
+     *
      * @param matrices Array of bone transformation matrices
      * @param count Number of bones
      */
@@ -225,15 +243,41 @@ public:
      */
     void clearBoneMatrices();
 
+    /**
+     * @brief Reserves a range of the bone palette for one animated character
+     * @param boneCount Bones in the character's skeleton (max MAX_BONES)
+     * @return First matrix of the range, or RangeAllocator::INVALID_OFFSET if full
+     */
+    uint32_t allocateBonePalette(uint32_t boneCount);
+
+    /**
+     * @brief Returns a range from allocateBonePalette()
+     */
+    void freeBonePalette(uint32_t base, uint32_t boneCount);
+
+    /**
+     * @brief Mapped bone palette (MAX_BONE_PALETTE matrices, host-coherent)
+     *
+     * AnimationBatch::update() writes skinning matrices straight into it. Like
+     * the previous bone UBO there is one copy shared by all frames in flight.
+     *
+     * @return Matrix 0 of the palette, or nullptr if the buffer failed to initialize
+     */
+    glm::mat4* getBonePalette();
+
+    /**
+     * @brief Points an instance at its own bone palette range
+     * @param instanceId Instance ID
+     * @param base First matrix (from allocateBonePalette)
+     * @param boneCount Bones in the range (0 = back to the shared palette)
+     */
+    void setInstanceBonePalette(uint32_t instanceId, uint32_t base, uint32_t boneCount);
+
 private:
     struct MeshData {
         Mesh mesh;
         uint32_t materialId = 0;
-        std::vector<uint32_t> instances;  // Instance IDs using this mesh
-        VkBuffer instanceBuffer = VK_NULL_HANDLE;
-        VkDeviceMemory instanceMemory = VK_NULL_HANDLE;
-        bool instanceBufferDirty = false;
-        uint32_t visibleInstanceCount = 0;  // Number of visible instances in buffer
+        std::unordered_set<uint32_t> instances;  // Instance IDs using this mesh
     };
 
     struct MaterialData {
@@ -245,8 +289,7 @@ private:
 
     struct InstanceInfo {
         uint32_t meshId;
-        InstanceData data;
-        bool visible = true;  ///< Whether this instance should be rendered
+        uint32_t slot;  ///< Slot in the instance table (MeshBatch)
     };
 
     // Deferred buffer deletion to avoid destroying in-flight resources
@@ -266,6 +309,20 @@ private:
         std::string name;
     };
 
+    // Per-frame-in-flight buffers (host visible, persistently mapped)
+    struct FrameResources {
+        VkBuffer instanceTable = VK_NULL_HANDLE;       ///< InstanceData per slot (storage buffer)
+        VkDeviceMemory instanceTableMemory = VK_NULL_HANDLE;
+        void* instanceTableMapped = nullptr;
+        VkBuffer visibleSlots = VK_NULL_HANDLE;        ///< uint32 slot per drawn instance (binding 1)
+        VkDeviceMemory visibleSlotsMemory = VK_NULL_HANDLE;
+        void* visibleSlotsMapped = nullptr;
+        VkBuffer indirect = VK_NULL_HANDLE;            ///< One VkDrawIndexedIndirectCommand per mesh
+        VkDeviceMemory indirectMemory = VK_NULL_HANDLE;
+        void* indirectMapped = nullptr;
+        VkDescriptorSet descriptorSet = VK_NULL_HANDLE;  ///< Set 2: bones + this frame's table
+    };
+
     VulkanRenderer* m_renderer;
 
     // Mesh storage
@@ -280,7 +337,21 @@ private:
     // Instance storage
     std::unordered_map<uint32_t, InstanceInfo> m_instances;
     uint32_t m_nextInstanceId = 1;
-    size_t m_instanceCount = 0;
+
+    // Batched rendering: mega-buffer ranges, instance table, per-frame draw lists
+    static constexpr uint32_t INITIAL_MEGA_VERTICES = 256 * 1024;  // ~23 MB of MeshVertex, doubles when full
+    static constexpr uint32_t INITIAL_MEGA_INDICES = 1024 * 1024;  // 4 MB, doubles when full
+    static constexpr uint32_t MAX_INSTANCES = 16384;               // 1.5 MB table per frame in flight
+    MeshBatch m_batch;
+    VkBuffer m_megaVertexBuffer = VK_NULL_HANDLE;
+    VkDeviceMemory m_megaVertexMemory = VK_NULL_HANDLE;
+    VkBuffer m_megaIndexBuffer = VK_NULL_HANDLE;
+    VkDeviceMemory m_megaIndexMemory = VK_NULL_HANDLE;
+    std::vector<FrameResources> m_frames;
+    VkDescriptorPool m_instanceDescriptorPool = VK_NULL_HANDLE;
+    std::vector<VkDrawIndexedIndirectCommand> m_drawCommands;  // Reused every frame
+    std::vector<uint32_t> m_visibleSlots;                      // Reused every frame
+    MeshBatch::DrawStats m_drawStats;
 
     // Texture storage (indexed by mesh-local texture index)
     std::vector<TextureData> m_textures;
@@ -295,13 +366,12 @@ private:
     uint64_t m_frameNumber = 0;
     static constexpr uint64_t FRAMES_TO_KEEP = 3;  // Keep buffers for 3 frames before deletion
 
-    // Bone matrix buffer for skeletal animation
+    // Bone palette for skeletal animation (bound with the instance table in set 2)
     VkBuffer m_boneBuffer = VK_NULL_HANDLE;
     VkDeviceMemory m_boneMemory = VK_NULL_HANDLE;
     void* m_boneMapped = nullptr;
-    VkDescriptorPool m_boneDescriptorPool = VK_NULL_HANDLE;
-    VkDescriptorSet m_boneDescriptorSet = VK_NULL_HANDLE;
     bool m_boneBufferInitialized = false;
+    RangeAllocator m_bonePaletteRanges;  // Per-character ranges; [0, MAX_BONES) is the shared palette
 
     /**
      * @brief Queue buffer for deferred deletion
@@ -314,14 +384,46 @@ private:
     void processPendingDeletions();
 
     /**
-     * @brief Upload mesh geometry to GPU
+     * @brief Suballocate mesh geometry in the mega-buffers and upload it
+     * @return False if the mesh is empty or the mega-buffers could not grow
+     */
+    bool uploadMesh(uint32_t meshId, MeshData& meshData);
+
+    /**
+     * @brief Write a mesh's vertices and indices into its mega-buffer range
+     */
+    void writeMeshGeometry(const Mesh& mesh, const MeshBatch::MeshRange& range);
+
+    /**
+     * @brief Reallocate a mega-buffer with at least minCapacity elements, keeping its contents
+     * @param indices True for the index mega-buffer, false for the vertex mega-buffer
+     */
+    bool growMegaBuffer(bool indices, uint32_t minCapacity);
+
+    /**
+     * @brief Copy CPU data into a device-local buffer at an offset (staging + transfer)
+     */
+    void uploadToBuffer(VkBuffer dst, VkDeviceSize dstOffset, const void* data, VkDeviceSize size);
+
+    /**
+     * @brief Copy a material's shader-visible fields into an instance record
+     */
+    void applyMaterial(InstanceData& data, uint32_t materialId) const;
+
+    /**
+     * @brief Rewrite the material fields of every instance of a mesh
+     */
+    void refreshInstanceMaterials(uint32_t meshId);
+
+    /**
+     * @brief Create mega-buffers, per-frame instance tables / draw buffers and set 2 descriptors
      */
-    void uploadMesh(MeshData& meshData);
+    void initializeBatchResources();
 
     /**
-     * @brief Update instance buffer for a mesh
+     * @brief Destroy everything created by initializeBatchResources()
      */
-    void updateInstanceBuffer(MeshData& meshData);
+    void cleanupBatchResources();
 
     /**
      * @brief Create or update material uniform buffer
@@ -6,36 +6,36 @@
 #pragma once
 
 #include "particle/particle_effect.h"
+#include "particle/particle_pool.h"
 #include <glm/glm.hpp>
-#include <vector>
+#include <memory>
 #include <random>
 
 /**
- * @brief Runtime particle data
- */
-struct RuntimeParticle {
-    glm::vec3 position = glm::vec3(0.0f);
-    glm::vec3 velocity = glm::vec3(0.0f);
-    glm::vec4 color = glm::vec4(1.0f);
-    glm::vec2 size = glm::vec2(1.0f);
-    float lifetime = 0.0f;
-    float maxLifetime = 1.0f;
-    float rotation = 0.0f;
-    int frameIndex = 0;
-
-    bool isAlive() const { return lifetime > 0.0f; }
-    float getNormalizedAge() const {
-        return maxLifetime > 0.0f ? 1.0f - (lifetime / maxLifetime) : 1.0f;
-    }
-};
-
-/**
- * @brief Spawns and updates particles based on EmitterConfig
+ * @brief Spawns particles based on EmitterConfig
+ *
+ * DATA-ORIENTED (2025-11-28): Particles live in a ParticlePool (SoA), not in the
+ * emitter. An emitter owns a pool slot (baked curves + physics) and only decides
+ * when and where to spawn. With a shared pool the pool's owner runs the
+ * simulation; a standalone emitter (editor preview) owns a small private pool
+ * and simulates it in update().
  */
 class ParticleEmitter {
 public:
+    /// Capacity of a standalone emitter's private pool (the old per-emitter cap)
+    static constexpr size_t STANDALONE_CAPACITY = 10000;
+
     ParticleEmitter();
-    explicit ParticleEmitter(const EmitterConfig& config);
+
+    /**
+     * @param config Emitter configuration
+     * @param pool Shared pool to spawn into (nullptr = private pool, simulated by update())
+     */
+    explicit ParticleEmitter(const EmitterConfig& config, ParticlePool* pool = nullptr);
+    ~ParticleEmitter();
+
+    ParticleEmitter(const ParticleEmitter&) = delete;
+    ParticleEmitter& operator=(const ParticleEmitter&) = delete;
 
     /**
      * @brief Set emitter configuration
@@ -48,7 +48,7 @@ public:
     const EmitterConfig& getConfig() const { return m_config; }
 
     /**
-     * @brief Update particles
+     * @brief Spawn particles (and simulate them when the pool is private)
      * @param deltaTime Frame delta time
      */
     void update(float deltaTime);
@@ -59,9 +59,16 @@ public:
     void reset();
 
     /**
-     * @brief Get all particles
+     * @brief Get the pool holding this emitter's particles
+     *
+     * A shared pool also holds other emitters' particles - filter by getSlot().
+     */
+    const ParticlePool& getPool() const { return *m_pool; }
+
+    /**
+     * @brief Get this emitter's slot in the pool
      */
-    const std::vector<RuntimeParticle>& getParticles() const { return m_particles; }
+    uint16_t getSlot() const { return m_slot; }
 
     /**
      * @brief Get number of active particles
@@ -90,15 +97,13 @@ public:
 
 private:
     void spawnParticle();
-    void updateParticle(RuntimeParticle& p, float dt);
     glm::vec3 getSpawnPosition();
     glm::vec3 getSpawnVelocity();
-    glm::vec4 evaluateColor(float normalizedAge);
-    glm::vec2 evaluateSize(float normalizedAge);
-    float evaluateCurve(const std::vector<CurveKey>& curve, float t, float defaultValue);
 
     EmitterConfig m_config;
-    std::vector<RuntimeParticle> m_particles;
+    std::unique_ptr<ParticlePool> m_ownedPool;  ///< Standalone emitters only
+    ParticlePool* m_pool = nullptr;
+    uint16_t m_slot = ParticlePool::INVALID_EMITTER;
     glm::vec3 m_position = glm::vec3(0.0f);
 
     float m_time = 0.0f;
@@ -0,0 +1,212 @@
+/**
+ * @file particle_pool.h
+ * @brief Engine-wide structure-of-arrays particle pool with SIMD update kernels
+ *
+ * Replaces the per-emitter std::vector<RuntimeParticle> (AoS, per-particle curve
+ * searches, 10k cap per emitter) and the legacy splash particle vector.
+ *
+ * LAYOUT:
+ * - Every per-particle field is its own contiguous array (position, velocity,
+ *   acceleration, drag, lifetime, ...). The update kernel streams only the
+ *   arrays it touches and processes 4 particles per SSE instruction.
+ * - Emitters register a slot; their color/size curves are baked into
+ *   CURVE_LUT_SIZE-entry lookup tables once (on register / config change)
+ *   instead of searching gradient stops per particle per frame.
+ * - Dead particles are swap-removed, so [0, size()) is always dense.
+ *
+ * RENDERING: writeInstances() evaluates the LUTs and writes instance data
+ * straight into a (persistently mapped) GPU buffer - no intermediate copy.
+ *
+ * THREADING: update() splits large pools (>= PARALLEL_THRESHOLD) across
+ * persistent worker threads and waits for them. All other methods, and update()
+ * itself, must be called from a single (main) thread.
+ *
+ * Created: 2025-11-28
+ */
+
+#pragma once
+
+#include "particle/particle_effect.h"
+#include <glm/glm.hpp>
+#include <array>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Per-particle GPU instance data (std430 compatible, 48 bytes)
+ */
+struct ParticleInstance {
+    glm::vec4 positionSize;  ///< xyz = position, w = size
+    glm::vec4 color;         ///< rgba
+    float rotation;
+    float padding[3];
+};
+
+/**
+ * @brief SoA particle storage shared by all emitters of a system
+ */
+class ParticlePool {
+public:
+    static constexpr size_t DEFAULT_CAPACITY = 131072;    ///< Engine-wide pool (6 MB of instance data)
+    static constexpr size_t PARALLEL_THRESHOLD = 32768;   ///< Below this the update stays on the caller's thread
+    static constexpr int CURVE_LUT_SIZE = 64;             ///< Samples per baked color/size curve
+    static constexpr uint16_t INVALID_EMITTER = 0xFFFF;
+
+    /**
+     * @brief Evaluated particle state (editor preview, debugging)
+     */
+    struct Sample {
+        glm::vec3 position;
+        glm::vec4 color;
+        glm::vec2 size;
+        float rotation;
+        int frameIndex;
+    };
+
+    explicit ParticlePool(size_t capacity = DEFAULT_CAPACITY);
+    ~ParticlePool();
+
+    ParticlePool(const ParticlePool&) = delete;
+    ParticlePool& operator=(const ParticlePool&) = delete;
+
+    // ========== Emitter Slots ==========
+
+    /**
+     * @brief Registers an emitter and bakes its curves
+     * @return Slot ID used by spawn(), or INVALID_EMITTER if all 65535 slots are taken
+     */
+    uint16_t registerEmitter(const EmitterConfig& config);
+
+    /**
+     * @brief Re-bakes an emitter's curves and physics (live editing)
+     *
+     * Existing particles keep the gravity/drag they spawned with.
+     */
+    void updateEmitter(uint16_t slot, const EmitterConfig& config);
+
+    /**
+     * @brief Kills the emitter's particles and frees its slot
+     */
+    void releaseEmitter(uint16_t slot);
+
+    /**
+     * @brief Kills every particle spawned by an emitter (slot stays registered)
+     */
+    void clearEmitter(uint16_t slot);
+
+    // ========== Particles ==========
+
+    /**
+     * @brief Adds a particle
+     *
+     * @param slot Emitter slot (selects curves, gravity and drag)
+     * @param lifetime Seconds to live (must be > 0)
+     * @param rotation Initial rotation in radians
+     * @param sizeScale Multiplier applied to the emitter's size curve
+     * @param tint RGBA8 multiplier applied to the emitter's color curve (R in the low byte)
+     * @return False if the pool is full or the slot is invalid
+     */
+    bool spawn(uint16_t slot, const glm::vec3& position, const glm::vec3& velocity, float lifetime,
+               float rotation = 0.0f, float sizeScale = 1.0f, uint32_t tint = 0xFFFFFFFFu);
+
+    /**
+     * @brief Integrates gravity, drag and lifetime, then compacts dead particles
+     * @param deltaTime Frame delta time in seconds
+     */
+    void update(float deltaTime);
+
+    /**
+     * @brief Writes evaluated instance data for all live particles
+     *
+     * @param dst Destination (typically a persistently mapped instance buffer)
+     * @param maxCount Capacity of @p dst in instances
+     * @return Number of instances written
+     */
+    size_t writeInstances(ParticleInstance* dst, size_t maxCount) const;
+
+    /**
+     * @brief Evaluates one particle (index in [0, size()))
+     */
+    Sample sample(size_t index) const;
+
+    /// Emitter slot that spawned a particle
+    uint16_t emitterOf(size_t index) const { return m_emitter[index]; }
+
+    /// Live particles spawned by an emitter
+    size_t liveCount(uint16_t slot) const;
+
+    size_t size() const { return m_count; }
+    size_t capacity() const { return m_capacity; }
+
+    /**
+     * @brief Kills every particle (emitter slots stay registered)
+     */
+    void clear();
+
+private:
+    struct EmitterParams {
+        std::array<glm::vec4, CURVE_LUT_SIZE> colorLut;
+        std::array<glm::vec2, CURVE_LUT_SIZE> sizeLut;
+        glm::vec2 gravity = glm::vec2(0.0f);
+        float drag = 0.0f;
+        bool alignToVelocity = false;
+        int frameIndex = 0;
+        int frameCount = 1;
+        float fps = 0.0f;
+        size_t liveCount = 0;
+        bool active = false;
+    };
+
+    void bakeEmitter(EmitterParams& params, const EmitterConfig& config);
+
+    /// SIMD kernel over particles [begin, end)
+    void integrate(size_t begin, size_t end, float deltaTime);
+
+    /// Swap-removes particles whose lifetime ran out
+    void compact();
+
+    /// Moves particle @p from into slot @p to (all arrays)
+    void moveParticle(size_t from, size_t to);
+
+    /// Curve LUT index for a particle's normalized age
+    int lutIndex(size_t index) const;
+
+    // ========== Worker Threads (large pools only) ==========
+    void startWorkers();
+    void stopWorkers();
+    void workerLoop(int workerIndex);
+
+    /// Range of particles handled by one of (workers + 1) parallel blocks
+    void blockRange(int block, size_t& begin, size_t& end) const;
+
+    size_t m_capacity;
+    size_t m_count = 0;
+
+    // Structure of arrays (all sized to m_capacity)
+    std::vector<float> m_posX, m_posY, m_posZ;
+    std::vector<float> m_velX, m_velY, m_velZ;
+    std::vector<float> m_accelX, m_accelY;      ///< Emitter gravity at spawn time
+    std::vector<float> m_drag;                  ///< Emitter drag at spawn time
+    std::vector<float> m_life;                  ///< Seconds remaining
+    std::vector<float> m_invMaxLife;            ///< 1 / initial lifetime (normalized age without a divide)
+    std::vector<float> m_rotation;
+    std::vector<float> m_sizeScale;
+    std::vector<uint32_t> m_tint;
+    std::vector<uint16_t> m_emitter;
+
+    std::vector<EmitterParams> m_emitters;
+    std::vector<uint16_t> m_freeSlots;
+
+    std::vector<std::thread> m_workers;
+    std::mutex m_workMutex;
+    std::condition_variable m_workCv;
+    std::condition_variable m_doneCv;
+    uint64_t m_workGeneration = 0;
+    int m_workersPending = 0;
+    float m_workDeltaTime = 0.0f;
+    bool m_shutdown = false;
+};
@@ -8,6 +8,7 @@
 #include <vulkan/vulkan.h>
 #include "particle/particle_effect.h"
 #include "particle/particle_emitter.h"
+#include "particle/particle_pool.h"
 #include <glm/glm.hpp>
 #include <vector>
 #include <memory>
@@ -36,7 +37,7 @@ struct ActiveParticleEffect {
  */
 class ParticleSystemRuntime {
 public:
-    ParticleSystemRuntime();
+    ParticleSystemRuntime() = default;
     ~ParticleSystemRuntime();
 
     /**
@@ -89,6 +90,9 @@ public:
 
     /**
      * @brief Render all particle effects
+     *
+     * Instance data is written by the pool directly into the mapped instance buffer.
+     *
      * @param commandBuffer Vulkan command buffer
      * @param viewProj View-projection matrix
      * @param cameraPos Camera position for billboarding
@@ -108,6 +112,10 @@ public:
 private:
     VulkanRenderer* m_renderer = nullptr;
 
+    // Particle storage (SoA, shared by all emitters, simulated in update())
+    // Declared before m_activeEffects: emitters release their slots on destruction
+    ParticlePool m_pool;
+
     // Loaded effect templates
     std::unordered_map<std::string, ParticleEffect> m_loadedEffects;
 
@@ -120,17 +128,6 @@ private:
     VkDeviceMemory m_particleVertexMemory = VK_NULL_HANDLE;
     VkBuffer m_particleInstanceBuffer = VK_NULL_HANDLE;
     VkDeviceMemory m_particleInstanceMemory = VK_NULL_HANDLE;
-    void* m_instanceBufferMapped = nullptr;
-
-    static constexpr size_t MAX_PARTICLES = 10000;
-
-    // Particle instance data for GPU
-    struct ParticleInstanceData {
-        glm::vec4 positionSize;  // xyz = position, w = size
-        glm::vec4 color;         // rgba
-        float rotation;
-        float padding[3];
-    };
-
-    std::vector<ParticleInstanceData> m_instanceData;
+    ParticleInstance* m_instanceBufferMapped = nullptr;  ///< Sized to the pool capacity
+    size_t m_instanceCount = 0;                          ///< Instances written by the last render()
 };
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "particle/particle_pool.h"
 #include <glm/glm.hpp>
 #include <vector>
 #include <memory>
@@ -7,26 +8,13 @@
 
 class VulkanRenderer;
 
-/**
- * @brief Simple particle for water splashes and effects
- */
-struct Particle {
-    glm::vec3 position;
-    glm::vec3 velocity;
-    glm::vec3 color;
-    float lifetime;      // Time remaining (seconds)
-    float maxLifetime;   // Total lifetime
-    float size;          // Particle size
-
-    Particle(const glm::vec3& pos, const glm::vec3& vel, const glm::vec3& col, float life, float sz)
-        : position(pos), velocity(vel), color(col), lifetime(life), maxLifetime(life), size(sz) {}
-
-    bool isAlive() const { return lifetime > 0.0f; }
-    float getAlpha() const { return lifetime / maxLifetime; }
-};
-
 /**
  * @brief Manages particle effects for water splashes
+ *
+ * DATA-ORIENTED (2025-11-28): Owns the engine-wide ParticlePool. Splash particles
+ * use one built-in emitter slot (gravity, alpha fading over lifetime); their
+ * color and size ride along as the per-particle tint and size scale. Other systems
+ * can spawn into the same pool via getPool().
  */
 class ParticleSystem {
 public:
@@ -63,9 +51,10 @@ public:
     bool spawnParticleEffect(const std::string& effectName, const glm::vec3& position, float intensity = 1.0f);
 
     /**
-     * @brief Gets all active particles for rendering
+     * @brief Gets the engine-wide particle pool (SoA, for rendering and shared spawning)
      */
-    const std::vector<Particle>& getParticles() const { return m_particles; }
+    ParticlePool& getPool() { return m_pool; }
+    const ParticlePool& getPool() const { return m_pool; }
 
     /**
      * @brief Clears all particles
@@ -73,8 +62,8 @@ public:
     void clear();
 
 private:
-    std::vector<Particle> m_particles;
-    const float m_gravity = -9.8f;  // Gravity acceleration
+    ParticlePool m_pool;
+    uint16_t m_splashSlot;  ///< Built-in emitter: gravity, fade out, per-particle tint/size
 
     void spawnParticle(const glm::vec3& position, const glm::vec3& velocity,
                       const glm::vec3& color, float lifetime, float size);
@@ -16,10 +16,15 @@
 #include <mutex>
 #include <vector>
 #include <glm/glm.hpp>
+#include "profiler.h"
 
 /**
  * @brief Scoped timer for automatic timing measurements
  *
+ * Feeds PerformanceMonitor's per-frame report. Each measurement locks the monitor
+ * and hashes a string label, so keep it to a few coarse per-frame sections; use
+ * PROFILE_ZONE (profiler.h) for hot loops and worker threads.
+ *
  * Usage:
  * @code
  *   {
@@ -129,10 +134,13 @@ private:
 /**
  * @brief Helper macro for automatic timing
  *
+ * Now a zone profiler zone (the old ScopedTimer expansion also pasted __LINE__
+ * unexpanded, so two PERF_SCOPEs in one scope collided).
+ *
  * Usage:
  * @code
- *   PERF_SCOPE("decoration_processing");
+ *   PERF_SCOPE("decoration_processing");  // String literal
  *   // ... code to measure ...
  * @endcode
  */
-#define PERF_SCOPE(label) ScopedTimer __perf_timer_##__LINE__(label)
+#define PERF_SCOPE(label) PROFILE_ZONE(label)
@@ -0,0 +1,282 @@
+/**
+ * @file profiler.h
+ * @brief Low-overhead hierarchical zone profiler
+ *
+ * Replacement for string-keyed ScopedTimer in hot loops and worker threads.
+ *
+ * ARCHITECTURE:
+ * - Zones: PROFILE_ZONE("name") registers a zone once per call site (function
+ *   local static) and gets a 16-bit ID. No strings are touched at runtime.
+ * - Timestamps: rdtsc on x86/x64 (steady_clock elsewhere), converted to
+ *   nanoseconds with a ratio calibrated against steady_clock.
+ * - Recording: One event per zone, written when the zone closes into the calling
+ *   thread's own ring (single producer, single consumer). No locks, no
+ *   allocation after the thread's first zone. Full rings drop events.
+ * - Frames: frameMark() (main thread, once per frame) drains every ring into
+ *   a history of the last MAX_FRAMES frames.
+ * - Threads: a ring is freed when its thread exits, or after the next
+ *   frameMark() drains it if it still holds events. shutdown() frees the rest.
+ * - Viewing: drawWindow() shows frame times and an ImPlot flame graph of the
+ *   selected frame (one lane per thread, nested zones stacked by depth).
+ *   exportChromeTrace() writes the history for chrome://tracing / Perfetto.
+ *
+ * Cost is two timestamp reads plus a thread_local load and one 24-byte store
+ * per zone (~20 ns on bare metal; virtualized rdtsc adds ~20 ns per read), so
+ * zones can stay enabled in release builds.
+ *
+ * KNOWN LIMITATION: In a VM a zone measures ~51 ns, just over the 50 ns budget.
+ * The two rdtsc reads take ~44 ns of that (trapped/emulated TSC) and the
+ * bookkeeping takes under 10 ns, so the gap can't be closed here.
+ *
+ * Created: 2025-11-28
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#define PROFILER_HAS_RDTSC 1
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define PROFILER_HAS_RDTSC 1
+#else
+#include <chrono>
+#define PROFILER_HAS_RDTSC 0
+#endif
+
+/**
+ * @brief One closed zone (24 bytes)
+ */
+struct ProfileEvent {
+    uint64_t startTick;     ///< Raw timestamp at zone entry
+    uint64_t endTick;       ///< Raw timestamp at zone exit
+    uint16_t zoneId;        ///< Index into the zone registry
+    uint8_t depth;          ///< Nesting depth on the recording thread
+    uint8_t thread;         ///< Recording thread index
+    uint32_t padding;
+};
+
+/**
+ * @brief Static description of a zone call site
+ */
+struct ProfileZoneInfo {
+    const char* name;       ///< Zone label (string literal)
+    const char* file;
+    int line;
+};
+
+/**
+ * @brief Events drained at one frame mark
+ */
+struct ProfileFrame {
+    uint64_t startTick = 0;
+    uint64_t endTick = 0;
+    std::vector<ProfileEvent> events;
+};
+
+/**
+ * @brief Singleton zone profiler
+ */
+class Profiler {
+public:
+    static constexpr size_t RING_CAPACITY = 8192;       ///< Events per thread ring (power of two)
+    static constexpr size_t MAX_FRAMES = 240;           ///< Frame history (~4 seconds at 60 FPS)
+    static constexpr size_t MAX_ZONES = 4096;           ///< Zone registry capacity
+    static constexpr size_t MAX_THREADS = 256;          ///< Thread index range (indices wrap)
+
+    static Profiler& instance();
+
+    /**
+     * @brief Gets a raw timestamp (rdtsc ticks or steady_clock nanoseconds)
+     */
+    static inline uint64_t now() {
+#if PROFILER_HAS_RDTSC
+        return __rdtsc();
+#else
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+#endif
+    }
+
+    /**
+     * @brief Registers a zone call site (once per PROFILE_ZONE via function-local static)
+     * @return Zone ID
+     */
+    static uint16_t registerZone(const char* name, const char* file, int line);
+
+    /**
+     * @brief Names the calling thread in the flame graph and exports
+     */
+    static void setThreadName(const char* name);
+
+    bool isEnabled() const { return m_enabled.load(std::memory_order_relaxed); }
+    void setEnabled(bool enabled) { m_enabled.store(enabled, std::memory_order_relaxed); }
+
+    /**
+     * @brief Opens a zone on the calling thread (used by ProfileScope)
+     * @return Nesting depth of the new zone
+     */
+    static uint8_t enterZone();
+
+    /**
+     * @brief Closes the innermost zone on the calling thread and records it (used by ProfileScope)
+     */
+    void recordZone(uint16_t zoneId, uint8_t depth, uint64_t startTick, uint64_t endTick);
+
+    /**
+     * @brief Ends the current frame: drains all thread rings into the history
+     *
+     * Call once per frame from the main thread.
+     */
+    void frameMark();
+
+    /**
+     * @brief Stops recording and frees every ring and the frame history
+     *
+     * Call once at exit, after worker threads are joined.
+     */
+    void shutdown();
+
+    /**
+     * @brief Freezes the frame history for inspection (drained events are discarded)
+     */
+    void setPaused(bool paused) { m_paused = paused; }
+    bool isPaused() const { return m_paused; }
+
+    /**
+     * @brief Converts a tick delta to milliseconds
+     */
+    double ticksToMs(uint64_t ticks) const { return ticks * m_msPerTick; }
+
+    /**
+     * @brief Draws the profiler window (frame times + flame graph)
+     * @param open Window close button state (may be nullptr)
+     */
+    void drawWindow(bool* open);
+
+    /**
+     * @brief Writes the frame history as Chrome trace / Perfetto JSON
+     * @param path Output file path
+     * @return True on success
+     */
+    bool exportChromeTrace(const std::string& path);
+
+    const char* getZoneName(uint16_t zoneId) const;
+    std::string getThreadName(uint8_t thread) const;
+    uint64_t getDroppedCount() const { return m_dropped.load(std::memory_order_relaxed); }
+
+private:
+    /// Single-producer single-consumer ring owned by one thread
+    struct ThreadRing {
+        ProfileEvent events[RING_CAPACITY];
+        std::atomic<uint64_t> head{0};      ///< Written by the owning thread
+        std::atomic<uint64_t> tail{0};      ///< Written by frameMark()
+        std::atomic<bool> retired{false};   ///< Owning thread has exited
+        uint8_t threadIndex = 0;
+        uint8_t depth = 0;                  ///< Open zone count (owning thread only)
+    };
+
+    friend struct ProfilerThreadSlot;
+
+    Profiler();
+    ~Profiler() = default;
+
+    Profiler(const Profiler&) = delete;
+    Profiler& operator=(const Profiler&) = delete;
+
+    ThreadRing* threadRing();
+    void calibrate();
+
+    /**
+     * @brief Called when a ring's thread exits: frees it now unless frameMark() still has events to drain
+     */
+    void retireRing(const std::shared_ptr<ThreadRing>& ring);
+
+    static thread_local ThreadRing* s_threadRing;       ///< Calling thread's ring (hot path)
+
+    std::atomic<bool> m_enabled{true};
+    std::atomic<uint64_t> m_dropped{0};
+    bool m_paused = false;
+
+    // Tick calibration (main thread)
+    uint64_t m_calibrationTick = 0;
+    int64_t m_calibrationNs = 0;
+    double m_msPerTick = 1.0e-6;
+
+    std::vector<std::shared_ptr<ThreadRing>> m_rings;   ///< All live rings
+    mutable std::mutex m_ringsMutex;                    ///< Guards m_rings and thread names
+    std::vector<std::string> m_threadNames;             ///< Indexed by thread index
+    uint32_t m_nextThreadIndex = 0;
+    bool m_framesMarked = false;                        ///< frameMark() has run (it drains retired rings)
+
+    // Frame history (main thread only)
+    std::vector<ProfileFrame> m_frames;                 ///< Ring of MAX_FRAMES frames
+    size_t m_frameCursor = 0;                           ///< Next frame slot to overwrite
+    size_t m_frameCount = 0;                            ///< Valid frames in the history
+    uint64_t m_lastFrameTick = 0;
+    int m_selectedFrame = -1;                           ///< History index (-1 = latest)
+};
+
+/**
+ * @brief RAII zone (use PROFILE_ZONE instead of constructing directly)
+ */
+class ProfileScope {
+public:
+    explicit ProfileScope(uint16_t zoneId)
+        : m_zoneId(zoneId)
+        , m_active(Profiler::instance().isEnabled()) {
+        if (m_active) {
+            m_depth = Profiler::enterZone();
+            m_start = Profiler::now();
+        }
+    }
+
+    ~ProfileScope() {
+        if (m_active) {
+            const uint64_t end = Profiler::now();
+            Profiler::instance().recordZone(m_zoneId, m_depth, m_start, end);
+        }
+    }
+
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+
+private:
+    uint16_t m_zoneId;
+    bool m_active;
+    uint8_t m_depth = 0;
+    uint64_t m_start = 0;
+};
+
+#define PROFILER_CONCAT_INNER(a, b) a##b
+#define PROFILER_CONCAT(a, b) PROFILER_CONCAT_INNER(a, b)
+
+/**
+ * @brief Profiles the enclosing scope
+ *
+ * Usage:
+ * @code
+ *   void World::decorateChunk(Chunk* chunk) {
+ *       PROFILE_ZONE("decorate_chunk");
+ *       // ... code to measure ...
+ *   }
+ * @endcode
+ *
+ * @param name String literal (stored by pointer, never copied)
+ */
+#define PROFILE_ZONE(name)                                                              \
+    static const uint16_t PROFILER_CONCAT(s_profileZone_, __LINE__) =                   \
+        Profiler::registerZone(name, __FILE__, __LINE__);                               \
+    ProfileScope PROFILER_CONCAT(profileScope_, __LINE__)(PROFILER_CONCAT(s_profileZone_, __LINE__))
+
+/**
+ * @brief Profiles the enclosing function under its own name
+ */
+#define PROFILE_FUNCTION() PROFILE_ZONE(__func__)
@@ -0,0 +1,102 @@
+/**
+ * @file quad_index.h
+ * @brief Implicit quad indexing for chunk meshes
+ *
+ * Every chunk face is a quad of 4 consecutive CompressedVertex entries drawn as
+ * the triangles {0,1,2} {0,2,3}. Storing that pattern per chunk cost 6 x uint32
+ * (24 bytes) per quad on top of 48 bytes of vertices (4 x 12-byte CompressedVertex):
+ * a third of chunk mesh memory and upload bytes.
+ *
+ * Instead the renderer owns ONE static 16-bit index buffer holding the pattern
+ * for MAX_QUADS_PER_DRAW quads, and every chunk draw points into it with
+ * firstIndex = 0 and vertexOffset = the chunk's base vertex in the mega-buffer.
+ * Chunks only store and upload vertices; their index count is derived.
+ *
+ * 16-bit indices address 65536 vertices (16384 quads) per draw. Larger meshes
+ * are split into several draws by forEachDraw(), each advancing vertexOffset.
+ *
+ * Created: 2025-11-28
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace QuadIndex {
+
+using Index = uint16_t;                          ///< Shared buffer index type (VK_INDEX_TYPE_UINT16)
+
+constexpr uint32_t VERTICES_PER_QUAD = 4;
+constexpr uint32_t INDICES_PER_QUAD = 6;
+constexpr uint32_t PATTERN[INDICES_PER_QUAD] = {0, 1, 2, 0, 2, 3};
+
+/// Quads addressable by one draw through 16-bit indices
+constexpr uint32_t MAX_QUADS_PER_DRAW = 65536 / VERTICES_PER_QUAD;
+
+/// Size of the shared index buffer in bytes
+constexpr size_t SHARED_BUFFER_BYTES = sizeof(Index) * MAX_QUADS_PER_DRAW * INDICES_PER_QUAD;
+
+/// Index count to draw a quad-list mesh with this many vertices
+inline uint32_t indexCountForVertices(uint32_t vertexCount) {
+    return (vertexCount / VERTICES_PER_QUAD) * INDICES_PER_QUAD;
+}
+
+/**
+ * @brief Builds the shared index buffer contents (quad q uses vertices 4q..4q+3)
+ */
+inline std::vector<Index> buildSharedIndices(uint32_t quadCount = MAX_QUADS_PER_DRAW) {
+    quadCount = std::min(quadCount, MAX_QUADS_PER_DRAW);
+    std::vector<Index> indices(static_cast<size_t>(quadCount) * INDICES_PER_QUAD);
+    for (uint32_t q = 0; q < quadCount; q++) {
+        const uint32_t base = q * VERTICES_PER_QUAD;
+        for (uint32_t i = 0; i < INDICES_PER_QUAD; i++) {
+            indices[q * INDICES_PER_QUAD + i] = static_cast<Index>(base + PATTERN[i]);
+        }
+    }
+    return indices;
+}
+
+/**
+ * @brief Checks that an explicit index list is exactly the implicit quad pattern
+ *
+ * This is the condition under which a mesh's indices can be dropped: the shared
+ * buffer reproduces them for any vertex count.
+ */
+inline bool isImplicitQuadList(const uint32_t* indices, size_t indexCount, uint32_t vertexCount) {
+    if (indexCount != indexCountForVertices(vertexCount) || vertexCount % VERTICES_PER_QUAD != 0) {
+        return false;
+    }
+    for (size_t i = 0; i < indexCount; i++) {
+        const uint32_t quad = static_cast<uint32_t>(i / INDICES_PER_QUAD);
+        if (indices[i] != quad * VERTICES_PER_QUAD + PATTERN[i % INDICES_PER_QUAD]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Splits a quad-list mesh into draws the shared buffer can address
+ *
+ * Calls fn(indexCount, vertexOffset) once per draw of at most MAX_QUADS_PER_DRAW
+ * quads; every draw starts at firstIndex 0 of the shared buffer.
+ *
+ * @param vertexCount Mesh vertex count (4 per quad)
+ * @param baseVertex First vertex of the mesh in the bound vertex buffer
+ */
+template <typename Fn>
+void forEachDraw(uint32_t vertexCount, int32_t baseVertex, Fn&& fn) {
+    uint32_t quadsLeft = vertexCount / VERTICES_PER_QUAD;
+    int32_t vertexOffset = baseVertex;
+    while (quadsLeft > 0) {
+        const uint32_t quads = std::min(quadsLeft, MAX_QUADS_PER_DRAW);
+        fn(quads * INDICES_PER_QUAD, vertexOffset);
+        vertexOffset += static_cast<int32_t>(quads * VERTICES_PER_QUAD);
+        quadsLeft -= quads;
+    }
+}
+
+}  // namespace QuadIndex
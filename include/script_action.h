@@ -1,4 +1,6 @@
 #pragma once
+#include <cstdint>
+#include <memory>
 #include <string>
 #include <vector>
 #include <unordered_map>
@@ -6,6 +8,8 @@
 #include <glm/glm.hpp>
 #include <yaml-cpp/yaml.h>
 
+class ScriptProgram;
+
 /**
  * @file script_action.h
  * @brief YAML-based scripting system for blocks and biomes
@@ -97,11 +101,56 @@ public:
 
     /**
      * @brief Clear all variables
+     *
+     * Slot indices stay valid; cleared slots read as unset.
      */
     void clear();
 
+    // ========== Slot Access (compiled scripts) ==========
+    // PERFORMANCE (2025-11-28): ScriptProgram resolves each variable name to a
+    // slot once at compile time. Slot calls skip the name hash, and numeric
+    // values stay ints instead of round-tripping through std::to_string/stoi.
+
+    /**
+     * @brief Get (or create) the slot index for a variable name
+     * @return Stable index for the lifetime of the registry
+     */
+    uint32_t resolveSlot(const std::string& name);
+
+    /**
+     * @brief Set a slot to an integer value
+     */
+    void setSlotNumeric(uint32_t slot, int value);
+
+    /**
+     * @brief Set a slot to a text value (getNumeric() still parses it)
+     */
+    void setSlotText(uint32_t slot, const std::string& value);
+
+    /**
+     * @brief Add to a slot's numeric value (unset or non-numeric counts as 0)
+     * @return New value
+     */
+    int addToSlot(uint32_t slot, int amount);
+
+    /**
+     * @brief Get a slot's numeric value
+     */
+    int getSlotNumeric(uint32_t slot, int defaultValue = 0);
+
 private:
-    std::unordered_map<std::string, std::string> m_variables;
+    struct Slot {
+        bool set = false;
+        bool numeric = false;  ///< number is authoritative; text is unused
+        int number = 0;
+        std::string text;
+    };
+
+    uint32_t resolveSlotLocked(const std::string& name);
+    static int slotNumber(const Slot& slot, int defaultValue);
+
+    std::unordered_map<std::string, uint32_t> m_slotIndex;
+    std::vector<Slot> m_slots;
     std::mutex m_mutex;
 };
 
@@ -119,7 +168,7 @@ enum class ActionType {
     PLAY_SOUND,        ///< Play a sound effect (uses soundName) - Future
     RUN_COMMAND,       ///< Execute a console command (uses command)
     SET_METADATA,      ///< Set block metadata (uses metadata map)
-    TRIGGER_UPDATE,    ///< Schedule a block update tick (uses offset)
+    TRIGGER_UPDATE,    ///< Schedule a block update tick (uses offset + delayTicks)
     SET_VARIABLE,      ///< Set a variable value (uses variableName + variableValue)
     GET_VARIABLE,      ///< Get a variable value (uses variableName, for conditions)
     INCREMENT_VAR,     ///< Increment a numeric variable (uses variableName + incrementAmount)
@@ -164,6 +213,7 @@ struct ScriptAction {
     std::string command;         ///< Console command for RUN_COMMAND
     glm::ivec3 offset{0,0,0};    ///< Relative position offset from event location
     int probability = 100;       ///< Chance to execute (0-100, default 100 = always)
+    int delayTicks = 1;          ///< Game ticks before a TRIGGER_UPDATE fires (20 per second)
 
     // Metadata for SET_METADATA action
     std::unordered_map<std::string, std::string> metadata;
@@ -207,6 +257,7 @@ struct ScriptAction {
 struct ScriptEventHandler {
     std::string eventType;  ///< Event type: "on_break", "on_place", "on_step", "on_neighbor_change", etc.
     std::vector<ScriptAction> actions;  ///< Actions to execute when event fires
+    std::shared_ptr<const ScriptProgram> program;  ///< actions compiled by fromYAML(); what actually runs
 
     /**
      * @brief Parse a ScriptEventHandler from a YAML node
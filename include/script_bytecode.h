@@ -0,0 +1,119 @@
+/**
+ * @file script_bytecode.h
+ * @brief Flat bytecode for YAML script actions
+ *
+ * Event handlers used to walk the ScriptAction tree on every event: a debug
+ * log stream per action, BlockRegistry::getID() per place_block, lowercased
+ * name compares for block_is, std::stoi for chance/metadata values, and
+ * variables kept as strings in a hashed map.
+ *
+ * ScriptProgram::compile() flattens a handler's actions once at load time:
+ * - Conditionals and per-action probability become forward jumps
+ * - Constants (chance, metadata, delays, integer variable values) are parsed
+ * - Variable names become ScriptVariableRegistry slot indices
+ * - Block names become IDs (linked on first run, since biome scripts can load
+ *   before every block is registered)
+ *
+ * execute() is a single switch loop over 24-byte instructions.
+ *
+ * Created: 2025-11-28
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include <glm/glm.hpp>
+
+struct ScriptAction;
+
+/**
+ * @brief Bytecode operations
+ *
+ * Operand use is listed per op; "target" is an instruction index. JUMP_UNLESS_*
+ * ops fall through when their test passes and jump to b otherwise.
+ */
+enum class ScriptOp : uint8_t {
+    PLACE_BLOCK,            ///< a = block ID (-1 = unknown), b = name string
+    BREAK_BLOCK,
+    SPAWN_STRUCTURE,        ///< a = structure name string
+    SPAWN_PARTICLES,        ///< a = particle name string
+    PLAY_SOUND,             ///< a = sound name string
+    RUN_COMMAND,            ///< a = command string
+    SET_METADATA,           ///< a = metadata value (0-255)
+    TRIGGER_UPDATE,         ///< a = delay in game ticks
+    SET_VAR_NUMBER,         ///< a = variable slot, b = value
+    SET_VAR_TEXT,           ///< a = variable slot, b = value string
+    ADD_VAR,                ///< a = variable slot, b = amount (negative for decrement_var)
+    JUMP_UNLESS_BLOCK,      ///< a = block ID, b = target
+    JUMP_UNLESS_NOT_BLOCK,  ///< a = block ID, b = target
+    JUMP_UNLESS_CHANCE,     ///< a = percent, b = target
+    JUMP_UNLESS_DAY,        ///< b = target
+    JUMP_UNLESS_NIGHT,      ///< b = target
+    JUMP                    ///< b = target
+};
+
+/**
+ * @brief One instruction; offset is relative to the event position
+ */
+struct ScriptInstruction {
+    ScriptOp op;
+    glm::ivec3 offset{0, 0, 0};
+    int32_t a = 0;
+    int32_t b = 0;
+};
+
+/**
+ * @brief Compiled event handler (immutable after the first execute)
+ *
+ * THREAD SAFETY (2025-11-28): execute() may run concurrently; block name
+ * linking happens exactly once under std::call_once.
+ */
+class ScriptProgram {
+public:
+    /**
+     * @brief Compile an action list
+     *
+     * Invalid constants (e.g. a non-numeric random_chance) are reported here
+     * once and compiled to their runtime result.
+     *
+     * @param actions Parsed actions, in execution order
+     * @param name Handler name for log messages (e.g. "on_break")
+     */
+    static std::shared_ptr<ScriptProgram> compile(const std::vector<ScriptAction>& actions,
+                                                  const std::string& name);
+
+    /**
+     * @brief Run the program for an event at position
+     */
+    void execute(const glm::ivec3& position) const;
+
+    const std::vector<ScriptInstruction>& getCode() const { return m_code; }
+    size_t size() const { return m_code.size(); }
+    const std::string& getName() const { return m_name; }
+
+private:
+    /// Block name waiting to be resolved into m_code[pc].a
+    struct BlockRef {
+        uint32_t pc;
+        uint32_t nameIndex;
+        bool exactName;   ///< place_block uses getID(); block_is compares normalized names
+    };
+
+    void emitActions(const std::vector<ScriptAction>& actions);
+    void emitAction(const ScriptAction& action);
+    size_t emit(ScriptOp op, const glm::ivec3& offset, int32_t a = 0, int32_t b = 0);
+    int32_t addString(const std::string& value);
+    void patchJump(size_t pc) { m_code[pc].b = static_cast<int32_t>(m_code.size()); }
+    void link() const;
+
+    std::string m_name;
+    mutable std::vector<ScriptInstruction> m_code;  ///< Block operands written once by link()
+    std::vector<std::string> m_strings;
+    std::vector<BlockRef> m_blockRefs;
+    mutable std::once_flag m_linkOnce;
+};
@@ -0,0 +1,133 @@
+/**
+ * @file structure_placement.h
+ * @brief Generation-time structure layer with deterministic per-region sites
+ *
+ * Structures with a `generation:` block (see StructureGenerationRule) are
+ * scattered over square regions of the world. A region's site depends only on
+ * the world seed, the structure, the region coordinates and the BiomeMap, so
+ * every chunk can work out on its own which structures overlap it:
+ * - No neighbour chunks need to exist or be locked
+ * - Each chunk blits only its own clipped part of every overlapping structure,
+ *   so workers generating adjacent chunks in parallel never share state
+ * - Candidates draw from a SplitMix64 hash of (seed, structure, region)
+ *   instead of constructing an mt19937 per chunk
+ *
+ * The object is immutable after addStructures(); every query is thread-safe.
+ * Definitions are copied in, so `reload structures` can rewrite the registry
+ * while workers are placing: World publishes a rebuilt placement and workers
+ * still holding the old one finish with their snapshot.
+ *
+ * Created: 2025-11-28
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#include <glm/glm.hpp>
+
+class BiomeMap;
+class Chunk;
+struct Biome;
+struct StructureDefinition;
+struct StructureVariation;
+
+/**
+ * @brief Resolves and places worldgen structure sites chunk by chunk
+ */
+class StructurePlacement {
+public:
+    /**
+     * @brief A resolved structure site
+     *
+     * Points into this placement's own definition snapshots (valid while it lives).
+     */
+    struct Site {
+        const StructureDefinition* definition = nullptr;
+        const StructureVariation* variation = nullptr;
+        glm::ivec3 origin{0};  ///< World position of the variation's [0][0][0] cell
+    };
+
+    /**
+     * @brief Creates an empty placement layer
+     * @param seed World seed
+     * @param biomeMap Biome map used to test candidates (must outlive this object)
+     */
+    StructurePlacement(int seed, BiomeMap* biomeMap);
+
+    /**
+     * @brief Registers structures with generation enabled
+     *
+     * Call once before the placement is shared with generation workers (not
+     * thread-safe). Each definition is copied, so the registry may be reloaded
+     * afterwards without affecting this object.
+     *
+     * @param definitions Structures from StructureRegistry::getGeneratedStructures()
+     */
+    void addStructures(const std::vector<const StructureDefinition*>& definitions);
+
+    /**
+     * @brief Resolves the site of one region
+     *
+     * @param structureIndex Index into the registered structures
+     * @param regionX Region X coordinate (world X / regionSize, floored)
+     * @param regionZ Region Z coordinate
+     * @param site Receives the site if the region has one
+     * @return True if the region contains a site
+     */
+    bool resolveSite(size_t structureIndex, int regionX, int regionZ, Site& site) const;
+
+    /**
+     * @brief Collects every site whose blocks overlap a chunk
+     *
+     * Sites are appended in structure registration order, then region order,
+     * which is also the order placeInChunk() blits them in.
+     */
+    void findSites(int chunkX, int chunkY, int chunkZ, std::vector<Site>& sites) const;
+
+    /**
+     * @brief Blits the part of every overlapping structure that lies inside a chunk
+     *
+     * Only writes to this chunk. Call right after Chunk::generate() on freshly
+     * generated chunks (chunks loaded from disk already contain their structures).
+     *
+     * @return Number of blocks written
+     */
+    int placeInChunk(Chunk* chunk) const;
+
+    /**
+     * @brief Gets the number of registered structures
+     */
+    size_t getStructureCount() const { return m_structures.size(); }
+
+    /**
+     * @brief Mixes a 64-bit value (SplitMix64 finalizer)
+     */
+    static uint64_t mix64(uint64_t value);
+
+private:
+    struct Entry {
+        std::shared_ptr<const StructureDefinition> definition;  ///< Snapshot taken by addStructures()
+        uint64_t salt;                          ///< Name hash so structures don't share region layouts
+        std::vector<std::string> biomes;        ///< Registered names of generation.biomes (empty = any)
+        glm::ivec3 reachMin;                    ///< Union of variation AABBs relative to the site center (inclusive)
+        glm::ivec3 reachMax;                    ///< Union of variation AABBs relative to the site center (exclusive)
+    };
+
+    /// Hash-only part of a site: no BiomeMap lookups
+    struct Candidate {
+        const StructureVariation* variation;
+        int centerX;
+        int centerZ;
+        int activityRoll;  ///< 0-99, compared against the biome's structure activity
+    };
+
+    bool rollCandidate(const Entry& entry, int regionX, int regionZ, Candidate& candidate) const;
+    bool testCandidate(const Entry& entry, const Candidate& candidate, Site& site) const;
+
+    uint64_t m_seed;
+    BiomeMap* m_biomeMap;
+    std::vector<Entry> m_structures;
+};
@@ -6,6 +6,7 @@
  * - Loading structure definitions from YAML files (assets/structures/)
  * - Multiple variations with weighted random selection
  * - Structure spawning at world positions
+ * - Optional world generation rules (see structure_placement.h)
  * - Integration with block system for runtime block lookup
  */
 
@@ -15,7 +16,10 @@
 #include <vector>
 #include <unordered_map>
 #include <random>
+#include <climits>
 #include <glm/glm.hpp>
+#include "structure_template.h"
+#include "terrain_constants.h"
 
 // Forward declarations
 class World;
@@ -35,6 +39,26 @@ struct StructureVariation {
     /// First dimension is height (layers from bottom to top)
     /// Each layer is a 2D array of block IDs
     std::vector<std::vector<std::vector<int>>> structure;
+
+    /// structure compiled into Z spans at load time; this is what spawnStructure() places
+    StructureTemplate compiled;
+};
+
+/**
+ * @brief World generation settings from a structure's optional `generation:` block
+ *
+ * The world is split into square regions of regionSize blocks. Each region has at
+ * most one candidate site, kept separation/2 blocks from the region edges so that
+ * sites in neighbouring regions are at least `separation` blocks apart.
+ */
+struct StructureGenerationRule {
+    bool enabled = false;                 ///< Only structures with a generation block spawn during worldgen
+    int regionSize = 256;                 ///< Region side length in blocks
+    int separation = 32;                  ///< Minimum distance between sites in neighbouring regions
+    int chance = 50;                      ///< Percentage of regions with a site (then rolled against biome activity)
+    int minHeight = TerrainGeneration::WATER_LEVEL;  ///< Lowest allowed ground Y (default: sea level)
+    int maxHeight = INT_MAX;              ///< Highest allowed ground Y
+    std::vector<std::string> biomes;      ///< Allowed biome names (empty = any biome)
 };
 
 /**
@@ -46,6 +70,7 @@ struct StructureVariation {
 struct StructureDefinition {
     std::string name;                           ///< Structure name (e.g., "Oak Tree")
     std::vector<StructureVariation> variations; ///< All variations with chances
+    StructureGenerationRule generation;         ///< World generation placement (disabled by default)
 };
 
 /**
@@ -113,6 +138,24 @@ public:
      */
     bool spawnStructure(const std::string& name, World* world, const glm::ivec3& centerPos, VulkanRenderer* renderer = nullptr);
 
+    /**
+     * @brief Gets every structure with world generation enabled, sorted by name
+     *
+     * Pointers stay valid until the next loadStructures() call.
+     */
+    std::vector<const StructureDefinition*> getGeneratedStructures() const;
+
+    /**
+     * @brief Picks the variation a 0-99 roll falls into (weighted by chance)
+     *
+     * Shared by spawnStructure() and world generation, which rolls from a region hash.
+     *
+     * @param def Structure definition with variations
+     * @param roll Value in [0, 100)
+     * @return Selected variation, or nullptr if the definition has none
+     */
+    static const StructureVariation* pickVariation(const StructureDefinition& def, int roll);
+
     /**
      * @brief Gets all loaded structure names
      * @return Vector of structure names
@@ -0,0 +1,84 @@
+/**
+ * @file structure_template.h
+ * @brief Run-length compiled block templates for structures and trees
+ *
+ * Structures were placed by walking a [y][z][x] grid of block IDs, and trees
+ * by walking a TreeBlock list, with one World::setBlockAt() per voxel (chunk
+ * lookup, block lock, heightmap rescan each time).
+ *
+ * A StructureTemplate stores the same blocks as Z runs (the contiguous axis of
+ * Chunk::m_blocks), grouped by Y slice and sorted by X, plus the AABB of all
+ * non-air blocks. World::placeTemplate() visits only the chunks the AABB
+ * overlaps, and Chunk::blitTemplate() clips each span to the chunk once and
+ * fills it directly under a single lock, rescanning each touched heightmap
+ * column once.
+ *
+ * Air (ID 0) is never stored: templates only add blocks, as before.
+ *
+ * Created: 2025-11-28
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <glm/glm.hpp>
+
+/**
+ * @brief A run of identical blocks along +Z at one (x, y)
+ */
+struct TemplateSpan {
+    int32_t blockID;
+    int16_t x;          ///< Template-local X
+    int16_t z;          ///< Template-local Z of the first block
+    uint16_t length;    ///< Blocks in the run (>= 1)
+};
+
+class StructureTemplate {
+public:
+    /// One block of a template (same layout as TreeBlock)
+    struct Voxel {
+        glm::ivec3 pos;
+        int blockID;
+    };
+
+    StructureTemplate() = default;
+
+    /**
+     * @brief Compile a [y][z][x] block grid (structure YAML layout)
+     *
+     * Rows may be ragged; zero cells are skipped.
+     */
+    static StructureTemplate fromLayers(const std::vector<std::vector<std::vector<int>>>& layers);
+
+    /**
+     * @brief Compile a block list; for duplicate positions the last entry wins
+     */
+    static StructureTemplate fromVoxels(std::vector<Voxel> voxels);
+
+    bool empty() const { return m_spans.empty(); }
+    size_t getBlockCount() const { return m_blockCount; }
+    size_t getSpanCount() const { return m_spans.size(); }
+
+    /// Inclusive lower corner of the non-air AABB (template-local)
+    const glm::ivec3& getMin() const { return m_min; }
+    /// Exclusive upper corner of the non-air AABB (template-local)
+    const glm::ivec3& getMax() const { return m_max; }
+
+    /**
+     * @brief Spans of one Y slice, sorted by X then Z
+     * @param y Template-local Y in [getMin().y, getMax().y)
+     */
+    const TemplateSpan* sliceBegin(int y) const { return m_spans.data() + m_sliceStart[y - m_min.y]; }
+    const TemplateSpan* sliceEnd(int y) const { return m_spans.data() + m_sliceStart[y - m_min.y + 1]; }
+
+private:
+    void build(std::vector<Voxel>& voxels);
+
+    std::vector<TemplateSpan> m_spans;
+    std::vector<uint32_t> m_sliceStart;   ///< Size (max.y - min.y + 1); slice i = [start[i], start[i+1])
+    glm::ivec3 m_min{0, 0, 0};
+    glm::ivec3 m_max{0, 0, 0};
+    size_t m_blockCount = 0;
+};
@@ -0,0 +1,85 @@
+/**
+ * @file texture_array.h
+ * @brief CPU side of the block texture array (layer packing and mip chains)
+ *
+ * World geometry samples block textures from a VK_IMAGE_VIEW_TYPE_2D_ARRAY
+ * image instead of the 2D atlas:
+ * - One layer per unique texture file, in first-reference order. The layer index
+ *   is stored in the vertex (the 16 bits that used to hold the atlas cell), so
+ *   greedy quads tile with plain REPEAT addressing and no padding or clamping.
+ * - Layers are square, LAYER_SIZE_MIN..LAYER_SIZE_MAX pixels (the largest source,
+ *   rounded up to a power of two), so 128px packs no longer hit an atlas limit.
+ * - Every layer carries a full mip chain built here, offline, with an sRGB-correct
+ *   alpha-weighted box filter (cutout texels don't bleed black into the mips).
+ *   The chains are baked to cache/block_layers.bin next to the atlas bake.
+ *
+ * Pixel layout of a baked array: layer-major, each layer its mip chain from
+ * level 0 down to 1x1, RGBA8 rows tightly packed (see mipOffset()).
+ *
+ * The 2D atlas is still built for ImGui block icons.
+ *
+ * Created: 2025-11-28
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace TextureArray {
+
+constexpr int LAYER_SIZE_MIN = 64;    ///< Smallest layer edge (the old atlas tile size)
+constexpr int LAYER_SIZE_MAX = 128;   ///< Largest layer edge (bigger sources are downscaled)
+constexpr int MAX_LAYERS = 256;       ///< Guaranteed maxImageArrayLayers minimum in Vulkan
+
+/**
+ * @brief Layer assignment for the face references of all blocks
+ */
+struct LayerPlan {
+    std::vector<int> layerSources;   ///< Unique source index per layer
+    std::vector<int> sourceLayers;   ///< Layer per unique source (-1 = unreferenced or failed to load)
+    std::vector<int> refLayers;      ///< Layer per face reference (-1 = source failed to load)
+    std::vector<int> droppedSources; ///< Loaded sources past MAX_LAYERS (drawn with layer 0), in reference order
+};
+
+/**
+ * @brief Packs referenced sources into layers
+ *
+ * Each loaded source gets one layer the first time it is referenced; animated
+ * blocks no longer reserve extra slots. Sources past MAX_LAYERS map to layer 0
+ * and are listed in droppedSources so the caller can report them.
+ *
+ * @param refSources Unique source index per face reference, in reference order
+ * @param loaded One flag per unique source (0 = decode failed)
+ */
+LayerPlan planLayers(const std::vector<int>& refSources, const std::vector<uint8_t>& loaded);
+
+/**
+ * @brief Picks the layer edge for a set of sources
+ * @param sourceEdges Larger edge of every loaded source (pixels)
+ * @return Power of two in [LAYER_SIZE_MIN, LAYER_SIZE_MAX]
+ */
+int chooseLayerSize(const std::vector<int>& sourceEdges);
+
+/// Mip levels for a square power-of-two layer (64 -> 7: 64, 32, ..., 1)
+int mipLevelCount(int layerSize);
+
+/// Byte offset of a mip level inside one layer's chain
+size_t mipOffset(int layerSize, int level);
+
+/// Bytes of one layer including its whole mip chain
+size_t layerBytes(int layerSize);
+
+/**
+ * @brief Fills levels 1..n of a mip chain from level 0
+ *
+ * Each texel is the 2x2 box average of the level above, averaged in linear
+ * light and weighted by alpha; alpha itself is averaged linearly.
+ *
+ * @param chain layerBytes(layerSize) bytes with level 0 filled in
+ * @param layerSize Level 0 edge (power of two)
+ */
+void buildMipChain(uint8_t* chain, int layerSize);
+
+}  // namespace TextureArray
@@ -4,7 +4,9 @@
 #include <memory>
 #include <random>
 #include <thread>
+#include <string>
 #include <glm/glm.hpp>
+#include "structure_template.h"
 
 // Forward declaration
 class World;
@@ -24,6 +26,7 @@ struct TreeTemplate {
     int height;                      // Tree height in blocks
     std::vector<TreeBlock> blocks;   // All blocks that make up the tree
     std::string type_name;           // "small_oak", "large_oak", etc.
+    StructureTemplate compiled;      // blocks as Z spans (built once per template; used by placeTree)
 };
 
 /**
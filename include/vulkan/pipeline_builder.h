@@ -238,6 +238,13 @@ public:
      */
     PipelineBuilder& setPipelineLayout(VkPipelineLayout layout);
 
+    /**
+     * @brief Compile through a pipeline cache (see PipelineCache)
+     * @param cache Cache handle, or VK_NULL_HANDLE for none
+     * @return Reference to this builder
+     */
+    PipelineBuilder& setPipelineCache(VkPipelineCache cache);
+
     // ========== Dynamic State ==========
 
     /**
@@ -321,4 +328,7 @@ private:
 
     // Created pipeline layout (if we created one)
     VkPipelineLayout m_createdLayout = VK_NULL_HANDLE;
+
+    // Pipeline cache (not reset by clear())
+    VkPipelineCache m_pipelineCache = VK_NULL_HANDLE;
 };
@@ -0,0 +1,89 @@
+/**
+ * @file pipeline_cache.h
+ * @brief Disk-backed VkPipelineCache shared by every pipeline the engine builds
+ *
+ * Without a cache every launch recompiles all pipelines from SPIR-V. The cache
+ * blob is loaded at startup and written back on shutdown (and after a cold
+ * start), so restarts only pay for pipelines whose shaders changed.
+ *
+ * VALIDATION: The file starts with our own header (magic, vendor/device ID,
+ * driver version, pipelineCacheUUID, size, checksum). Any mismatch - new GPU,
+ * driver update, truncated or corrupt file - discards the blob and starts
+ * empty instead of handing stale data to the driver.
+ *
+ * THREADING: The VkPipelineCache is created without EXTERNALLY_SYNCHRONIZED,
+ * so pipelines may be created from several threads at once using get().
+ *
+ * Usage:
+ *   PipelineCache cache(device, physicalDevice, "cache/pipeline_cache.bin");
+ *   builder.setPipelineCache(cache.get());
+ *   ...
+ *   cache.save();  // Also done by the destructor
+ *
+ * Created: 2025-11-28
+ */
+
+#pragma once
+
+#include <vulkan/vulkan.h>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Owns a VkPipelineCache and persists it between runs
+ */
+class PipelineCache {
+public:
+    /**
+     * @brief Creates the cache, seeded from @p path if the file matches this device/driver
+     * @param device Vulkan logical device
+     * @param physicalDevice Physical device (identity used to validate the file)
+     * @param path Cache file location (parent directory is created on save)
+     * @throws std::runtime_error if the VkPipelineCache cannot be created
+     */
+    PipelineCache(VkDevice device, VkPhysicalDevice physicalDevice, const std::string& path);
+
+    /**
+     * @brief Saves the cache and destroys it
+     */
+    ~PipelineCache();
+
+    PipelineCache(const PipelineCache&) = delete;
+    PipelineCache& operator=(const PipelineCache&) = delete;
+
+    /**
+     * @brief Writes the current cache contents to disk (temp file + rename)
+     * @return False if the data could not be retrieved or written
+     */
+    bool save();
+
+    /// Handle to pass to vkCreateGraphicsPipelines / PipelineBuilder
+    VkPipelineCache get() const { return m_cache; }
+
+    /// True if a valid cache file was loaded (warm start)
+    bool wasLoaded() const { return m_loaded; }
+
+    /// Bytes of cache data loaded from disk (0 on a cold start)
+    size_t loadedSize() const { return m_loadedSize; }
+
+private:
+    /**
+     * @brief Reads and validates the cache file
+     * @return Driver cache blob, or empty if missing/stale/corrupt
+     */
+    std::vector<char> loadFile() const;
+
+    VkDevice m_device;
+    VkPipelineCache m_cache = VK_NULL_HANDLE;
+    std::string m_path;
+
+    // Identity of the device the cache was built for
+    uint32_t m_vendorID = 0;
+    uint32_t m_deviceID = 0;
+    uint32_t m_driverVersion = 0;
+    uint8_t m_uuid[VK_UUID_SIZE] = {};
+
+    bool m_loaded = false;
+    size_t m_loadedSize = 0;
+};
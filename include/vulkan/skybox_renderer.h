@@ -67,9 +67,10 @@ public:
      * @param renderPass Render pass for pipeline creation
      * @param pipelineLayout Pipeline layout to use (must have cubemap bindings at 2 and 3)
      * @param extent Swapchain extent for viewport
+     * @param pipelineCache Optional pipeline cache used for this and later pipeline builds
      */
     void initialize(VkRenderPass renderPass, VkPipelineLayout pipelineLayout,
-                   VkExtent2D extent);
+                   VkExtent2D extent, VkPipelineCache pipelineCache = VK_NULL_HANDLE);
 
     /**
      * @brief Clean up all Vulkan resources
@@ -276,6 +277,7 @@ private:
     // ========== Pipeline ==========
     VkPipeline m_pipeline = VK_NULL_HANDLE;
     VkPipelineLayout m_pipelineLayout = VK_NULL_HANDLE;  // Borrowed from VulkanRenderer
+    VkPipelineCache m_pipelineCache = VK_NULL_HANDLE;    // Borrowed from VulkanRenderer
 
     // ========== Vertex Buffer ==========
     VkBuffer m_vertexBuffer = VK_NULL_HANDLE;
@@ -17,6 +17,7 @@
 
 #include <vulkan/vulkan.h>
 #include <string>
+#include <vector>
 #include <cstdint>
 
 /**
@@ -75,6 +76,24 @@ public:
                      VkMemoryPropertyFlags properties,
                      VkImage& image, VkDeviceMemory& imageMemory);
 
+    /**
+     * @brief Create a 2D image with mip levels and/or array layers
+     * @param width Level 0 width in pixels
+     * @param height Level 0 height in pixels
+     * @param mipLevels Number of mip levels
+     * @param arrayLayers Number of array layers
+     * @param format Pixel format
+     * @param tiling Image tiling mode
+     * @param usage Usage flags
+     * @param properties Memory property flags
+     * @param image Output image handle
+     * @param imageMemory Output device memory handle
+     */
+    void createImage(uint32_t width, uint32_t height, uint32_t mipLevels, uint32_t arrayLayers,
+                     VkFormat format, VkImageTiling tiling, VkImageUsageFlags usage,
+                     VkMemoryPropertyFlags properties,
+                     VkImage& image, VkDeviceMemory& imageMemory);
+
     /**
      * @brief Create an image view for shader access
      * @param image Source image
@@ -85,6 +104,17 @@ public:
     VkImageView createImageView(VkImage image, VkFormat format,
                                 VkImageAspectFlags aspectFlags);
 
+    /**
+     * @brief Create a VK_IMAGE_VIEW_TYPE_2D_ARRAY color view (sampler2DArray)
+     * @param image Source image
+     * @param format Image format
+     * @param mipLevels Mip levels to expose
+     * @param layerCount Array layers to expose
+     * @return Created image view handle
+     */
+    VkImageView createArrayImageView(VkImage image, VkFormat format,
+                                     uint32_t mipLevels, uint32_t layerCount);
+
     // ========== Texture Loading ==========
 
     /**
@@ -137,6 +167,16 @@ public:
      */
     VkSampler createLinearSampler(float maxAnisotropy = 4.0f);
 
+    /**
+     * @brief Create a repeating nearest-neighbor sampler that uses all mip levels
+     *
+     * Texels stay pixelated up close; distant surfaces blend between mip levels.
+     *
+     * @param mipLevels Mip levels of the sampled image
+     * @return Created sampler handle
+     */
+    VkSampler createMipmappedSampler(uint32_t mipLevels);
+
     // ========== Layout Transitions ==========
 
     /**
@@ -145,13 +185,16 @@ public:
      * @param format Image format (for determining aspect mask)
      * @param oldLayout Current layout
      * @param newLayout Target layout
+     * @param mipLevels Mip levels to transition (all levels from 0)
+     * @param layerCount Array layers to transition (all layers from 0)
      *
      * Supported transitions:
      * - UNDEFINED -> TRANSFER_DST_OPTIMAL (for texture upload)
      * - TRANSFER_DST_OPTIMAL -> SHADER_READ_ONLY_OPTIMAL (for shader sampling)
      */
     void transitionImageLayout(VkImage image, VkFormat format,
-                               VkImageLayout oldLayout, VkImageLayout newLayout);
+                               VkImageLayout oldLayout, VkImageLayout newLayout,
+                               uint32_t mipLevels = 1, uint32_t layerCount = 1);
 
     /**
      * @brief Copy buffer data to image
@@ -163,6 +206,15 @@ public:
     void copyBufferToImage(VkBuffer buffer, VkImage image,
                            uint32_t width, uint32_t height);
 
+    /**
+     * @brief Copy buffer data to several image subresources in one submit
+     * @param buffer Source buffer with pixel data
+     * @param image Destination image (must be in TRANSFER_DST_OPTIMAL layout)
+     * @param regions One region per mip level / array layer
+     */
+    void copyBufferToImage(VkBuffer buffer, VkImage image,
+                           const std::vector<VkBufferImageCopy>& regions);
+
     // ========== Resource Destruction ==========
 
     /**
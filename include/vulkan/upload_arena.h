@@ -0,0 +1,125 @@
+/**
+ * @file upload_arena.h
+ * @brief Persistently mapped ring buffer for zero-copy mesh uploads
+ *
+ * Mesh workers reserve a slice, write vertices/indices straight into mapped
+ * memory, and hand the slice to the main thread, which only records a
+ * vkCmdCopyBuffer region from the arena buffer. Slices are released once the
+ * GPU copy that reads them has completed (fence-tracked by VulkanRenderer).
+ *
+ * Allocation is a ring: new slices go at the head, space is reclaimed from the
+ * tail. Slices may be released out of order (a chunk unloaded before upload);
+ * the tail only advances past released slices, so an old slice delays reuse
+ * but never corrupts live data. allocate() never blocks - when the ring is
+ * full callers fall back to the staging-buffer path.
+ *
+ * Usage:
+ *   UploadArena::Allocation slice;
+ *   if (arena.allocate(bytes, slice)) {
+ *       memcpy(slice.ptr, data, bytes);                       // any thread
+ *       renderer->batchCopyBuffer(arena.getBuffer(), dst, bytes, slice.offset);
+ *       renderer->releaseUploadArenaAfterBatch(slice.id);     // freed on fence
+ *   }
+ *
+ * Created: 2025-11-28
+ */
+
+#pragma once
+
+#include <vulkan/vulkan.h>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+
+/**
+ * @brief Thread-safe ring allocator over one host-visible, coherent transfer buffer
+ */
+class UploadArena {
+public:
+    static constexpr VkDeviceSize ALIGNMENT = 16;
+
+    /**
+     * @brief A reserved slice of the arena
+     */
+    struct Allocation {
+        uint64_t id = 0;          ///< 0 = no allocation
+        VkDeviceSize offset = 0;  ///< Byte offset of the slice in getBuffer()
+        VkDeviceSize size = 0;    ///< Slice size (rounded up to ALIGNMENT)
+        uint8_t* ptr = nullptr;   ///< Mapped pointer to the slice
+
+        bool valid() const { return id != 0; }
+    };
+
+    UploadArena() = default;
+    ~UploadArena() = default;
+
+    UploadArena(const UploadArena&) = delete;
+    UploadArena& operator=(const UploadArena&) = delete;
+
+    /**
+     * @brief Creates and maps the arena buffer
+     * @param device Vulkan device
+     * @param physicalDevice Physical device for memory type lookup
+     * @param capacity Arena size in bytes
+     */
+    void initialize(VkDevice device, VkPhysicalDevice physicalDevice, VkDeviceSize capacity);
+
+    /**
+     * @brief Uses caller-owned host memory instead of a Vulkan buffer (headless tools, tests)
+     * @param memory At least @p capacity bytes, outliving the arena's use
+     * @param capacity Arena size in bytes
+     *
+     * getBuffer() stays VK_NULL_HANDLE, so slices can't be copied to the GPU.
+     */
+    void initializeHost(uint8_t* memory, VkDeviceSize capacity);
+
+    /**
+     * @brief Unmaps and destroys the buffer (all slices become invalid)
+     * @param device Vulkan device
+     */
+    void cleanup(VkDevice device);
+
+    /**
+     * @brief Reserves a slice (thread-safe, never blocks)
+     * @param size Bytes needed
+     * @param out Receives the slice on success
+     * @return False if the arena is full or not initialized
+     */
+    bool allocate(VkDeviceSize size, Allocation& out);
+
+    /**
+     * @brief Returns a slice to the arena (thread-safe; unknown ids are ignored)
+     * @param id Allocation::id
+     */
+    void release(uint64_t id);
+
+    VkBuffer getBuffer() const { return m_buffer; }
+    VkDeviceSize getCapacity() const { return m_capacity; }
+
+    /**
+     * @brief Bytes held by live slices (including ones awaiting GPU completion)
+     */
+    VkDeviceSize getUsedBytes() const;
+
+    /// Rounds @p size up to ALIGNMENT
+    static VkDeviceSize alignUp(VkDeviceSize size) { return (size + ALIGNMENT - 1) & ~(ALIGNMENT - 1); }
+
+private:
+    struct Record {
+        uint64_t id;
+        VkDeviceSize offset;
+        VkDeviceSize size;
+        bool released;
+    };
+
+    VkBuffer m_buffer = VK_NULL_HANDLE;
+    VkDeviceMemory m_memory = VK_NULL_HANDLE;
+    uint8_t* m_mapped = nullptr;
+    VkDeviceSize m_capacity = 0;
+
+    std::deque<Record> m_records;  ///< Live slices in allocation order (front = tail)
+    VkDeviceSize m_head = 0;       ///< End of the newest slice
+    VkDeviceSize m_usedBytes = 0;
+    uint64_t m_nextId = 1;
+    mutable std::mutex m_mutex;
+};
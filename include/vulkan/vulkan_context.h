@@ -102,6 +102,12 @@ public:
     uint32_t getGraphicsQueueFamily() const { return m_graphicsQueueFamily; }
     uint32_t getTransferQueueFamily() const { return m_transferQueueFamily; }
 
+    /**
+     * @brief Get the device features enabled at device creation
+     * @return Features (only optional ones the GPU supports are set)
+     */
+    const VkPhysicalDeviceFeatures& getEnabledFeatures() const { return m_enabledFeatures; }
+
     /**
      * @brief Check if validation layers are enabled
      * @return True in debug builds, false in release
@@ -163,6 +169,9 @@ private:
     uint32_t m_graphicsQueueFamily = 0;
     uint32_t m_transferQueueFamily = 0;
 
+    // Features enabled on m_device
+    VkPhysicalDeviceFeatures m_enabledFeatures{};
+
     // ========== Configuration ==========
 
     const std::vector<const char*> m_validationLayers = {
@@ -23,6 +23,8 @@
 
 // Manager includes (for types they define)
 #include "vulkan/vulkan_context.h"  // For QueueFamilyIndices
+#include "vulkan/upload_arena.h"
+#include "chunk_upload_target.h"
 
 // Forward declarations
 class BufferManager;
@@ -30,6 +32,7 @@ class DescriptorManager;
 class SwapchainManager;
 class TextureManager;
 class SkyboxRenderer;
+class PipelineCache;
 
 // Forward declare Vertex (defined in chunk.h)
 struct Vertex;
@@ -47,9 +50,20 @@ struct UniformBufferObject {
     alignas(16) glm::vec4 cameraPos;     ///< Camera position (.xyz) + render distance (.w)
     alignas(16) glm::vec4 skyTimeData;   ///< Time data (.x=time 0-1, .y=sun, .z=moon, .w=underwater 0/1)
     alignas(16) glm::vec4 liquidFogColor;///< Liquid fog color (.rgb) + density (.a)
-    alignas(16) glm::vec4 liquidFogDist; ///< Fog distances (.x=start, .y=end) + unused (.zw)
+    alignas(16) glm::vec4 liquidFogDist; ///< Fog distances (.x=start, .y=end) + horizon inner radius (.z) and fade distance (.w)
     alignas(16) glm::vec4 liquidTint;    ///< Liquid tint color (.rgb) + darken factor (.a)
-    alignas(16) glm::vec4 atlasInfo;     ///< Texture atlas info (.x=width in cells, .y=height, .z=cell size, .w=unused)
+    alignas(16) glm::vec4 atlasInfo;     ///< Texture atlas info (.x=width in cells, .y=height, .z=cell size, .w=far LOD distance)
+};
+
+/**
+ * @brief Per-draw push constants for the world pipelines (vertex stage)
+ *
+ * lightBlend drives the GPU light transition: the vertex shader mixes each
+ * vertex's previous block light toward its current one (see CompressedVertex).
+ * 1.0 = current light; only chunks with a running transition push less.
+ */
+struct ChunkPushConstants {
+    float lightBlend = 1.0f;
 };
 
 // QueueFamilyIndices is now defined in vulkan/vulkan_context.h
@@ -171,7 +185,7 @@ private:
  *
  * @note This class is not copyable. There should be only one renderer instance.
  */
-class VulkanRenderer {
+class VulkanRenderer : public ChunkUploadTarget {
 public:
     /**
      * @brief Constructs the Vulkan renderer and initializes all resources
@@ -245,6 +259,30 @@ public:
                             const glm::vec3& liquidFogColor = glm::vec3(0.1f, 0.3f, 0.5f), float liquidFogStart = 1.0f, float liquidFogEnd = 8.0f,
                             const glm::vec3& liquidTintColor = glm::vec3(0.4f, 0.7f, 1.0f), float liquidDarkenFactor = 0.4f);
 
+    /**
+     * @brief Sets the fade distance used by far-LOD terrain (CompressedVertex::FLAG_FAR_LOD)
+     *
+     * Far LOD chunks are drawn beyond the normal render distance; the fragment
+     * shader fogs and discards them against this distance instead.
+     *
+     * @param distance LOD fade distance in blocks (0 = disabled, use render distance)
+     */
+    void setFarLodDistance(float distance) { m_farLodDistance = distance; }
+
+    /**
+     * @brief Sets the horizon heightfield distances (CompressedVertex::FLAG_HORIZON)
+     *
+     * Horizon fragments closer than innerRadius are discarded (full chunks are
+     * always resident there); the rest fog out at outerDistance.
+     *
+     * @param innerRadius Horizontal radius in blocks where the horizon is hidden
+     * @param outerDistance Horizon fade distance in blocks (0 = disabled)
+     */
+    void setHorizonDistances(float innerRadius, float outerDistance) {
+        m_horizonInnerRadius = innerRadius;
+        m_horizonDistance = outerDistance;
+    }
+
     // ========== Sky System ==========
 
     /**
@@ -277,6 +315,17 @@ public:
      */
     void bindAtlasTexture(VkImageView atlasView, VkSampler atlasSampler);
 
+    /**
+     * @brief Binds the block texture array to descriptor sets (binding 4)
+     *
+     * World geometry samples this sampler2DArray with the layer stored in each
+     * vertex. Until it is bound, a 1-layer white array is used.
+     *
+     * @param arrayView 2D array image view (BlockRegistry::getTextureArrayView)
+     * @param arraySampler Repeating mipmapped sampler
+     */
+    void bindBlockTextureArray(VkImageView arrayView, VkSampler arraySampler);
+
     // ========== Vulkan Object Getters ==========
     // Provide access to Vulkan objects for chunk/world rendering
 
@@ -300,7 +349,7 @@ public:
      * Must be called after binding the mesh pipeline
      * @param cmd Command buffer
      * @param textureDescriptorSet Optional texture descriptor set (set 1)
-     * @param boneDescriptorSet Optional bone descriptor set (set 2) for skeletal animation
+     * @param boneDescriptorSet Optional bone + instance table descriptor set (set 2)
      */
     void bindMeshDescriptorSets(VkCommandBuffer cmd, VkDescriptorSet textureDescriptorSet = VK_NULL_HANDLE,
                                VkDescriptorSet boneDescriptorSet = VK_NULL_HANDLE);
@@ -315,16 +364,6 @@ public:
      */
     VkDescriptorSetLayout getMeshBoneDescriptorSetLayout() const { return m_meshBoneDescriptorSetLayout; }
 
-    /**
-     * @brief Push material constants for mesh rendering
-     * @param cmd Command buffer
-     * @param albedoTexIndex Albedo texture index (-1 for no texture)
-     * @param normalTexIndex Normal texture index (-1 for no texture)
-     * @param metallic Material metallic value
-     * @param roughness Material roughness value
-     */
-    void pushMeshMaterialConstants(VkCommandBuffer cmd, int32_t albedoTexIndex, int32_t normalTexIndex,
-                                    float metallic, float roughness);
     VkCommandBuffer getCurrentCommandBuffer() const { return m_commandBuffers[m_currentFrame]; }  ///< Get current cmd buffer
     VkDescriptorSetLayout getDescriptorSetLayout() const { return m_descriptorSetLayout; }  ///< Get descriptor layout
     VkDescriptorSet getCurrentDescriptorSet() const { return m_descriptorSets[m_currentFrame]; }  ///< Get current descriptor
@@ -342,6 +381,13 @@ public:
      */
     VkDescriptorSet createCustomTextureDescriptorSet(VkImageView imageView, VkSampler sampler);
     uint32_t getCurrentFrame() const { return m_currentFrame; }                 ///< Get current frame index
+    uint32_t getFramesInFlight() const { return MAX_FRAMES_IN_FLIGHT; }         ///< Frames the CPU may record ahead
+
+    /// vkCmdDrawIndexedIndirect with drawCount > 1 (multiDrawIndirect feature)
+    bool supportsMultiDrawIndirect() const;
+
+    /// Non-zero firstInstance in indirect commands (drawIndirectFirstInstance feature)
+    bool supportsIndirectFirstInstance() const;
     VkExtent2D getSwapChainExtent() const { return m_swapChainExtent; }        ///< Get swapchain extent
 
     // ========== Window Events ==========
@@ -404,8 +450,24 @@ public:
      * @param srcBuffer Source buffer
      * @param dstBuffer Destination buffer
      * @param size Number of bytes to copy
+     * @param srcOffset Byte offset in srcBuffer (e.g. an upload arena slice)
      */
-    void batchCopyBuffer(VkBuffer srcBuffer, VkBuffer dstBuffer, VkDeviceSize size);
+    void batchCopyBuffer(VkBuffer srcBuffer, VkBuffer dstBuffer, VkDeviceSize size, VkDeviceSize srcOffset = 0);
+
+    /**
+     * @brief Releases an upload arena slice once the current batch has finished on the GPU
+     *
+     * Call after recording copies that read the slice. Sync batches release it right
+     * after the wait; async batches release it when their fence signals.
+     *
+     * @param allocationId UploadArena::Allocation::id
+     */
+    void releaseUploadArenaAfterBatch(uint64_t allocationId);
+
+    /**
+     * @brief Persistently mapped arena that mesh workers write upload data into
+     */
+    UploadArena& getUploadArena() { return m_uploadArena; }
 
     /**
      * @brief Submits all batched buffer copies and waits for completion
@@ -453,7 +515,7 @@ public:
      *   }
      *   renderer->submitBatchedChunkUploads();
      */
-    void beginBatchedChunkUploads();
+    void beginBatchedChunkUploads() override;
 
     /**
      * @brief Add a single chunk to the current batch
@@ -463,7 +525,7 @@ public:
      *
      * @param chunk Chunk to upload
      */
-    void addChunkToBatch(class Chunk* chunk);
+    void addChunkToBatch(class Chunk* chunk) override;
 
     /**
      * @brief Submit all batched chunk uploads at once
@@ -471,7 +533,7 @@ public:
      * Submits a single vkQueueSubmit containing all chunks added via addChunkToBatch().
      * Staging buffers will be cleaned up asynchronously when GPU completes.
      */
-    void submitBatchedChunkUploads();
+    void submitBatchedChunkUploads() override;
 
     // ========== GPU Backlog Monitoring (2025-11-25) ==========
 
@@ -501,7 +563,7 @@ public:
      *
      * @return Recommended upload count (0-4)
      */
-    size_t getRecommendedUploadCount() const;
+    size_t getRecommendedUploadCount() const override;
 
     // ========== Indirect Drawing API (GPU Optimization) ==========
 
@@ -520,33 +582,25 @@ public:
      * Thread-safe for concurrent chunk loading.
      *
      * @param vertexSize Size of vertex data in bytes
-     * @param indexSize Size of index data in bytes
      * @param transparent Whether this is for transparent geometry
      * @param outVertexOffset Output: offset in vertex mega-buffer
-     * @param outIndexOffset Output: offset in index mega-buffer
      * @return True if allocation succeeded, false if mega-buffer is full
      */
-    bool allocateMegaBufferSpace(VkDeviceSize vertexSize, VkDeviceSize indexSize,
-                                  bool transparent,
-                                  VkDeviceSize& outVertexOffset, VkDeviceSize& outIndexOffset);
+    bool allocateMegaBufferSpace(VkDeviceSize vertexSize, bool transparent, VkDeviceSize& outVertexOffset);
 
     /**
      * @brief Upload chunk geometry to mega-buffer
      *
-     * Copies vertex and index data to the specified offsets in mega-buffers.
+     * Copies vertex data to the specified offset in the vertex mega-buffer.
+     * Chunk meshes carry no index data (see getQuadIndexBuffer()).
      *
      * @param vertexData Pointer to vertex data
      * @param vertexSize Size of vertex data in bytes
-     * @param indexData Pointer to index data
-     * @param indexSize Size of index data in bytes
      * @param vertexOffset Target offset in vertex mega-buffer
-     * @param indexOffset Target offset in index mega-buffer
      * @param transparent Whether this is transparent geometry
      */
     void uploadToMegaBuffer(const void* vertexData, VkDeviceSize vertexSize,
-                           const void* indexData, VkDeviceSize indexSize,
-                           VkDeviceSize vertexOffset, VkDeviceSize indexOffset,
-                           bool transparent);
+                           VkDeviceSize vertexOffset, bool transparent);
 
     /**
      * @brief Batched upload to mega-buffer (integrates with batch copy system)
@@ -555,17 +609,14 @@ public:
      * Use with beginBufferCopyBatch() / submitBufferCopyBatch().
      *
      * @param srcVertexBuffer Source vertex staging buffer
-     * @param srcIndexBuffer Source index staging buffer
      * @param vertexSize Size of vertex data
-     * @param indexSize Size of index data
      * @param vertexOffset Target offset in mega vertex buffer
-     * @param indexOffset Target offset in mega index buffer
      * @param transparent Whether this is transparent geometry
+     * @param srcVertexOffset Byte offset in srcVertexBuffer
      */
-    void batchCopyToMegaBuffer(VkBuffer srcVertexBuffer, VkBuffer srcIndexBuffer,
-                               VkDeviceSize vertexSize, VkDeviceSize indexSize,
-                               VkDeviceSize vertexOffset, VkDeviceSize indexOffset,
-                               bool transparent);
+    void batchCopyToMegaBuffer(VkBuffer srcVertexBuffer, VkDeviceSize vertexSize,
+                               VkDeviceSize vertexOffset, bool transparent,
+                               VkDeviceSize srcVertexOffset = 0);
 
     /**
      * @brief Bind pipeline with state caching (avoids redundant binds)
@@ -582,6 +633,17 @@ public:
      */
     void resetPipelineCache();
 
+    /**
+     * @brief Sets the light transition blend for subsequent world draws
+     *
+     * Push constants persist across binds of pipelines sharing m_pipelineLayout,
+     * so the value holds until the next call. beginFrame() pushes 1.0.
+     *
+     * @param commandBuffer Command buffer
+     * @param lightBlend Blend factor (0.0 = previous light, 1.0 = current light)
+     */
+    void pushChunkLightBlend(VkCommandBuffer commandBuffer, float lightBlend);
+
     // ========== Mesh Rendering API ==========
 
     /**
@@ -653,9 +715,15 @@ public:
 
     // ========== Mega-Buffer Getters (for Indirect Drawing) ==========
     VkBuffer getMegaVertexBuffer() const { return m_megaVertexBuffer; }
-    VkBuffer getMegaIndexBuffer() const { return m_megaIndexBuffer; }
     VkBuffer getMegaTransparentVertexBuffer() const { return m_megaTransparentVertexBuffer; }
-    VkBuffer getMegaTransparentIndexBuffer() const { return m_megaTransparentIndexBuffer; }
+
+    /**
+     * @brief Shared static index buffer for all chunk quads (VK_INDEX_TYPE_UINT16)
+     *
+     * Holds {0,1,2,0,2,3} + 4q for QuadIndex::MAX_QUADS_PER_DRAW quads. Chunk draws use
+     * firstIndex 0 and their base vertex as vertexOffset (see quad_index.h).
+     */
+    VkBuffer getQuadIndexBuffer() const { return m_quadIndexBuffer; }
     VkBuffer getIndirectDrawBuffer() const { return m_indirectDrawBuffer; }
     VkDeviceMemory getIndirectDrawBufferMemory() const { return m_indirectDrawBufferMemory; }
     VkBuffer getIndirectDrawTransparentBuffer() const { return m_indirectDrawTransparentBuffer; }
@@ -742,6 +810,17 @@ public:
     void createImage(uint32_t width, uint32_t height, VkFormat format, VkImageTiling tiling,
                      VkImageUsageFlags usage, VkMemoryPropertyFlags properties, VkImage& image, VkDeviceMemory& imageMemory);
 
+    /**
+     * @brief Creates a 2D image with mip levels and/or array layers
+     *
+     * @param mipLevels Number of mip levels
+     * @param arrayLayers Number of array layers
+     * (other parameters as above)
+     */
+    void createImage(uint32_t width, uint32_t height, uint32_t mipLevels, uint32_t arrayLayers,
+                     VkFormat format, VkImageTiling tiling, VkImageUsageFlags usage,
+                     VkMemoryPropertyFlags properties, VkImage& image, VkDeviceMemory& imageMemory);
+
     /**
      * @brief Creates an image view for an image
      *
@@ -752,6 +831,17 @@ public:
      */
     VkImageView createImageView(VkImage image, VkFormat format, VkImageAspectFlags aspectFlags);
 
+    /**
+     * @brief Creates a VK_IMAGE_VIEW_TYPE_2D_ARRAY color view
+     *
+     * @param image Source image
+     * @param format Image format
+     * @param mipLevels Mip levels to expose
+     * @param layerCount Array layers to expose
+     * @return Image view handle
+     */
+    VkImageView createArrayImageView(VkImage image, VkFormat format, uint32_t mipLevels, uint32_t layerCount);
+
     /**
      * @brief Transitions an image to a new layout
      *
@@ -759,8 +849,11 @@ public:
      * @param format Image format
      * @param oldLayout Current layout
      * @param newLayout Desired layout
+     * @param mipLevels Mip levels to transition
+     * @param layerCount Array layers to transition
      */
-    void transitionImageLayout(VkImage image, VkFormat format, VkImageLayout oldLayout, VkImageLayout newLayout);
+    void transitionImageLayout(VkImage image, VkFormat format, VkImageLayout oldLayout, VkImageLayout newLayout,
+                               uint32_t mipLevels = 1, uint32_t layerCount = 1);
 
     /**
      * @brief Copies buffer data to an image
@@ -772,6 +865,15 @@ public:
      */
     void copyBufferToImage(VkBuffer buffer, VkImage image, uint32_t width, uint32_t height);
 
+    /**
+     * @brief Copies buffer data to several image subresources (mip levels, layers)
+     *
+     * @param buffer Source buffer containing pixel data
+     * @param image Destination image
+     * @param regions One region per subresource
+     */
+    void copyBufferToImage(VkBuffer buffer, VkImage image, const std::vector<VkBufferImageCopy>& regions);
+
     /**
      * @brief Creates a texture sampler with default settings
      *
@@ -786,6 +888,14 @@ public:
      */
     VkSampler createLinearTextureSampler();
 
+    /**
+     * @brief Creates a repeating nearest-neighbor sampler over all mip levels
+     *
+     * @param mipLevels Mip levels of the sampled image
+     * @return Sampler handle
+     */
+    VkSampler createMipmappedSampler(uint32_t mipLevels);
+
     /**
      * @brief Creates a default 1x1 white texture
      *
@@ -882,6 +992,8 @@ private:
     void createImageViews();
     void createRenderPass();
     void createDescriptorSetLayout();
+    void createPipelineLayouts();
+    void createPipelines();
     void createGraphicsPipeline();
     void createTransparentPipeline();
     void createWireframePipeline();
@@ -986,13 +1098,16 @@ private:
 
     // Mesh rendering pipeline (separate from voxel pipeline)
     VkDescriptorSetLayout m_meshDescriptorSetLayout;      // Set 1: textures
-    VkDescriptorSetLayout m_meshBoneDescriptorSetLayout;  // Set 2: bone matrices
+    VkDescriptorSetLayout m_meshBoneDescriptorSetLayout;  // Set 2: bone palette + instance table
     VkPipelineLayout m_meshPipelineLayout;
     VkPipeline m_meshPipeline;
 
     // Sphere pipeline for loading screen (uses uncompressed Vertex format)
     VkPipeline m_spherePipeline;
 
+    // PERFORMANCE (2025-11-28): Disk-backed cache shared by all pipeline builds
+    std::unique_ptr<PipelineCache> m_pipelineCache;
+
     // Command buffers
     VkCommandPool m_commandPool;
     VkCommandPool m_transferCommandPool;  ///< PERF (2025-11-24): Separate command pool for transfer queue
@@ -1016,6 +1131,7 @@ private:
     VkImage m_defaultTextureImage;
     VkDeviceMemory m_defaultTextureMemory;
     VkImageView m_defaultTextureView;
+    VkImageView m_defaultTextureArrayView;  ///< Same 1x1 image as a 1-layer 2D array (binding 4 fallback)
     VkSampler m_defaultTextureSampler;
 
     // ========== SkyboxRenderer (2025-12-27) ==========
@@ -1041,6 +1157,9 @@ private:
 
     // Sky time for day/night cycle
     float m_skyTime = 0.30f;  // 0.30 = morning (after sunrise)
+    float m_farLodDistance = 0.0f;  // Far-LOD fade distance (UBO atlasInfo.w), 0 = disabled
+    float m_horizonInnerRadius = 0.0f;  // Horizon hole radius (UBO liquidFogDist.z)
+    float m_horizonDistance = 0.0f;     // Horizon fade distance (UBO liquidFogDist.w), 0 = disabled
 
     // Synchronization
     std::vector<VkSemaphore> m_imageAvailableSemaphores;
@@ -1060,12 +1179,14 @@ private:
 
     // Multi-chunk batch upload tracking
     std::vector<std::pair<VkBuffer, VkDeviceMemory>> m_batchStagingBuffers;  // Staging buffers for current batch
+    std::vector<uint64_t> m_batchArenaAllocations;  // Upload arena slices read by the current batch
 
     // Async upload tracking
     struct PendingUpload {
         VkFence fence;
         VkCommandBuffer commandBuffer;
         std::vector<std::pair<VkBuffer, VkDeviceMemory>> stagingBuffers;
+        std::vector<uint64_t> arenaAllocations;  // Upload arena slices to release on completion
     };
     std::deque<PendingUpload> m_pendingUploads;
     mutable std::mutex m_pendingUploadsMutex;  // mutable for const getters
@@ -1085,23 +1206,21 @@ private:
     // This reduces draw calls from 300+ per frame to just 2 (opaque + transparent)
 
     static constexpr VkDeviceSize MEGA_BUFFER_VERTEX_SIZE = 2ULL * 1024 * 1024 * 1024;  // 2 GB for vertices (terrain changes need more space)
-    static constexpr VkDeviceSize MEGA_BUFFER_INDEX_SIZE = 2ULL * 1024 * 1024 * 1024;   // 2 GB for indices (terrain changes need more space)
 
-    // Opaque geometry mega-buffers
+    // Opaque geometry mega-buffer
     VkBuffer m_megaVertexBuffer = VK_NULL_HANDLE;
     VkDeviceMemory m_megaVertexBufferMemory = VK_NULL_HANDLE;
-    VkBuffer m_megaIndexBuffer = VK_NULL_HANDLE;
-    VkDeviceMemory m_megaIndexBufferMemory = VK_NULL_HANDLE;
     VkDeviceSize m_megaVertexOffset = 0;  // Current write offset in vertex mega-buffer
-    VkDeviceSize m_megaIndexOffset = 0;   // Current write offset in index mega-buffer
 
-    // Transparent geometry mega-buffers
+    // Transparent geometry mega-buffer
     VkBuffer m_megaTransparentVertexBuffer = VK_NULL_HANDLE;
     VkDeviceMemory m_megaTransparentVertexBufferMemory = VK_NULL_HANDLE;
-    VkBuffer m_megaTransparentIndexBuffer = VK_NULL_HANDLE;
-    VkDeviceMemory m_megaTransparentIndexBufferMemory = VK_NULL_HANDLE;
     VkDeviceSize m_megaTransparentVertexOffset = 0;
-    VkDeviceSize m_megaTransparentIndexOffset = 0;
+
+    // QUAD INDEX ELIMINATION (2025-11-28): One static 16-bit quad index buffer replaces the
+    // two 2 GB index mega-buffers; chunks no longer store or upload indices
+    VkBuffer m_quadIndexBuffer = VK_NULL_HANDLE;
+    VkDeviceMemory m_quadIndexBufferMemory = VK_NULL_HANDLE;
 
     // Indirect command buffers (rebuilt each frame with visible chunks)
     VkBuffer m_indirectDrawBuffer = VK_NULL_HANDLE;
@@ -1120,6 +1239,11 @@ private:
     static constexpr VkDeviceSize STAGING_BUFFER_SIZE = 4 * 1024 * 1024;  // 4MB per staging buffer
     static constexpr size_t STAGING_BUFFER_COUNT = 16;  // Pre-allocate 16 buffers (64MB total)
 
+    // ========== Upload Arena (2025-11-28) ==========
+    // Mesh workers write chunk geometry straight into this ring; uploads only record copy regions
+    UploadArena m_uploadArena;
+    static constexpr VkDeviceSize UPLOAD_ARENA_SIZE = 96ULL * 1024 * 1024;  // ~300 typical chunk meshes in flight
+
     // ========== Buffer Manager (2025-12-27) ==========
     // Centralized buffer creation and memory management
     std::unique_ptr<BufferManager> m_bufferManager;
@@ -72,9 +72,8 @@ public:
     /**
      * @brief Trigger water flow from adjacent water when a block is broken
      * This handles natural water (oceans/lakes) by treating water at/below sea level as infinite sources
-     * @param lockHeld If true, caller already holds World's chunk mutex - use unsafe methods
      */
-    void triggerWaterFlow(int brokenX, int brokenY, int brokenZ, World* world, bool lockHeld = false);
+    void triggerWaterFlow(int brokenX, int brokenY, int brokenZ, World* world);
 
     /**
      * @brief Check if position has a source block
@@ -189,7 +188,7 @@ private:
     void queueRemove(const glm::ivec3& pos);
     void setWaterCell(const glm::ivec3& pos, uint8_t level, bool isSource, World* world);
     void removeWaterCell(const glm::ivec3& pos, World* world);
-    void syncToChunk(const glm::ivec3& pos, uint8_t level, World* world, bool lockHeld = false);
+    void syncToChunk(const glm::ivec3& pos, uint8_t level, World* world);
     void markChunkDirtyAt(const glm::ivec3& pos);
 
     bool isBlockSolid(int x, int y, int z, World* world) const;
@@ -10,7 +10,6 @@
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
-#include <shared_mutex>
 #include <functional>
 #include <cstdint>
 #include <future>
@@ -18,6 +17,9 @@
 #include <glm/glm.hpp>
 #include <vulkan/vulkan.h>
 #include "chunk.h"
+#include "chunk_coord.h"
+#include "chunk_cache.h"
+#include "chunk_map.h"
 #include "water_simulation.h"
 #include "particle_system.h"
 #include "biome_map.h"
@@ -29,39 +31,10 @@
 class VulkanRenderer;
 class BiomeMap;
 class LightingSystem;
+class BlockTickSystem;
+class StructureTemplate;
 enum class ChunkLOD : uint8_t;  // Defined in world_streaming.h
 
-/**
- * @brief Chunk coordinate key for spatial hash map
- *
- * Used as key in unordered_map for O(1) chunk lookup instead of O(n) linear search.
- */
-struct ChunkCoord {
-    int x, y, z;
-
-    bool operator==(const ChunkCoord& other) const {
-        return x == other.x && y == other.y && z == other.z;
-    }
-};
-
-/**
- * @brief Hash function for ChunkCoord to enable use in unordered_map
- */
-namespace std {
-    template<>
-    struct hash<ChunkCoord> {
-        size_t operator()(const ChunkCoord& coord) const {
-            // Cantor pairing function variation for 3D coordinates
-            // Mix coordinates to distribute hash values evenly
-            size_t h1 = hash<int>()(coord.x);
-            size_t h2 = hash<int>()(coord.y);
-            size_t h3 = hash<int>()(coord.z);
-            return h1 ^ (h2 << 1) ^ (h3 << 2);
-        }
-    };
-    // Note: hash<glm::ivec3> is already defined in water_simulation.h
-}
-
 /**
  * @brief Manages the voxel world including chunk generation, rendering, and block operations
  *
@@ -171,6 +144,15 @@ public:
      */
     void renderWorld(VkCommandBuffer commandBuffer, const glm::vec3& cameraPos, const glm::mat4& viewProj, float renderDistance = 50.0f, class VulkanRenderer* renderer = nullptr);
 
+    /**
+     * @brief Sets the culling distance for far-LOD chunks (Chunk::getLodLevel() > 0)
+     *
+     * LOD chunks are distance-culled against this instead of renderDistance.
+     *
+     * @param distance LOD render distance in world units (0 = LOD chunks use renderDistance)
+     */
+    void setFarLodDistance(float distance) { m_farLodDistance = distance; }
+
     // ========== Block Querying and Modification ==========
 
     /**
@@ -301,6 +283,29 @@ public:
      */
     void setBlockMetadataAt(float worldX, float worldY, float worldZ, uint8_t metadata);
 
+    /**
+     * @brief Places a compiled template (structures, trees)
+     *
+     * Visits only the loaded chunks overlapping the template's AABB and blits
+     * each one's clipped spans directly (see Chunk::blitTemplate). Blocks in
+     * unloaded chunks are dropped, as with setBlockAt(). Chunks written to are
+     * marked dirty; meshes are not regenerated.
+     *
+     * @param tmpl Compiled template
+     * @param origin World block position of the template's local (0,0,0)
+     * @param touchedChunks Optional output: chunks that received blocks
+     * @return Number of blocks written
+     */
+    int placeTemplate(const StructureTemplate& tmpl, const glm::ivec3& origin,
+                      std::vector<Chunk*>* touchedChunks = nullptr);
+
+    /**
+     * @brief Checks that a template would only overwrite air or replaceableID
+     *
+     * Unloaded chunks count as clear (getBlockAt() reads them as air).
+     */
+    bool isTemplateClear(const StructureTemplate& tmpl, const glm::ivec3& origin, int replaceableID);
+
     // ========== Higher-Level Block Operations ==========
 
     /**
@@ -415,6 +420,12 @@ public:
      */
     LightingSystem* getLightingSystem() { return m_lightingSystem.get(); }
 
+    /**
+     * @brief Gets the scheduled/random block tick system
+     * @return Pointer to block tick system
+     */
+    BlockTickSystem* getBlockTickSystem() { return m_blockTickSystem.get(); }
+
     /**
      * @brief Initializes basic sunlight for a newly generated chunk
      * @param chunk Chunk to initialize lighting for
@@ -437,6 +448,26 @@ public:
      */
     void decorateWorld();
 
+    /**
+     * @brief Places worldgen structures (villages, dungeons, ...) into a freshly generated chunk
+     *
+     * Writes only this chunk's part of every structure site that overlaps it, so it
+     * needs no neighbours and is safe to call from any generation worker. Call right
+     * after Chunk::generate(); chunks loaded from disk already contain their structures.
+     *
+     * @param chunk The chunk that was just generated
+     */
+    void placeGeneratedStructures(Chunk* chunk);
+
+    /**
+     * @brief Rebuilds worldgen structure placement from the StructureRegistry (main thread)
+     *
+     * Call after StructureRegistry::loadStructures() (e.g. `reload structures`).
+     * The new placement is published atomically; generation workers already
+     * placing a chunk finish with the previous snapshot.
+     */
+    void reloadStructurePlacement();
+
     /**
      * @brief Decorates a single chunk (for streaming chunks)
      *
@@ -458,6 +489,17 @@ public:
      */
     bool hasHorizontalNeighbors(Chunk* chunk);
 
+    /**
+     * @brief Adds a chunk to the pending decoration queue
+     *
+     * processPendingDecorations() decorates it once its neighbours are loaded and
+     * queues it for re-meshing. Used for fresh chunks whose neighbours are missing
+     * and for far LOD chunks that refine to full detail.
+     *
+     * @param chunk Chunk that still needs decoration (ignored otherwise)
+     */
+    void queueDecoration(Chunk* chunk);
+
     /**
      * @brief Attempts to decorate pending chunks that now have neighbors
      *
@@ -470,15 +512,6 @@ public:
      */
     void processPendingDecorations(VulkanRenderer* renderer, class WorldStreaming* streaming, int maxChunks = 5);
 
-    /**
-     * @brief Updates interpolated lighting for all loaded chunks
-     *
-     * Creates smooth, natural lighting transitions over time.
-     *
-     * @param deltaTime Time since last frame in seconds
-     */
-    void updateInterpolatedLighting(float deltaTime);
-
     /**
      * @brief Register water blocks in a single chunk with the simulation system
      * Called for both initial world generation and dynamically loaded chunks
@@ -527,19 +560,12 @@ public:
      */
     void markChunkDirty(int chunkX, int chunkY, int chunkZ);
 
-    /**
-     * @brief Marks a chunk as dirty (UNSAFE - caller must hold m_chunkMapMutex)
-     * @param chunkX Chunk X coordinate
-     * @param chunkY Chunk Y coordinate
-     * @param chunkZ Chunk Z coordinate
-     */
-    void markChunkDirtyUnsafe(int chunkX, int chunkY, int chunkZ);
-
     /**
      * @brief Retrieves chunk from RAM cache (if present)
      *
-     * Checks m_unloadedChunksCache for chunks that were unloaded but kept in RAM.
-     * Returns nullptr if not in cache. This is 10,000x faster than disk loading!
+     * Checks the hot (full chunk) and warm (encoded) tiers of m_chunkCache.
+     * Warm hits are decoded into a pooled chunk outside the chunk map lock.
+     * Returns nullptr if not cached in RAM - caller falls back to disk.
      *
      * @param chunkX Chunk X coordinate
      * @param chunkY Chunk Y coordinate
@@ -548,6 +574,17 @@ public:
      */
     std::unique_ptr<Chunk> getChunkFromCache(int chunkX, int chunkY, int chunkZ);
 
+    /**
+     * @brief Records the outcome of a disk load after a RAM cache miss (cold tier stats)
+     * @param found True if the chunk was loaded from disk, false if it must be generated
+     */
+    void recordChunkDiskLookup(bool found) { m_chunkCache.recordColdLookup(found); }
+
+    /**
+     * @brief Gets chunk cache occupancy and per-tier hit counters
+     */
+    ChunkCacheStats getChunkCacheStats() const { return m_chunkCache.getStats(); }
+
     /**
      * @brief Acquires a chunk from the pool (or creates new if pool empty)
      *
@@ -603,51 +640,13 @@ public:
 
     /**
      * @brief Gets all chunks for iteration
-     * @return Reference to vector of all chunks
-     */
-    std::vector<Chunk*>& getChunks() { return m_chunks; }
-    const std::vector<Chunk*>& getChunks() const { return m_chunks; }
-
-    /**
-     * @brief Internal block getter without locking (caller must hold lock)
      *
-     * THREAD SAFETY: This method does NOT acquire any locks. The caller MUST
-     * already hold m_chunkMapMutex before calling this method.
+     * Lock-free when no chunk was added or removed since the last call. The
+     * snapshot is immutable; hold on to it for as long as you iterate.
      *
-     * Use this when you already hold the lock to prevent deadlock.
-     * For normal use, call getBlockAt() instead.
-     *
-     * @param worldX World X coordinate
-     * @param worldY World Y coordinate
-     * @param worldZ World Z coordinate
-     * @return Block ID, or 0 if out of bounds
+     * @return Shared snapshot of all loaded chunks (unspecified order)
      */
-    int getBlockAtUnsafe(float worldX, float worldY, float worldZ);
-
-    /**
-     * @brief Internal chunk lookup by world position without locking (PUBLIC for WaterSimulation)
-     * @warning UNSAFE: Caller must hold m_chunkMapMutex!
-     * @param worldX World X coordinate
-     * @param worldY World Y coordinate
-     * @param worldZ World Z coordinate
-     * @return Pointer to chunk, or nullptr if not found
-     */
-    Chunk* getChunkAtWorldPosUnsafe(float worldX, float worldY, float worldZ);
-
-    /**
-     * @brief Internal block setter without locking (PUBLIC for WaterSimulation)
-     * @warning UNSAFE: Caller must hold m_chunkMapMutex!
-     * @param worldX World X coordinate
-     * @param worldY World Y coordinate
-     * @param worldZ World Z coordinate
-     * @param blockID Block ID to set
-     */
-    void setBlockAtUnsafe(float worldX, float worldY, float worldZ, int blockID);
-
-    /**
-     * @brief Internal metadata setter without locking (PUBLIC for WaterSimulation)
-     */
-    void setBlockMetadataAtUnsafe(float worldX, float worldY, float worldZ, uint8_t metadata);
+    ShardedChunkMap::Snapshot getChunks() const { return m_chunkMap.snapshot(); }
 
     // ============================================================================
     // PERFORMANCE MONITORING (2025-11-24): Queue size accessors
@@ -679,26 +678,19 @@ public:
 
 private:
     /**
-     * @brief Internal chunk lookup without locking (caller must hold lock)
+     * @brief Collects the loaded chunks whose meshes read a block (deduplicated)
      *
-     * Used internally by functions that already hold m_chunkMapMutex.
-     * UNSAFE: Caller must ensure proper locking!
+     * Cube meshes only read face neighbors: the block's chunk plus the chunks across
+     * its 6 faces. Smooth meshes read all 26 neighbors (edge and corner cells), so if
+     * any chunk touching the block's 3x3x3 neighborhood is smooth, all of them are
+     * returned (up to 8).
      *
-     * @param chunkX Chunk X coordinate
-     * @param chunkY Chunk Y coordinate
-     * @param chunkZ Chunk Z coordinate
-     * @return Pointer to chunk, or nullptr if not found
+     * @param worldX Edited block X in world coordinates
+     * @param worldY Edited block Y
+     * @param worldZ Edited block Z
+     * @param chunks Output, cleared first; the block's own chunk comes first
      */
-    Chunk* getChunkAtUnsafe(int chunkX, int chunkY, int chunkZ);
-
-    /**
-     * @brief Internal metadata getter without locking (caller must hold lock)
-     * @param worldX World X coordinate
-     * @param worldY World Y coordinate
-     * @param worldZ World Z coordinate
-     * @return Metadata value
-     */
-    uint8_t getBlockMetadataAtUnsafe(float worldX, float worldY, float worldZ);
+    void collectChunksReadingBlock(float worldX, float worldY, float worldZ, std::vector<Chunk*>& chunks);
 
     int m_width, m_height, m_depth;      ///< World dimensions in chunks
     int m_seed;                          ///< World generation seed
@@ -707,24 +699,23 @@ private:
     float m_ageBias = 0.0f;              ///< Age/roughness bias for terrain (-1 to +1)
     std::string m_worldName;             ///< World name (extracted from save path)
     std::string m_worldPath;             ///< World save path for chunk streaming persistence
-    std::unordered_map<ChunkCoord, std::unique_ptr<Chunk>> m_chunkMap;  ///< Fast O(1) chunk lookup by coordinates
-    std::vector<Chunk*> m_chunks;  ///< All chunks for iteration (does not own memory)
 
-    // CHUNK CACHING: RAM cache for unloaded chunks (prevents disk thrashing)
-    std::unordered_map<ChunkCoord, std::unique_ptr<Chunk>> m_unloadedChunksCache;  ///< Cached unloaded chunks (still in RAM)
-    std::unordered_set<ChunkCoord> m_dirtyChunks;  ///< Chunks modified since last save (need disk write)
+    // LOCK SHARDING (2025-11-28): Owns all loaded chunks. Lookups lock one of 64
+    // spatial shards; iteration goes through lock-free snapshots (see chunk_map.h)
+    ShardedChunkMap m_chunkMap;
+
+    // CHUNK CACHING: Tiered RAM cache for unloaded chunks (prevents disk thrashing)
+    // Guarded by m_chunkCacheMutex. Dirty state moves into the cache with the chunk.
+    ChunkCache m_chunkCache;  ///< Hot (full chunk) / warm (encoded) LRU tiers, budgets in MB
+    mutable std::mutex m_chunkCacheMutex;  ///< Protects m_chunkCache (no longer covered by a world-wide lock)
+    std::unordered_set<ChunkCoord> m_dirtyChunks;  ///< Loaded chunks modified since last save (need disk write)
     mutable std::mutex m_dirtyChunksMutex;  ///< THREAD SAFETY (2025-11-23): Protects m_dirtyChunks for parallel decoration
-    size_t m_maxCachedChunks = 2000;  ///< Maximum cached chunks before forced eviction (~900MB at 450KB/chunk)
 
     // CHUNK POOLING: Reuse chunk objects instead of new/delete (100x faster allocation)
     std::vector<std::unique_ptr<Chunk>> m_chunkPool;  ///< Pool of reusable chunk objects
     size_t m_maxPoolSize = 500;  ///< Maximum pooled chunks (32MB at 64KB/chunk)
     mutable std::mutex m_chunkPoolMutex;  ///< Protects m_chunkPool access from worker threads
 
-    // THREAD SAFETY: Protects m_chunkMap access for future chunk streaming
-    // Use std::shared_lock for readers (many simultaneous), std::unique_lock for writers (exclusive)
-    mutable std::shared_mutex m_chunkMapMutex;
-
     // WEEK 1 OPTIMIZATION: Mesh buffer pooling (40-60% faster mesh generation)
     // Reuses vector memory across chunk mesh regenerations to avoid allocations
     MeshBufferPool m_meshBufferPool;
@@ -736,10 +727,14 @@ private:
     // Biome and generation systems
     std::unique_ptr<BiomeMap> m_biomeMap;  ///< Biome map for world generation
     std::unique_ptr<class TreeGenerator> m_treeGenerator;  ///< Procedural tree generation
+    std::shared_ptr<const class StructurePlacement> m_structurePlacement;  ///< Per-region worldgen structure sites (atomic_load/atomic_store)
 
     // Lighting system
     std::unique_ptr<LightingSystem> m_lightingSystem;  ///< Voxel lighting system
 
+    // Block ticks (falling blocks, delayed TRIGGER_UPDATE, random ticks)
+    std::unique_ptr<BlockTickSystem> m_blockTickSystem;  ///< Per-chunk timing wheel scheduler
+
     // DECORATION FIX: Track chunks waiting for neighbors before decoration
     std::unordered_set<Chunk*> m_pendingDecorations;  ///< Chunks waiting for neighbors to be decorated
     std::unordered_map<Chunk*, std::chrono::steady_clock::time_point> m_pendingDecorationTimestamps;  ///< DEADLOCK FIX (2025-11-24): Track when chunks were added to pending queue
@@ -759,4 +754,7 @@ private:
 
     // RENDERING OPTIMIZATION: Cache transparent chunk sort position to avoid re-sorting every frame
     glm::vec3 m_lastSortPosition = glm::vec3(0.0f);  ///< Last camera position used for sorting transparent chunks
+
+    // HIERARCHICAL LOD (2025-11-27): Far LOD chunks cull against their own distance
+    float m_farLodDistance = 0.0f;  ///< Render distance for LOD chunks (0 = use renderDistance)
 };
@@ -3,7 +3,8 @@
  * @brief Asynchronous chunk loading/unloading system for infinite worlds
  *
  * ARCHITECTURE:
- * - Priority queue orders chunks by distance from player
+ * - Deadline scheduler orders chunks by the time left before they become visible
+ *   (position, velocity, view direction) minus measured generation+mesh latency
  * - Worker threads generate/load chunks in background
  * - Main thread handles mesh creation and buffer upload (Vulkan not thread-safe)
  * - Double-buffering pattern: generation happens async, mesh upload on main thread
@@ -39,10 +40,12 @@
 
 // Need full ChunkCoord definition for hash function in unordered_set
 #include "world.h"
+#include "indexed_heap.h"
 
 // Forward declarations
 class Chunk;
 class VulkanRenderer;
+class ChunkUploadTarget;
 class BiomeMap;
 
 /**
@@ -51,34 +54,27 @@ class BiomeMap;
  * Tiered loading reduces work for distant chunks:
  * - FULL: Close chunks get decoration + full mesh (visible)
  * - MESH_ONLY: Medium chunks skip decoration, get mesh (fog hides detail)
- * - TERRAIN_ONLY: Far chunks skip decoration AND mesh (beyond render distance)
+ * - TERRAIN_ONLY: Far chunks skip decoration; meshed at 2x/4x/8x LOD (chunk_lod.h) when
+ *   setFarLodDistance() is enabled, otherwise not meshed at all
  */
 enum class ChunkLOD : uint8_t {
     FULL = 0,           ///< Full detail: decoration + mesh (within ~48 blocks)
     MESH_ONLY = 1,      ///< Medium detail: mesh only, no decoration (48-80 blocks, fog hides trees)
-    TERRAIN_ONLY = 2    ///< Terrain only: no decoration, no mesh (>80 blocks, not rendered)
+    TERRAIN_ONLY = 2    ///< Terrain only: no decoration; downsampled LOD mesh when far LOD is enabled
 };
 
 /**
  * @brief Chunk loading request with priority and LOD tier
  *
- * Chunks closer to the player have higher priority (lower distance).
- * The priority queue orders by distance (smaller = higher priority).
+ * Priority is the request's slack in seconds (2025-11-28): estimated time until
+ * the chunk becomes visible minus the expected generation+mesh latency. Negative
+ * slack means the chunk will already be late; smaller = served first.
  */
 struct ChunkLoadRequest {
     int chunkX, chunkY, chunkZ;      ///< Chunk coordinates to load
-    float priority;                   ///< Priority (distance from player, lower = higher priority)
+    float priority;                   ///< Slack in seconds (lower = higher priority)
     ChunkLOD lod = ChunkLOD::FULL;   ///< LOD tier based on distance
-
-    /**
-     * @brief Comparison operator for priority queue
-     *
-     * Note: We use > because priority_queue is a max-heap by default,
-     * but we want min-heap behavior (smallest distance first)
-     */
-    bool operator<(const ChunkLoadRequest& other) const {
-        return priority > other.priority;  // Inverted: smaller distance = higher priority
-    }
+    int64_t queuedAtNs = -1;          ///< Chunk trace clock at enqueue (-1 when tracing is off)
 };
 
 /**
@@ -86,7 +82,7 @@ struct ChunkLoadRequest {
  *
  * The WorldStreaming class handles:
  * - Background chunk generation on worker threads
- * - Priority-based loading (closest chunks first)
+ * - Deadline-based loading (chunks about to become visible first)
  * - Automatic unloading of distant chunks
  * - Thread-safe coordination with main rendering thread
  *
@@ -156,6 +152,16 @@ public:
                              float loadDistance = 64.0f,
                              float unloadDistance = 96.0f);
 
+    /**
+     * @brief Sets the camera forward vector used for time-to-visible estimates
+     *
+     * Cheap; call every frame. A turn larger than REKEY_TURN_ANGLE re-keys the load
+     * queue on the next updatePlayerPosition() even without a boundary crossing.
+     *
+     * @param forward Camera forward direction (need not be normalized; zero = unknown)
+     */
+    void setViewDirection(const glm::vec3& forward);
+
     /**
      * @brief Processes chunks that finished generation
      *
@@ -180,6 +186,26 @@ public:
      */
     size_t getCompletedChunkCount() const;
 
+    /**
+     * @brief Gets the number of meshed chunks waiting for the upload stage
+     * @return Number of chunks in the ready-for-upload queue
+     */
+    size_t getUploadQueueSize() const;
+
+    /**
+     * @brief Gets the number of chunks integrated into the world since start()
+     */
+    size_t getTotalChunksLoaded() const { return m_totalChunksLoaded.load(); }
+
+    /**
+     * @brief Replaces the upload stage (defaults to the renderer)
+     *
+     * Headless tools pass a stub so the pipeline runs without a Vulkan device.
+     *
+     * @param target Upload target (must outlive streaming; nullptr skips uploads)
+     */
+    void setUploadTarget(ChunkUploadTarget* target) { m_uploadTarget = target; }
+
     /**
      * @brief Gets statistics about the streaming system
      * @return Tuple of (pending loads, completed chunks, active workers)
@@ -213,6 +239,24 @@ public:
      */
     size_t getMeshThrottleCount() const { return m_meshThrottleCount.load(); }
 
+    /**
+     * @brief Gets how many queued requests were cancelled because the player left them behind
+     */
+    size_t getCancelledLoadCount() const { return m_cancelledLoadCount.load(); }
+
+    /**
+     * @brief Gets how many times the load queue was re-keyed (boundary crossings and turns)
+     */
+    size_t getRekeyCount() const { return m_rekeyCount.load(); }
+
+    /**
+     * @brief Gets the measured per-chunk pipeline latency used for scheduling
+     * @return Moving average of generation + mesh time in milliseconds
+     */
+    float getEstimatedChunkLatencyMs() const {
+        return m_generateLatencyMs.load() + m_meshLatencyMs.load();
+    }
+
     /**
      * @brief Queue a chunk for async mesh generation (used by decoration system)
      *
@@ -272,6 +316,28 @@ public:
      */
     void queueBackgroundGeneration(int centerX, int centerZ, int radius);
 
+    // ============================================================================
+    // HIERARCHICAL LOD (2025-11-27)
+    // ============================================================================
+
+    /**
+     * @brief Enables far LOD terrain out to the given distance
+     *
+     * Chunks in the surface band (ChunkLod::LOD_MIN_CHUNK_Y..LOD_MAX_CHUNK_Y) between
+     * the load distance and this distance are streamed as TERRAIN_ONLY and meshed
+     * from 2x/4x/8x downsampled grids. Levels are re-evaluated on chunk boundary
+     * crossings, so chunks refine to full detail as the player approaches.
+     *
+     * @param distance Far LOD distance in blocks (0 = disabled, TERRAIN_ONLY chunks stay unmeshed)
+     */
+    void setFarLodDistance(float distance) { m_farLodDistance = distance; }
+
+    /**
+     * @brief Gets the far LOD distance
+     * @return Distance in blocks (0 = disabled)
+     */
+    float getFarLodDistance() const { return m_farLodDistance; }
+
 private:
     /**
      * @brief Worker thread main loop
@@ -316,17 +382,69 @@ private:
                         const glm::vec3& playerPos, float loadDistance) const;
 
     /**
-     * @brief Calculates chunk priority (distance from player)
+     * @brief Calculates squared distance from the player to a chunk center
      *
      * @param chunkX Chunk X coordinate
      * @param chunkY Chunk Y coordinate
      * @param chunkZ Chunk Z coordinate
      * @param playerPos Player position
-     * @return Distance from player to chunk center (lower = higher priority)
+     * @return Squared distance from player to chunk center
      */
     float calculateChunkPriority(int chunkX, int chunkY, int chunkZ,
                                  const glm::vec3& playerPos) const;
 
+    /**
+     * @brief Snapshot of the camera state the deadline scheduler keys against
+     */
+    struct ViewState {
+        glm::vec3 position{0.0f};
+        glm::vec3 velocity{0.0f};   ///< Blocks/sec (zero after teleports)
+        glm::vec3 forward{0.0f};    ///< Normalized, zero when unknown
+        float viewDistance = 64.0f; ///< Radius inside which a chunk counts as visible
+    };
+
+    /**
+     * @brief Estimates seconds until a chunk enters the view (0 = visible now)
+     *
+     * A chunk becomes visible once it is both inside the view radius and inside
+     * the view cone. The radial wait uses the closing speed along the direction to
+     * the chunk; the angular wait assumes a typical camera turn rate. Both happen
+     * concurrently, so the estimate is the larger of the two, capped at
+     * SCHEDULE_HORIZON_SECONDS.
+     */
+    float estimateTimeToVisible(const glm::vec3& chunkCenter, const ViewState& view) const;
+
+    /**
+     * @brief Deadline-scheduler key: time-to-visible minus expected latency
+     *
+     * Least-slack-first. A small distance term orders chunks with equal slack
+     * (e.g. everything already in view) nearest first.
+     */
+    float calculateChunkDeadline(int chunkX, int chunkY, int chunkZ, ChunkLOD lod,
+                                 const ViewState& view) const;
+
+    /**
+     * @brief Snapshots position, velocity and view direction under m_playerPosMutex
+     */
+    ViewState captureViewState() const;
+
+    /**
+     * @brief Re-keys every queued request and cancels those the player left behind
+     *
+     * Expects the caller to hold m_loadQueueMutex. O(n) heap rebuild. A request is
+     * cancelled when its chunk would be unloaded on arrival (surface-band chunks
+     * use the far LOD distance when far LOD is enabled).
+     *
+     * @param view Current camera state
+     * @param cancelDistance Unload distance for full-detail requests
+     */
+    void rekeyLoadQueueLocked(const ViewState& view, float cancelDistance);
+
+    /**
+     * @brief Folds one measured stage duration into a latency moving average
+     */
+    static void recordLatency(std::atomic<float>& average, float milliseconds);
+
     /**
      * @brief Converts chunk coordinates to world position (center of chunk)
      *
@@ -361,6 +479,7 @@ private:
     World* m_world;                       ///< World instance being managed
     BiomeMap* m_biomeMap;                 ///< Biome map for generation
     VulkanRenderer* m_renderer;           ///< Renderer for buffer creation
+    ChunkUploadTarget* m_uploadTarget;    ///< Final pipeline stage (renderer unless overridden)
 
     // === Threading ===
     std::vector<std::thread> m_workers;   ///< Background worker threads
@@ -368,8 +487,10 @@ private:
     std::atomic<int> m_activeWorkers;     ///< Number of active workers
 
     // === Load Queue (accessed by main thread + workers) ===
+    // DEADLINE SCHEDULING (2025-11-28): Indexed heap keyed by chunk, so requests can be
+    // re-keyed when the player turns and cancelled in O(log n) when left behind
     static constexpr size_t MAX_LOAD_QUEUE_SIZE = 2048;   ///< Maximum allowed size of m_loadQueue
-    std::priority_queue<ChunkLoadRequest> m_loadQueue;  ///< Priority queue of chunks to load
+    IndexedMinHeap<ChunkCoord, ChunkLoadRequest> m_loadQueue;  ///< Load requests ordered by slack
     mutable std::mutex m_loadQueueMutex;                ///< Protects m_loadQueue
     std::condition_variable m_loadQueueCV;              ///< Signals workers when work available
 
@@ -390,24 +511,16 @@ private:
     bool enqueueLoadRequestLocked(const ChunkLoadRequest& request);
 
     /**
-     * @brief Finds the lowest-priority request currently in the load queue.
-     *
-     * Expects the caller to hold m_loadQueueMutex.
-     *
-     * @return Optional containing the lowest-priority request, or std::nullopt if empty
-     */
-    std::optional<ChunkLoadRequest> findLowestPriorityRequestLocked() const;
-
-    /**
-     * @brief Removes the first matching request from the load queue.
+     * @brief Cancels a queued request (O(log n)).
      *
      * Expects the caller to hold m_loadQueueMutex. Also removes the matching entry
-     * from m_chunksInFlight when found.
+     * from m_chunksInFlight when found. Requests already picked up by a worker are
+     * not affected.
      *
-     * @param target The request to remove
-     * @return true if a request was removed
+     * @param coord Chunk to cancel
+     * @return true if a queued request was removed
      */
-    bool removeRequestFromLoadQueueLocked(const ChunkLoadRequest& target);
+    bool cancelLoadRequestLocked(const ChunkCoord& coord);
 
     // === Error Tracking and Retry ===
     struct FailedChunk {
@@ -456,6 +569,9 @@ private:
     glm::vec3 m_previousPlayerPos;          ///< Previous player position for velocity calculation
     std::chrono::high_resolution_clock::time_point m_lastVelocityUpdate;  ///< Last time velocity was calculated
     float m_playerVelocity;                 ///< Current player velocity (blocks/sec)
+    glm::vec3 m_playerVelocityVec{0.0f};    ///< Current player velocity vector (blocks/sec)
+    glm::vec3 m_viewForward{0.0f};          ///< Camera forward (normalized, zero = unknown)
+    glm::vec3 m_rekeyedForward{0.0f};       ///< Camera forward at the last load queue re-key
     mutable std::mutex m_playerPosMutex;    ///< Protects m_lastPlayerPos and velocity data
 
     // PERFORMANCE FIX (2025-11-24): Track last chunk to avoid 13,500 iterations/sec
@@ -480,4 +596,16 @@ private:
     bool m_predictiveEnabled = true;    ///< Enable/disable predictive generation
     float m_lookAheadDistance = 96.0f;  ///< How far ahead to pre-generate (blocks)
     glm::vec3 m_playerMovementDir{0.0f}; ///< Normalized movement direction
+
+    // === Hierarchical LOD (2025-11-27) ===
+    float m_farLodDistance = 0.0f;      ///< Far LOD terrain distance (0 = disabled)
+    float m_fullDetailDistance = 64.0f; ///< Last requested load distance (full-detail radius)
+
+    // === Deadline Scheduling (2025-11-28) ===
+    static constexpr float SCHEDULE_HORIZON_SECONDS = 30.0f;  ///< Time-to-visible cap ("not soon")
+    static constexpr float REKEY_TURN_ANGLE = 0.5f;           ///< Radians of camera turn that force a re-key
+    std::atomic<float> m_generateLatencyMs{5.0f};             ///< Moving average of worker generation time
+    std::atomic<float> m_meshLatencyMs{2.0f};                 ///< Moving average of light + mesh time
+    std::atomic<size_t> m_cancelledLoadCount{0};              ///< Requests cancelled as out of range
+    std::atomic<size_t> m_rekeyCount{0};                      ///< Load queue re-keys performed
 };
@@ -10,6 +10,8 @@ layout(location = 4) in vec3 fragBitangent;
 layout(location = 5) in vec4 fragTintColor;
 layout(location = 6) in float fragTimeOfDay;
 layout(location = 7) in vec4 fragVertexColor;  // Vertex color (for PS1-style models)
+layout(location = 8) flat in ivec2 fragTextures;          // Albedo, normal texture index (-1 = none)
+layout(location = 9) flat in vec2 fragMetallicRoughness;  // Metallic, roughness
 
 // ========== Outputs ==========
 
@@ -32,14 +34,6 @@ layout(set = 0, binding = 0) uniform CameraUBO {
 // Set 1: Mesh textures
 layout(set = 1, binding = 0) uniform sampler2D meshTextures[64];
 
-// Push constant for material data
-layout(push_constant) uniform MaterialPushConstant {
-    int albedoTexIndex;     // -1 = no texture, use base color
-    int normalTexIndex;     // -1 = no normal map
-    float metallic;
-    float roughness;
-} material;
-
 // ========== Constants ==========
 
 const float PI = 3.14159265359;
@@ -136,10 +130,14 @@ vec3 calculatePBRLighting(vec3 albedo, float metallic, float roughness, vec3 nor
 // ========== Main ==========
 
 void main() {
+    // Material comes from the instance table (was a per-mesh push constant)
+    int albedoTexIndex = fragTextures.x;
+    int normalTexIndex = fragTextures.y;
+
     // Sample albedo texture or use vertex color (for PS1-style models without textures)
     vec4 albedoSample;
-    if (material.albedoTexIndex >= 0 && material.albedoTexIndex < 64) {
-        albedoSample = texture(meshTextures[material.albedoTexIndex], fragTexCoord);
+    if (albedoTexIndex >= 0 && albedoTexIndex < 64) {
+        albedoSample = texture(meshTextures[albedoTexIndex], fragTexCoord);
     } else {
         // No texture - use vertex color (defaults to white if not set)
         albedoSample = fragVertexColor;
@@ -152,8 +150,8 @@ void main() {
     // Get normal from normal map or use vertex normal
     vec3 normal = normalize(fragNormal);
 
-    if (material.normalTexIndex >= 0 && material.normalTexIndex < 64) {
-        vec3 tangentNormal = texture(meshTextures[material.normalTexIndex], fragTexCoord).rgb;
+    if (normalTexIndex >= 0 && normalTexIndex < 64) {
+        vec3 tangentNormal = texture(meshTextures[normalTexIndex], fragTexCoord).rgb;
         tangentNormal = tangentNormal * 2.0 - 1.0;
 
         // Build TBN matrix
@@ -169,7 +167,7 @@ void main() {
     vec3 viewDir = normalize(camera.cameraPos.xyz - fragWorldPos);
 
     // PBR lighting calculation
-    vec3 color = calculatePBRLighting(albedo, material.metallic, material.roughness, normal, viewDir);
+    vec3 color = calculatePBRLighting(albedo, fragMetallicRoughness.x, fragMetallicRoughness.y, normal, viewDir);
 
     // Tone mapping (simple Reinhard)
     color = color / (color + vec3(1.0));
@@ -11,9 +11,8 @@ layout(location = 4) in vec4 inVertexColor;  // Vertex color (RGBA)
 layout(location = 5) in ivec4 inBoneIndices; // Bone indices (up to 4 bones)
 layout(location = 6) in vec4 inBoneWeights;  // Bone weights (should sum to 1.0)
 
-// Per-instance data (binding 1) - for instanced rendering
-layout(location = 7) in mat4 instanceTransform;  // Locations 7-10 (mat4 = 4x vec4)
-layout(location = 11) in vec4 instanceTintColor; // Location 11
+// Per-instance data (binding 1): slot in the instance table, one per drawn instance
+layout(location = 7) in uint inInstanceSlot;
 
 // ========== Uniforms ==========
 
@@ -28,14 +27,25 @@ layout(binding = 0) uniform CameraUBO {
     vec4 liquidTint;      // Not used for meshes
 } camera;
 
-// Bone matrices for skeletal animation (set 2, binding 0)
-const int MAX_BONES = 64;
-layout(set = 2, binding = 0) uniform BoneUBO {
-    mat4 boneMatrices[MAX_BONES];
-    int numBones;         // Number of active bones (0 = no skinning)
-    float _padding[3];    // Padding to 16-byte alignment
+// Bone palette for skeletal animation (set 2, binding 0), matches BonePaletteHeader in mesh.h
+// Every animated character owns a range; [0, sharedBoneCount) is the shared palette
+layout(std430, set = 2, binding = 0) readonly buffer BonePalette {
+    int sharedBoneCount;  // Bones in the shared palette (0 = no skinning)
+    mat4 matrices[];
 } bones;
 
+// Persistent instance table (set 2, binding 1), matches InstanceData in mesh.h
+struct InstanceRecord {
+    mat4 transform;
+    vec4 tintColor;
+    ivec2 textures;          // Albedo, normal texture index (-1 = none)
+    vec2 metallicRoughness;
+    ivec4 skin;              // Bone palette base, bone count (0 = shared palette)
+};
+layout(std430, set = 2, binding = 1) readonly buffer InstanceTable {
+    InstanceRecord records[];
+} instanceTable;
+
 // ========== Outputs ==========
 
 layout(location = 0) out vec3 fragWorldPos;
@@ -46,13 +56,19 @@ layout(location = 4) out vec3 fragBitangent;
 layout(location = 5) out vec4 fragTintColor;
 layout(location = 6) out float fragTimeOfDay;  // For dynamic lighting
 layout(location = 7) out vec4 fragVertexColor; // Vertex color for PS1-style models
+layout(location = 8) flat out ivec2 fragTextures;         // Material texture indices
+layout(location = 9) flat out vec2 fragMetallicRoughness; // Material factors
 
 // ========== Skinning Function ==========
 
-void applySkinning(inout vec3 position, inout vec3 normal, inout vec3 tangent) {
+void applySkinning(ivec4 skin, inout vec3 position, inout vec3 normal, inout vec3 tangent) {
+    // Instances without their own palette range use the shared palette
+    int boneBase = skin.y > 0 ? skin.x : 0;
+    int boneCount = skin.y > 0 ? skin.y : bones.sharedBoneCount;
+
     // Skip skinning if no bones are active or weights are zero
     float totalWeight = inBoneWeights.x + inBoneWeights.y + inBoneWeights.z + inBoneWeights.w;
-    if (bones.numBones == 0 || totalWeight < 0.001) {
+    if (boneCount == 0 || totalWeight < 0.001) {
         return;
     }
 
@@ -65,8 +81,8 @@ void applySkinning(inout vec3 position, inout vec3 normal, inout vec3 tangent) {
         float weight = inBoneWeights[i];
         if (weight > 0.0) {
             int boneIdx = inBoneIndices[i];
-            if (boneIdx >= 0 && boneIdx < bones.numBones) {
-                mat4 boneMatrix = bones.boneMatrices[boneIdx];
+            if (boneIdx >= 0 && boneIdx < boneCount) {
+                mat4 boneMatrix = bones.matrices[boneBase + boneIdx];
                 mat3 boneRotation = mat3(boneMatrix);
 
                 skinnedPos += weight * (boneMatrix * vec4(position, 1.0)).xyz;
@@ -84,13 +100,16 @@ void applySkinning(inout vec3 position, inout vec3 normal, inout vec3 tangent) {
 // ========== Main ==========
 
 void main() {
+    InstanceRecord instance = instanceTable.records[inInstanceSlot];
+    mat4 instanceTransform = instance.transform;
+
     // Start with original vertex data
     vec3 localPos = inPosition;
     vec3 localNormal = inNormal;
     vec3 localTangent = inTangent;
 
     // Apply skeletal animation skinning
-    applySkinning(localPos, localNormal, localTangent);
+    applySkinning(instance.skin, localPos, localNormal, localTangent);
 
     // Transform position to world space
     vec4 worldPos = instanceTransform * vec4(localPos, 1.0);
@@ -111,9 +130,13 @@ void main() {
     fragTexCoord = inTexCoord;
 
     // Combine instance tint with vertex color
-    fragTintColor = instanceTintColor;
+    fragTintColor = instance.tintColor;
     fragVertexColor = inVertexColor;
 
+    // Material (constant across a draw: every instance of a mesh shares it)
+    fragTextures = instance.textures;
+    fragMetallicRoughness = instance.metallicRoughness;
+
     // Pass through time of day for dynamic lighting
     fragTimeOfDay = camera.skyTimeData.x;
 }
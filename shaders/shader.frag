@@ -7,12 +7,13 @@ layout(binding = 0) uniform UniformBufferObject {
     vec4 cameraPos;       // .xyz = camera position, .w = render distance
     vec4 skyTimeData;     // .x = time of day (0-1), .y = sun intensity, .z = moon intensity, .w = underwater 0/1
     vec4 liquidFogColor;  // .rgb = fog color, .a = fog density
-    vec4 liquidFogDist;   // .x = fog start, .y = fog end, .zw = unused
+    vec4 liquidFogDist;   // .x = fog start, .y = fog end, .z = horizon inner radius, .w = horizon distance
     vec4 liquidTint;      // .rgb = tint color, .a = darken factor
-    vec4 atlasInfo;       // .x = atlas width in cells, .y = height, .z = cell size (1/width), .w = unused
+    vec4 atlasInfo;       // .xyz = icon atlas grid (unused here), .w = far LOD distance
 } ubo;
 
-layout(binding = 1) uniform sampler2D texSampler;
+// Block textures: one layer per texture with full mip chains, REPEAT addressing (binding 4)
+layout(binding = 4) uniform sampler2DArray blockTextures;
 
 layout(location = 0) in vec4 fragColor;  // Now vec4 with alpha
 layout(location = 1) in vec3 fragWorldPos;
@@ -21,58 +22,58 @@ layout(location = 3) in float fragWaveIntensity;
 layout(location = 4) in float fragSkyLight;    // Sky light from vertex shader
 layout(location = 5) in float fragBlockLight;  // Block light from vertex shader
 layout(location = 6) in float fragAO;          // Ambient occlusion from vertex shader
+layout(location = 7) in float fragFarLod;      // 1.0 for downsampled far terrain, 2.0 for horizon
+layout(location = 8) in float fragSmooth;      // 1.0 for smooth terrain (surface nets)
+layout(location = 9) flat in uint fragLayer;   // Block texture array layer
 
 layout(location = 0) out vec4 outColor;
 
 void main() {
-    // Get atlas size from UBO (dynamic, not hardcoded)
-    float atlasSize = max(ubo.atlasInfo.x, 1.0);
-    float cellSize = 1.0 / atlasSize;
+    // Quad-local UV (0..quadWidth, 0..quadHeight); the sampler repeats the layer
     vec2 texCoord = fragTexCoord;
 
+    // Face normal from derivatives (flat per triangle; used for smooth texturing and sun shading)
+    vec3 dFdxPos = dFdx(fragWorldPos);
+    vec3 dFdyPos = dFdy(fragWorldPos);
+    // FIX: Negate the cross product to get correct front-facing normals
+    // Without negation, top faces appear dark and bottom faces appear bright (lit from below)
+    vec3 faceNormal = -normalize(cross(dFdxPos, dFdyPos));
+
     // Parallax scrolling ONLY for water (not ice or other transparent blocks)
     // Water has alpha=0.7 from TINT_PALETTE in vertex shader
-    // Uses TILED UV encoding: integer part = atlas cell, fractional part = tiled position
     if (fragColor.a >= 0.65 && fragColor.a < 0.75) {  // Only water blocks (alpha=0.7)
-        // TILED UV DECODING for water (same as other blocks but with parallax)
-        vec2 cell = floor(fragTexCoord);                   // Which atlas cell
-        vec2 localUV = fract(fragTexCoord) * atlasSize;    // Position scaled by quad size
-
-        // Apply parallax scrolling BEFORE tiling
+        // Scrolling wraps through REPEAT addressing like greedy mesh tiling
         float scrollSpeed = 250.0;  // Fast, smooth flow
-        localUV.y -= ubo.skyTimeData.x * scrollSpeed;        // Downward flow
-        localUV.x += ubo.skyTimeData.x * scrollSpeed * 0.5;  // Diagonal drift
-
-        // Tile within 0-1 (handles both scrolling wrap and greedy mesh tiling)
-        vec2 tiledUV = mod(localUV, 1.0);
-        tiledUV = clamp(tiledUV, 0.001, 0.999);
-
-        // Convert back to atlas space
-        texCoord = (cell + tiledUV) * cellSize;
+        texCoord.y -= ubo.skyTimeData.x * scrollSpeed;        // Downward flow
+        texCoord.x += ubo.skyTimeData.x * scrollSpeed * 0.5;  // Diagonal drift
     }
-    else {
-        // TILED UV DECODING for greedy meshing
-        // UV encoding: cellIndex + (localUV * quadSize) / atlasSize
-        // - Integer part = atlas cell index (0-3 for 4x4 atlas)
-        // - Fractional part * atlasSize = local position (0 to quadSize)
-        // Using mod() for tiling to handle edge case where fract(1.0) = 0.0
-        vec2 cell = floor(fragTexCoord);                   // Which atlas cell
-        vec2 localUV = fract(fragTexCoord) * atlasSize;    // Position scaled by quad size
-        // Use mod() instead of fract() to properly tile - handles exact integer values
-        // For single blocks: localUV goes from 0 to 1, we sample 0 to 0.999...
-        // For merged quads: localUV goes from 0 to N, texture tiles N times
-        vec2 tiledUV = mod(localUV, 1.0);                  // Tile within 0-1
-        // Clamp to avoid sampling neighboring cells at exact boundary
-        tiledUV = clamp(tiledUV, 0.001, 0.999);
-        texCoord = (cell + tiledUV) * cellSize;            // Convert back to atlas space
+    else if (fragSmooth > 0.5) {
+        // SMOOTH TERRAIN: project the block texture along the dominant normal axis,
+        // one tile per block like the cube mesher (sides keep the V flip)
+        vec3 axisWeight = abs(faceNormal);
+        if (axisWeight.y >= axisWeight.x && axisWeight.y >= axisWeight.z) {
+            texCoord = fragWorldPos.xz;
+        } else if (axisWeight.x >= axisWeight.z) {
+            texCoord = vec2(fragWorldPos.z, -fragWorldPos.y);
+        } else {
+            texCoord = vec2(fragWorldPos.x, -fragWorldPos.y);
+        }
     }
+    // Greedy-merged quads: texCoord already runs 0..N across the quad, the
+    // sampler tiles the layer N times and picks mips from continuous derivatives
 
     // Sample texture and multiply by vertex color
     // Textured blocks have white (1,1,1,1) vertex color → shows texture
     // Colored blocks have colored vertex color → shows solid color (default white texture)
-    vec4 texColor = texture(texSampler, texCoord);
+    vec4 texColor = texture(blockTextures, vec3(texCoord, float(fragLayer)));
     vec3 baseColor = texColor.rgb * fragColor.rgb;
 
+    // Horizon heightfield carries its own color (no texture)
+    bool horizon = fragFarLod > 1.5;
+    if (horizon) {
+        baseColor = fragColor.rgb;
+    }
+
     // Darken and tint water to reduce bright patches (not too dark)
     if (fragColor.a >= 0.65 && fragColor.a < 0.75) {  // Only water blocks (alpha=0.7)
         baseColor *= 0.65;  // Darken by 35% (less aggressive)
@@ -86,6 +87,19 @@ void main() {
     vec3 camPos = ubo.cameraPos.xyz;
     float renderDistance = ubo.cameraPos.w;
 
+    // Far LOD terrain lives beyond the normal render distance - fog/discard against the LOD distance
+    if (fragFarLod > 0.5 && fragFarLod < 1.5 && ubo.atlasInfo.w > renderDistance) {
+        renderDistance = ubo.atlasInfo.w;
+    }
+
+    // Horizon is hidden where full chunks are always resident and fades at its own distance
+    if (horizon) {
+        if (length(fragWorldPos.xz - ubo.cameraPos.xz) < ubo.liquidFogDist.z) {
+            discard;
+        }
+        renderDistance = max(renderDistance, ubo.liquidFogDist.w);
+    }
+
     // Extract sky time data
     float time = ubo.skyTimeData.x;
     float sunIntensity = ubo.skyTimeData.y;
@@ -137,12 +151,7 @@ void main() {
     float skyLightIntensity = sunContribution + moonContribution;
 
     // DIRECTIONAL SUN LIGHTING - Classic Minecraft-style face shading
-    // Calculate face normal from derivatives (works for flat-shaded blocks)
-    vec3 dFdxPos = dFdx(fragWorldPos);
-    vec3 dFdyPos = dFdy(fragWorldPos);
-    // FIX: Negate the cross product to get correct front-facing normals
-    // Without negation, top faces appear dark and bottom faces appear bright (lit from below)
-    vec3 faceNormal = -normalize(cross(dFdxPos, dFdyPos));
+    // (faceNormal is derived from screen-space derivatives at the top of main)
 
     // Sun always comes from above in retro style
     vec3 sunDirection = vec3(0.0, 1.0, 0.0);  // Pointing straight up
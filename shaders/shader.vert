@@ -14,15 +14,22 @@ layout(binding = 0) uniform UniformBufferObject {
     vec4 cameraPos;       // .xyz = camera position, .w = render distance
     vec4 skyTimeData;     // .x = time of day (0-1), .y = sun intensity, .z = moon intensity, .w = star intensity
     vec4 liquidFogColor;  // Liquid fog color (.rgb) + density (.a)
-    vec4 liquidFogDist;   // Fog distances (.x=start, .y=end) + unused (.zw)
+    vec4 liquidFogDist;   // Fog distances (.x=start, .y=end) + horizon inner radius (.z) and distance (.w)
     vec4 liquidTint;      // Liquid tint color (.rgb) + darken factor (.a)
-    vec4 atlasInfo;       // .x = atlas width in cells, .y = height, .z = cell size (1/width), .w = unused
+    vec4 atlasInfo;       // .xyz = icon atlas grid (unused here), .w = far LOD distance
 } ubo;
 
+// Per-draw constants (ChunkPushConstants in vulkan_renderer.h)
+// lightBlend: 0.0 = block light of the chunk's previous mesh, 1.0 = current light.
+// Ramped by the CPU after a lighting remesh; 1.0 for everything else.
+layout(push_constant) uniform ChunkPushConstants {
+    float lightBlend;
+} pc;
+
 // Compressed vertex input (12 bytes total = 3x uint32)
 layout(location = 0) in uint inPosXY;      // Position X (low 16) + Position Y (high 16)
-layout(location = 1) in uint inPosZAtlas;  // Position Z (low 16) + Atlas X (bits 16-23) + Atlas Y (bits 24-31)
-layout(location = 2) in uint inPackedB;    // Normal + QuadSize + Corner + Lighting + Tint
+layout(location = 1) in uint inPosZAtlas;  // Position Z (low 16) + texture array layer (high 16)
+layout(location = 2) in uint inPackedB;    // PrevLight + QuadSize + Corner + Lighting + Tint
 
 // Outputs to fragment shader
 layout(location = 0) out vec4 fragColor;
@@ -32,6 +39,9 @@ layout(location = 3) out float fragWaveIntensity;
 layout(location = 4) out float fragSkyLight;
 layout(location = 5) out float fragBlockLight;
 layout(location = 6) out float fragAO;
+layout(location = 7) out float fragFarLod;  // 1.0 for downsampled far terrain (bit 30), 2.0 for horizon (bit 31)
+layout(location = 8) out float fragSmooth;  // 1.0 for smooth terrain (bits 30 + 31): world-space texturing
+layout(location = 9) flat out uint fragLayer;  // Block texture array layer
 
 // Color tint palette (4 tints to fit in 2 bits)
 const vec4 TINT_PALETTE[4] = vec4[4](
@@ -55,49 +65,57 @@ float unpackInt16(uint packed, uint shift) {
 void main() {
     // ========== UNPACK POSITION ==========
     // posXY: bits 0-15 = posX (int16), bits 16-31 = posY (int16)
-    // posZAtlas: bits 0-15 = posZ (int16), bits 16-23 = atlasX, bits 24-31 = atlasY
+    // posZAtlas: bits 0-15 = posZ (int16), bits 16-31 = texture array layer
     float posX = unpackInt16(inPosXY, 0u);
     float posY = unpackInt16(inPosXY, 16u);
     float posZ = unpackInt16(inPosZAtlas, 0u);
 
     vec3 worldPos = vec3(posX, posY, posZ);
 
-    // ========== UNPACK ATLAS COORDS ==========
-    float atlasX = float((inPosZAtlas >> 16u) & 0xFFu);
-    float atlasY = float((inPosZAtlas >> 24u) & 0xFFu);
+    // ========== UNPACK TEXTURE LAYER ==========
+    fragLayer = inPosZAtlas >> 16u;
 
     // ========== UNPACK OTHER DATA (packedB) ==========
-    // Bits 0-2:   Normal index (0-5) - unused for now but available
-    // Bits 3-7:   Quad width (0-31)
-    // Bits 8-12:  Quad height (0-31)
-    // Bits 13-14: Corner index (0-3)
-    // Bits 15-18: Sky light (0-15)
-    // Bits 19-22: Block light (0-15)
-    // Bits 23-26: AO (0-15)
-    // Bits 27-28: Color tint (0-3)
-
-    // uint normalIndex = inPackedB & 0x7u;  // Uncomment if needed
-    float quadWidth = float((inPackedB >> 3u) & 0x1Fu);
-    float quadHeight = float((inPackedB >> 8u) & 0x1Fu);
-    uint cornerIndex = (inPackedB >> 13u) & 0x3u;
-    float skyLight = float((inPackedB >> 15u) & 0xFu) / 15.0;
-    float blockLight = float((inPackedB >> 19u) & 0xFu) / 15.0;
-    float ao = float((inPackedB >> 23u) & 0xFu) / 15.0;
-    uint colorTint = (inPackedB >> 27u) & 0x3u;
+    // Bits 0-3:   Previous block light (0-15, light transition source)
+    // Bits 4-8:   Quad width (0-31)
+    // Bits 9-13:  Quad height (0-31)
+    // Bits 14-15: Corner index (0-3)
+    // Bits 16-19: Sky light (0-15)
+    // Bits 20-23: Block light (0-15)
+    // Bits 24-27: AO (0-15)
+    // Bits 28-29: Color tint (0-3)
+    // Bit 30:     Far-LOD flag
+    // Bit 31:     Horizon flag (layer bits hold an RGB565 color)
+    // Bits 30+31: Smooth terrain - bits 0-11 are X/Y/Z position fractions (1/16 block)
+    // (Face normals come from screen-space derivatives in the fragment shader)
+
+    uint vertexKind = inPackedB >> 30u;  // 0 = block, 1 = far LOD, 2 = horizon, 3 = smooth terrain
+    bool smoothTerrain = vertexKind == 3u;
+    if (smoothTerrain) {
+        worldPos += vec3(float(inPackedB & 0xFu), float((inPackedB >> 4u) & 0xFu), float((inPackedB >> 8u) & 0xFu)) / 16.0;
+    }
+
+    // Smooth vertices carry no previous light (no transition)
+    float prevBlockLight = smoothTerrain ? float((inPackedB >> 20u) & 0xFu) : float(inPackedB & 0xFu);
+    float quadWidth = float((inPackedB >> 4u) & 0x1Fu);
+    float quadHeight = float((inPackedB >> 9u) & 0x1Fu);
+    uint cornerIndex = (inPackedB >> 14u) & 0x3u;
+    float skyLight = float((inPackedB >> 16u) & 0xFu) / 15.0;
+    float blockLight = mix(prevBlockLight, float((inPackedB >> 20u) & 0xFu), clamp(pc.lightBlend, 0.0, 1.0)) / 15.0;
+    float ao = float((inPackedB >> 24u) & 0xFu) / 15.0;
+    uint colorTint = (inPackedB >> 28u) & 0x3u;
 
     // ========== RECONSTRUCT UV COORDINATES ==========
     // Corner index determines UV offset within the quad:
     // 0: (0, 0)                  1: (quadWidth, 0)
     // 2: (0, quadHeight)         3: (quadWidth, quadHeight)
-    // Use (quadSize - 0.001) for max corner to avoid mod(N, 1.0) = 0.0 edge case
-    float uvOffsetU = ((cornerIndex & 1u) != 0u) ? (quadWidth - 0.001) : 0.001;
-    float uvOffsetV = ((cornerIndex & 2u) != 0u) ? (quadHeight - 0.001) : 0.001;
-
-    // Calculate final texture coordinates using tiled encoding
-    // UV = cellIndex + localOffset / atlasSize
-    // This allows fragment shader to use mod() for texture tiling
-    float atlasSize = max(ubo.atlasInfo.x, 1.0);  // Number of cells per row (default 1 to avoid div by 0)
-    fragTexCoord = vec2(atlasX + uvOffsetU / atlasSize, atlasY + uvOffsetV / atlasSize);
+    // The texture array sampler uses REPEAT, so a merged quad tiles its layer
+    // quadWidth x quadHeight times with no wrapping math in the fragment shader
+    fragTexCoord = vec2(((cornerIndex & 1u) != 0u) ? quadWidth : 0.0,
+                        ((cornerIndex & 2u) != 0u) ? quadHeight : 0.0);
+    if (smoothTerrain) {
+        fragTexCoord = vec2(0.0);  // Layer only - UVs come from world space
+    }
 
     // ========== OUTPUT ==========
     // Apply model matrix (identity for world rendering)
@@ -106,8 +124,20 @@ void main() {
     gl_Position = ubo.projection * ubo.view * transformedPos;
     fragWorldPos = transformedPos.xyz;
     fragColor = TINT_PALETTE[colorTint];
+
+    // Horizon heightfield: vertex color replaces the texture (RGB565 in the layer bits)
+    bool horizon = vertexKind == 2u;
+    if (horizon) {
+        uint rgb565 = (inPosZAtlas >> 16u) & 0xFFFFu;
+        fragColor = vec4(float((rgb565 >> 11u) & 0x1Fu) / 31.0,
+                         float((rgb565 >> 5u) & 0x3Fu) / 63.0,
+                         float(rgb565 & 0x1Fu) / 31.0,
+                         1.0);
+    }
     fragWaveIntensity = (colorTint == 1u) ? 1.0 : 0.0;  // Water gets wave intensity
     fragSkyLight = skyLight;
     fragBlockLight = blockLight;
     fragAO = ao;
+    fragFarLod = horizon ? 2.0 : (vertexKind == 1u ? 1.0 : 0.0);
+    fragSmooth = smoothTerrain ? 1.0 : 0.0;
 }
@@ -0,0 +1,445 @@
+/**
+ * @file animation_batch.cpp
+ * @brief Clip compilation, cursor-cached sampling and parallel skinning for crowds
+ *
+ * Created: 2025-11-28
+ */
+
+#include "animation/animation_batch.h"
+#include "mesh/mesh.h"
+#include "profiler.h"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+
+/// T * R * S without building three matrices
+glm::mat4 composeTRS(const glm::vec3& translation, const glm::quat& rotation, const glm::vec3& scale) {
+    const glm::mat3 r = glm::mat3_cast(rotation);
+    glm::mat4 m(1.0f);
+    m[0] = glm::vec4(r[0] * scale.x, 0.0f);
+    m[1] = glm::vec4(r[1] * scale.y, 0.0f);
+    m[2] = glm::vec4(r[2] * scale.z, 0.0f);
+    m[3] = glm::vec4(translation, 1.0f);
+    return m;
+}
+
+/// Normalized lerp along the shorter arc (crossfades: cheaper than slerp, close enough)
+glm::quat nlerp(const glm::quat& a, const glm::quat& b, float t) {
+    const glm::quat target = glm::dot(a, b) < 0.0f ? -b : b;
+    return glm::normalize(a * (1.0f - t) + target * t);
+}
+
+}  // namespace
+
+// ========== Compilation ==========
+
+uint32_t AnimationBatch::addSkeleton(const RuntimeSkeleton& skeleton) {
+    const size_t boneCount = skeleton.bones.size();
+    if (boneCount == 0 || boneCount > static_cast<size_t>(MAX_BONES)) {
+        return 0;
+    }
+
+    AnimSkeleton compiled;
+    compiled.parents.resize(boneCount);
+    compiled.bindTranslations.resize(boneCount);
+    compiled.bindRotations.resize(boneCount);
+    compiled.bindScales.resize(boneCount);
+    for (size_t i = 0; i < boneCount; i++) {
+        const RuntimeBone& bone = skeleton.bones[i];
+        const bool validParent = bone.parentIndex >= 0 && bone.parentIndex < static_cast<int>(boneCount) &&
+                                 bone.parentIndex != static_cast<int>(i);
+        compiled.parents[i] = validParent ? bone.parentIndex : -1;
+        compiled.bindTranslations[i] = bone.position;
+        compiled.bindRotations[i] = bone.rotation;
+        compiled.bindScales[i] = bone.scale;
+        compiled.boneNameToIndex[bone.name] = static_cast<int>(i);
+    }
+
+    // Parents before children, whatever order the rig lists them in
+    std::vector<uint8_t> placed(boneCount, 0);
+    compiled.evalOrder.reserve(boneCount);
+    while (compiled.evalOrder.size() < boneCount) {
+        const size_t before = compiled.evalOrder.size();
+        for (size_t i = 0; i < boneCount; i++) {
+            const int parent = compiled.parents[i];
+            if (!placed[i] && (parent < 0 || placed[parent])) {
+                placed[i] = 1;
+                compiled.evalOrder.push_back(static_cast<int>(i));
+            }
+        }
+        if (compiled.evalOrder.size() == before) {
+            // Parent cycle: treat the remaining bones as roots
+            for (size_t i = 0; i < boneCount; i++) {
+                if (!placed[i]) {
+                    placed[i] = 1;
+                    compiled.parents[i] = -1;
+                    compiled.evalOrder.push_back(static_cast<int>(i));
+                }
+            }
+        }
+    }
+
+    // Inverse bind poses from the bind pose's model-space transforms
+    AnimPose bindPose;
+    bindPose.translations = compiled.bindTranslations;
+    bindPose.rotations = compiled.bindRotations;
+    bindPose.scales = compiled.bindScales;
+    compiled.inverseBindPoses.assign(boneCount, glm::mat4(1.0f));
+    std::vector<glm::mat4> model;
+    std::vector<glm::mat4> identitySkinning(boneCount);
+    computeSkinning(compiled, bindPose, model, identitySkinning.data());
+    for (size_t i = 0; i < boneCount; i++) {
+        compiled.inverseBindPoses[i] = glm::inverse(model[i]);
+    }
+
+    m_skeletons.push_back(std::move(compiled));
+    return static_cast<uint32_t>(m_skeletons.size());
+}
+
+uint32_t AnimationBatch::addClip(uint32_t skeletonId, const AnimationClip& clip) {
+    const AnimSkeleton* skeleton = getSkeleton(skeletonId);
+    if (skeleton == nullptr) {
+        return 0;
+    }
+
+    ClipEntry entry;
+    entry.skeleton = skeletonId - 1;
+    entry.clip.duration = clip.duration;
+    entry.clip.loop = clip.loop;
+
+    for (const BoneAnimationTrack& source : clip.tracks) {
+        auto boneIt = skeleton->boneNameToIndex.find(source.boneName);
+        if (boneIt == skeleton->boneNameToIndex.end() || source.keyframes.empty()) continue;
+
+        std::vector<AnimationKeyframe> keys = source.keyframes;
+        std::stable_sort(keys.begin(), keys.end(),
+                         [](const AnimationKeyframe& a, const AnimationKeyframe& b) { return a.time < b.time; });
+
+        AnimClip::Track track;
+        track.bone = boneIt->second;
+        track.firstKey = static_cast<uint32_t>(entry.clip.times.size());
+        track.keyCount = static_cast<uint32_t>(keys.size());
+        for (const AnimationKeyframe& key : keys) {
+            entry.clip.times.push_back(key.time);
+            entry.clip.translations.push_back(key.position);
+            entry.clip.rotations.push_back(key.rotation);
+            entry.clip.scales.push_back(key.scale);
+        }
+        entry.clip.tracks.push_back(track);
+    }
+
+    m_clips.push_back(std::move(entry));
+    return static_cast<uint32_t>(m_clips.size());
+}
+
+const AnimSkeleton* AnimationBatch::getSkeleton(uint32_t skeletonId) const {
+    if (skeletonId == 0 || skeletonId > m_skeletons.size()) {
+        return nullptr;
+    }
+    return &m_skeletons[skeletonId - 1];
+}
+
+// ========== Characters ==========
+
+uint32_t AnimationBatch::createCharacter(uint32_t skeletonId, uint32_t paletteBase) {
+    if (getSkeleton(skeletonId) == nullptr) {
+        return 0;
+    }
+
+    Character character;
+    character.id = m_nextCharacterId++;
+    character.skeleton = skeletonId - 1;
+    character.paletteBase = paletteBase;
+    resetToBindPose(character);
+
+    m_characterIndex[character.id] = static_cast<uint32_t>(m_characters.size());
+    m_characters.push_back(std::move(character));
+    return m_characters.back().id;
+}
+
+void AnimationBatch::removeCharacter(uint32_t characterId) {
+    auto it = m_characterIndex.find(characterId);
+    if (it == m_characterIndex.end()) {
+        return;
+    }
+
+    // Swap-remove keeps the update loop dense
+    const uint32_t index = it->second;
+    m_characterIndex.erase(it);
+    if (index + 1 != m_characters.size()) {
+        m_characters[index] = std::move(m_characters.back());
+        m_characterIndex[m_characters[index].id] = index;
+    }
+    m_characters.pop_back();
+}
+
+void AnimationBatch::play(uint32_t characterId, uint32_t clipId, bool loop, float blendTime, float speed) {
+    Character* character = findCharacter(characterId);
+    if (character == nullptr || clipId == 0 || clipId > m_clips.size() ||
+        m_clips[clipId - 1].skeleton != character->skeleton) {
+        return;
+    }
+
+    // Crossfade from whatever is on screen now (blended is current once the fade has advanced)
+    if (blendTime > 0.0f) {
+        const bool midBlend = character->blendElapsed > 0.0f && character->blendElapsed < character->blendDuration;
+        character->blendFrom = midBlend ? character->blended : character->pose;
+        character->blendElapsed = 0.0f;
+        character->blendDuration = blendTime;
+    } else {
+        character->blendDuration = 0.0f;
+    }
+
+    // Bones the new clip doesn't animate return to the bind pose
+    resetToBindPose(*character);
+
+    character->clip = clipId - 1;
+    character->cursors.assign(m_clips[clipId - 1].clip.tracks.size(), 0);
+    character->time = 0.0f;
+    character->speed = speed;
+    character->loop = loop;
+    character->playing = true;
+}
+
+void AnimationBatch::stop(uint32_t characterId) {
+    if (Character* character = findCharacter(characterId)) {
+        character->playing = false;
+    }
+}
+
+void AnimationBatch::setPaletteBase(uint32_t characterId, uint32_t paletteBase) {
+    if (Character* character = findCharacter(characterId)) {
+        character->paletteBase = paletteBase;
+        character->dirty = true;
+    }
+}
+
+bool AnimationBatch::isPlaying(uint32_t characterId) const {
+    const Character* character = findCharacter(characterId);
+    return character != nullptr && character->playing;
+}
+
+float AnimationBatch::getTime(uint32_t characterId) const {
+    const Character* character = findCharacter(characterId);
+    return character != nullptr ? character->time : 0.0f;
+}
+
+AnimationBatch::Character* AnimationBatch::findCharacter(uint32_t characterId) {
+    auto it = m_characterIndex.find(characterId);
+    return it != m_characterIndex.end() ? &m_characters[it->second] : nullptr;
+}
+
+const AnimationBatch::Character* AnimationBatch::findCharacter(uint32_t characterId) const {
+    auto it = m_characterIndex.find(characterId);
+    return it != m_characterIndex.end() ? &m_characters[it->second] : nullptr;
+}
+
+void AnimationBatch::resetToBindPose(Character& character) const {
+    const AnimSkeleton& skeleton = m_skeletons[character.skeleton];
+    character.pose.translations = skeleton.bindTranslations;
+    character.pose.rotations = skeleton.bindRotations;
+    character.pose.scales = skeleton.bindScales;
+    character.dirty = true;
+}
+
+// ========== Evaluation ==========
+
+void AnimationBatch::update(float deltaTime, glm::mat4* palette) {
+    const size_t count = m_characters.size();
+    if (count == 0) {
+        return;
+    }
+
+    const size_t jobs = (count + CHARACTERS_PER_JOB - 1) / CHARACTERS_PER_JOB;
+    if (jobs == 1) {
+        for (Character& character : m_characters) {
+            evaluate(character, deltaTime, palette);
+        }
+        return;
+    }
+
+    if (m_workers.empty()) {
+        startWorkers();
+    }
+
+    // Characters only touch their own state and palette range
+    {
+        std::lock_guard<std::mutex> lock(m_jobMutex);
+        m_jobDeltaTime = deltaTime;
+        m_jobPalette = palette;
+        m_jobCount = jobs;
+        m_jobNext.store(0, std::memory_order_relaxed);
+        m_workersBusy = m_workers.size();
+        m_jobGeneration++;
+    }
+    m_jobCV.notify_all();
+
+    evaluateJobs();  // The calling thread claims jobs too
+
+    std::unique_lock<std::mutex> lock(m_jobMutex);
+    m_doneCV.wait(lock, [this]() { return m_workersBusy == 0; });
+    m_jobPalette = nullptr;
+}
+
+void AnimationBatch::evaluate(Character& character, float deltaTime, glm::mat4* palette) const {
+    const bool blending = character.blendElapsed < character.blendDuration;
+    if (!character.playing && !blending && !character.dirty) {
+        return;
+    }
+
+    if (character.playing && character.clip != NO_CLIP) {
+        const AnimClip& clip = m_clips[character.clip].clip;
+
+        character.time += deltaTime * character.speed;
+        if (character.loop && clip.duration > 0.0f) {
+            character.time = std::fmod(character.time, clip.duration);
+            if (character.time < 0.0f) character.time += clip.duration;
+        } else if (character.time >= clip.duration) {
+            character.time = clip.duration;
+            character.playing = false;
+        }
+
+        sampleClip(clip, character.time, character.cursors, character.pose);
+    }
+
+    const AnimPose* pose = &character.pose;
+    if (blending) {
+        character.blendElapsed += deltaTime;
+        const float weight = glm::clamp(character.blendElapsed / character.blendDuration, 0.0f, 1.0f);
+
+        const size_t boneCount = character.pose.translations.size();
+        character.blended.translations.resize(boneCount);
+        character.blended.rotations.resize(boneCount);
+        character.blended.scales.resize(boneCount);
+        for (size_t bone = 0; bone < boneCount; bone++) {
+            character.blended.translations[bone] =
+                glm::mix(character.blendFrom.translations[bone], character.pose.translations[bone], weight);
+            character.blended.rotations[bone] =
+                nlerp(character.blendFrom.rotations[bone], character.pose.rotations[bone], weight);
+            character.blended.scales[bone] =
+                glm::mix(character.blendFrom.scales[bone], character.pose.scales[bone], weight);
+        }
+        pose = &character.blended;
+    }
+
+    if (palette != nullptr) {
+        computeSkinning(m_skeletons[character.skeleton], *pose, character.model, palette + character.paletteBase);
+        character.dirty = false;
+    }
+}
+
+// ========== Update Workers ==========
+
+AnimationBatch::~AnimationBatch() {
+    {
+        std::lock_guard<std::mutex> lock(m_jobMutex);
+        m_shuttingDown = true;
+    }
+    m_jobCV.notify_all();
+    for (std::thread& worker : m_workers) {
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+}
+
+void AnimationBatch::startWorkers() {
+    unsigned int numThreads = std::thread::hardware_concurrency();
+    if (numThreads == 0) {
+        numThreads = 4;  // hardware_concurrency() can return 0 in containers
+    }
+    const unsigned int workerCount = std::max(1u, std::min(numThreads - 1, MAX_WORKERS));
+
+    m_workers.reserve(workerCount);
+    for (unsigned int i = 0; i < workerCount; i++) {
+        m_workers.emplace_back(&AnimationBatch::workerThreadFunction, this);
+    }
+}
+
+void AnimationBatch::workerThreadFunction() {
+    Profiler::setThreadName("Animation Worker");
+
+    uint64_t lastGeneration = 0;
+    while (true) {
+        // Wait for the next parallel update (or shutdown)
+        {
+            std::unique_lock<std::mutex> lock(m_jobMutex);
+            m_jobCV.wait(lock, [this, lastGeneration]() {
+                return m_shuttingDown || m_jobGeneration != lastGeneration;
+            });
+            if (m_shuttingDown) {
+                break;
+            }
+            lastGeneration = m_jobGeneration;
+        }
+
+        evaluateJobs();
+
+        {
+            std::lock_guard<std::mutex> lock(m_jobMutex);
+            if (--m_workersBusy == 0) {
+                m_doneCV.notify_one();
+            }
+        }
+    }
+}
+
+void AnimationBatch::evaluateJobs() {
+    for (size_t job = m_jobNext.fetch_add(1); job < m_jobCount; job = m_jobNext.fetch_add(1)) {
+        const size_t end = std::min(m_characters.size(), (job + 1) * CHARACTERS_PER_JOB);
+        for (size_t i = job * CHARACTERS_PER_JOB; i < end; i++) {
+            evaluate(m_characters[i], m_jobDeltaTime, m_jobPalette);
+        }
+    }
+}
+
+// ========== Sampling ==========
+
+void AnimationBatch::sampleClip(const AnimClip& clip, float time, std::vector<uint32_t>& cursors, AnimPose& pose) {
+    if (cursors.size() != clip.tracks.size()) {
+        cursors.assign(clip.tracks.size(), 0);
+    }
+
+    for (size_t t = 0; t < clip.tracks.size(); t++) {
+        const AnimClip::Track& track = clip.tracks[t];
+        const float* times = clip.times.data() + track.firstKey;
+        const uint32_t first = track.firstKey;
+
+        // Step on from last frame's key; rewind only when time went backwards (loop wrap)
+        uint32_t& cursor = cursors[t];
+        if (cursor >= track.keyCount || times[cursor] > time) {
+            cursor = 0;
+        }
+        while (cursor + 1 < track.keyCount && times[cursor + 1] <= time) {
+            cursor++;
+        }
+
+        const uint32_t a = first + cursor;
+        if (cursor + 1 >= track.keyCount) {
+            pose.translations[track.bone] = clip.translations[a];
+            pose.rotations[track.bone] = clip.rotations[a];
+            pose.scales[track.bone] = clip.scales[a];
+            continue;
+        }
+
+        const uint32_t b = a + 1;
+        const float span = clip.times[b] - clip.times[a];
+        const float factor = span < 0.0001f ? 0.0f : glm::clamp((time - clip.times[a]) / span, 0.0f, 1.0f);
+        pose.translations[track.bone] = glm::mix(clip.translations[a], clip.translations[b], factor);
+        pose.rotations[track.bone] = glm::slerp(clip.rotations[a], clip.rotations[b], factor);
+        pose.scales[track.bone] = glm::mix(clip.scales[a], clip.scales[b], factor);
+    }
+}
+
+void AnimationBatch::computeSkinning(const AnimSkeleton& skeleton, const AnimPose& pose,
+                                     std::vector<glm::mat4>& modelScratch, glm::mat4* out) {
+    modelScratch.resize(skeleton.boneCount());
+
+    for (int bone : skeleton.evalOrder) {
+        const glm::mat4 local = composeTRS(pose.translations[bone], pose.rotations[bone], pose.scales[bone]);
+        const int parent = skeleton.parents[bone];
+        modelScratch[bone] = parent >= 0 ? modelScratch[parent] * local : local;
+        out[bone] = modelScratch[bone] * skeleton.inverseBindPoses[bone];
+    }
+}
@@ -0,0 +1,176 @@
+/**
+ * @file asset_pipeline.cpp
+ * @brief Parallel YAML parsing, content hashing, atomic writes and file mapping
+ *
+ * Created: 2025-11-28
+ */
+
+#include "asset_pipeline.h"
+#include <fstream>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace AssetPipeline {
+
+std::vector<ParsedYaml> loadYamlFiles(const std::vector<std::filesystem::path>& paths) {
+    std::vector<ParsedYaml> results(paths.size());
+    parallelFor(paths.size(), [&](size_t i) {
+        ParsedYaml& result = results[i];
+        result.path = paths[i];
+        try {
+            result.doc = YAML::LoadFile(paths[i].string());
+        } catch (const std::exception& e) {
+            result.doc = YAML::Node();
+            result.error = e.what();
+        }
+    });
+    return results;
+}
+
+uint64_t hashBytes(const void* data, size_t size, uint64_t seed) {
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+    uint64_t hash = seed;
+    for (size_t i = 0; i < size; i++) {
+        hash ^= bytes[i];
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+uint64_t hashString(const std::string& str, uint64_t seed) {
+    const uint64_t length = str.size();
+    return hashBytes(str.data(), str.size(), hashBytes(&length, sizeof(length), seed));
+}
+
+uint64_t hashFile(const std::string& path, bool* exists) {
+    MappedFile file;
+    if (!file.open(path)) {
+        if (exists) *exists = false;
+        return 0;
+    }
+    if (exists) *exists = true;
+    return hashBytes(file.data(), file.size());
+}
+
+bool writeFileAtomic(const std::string& path, const std::vector<std::pair<const void*, size_t>>& chunks) {
+    namespace fs = std::filesystem;
+    std::error_code ec;
+    fs::path filePath(path);
+    if (filePath.has_parent_path()) {
+        fs::create_directories(filePath.parent_path(), ec);
+    }
+
+    const std::string tempPath = path + ".tmp";
+    {
+        std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+        if (!file.is_open()) {
+            return false;
+        }
+        for (const auto& chunk : chunks) {
+            file.write(static_cast<const char*>(chunk.first), static_cast<std::streamsize>(chunk.second));
+        }
+        if (!file) {
+            return false;
+        }
+    }
+
+    fs::rename(tempPath, filePath, ec);
+    if (ec) {
+        fs::remove(tempPath, ec);
+        return false;
+    }
+    return true;
+}
+
+// ========== MappedFile ==========
+
+MappedFile::~MappedFile() {
+    close();
+}
+
+#ifdef _WIN32
+
+bool MappedFile::open(const std::string& path) {
+    close();
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        return false;
+    }
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0) {
+        CloseHandle(file);
+        return false;
+    }
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (!mapping) {
+        CloseHandle(file);
+        return false;
+    }
+    void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (!view) {
+        CloseHandle(mapping);
+        CloseHandle(file);
+        return false;
+    }
+    m_file = file;
+    m_mapping = mapping;
+    m_data = static_cast<const uint8_t*>(view);
+    m_size = static_cast<size_t>(fileSize.QuadPart);
+    return true;
+}
+
+void MappedFile::close() {
+    if (m_data) UnmapViewOfFile(m_data);
+    if (m_mapping) CloseHandle(static_cast<HANDLE>(m_mapping));
+    if (m_file) CloseHandle(static_cast<HANDLE>(m_file));
+    m_data = nullptr;
+    m_mapping = nullptr;
+    m_file = nullptr;
+    m_size = 0;
+}
+
+#else
+
+bool MappedFile::open(const std::string& path) {
+    close();
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size <= 0) {
+        ::close(fd);
+        return false;
+    }
+    void* view = mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);  // The mapping keeps the file referenced
+    if (view == MAP_FAILED) {
+        return false;
+    }
+    m_data = static_cast<const uint8_t*>(view);
+    m_size = static_cast<size_t>(st.st_size);
+    return true;
+}
+
+void MappedFile::close() {
+    if (m_data) {
+        munmap(const_cast<uint8_t*>(m_data), m_size);
+    }
+    m_data = nullptr;
+    m_size = 0;
+}
+
+#endif
+
+}  // namespace AssetPipeline
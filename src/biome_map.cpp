@@ -174,7 +174,11 @@ const Biome* BiomeMap::getBiomeAt(float worldX, float worldZ) {
         }
     }
 
-    // Not in cache - compute it
+    // Not in cache - compute it at the cell's reference point, not the queried position,
+    // so the cached value doesn't depend on which column asked first (worldgen structure
+    // sites are resolved independently per chunk and must agree)
+    worldX = quantizedX * 4.0f;
+    worldZ = quantizedZ * 4.0f;
     float temperature = getTemperatureAt(worldX, worldZ);
     float moisture = getMoistureAt(worldX, worldZ);
     const Biome* biome = selectBiome(temperature, moisture);
@@ -221,7 +225,10 @@ int BiomeMap::getTerrainHeightAt(float worldX, float worldZ) {
         }
     }
 
-    // Not in cache - compute it
+    // Not in cache - compute it at the cell's reference point (order-independent, as getBiomeAt)
+    worldX = quantizedX * 2.0f;
+    worldZ = quantizedZ * 2.0f;
+
     // Get biome at this location
     const Biome* biome = getBiomeAt(worldX, worldZ);
     if (!biome) {
@@ -299,10 +306,13 @@ int BiomeMap::getTerrainHeightAt(float worldX, float worldZ) {
             int mountainCount = 0;
             const int totalSamples = 8;
 
+            // Sample around the region's reference point so the cached value is order-independent
+            const float regionX = static_cast<float>(mountainRegionX << 5);
+            const float regionZ = static_cast<float>(mountainRegionZ << 5);
             for (int i = 0; i < totalSamples; i++) {
                 float angle = (i / float(totalSamples)) * 2.0f * 3.14159f;
-                float sampleX = worldX + std::cos(angle) * sampleRadius;
-                float sampleZ = worldZ + std::sin(angle) * sampleRadius;
+                float sampleX = regionX + std::cos(angle) * sampleRadius;
+                float sampleZ = regionZ + std::sin(angle) * sampleRadius;
 
                 const Biome* sampleBiome = getBiomeAt(sampleX, sampleZ);
                 if (sampleBiome && sampleBiome->height_multiplier > 1.5f) {
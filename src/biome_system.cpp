@@ -2,6 +2,7 @@
 #include "tree_generator.h"
 #include "logger.h"
 #include "script_action.h"
+#include "asset_pipeline.h"
 #include <yaml-cpp/yaml.h>
 #include <filesystem>
 #include <algorithm>
@@ -27,20 +28,28 @@ bool BiomeRegistry::loadBiomes(const std::string& directory) {
         return false;
     }
 
-    int loadedCount = 0;
+    std::vector<fs::path> yamlFiles;
     for (const auto& entry : fs::directory_iterator(directory)) {
         if (entry.is_regular_file()) {
             const auto& path = entry.path();
             if (path.extension() == ".yaml" || path.extension() == ".yml") {
-                if (loadBiomeFromFile(path.string())) {
-                    loadedCount++;
-                } else {
-                    Logger::error() << "Failed to load biome from: " << path.string();
-                }
+                yamlFiles.push_back(path);
             }
         }
     }
 
+    // PERFORMANCE (2025-11-28): Parse all files in parallel, register sequentially in directory order
+    int loadedCount = 0;
+    for (const auto& parsed : AssetPipeline::loadYamlFiles(yamlFiles)) {
+        if (!parsed.error.empty()) {
+            Logger::error() << "YAML parsing error in " << parsed.path.string() << ": " << parsed.error;
+        } else if (loadBiomeFromNode(parsed.doc, parsed.path.string())) {
+            loadedCount++;
+            continue;
+        }
+        Logger::error() << "Failed to load biome from: " << parsed.path.string();
+    }
+
     Logger::info() << "Successfully loaded " << loadedCount << " biome(s)";
     return loadedCount > 0;
 }
@@ -63,10 +72,8 @@ void BiomeRegistry::generateTreeTemplates(TreeGenerator* treeGenerator) {
     Logger::info() << "Tree template generation complete";
 }
 
-bool BiomeRegistry::loadBiomeFromFile(const std::string& filepath) {
+bool BiomeRegistry::loadBiomeFromNode(const YAML::Node& doc, const std::string& filepath) {
     try {
-        YAML::Node doc = YAML::LoadFile(filepath);
-
         auto biome = std::make_unique<Biome>();
 
         // ===== REQUIRED FIELDS =====
@@ -144,6 +151,9 @@ bool BiomeRegistry::loadBiomeFromFile(const std::string& filepath) {
         if (doc["height_multiplier"]) {
             biome->height_multiplier = doc["height_multiplier"].as<float>();
         }
+        if (doc["smooth_terrain"]) {
+            biome->smooth_terrain = doc["smooth_terrain"].as<bool>();
+        }
 
         // Vegetation
         if (doc["trees_spawn"]) {
@@ -0,0 +1,67 @@
+/**
+ * @file block_properties.cpp
+ * @brief Compiles BlockDefinitions into the flat hot-path property table
+ *
+ * Created: 2025-11-28
+ */
+
+#include "block_properties.h"
+#include "block_system.h"
+#include "chunk.h"
+#include <algorithm>
+
+namespace {
+
+uint16_t layerOf(const BlockDefinition::FaceTexture& tex, int maxLayer) {
+    return static_cast<uint16_t>(std::clamp(tex.layer, 0, maxLayer));
+}
+
+}  // namespace
+
+void BlockPropertyTable::build(const std::vector<BlockDefinition>& defs, int layerCount) {
+    const size_t count = defs.size();
+    m_flags.assign(count, 0);
+    m_lightLevel.assign(count, 0);
+    m_tint.assign(count, CompressedVertex::TINT_WHITE);
+    m_faceLayers.assign(count * 6, 0);
+    m_randomTick.assign(count, 0);
+    m_smooth.assign(count, 0);
+    m_anyRandomTick = false;
+
+    // Headless (no texture array): every face reads layer 0
+    const int maxLayer = std::max(0, layerCount - 1);
+
+    for (size_t i = 0; i < count; i++) {
+        const BlockDefinition& def = defs[i];
+        if (i == 0 || def.id != static_cast<int>(i)) continue;  // Air, or a gap in the ID range
+
+        uint8_t bits = BlockFlags::VALID;
+        if (!def.isLiquid) bits |= BlockFlags::SOLID;
+        if (def.transparency > 0.0f) bits |= BlockFlags::TRANSPARENT;
+        else bits |= BlockFlags::OPAQUE;
+        if (def.isLiquid) bits |= BlockFlags::LIQUID;
+        if (def.isEmissive && def.lightLevel > 0) bits |= BlockFlags::EMISSIVE;
+        if (def.affectedByGravity) bits |= BlockFlags::GRAVITY;
+        if (def.useCubeMap) bits |= BlockFlags::CUBE_MAP;
+        m_flags[i] = bits;
+
+        m_lightLevel[i] = def.lightLevel;
+        m_tint[i] = def.isLiquid ? CompressedVertex::TINT_WATER : CompressedVertex::TINT_WHITE;
+        m_randomTick[i] = def.randomTick ? 1 : 0;
+        m_anyRandomTick |= def.randomTick;
+        m_smooth[i] = (def.smoothTerrain && (bits & BlockFlags::SOLID) && (bits & BlockFlags::OPAQUE)) ? 1 : 0;
+
+        // FaceDirection order: +X (right), -X (left), +Y (top), -Y (bottom), +Z (back), -Z (front)
+        uint16_t* layers = &m_faceLayers[i * 6];
+        if (def.useCubeMap) {
+            layers[0] = layerOf(def.right, maxLayer);
+            layers[1] = layerOf(def.left, maxLayer);
+            layers[2] = layerOf(def.top, maxLayer);
+            layers[3] = layerOf(def.bottom, maxLayer);
+            layers[4] = layerOf(def.back, maxLayer);
+            layers[5] = layerOf(def.front, maxLayer);
+        } else {
+            std::fill(layers, layers + 6, layerOf(def.all, maxLayer));
+        }
+    }
+}
@@ -6,7 +6,8 @@
  * - Loading block definitions from YAML files (assets/blocks/)
  * - Texture loading and automatic downscaling to 64x64
  * - Cube-mapped texture atlas generation (NxN grid of block faces)
- * - Mipmap generation for smooth LOD transitions
+ * - Block texture array (one 64-128px layer per texture, offline mip chains)
+ *   for world rendering; the atlas remains for inventory icons
  * - UV coordinate calculation for texture atlas indexing
  * - Block type registry (singleton pattern)
  *
@@ -21,11 +22,16 @@
 #include "vulkan_renderer.h"
 #include "logger.h"
 #include "script_action.h"
+#include "asset_pipeline.h"
+#include "texture_array.h"
 #include <iostream>
 #include <fstream>
 #include <filesystem>
 #include <algorithm>
 #include <cctype>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
 
 // stb_image - for texture loading and resizing
 #define STB_IMAGE_IMPLEMENTATION
@@ -44,14 +50,14 @@ struct PixelDeleter {
 
 // Helper structure to hold loaded texture data before atlas building
 struct LoadedTexture {
-    std::unique_ptr<unsigned char[], PixelDeleter> pixels;  // RAII managed RGBA data (64x64)
+    std::unique_ptr<unsigned char[], PixelDeleter> pixels;  // RAII managed RGBA data
     int width = 64;
     int height = 64;
     std::string name;
 };
 
-// Helper function to load and downscale a texture to 64x64
-static LoadedTexture loadAndResizeTexture(const std::string& texturePath, const std::string& name) {
+// Helper function to decode a texture at its native size
+static LoadedTexture loadTexture(const std::string& texturePath, const std::string& name) {
     LoadedTexture tex;
     tex.name = name;
 
@@ -62,23 +68,45 @@ static LoadedTexture loadAndResizeTexture(const std::string& texturePath, const
         return tex;  // pixels = nullptr indicates failure
     }
 
-    // Auto-downscale to 64x64 if needed
-    if (texWidth != 64 || texHeight != 64) {
-        Logger::debug() << "Resizing texture " << texturePath << " from " << texWidth << "x" << texHeight << " to 64x64";
+    tex.pixels.reset(pixels);
+    tex.width = texWidth;
+    tex.height = texHeight;
+    return tex;
+}
 
-        // Allocate resized buffer - stbir can allocate for us
-        unsigned char* resizedPixels = nullptr;
-        resizedPixels = stbir_resize_uint8_srgb(pixels, texWidth, texHeight, 0,
-                                                nullptr, 64, 64, 0, STBIR_RGBA);
+// Helper function to scale a decoded texture to a square tile
+// Atlas tiles keep the original sRGB resize; texture array layers wrap at the
+// edges (they tile with REPEAT) and point-sample upscales to keep pixel art crisp
+static LoadedTexture resizeTexture(const LoadedTexture& src, int size, bool tiling) {
+    LoadedTexture tex;
+    tex.name = src.name;
+    tex.width = size;
+    tex.height = size;
+    if (!src.pixels) {
+        return tex;
+    }
 
-        stbi_image_free(pixels);
+    // stbir allocates with malloc, will be freed with stbi_image_free
+    unsigned char* resizedPixels = nullptr;
+    if (src.width == size && src.height == size) {
+        resizedPixels = static_cast<unsigned char*>(std::malloc(static_cast<size_t>(size) * size * 4));
         if (resizedPixels) {
-            tex.pixels.reset(resizedPixels);  // stbir allocates with malloc, will be freed with stbi_image_free
+            std::memcpy(resizedPixels, src.pixels.get(), static_cast<size_t>(size) * size * 4);
         }
+    } else if (!tiling) {
+        Logger::debug() << "Resizing texture " << src.name << " from " << src.width << "x" << src.height
+                        << " to " << size << "x" << size;
+        resizedPixels = stbir_resize_uint8_srgb(src.pixels.get(), src.width, src.height, 0,
+                                                nullptr, size, size, 0, STBIR_RGBA);
     } else {
-        tex.pixels.reset(pixels);
+        const bool upscale = src.width < size && src.height < size;
+        resizedPixels = static_cast<unsigned char*>(stbir_resize(
+            src.pixels.get(), src.width, src.height, 0,
+            nullptr, size, size, 0,
+            STBIR_RGBA, STBIR_TYPE_UINT8_SRGB, STBIR_EDGE_WRAP,
+            upscale ? STBIR_FILTER_POINT_SAMPLE : STBIR_FILTER_DEFAULT));
     }
-
+    tex.pixels.reset(resizedPixels);
     return tex;
 }
 
@@ -166,18 +194,30 @@ bool BlockRegistry::loadBlocks(const std::string& directory, VulkanRenderer* ren
     std::vector<PendingBlock> pendingBlocks;
     int highestExplicitID = 0;
 
+    // PERFORMANCE (2025-11-28): Parse every file up front on all cores; ID assignment below
+    // stays sequential (same file order as before). Parsed documents are kept for the atlas
+    // builder, which used to parse every file a second time.
+    auto parseStart = std::chrono::steady_clock::now();
+    std::vector<AssetPipeline::ParsedYaml> parsedFiles = AssetPipeline::loadYamlFiles(yamlFiles);
+    double parseMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - parseStart).count();
+    Logger::info() << "BlockRegistry: Parsed " << parsedFiles.size() << " block files in " << parseMs << " ms";
+
+    std::vector<YAML::Node> docsByID;  // Source document per block ID (for the atlas)
+    auto keepDoc = [&docsByID](int id, const YAML::Node& doc) {
+        if (id >= static_cast<int>(docsByID.size())) docsByID.resize(id + 1);
+        docsByID[id] = doc;
+    };
+
     std::cout << "Loading blocks (Pass 1: Explicit IDs)..." << '\n';
 
     // PASS 1: Load all blocks with explicit IDs
-    for (const auto& path : yamlFiles) {
-        // Parse the YAML file
-        YAML::Node doc;
-        try {
-            doc = YAML::LoadFile(path.string());
-        } catch (const std::exception& e) {
-            std::cerr << "Error parsing YAML file " << path << ": " << e.what() << '\n';
+    for (const auto& parsed : parsedFiles) {
+        const fs::path& path = parsed.path;
+        if (!parsed.error.empty()) {
+            std::cerr << "Error parsing YAML file " << path << ": " << parsed.error << '\n';
             continue;
         }
+        YAML::Node doc = parsed.doc;
         if (!doc["name"]) {
             std::cerr << "YAML missing 'name' in " << path << '\n';
             continue;
@@ -215,6 +255,14 @@ bool BlockRegistry::loadBlocks(const std::string& directory, VulkanRenderer* ren
         if (doc["affected_by_gravity"]) {
             def.affectedByGravity = doc["affected_by_gravity"].as<bool>();
         }
+        // Optional: random ticks (BlockTickSystem samples a few blocks per chunk each tick)
+        if (doc["random_tick"]) {
+            def.randomTick = doc["random_tick"].as<bool>();
+        }
+        // Optional: smoothed by the surface-nets mesher in smooth terrain chunks
+        if (doc["smooth_terrain"]) {
+            def.smoothTerrain = doc["smooth_terrain"].as<bool>();
+        }
         // Optional: flammability, transparency, liquid
         if (doc["flammability"]) {
             def.flammability = doc["flammability"].as<int>();
@@ -318,6 +366,7 @@ bool BlockRegistry::loadBlocks(const std::string& directory, VulkanRenderer* ren
         m_defs[def.id] = def;
         m_nameToID[def.name] = def.id;
         std::cout << "  Loaded block: " << def.name << " (ID " << def.id << ")" << '\n';
+        keepDoc(def.id, doc);
 
         // Parse and register event handlers
         parseAndRegisterEventHandlers(def.id, def.name, doc);
@@ -347,6 +396,14 @@ bool BlockRegistry::loadBlocks(const std::string& directory, VulkanRenderer* ren
             if (doc["affected_by_gravity"]) {
                 def.affectedByGravity = doc["affected_by_gravity"].as<bool>();
             }
+            // Optional: random ticks (BlockTickSystem samples a few blocks per chunk each tick)
+            if (doc["random_tick"]) {
+                def.randomTick = doc["random_tick"].as<bool>();
+            }
+            // Optional: smoothed by the surface-nets mesher in smooth terrain chunks
+            if (doc["smooth_terrain"]) {
+                def.smoothTerrain = doc["smooth_terrain"].as<bool>();
+            }
             // Optional: flammability, transparency, liquid
             if (doc["flammability"]) {
                 def.flammability = doc["flammability"].as<int>();
@@ -438,6 +495,7 @@ bool BlockRegistry::loadBlocks(const std::string& directory, VulkanRenderer* ren
             m_defs[def.id] = def;
             m_nameToID[def.name] = def.id;
             std::cout << "  Loaded block: " << def.name << " (ID " << def.id << ", auto-assigned)" << '\n';
+            keepDoc(def.id, doc);
 
             // Parse and register event handlers
             parseAndRegisterEventHandlers(def.id, def.name, doc);
@@ -446,7 +504,8 @@ bool BlockRegistry::loadBlocks(const std::string& directory, VulkanRenderer* ren
 
     // Build texture atlas after all blocks are loaded
     if (renderer) {
-        buildTextureAtlas(renderer);
+        docsByID.resize(m_defs.size());
+        buildTextureAtlas(renderer, docsByID);
     }
 
     // PERFORMANCE (2025-11-25): Build cached list of emissive block IDs
@@ -464,6 +523,10 @@ bool BlockRegistry::loadBlocks(const std::string& directory, VulkanRenderer* ren
         std::cout << "  Found " << m_emissiveBlockIDs.size() << " emissive block types for lighting" << '\n';
     }
 
+    // PERFORMANCE (2025-11-28): Compile the flat property table used by meshing/lighting hot paths
+    // Must run after buildTextureAtlas() so face layers are clamped to the final layer count
+    m_properties.build(m_defs, m_layerCount);
+
     // Debug: Print final block registry state
     std::cout << "\nBlock Registry Summary:" << '\n';
     for (size_t i = 0; i < m_defs.size(); i++) {
@@ -506,65 +569,80 @@ bool BlockRegistry::loadBlocks(const std::string& directory, VulkanRenderer* ren
     return true;
 }
 
-void BlockRegistry::buildTextureAtlas(VulkanRenderer* renderer) {
-    std::cout << "Building texture atlas with cube map support..." << '\n';
+// ========== Baked Atlas (2025-11-28) ==========
+// Layout: AtlasBakeHeader | one loaded flag per unique texture | RGBA8 atlas pixels
 
-    // Map texture names to atlas indices to avoid duplicates
-    std::unordered_map<std::string, int> textureNameToAtlasIndex;
-    std::vector<LoadedTexture> textures;
-
-    // Helper to add a texture to the atlas if not already present
-    // animatedTiles: Number of tiles for animation (1=static, 2=2x2 grid=4 slots, etc.)
-    // Returns the starting atlas index
-    auto addTextureToAtlas = [&](const std::string& textureName, const std::string& blockName, int animatedTiles = 1) -> int {
-        // Check if already loaded
-        auto it = textureNameToAtlasIndex.find(textureName);
-        if (it != textureNameToAtlasIndex.end()) {
-            return it->second;
-        }
-
-        // Load the texture
-        std::string texturePath = "assets/blocks/" + textureName;
-        LoadedTexture tex = loadAndResizeTexture(texturePath, blockName + ":" + textureName);
+namespace {
 
-        if (!tex.pixels) {
-            std::cerr << "  Failed to load texture: " << textureName << '\n';
-            return -1;
-        }
+constexpr uint32_t ATLAS_BAKE_MAGIC = 0x4C544156;  // "VATL"
+constexpr uint32_t ATLAS_BAKE_VERSION = 1;         // Bump when decode/resize/layout rules change
+constexpr int ATLAS_TILE_SIZE = 64;
 
-        int atlasIndex = (int)textures.size();
-
-        // For animated textures, reserve multiple consecutive slots
-        if (animatedTiles > 1) {
-            int totalSlots = animatedTiles * animatedTiles;  // 2x2 = 4 slots, 3x3 = 9 slots
-            std::cout << "  Loaded texture: " << textureName << " (atlas index " << atlasIndex
-                      << ", " << animatedTiles << "x" << animatedTiles << " = " << totalSlots << " slots)" << '\n';
+struct AtlasBakeHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint64_t key;            ///< Hash of every face reference + source PNG contents
+    uint32_t textureCount;   ///< Unique textures (one loaded flag each)
+    uint32_t gridSize;
+    uint32_t atlasSize;      ///< Pixels per side
+    uint32_t padding;
+    uint64_t pixelBytes;
+};
 
-            // Add the same texture multiple times to reserve slots
-            for (int i = 0; i < totalSlots; i++) {
-                LoadedTexture texCopy;
-                texCopy.name = tex.name + "_tile" + std::to_string(i);
-                texCopy.width = tex.width;
-                texCopy.height = tex.height;
+// Texture array bake: LayerBakeHeader | layer-major RGBA8 mip chains (TextureArray layout)
+constexpr uint32_t LAYER_BAKE_MAGIC = 0x5259414C;  // "LAYR"
+constexpr uint32_t LAYER_BAKE_VERSION = 1;         // Bump when resize/mip rules change
+
+struct LayerBakeHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint64_t key;            ///< Hash of the layer sources (names + PNG contents)
+    uint32_t layerCount;
+    uint32_t layerSize;      ///< Level 0 edge in pixels
+    uint64_t pixelBytes;
+};
 
-                // Allocate new memory and copy pixels
-                size_t pixelDataSize = 64 * 64 * 4;  // RGBA
-                unsigned char* copiedPixels = (unsigned char*)malloc(pixelDataSize);
-                memcpy(copiedPixels, tex.pixels.get(), pixelDataSize);
-                texCopy.pixels.reset(copiedPixels);
+}  // namespace
 
-                textures.push_back(std::move(texCopy));
+void BlockRegistry::buildTextureAtlas(VulkanRenderer* renderer, const std::vector<YAML::Node>& docsByID) {
+    std::cout << "Building texture atlas with cube map support..." << '\n';
+    auto atlasStart = std::chrono::steady_clock::now();
+    m_atlasFromCache = false;
+
+    // PERFORMANCE (2025-11-28): The atlas is built in three steps so the expensive middle one
+    // (PNG decode + resize) can run on all cores, or be skipped entirely on a warm start:
+    //   1. Resolve which texture file every face uses (YAML only, no image I/O)
+    //   2. Hash the referenced files; on a bake hit map the baked atlas, else decode in parallel
+    //   3. Assign atlas slots in reference order (identical layout to the old sequential loader)
+
+    // One face's texture reference, in the order the sequential loader visited them
+    struct TextureRef {
+        BlockDefinition* def;
+        BlockDefinition::FaceTexture* face;
+        std::string filename;
+        float variation;
+        bool simpleMode;  // texture:/default PNG - hasTexture is only set if the load succeeds
+    };
+    std::vector<TextureRef> refs;
+
+    // Helper to parse texture string with optional variation: "texture.png,1.5"
+    auto parseTexture = [](const std::string& texString) -> std::pair<std::string, float> {
+        size_t commaPos = texString.find(',');
+        if (commaPos != std::string::npos) {
+            std::string filename = texString.substr(0, commaPos);
+            std::string variationStr = texString.substr(commaPos + 1);
+            try {
+                float variation = std::stof(variationStr);
+                return {filename, variation};
+            } catch (...) {
+                std::cerr << "Warning: Invalid variation value '" << variationStr << "', using 1.0" << '\n';
+                return {filename, 1.0f};
             }
-        } else {
-            textures.push_back(std::move(tex));  // Move unique_ptr ownership
-            std::cout << "  Loaded texture: " << textureName << " (atlas index " << atlasIndex << ")" << '\n';
         }
-
-        textureNameToAtlasIndex[textureName] = atlasIndex;
-        return atlasIndex;
+        return {texString, 1.0f};  // Default: no variation
     };
 
-    // First pass: Load all textures from YAML definitions
+    // ---- Step 1: Resolve face textures ----
     for (size_t i = 1; i < m_defs.size(); i++) {  // Skip air (index 0)
         BlockDefinition& def = m_defs[i];
 
@@ -573,17 +651,9 @@ void BlockRegistry::buildTextureAtlas(VulkanRenderer* renderer) {
             continue;
         }
 
-        // Re-parse YAML to get texture information using stored source file
-        if (def.sourceFile.empty()) {
-            std::cerr << "Error: No source file stored for " << def.name << '\n';
-            continue;
-        }
-
-        YAML::Node doc;
-        try {
-            doc = YAML::LoadFile(def.sourceFile);
-        } catch (const std::exception& e) {
-            std::cerr << "Error re-parsing YAML for " << def.name << " from " << def.sourceFile << ": " << e.what() << '\n';
+        YAML::Node doc = (i < docsByID.size()) ? docsByID[i] : YAML::Node();
+        if (!doc) {
+            std::cerr << "Error: No source document for " << def.name << '\n';
             continue;
         }
 
@@ -600,30 +670,12 @@ void BlockRegistry::buildTextureAtlas(VulkanRenderer* renderer) {
 
             YAML::Node cubeMap = doc["cube_map"];
 
-            // Helper to parse texture string with optional variation: "texture.png,1.5"
-            auto parseTexture = [](const std::string& texString) -> std::pair<std::string, float> {
-                size_t commaPos = texString.find(',');
-                if (commaPos != std::string::npos) {
-                    std::string filename = texString.substr(0, commaPos);
-                    std::string variationStr = texString.substr(commaPos + 1);
-                    try {
-                        float variation = std::stof(variationStr);
-                        return {filename, variation};
-                    } catch (...) {
-                        std::cerr << "Warning: Invalid variation value '" << variationStr << "', using 1.0" << '\n';
-                        return {filename, 1.0f};
-                    }
-                }
-                return {texString, 1.0f};  // Default: no variation
-            };
-
             // Collect all explicitly defined textures to detect single-texture mode
             std::vector<std::string> definedTextures;
             std::vector<std::string> faceNames = {"top", "bottom", "front", "back", "left", "right", "sides", "all"};
             for (const auto& faceName : faceNames) {
                 if (cubeMap[faceName]) {
                     std::string texString = cubeMap[faceName].as<std::string>();
-                    auto [filename, variation] = parseTexture(texString);
                     if (std::find(definedTextures.begin(), definedTextures.end(), texString) == definedTextures.end()) {
                         definedTextures.push_back(texString);
                     }
@@ -638,8 +690,8 @@ void BlockRegistry::buildTextureAtlas(VulkanRenderer* renderer) {
                 std::cout << "  Single texture detected for " << def.name << ", using '" << filename << "' (variation=" << variation << ") for all faces" << '\n';
             }
 
-            // Helper to load a face texture with smart fallback logic
-            auto loadFace = [&](const std::string& faceName, BlockDefinition::FaceTexture& face) {
+            // Helper to resolve a face texture with smart fallback logic
+            auto resolveFace = [&](const std::string& faceName, BlockDefinition::FaceTexture& face) {
                 std::string texString;
 
                 // Priority 1: Face-specific texture
@@ -662,26 +714,16 @@ void BlockRegistry::buildTextureAtlas(VulkanRenderer* renderer) {
                     return;
                 }
 
-                // Parse texture filename and variation
                 auto [filename, variation] = parseTexture(texString);
-
-                int atlasIndex = addTextureToAtlas(filename, def.name, def.animatedTiles);
-                if (atlasIndex >= 0) {
-                    // Atlas coordinates will be calculated after we know the grid size
-                    face.atlasX = atlasIndex;  // Temporarily store atlas index
-                    face.atlasY = 0;
-                    face.variation = variation;  // Store per-face variation
-                }
+                refs.push_back({&def, &face, filename, variation, false});
             };
 
-            loadFace("top", def.top);
-            loadFace("bottom", def.bottom);
-            loadFace("front", def.front);
-            loadFace("back", def.back);
-            loadFace("left", def.left);
-            loadFace("right", def.right);
-
-            std::cout << "  Loaded cube map for " << def.name << '\n';
+            resolveFace("top", def.top);
+            resolveFace("bottom", def.bottom);
+            resolveFace("front", def.front);
+            resolveFace("back", def.back);
+            resolveFace("left", def.left);
+            resolveFace("right", def.right);
         } else if (doc["texture"]) {
             // Simple texture mode (backwards compatibility)
             std::string texString = doc["texture"].as<std::string>();
@@ -691,89 +733,204 @@ void BlockRegistry::buildTextureAtlas(VulkanRenderer* renderer) {
                 continue;
             }
 
-            // Parse texture filename and variation
-            size_t commaPos = texString.find(',');
-            std::string filename = texString;
-            float variation = 1.0f;
-
-            if (commaPos != std::string::npos) {
-                filename = texString.substr(0, commaPos);
-                std::string variationStr = texString.substr(commaPos + 1);
-                try {
-                    variation = std::stof(variationStr);
-                } catch (...) {
-                    std::cerr << "Warning: Invalid variation value '" << variationStr << "', using 1.0" << '\n';
-                }
-            }
-
-            int atlasIndex = addTextureToAtlas(filename, def.name, def.animatedTiles);
-            if (atlasIndex >= 0) {
-                def.hasTexture = true;
-                def.useCubeMap = false;
-                // Store atlas index and variation temporarily
-                def.all.atlasX = atlasIndex;
-                def.all.atlasY = 0;
-                def.all.variation = variation;
-            }
+            auto [filename, variation] = parseTexture(texString);
+            refs.push_back({&def, &def.all, filename, variation, true});
         } else {
             // No texture or cube_map defined - try to load {blockname}.png automatically
             std::string defaultTexName = lowerName + ".png";
             std::cout << "  No texture defined for " << def.name << ", attempting to load " << defaultTexName << '\n';
+            refs.push_back({&def, &def.all, defaultTexName, 1.0f, true});
+        }
+    }
 
-            int atlasIndex = addTextureToAtlas(defaultTexName, def.name, def.animatedTiles);
-            if (atlasIndex >= 0) {
-                def.hasTexture = true;
-                def.useCubeMap = false;
-                def.all.atlasX = atlasIndex;
-                def.all.atlasY = 0;
-                def.all.variation = 1.0f;  // No variation by default
-                std::cout << "  Auto-loaded default texture for " << def.name << '\n';
-            }
+    // Unique files in first-reference order
+    std::vector<std::string> uniqueNames;
+    std::unordered_map<std::string, int> uniqueIndex;
+    for (const TextureRef& ref : refs) {
+        if (uniqueIndex.emplace(ref.filename, static_cast<int>(uniqueNames.size())).second) {
+            uniqueNames.push_back(ref.filename);
+        }
+    }
+    const size_t uniqueCount = uniqueNames.size();
+
+    // ---- Step 2: Hash sources, then map the bake or decode ----
+    std::vector<uint64_t> fileHashes(uniqueCount, 0);
+    std::vector<uint8_t> fileExists(uniqueCount, 0);
+    AssetPipeline::parallelFor(uniqueCount, [&](size_t u) {
+        bool exists = false;
+        fileHashes[u] = AssetPipeline::hashFile("assets/blocks/" + uniqueNames[u], &exists);
+        fileExists[u] = exists ? 1 : 0;
+    });
+
+    // The slot layout depends on every reference (order, animation tiles), the pixels on file contents
+    uint64_t bakeKey = AssetPipeline::hashBytes(&ATLAS_BAKE_VERSION, sizeof(ATLAS_BAKE_VERSION));
+    for (const TextureRef& ref : refs) {
+        bakeKey = AssetPipeline::hashString(ref.filename, bakeKey);
+        bakeKey = AssetPipeline::hashBytes(&ref.def->animatedTiles, sizeof(ref.def->animatedTiles), bakeKey);
+    }
+    bakeKey = AssetPipeline::hashBytes(fileHashes.data(), fileHashes.size() * sizeof(uint64_t), bakeKey);
+
+    const std::string bakePath = std::string(AssetPipeline::BAKE_DIRECTORY) + "/block_atlas.bin";
+    AssetPipeline::MappedFile bake;
+    AtlasBakeHeader bakeHeader{};
+    std::vector<uint8_t> loaded(uniqueCount, 0);
+    const unsigned char* bakedPixels = nullptr;
+
+    if (bake.open(bakePath) && bake.size() >= sizeof(AtlasBakeHeader)) {
+        std::memcpy(&bakeHeader, bake.data(), sizeof(bakeHeader));
+        const uint64_t expectedPixels = static_cast<uint64_t>(bakeHeader.atlasSize) * bakeHeader.atlasSize * 4;
+        if (bakeHeader.magic == ATLAS_BAKE_MAGIC && bakeHeader.version == ATLAS_BAKE_VERSION &&
+            bakeHeader.key == bakeKey && bakeHeader.textureCount == uniqueCount &&
+            bakeHeader.pixelBytes == expectedPixels &&
+            bake.size() == sizeof(bakeHeader) + uniqueCount + bakeHeader.pixelBytes) {
+            std::memcpy(loaded.data(), bake.data() + sizeof(bakeHeader), uniqueCount);
+            bakedPixels = bake.data() + sizeof(bakeHeader) + uniqueCount;
         }
     }
 
-    if (textures.empty()) {
+    // Sources are decoded at native size: the atlas and the texture array scale them separately
+    std::vector<LoadedTexture> decoded(uniqueCount);
+    bool sourcesDecoded = false;
+    auto decodeAll = [&]() {
+        AssetPipeline::parallelFor(uniqueCount, [&](size_t u) {
+            if (!fileExists[u]) return;
+            decoded[u] = loadTexture("assets/blocks/" + uniqueNames[u], uniqueNames[u]);
+            loaded[u] = decoded[u].pixels ? 1 : 0;
+        });
+        sourcesDecoded = true;
+    };
+    if (!bakedPixels) {
+        bake.close();
+        decodeAll();
+    }
+
+    // ---- Step 3: Assign atlas slots in reference order ----
+    // Animated textures reserve animatedTiles^2 consecutive slots (of the first referencing block)
+    std::vector<int> slotSource;  // Unique texture per atlas slot
+    std::unordered_map<std::string, int> textureNameToAtlasIndex;
+
+    auto addTextureToAtlas = [&](const TextureRef& ref) -> int {
+        auto it = textureNameToAtlasIndex.find(ref.filename);
+        if (it != textureNameToAtlasIndex.end()) {
+            return it->second;
+        }
+
+        const int u = uniqueIndex[ref.filename];
+        if (!loaded[u]) {
+            std::cerr << "  Failed to load texture: " << ref.filename << '\n';
+            return -1;
+        }
+
+        int atlasIndex = (int)slotSource.size();
+        int animatedTiles = ref.def->animatedTiles;
+        if (animatedTiles > 1) {
+            int totalSlots = animatedTiles * animatedTiles;  // 2x2 = 4 slots, 3x3 = 9 slots
+            slotSource.insert(slotSource.end(), totalSlots, u);
+            std::cout << "  Loaded texture: " << ref.filename << " (atlas index " << atlasIndex
+                      << ", " << animatedTiles << "x" << animatedTiles << " = " << totalSlots << " slots)" << '\n';
+        } else {
+            slotSource.push_back(u);
+            std::cout << "  Loaded texture: " << ref.filename << " (atlas index " << atlasIndex << ")" << '\n';
+        }
+
+        textureNameToAtlasIndex[ref.filename] = atlasIndex;
+        return atlasIndex;
+    };
+
+    // TEXTURE ARRAY (2025-11-28): One layer per loaded unique file, in the same reference order
+    std::vector<int> refSources(refs.size());
+    for (size_t i = 0; i < refs.size(); i++) {
+        refSources[i] = uniqueIndex[refs[i].filename];
+    }
+    const TextureArray::LayerPlan layerPlan = TextureArray::planLayers(refSources, loaded);
+    for (int source : layerPlan.droppedSources) {
+        std::cerr << "Error: texture array is full (" << TextureArray::MAX_LAYERS << " layers), "
+                  << uniqueNames[source] << " will be drawn with " << uniqueNames[layerPlan.layerSources[0]] << '\n';
+    }
+
+    for (size_t i = 0; i < refs.size(); i++) {
+        const TextureRef& ref = refs[i];
+        int atlasIndex = addTextureToAtlas(ref);
+        if (atlasIndex < 0) {
+            continue;
+        }
+        // Atlas coordinates will be calculated after we know the grid size
+        ref.face->atlasX = atlasIndex;  // Temporarily store atlas index
+        ref.face->atlasY = 0;
+        ref.face->layer = layerPlan.refLayers[i];
+        ref.face->variation = ref.variation;
+        if (ref.simpleMode) {
+            ref.def->hasTexture = true;
+            ref.def->useCubeMap = false;
+        }
+    }
+
+    if (slotSource.empty()) {
         std::cout << "No textures loaded, skipping atlas creation" << '\n';
         return;
     }
 
     // Calculate atlas grid size (round up to next power of 2)
-    int numTextures = (int)textures.size();
+    int numTextures = (int)slotSource.size();
     m_atlasGridSize = 1;
     while (m_atlasGridSize * m_atlasGridSize < numTextures) {
         m_atlasGridSize *= 2;
     }
 
-    int atlasSize = m_atlasGridSize * 64;  // Each slot is 64x64
+    int atlasSize = m_atlasGridSize * ATLAS_TILE_SIZE;  // Each slot is 64x64
     std::cout << "Atlas grid: " << m_atlasGridSize << "x" << m_atlasGridSize << " (" << atlasSize << "x" << atlasSize << " pixels, " << numTextures << " textures)" << '\n';
 
-    // Create atlas pixel data (RGBA)
-    size_t atlasDataSize = atlasSize * atlasSize * 4;
-    unsigned char* atlasPixels = (unsigned char*)calloc(atlasDataSize, 1);  // Initialize to zeros
-
-    // Copy textures into atlas
-    const int textureCount = static_cast<int>(textures.size());
-    for (int atlasIndex = 0; atlasIndex < textureCount; atlasIndex++) {
-        LoadedTexture& tex = textures[atlasIndex];
-
-        int atlasX = atlasIndex % m_atlasGridSize;
-        int atlasY = atlasIndex / m_atlasGridSize;
-
-        // Copy texture pixels into atlas
-        for (int y = 0; y < 64; y++) {
-            for (int x = 0; x < 64; x++) {
-                int srcIdx = (y * 64 + x) * 4;
-                int dstX = atlasX * 64 + x;
-                int dstY = atlasY * 64 + y;
-                int dstIdx = (dstY * atlasSize + dstX) * 4;
-
-                atlasPixels[dstIdx + 0] = tex.pixels.get()[srcIdx + 0];  // R
-                atlasPixels[dstIdx + 1] = tex.pixels.get()[srcIdx + 1];  // G
-                atlasPixels[dstIdx + 2] = tex.pixels.get()[srcIdx + 2];  // B
-                atlasPixels[dstIdx + 3] = tex.pixels.get()[srcIdx + 3];  // A
+    size_t atlasDataSize = static_cast<size_t>(atlasSize) * atlasSize * 4;
+
+    if (bakedPixels && (bakeHeader.gridSize != static_cast<uint32_t>(m_atlasGridSize) ||
+                        bakeHeader.atlasSize != static_cast<uint32_t>(atlasSize))) {
+        // Key matched but the layout didn't - never trust it, rebuild from sources
+        Logger::warning() << "Baked atlas layout mismatch, rebuilding";
+        bakedPixels = nullptr;
+        bake.close();
+        decodeAll();
+    }
+
+    std::vector<unsigned char> atlasPixels;
+    if (!bakedPixels) {
+        // Scale each source to one tile, then copy into the atlas (zero-initialized: unused slots stay transparent)
+        std::vector<LoadedTexture> tiles(uniqueCount);
+        AssetPipeline::parallelFor(uniqueCount, [&](size_t u) {
+            tiles[u] = resizeTexture(decoded[u], ATLAS_TILE_SIZE, false);
+        });
+
+        atlasPixels.assign(atlasDataSize, 0);
+        const size_t rowBytes = ATLAS_TILE_SIZE * 4;
+        AssetPipeline::parallelFor(slotSource.size(), [&](size_t atlasIndex) {
+            const LoadedTexture& tex = tiles[slotSource[atlasIndex]];
+            if (!tex.pixels) return;
+
+            int atlasX = static_cast<int>(atlasIndex) % m_atlasGridSize;
+            int atlasY = static_cast<int>(atlasIndex) / m_atlasGridSize;
+            for (int y = 0; y < ATLAS_TILE_SIZE; y++) {
+                size_t dstIdx = ((static_cast<size_t>(atlasY) * ATLAS_TILE_SIZE + y) * atlasSize + atlasX * ATLAS_TILE_SIZE) * 4;
+                std::memcpy(&atlasPixels[dstIdx], tex.pixels.get() + y * rowBytes, rowBytes);
             }
+        });
+        tiles.clear();  // Texture memory freed by unique_ptr destructors
+
+        // Bake for the next start
+        AtlasBakeHeader header{};
+        header.magic = ATLAS_BAKE_MAGIC;
+        header.version = ATLAS_BAKE_VERSION;
+        header.key = bakeKey;
+        header.textureCount = static_cast<uint32_t>(uniqueCount);
+        header.gridSize = static_cast<uint32_t>(m_atlasGridSize);
+        header.atlasSize = static_cast<uint32_t>(atlasSize);
+        header.pixelBytes = atlasDataSize;
+        if (!AssetPipeline::writeFileAtomic(bakePath, {{&header, sizeof(header)},
+                                                       {loaded.data(), loaded.size()},
+                                                       {atlasPixels.data(), atlasPixels.size()}})) {
+            Logger::warning() << "Failed to write baked atlas: " << bakePath;
         }
     }
+    m_atlasFromCache = bakedPixels != nullptr;
+    const unsigned char* srcPixels = bakedPixels ? bakedPixels : atlasPixels.data();
 
     // Second pass: Convert atlas indices to atlas grid coordinates
     for (size_t i = 1; i < m_defs.size(); i++) {
@@ -805,8 +962,6 @@ void BlockRegistry::buildTextureAtlas(VulkanRenderer* renderer) {
 
     }
 
-    // Texture memory automatically freed by unique_ptr destructors
-
     // Upload atlas to GPU
     VkDeviceSize imageSize = atlasDataSize;
 
@@ -817,12 +972,15 @@ void BlockRegistry::buildTextureAtlas(VulkanRenderer* renderer) {
                           VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
                           stagingBuffer, stagingBufferMemory);
 
+    // Warm start: straight from the mapped bake into staging memory
     void* data;
     vkMapMemory(renderer->getDevice(), stagingBufferMemory, 0, imageSize, 0, &data);
-    memcpy(data, atlasPixels, atlasDataSize);
+    memcpy(data, srcPixels, atlasDataSize);
     vkUnmapMemory(renderer->getDevice(), stagingBufferMemory);
 
-    free(atlasPixels);  // Free CPU atlas memory
+    // Free CPU atlas memory
+    atlasPixels = std::vector<unsigned char>();
+    bake.close();
 
     // Create Vulkan image
     renderer->createImage(atlasSize, atlasSize, VK_FORMAT_R8G8B8A8_SRGB, VK_IMAGE_TILING_OPTIMAL,
@@ -845,7 +1003,145 @@ void BlockRegistry::buildTextureAtlas(VulkanRenderer* renderer) {
     m_atlasImageView = renderer->createImageView(m_atlasImage, VK_FORMAT_R8G8B8A8_SRGB, VK_IMAGE_ASPECT_COLOR_BIT);
     m_atlasSampler = renderer->createTextureSampler();
 
-    std::cout << "Texture atlas created successfully!" << '\n';
+    // ---- Step 4: Texture array layers with offline mip chains ----
+    // Baked separately (cache/block_layers.bin) so either blob can be rebuilt on its own
+    const int layerCount = static_cast<int>(layerPlan.layerSources.size());
+    uint64_t layerKey = AssetPipeline::hashBytes(&LAYER_BAKE_VERSION, sizeof(LAYER_BAKE_VERSION));
+    for (int source : layerPlan.layerSources) {
+        layerKey = AssetPipeline::hashString(uniqueNames[source], layerKey);
+        layerKey = AssetPipeline::hashBytes(&fileHashes[source], sizeof(uint64_t), layerKey);
+    }
+
+    const std::string layerBakePath = std::string(AssetPipeline::BAKE_DIRECTORY) + "/block_layers.bin";
+    AssetPipeline::MappedFile layerBake;
+    LayerBakeHeader layerHeader{};
+    const uint8_t* bakedLayers = nullptr;
+    if (layerBake.open(layerBakePath) && layerBake.size() >= sizeof(LayerBakeHeader)) {
+        std::memcpy(&layerHeader, layerBake.data(), sizeof(layerHeader));
+        const int bakedSize = static_cast<int>(layerHeader.layerSize);
+        if (layerHeader.magic == LAYER_BAKE_MAGIC && layerHeader.version == LAYER_BAKE_VERSION &&
+            layerHeader.key == layerKey && layerHeader.layerCount == static_cast<uint32_t>(layerCount) &&
+            bakedSize >= TextureArray::LAYER_SIZE_MIN && bakedSize <= TextureArray::LAYER_SIZE_MAX &&
+            layerHeader.pixelBytes == layerCount * TextureArray::layerBytes(bakedSize) &&
+            layerBake.size() == sizeof(layerHeader) + layerHeader.pixelBytes) {
+            bakedLayers = layerBake.data() + sizeof(layerHeader);
+        }
+    }
+
+    int layerSize = static_cast<int>(layerHeader.layerSize);
+    std::vector<uint8_t> layerPixels;
+    if (!bakedLayers) {
+        layerBake.close();
+        if (!sourcesDecoded) {
+            decodeAll();
+        }
+
+        std::vector<int> sourceEdges;
+        for (int source : layerPlan.layerSources) {
+            sourceEdges.push_back(std::max(decoded[source].width, decoded[source].height));
+        }
+        layerSize = TextureArray::chooseLayerSize(sourceEdges);
+
+        const size_t bytesPerLayer = TextureArray::layerBytes(layerSize);
+        layerPixels.assign(layerCount * bytesPerLayer, 0);
+        AssetPipeline::parallelFor(static_cast<size_t>(layerCount), [&](size_t layer) {
+            LoadedTexture tile = resizeTexture(decoded[layerPlan.layerSources[layer]], layerSize, true);
+            if (!tile.pixels) return;
+            uint8_t* chain = &layerPixels[layer * bytesPerLayer];
+            std::memcpy(chain, tile.pixels.get(), static_cast<size_t>(layerSize) * layerSize * 4);
+            TextureArray::buildMipChain(chain, layerSize);
+        });
+
+        LayerBakeHeader header{};
+        header.magic = LAYER_BAKE_MAGIC;
+        header.version = LAYER_BAKE_VERSION;
+        header.key = layerKey;
+        header.layerCount = static_cast<uint32_t>(layerCount);
+        header.layerSize = static_cast<uint32_t>(layerSize);
+        header.pixelBytes = layerPixels.size();
+        if (!AssetPipeline::writeFileAtomic(layerBakePath, {{&header, sizeof(header)},
+                                                            {layerPixels.data(), layerPixels.size()}})) {
+            Logger::warning() << "Failed to write baked texture layers: " << layerBakePath;
+        }
+    }
+    decoded.clear();  // Texture memory freed by unique_ptr destructors
+
+    if (layerCount > 0) {
+        uploadTextureArray(renderer, bakedLayers ? bakedLayers : layerPixels.data(), layerSize, layerCount);
+        Logger::info() << "Texture array: " << layerCount << " layers of " << layerSize << "x" << layerSize
+                       << " (" << TextureArray::mipLevelCount(layerSize) << " mip levels, "
+                       << (bakedLayers ? "baked" : "rebuilt") << ")";
+    } else {
+        // Vulkan rejects 0-layer images: the view stays VK_NULL_HANDLE, so the
+        // renderer keeps its 1-layer default array bound
+        Logger::warning() << "Texture array: no block textures, keeping the default array";
+    }
+    layerBake.close();
+
+    double atlasMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - atlasStart).count();
+    if (m_atlasFromCache) {
+        Logger::info() << "Texture atlas created in " << atlasMs << " ms (warm: baked atlas, "
+                       << uniqueCount << " sources hashed, " << (sourcesDecoded ? uniqueCount : 0) << " decoded)";
+    } else {
+        Logger::info() << "Texture atlas created in " << atlasMs << " ms (cold: " << uniqueCount
+                       << " textures decoded in parallel, baked to " << bakePath << ")";
+    }
+}
+
+void BlockRegistry::uploadTextureArray(VulkanRenderer* renderer, const uint8_t* pixels, int layerSize, int layerCount) {
+    const uint32_t mipLevels = static_cast<uint32_t>(TextureArray::mipLevelCount(layerSize));
+    const size_t bytesPerLayer = TextureArray::layerBytes(layerSize);
+    VkDeviceSize imageSize = bytesPerLayer * layerCount;
+
+    // Create staging buffer
+    VkBuffer stagingBuffer;
+    VkDeviceMemory stagingBufferMemory;
+    renderer->createBuffer(imageSize, VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+                          VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+                          stagingBuffer, stagingBufferMemory);
+
+    void* data;
+    vkMapMemory(renderer->getDevice(), stagingBufferMemory, 0, imageSize, 0, &data);
+    memcpy(data, pixels, static_cast<size_t>(imageSize));
+    vkUnmapMemory(renderer->getDevice(), stagingBufferMemory);
+
+    // One copy region per (layer, mip level), all in a single submit
+    std::vector<VkBufferImageCopy> regions;
+    regions.reserve(static_cast<size_t>(layerCount) * mipLevels);
+    for (int layer = 0; layer < layerCount; layer++) {
+        for (uint32_t level = 0; level < mipLevels; level++) {
+            const uint32_t edge = static_cast<uint32_t>(std::max(1, layerSize >> level));
+            VkBufferImageCopy region{};
+            region.bufferOffset = layer * bytesPerLayer + TextureArray::mipOffset(layerSize, static_cast<int>(level));
+            region.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+            region.imageSubresource.mipLevel = level;
+            region.imageSubresource.baseArrayLayer = static_cast<uint32_t>(layer);
+            region.imageSubresource.layerCount = 1;
+            region.imageExtent = {edge, edge, 1};
+            regions.push_back(region);
+        }
+    }
+
+    renderer->createImage(layerSize, layerSize, mipLevels, static_cast<uint32_t>(layerCount),
+                         VK_FORMAT_R8G8B8A8_SRGB, VK_IMAGE_TILING_OPTIMAL,
+                         VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT,
+                         VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
+                         m_layerImage, m_layerMemory);
+    renderer->transitionImageLayout(m_layerImage, VK_FORMAT_R8G8B8A8_SRGB,
+                                   VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+                                   mipLevels, static_cast<uint32_t>(layerCount));
+    renderer->copyBufferToImage(stagingBuffer, m_layerImage, regions);
+    renderer->transitionImageLayout(m_layerImage, VK_FORMAT_R8G8B8A8_SRGB,
+                                   VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+                                   mipLevels, static_cast<uint32_t>(layerCount));
+
+    vkDestroyBuffer(renderer->getDevice(), stagingBuffer, nullptr);
+    vkFreeMemory(renderer->getDevice(), stagingBufferMemory, nullptr);
+
+    m_layerImageView = renderer->createArrayImageView(m_layerImage, VK_FORMAT_R8G8B8A8_SRGB,
+                                                      mipLevels, static_cast<uint32_t>(layerCount));
+    m_layerSampler = renderer->createMipmappedSampler(mipLevels);
+    m_layerCount = layerCount;
 }
 
 const BlockDefinition& BlockRegistry::get(int id) const {
@@ -0,0 +1,383 @@
+/**
+ * @file block_tick_system.cpp
+ * @brief Scheduled and random block tick processing
+ *
+ * Created: 2025-11-28
+ */
+
+#include "block_tick_system.h"
+#include "world.h"
+#include "world_utils.h"
+#include "chunk.h"
+#include "block_system.h"
+#include "lighting_system.h"
+#include "water_simulation.h"
+#include "event_dispatcher.h"
+#include "event_types.h"
+#include "vulkan_renderer.h"
+#include "world_streaming.h"
+#include "profiler.h"
+#include "logger.h"
+#include <algorithm>
+#include <stdexcept>
+
+namespace {
+
+constexpr size_t PARALLEL_CHUNK_THRESHOLD = 16;   ///< Fewer active chunks run on the main thread
+constexpr size_t CHUNKS_PER_BATCH = 8;            ///< Chunks claimed per atomic increment
+
+/// Per-chunk, per-tick random tick seed (stable across runs for the same world state)
+uint64_t randomTickSeed(const Chunk* chunk, uint64_t tick) {
+    uint64_t h = static_cast<uint64_t>(static_cast<uint32_t>(chunk->getChunkX())) * 0x9E3779B97F4A7C15ull
+               ^ static_cast<uint64_t>(static_cast<uint32_t>(chunk->getChunkY())) * 0xC2B2AE3D27D4EB4Full
+               ^ static_cast<uint64_t>(static_cast<uint32_t>(chunk->getChunkZ())) * 0x165667B19E3779F9ull
+               ^ tick;
+    return h ? h : 1;  // xorshift state must be non-zero
+}
+
+uint64_t xorshift64(uint64_t& state) {
+    state ^= state << 13;
+    state ^= state >> 7;
+    state ^= state << 17;
+    return state;
+}
+
+/// Gravity blocks fall into air and displace liquids
+bool canFallInto(int blockID, const BlockPropertyTable& props) {
+    return blockID == 0 || props.isLiquid(blockID);
+}
+
+}  // namespace
+
+BlockTickSystem::BlockTickSystem(World* world)
+    : m_world(world) {
+    if (!m_world) {
+        throw std::runtime_error("BlockTickSystem: World pointer cannot be null");
+    }
+}
+
+BlockTickSystem::~BlockTickSystem() {
+    {
+        std::lock_guard<std::mutex> lock(m_jobMutex);
+        m_shuttingDown = true;
+    }
+    m_jobCV.notify_all();
+    for (std::thread& worker : m_workers) {
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+}
+
+bool BlockTickSystem::scheduleTick(const glm::ivec3& pos, int blockID, uint32_t delayTicks) {
+    auto coords = worldToBlockCoords(static_cast<float>(pos.x), static_cast<float>(pos.y), static_cast<float>(pos.z));
+    Chunk* chunk = m_world->getChunkAt(coords.chunkX, coords.chunkY, coords.chunkZ);
+    if (chunk == nullptr) {
+        return false;
+    }
+    return chunk->scheduleTick(coords.localX, coords.localY, coords.localZ, blockID, delayTicks);
+}
+
+void BlockTickSystem::onBlockChanged(const glm::ivec3& pos) {
+    const BlockPropertyTable& props = BlockRegistry::instance().properties();
+
+    // The changed block itself (sand placed in mid-air) and whatever it was supporting
+    for (const glm::ivec3& p : {pos, pos + glm::ivec3(0, 1, 0)}) {
+        int blockID = m_world->getBlockAt(static_cast<float>(p.x), static_cast<float>(p.y), static_cast<float>(p.z));
+        if (props.hasGravity(blockID)) {
+            scheduleTick(p, blockID, FALL_DELAY);
+        }
+    }
+}
+
+// ========== Update ==========
+
+void BlockTickSystem::update(float deltaTime, VulkanRenderer* renderer, WorldStreaming* streaming) {
+    PROFILE_ZONE("block_ticks");
+
+    m_accumulator += deltaTime;
+    const float tickInterval = 1.0f / TICKS_PER_SECOND;
+
+    int ticks = 0;
+    while (m_accumulator >= tickInterval && ticks < MAX_TICKS_PER_FRAME) {
+        m_accumulator -= tickInterval;
+        ticks++;
+    }
+    if (ticks == MAX_TICKS_PER_FRAME) {
+        m_accumulator = 0.0f;  // Drop the backlog after a hitch instead of spiraling
+    }
+    if (ticks == 0) {
+        return;
+    }
+
+    // Chunks touched by any tick this frame are re-meshed once at the end
+    std::unordered_set<Chunk*> dirtyChunks;
+    for (int i = 0; i < ticks; i++) {
+        runTick(dirtyChunks);
+    }
+
+    // Re-mesh on the streaming mesh workers (same pipeline as decorated chunks)
+    if (streaming && streaming->isActive()) {
+        for (Chunk* chunk : dirtyChunks) {
+            streaming->queueChunkForMeshing(chunk->getChunkX(), chunk->getChunkY(), chunk->getChunkZ());
+        }
+        return;
+    }
+
+    // Fallback: sync path if no streaming system available
+    for (Chunk* chunk : dirtyChunks) {
+        try {
+            chunk->generateMesh(m_world);
+            if (renderer) {
+                renderer->beginAsyncChunkUpload();
+                chunk->createVertexBufferBatched(renderer);
+                renderer->submitAsyncChunkUpload(chunk);
+            }
+        } catch (const std::exception& e) {
+            Logger::error() << "Failed to update chunk after block tick: " << e.what();
+        }
+    }
+}
+
+void BlockTickSystem::runTick(std::unordered_set<Chunk*>& dirtyChunks) {
+    const BlockPropertyTable& props = BlockRegistry::instance().properties();
+    const bool randomTicks = props.anyRandomTick();
+
+    // Only chunks with pending ticks or random-tick blocks have work (O(1) per chunk via the brick mask)
+    const ShardedChunkMap::Snapshot chunkSnapshot = m_world->getChunks();
+    std::vector<Chunk*> active;
+    for (Chunk* chunk : *chunkSnapshot) {
+        if (chunk->hasPendingTicks() || (randomTicks && chunk->getBricks().randomTick() != 0)) {
+            active.push_back(chunk);
+        }
+    }
+
+    m_tickCount++;
+    m_lastActiveChunks = active.size();
+    m_lastUpdateCount = 0;
+    if (active.empty()) {
+        return;
+    }
+
+    // ===== Collect (read-only on the world, parallel by chunk) =====
+    std::vector<ChunkTickResult> results(active.size());
+
+    if (active.size() < PARALLEL_CHUNK_THRESHOLD) {
+        std::vector<ScheduledTick> due;
+        for (size_t i = 0; i < active.size(); i++) {
+            collectChunk(active[i], randomTicks, due, results[i]);
+        }
+    } else {
+        if (m_workers.empty()) {
+            startWorkers();
+        }
+
+        // Chunks are only removed on the main thread, which waits here, so the pointers stay valid
+        {
+            std::lock_guard<std::mutex> lock(m_jobMutex);
+            m_jobChunks = &active;
+            m_jobResults = &results;
+            m_jobRandomTicks = randomTicks;
+            m_jobNext.store(0, std::memory_order_relaxed);
+            m_workersBusy = m_workers.size();
+            m_jobGeneration++;
+        }
+        m_jobCV.notify_all();
+
+        collectBatches();  // The main thread claims batches too
+
+        std::unique_lock<std::mutex> lock(m_jobMutex);
+        m_doneCV.wait(lock, [this]() { return m_workersBusy == 0; });
+        m_jobChunks = nullptr;
+        m_jobResults = nullptr;
+    }
+
+    // ===== Apply (main thread) =====
+    applyResults(results, dirtyChunks);
+}
+
+// ========== Collect Workers ==========
+
+void BlockTickSystem::startWorkers() {
+    unsigned int numThreads = std::thread::hardware_concurrency();
+    if (numThreads == 0) {
+        numThreads = 4;  // hardware_concurrency() can return 0 in containers
+    }
+    const unsigned int workerCount = std::max(1u, std::min(numThreads - 1, MAX_WORKERS));
+
+    m_workers.reserve(workerCount);
+    for (unsigned int i = 0; i < workerCount; i++) {
+        m_workers.emplace_back(&BlockTickSystem::workerThreadFunction, this);
+    }
+    Logger::debug() << "Block tick system started " << workerCount << " collect workers";
+}
+
+void BlockTickSystem::workerThreadFunction() {
+    Profiler::setThreadName("Block Tick Worker");
+
+    uint64_t lastGeneration = 0;
+    while (true) {
+        // Wait for the next parallel collect (or shutdown)
+        {
+            std::unique_lock<std::mutex> lock(m_jobMutex);
+            m_jobCV.wait(lock, [this, lastGeneration]() {
+                return m_shuttingDown || m_jobGeneration != lastGeneration;
+            });
+            if (m_shuttingDown) {
+                break;
+            }
+            lastGeneration = m_jobGeneration;
+        }
+
+        collectBatches();
+
+        {
+            std::lock_guard<std::mutex> lock(m_jobMutex);
+            if (--m_workersBusy == 0) {
+                m_doneCV.notify_one();
+            }
+        }
+    }
+}
+
+void BlockTickSystem::collectBatches() {
+    const std::vector<Chunk*>& chunks = *m_jobChunks;
+    std::vector<ChunkTickResult>& results = *m_jobResults;
+    std::vector<ScheduledTick> due;
+
+    for (size_t start = m_jobNext.fetch_add(CHUNKS_PER_BATCH); start < chunks.size();
+         start = m_jobNext.fetch_add(CHUNKS_PER_BATCH)) {
+        const size_t end = std::min(start + CHUNKS_PER_BATCH, chunks.size());
+        for (size_t i = start; i < end; i++) {
+            try {
+                collectChunk(chunks[i], m_jobRandomTicks, due, results[i]);
+            } catch (const std::exception& e) {
+                Logger::error() << "Block tick collect failed for chunk (" << chunks[i]->getChunkX() << ", "
+                                << chunks[i]->getChunkY() << ", " << chunks[i]->getChunkZ() << "): " << e.what();
+            }
+        }
+    }
+}
+
+// ========== Collect / Apply ==========
+
+void BlockTickSystem::collectChunk(Chunk* chunk, bool randomTicks, std::vector<ScheduledTick>& due,
+                                   ChunkTickResult& result) const {
+    const BlockPropertyTable& props = BlockRegistry::instance().properties();
+    const glm::ivec3 origin(chunk->getChunkX() * Chunk::WIDTH,
+                            chunk->getChunkY() * Chunk::HEIGHT,
+                            chunk->getChunkZ() * Chunk::DEPTH);
+
+    // Scheduled ticks
+    due.clear();
+    if (chunk->hasPendingTicks()) {
+        chunk->advanceTicks(due);
+    }
+    for (const ScheduledTick& tick : due) {
+        const glm::ivec3 local = Chunk::tickLocalPos(tick.localIndex);
+        if (chunk->getBlock(local.x, local.y, local.z) != tick.blockID) {
+            continue;  // Block changed since the tick was scheduled
+        }
+
+        const glm::ivec3 worldPos = origin + local;
+        if (props.hasGravity(tick.blockID)) {
+            const glm::ivec3 below = worldPos - glm::ivec3(0, 1, 0);
+            int belowID = local.y > 0
+                ? chunk->getBlock(local.x, local.y - 1, local.z)
+                : m_world->getBlockAt(static_cast<float>(below.x), static_cast<float>(below.y), static_cast<float>(below.z));
+            if (canFallInto(belowID, props)) {
+                result.moves.push_back({worldPos, below, tick.blockID});
+            }
+            continue;
+        }
+        result.updates.emplace_back(worldPos, tick.blockID);
+    }
+
+    // Random ticks: samples landing in bricks without random-tick blocks are skipped unread
+    const uint64_t randomBricks = randomTicks ? chunk->getBricks().randomTick() : 0;
+    if (randomBricks != 0) {
+        uint64_t rng = randomTickSeed(chunk, m_tickCount);
+        for (int i = 0; i < RANDOM_TICKS_PER_CHUNK; i++) {
+            const uint16_t index = static_cast<uint16_t>(xorshift64(rng) % (Chunk::WIDTH * Chunk::HEIGHT * Chunk::DEPTH));
+            const glm::ivec3 local = Chunk::tickLocalPos(index);
+            if (!(randomBricks & ChunkBricks::bit(ChunkBricks::indexOf(local.x, local.y, local.z)))) {
+                continue;
+            }
+            int blockID = chunk->getBlock(local.x, local.y, local.z);
+            if (props.hasRandomTick(blockID)) {
+                result.updates.emplace_back(origin + local, blockID);
+            }
+        }
+    }
+}
+
+void BlockTickSystem::applyResults(std::vector<ChunkTickResult>& results, std::unordered_set<Chunk*>& dirtyChunks) {
+    const BlockPropertyTable& props = BlockRegistry::instance().properties();
+
+    std::vector<BlockMove> moves;
+    for (ChunkTickResult& result : results) {
+        moves.insert(moves.end(), result.moves.begin(), result.moves.end());
+    }
+
+    // Lowest first, so a falling column moves as a unit instead of colliding with itself
+    std::sort(moves.begin(), moves.end(), [](const BlockMove& a, const BlockMove& b) {
+        return a.from.y < b.from.y;
+    });
+
+    LightingSystem* lighting = m_world->getLightingSystem();
+    size_t updateCount = 0;
+    for (const BlockMove& move : moves) {
+        // Re-validate: an earlier move (or the player) may have changed either cell
+        const glm::vec3 from(move.from);
+        const glm::vec3 to(move.to);
+        if (m_world->getBlockAt(from.x, from.y, from.z) != move.blockID ||
+            m_world->getChunkAtWorldPos(to.x, to.y, to.z) == nullptr) {
+            continue;  // Never fall into unloaded chunks - the block would vanish
+        }
+        int targetID = m_world->getBlockAt(to.x, to.y, to.z);
+        if (!canFallInto(targetID, props)) {
+            continue;
+        }
+
+        if (props.isLiquid(targetID)) {
+            m_world->getWaterSimulation()->setWaterLevel(move.to.x, move.to.y, move.to.z, 0, 0);
+            m_world->setBlockMetadataAt(to.x, to.y, to.z, 0);
+        }
+        m_world->setBlockAt(to.x, to.y, to.z, move.blockID, false);
+        m_world->setBlockAt(from.x, from.y, from.z, 0, false);
+        markDirty(move.from, dirtyChunks);
+        markDirty(move.to, dirtyChunks);
+        updateCount++;
+
+        if (lighting && props.isOpaque(move.blockID)) {
+            lighting->onBlockChanged(move.from, true, false);
+            lighting->onBlockChanged(move.to, props.isOpaque(targetID), true);
+        }
+
+        // Keep falling, and let whatever rested on top follow
+        scheduleTick(move.to, move.blockID, FALL_DELAY);
+        onBlockChanged(move.from);
+    }
+
+    auto& dispatcher = EventDispatcher::instance();
+    for (ChunkTickResult& result : results) {
+        for (const auto& [pos, blockID] : result.updates) {
+            dispatcher.dispatch(std::make_unique<BlockUpdateEvent>(pos, blockID));
+        }
+        updateCount += result.updates.size();
+    }
+    m_lastUpdateCount = updateCount;
+}
+
+void BlockTickSystem::markDirty(const glm::ivec3& pos, std::unordered_set<Chunk*>& dirtyChunks) {
+    // The owning chunk plus any neighbor whose border faces see this block
+    static const glm::ivec3 offsets[7] = {
+        {0, 0, 0}, {1, 0, 0}, {-1, 0, 0}, {0, 1, 0}, {0, -1, 0}, {0, 0, 1}, {0, 0, -1}
+    };
+    for (const glm::ivec3& offset : offsets) {
+        const glm::vec3 p(pos + offset);
+        if (Chunk* chunk = m_world->getChunkAtWorldPos(p.x, p.y, p.z)) {
+            dirtyChunks.insert(chunk);
+        }
+    }
+}
@@ -10,12 +10,18 @@
  */
 
 #include "chunk.h"
+#include "profiler.h"
 #include "chunk_face_config.h"
+#include "chunk_lod.h"
+#include "chunk_smooth.h"
+#include "chunk_trace.h"
 #include "world.h"
 #include "vulkan_renderer.h"
 #include "block_system.h"
 #include "terrain_constants.h"
 #include "mesh_buffer_pool.h"
+#include "quad_index.h"
+#include "structure_template.h"
 #include "logger.h"
 #include "debug_state.h"
 #include <glm/gtc/matrix_transform.hpp>
@@ -26,6 +32,7 @@
 #include <sstream>
 #include <filesystem>
 #include <cmath>
+#include <cstring>
 
 // Static member initialization
 std::unique_ptr<FastNoiseLite> Chunk::s_noise = nullptr;
@@ -47,6 +54,12 @@ void Chunk::cleanupNoise() {
     s_noise.reset();  // Automatic cleanup with unique_ptr
 }
 
+std::atomic<UploadArena*> Chunk::s_uploadArena{nullptr};
+
+void Chunk::setUploadArena(UploadArena* arena) {
+    s_uploadArena.store(arena, std::memory_order_release);
+}
+
 // Note: Vertex::getBindingDescription() and Vertex::getAttributeDescriptions()
 // are now defined as inline functions in chunk.h
 
@@ -54,31 +67,21 @@ Chunk::Chunk(int x, int y, int z)
     : m_x(x), m_y(y), m_z(z),
       m_vertexBuffer(VK_NULL_HANDLE),
       m_vertexBufferMemory(VK_NULL_HANDLE),
-      m_indexBuffer(VK_NULL_HANDLE),
-      m_indexBufferMemory(VK_NULL_HANDLE),
       m_vertexCount(0),
       m_indexCount(0),
       m_transparentVertexBuffer(VK_NULL_HANDLE),
       m_transparentVertexBufferMemory(VK_NULL_HANDLE),
-      m_transparentIndexBuffer(VK_NULL_HANDLE),
-      m_transparentIndexBufferMemory(VK_NULL_HANDLE),
       m_transparentVertexCount(0),
       m_transparentIndexCount(0),
       m_vertexStagingBuffer(VK_NULL_HANDLE),
       m_vertexStagingBufferMemory(VK_NULL_HANDLE),
-      m_indexStagingBuffer(VK_NULL_HANDLE),
-      m_indexStagingBufferMemory(VK_NULL_HANDLE),
       m_transparentVertexStagingBuffer(VK_NULL_HANDLE),
       m_transparentVertexStagingBufferMemory(VK_NULL_HANDLE),
-      m_transparentIndexStagingBuffer(VK_NULL_HANDLE),
-      m_transparentIndexStagingBufferMemory(VK_NULL_HANDLE),
       m_visible(false),
       m_lightingDirty(false),
       m_needsDecoration(false),
       m_hasLightingData(false),
-      m_terrainReady(false),  // MULTI-STAGE GENERATION: Start false, set true after terrain generation
-      m_isEmpty(true),      // PERFORMANCE: Start empty (all air)
-      m_isEmptyValid(true)  // Cache is valid initially
+      m_terrainReady(false)  // MULTI-STAGE GENERATION: Start false, set true after terrain generation
 {
 
     // Initialize all blocks to air, metadata to 0, and lighting to darkness
@@ -89,10 +92,6 @@ Chunk::Chunk(int x, int y, int z)
     // Initialize all light data to 0 (complete darkness)
     m_lightData.fill(BlockLight(0, 0));
 
-    // MEMORY OPTIMIZATION (2025-11-25): Interpolated lighting is lazy-allocated
-    // Don't allocate here - will be allocated on first use (saves 256KB per cached chunk)
-    m_interpolatedLightData = nullptr;
-
     // BUG FIX: Initialize heightmap to -1 (indicates all air columns)
     // Without this, heightmap contains garbage memory causing incorrect lighting
     m_heightMap.fill(-1);
@@ -113,6 +112,7 @@ Chunk::Chunk(int x, int y, int z)
 
 Chunk::~Chunk() {
     // Note: Vulkan buffers must be destroyed via destroyBuffers() before destruction
+    releaseArenaMesh();
 }
 
 /**
@@ -135,14 +135,24 @@ void Chunk::reset(int x, int y, int z) {
 
     // Reset lighting to darkness
     m_lightData.fill(BlockLight(0, 0));
-    // MEMORY OPTIMIZATION (2025-11-25): Deallocate interpolated lighting on reset
-    m_interpolatedLightData = nullptr;
+    // Light transitions start over at the new position (no fade-in on first mesh)
+    m_meshedBlockLight.reset();
+    m_hasMeshedLight = false;
+    m_lightTransitionPending = false;
+    m_lightTransitionStart = std::chrono::steady_clock::time_point{};
     m_lightingDirty = false;
 
     // BUG FIX: Reset heightmap to -1 (all air)
     // Without this, recycled chunks use stale heightmap from previous location
     m_heightMap.fill(-1);
 
+    // Pending ticks belonged to the previous position
+    {
+        std::lock_guard<std::mutex> lock(m_tickMutex);
+        m_tickWheel.clear();
+        m_pendingTickCount.store(0, std::memory_order_relaxed);
+    }
+
     // Recalculate bounds
     float worldX = m_x * WIDTH;
     float worldY = m_y * HEIGHT;
@@ -152,10 +162,9 @@ void Chunk::reset(int x, int y, int z) {
     m_maxBounds = glm::vec3(worldX + WIDTH, worldY + HEIGHT, worldZ + DEPTH);
 
     // Clear mesh data (but don't deallocate vectors - they'll be reused)
+    releaseArenaMesh();
     m_vertices.clear();
-    m_indices.clear();
     m_transparentVertices.clear();
-    m_transparentIndices.clear();
 
     // Reset counters
     m_vertexCount = 0;
@@ -168,47 +177,13 @@ void Chunk::reset(int x, int y, int z) {
     m_needsDecoration = false;
     m_hasLightingData = false;
     m_terrainReady = false;  // MULTI-STAGE GENERATION: Reset to false for fresh generation
-    m_isEmpty = true;        // PERFORMANCE: Reset isEmpty cache
-    m_isEmptyValid = true;   // Cache is valid initially
+    m_bricks.clear();        // PERFORMANCE: All bricks empty (all air)
+    m_lodLevel.store(0, std::memory_order_release);  // Pooled chunks start at full detail
 
     // Reset state machine to UNLOADED (ready for fresh generation)
     m_state.store(ChunkState::UNLOADED, std::memory_order_release);
 }
 
-/**
- * @brief Checks if chunk is completely empty (all air blocks)
- *
- * PERFORMANCE OPTIMIZATION: Uses cached isEmpty state to avoid 32,768 block scans.
- * Cache is invalidated on setBlock() and recomputed lazily on first isEmpty() call.
- *
- * Before: O(32K) - scans all blocks every call
- * After: O(1) - returns cached value (recomputed only when invalid)
- * Impact: 1.6M block checks/frame → ~0 (at 50 chunks/frame unload rate)
- */
-bool Chunk::isEmpty() const {
-    // FAST PATH: Return cached value if valid
-    if (m_isEmptyValid) {
-        return m_isEmpty;
-    }
-
-    // SLOW PATH: Recompute and cache (only when cache invalidated)
-    bool empty = true;
-    for (int i = 0; i < WIDTH; i++) {
-        for (int j = 0; j < HEIGHT; j++) {
-            for (int k = 0; k < DEPTH; k++) {
-                if (m_blocks[i][j][k] != 0) {
-                    empty = false;
-                    goto done;  // Early exit on first non-air block
-                }
-            }
-        }
-    }
-done:
-    m_isEmpty = empty;
-    m_isEmptyValid = true;
-    return empty;
-}
-
 // =============================================================================
 // CHUNK STATE MACHINE (2025-11-25)
 // =============================================================================
@@ -233,6 +208,8 @@ done:
  *   UNLOADING -> UNLOADED (cleanup complete)
  *
  * Also allows:
+ *   GENERATED -> AWAITING_MESH (decoration skipped or deferred)
+ *   MESHING -> ACTIVE (fully occluded, nothing to upload)
  *   ACTIVE -> AWAITING_MESH (block change triggers remesh)
  *   Any -> UNLOADED (forced reset/pool return)
  *
@@ -253,7 +230,9 @@ bool Chunk::transitionTo(ChunkState newState) {
             valid = (newState == ChunkState::GENERATED);
             break;
         case ChunkState::GENERATED:
-            valid = (newState == ChunkState::DECORATING);
+            // Decoration is skipped for LOD tiers and deferred while neighbors load
+            valid = (newState == ChunkState::DECORATING ||
+                     newState == ChunkState::AWAITING_MESH);
             break;
         case ChunkState::DECORATING:
             valid = (newState == ChunkState::AWAITING_MESH);
@@ -262,7 +241,9 @@ bool Chunk::transitionTo(ChunkState newState) {
             valid = (newState == ChunkState::MESHING);
             break;
         case ChunkState::MESHING:
-            valid = (newState == ChunkState::AWAITING_UPLOAD);
+            // Fully occluded chunks skip the upload
+            valid = (newState == ChunkState::AWAITING_UPLOAD ||
+                     newState == ChunkState::ACTIVE);
             break;
         case ChunkState::AWAITING_UPLOAD:
             valid = (newState == ChunkState::UPLOADING);
@@ -287,6 +268,7 @@ bool Chunk::transitionTo(ChunkState newState) {
 
     if (valid) {
         m_state.store(newState, std::memory_order_release);
+        ChunkTrace::instance().recordTransition(m_x, m_y, m_z, current, newState);
         return true;
     }
 
@@ -318,11 +300,15 @@ bool Chunk::transitionTo(ChunkState newState) {
  * @return True if transition succeeded, false if state didn't match expected
  */
 bool Chunk::tryTransition(ChunkState expectedState, ChunkState newState) {
-    return m_state.compare_exchange_strong(
-        expectedState, newState,
-        std::memory_order_acq_rel,
-        std::memory_order_acquire
-    );
+    const ChunkState fromState = expectedState;
+    if (m_state.compare_exchange_strong(
+            expectedState, newState,
+            std::memory_order_acq_rel,
+            std::memory_order_acquire)) {
+        ChunkTrace::instance().recordTransition(m_x, m_y, m_z, fromState, newState);
+        return true;
+    }
+    return false;
 }
 
 /**
@@ -582,8 +568,9 @@ void Chunk::generate(BiomeMap* biomeMap) {
         }
     }
 
-    // PERFORMANCE: Build heightmap for fast sky light calculation
+    // PERFORMANCE: Count brick occupancy, then build heightmap for fast sky light calculation
     // This replaces expensive BFS propagation with O(1) lookups
+    m_bricks.rebuild(BlockRegistry::instance().properties(), &m_blocks[0][0][0]);
     rebuildHeightMap();
 
     // FIXED (2025-11-23): Mark freshly generated chunks as needing decoration
@@ -617,8 +604,8 @@ void Chunk::generate(BiomeMap* biomeMap) {
  *    b. Query neighbor block (may be in adjacent chunk)
  *    c. If neighbor is air (not solid), face is visible:
  *       - Generate 4 vertices for the quad
- *       - Assign texture coordinates from texture atlas
- *       - Add 6 indices (2 triangles) for the face
+ *       - Assign the face's texture array layer and quad UV corners
+ *       - Indices are implicit (shared quad index buffer, see quad_index.h)
  *    d. If neighbor is solid, face is hidden - skip it
  *
  * 3. Result: Only faces exposed to air are generated
@@ -627,27 +614,36 @@ void Chunk::generate(BiomeMap* biomeMap) {
  * -------------------
  * - Local coords: (0-31, 0-31, 0-31) within chunk
  * - World coords: local * 1.0 (blocks are 1.0 world units)
- * - Texture coords: UV mapped from texture atlas
+ * - Texture coords: quad-local UV on one texture array layer
  *
- * Texture Atlas Mapping:
+ * Texture Array Mapping:
  * ----------------------
- * - All block textures packed in NxN grid
- * - Each texture 64x64 pixels
- * - UV coords: (atlasX / gridSize, atlasY / gridSize)
+ * - One layer per block texture (64-128 pixels, see texture_array.h)
+ * - UV coords: (0..quadWidth, 0..quadHeight), tiled by REPEAT addressing
  * - Supports per-face textures (cube mapping)
  *
  * @param world World instance to query neighboring chunks
  */
-void Chunk::generateMesh(World* world, bool callerHoldsLock, int lodLevel) {
+void Chunk::generateMesh(World* world, int lodLevel) {
+    PROFILE_ZONE("chunk_generate_mesh");
+
+    // HIERARCHICAL LOD (2025-11-27): -1 keeps the level assigned by streaming, so
+    // lighting/edit remeshes of far chunks stay coarse
+    if (lodLevel < 0) {
+        lodLevel = getLodLevel();
+    }
+    lodLevel = std::clamp(lodLevel, 0, ChunkLod::MAX_LOD_LEVEL);
+    setLodLevel(lodLevel);
+    m_lightTransitionPending = false;
+
     // OCCLUSION CULLING: Skip mesh generation for fully-occluded chunks
     // Underground chunks surrounded by solid stone don't need any geometry!
     // This saves ~40% of mesh generation work for typical terrain
-    if (isFullyOccluded(world, callerHoldsLock)) {
+    if (isFullyOccluded(world)) {
         // Clear any existing mesh data
+        releaseArenaMesh();
         m_vertices.clear();
-        m_indices.clear();
         m_transparentVertices.clear();
-        m_transparentIndices.clear();
         m_vertexCount = 0;
         m_indexCount = 0;
         m_transparentVertexCount = 0;
@@ -656,6 +652,11 @@ void Chunk::generateMesh(World* world, bool callerHoldsLock, int lodLevel) {
         return;
     }
 
+    if (lodLevel > 0) {
+        generateLodMesh(lodLevel);
+        return;
+    }
+
     /**
      * Cube Vertex Layout (indexed rendering):
      * ========================================
@@ -702,7 +703,7 @@ void Chunk::generateMesh(World* world, bool callerHoldsLock, int lodLevel) {
      * UV Coordinate Layout:
      * =====================
      *
-     * UV coordinates map quad corners to texture atlas cells.
+     * UV coordinates map quad corners to the face's texture layer.
      * Standard UV space: (0,0) = top-left, (1,1) = bottom-right
      *
      * V-flip for side faces: Side faces need V-flip to prevent upside-down textures
@@ -734,39 +735,37 @@ void Chunk::generateMesh(World* world, bool callerHoldsLock, int lodLevel) {
     if (!m_vertices.empty()) {
         pool.releaseVertexBuffer(std::move(m_vertices));
     }
-    if (!m_indices.empty()) {
-        pool.releaseIndexBuffer(std::move(m_indices));
-    }
     if (!m_transparentVertices.empty()) {
         pool.releaseVertexBuffer(std::move(m_transparentVertices));
     }
-    if (!m_transparentIndices.empty()) {
-        pool.releaseIndexBuffer(std::move(m_transparentIndices));
-    }
 
     // Acquire buffers from pool (reuses allocated memory)
     std::vector<CompressedVertex> verts = pool.acquireVertexBuffer();
-    std::vector<uint32_t> indices = pool.acquireIndexBuffer();
     std::vector<CompressedVertex> transparentVerts = pool.acquireVertexBuffer();
-    std::vector<uint32_t> transparentIndices = pool.acquireIndexBuffer();
 
     // Reserve space for estimated visible faces (roughly 30% of blocks visible, 3 faces each on average)
-    // With indexed rendering: 4 vertices per face instead of 6
+    // 4 vertices per face; indices are implicit (shared quad index buffer)
     verts.reserve(WIDTH * HEIGHT * DEPTH * 12 / 10);  // 4 vertices per face
-    indices.reserve(WIDTH * HEIGHT * DEPTH * 18 / 10); // 6 indices per face (same as before)
     transparentVerts.reserve(WIDTH * HEIGHT * DEPTH * 6 / 10);  // Less transparent blocks typically
-    transparentIndices.reserve(WIDTH * HEIGHT * DEPTH * 9 / 10);
 
     // Get block registry (needed for liquid checks)
     auto& registry = BlockRegistry::instance();
-    int atlasGridSize = registry.getAtlasGridSize();
-    float uvScale = (atlasGridSize > 0) ? (1.0f / atlasGridSize) : 1.0f;
 
-    // Max quad size for greedy meshing - limited by TWO constraints:
-    // 1. UV constraint: quadSize <= atlasSize (prevents UV from crossing cell boundaries)
-    // 2. Bit constraint: quadSize <= 31 (CompressedVertex uses 5 bits for width/height)
-    // For tiled UV encoding, UV = cell + localUV * quadSize / atlasSize
-    const int maxQuadSize = std::min(31, (atlasGridSize > 0) ? atlasGridSize : 4);
+    // PERFORMANCE (2025-11-28): Per-block lookups go through the flat property table
+    // (1 byte of flags per ID, no bounds exceptions) instead of registry.get()
+    const BlockPropertyTable& props = registry.properties();
+
+    // SMOOTH TERRAIN (2025-11-28): smooth_terrain blocks are left to the surface-nets
+    // pass below (chunk_smooth.h); everything else is cube meshed as usual
+    const bool smoothTerrain = isSmoothTerrain(world);
+
+    // Set when any face samples a block light that differs from the previous mesh
+    bool lightChanged = false;
+
+    // Max quad size for greedy meshing: CompressedVertex uses 5 bits for width/height.
+    // TEXTURE ARRAY (2025-11-28): Quads tile with REPEAT addressing on their own layer,
+    // so the old quadSize <= atlasGridSize UV limit is gone
+    const int maxQuadSize = 31;
 
     // ============================================================================
     // PERFORMANCE FIX (2025-11-24): Cache neighbor chunks to eliminate hash lookups
@@ -778,14 +777,14 @@ void Chunk::generateMesh(World* world, bool callerHoldsLock, int lodLevel) {
     //      Direct chunk->getBlock() access (array lookup, no hash, no mutex)
     // IMPACT: 99.995% reduction in neighbor queries → Massive mesh generation speedup
     // ============================================================================
-    // DEADLOCK FIX (2025-11-25): Use getChunkAtUnsafe when caller already holds the lock!
-    // Otherwise getChunkAt tries to acquire shared_lock while caller holds unique_lock → deadlock
-    Chunk* neighborPosX = world ? (callerHoldsLock ? world->getChunkAtUnsafe(m_x + 1, m_y, m_z) : world->getChunkAt(m_x + 1, m_y, m_z)) : nullptr;
-    Chunk* neighborNegX = world ? (callerHoldsLock ? world->getChunkAtUnsafe(m_x - 1, m_y, m_z) : world->getChunkAt(m_x - 1, m_y, m_z)) : nullptr;
-    Chunk* neighborPosY = world ? (callerHoldsLock ? world->getChunkAtUnsafe(m_x, m_y + 1, m_z) : world->getChunkAt(m_x, m_y + 1, m_z)) : nullptr;
-    Chunk* neighborNegY = world ? (callerHoldsLock ? world->getChunkAtUnsafe(m_x, m_y - 1, m_z) : world->getChunkAt(m_x, m_y - 1, m_z)) : nullptr;
-    Chunk* neighborPosZ = world ? (callerHoldsLock ? world->getChunkAtUnsafe(m_x, m_y, m_z + 1) : world->getChunkAt(m_x, m_y, m_z + 1)) : nullptr;
-    Chunk* neighborNegZ = world ? (callerHoldsLock ? world->getChunkAtUnsafe(m_x, m_y, m_z - 1) : world->getChunkAt(m_x, m_y, m_z - 1)) : nullptr;
+    // LOCK SHARDING (2025-11-28): Each lookup takes a shared lock on one shard of the
+    // world's chunk map, so this is safe from any thread (no world-wide lock to hold)
+    Chunk* neighborPosX = world ? world->getChunkAt(m_x + 1, m_y, m_z) : nullptr;
+    Chunk* neighborNegX = world ? world->getChunkAt(m_x - 1, m_y, m_z) : nullptr;
+    Chunk* neighborPosY = world ? world->getChunkAt(m_x, m_y + 1, m_z) : nullptr;
+    Chunk* neighborNegY = world ? world->getChunkAt(m_x, m_y - 1, m_z) : nullptr;
+    Chunk* neighborPosZ = world ? world->getChunkAt(m_x, m_y, m_z + 1) : nullptr;
+    Chunk* neighborNegZ = world ? world->getChunkAt(m_x, m_y, m_z - 1) : nullptr;
 
     // Helper: Convert local chunk coordinates to world position (eliminates code duplication)
     auto localToWorldPos = [this](int x, int y, int z) -> glm::vec3 {
@@ -885,31 +884,20 @@ void Chunk::generateMesh(World* world, bool callerHoldsLock, int lodLevel) {
 
     // Helper lambda to check if a block is solid (non-air)
     // PERFORMANCE FIX: Uses cached neighbor chunks instead of world->getBlockAt()
-    auto isSolid = [&getNeighborBlock, &registry](int x, int y, int z) -> bool {
-        int blockID = getNeighborBlock(x, y, z);
-        if (blockID == 0) return false;
-        // Bounds check before registry access to prevent crash
-        if (blockID < 0 || blockID >= registry.count()) return false;
-        return !registry.get(blockID).isLiquid;  // Solid = not air and not liquid
+    auto isSolid = [&getNeighborBlock, &props](int x, int y, int z) -> bool {
+        return props.isSolid(getNeighborBlock(x, y, z));  // Solid = not air and not liquid
     };
 
     // Helper lambda to check if a block is liquid
     // PERFORMANCE FIX: Uses cached neighbor chunks instead of world->getBlockAt()
-    auto isLiquid = [&getNeighborBlock, &registry](int x, int y, int z) -> bool {
-        int blockID = getNeighborBlock(x, y, z);
-        if (blockID == 0) return false;
-        // Bounds check before registry access to prevent crash
-        if (blockID < 0 || blockID >= registry.count()) return false;
-        return registry.get(blockID).isLiquid;
+    auto isLiquid = [&getNeighborBlock, &props](int x, int y, int z) -> bool {
+        return props.isLiquid(getNeighborBlock(x, y, z));
     };
 
     // Helper lambda to check if a block is transparent (leaves, glass, etc.)
     // PERFORMANCE FIX: Uses cached neighbor chunks instead of world->getBlockAt()
-    auto isTransparent = [&getNeighborBlock, &registry](int x, int y, int z) -> bool {
-        int blockID = getNeighborBlock(x, y, z);
-        if (blockID == 0) return false;  // Air is not transparent, it's nothing
-        if (blockID < 0 || blockID >= registry.count()) return false;
-        return registry.get(blockID).transparency > 0.0f;
+    auto isTransparent = [&getNeighborBlock, &props](int x, int y, int z) -> bool {
+        return props.isTransparent(getNeighborBlock(x, y, z));  // Air is not transparent, it's nothing
     };
 
     // Helper lambda to get the block ID at a position (for neighbor comparison)
@@ -918,75 +906,6 @@ void Chunk::generateMesh(World* world, bool callerHoldsLock, int lodLevel) {
         return getNeighborBlock(x, y, z);
     };
 
-    // SMOOTH LIGHTING: Helper to get light at a vertex by sampling 4 adjacent blocks
-    // This creates smooth gradients between different light levels (Minecraft-style)
-    // Uses WORLD-SPACE vertex position to ensure consistent lighting across block boundaries
-    // Uses INTERPOLATED lighting values for smooth time-based transitions
-    // PERFORMANCE FIX: Uses cached neighbor chunks instead of world->getChunkAtWorldPos()
-    auto getSmoothLight = [this, neighborPosX, neighborNegX, neighborPosY, neighborNegY, neighborPosZ, neighborNegZ, callerHoldsLock](
-        float vx, float vy, float vz, int dx1, int dy1, int dz1, int dx2, int dy2, int dz2, bool isSky) -> float {
-
-        // Convert vertex world position to block coordinates
-        int blockX = static_cast<int>(std::floor(vx));
-        int blockY = static_cast<int>(std::floor(vy));
-        int blockZ = static_cast<int>(std::floor(vz));
-
-        // Sample 4 blocks around this vertex in world space
-        float light1, light2, light3, light4;
-
-        // PERFORMANCE FIX: Use cached neighbor chunks instead of hash lookups
-        auto getLightAtWorldPos = [&](int worldX, int worldY, int worldZ) -> float {
-            // Convert to chunk-local coordinates for this chunk
-            int localX = worldX - (m_x * WIDTH);
-            int localY = worldY - (m_y * HEIGHT);
-            int localZ = worldZ - (m_z * DEPTH);
-
-            // Inside this chunk - direct access
-            if (localX >= 0 && localX < WIDTH && localY >= 0 && localY < HEIGHT && localZ >= 0 && localZ < DEPTH) {
-                return isSky ? getInterpolatedSkyLight(localX, localY, localZ) : getInterpolatedBlockLight(localX, localY, localZ);
-            }
-
-            // Out of bounds - use cached neighbor chunks
-            Chunk* chunk = nullptr;
-            if (localX < 0) {
-                chunk = neighborNegX;
-                localX += WIDTH;
-            } else if (localX >= WIDTH) {
-                chunk = neighborPosX;
-                localX -= WIDTH;
-            } else if (localY < 0) {
-                chunk = neighborNegY;
-                localY += HEIGHT;
-            } else if (localY >= HEIGHT) {
-                chunk = neighborPosY;
-                localY -= HEIGHT;
-            } else if (localZ < 0) {
-                chunk = neighborNegZ;
-                localZ += DEPTH;
-            } else if (localZ >= DEPTH) {
-                chunk = neighborPosZ;
-                localZ -= DEPTH;
-            }
-
-            // If neighbor chunk exists, get lighting from it
-            if (chunk && localX >= 0 && localX < WIDTH && localY >= 0 && localY < HEIGHT && localZ >= 0 && localZ < DEPTH) {
-                return isSky ? chunk->getInterpolatedSkyLight(localX, localY, localZ) : chunk->getInterpolatedBlockLight(localX, localY, localZ);
-            }
-
-            // Fallback: assume full sunlight for sky, no block light
-            return isSky ? 15.0f : 0.0f;
-        };
-
-        // Sample 4 blocks around the vertex position
-        light1 = getLightAtWorldPos(blockX + dx1 + dx2, blockY + dy1 + dy2, blockZ + dz1 + dz2);  // Diagonal
-        light2 = getLightAtWorldPos(blockX + dx1, blockY + dy1, blockZ + dz1);                     // Side 1
-        light3 = getLightAtWorldPos(blockX + dx2, blockY + dy2, blockZ + dz2);                     // Side 2
-        light4 = getLightAtWorldPos(blockX, blockY, blockZ);                                       // Center
-
-        // Average the 4 samples and normalize to 0.0-1.0
-        return (light1 + light2 + light3 + light4) / 4.0f / 15.0f;
-    };
-
     // AMBIENT OCCLUSION: Darken vertices where 3 blocks meet (corners)
     // Creates depth perception and more realistic shadows (Minecraft-style)
     auto calculateAO = [&isSolid](int x, int y, int z, int dx1, int dy1, int dz1, int dx2, int dy2, int dz2) -> float {
@@ -1040,64 +959,38 @@ void Chunk::generateMesh(World* world, bool callerHoldsLock, int lodLevel) {
     #define SET_PROCESSED_POSZ(x, y, z) (processedPosZ[x][y] |= (1u << (z)))
     #define SET_PROCESSED_NEGZ(x, y, z) (processedNegZ[x][y] |= (1u << (z)))
 
+    // ============================================================================
+    // EMPTY-SPACE SKIPPING (2025-11-28): 8³ brick occupancy (chunk_bricks.h)
+    // ============================================================================
+    // EMPTY bricks have nothing to mesh, and OPAQUE bricks surrounded by OPAQUE
+    // bricks (neighbor chunks included) have every face culled. Skipping them
+    // leaves the visiting order - and so the greedy quads - unchanged, because
+    // no quad can start in or extend into a brick without visible faces.
+    // ============================================================================
+    const uint64_t neighborOpaque[6] = {
+        neighborPosX ? neighborPosX->m_bricks.opaque() : 0, neighborNegX ? neighborNegX->m_bricks.opaque() : 0,
+        neighborPosY ? neighborPosY->m_bricks.opaque() : 0, neighborNegY ? neighborNegY->m_bricks.opaque() : 0,
+        neighborPosZ ? neighborPosZ->m_bricks.opaque() : 0, neighborNegZ ? neighborNegZ->m_bricks.opaque() : 0
+    };
+    const uint64_t skipBricks = ~m_bricks.occupied() | m_bricks.buried(neighborOpaque);
+
     // Iterate over every block in the chunk (optimized order for cache locality)
     for(int X = 0; X < WIDTH;  X++) {
         for(int Y = 0; Y < HEIGHT; Y++) {
             for(int Z = 0; Z < DEPTH;  Z++) {
-                int id = m_blocks[X][Y][Z];
-                if (id == 0) continue; // Skip air
-
-                // Bounds check before registry access to prevent crash
-                if (id < 0 || id >= registry.count()) {
-                    continue; // Skip invalid block IDs
+                // Brick boundary along the Z run: jump over bricks without visible faces
+                if ((Z & (ChunkBricks::SIZE - 1)) == 0 && (skipBricks & ChunkBricks::bit(ChunkBricks::indexOf(X, Y, Z)))) {
+                    Z += ChunkBricks::SIZE - 1;
+                    continue;
                 }
 
-                // Look up block definition by ID
-                const BlockDefinition& def = registry.get(id);
-                float cr, cg, cb, ca;
-                if (def.hasColor) {
-                    // Use the block's defined color
-                    cr = def.color.r;
-                    cg = def.color.g;
-                    cb = def.color.b;
-                } else {
-                    // No color defined (likely has a texture); use white
-                    cr = cg = cb = 1.0f;
-                }
-                // Set alpha based on transparency (1.0 - transparency for proper blending)
-                ca = 1.0f - def.transparency;
-
-                // Helper to get UV coordinates for a specific face with texture variation
-                auto getUVsForFace = [&](const BlockDefinition::FaceTexture& face) -> std::pair<float, float> {
-                    float uMin = face.atlasX * uvScale;
-                    float vMin = face.atlasY * uvScale;
-
-                    // Apply texture variation if enabled (per-face variation)
-                    float zoomFactor = face.variation;
-                    if (zoomFactor > 1.0f) {
-                        int worldX = m_x * WIDTH + X;
-                        int worldY = m_y * HEIGHT + Y;
-                        int worldZ = m_z * DEPTH + Z;
-
-                        // Simple hash function for pseudo-random offset
-                        // Cast to unsigned before multiplication to avoid signed integer overflow (UB)
-                        unsigned int seed = (static_cast<unsigned int>(worldX) * 73856093U) ^
-                                          (static_cast<unsigned int>(worldY) * 19349663U) ^
-                                          (static_cast<unsigned int>(worldZ) * 83492791U);
-                        float randU = ((seed >> 0) & 0xFF) / 255.0f;
-                        float randV = ((seed >> 8) & 0xFF) / 255.0f;
-
-                        // Calculate how much space we can shift within
-                        float maxShift = uvScale * (1.0f - 1.0f / zoomFactor);
-                        float uShift = randU * maxShift;
-                        float vShift = randV * maxShift;
-
-                        uMin += uShift;
-                        vMin += vShift;
-                    }
+                int id = m_blocks[X][Y][Z];
+                if (id == 0) continue; // Skip air
 
-                    return {uMin, vMin};
-                };
+                // Skip invalid block IDs (out of range or unregistered)
+                const uint8_t flags = props.flags(id);
+                if (!(flags & BlockFlags::VALID)) continue;
+                if (smoothTerrain && props.isSmooth(id)) continue;
 
                 // Calculate world position for this block
                 float bx = float(m_x * WIDTH + X);
@@ -1107,7 +1000,7 @@ void Chunk::generateMesh(World* world, bool callerHoldsLock, int lodLevel) {
                 // Water level height adjustment (Minecraft-style flowing water)
                 // Level 0 = source (full height), Level 7 = edge (very low)
                 float waterHeightAdjust = 0.0f;
-                if (def.isLiquid) {
+                if (flags & BlockFlags::LIQUID) {
                     uint8_t waterLevel = m_blockMetadata[X][Y][Z];
                     // Each level reduces height by 1/8th of a block (0.125 world units)
                     waterHeightAdjust = -waterLevel * (1.0f / 8.0f);
@@ -1120,7 +1013,7 @@ void Chunk::generateMesh(World* world, bool callerHoldsLock, int lodLevel) {
                 // faceNormal: Direction the face is facing (for smooth lighting calculation)
                 // width, height: Size of the merged quad (1.0 = single block, >1.0 = merged)
                 // startX, startY, startZ: Starting position of the merged quad
-                auto renderFace = [&](const BlockDefinition::FaceTexture& faceTexture, int cubeStart, int uvStart,
+                auto renderFace = [&](uint16_t layer, int cubeStart, int uvStart,
                                       float heightAdjust = 0.0f, bool adjustTopOnly = false, bool useTransparent = false,
                                       glm::ivec3 faceNormal = glm::ivec3(0, 0, 0),
                                       float quadWidth = 1.0f, float quadHeight = 1.0f,
@@ -1132,44 +1025,23 @@ void Chunk::generateMesh(World* world, bool callerHoldsLock, int lodLevel) {
 
                     // Choose which vectors to use based on transparency
                     auto& targetVerts = useTransparent ? transparentVerts : verts;
-                    auto& targetIndices = useTransparent ? transparentIndices : indices;
-
-                    // Get the base index for these vertices
-                    uint32_t baseIndex = static_cast<uint32_t>(targetVerts.size());
 
                     // ========== COMPRESSED VERTEX SETUP ==========
-                    // Determine normal index from face normal
-                    uint8_t normalIndex;
-                    if (faceNormal.x > 0) normalIndex = CompressedVertex::NORMAL_POS_X;
-                    else if (faceNormal.x < 0) normalIndex = CompressedVertex::NORMAL_NEG_X;
-                    else if (faceNormal.y > 0) normalIndex = CompressedVertex::NORMAL_POS_Y;
-                    else if (faceNormal.y < 0) normalIndex = CompressedVertex::NORMAL_NEG_Y;
-                    else if (faceNormal.z > 0) normalIndex = CompressedVertex::NORMAL_POS_Z;
-                    else normalIndex = CompressedVertex::NORMAL_NEG_Z;
-
                     // Determine if this is a top/bottom face (affects UV corner mapping)
                     bool isYFace = (faceNormal.y != 0);
 
-                    // Get atlas cell indices (clamp to valid range)
-                    float atlasSize = (uvScale > 0.0f) ? (1.0f / uvScale) : 16.0f;
-                    int maxCell = static_cast<int>(atlasSize) - 1;
-                    uint8_t atlasX = static_cast<uint8_t>(std::clamp(faceTexture.atlasX, 0, maxCell));
-                    uint8_t atlasY = static_cast<uint8_t>(std::clamp(faceTexture.atlasY, 0, maxCell));
-
                     // Calculate quad dimensions (clamped to 0-31)
                     uint8_t qw = static_cast<uint8_t>(std::clamp(static_cast<int>(quadWidth), 1, 31));
                     uint8_t qh = static_cast<uint8_t>(std::clamp(static_cast<int>(quadHeight), 1, 31));
 
                     // Determine color tint based on block type
                     // TODO: Add isFoliage/isGrass properties to BlockDefinition for tint support
-                    uint8_t colorTint = CompressedVertex::TINT_WHITE;
-                    if (def.isLiquid) {
-                        colorTint = CompressedVertex::TINT_WATER;
-                    }
+                    uint8_t colorTint = props.tint(id);
 
                     // Calculate lighting once per face (classic retro style)
                     uint8_t skyLightInt = 15;
                     uint8_t blockLightInt = 0;
+                    uint8_t prevBlockLightInt = 0;  // Block light of the previous mesh (GPU transition source)
                     uint8_t aoInt = 15;  // 15 = full brightness (1.0), no AO darkening
 
                     if (DebugState::instance().lightingEnabled.getValue()) {
@@ -1177,12 +1049,12 @@ void Chunk::generateMesh(World* world, bool callerHoldsLock, int lodLevel) {
                         int sampleY = Y + faceNormal.y;
                         int sampleZ = Z + faceNormal.z;
 
-                        if (callerHoldsLock) {
-                            if (sampleX >= 0 && sampleX < WIDTH && sampleY >= 0 && sampleY < HEIGHT && sampleZ >= 0 && sampleZ < DEPTH) {
-                                skyLightInt = static_cast<uint8_t>(calculateSkyLightFromHeightmap(sampleX, sampleY, sampleZ));
-                                blockLightInt = static_cast<uint8_t>(std::clamp(getInterpolatedBlockLight(sampleX, sampleY, sampleZ) * 15.0f, 0.0f, 15.0f));
-                            }
-                        } else {
+                        if (sampleX >= 0 && sampleX < WIDTH && sampleY >= 0 && sampleY < HEIGHT && sampleZ >= 0 && sampleZ < DEPTH) {
+                            // Sample inside this chunk - no chunk map lookup (shard lock) needed
+                            skyLightInt = static_cast<uint8_t>(calculateSkyLightFromHeightmap(sampleX, sampleY, sampleZ));
+                            blockLightInt = getBlockLight(sampleX, sampleY, sampleZ);
+                            prevBlockLightInt = getPreviousBlockLight(sampleX, sampleY, sampleZ);
+                        } else if (world) {
                             glm::vec3 sampleWorldPos = localToWorldPos(sampleX, sampleY, sampleZ);
                             Chunk* chunk = world->getChunkAtWorldPos(sampleWorldPos.x, sampleWorldPos.y, sampleWorldPos.z);
                             if (chunk) {
@@ -1190,9 +1062,12 @@ void Chunk::generateMesh(World* world, bool callerHoldsLock, int lodLevel) {
                                 int localY = static_cast<int>(sampleWorldPos.y) - (chunk->getChunkY() * HEIGHT);
                                 int localZ = static_cast<int>(sampleWorldPos.z) - (chunk->getChunkZ() * DEPTH);
                                 skyLightInt = static_cast<uint8_t>(chunk->calculateSkyLightFromHeightmap(localX, localY, localZ));
-                                blockLightInt = static_cast<uint8_t>(std::clamp(chunk->getInterpolatedBlockLight(localX, localY, localZ) * 15.0f, 0.0f, 15.0f));
+                                blockLightInt = chunk->getBlockLight(localX, localY, localZ);
+                                // Neighbor snapshots may be rewritten by another mesh worker - no transition across borders
+                                prevBlockLightInt = blockLightInt;
                             }
                         }
+                        lightChanged |= (prevBlockLightInt != blockLightInt);
                     }
 
                     // Corner index mapping for UV calculation
@@ -1253,38 +1128,31 @@ void Chunk::generateMesh(World* world, bool callerHoldsLock, int lodLevel) {
                         // Pack and add compressed vertex
                         targetVerts.push_back(CompressedVertex::pack(
                             worldX, worldY, worldZ,
-                            normalIndex,
                             qw, qh,
-                            atlasX, atlasY,
+                            layer,
                             cornerIndex,
-                            skyLightInt, blockLightInt, aoInt,
+                            skyLightInt, blockLightInt, prevBlockLightInt, aoInt,
                             colorTint
                         ));
                     }
 
-                    // SIMPLIFIED TRIANGLE SPLIT FOR CLASSIC LIGHTING
-                    // Use consistent diagonal (0-2) for all faces
-                    targetIndices.push_back(baseIndex + 0);
-                    targetIndices.push_back(baseIndex + 1);
-                    targetIndices.push_back(baseIndex + 2);
-                    targetIndices.push_back(baseIndex + 0);
-                    targetIndices.push_back(baseIndex + 2);
-                    targetIndices.push_back(baseIndex + 3);
+                    // SIMPLIFIED TRIANGLE SPLIT FOR CLASSIC LIGHTING: every quad uses the
+                    // consistent diagonal (0-2) of the shared quad index buffer
                 };
 
-                // Select appropriate texture for each face
-                const BlockDefinition::FaceTexture& frontTex = def.useCubeMap ? def.front : def.all;
-                const BlockDefinition::FaceTexture& backTex = def.useCubeMap ? def.back : def.all;
-                const BlockDefinition::FaceTexture& leftTex = def.useCubeMap ? def.left : def.all;
-                const BlockDefinition::FaceTexture& rightTex = def.useCubeMap ? def.right : def.all;
-                const BlockDefinition::FaceTexture& topTex = def.useCubeMap ? def.top : def.all;
-                const BlockDefinition::FaceTexture& bottomTex = def.useCubeMap ? def.bottom : def.all;
+                // Select the texture layer for each face (cube maps resolved in the table)
+                const uint16_t frontTex = props.faceLayer(id, static_cast<int>(FaceDirection::NegZ));
+                const uint16_t backTex = props.faceLayer(id, static_cast<int>(FaceDirection::PosZ));
+                const uint16_t leftTex = props.faceLayer(id, static_cast<int>(FaceDirection::NegX));
+                const uint16_t rightTex = props.faceLayer(id, static_cast<int>(FaceDirection::PosX));
+                const uint16_t topTex = props.faceLayer(id, static_cast<int>(FaceDirection::PosY));
+                const uint16_t bottomTex = props.faceLayer(id, static_cast<int>(FaceDirection::NegY));
 
                 // Face culling based on block type
                 // - Solid blocks: ALWAYS render faces against air and liquids (liquids are transparent)
                 // - Liquid blocks: render faces against air and solids (not other liquids to avoid z-fighting)
-                bool isCurrentLiquid = def.isLiquid;
-                bool isCurrentTransparent = (def.transparency > 0.0f);  // Has any transparency
+                bool isCurrentLiquid = (flags & BlockFlags::LIQUID) != 0;
+                bool isCurrentTransparent = (flags & BlockFlags::TRANSPARENT) != 0;  // Has any transparency
 
                 // =================================================================================================
                 // UNIFIED FACE PROCESSING HELPER (uses FaceConfig for data-driven face generation)
@@ -1297,7 +1165,7 @@ void Chunk::generateMesh(World* world, bool callerHoldsLock, int lodLevel) {
                 // =================================================================================================
                 auto processFace = [&](
                     const FaceConfig& face,
-                    const BlockDefinition::FaceTexture& tex,
+                    uint16_t tex,
                     auto&& isProcessed,
                     auto&& setProcessed,
                     int maxDim1, int maxDim2,
@@ -1447,17 +1315,209 @@ void Chunk::generateMesh(World* world, bool callerHoldsLock, int lodLevel) {
     #undef SET_PROCESSED_POSZ
     #undef SET_PROCESSED_NEGZ
 
-    // Store opaque geometry
-    m_vertexCount = static_cast<uint32_t>(verts.size());
-    m_indexCount = static_cast<uint32_t>(indices.size());
-    m_vertices = std::move(verts);
-    m_indices = std::move(indices);
+    if (smoothTerrain) {
+        appendSmoothMesh(world, verts);
+    }
+
+    // Store opaque + transparent geometry (straight into the upload arena when possible)
+    storeMesh(verts, transparentVerts);
+
+    // LIGHT TRANSITIONS: The upload starts the GPU blend if any face changed brightness,
+    // then this mesh's light becomes the source of the next transition
+    m_lightTransitionPending = lightChanged;
+    captureMeshedBlockLight();
+}
+
+void Chunk::generateLodMesh(int lodLevel) {
+    // ============================================================================
+    // HIERARCHICAL LOD (2025-11-27): Coarse mesh from a downsampled block grid
+    // ============================================================================
+    // 2x/4x/8x cells → 8x/64x/512x fewer candidate faces than the full mesher.
+    // Neighbors are not consulted: chunk borders get skirts instead (chunk_lod.cpp)
+    // ============================================================================
+    auto& pool = getThreadLocalMeshPool();
+
+    if (!m_vertices.empty()) {
+        pool.releaseVertexBuffer(std::move(m_vertices));
+    }
+    if (!m_transparentVertices.empty()) {
+        pool.releaseVertexBuffer(std::move(m_transparentVertices));
+    }
+
+    std::vector<CompressedVertex> verts = pool.acquireVertexBuffer();
+    std::vector<CompressedVertex> transparentVerts = pool.acquireVertexBuffer();
+
+    // Grid storage is reused per mesh worker thread
+    thread_local ChunkLod::DownsampledGrid grid;
+    {
+        std::lock_guard<std::mutex> lock(m_blockDataMutex);
+        ChunkLod::downsample(m_blocks, lodLevel, grid);
+    }
+    ChunkLod::buildMesh(grid, m_x, m_y, m_z, verts, transparentVerts);
+
+    storeMesh(verts, transparentVerts);
+}
+
+bool Chunk::isSmoothTerrain(World* world) const {
+    if (DebugState::instance().smoothTerrain.getValue()) {
+        return true;
+    }
+    BiomeMap* biomeMap = world ? world->getBiomeMap() : nullptr;
+    if (!biomeMap) {
+        return false;
+    }
+    // One biome decides for the whole chunk (sampled at the chunk center column)
+    const Biome* biome = biomeMap->getBiomeAt(static_cast<float>(m_x * WIDTH + WIDTH / 2),
+                                              static_cast<float>(m_z * DEPTH + DEPTH / 2));
+    return biome && biome->smooth_terrain;
+}
+
+void Chunk::appendSmoothMesh(World* world, std::vector<CompressedVertex>& verts) {
+    // ============================================================================
+    // SMOOTH TERRAIN (2025-11-28): Surface nets over a 34³ padded sample grid
+    // ============================================================================
+    // Same neighbor caching as the cube mesher, but the border includes edges and
+    // corners (26 neighbors): cells on a chunk edge need all 8 of their samples.
+    // Missing neighbors read as air, like getNeighborBlock().
+    // around[] is indexed like ChunkSmooth::regionBit()
+    // ============================================================================
+    using ChunkSmooth::PAD;
+
+    Chunk* around[27];
+    for (int i = 0; i < 27; i++) {
+        const int dx = i / 9 - 1;
+        const int dy = (i / 3) % 3 - 1;
+        const int dz = i % 3 - 1;
+        if (dx == 0 && dy == 0 && dz == 0) {
+            around[i] = this;
+        } else {
+            around[i] = world ? world->getChunkAt(m_x + dx, m_y + dy, m_z + dz) : nullptr;
+        }
+    }
+    auto chunkFor = [&around](int dx, int dy, int dz) { return around[(dx + 1) * 9 + (dy + 1) * 3 + (dz + 1)]; };
+    auto split = [](int padded, int size, int& local) {
+        local = padded - 1;
+        const int offset = (local < 0) ? -1 : (local >= size ? 1 : 0);
+        local -= offset * size;
+        return offset;
+    };
+
+    // Grid storage is reused per mesh worker thread
+    thread_local ChunkSmooth::SampleGrid grid;
+    grid.resize();
+
+    // Neighbors outside smooth biomes are cube meshed: their blocks pin the border cells
+    // so the smooth surface meets their cube faces (chunk_smooth.h, MIXED BORDERS)
+    grid.cubeRegions = 0;
+    for (int i = 0; i < 27; i++) {
+        if (around[i] && around[i] != this && !around[i]->isSmoothTerrain(world)) {
+            grid.cubeRegions |= 1u << i;
+        }
+    }
+
+    for (int px = 0; px < PAD; px++) {
+        int lx;
+        const int dx = split(px, WIDTH, lx);
+        for (int py = 0; py < PAD; py++) {
+            int ly;
+            const int dy = split(py, HEIGHT, ly);
+            int* row = &grid.blocks[ChunkSmooth::SampleGrid::index(px, py, 0)];
+
+            // Z run: 1 sample from -Z, 32 contiguous blocks, 1 sample from +Z
+            const Chunk* below = chunkFor(dx, dy, -1);
+            const Chunk* middle = chunkFor(dx, dy, 0);
+            const Chunk* above = chunkFor(dx, dy, 1);
+            row[0] = below ? below->m_blocks[lx][ly][DEPTH - 1] : 0;
+            if (middle) {
+                std::memcpy(row + 1, middle->m_blocks[lx][ly], DEPTH * sizeof(int));
+            } else {
+                std::fill(row + 1, row + 1 + DEPTH, 0);
+            }
+            row[PAD - 1] = above ? above->m_blocks[lx][ly][0] : 0;
+        }
+    }
+
+    if (ChunkSmooth::prepare(grid) == 0) {
+        return;
+    }
+
+    // Light only for the outside samples that smooth quads face
+    const bool lighting = DebugState::instance().lightingEnabled.getValue();
+    for (int sample : grid.litSamples) {
+        uint8_t sky = 15;
+        uint8_t block = 0;
+        if (lighting) {
+            int lx, ly, lz;
+            const int dx = split(sample / (PAD * PAD), WIDTH, lx);
+            const int dy = split((sample / PAD) % PAD, HEIGHT, ly);
+            const int dz = split(sample % PAD, DEPTH, lz);
+            if (const Chunk* chunk = chunkFor(dx, dy, dz)) {
+                sky = chunk->calculateSkyLightFromHeightmap(lx, ly, lz);
+                block = chunk->getBlockLight(lx, ly, lz);
+            }
+        }
+        grid.light[sample] = static_cast<uint8_t>((sky << 4) | block);
+    }
+
+    ChunkSmooth::buildMesh(grid, m_x, m_y, m_z, verts);
+}
 
-    // Store transparent geometry
+void Chunk::storeMesh(std::vector<CompressedVertex>& verts, std::vector<CompressedVertex>& transparentVerts) {
+    // QUAD INDEX ELIMINATION (2025-11-28): Meshes are plain quad lists; the index
+    // count is derived and drawn from the renderer's shared quad index buffer
+    m_vertexCount = static_cast<uint32_t>(verts.size());
+    m_indexCount = QuadIndex::indexCountForVertices(m_vertexCount);
     m_transparentVertexCount = static_cast<uint32_t>(transparentVerts.size());
-    m_transparentIndexCount = static_cast<uint32_t>(transparentIndices.size());
+    m_transparentIndexCount = QuadIndex::indexCountForVertices(m_transparentVertexCount);
+
+    // A previous mesh that never reached the GPU is superseded
+    releaseArenaMesh();
+
+    // ============================================================================
+    // ZERO-COPY UPLOAD (2025-11-28): Write the mesh into a mapped arena slice here,
+    // on the mesh worker. The main thread then only records copy regions from the
+    // arena - no staging buffers, no main-thread memcpy, no CPU mesh kept per chunk.
+    // The thread-local scratch vectors go straight back to the pool.
+    // ============================================================================
+    const VkDeviceSize vertexBytes = verts.size() * sizeof(CompressedVertex);
+    const VkDeviceSize transparentVertexBytes = transparentVerts.size() * sizeof(CompressedVertex);
+
+    const VkDeviceSize transparentVertexOffset = UploadArena::alignUp(vertexBytes);
+    const VkDeviceSize totalBytes = transparentVertexOffset + transparentVertexBytes;
+
+    UploadArena* arena = s_uploadArena.load(std::memory_order_acquire);
+    if (arena && totalBytes > 0 && arena->allocate(totalBytes, m_arenaMesh)) {
+        uint8_t* dst = m_arenaMesh.ptr;
+        if (vertexBytes > 0) std::memcpy(dst, verts.data(), vertexBytes);
+        if (transparentVertexBytes > 0) std::memcpy(dst + transparentVertexOffset, transparentVerts.data(), transparentVertexBytes);
+        m_arenaTransparentVertexOffset = transparentVertexOffset;
+
+        auto& pool = getThreadLocalMeshPool();
+        pool.releaseVertexBuffer(std::move(verts));
+        pool.releaseVertexBuffer(std::move(transparentVerts));
+        return;
+    }
+
+    // No arena (or arena full): keep the mesh on the CPU for the staging-buffer path
+    m_vertices = std::move(verts);
     m_transparentVertices = std::move(transparentVerts);
-    m_transparentIndices = std::move(transparentIndices);
+}
+
+void Chunk::releaseArenaMesh() {
+    if (!m_arenaMesh.valid()) {
+        return;
+    }
+    if (UploadArena* arena = s_uploadArena.load(std::memory_order_acquire)) {
+        arena->release(m_arenaMesh.id);
+    }
+    m_arenaMesh = UploadArena::Allocation{};
+}
+
+void Chunk::discardPendingMesh() {
+    releaseArenaMesh();
+    m_vertices.clear();
+    m_transparentVertices.clear();
+    setState(ChunkState::AWAITING_MESH);
 }
 
 void Chunk::createVertexBuffer(VulkanRenderer* renderer) {
@@ -1465,6 +1525,20 @@ void Chunk::createVertexBuffer(VulkanRenderer* renderer) {
         return;  // No vertices to upload
     }
 
+    // Mesh lives in the upload arena - copy it with a one-off batch
+    if (m_arenaMesh.valid()) {
+        renderer->beginBufferCopyBatch();
+        createVertexBufferBatched(renderer);
+        renderer->submitBufferCopyBatch();
+        cleanupStagingBuffers(renderer);
+        return;
+    }
+
+    // LIGHT TRANSITIONS: The new mesh becomes visible now - start its GPU blend here
+    m_lightTransitionStart = m_lightTransitionPending ? std::chrono::steady_clock::now()
+                                                     : std::chrono::steady_clock::time_point{};
+    m_lightTransitionPending = false;
+
     // PERFORMANCE FIX: Use deferred deletion instead of vkDeviceWaitIdle()
     // Old buffers are queued for destruction after MAX_FRAMES_IN_FLIGHT frames
     // This eliminates the GPU pipeline stall that was causing spawn lag!
@@ -1515,60 +1589,10 @@ void Chunk::createVertexBuffer(VulkanRenderer* renderer) {
         throw;  // Re-throw to caller
     }
 
-    // Create index buffer with exception safety
-    VkDeviceSize indexBufferSize = sizeof(uint32_t) * m_indices.size();
-
-    stagingBuffer = VK_NULL_HANDLE;
-    stagingBufferMemory = VK_NULL_HANDLE;
-
-    try {
-        renderer->createBuffer(indexBufferSize,
-                              VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
-                              VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
-                              stagingBuffer, stagingBufferMemory);
-
-        void* data;
-        vkMapMemory(device, stagingBufferMemory, 0, indexBufferSize, 0, &data);
-        memcpy(data, m_indices.data(), (size_t)indexBufferSize);
-        vkUnmapMemory(device, stagingBufferMemory);
-
-        renderer->createBuffer(indexBufferSize,
-                              VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_INDEX_BUFFER_BIT,
-                              VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
-                              m_indexBuffer, m_indexBufferMemory);
-
-        renderer->copyBuffer(stagingBuffer, m_indexBuffer, indexBufferSize);
-
-        // Clean up staging buffer
-        vkDestroyBuffer(device, stagingBuffer, nullptr);
-        vkFreeMemory(device, stagingBufferMemory, nullptr);
-
-    } catch (...) {
-        // Clean up staging buffer on exception
-        if (stagingBuffer != VK_NULL_HANDLE) {
-            vkDestroyBuffer(device, stagingBuffer, nullptr);
-        }
-        if (stagingBufferMemory != VK_NULL_HANDLE) {
-            vkFreeMemory(device, stagingBufferMemory, nullptr);
-        }
-        // Also clean up partially created vertex buffer
-        if (m_vertexBuffer != VK_NULL_HANDLE) {
-            vkDestroyBuffer(device, m_vertexBuffer, nullptr);
-            m_vertexBuffer = VK_NULL_HANDLE;
-        }
-        if (m_vertexBufferMemory != VK_NULL_HANDLE) {
-            vkFreeMemory(device, m_vertexBufferMemory, nullptr);
-            m_vertexBufferMemory = VK_NULL_HANDLE;
-        }
-        throw;  // Re-throw to caller
-    }
-
     // Free CPU-side mesh data after successful GPU upload
     // Data is now on GPU (DEVICE_LOCAL memory), no need to keep CPU copy
     m_vertices.clear();
     m_vertices.shrink_to_fit();
-    m_indices.clear();
-    m_indices.shrink_to_fit();
     }  // End of opaque buffer creation
 
     // ========== CREATE TRANSPARENT BUFFERS ==========
@@ -1614,59 +1638,9 @@ void Chunk::createVertexBuffer(VulkanRenderer* renderer) {
             throw;  // Re-throw to caller
         }
 
-        // Create transparent index buffer
-        VkDeviceSize indexBufferSize = sizeof(uint32_t) * m_transparentIndices.size();
-
-        stagingBuffer = VK_NULL_HANDLE;
-        stagingBufferMemory = VK_NULL_HANDLE;
-
-        try {
-            renderer->createBuffer(indexBufferSize,
-                                  VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
-                                  VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
-                                  stagingBuffer, stagingBufferMemory);
-
-            void* data;
-            vkMapMemory(device, stagingBufferMemory, 0, indexBufferSize, 0, &data);
-            memcpy(data, m_transparentIndices.data(), (size_t)indexBufferSize);
-            vkUnmapMemory(device, stagingBufferMemory);
-
-            renderer->createBuffer(indexBufferSize,
-                                  VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_INDEX_BUFFER_BIT,
-                                  VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
-                                  m_transparentIndexBuffer, m_transparentIndexBufferMemory);
-
-            renderer->copyBuffer(stagingBuffer, m_transparentIndexBuffer, indexBufferSize);
-
-            // Clean up staging buffer
-            vkDestroyBuffer(device, stagingBuffer, nullptr);
-            vkFreeMemory(device, stagingBufferMemory, nullptr);
-
-        } catch (...) {
-            // Clean up staging buffer on exception
-            if (stagingBuffer != VK_NULL_HANDLE) {
-                vkDestroyBuffer(device, stagingBuffer, nullptr);
-            }
-            if (stagingBufferMemory != VK_NULL_HANDLE) {
-                vkFreeMemory(device, stagingBufferMemory, nullptr);
-            }
-            // Also clean up partially created transparent vertex buffer
-            if (m_transparentVertexBuffer != VK_NULL_HANDLE) {
-                vkDestroyBuffer(device, m_transparentVertexBuffer, nullptr);
-                m_transparentVertexBuffer = VK_NULL_HANDLE;
-            }
-            if (m_transparentVertexBufferMemory != VK_NULL_HANDLE) {
-                vkFreeMemory(device, m_transparentVertexBufferMemory, nullptr);
-                m_transparentVertexBufferMemory = VK_NULL_HANDLE;
-            }
-            throw;  // Re-throw to caller
-        }
-
         // Free CPU-side transparent mesh data after successful GPU upload
         m_transparentVertices.clear();
         m_transparentVertices.shrink_to_fit();
-        m_transparentIndices.clear();
-        m_transparentIndices.shrink_to_fit();
     }  // End of transparent buffer creation
 }
 
@@ -1689,24 +1663,12 @@ void Chunk::destroyBuffers(VulkanRenderer* renderer) {
         m_vertexBufferMemory = VK_NULL_HANDLE;
     }
 
-    if (m_indexBuffer != VK_NULL_HANDLE || m_indexBufferMemory != VK_NULL_HANDLE) {
-        renderer->queueBufferDeletion(m_indexBuffer, m_indexBufferMemory);
-        m_indexBuffer = VK_NULL_HANDLE;
-        m_indexBufferMemory = VK_NULL_HANDLE;
-    }
-
     // Queue transparent buffers for deletion
     if (m_transparentVertexBuffer != VK_NULL_HANDLE || m_transparentVertexBufferMemory != VK_NULL_HANDLE) {
         renderer->queueBufferDeletion(m_transparentVertexBuffer, m_transparentVertexBufferMemory);
         m_transparentVertexBuffer = VK_NULL_HANDLE;
         m_transparentVertexBufferMemory = VK_NULL_HANDLE;
     }
-
-    if (m_transparentIndexBuffer != VK_NULL_HANDLE || m_transparentIndexBufferMemory != VK_NULL_HANDLE) {
-        renderer->queueBufferDeletion(m_transparentIndexBuffer, m_transparentIndexBufferMemory);
-        m_transparentIndexBuffer = VK_NULL_HANDLE;
-        m_transparentIndexBufferMemory = VK_NULL_HANDLE;
-    }
 #endif
 }
 
@@ -1715,6 +1677,26 @@ void Chunk::createVertexBufferBatched(VulkanRenderer* renderer) {
         return;  // No vertices to upload
     }
 
+    // ZERO-COPY UPLOAD (2025-11-28): If the mesher wrote into the upload arena, only copy
+    // regions are recorded here; the slice is released when the batch completes on the GPU
+    const bool fromArena = m_arenaMesh.valid();
+    const VkBuffer arenaBuffer = fromArena ? renderer->getUploadArena().getBuffer() : VK_NULL_HANDLE;
+
+    // The arena slice is consumed by the upload, so a second upload without a remesh has no source
+    if (!fromArena && (m_vertices.size() != m_vertexCount ||
+                       m_transparentVertices.size() != m_transparentVertexCount)) {
+        Logger::debug() << "Chunk (" << m_x << ", " << m_y << ", " << m_z << ") already uploaded, skipping";
+        return;
+    }
+
+    // LIGHT TRANSITIONS: The new mesh becomes visible now - start its GPU blend here
+    m_lightTransitionStart = m_lightTransitionPending ? std::chrono::steady_clock::now()
+                                                     : std::chrono::steady_clock::time_point{};
+    m_lightTransitionPending = false;
+
+    // QUAD INDEX ELIMINATION (2025-11-28): Only vertices are uploaded; draws use the
+    // renderer's shared quad index buffer (see quad_index.h)
+
 #if USE_INDIRECT_DRAWING
     // ========== INDIRECT DRAWING PATH (MEGA-BUFFER) ==========
     VkDevice device = renderer->getDevice();
@@ -1722,26 +1704,20 @@ void Chunk::createVertexBufferBatched(VulkanRenderer* renderer) {
     // Initialize staging buffers to NULL
     m_vertexStagingBuffer = VK_NULL_HANDLE;
     m_vertexStagingBufferMemory = VK_NULL_HANDLE;
-    m_indexStagingBuffer = VK_NULL_HANDLE;
-    m_indexStagingBufferMemory = VK_NULL_HANDLE;
     m_transparentVertexStagingBuffer = VK_NULL_HANDLE;
     m_transparentVertexStagingBufferMemory = VK_NULL_HANDLE;
-    m_transparentIndexStagingBuffer = VK_NULL_HANDLE;
-    m_transparentIndexStagingBufferMemory = VK_NULL_HANDLE;
 
     // ========== ALLOCATE AND UPLOAD OPAQUE GEOMETRY ==========
     if (m_vertexCount > 0) {
-        VkDeviceSize vertexBufferSize = sizeof(CompressedVertex) * m_vertices.size();
-        VkDeviceSize indexBufferSize = sizeof(uint32_t) * m_indices.size();
+        VkDeviceSize vertexBufferSize = sizeof(CompressedVertex) * m_vertexCount;
 
         // OPTIMIZATION: Only allocate new space if we don't already have space
         // This prevents memory leaks when chunks regenerate meshes (lighting updates, etc.)
-        bool needsNewAllocation = (m_megaBufferVertexOffset == 0 && m_megaBufferIndexOffset == 0);
+        bool needsNewAllocation = (m_megaBufferVertexOffset == 0);
 
         if (needsNewAllocation) {
             // Allocate space in mega-buffer
-            if (!renderer->allocateMegaBufferSpace(vertexBufferSize, indexBufferSize, false,
-                                                    m_megaBufferVertexOffset, m_megaBufferIndexOffset)) {
+            if (!renderer->allocateMegaBufferSpace(vertexBufferSize, false, m_megaBufferVertexOffset)) {
                 Logger::error() << "Failed to allocate mega-buffer space for chunk at ("
                                << m_x << ", " << m_z << ")";
                 return;
@@ -1752,49 +1728,39 @@ void Chunk::createVertexBufferBatched(VulkanRenderer* renderer) {
         }
         // else: Reuse existing allocation (chunk is updating its mesh)
 
-        // Create staging buffers
-        renderer->createBuffer(vertexBufferSize,
-                              VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
-                              VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
-                              m_vertexStagingBuffer, m_vertexStagingBufferMemory);
-
-        renderer->createBuffer(indexBufferSize,
-                              VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
-                              VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
-                              m_indexStagingBuffer, m_indexStagingBufferMemory);
-
-        // Copy data to staging buffers
-        void* data;
-        vkMapMemory(device, m_vertexStagingBufferMemory, 0, vertexBufferSize, 0, &data);
-        memcpy(data, m_vertices.data(), (size_t)vertexBufferSize);
-        vkUnmapMemory(device, m_vertexStagingBufferMemory);
+        if (fromArena) {
+            renderer->batchCopyToMegaBuffer(arenaBuffer, vertexBufferSize, m_megaBufferVertexOffset,
+                                           false, m_arenaMesh.offset);
+        } else {
+            // Create staging buffer
+            renderer->createBuffer(vertexBufferSize,
+                                  VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+                                  VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+                                  m_vertexStagingBuffer, m_vertexStagingBufferMemory);
 
-        vkMapMemory(device, m_indexStagingBufferMemory, 0, indexBufferSize, 0, &data);
-        memcpy(data, m_indices.data(), (size_t)indexBufferSize);
-        vkUnmapMemory(device, m_indexStagingBufferMemory);
+            // Copy data to staging buffer
+            void* data;
+            vkMapMemory(device, m_vertexStagingBufferMemory, 0, vertexBufferSize, 0, &data);
+            memcpy(data, m_vertices.data(), (size_t)vertexBufferSize);
+            vkUnmapMemory(device, m_vertexStagingBufferMemory);
 
-        // Record batched copy to mega-buffer
-        renderer->batchCopyToMegaBuffer(m_vertexStagingBuffer, m_indexStagingBuffer,
-                                       vertexBufferSize, indexBufferSize,
-                                       m_megaBufferVertexOffset, m_megaBufferIndexOffset,
-                                       false);
+            // Record batched copy to mega-buffer
+            renderer->batchCopyToMegaBuffer(m_vertexStagingBuffer, vertexBufferSize, m_megaBufferVertexOffset,
+                                           false);
+        }
     }
 
     // ========== ALLOCATE AND UPLOAD TRANSPARENT GEOMETRY ==========
     if (m_transparentVertexCount > 0) {
-        VkDeviceSize vertexBufferSize = sizeof(CompressedVertex) * m_transparentVertices.size();
-        VkDeviceSize indexBufferSize = sizeof(uint32_t) * m_transparentIndices.size();
+        VkDeviceSize vertexBufferSize = sizeof(CompressedVertex) * m_transparentVertexCount;
 
         // OPTIMIZATION: Only allocate new space if we don't already have space
         // This prevents memory leak when chunks regenerate meshes for lighting updates
-        bool needsNewAllocation = (m_megaBufferTransparentVertexOffset == 0 &&
-                                   m_megaBufferTransparentIndexOffset == 0);
+        bool needsNewAllocation = (m_megaBufferTransparentVertexOffset == 0);
 
         if (needsNewAllocation) {
             // Allocate space in transparent mega-buffer
-            if (!renderer->allocateMegaBufferSpace(vertexBufferSize, indexBufferSize, true,
-                                                    m_megaBufferTransparentVertexOffset,
-                                                    m_megaBufferTransparentIndexOffset)) {
+            if (!renderer->allocateMegaBufferSpace(vertexBufferSize, true, m_megaBufferTransparentVertexOffset)) {
                 Logger::error() << "Failed to allocate transparent mega-buffer space for chunk at ("
                                << m_x << ", " << m_z << ")";
                 return;
@@ -1805,32 +1771,26 @@ void Chunk::createVertexBufferBatched(VulkanRenderer* renderer) {
         }
         // else: Reuse existing allocation (chunk is updating its mesh)
 
-        // Create staging buffers
-        renderer->createBuffer(vertexBufferSize,
-                              VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
-                              VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
-                              m_transparentVertexStagingBuffer, m_transparentVertexStagingBufferMemory);
-
-        renderer->createBuffer(indexBufferSize,
-                              VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
-                              VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
-                              m_transparentIndexStagingBuffer, m_transparentIndexStagingBufferMemory);
-
-        // Copy data to staging buffers
-        void* data;
-        vkMapMemory(device, m_transparentVertexStagingBufferMemory, 0, vertexBufferSize, 0, &data);
-        memcpy(data, m_transparentVertices.data(), (size_t)vertexBufferSize);
-        vkUnmapMemory(device, m_transparentVertexStagingBufferMemory);
+        if (fromArena) {
+            renderer->batchCopyToMegaBuffer(arenaBuffer, vertexBufferSize, m_megaBufferTransparentVertexOffset,
+                                           true, m_arenaMesh.offset + m_arenaTransparentVertexOffset);
+        } else {
+            // Create staging buffer
+            renderer->createBuffer(vertexBufferSize,
+                                  VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+                                  VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+                                  m_transparentVertexStagingBuffer, m_transparentVertexStagingBufferMemory);
 
-        vkMapMemory(device, m_transparentIndexStagingBufferMemory, 0, indexBufferSize, 0, &data);
-        memcpy(data, m_transparentIndices.data(), (size_t)indexBufferSize);
-        vkUnmapMemory(device, m_transparentIndexStagingBufferMemory);
+            // Copy data to staging buffer
+            void* data;
+            vkMapMemory(device, m_transparentVertexStagingBufferMemory, 0, vertexBufferSize, 0, &data);
+            memcpy(data, m_transparentVertices.data(), (size_t)vertexBufferSize);
+            vkUnmapMemory(device, m_transparentVertexStagingBufferMemory);
 
-        // Record batched copy to transparent mega-buffer
-        renderer->batchCopyToMegaBuffer(m_transparentVertexStagingBuffer, m_transparentIndexStagingBuffer,
-                                       vertexBufferSize, indexBufferSize,
-                                       m_megaBufferTransparentVertexOffset, m_megaBufferTransparentIndexOffset,
-                                       true);
+            // Record batched copy to transparent mega-buffer
+            renderer->batchCopyToMegaBuffer(m_transparentVertexStagingBuffer, vertexBufferSize,
+                                           m_megaBufferTransparentVertexOffset, true);
+        }
     }
 
 #else
@@ -1844,102 +1804,73 @@ void Chunk::createVertexBufferBatched(VulkanRenderer* renderer) {
     // Initialize staging buffers to NULL
     m_vertexStagingBuffer = VK_NULL_HANDLE;
     m_vertexStagingBufferMemory = VK_NULL_HANDLE;
-    m_indexStagingBuffer = VK_NULL_HANDLE;
-    m_indexStagingBufferMemory = VK_NULL_HANDLE;
     m_transparentVertexStagingBuffer = VK_NULL_HANDLE;
     m_transparentVertexStagingBufferMemory = VK_NULL_HANDLE;
-    m_transparentIndexStagingBuffer = VK_NULL_HANDLE;
-    m_transparentIndexStagingBufferMemory = VK_NULL_HANDLE;
 
     // ========== CREATE OPAQUE BUFFERS (BATCHED) ==========
     if (m_vertexCount > 0) {
         // Create vertex staging buffer and device buffer
-        VkDeviceSize vertexBufferSize = sizeof(CompressedVertex) * m_vertices.size();
-
-        renderer->createBuffer(vertexBufferSize,
-                              VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
-                              VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
-                              m_vertexStagingBuffer, m_vertexStagingBufferMemory);
-
-        void* data;
-        vkMapMemory(device, m_vertexStagingBufferMemory, 0, vertexBufferSize, 0, &data);
-        memcpy(data, m_vertices.data(), (size_t)vertexBufferSize);
-        vkUnmapMemory(device, m_vertexStagingBufferMemory);
+        VkDeviceSize vertexBufferSize = sizeof(CompressedVertex) * m_vertexCount;
 
         renderer->createBuffer(vertexBufferSize,
                               VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_VERTEX_BUFFER_BIT,
                               VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
                               m_vertexBuffer, m_vertexBufferMemory);
 
-        // Record copy command (doesn't submit yet)
-        renderer->batchCopyBuffer(m_vertexStagingBuffer, m_vertexBuffer, vertexBufferSize);
-
-        // Create index staging buffer and device buffer
-        VkDeviceSize indexBufferSize = sizeof(uint32_t) * m_indices.size();
-
-        renderer->createBuffer(indexBufferSize,
-                              VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
-                              VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
-                              m_indexStagingBuffer, m_indexStagingBufferMemory);
-
-        vkMapMemory(device, m_indexStagingBufferMemory, 0, indexBufferSize, 0, &data);
-        memcpy(data, m_indices.data(), (size_t)indexBufferSize);
-        vkUnmapMemory(device, m_indexStagingBufferMemory);
+        if (fromArena) {
+            renderer->batchCopyBuffer(arenaBuffer, m_vertexBuffer, vertexBufferSize, m_arenaMesh.offset);
+        } else {
+            renderer->createBuffer(vertexBufferSize,
+                                  VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+                                  VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+                                  m_vertexStagingBuffer, m_vertexStagingBufferMemory);
 
-        renderer->createBuffer(indexBufferSize,
-                              VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_INDEX_BUFFER_BIT,
-                              VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
-                              m_indexBuffer, m_indexBufferMemory);
+            void* data;
+            vkMapMemory(device, m_vertexStagingBufferMemory, 0, vertexBufferSize, 0, &data);
+            memcpy(data, m_vertices.data(), (size_t)vertexBufferSize);
+            vkUnmapMemory(device, m_vertexStagingBufferMemory);
 
-        // Record copy command (doesn't submit yet)
-        renderer->batchCopyBuffer(m_indexStagingBuffer, m_indexBuffer, indexBufferSize);
+            // Record copy command (doesn't submit yet)
+            renderer->batchCopyBuffer(m_vertexStagingBuffer, m_vertexBuffer, vertexBufferSize);
+        }
     }
 
     // ========== CREATE TRANSPARENT BUFFERS (BATCHED) ==========
     if (m_transparentVertexCount > 0) {
         // Create transparent vertex staging buffer and device buffer
-        VkDeviceSize vertexBufferSize = sizeof(CompressedVertex) * m_transparentVertices.size();
-
-        renderer->createBuffer(vertexBufferSize,
-                              VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
-                              VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
-                              m_transparentVertexStagingBuffer, m_transparentVertexStagingBufferMemory);
-
-        void* data;
-        vkMapMemory(device, m_transparentVertexStagingBufferMemory, 0, vertexBufferSize, 0, &data);
-        memcpy(data, m_transparentVertices.data(), (size_t)vertexBufferSize);
-        vkUnmapMemory(device, m_transparentVertexStagingBufferMemory);
+        VkDeviceSize vertexBufferSize = sizeof(CompressedVertex) * m_transparentVertexCount;
 
         renderer->createBuffer(vertexBufferSize,
                               VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_VERTEX_BUFFER_BIT,
                               VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
                               m_transparentVertexBuffer, m_transparentVertexBufferMemory);
 
-        // Record copy command (doesn't submit yet)
-        renderer->batchCopyBuffer(m_transparentVertexStagingBuffer, m_transparentVertexBuffer, vertexBufferSize);
-
-        // Create transparent index staging buffer and device buffer
-        VkDeviceSize indexBufferSize = sizeof(uint32_t) * m_transparentIndices.size();
-
-        renderer->createBuffer(indexBufferSize,
-                              VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
-                              VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
-                              m_transparentIndexStagingBuffer, m_transparentIndexStagingBufferMemory);
-
-        vkMapMemory(device, m_transparentIndexStagingBufferMemory, 0, indexBufferSize, 0, &data);
-        memcpy(data, m_transparentIndices.data(), (size_t)indexBufferSize);
-        vkUnmapMemory(device, m_transparentIndexStagingBufferMemory);
+        if (fromArena) {
+            renderer->batchCopyBuffer(arenaBuffer, m_transparentVertexBuffer, vertexBufferSize,
+                                      m_arenaMesh.offset + m_arenaTransparentVertexOffset);
+        } else {
+            renderer->createBuffer(vertexBufferSize,
+                                  VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+                                  VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+                                  m_transparentVertexStagingBuffer, m_transparentVertexStagingBufferMemory);
 
-        renderer->createBuffer(indexBufferSize,
-                              VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_INDEX_BUFFER_BIT,
-                              VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
-                              m_transparentIndexBuffer, m_transparentIndexBufferMemory);
+            void* data;
+            vkMapMemory(device, m_transparentVertexStagingBufferMemory, 0, vertexBufferSize, 0, &data);
+            memcpy(data, m_transparentVertices.data(), (size_t)vertexBufferSize);
+            vkUnmapMemory(device, m_transparentVertexStagingBufferMemory);
 
-        // Record copy command (doesn't submit yet)
-        renderer->batchCopyBuffer(m_transparentIndexStagingBuffer, m_transparentIndexBuffer, indexBufferSize);
+            // Record copy command (doesn't submit yet)
+            renderer->batchCopyBuffer(m_transparentVertexStagingBuffer, m_transparentVertexBuffer, vertexBufferSize);
+        }
     }
 #endif
 
+    // The batch owns the arena slice from here; it is released when the copies complete
+    if (fromArena) {
+        renderer->releaseUploadArenaAfterBatch(m_arenaMesh.id);
+        m_arenaMesh = UploadArena::Allocation{};
+    }
+
     // NOTE: Don't clean up staging buffers yet - caller will call cleanupStagingBuffers() after batch submit
     // NOTE: Don't free CPU-side mesh data yet - we keep it in case of errors
 }
@@ -1947,7 +1878,7 @@ void Chunk::createVertexBufferBatched(VulkanRenderer* renderer) {
 void Chunk::cleanupStagingBuffers(VulkanRenderer* renderer) {
     VkDevice device = renderer->getDevice();
 
-    // Destroy opaque staging buffers
+    // Destroy opaque staging buffer
     if (m_vertexStagingBuffer != VK_NULL_HANDLE) {
         vkDestroyBuffer(device, m_vertexStagingBuffer, nullptr);
         m_vertexStagingBuffer = VK_NULL_HANDLE;
@@ -1957,16 +1888,7 @@ void Chunk::cleanupStagingBuffers(VulkanRenderer* renderer) {
         m_vertexStagingBufferMemory = VK_NULL_HANDLE;
     }
 
-    if (m_indexStagingBuffer != VK_NULL_HANDLE) {
-        vkDestroyBuffer(device, m_indexStagingBuffer, nullptr);
-        m_indexStagingBuffer = VK_NULL_HANDLE;
-    }
-    if (m_indexStagingBufferMemory != VK_NULL_HANDLE) {
-        vkFreeMemory(device, m_indexStagingBufferMemory, nullptr);
-        m_indexStagingBufferMemory = VK_NULL_HANDLE;
-    }
-
-    // Destroy transparent staging buffers
+    // Destroy transparent staging buffer
     if (m_transparentVertexStagingBuffer != VK_NULL_HANDLE) {
         vkDestroyBuffer(device, m_transparentVertexStagingBuffer, nullptr);
         m_transparentVertexStagingBuffer = VK_NULL_HANDLE;
@@ -1976,64 +1898,42 @@ void Chunk::cleanupStagingBuffers(VulkanRenderer* renderer) {
         m_transparentVertexStagingBufferMemory = VK_NULL_HANDLE;
     }
 
-    if (m_transparentIndexStagingBuffer != VK_NULL_HANDLE) {
-        vkDestroyBuffer(device, m_transparentIndexStagingBuffer, nullptr);
-        m_transparentIndexStagingBuffer = VK_NULL_HANDLE;
-    }
-    if (m_transparentIndexStagingBufferMemory != VK_NULL_HANDLE) {
-        vkFreeMemory(device, m_transparentIndexStagingBufferMemory, nullptr);
-        m_transparentIndexStagingBufferMemory = VK_NULL_HANDLE;
-    }
-
     // Free CPU-side mesh data after successful GPU upload
     if (m_vertexCount > 0) {
         m_vertices.clear();
         m_vertices.shrink_to_fit();
-        m_indices.clear();
-        m_indices.shrink_to_fit();
     }
 
     if (m_transparentVertexCount > 0) {
         m_transparentVertices.clear();
         m_transparentVertices.shrink_to_fit();
-        m_transparentIndices.clear();
-        m_transparentIndices.shrink_to_fit();
     }
 }
 
 void Chunk::render(VkCommandBuffer commandBuffer, bool transparent) {
+    // The caller binds the renderer's shared quad index buffer (VulkanRenderer::getQuadIndexBuffer)
+    auto drawQuads = [&](VkBuffer vertexBuffer, uint32_t vertexCount) {
+        VkBuffer vertexBuffers[] = {vertexBuffer};
+        VkDeviceSize offsets[] = {0};
+        vkCmdBindVertexBuffers(commandBuffer, 0, 1, vertexBuffers, offsets);
+
+        QuadIndex::forEachDraw(vertexCount, 0, [&](uint32_t indexCount, int32_t vertexOffset) {
+            vkCmdDrawIndexed(commandBuffer, indexCount, 1, 0, vertexOffset, 0);
+        });
+    };
+
     if (transparent) {
         // Render transparent geometry
         if (m_transparentVertexCount == 0) {
             return;  // Nothing to render
         }
-
-        // Bind transparent vertex buffer
-        VkBuffer vertexBuffers[] = {m_transparentVertexBuffer};
-        VkDeviceSize offsets[] = {0};
-        vkCmdBindVertexBuffers(commandBuffer, 0, 1, vertexBuffers, offsets);
-
-        // Bind transparent index buffer
-        vkCmdBindIndexBuffer(commandBuffer, m_transparentIndexBuffer, 0, VK_INDEX_TYPE_UINT32);
-
-        // Draw indexed
-        vkCmdDrawIndexed(commandBuffer, m_transparentIndexCount, 1, 0, 0, 0);
+        drawQuads(m_transparentVertexBuffer, m_transparentVertexCount);
     } else {
         // Render opaque geometry
         if (m_vertexCount == 0) {
             return;  // Nothing to render
         }
-
-        // Bind vertex buffer
-        VkBuffer vertexBuffers[] = {m_vertexBuffer};
-        VkDeviceSize offsets[] = {0};
-        vkCmdBindVertexBuffers(commandBuffer, 0, 1, vertexBuffers, offsets);
-
-        // Bind index buffer
-        vkCmdBindIndexBuffer(commandBuffer, m_indexBuffer, 0, VK_INDEX_TYPE_UINT32);
-
-        // Draw indexed
-        vkCmdDrawIndexed(commandBuffer, m_indexCount, 1, 0, 0, 0);
+        drawQuads(m_vertexBuffer, m_vertexCount);
     }
 }
 
@@ -2052,16 +1952,37 @@ void Chunk::setBlock(int x, int y, int z, int blockID) {
     }
     // THREAD SAFETY (2025-11-23): Lock for concurrent writes during parallel decoration
     std::lock_guard<std::mutex> lock(m_blockDataMutex);
+    const int oldID = m_blocks[x][y][z];
     m_blocks[x][y][z] = blockID;
 
-    // PERFORMANCE: Invalidate isEmpty cache (will be recomputed lazily)
-    m_isEmptyValid = false;
+    // PERFORMANCE: O(1) brick occupancy update (also answers isEmpty())
+    m_bricks.update(BlockRegistry::instance().properties(), x, y, z, oldID, blockID);
 
     // PERFORMANCE: Update heightmap for fast sky light calculation
     // Only update if this block change might affect the highest block in the column
     updateHeightAt(x, z);
 }
 
+// ========== Scheduled Block Ticks ==========
+
+bool Chunk::scheduleTick(int x, int y, int z, int blockID, uint32_t delayTicks) {
+    if (x < 0 || x >= WIDTH || y < 0 || y >= HEIGHT || z < 0 || z >= DEPTH || blockID < 0) {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(m_tickMutex);
+    if (!m_tickWheel.schedule(tickIndex(x, y, z), static_cast<uint16_t>(blockID), delayTicks)) {
+        return false;
+    }
+    m_pendingTickCount.store(static_cast<uint32_t>(m_tickWheel.size()), std::memory_order_relaxed);
+    return true;
+}
+
+void Chunk::advanceTicks(std::vector<ScheduledTick>& due) {
+    std::lock_guard<std::mutex> lock(m_tickMutex);
+    m_tickWheel.advance(due);
+    m_pendingTickCount.store(static_cast<uint32_t>(m_tickWheel.size()), std::memory_order_relaxed);
+}
+
 uint8_t Chunk::getBlockMetadata(int x, int y, int z) const {
     if (x < 0 || x >= WIDTH || y < 0 || y >= HEIGHT || z < 0 || z >= DEPTH) {
         return 0;  // Out of bounds
@@ -2080,6 +2001,96 @@ void Chunk::setBlockMetadata(int x, int y, int z, uint8_t metadata) {
     m_blockMetadata[x][y][z] = metadata;
 }
 
+// ========== Template Placement ==========
+
+/**
+ * @brief Calls fn(x, y, z0, z1, blockID) for each template span clipped to [0, 32)^3
+ */
+template <typename Fn>
+static void forEachClippedSpan(const StructureTemplate& tmpl, const glm::ivec3& origin, Fn&& fn) {
+    if (tmpl.empty()) return;
+
+    const int yBegin = std::max(tmpl.getMin().y + origin.y, 0);
+    const int yEnd = std::min(tmpl.getMax().y + origin.y, Chunk::HEIGHT);
+    if (yBegin >= yEnd ||
+        tmpl.getMax().x + origin.x <= 0 || tmpl.getMin().x + origin.x >= Chunk::WIDTH ||
+        tmpl.getMax().z + origin.z <= 0 || tmpl.getMin().z + origin.z >= Chunk::DEPTH) {
+        return;
+    }
+
+    for (int y = yBegin; y < yEnd; y++) {
+        // Spans are sorted by X: skip to the first one inside the chunk
+        const TemplateSpan* end = tmpl.sliceEnd(y - origin.y);
+        const TemplateSpan* first = std::lower_bound(tmpl.sliceBegin(y - origin.y), end, -origin.x,
+            [](const TemplateSpan& span, int x) { return span.x < x; });
+        for (const TemplateSpan* span = first; span != end; ++span) {
+            const int x = span->x + origin.x;
+            if (x >= Chunk::WIDTH) break;
+            const int z0 = std::max(span->z + origin.z, 0);
+            const int z1 = std::min(span->z + origin.z + static_cast<int>(span->length), Chunk::DEPTH);
+            if (z0 < z1) {
+                fn(x, y, z0, z1, span->blockID);
+            }
+        }
+    }
+}
+
+int Chunk::blitTemplate(const StructureTemplate& tmpl, const glm::ivec3& origin) {
+    // Templates only add blocks, so a column's height can only rise to the highest
+    // opaque block written - unless a non-opaque block replaced the current top, in
+    // which case that column is rescanned (same opacity rule as updateHeightAt)
+    const BlockPropertyTable& props = BlockRegistry::instance().properties();
+    std::array<int16_t, WIDTH * DEPTH> highestOpaque;
+    highestOpaque.fill(-1);
+    std::array<uint32_t, WIDTH> rescanColumns{};  // Bit z of [x] = rescan column (x, z)
+    int written = 0;
+
+    std::lock_guard<std::mutex> lock(m_blockDataMutex);
+    forEachClippedSpan(tmpl, origin, [&](int x, int y, int z0, int z1, int blockID) {
+        for (int z = z0; z < z1; z++) {
+            m_bricks.update(props, x, y, z, m_blocks[x][y][z], blockID);
+        }
+        std::fill(&m_blocks[x][y][z0], &m_blocks[x][y][0] + z1, blockID);
+        written += z1 - z0;
+
+        const uint8_t flags = props.flags(blockID);
+        const bool opaque = !(flags & BlockFlags::VALID) || (flags & BlockFlags::OPAQUE);
+        for (int z = z0; z < z1; z++) {
+            const int column = x * DEPTH + z;
+            if (opaque) {
+                highestOpaque[column] = std::max<int16_t>(highestOpaque[column], static_cast<int16_t>(y));
+            } else if (m_heightMap[column] == y) {
+                rescanColumns[x] |= 1u << z;
+            }
+        }
+    });
+
+    if (written > 0) {
+        for (int x = 0; x < WIDTH; x++) {
+            for (int z = 0; z < DEPTH; z++) {
+                if (rescanColumns[x] & (1u << z)) {
+                    updateHeightAt(x, z);
+                } else if (highestOpaque[x * DEPTH + z] > m_heightMap[x * DEPTH + z]) {
+                    m_heightMap[x * DEPTH + z] = highestOpaque[x * DEPTH + z];
+                }
+            }
+        }
+    }
+    return written;
+}
+
+bool Chunk::isTemplateClear(const StructureTemplate& tmpl, const glm::ivec3& origin, int replaceableID) const {
+    bool clear = true;
+    std::lock_guard<std::mutex> lock(m_blockDataMutex);
+    forEachClippedSpan(tmpl, origin, [&](int x, int y, int z0, int z1, int) {
+        for (int z = z0; z < z1 && clear; z++) {
+            const int existing = m_blocks[x][y][z];
+            clear = existing == 0 || existing == replaceableID;
+        }
+    });
+    return clear;
+}
+
 // ========== Lighting Accessors ==========
 
 uint8_t Chunk::getSkyLight(int x, int y, int z) const {
@@ -2106,85 +2117,54 @@ void Chunk::setSkyLight(int x, int y, int z, uint8_t value) {
     m_lightData[index].skyLight = value & 0x0F;  // Clamp to 4 bits (0-15)
 }
 
-float Chunk::getInterpolatedSkyLight(int x, int y, int z) const {
-    // PERFORMANCE OPTIMIZATION (2025-11-23): Return direct lighting value (no interpolation)
-    // Interpolation was causing 40-80M operations/sec on lower-end hardware
+uint8_t Chunk::getPreviousBlockLight(int x, int y, int z) const {
     if (x < 0 || x >= WIDTH || y < 0 || y >= HEIGHT || z < 0 || z >= DEPTH) {
-        return 0.0f;  // Out of bounds
+        return 0;  // Out of bounds
     }
     int index = x + y * WIDTH + z * WIDTH * HEIGHT;
-    return static_cast<float>(m_lightData[index].skyLight);
-}
-
-float Chunk::getInterpolatedBlockLight(int x, int y, int z) const {
-    // PERFORMANCE OPTIMIZATION (2025-11-23): Return direct lighting value (no interpolation)
-    // Interpolation was causing 40-80M operations/sec on lower-end hardware
-    if (x < 0 || x >= WIDTH || y < 0 || y >= HEIGHT || z < 0 || z >= DEPTH) {
-        return 0.0f;  // Out of bounds
+    if (!m_hasMeshedLight) {
+        return m_lightData[index].blockLight;  // First mesh: nothing to transition from
     }
-    int index = x + y * WIDTH + z * WIDTH * HEIGHT;
-    return static_cast<float>(m_lightData[index].blockLight);
+    if (!m_meshedBlockLight) {
+        return 0;  // Last mesh was completely dark
+    }
+    uint8_t pair = (*m_meshedBlockLight)[index >> 1];
+    return (index & 1) ? (pair >> 4) : (pair & 0x0F);
 }
 
-// ========== Lazy Interpolated Lighting (Memory Optimization 2025-11-25) ==========
+// ========== GPU Light Transitions (2025-11-28) ==========
 
-void Chunk::ensureInterpolatedLightingAllocated() {
-    if (!m_interpolatedLightData) {
-        m_interpolatedLightData = std::make_unique<InterpolatedLightArray>();
-        // Initialize to match target values (prevents fade-in)
-        for (int i = 0; i < WIDTH * HEIGHT * DEPTH; ++i) {
-            (*m_interpolatedLightData)[i].skyLight = static_cast<float>(m_lightData[i].skyLight);
-            (*m_interpolatedLightData)[i].blockLight = static_cast<float>(m_lightData[i].blockLight);
+void Chunk::captureMeshedBlockLight() {
+    // MEMORY: Most chunks carry no block light at all - keep the snapshot unallocated for them
+    bool anyLight = false;
+    for (const BlockLight& light : m_lightData) {
+        if (light.blockLight != 0) {
+            anyLight = true;
+            break;
         }
     }
-}
 
-void Chunk::deallocateInterpolatedLighting() {
-    m_interpolatedLightData.reset();
-}
-
-void Chunk::updateInterpolatedLighting(float deltaTime, float speed) {
-    // MEMORY OPTIMIZATION: Only update if allocated (visible chunk)
-    if (!m_interpolatedLightData) return;
-
-    // Smoothly interpolate current lighting toward target lighting values
-    // This creates natural, gradual lighting transitions over time
-    const float lerpFactor = 1.0f - std::exp(-speed * deltaTime);  // Exponential smoothing
-
-    for (int i = 0; i < WIDTH * HEIGHT * DEPTH; ++i) {
-        const BlockLight& target = m_lightData[i];
-        InterpolatedLight& current = (*m_interpolatedLightData)[i];
-
-        // Interpolate toward target values
-        float targetSky = static_cast<float>(target.skyLight);
-        float targetBlock = static_cast<float>(target.blockLight);
-
-        current.skyLight += (targetSky - current.skyLight) * lerpFactor;
-        current.blockLight += (targetBlock - current.blockLight) * lerpFactor;
+    m_hasMeshedLight = true;
+    if (!anyLight) {
+        m_meshedBlockLight.reset();
+        return;
+    }
 
-        // Snap to target if very close (prevents infinite asymptotic approach)
-        if (std::abs(current.skyLight - targetSky) < 0.01f) {
-            current.skyLight = targetSky;
-        }
-        if (std::abs(current.blockLight - targetBlock) < 0.01f) {
-            current.blockLight = targetBlock;
-        }
+    if (!m_meshedBlockLight) {
+        m_meshedBlockLight = std::make_unique<PackedLightArray>();
+    }
+    for (size_t i = 0; i < m_meshedBlockLight->size(); ++i) {
+        (*m_meshedBlockLight)[i] = static_cast<uint8_t>(m_lightData[2 * i].blockLight |
+                                                        (m_lightData[2 * i + 1].blockLight << 4));
     }
 }
 
-void Chunk::initializeInterpolatedLighting() {
-    // MEMORY OPTIMIZATION: Lazy allocate on first use
-    ensureInterpolatedLightingAllocated();
-
-    // Initialize interpolated values to match target values immediately
-    // This prevents fade-in effect when chunks are first loaded
-    for (int i = 0; i < WIDTH * HEIGHT * DEPTH; ++i) {
-        const BlockLight& target = m_lightData[i];
-        InterpolatedLight& current = (*m_interpolatedLightData)[i];
-
-        current.skyLight = static_cast<float>(target.skyLight);
-        current.blockLight = static_cast<float>(target.blockLight);
+float Chunk::getLightTransitionBlend(std::chrono::steady_clock::time_point now) const {
+    if (m_lightTransitionStart == std::chrono::steady_clock::time_point{}) {
+        return 1.0f;  // No transition since the last upload
     }
+    float elapsed = std::chrono::duration<float>(now - m_lightTransitionStart).count();
+    return std::clamp(elapsed / LIGHT_TRANSITION_SECONDS, 0.0f, 1.0f);
 }
 
 void Chunk::setBlockLight(int x, int y, int z, uint8_t value) {
@@ -2202,18 +2182,31 @@ void Chunk::updateHeightAt(int x, int z) {
 
     // Scan from top to bottom to find highest OPAQUE block
     // BUG FIX: Must check transparency to avoid treating water/ice/leaves as solid
+    // PERFORMANCE (2025-11-28): Walk the column's 4 bricks first - EMPTY bricks are
+    // skipped, an OPAQUE brick answers with its top layer, only MIXED ones are scanned
     int16_t highestY = -1;
-    for (int y = HEIGHT - 1; y >= 0; y--) {
+    const BlockPropertyTable& props = BlockRegistry::instance().properties();
+    int scanTop = -1;
+    for (int by = ChunkBricks::PER_AXIS - 1; by >= 0 && scanTop < 0; by--) {
+        const BrickState state = m_bricks.state(ChunkBricks::brickIndex(x >> ChunkBricks::SHIFT, by, z >> ChunkBricks::SHIFT));
+        if (state == BrickState::OPAQUE) {
+            m_heightMap[x * DEPTH + z] = static_cast<int16_t>(by * ChunkBricks::SIZE + ChunkBricks::SIZE - 1);
+            return;
+        }
+        if (state == BrickState::MIXED) {
+            scanTop = by * ChunkBricks::SIZE + ChunkBricks::SIZE - 1;
+        }
+    }
+    for (int y = scanTop; y >= 0; y--) {
         int blockID = m_blocks[x][y][z];
         if (blockID != 0) {  // Not air
             // Check if block is opaque (blocks sunlight)
-            auto& registry = BlockRegistry::instance();
-            if (blockID >= 0 && blockID < registry.count()) {
-                const BlockDefinition& blockDef = registry.get(blockID);
+            const uint8_t flags = props.flags(blockID);
+            if (flags & BlockFlags::VALID) {
                 // Only FULLY opaque blocks (transparency == 0) should block sunlight
                 // This allows water, ice, glass, and leaves to let sunlight through
                 // Minecraft-style: transparent blocks don't stop sunlight column
-                if (blockDef.transparency == 0.0f) {
+                if (flags & BlockFlags::OPAQUE) {
                     highestY = static_cast<int16_t>(y);
                     break;
                 }
@@ -2456,13 +2449,25 @@ bool Chunk::decompressLighting(const std::vector<uint8_t>& input) {
  * Performance: Checking 6 neighbors = 6 pointer lookups + 6 face scans
  * Benefit: Skip mesh generation + rendering for ~40% of underground chunks
  */
-bool Chunk::isFullyOccluded(World* world, bool callerHoldsLock) const {
+bool Chunk::isFullyOccluded(World* world) const {
     if (!world) return false;
 
     // Helper lambda: Check if a chunk face is completely solid (no gaps)
     auto isFaceSolid = [](const Chunk* chunk, int face) -> bool {
         if (!chunk) return false;
 
+        // PERFORMANCE (2025-11-28): Decide from the 16 bricks on that face when possible -
+        // all OPAQUE = no air, any EMPTY = air; only otherwise scan the 1024 blocks
+        static constexpr uint64_t faceLayers[6] = {
+            ChunkBricks::LAYER_X3, ChunkBricks::LAYER_X0, ChunkBricks::LAYER_Y3,
+            ChunkBricks::LAYER_Y0, ChunkBricks::LAYER_Z3, ChunkBricks::LAYER_Z0
+        };
+        if (face >= 0 && face < 6) {
+            const uint64_t layer = faceLayers[face];
+            if ((chunk->m_bricks.opaque() & layer) == layer) return true;
+            if ((chunk->m_bricks.occupied() & layer) != layer) return false;
+        }
+
         // face: 0=+X, 1=-X, 2=+Y, 3=-Y, 4=+Z, 5=-Z
         switch (face) {
             case 0: // +X face (x=31)
@@ -2512,13 +2517,13 @@ bool Chunk::isFullyOccluded(World* world, bool callerHoldsLock) const {
         }
     };
 
-    // Get all 6 neighbors (use unsafe version if caller holds lock to prevent deadlock)
-    Chunk* neighborPosX = callerHoldsLock ? world->getChunkAtUnsafe(m_x + 1, m_y, m_z) : world->getChunkAt(m_x + 1, m_y, m_z);
-    Chunk* neighborNegX = callerHoldsLock ? world->getChunkAtUnsafe(m_x - 1, m_y, m_z) : world->getChunkAt(m_x - 1, m_y, m_z);
-    Chunk* neighborPosY = callerHoldsLock ? world->getChunkAtUnsafe(m_x, m_y + 1, m_z) : world->getChunkAt(m_x, m_y + 1, m_z);
-    Chunk* neighborNegY = callerHoldsLock ? world->getChunkAtUnsafe(m_x, m_y - 1, m_z) : world->getChunkAt(m_x, m_y - 1, m_z);
-    Chunk* neighborPosZ = callerHoldsLock ? world->getChunkAtUnsafe(m_x, m_y, m_z + 1) : world->getChunkAt(m_x, m_y, m_z + 1);
-    Chunk* neighborNegZ = callerHoldsLock ? world->getChunkAtUnsafe(m_x, m_y, m_z - 1) : world->getChunkAt(m_x, m_y, m_z - 1);
+    // Get all 6 neighbors
+    Chunk* neighborPosX = world->getChunkAt(m_x + 1, m_y, m_z);
+    Chunk* neighborNegX = world->getChunkAt(m_x - 1, m_y, m_z);
+    Chunk* neighborPosY = world->getChunkAt(m_x, m_y + 1, m_z);
+    Chunk* neighborNegY = world->getChunkAt(m_x, m_y - 1, m_z);
+    Chunk* neighborPosZ = world->getChunkAt(m_x, m_y, m_z + 1);
+    Chunk* neighborNegZ = world->getChunkAt(m_x, m_y, m_z - 1);
 
     // Check if all 6 neighbors exist and have solid facing faces
     return neighborPosX && isFaceSolid(neighborPosX, 1) &&  // Neighbor's -X face blocks our +X
@@ -2529,75 +2534,225 @@ bool Chunk::isFullyOccluded(World* world, bool callerHoldsLock) const {
            neighborNegZ && isFaceSolid(neighborNegZ, 4);    // Neighbor's +Z face blocks our -Z
 }
 
-bool Chunk::save(const std::string& worldPath) const {
-    namespace fs = std::filesystem;
+namespace {
 
-    try {
-        // EMPTY CHUNK CULLING: Don't save empty chunks (saves disk space!)
-        // Sky chunks at high Y are all air - no need to save/load them
-        if (isEmpty()) {
-            // Delete the file if it exists (chunk may have been cleared)
-            fs::path chunksDir = fs::path(worldPath) / "chunks";
-            // OPTIMIZATION: Use ostringstream instead of string concatenation (3x faster, single allocation)
-            std::ostringstream oss;
-            oss << "chunk_" << m_x << "_" << m_y << "_" << m_z << ".dat";
-            fs::path filepath = chunksDir / oss.str();
-            if (fs::exists(filepath)) {
-                fs::remove(filepath);
-                Logger::debug() << "Deleted empty chunk file (" << m_x << ", " << m_y << ", " << m_z << ")";
+// Chunk file codec layout
+constexpr uint32_t CHUNK_FILE_VERSION = 4;           ///< RLE blocks + metadata + lighting + scheduled ticks
+constexpr size_t CHUNK_FILE_HEADER_SIZE = 16;        ///< version + x + y + z
+
+std::filesystem::path chunkFilePath(const std::string& worldPath, int chunkX, int chunkY, int chunkZ) {
+    // OPTIMIZATION: Use ostringstream instead of string concatenation (3x faster, single allocation)
+    std::ostringstream oss;
+    oss << "chunk_" << chunkX << "_" << chunkY << "_" << chunkZ << ".dat";
+    return std::filesystem::path(worldPath) / "chunks" / oss.str();
+}
+
+void appendU32(std::vector<uint8_t>& output, uint32_t value) {
+    const uint8_t* bytes = reinterpret_cast<const uint8_t*>(&value);
+    output.insert(output.end(), bytes, bytes + sizeof(uint32_t));
+}
+
+void appendSection(std::vector<uint8_t>& output, const std::vector<uint8_t>& section) {
+    appendU32(output, static_cast<uint32_t>(section.size()));
+    output.insert(output.end(), section.begin(), section.end());
+}
+
+// Reads a [size (4 bytes), data] section; false if it runs past the end
+bool readSection(const std::vector<uint8_t>& input, size_t& offset, std::vector<uint8_t>& section) {
+    uint32_t size;
+    if (offset + sizeof(uint32_t) > input.size()) return false;
+    std::memcpy(&size, input.data() + offset, sizeof(uint32_t));
+    offset += sizeof(uint32_t);
+    if (offset + size > input.size()) return false;
+    section.assign(input.begin() + offset, input.begin() + offset + size);
+    offset += size;
+    return true;
+}
+
+} // namespace
+
+void Chunk::encode(std::vector<uint8_t>& output) const {
+    // RLE COMPRESSION: Compress block, metadata, and lighting data
+    std::vector<uint8_t> compressedBlocks, compressedMetadata, compressedLighting;
+    compressBlocks(compressedBlocks);
+    compressMetadata(compressedMetadata);
+    compressLighting(compressedLighting);
+
+    // Version 4: pending scheduled ticks (remaining delays, 8 bytes each; empty if none)
+    std::vector<uint8_t> scheduledTicks;
+    {
+        std::lock_guard<std::mutex> lock(m_tickMutex);
+        if (!m_tickWheel.empty()) {
+            m_tickWheel.serialize(scheduledTicks);
+        }
+    }
+
+    output.clear();
+    output.reserve(CHUNK_FILE_HEADER_SIZE + 4 * sizeof(uint32_t) + compressedBlocks.size() +
+                   compressedMetadata.size() + compressedLighting.size() + scheduledTicks.size());
+
+    // Header (version 4: RLE compression + LIGHTING PERSISTENCE + scheduled ticks)
+    appendU32(output, CHUNK_FILE_VERSION);
+    appendU32(output, static_cast<uint32_t>(m_x));
+    appendU32(output, static_cast<uint32_t>(m_y));
+    appendU32(output, static_cast<uint32_t>(m_z));
+
+    // Sections: [size (4 bytes), data] for blocks (typically 2-8 KB instead of 128 KB),
+    // metadata (<500 bytes instead of 32 KB) and lighting (1-3 KB instead of 32 KB)
+    appendSection(output, compressedBlocks);
+    appendSection(output, compressedMetadata);
+    appendSection(output, compressedLighting);
+    appendSection(output, scheduledTicks);
+}
+
+bool Chunk::decode(const std::vector<uint8_t>& input) {
+    if (input.size() < CHUNK_FILE_HEADER_SIZE) {
+        return false;
+    }
+
+    // Read header (16 bytes)
+    uint32_t version;
+    int fileX, fileY, fileZ;
+    std::memcpy(&version, input.data(), sizeof(uint32_t));
+    std::memcpy(&fileX, input.data() + 4, sizeof(int));
+    std::memcpy(&fileY, input.data() + 8, sizeof(int));
+    std::memcpy(&fileZ, input.data() + 12, sizeof(int));
+
+    // Verify coordinates match
+    if (fileX != m_x || fileY != m_y || fileZ != m_z) {
+        return false;  // Coordinate mismatch
+    }
+
+    size_t offset = CHUNK_FILE_HEADER_SIZE;
+
+    // Handle different file versions
+    if (version == 1) {
+        // LEGACY FORMAT: Uncompressed data (backwards compatibility)
+        if (input.size() < offset + sizeof(m_blocks) + sizeof(m_blockMetadata)) {
+            return false;
+        }
+        std::memcpy(m_blocks, input.data() + offset, sizeof(m_blocks));
+        std::memcpy(m_blockMetadata, input.data() + offset + sizeof(m_blocks), sizeof(m_blockMetadata));
+        Logger::debug() << "Loaded chunk (" << m_x << ", " << m_y << ", " << m_z << ") from legacy format";
+
+    } else if (version >= 2 && version <= 4) {
+        // RLE COMPRESSED FORMAT (version 3 adds LIGHTING PERSISTENCE, version 4 scheduled ticks)
+        std::vector<uint8_t> compressedBlocks, compressedMetadata, compressedLighting, scheduledTicks;
+        if (!readSection(input, offset, compressedBlocks) || !readSection(input, offset, compressedMetadata) ||
+            (version >= 3 && !readSection(input, offset, compressedLighting)) ||
+            (version >= 4 && !readSection(input, offset, scheduledTicks))) {
+            Logger::error() << "Truncated chunk data for chunk (" << m_x << ", " << m_y << ", " << m_z << ")";
+            return false;
+        }
+
+        // Decompress data
+        if (!decompressBlocks(compressedBlocks)) {
+            Logger::error() << "Failed to decompress block data for chunk (" << m_x << ", " << m_y << ", " << m_z << ")";
+            return false;
+        }
+        if (!decompressMetadata(compressedMetadata)) {
+            Logger::error() << "Failed to decompress metadata for chunk (" << m_x << ", " << m_y << ", " << m_z << ")";
+            return false;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(m_tickMutex);
+            if (!m_tickWheel.deserialize(scheduledTicks.data(), scheduledTicks.size())) {
+                Logger::warning() << "Dropped corrupted scheduled ticks for chunk (" << m_x << ", " << m_y << ", " << m_z << ")";
             }
-            return true;  // Success - nothing to save
+            m_pendingTickCount.store(static_cast<uint32_t>(m_tickWheel.size()), std::memory_order_relaxed);
         }
 
-        // Create chunks directory if it doesn't exist
-        fs::path chunksDir = fs::path(worldPath) / "chunks";
-        fs::create_directories(chunksDir);
+        if (version >= 3) {
+            if (!decompressLighting(compressedLighting)) {
+                Logger::error() << "Failed to decompress lighting data for chunk (" << m_x << ", " << m_y << ", " << m_z << ")";
+                return false;
+            }
 
-        // Create filename: chunk_X_Y_Z.dat
-        // OPTIMIZATION: Use ostringstream instead of string concatenation (3x faster, single allocation)
-        std::ostringstream oss;
-        oss << "chunk_" << m_x << "_" << m_y << "_" << m_z << ".dat";
-        fs::path filepath = chunksDir / oss.str();
+            // PERFORMANCE FIX (2025-11-23): Mark that chunk has lighting data to skip re-initialization
+            // This prevents double mesh generation for loaded chunks with lighting
+            m_hasLightingData = true;
+            Logger::debug() << "Loaded chunk (" << m_x << ", " << m_y << ", " << m_z << ") from RLE format v" << version << " WITH LIGHTING ("
+                           << compressedBlocks.size() << "+" << compressedMetadata.size() << "+"
+                           << compressedLighting.size() << " bytes) - instant lighting!";
+        } else {
+            // NOTE: Version 2 doesn't have lighting data, so caller must initialize lighting!
+            Logger::debug() << "Loaded chunk (" << m_x << ", " << m_y << ", " << m_z << ") from RLE format v2 ("
+                           << compressedBlocks.size() << "+" << compressedMetadata.size() << " bytes) - lighting will be calculated";
+        }
+
+    } else {
+        Logger::error() << "Unsupported chunk file version: " << version;
+        return false;  // Unsupported version
+    }
+
+    // Blocks were written directly - derived caches are stale
+    m_bricks.rebuild(BlockRegistry::instance().properties(), &m_blocks[0][0][0]);
+    rebuildHeightMap();
+
+    // FIXED (2025-11-23): Mark loaded chunks as NOT needing decoration
+    // Prevents overwriting player edits when chunks reload
+    m_needsDecoration = false;
+    return true;
+}
+
+bool Chunk::writeEncoded(const std::string& worldPath, int chunkX, int chunkY, int chunkZ,
+                         const std::vector<uint8_t>& data) {
+    namespace fs = std::filesystem;
+
+    try {
+        fs::path filepath = chunkFilePath(worldPath, chunkX, chunkY, chunkZ);
+        fs::create_directories(filepath.parent_path());
 
-        // Open file for binary writing
         std::ofstream file(filepath, std::ios::binary);
         if (!file.is_open()) {
             return false;
         }
+        file.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size()));
+        return file.good();
+
+    } catch (const std::exception&) {
+        return false;
+    }
+}
 
-        // RLE COMPRESSION: Compress block, metadata, and lighting data before writing
-        std::vector<uint8_t> compressedBlocks, compressedMetadata, compressedLighting;
-        compressBlocks(compressedBlocks);
-        compressMetadata(compressedMetadata);
-        compressLighting(compressedLighting);
-
-        // Write header (version 3 with RLE compression + LIGHTING PERSISTENCE!)
-        constexpr uint32_t CHUNK_FILE_VERSION = 3;
-        file.write(reinterpret_cast<const char*>(&CHUNK_FILE_VERSION), sizeof(uint32_t));
-        file.write(reinterpret_cast<const char*>(&m_x), sizeof(int));
-        file.write(reinterpret_cast<const char*>(&m_y), sizeof(int));
-        file.write(reinterpret_cast<const char*>(&m_z), sizeof(int));
-
-        // Write compressed block data size + data (variable size, typically 2-8 KB instead of 32 KB!)
-        uint32_t blockDataSize = static_cast<uint32_t>(compressedBlocks.size());
-        file.write(reinterpret_cast<const char*>(&blockDataSize), sizeof(uint32_t));
-        file.write(reinterpret_cast<const char*>(compressedBlocks.data()), blockDataSize);
-
-        // Write compressed metadata size + data (variable size, typically <500 bytes instead of 32 KB!)
-        uint32_t metadataSize = static_cast<uint32_t>(compressedMetadata.size());
-        file.write(reinterpret_cast<const char*>(&metadataSize), sizeof(uint32_t));
-        file.write(reinterpret_cast<const char*>(compressedMetadata.data()), metadataSize);
-
-        // Write compressed lighting data size + data (variable size, typically 1-3 KB instead of 32 KB!)
-        uint32_t lightingSize = static_cast<uint32_t>(compressedLighting.size());
-        file.write(reinterpret_cast<const char*>(&lightingSize), sizeof(uint32_t));
-        file.write(reinterpret_cast<const char*>(compressedLighting.data()), lightingSize);
+bool Chunk::removeSaved(const std::string& worldPath, int chunkX, int chunkY, int chunkZ) {
+    namespace fs = std::filesystem;
 
-        file.close();
+    std::error_code ec;
+    fs::path filepath = chunkFilePath(worldPath, chunkX, chunkY, chunkZ);
+    if (fs::remove(filepath, ec)) {
+        Logger::debug() << "Deleted empty chunk file (" << chunkX << ", " << chunkY << ", " << chunkZ << ")";
+    }
+    return !ec;
+}
+
+size_t Chunk::getMemoryUsage() const {
+    size_t bytes = sizeof(Chunk);
+    bytes += (m_vertices.capacity() + m_transparentVertices.capacity()) * sizeof(CompressedVertex);
+    if (m_meshedBlockLight) {
+        bytes += sizeof(PackedLightArray);
+    }
+    return bytes;
+}
+
+bool Chunk::save(const std::string& worldPath) const {
+    try {
+        // EMPTY CHUNK CULLING: Don't save empty chunks (saves disk space!)
+        // Sky chunks at high Y are all air - no need to save/load them
+        if (isEmpty()) {
+            // Delete the file if it exists (chunk may have been cleared)
+            return removeSaved(worldPath, m_x, m_y, m_z);
+        }
+
+        std::vector<uint8_t> encoded;
+        encode(encoded);
+        if (!writeEncoded(worldPath, m_x, m_y, m_z, encoded)) {
+            return false;
+        }
 
         Logger::debug() << "Saved chunk (" << m_x << ", " << m_y << ", " << m_z << ") with RLE+LIGHTING: "
-                       << blockDataSize << " bytes blocks, " << metadataSize << " bytes metadata, "
-                       << lightingSize << " bytes lighting (was 196608 bytes uncompressed)";
+                       << encoded.size() << " bytes (was 196608 bytes uncompressed)";
         return true;
 
     } catch (const std::exception&) {
@@ -2609,12 +2764,7 @@ bool Chunk::load(const std::string& worldPath) {
     namespace fs = std::filesystem;
 
     try {
-        // Build filepath
-        fs::path chunksDir = fs::path(worldPath) / "chunks";
-        // OPTIMIZATION: Use ostringstream instead of string concatenation (3x faster, single allocation)
-        std::ostringstream oss;
-        oss << "chunk_" << m_x << "_" << m_y << "_" << m_z << ".dat";
-        fs::path filepath = chunksDir / oss.str();
+        fs::path filepath = chunkFilePath(worldPath, m_x, m_y, m_z);
 
         // Check if file exists
         if (!fs::exists(filepath)) {
@@ -2622,126 +2772,18 @@ bool Chunk::load(const std::string& worldPath) {
         }
 
         // Open file for binary reading
-        std::ifstream file(filepath, std::ios::binary);
+        std::ifstream file(filepath, std::ios::binary | std::ios::ate);
         if (!file.is_open()) {
             return false;
         }
 
-        // Read header (16 bytes)
-        uint32_t version;
-        int fileX, fileY, fileZ;
-        file.read(reinterpret_cast<char*>(&version), sizeof(uint32_t));
-        file.read(reinterpret_cast<char*>(&fileX), sizeof(int));
-        file.read(reinterpret_cast<char*>(&fileY), sizeof(int));
-        file.read(reinterpret_cast<char*>(&fileZ), sizeof(int));
-
-        // Verify coordinates match
-        if (fileX != m_x || fileY != m_y || fileZ != m_z) {
-            file.close();
-            return false;  // Coordinate mismatch
-        }
-
-        // Handle different file versions
-        if (version == 1) {
-            // LEGACY FORMAT: Uncompressed data (backwards compatibility)
-            file.read(reinterpret_cast<char*>(m_blocks), WIDTH * HEIGHT * DEPTH * sizeof(int));
-            file.read(reinterpret_cast<char*>(m_blockMetadata), WIDTH * HEIGHT * DEPTH * sizeof(uint8_t));
-            file.close();
-            Logger::debug() << "Loaded chunk (" << m_x << ", " << m_y << ", " << m_z << ") from legacy format";
-
-            // FIXED (2025-11-23): Mark loaded chunks as NOT needing decoration
-            // Prevents overwriting player edits when chunks reload
-            m_needsDecoration = false;
-            return true;
-
-        } else if (version == 2) {
-            // RLE COMPRESSED FORMAT (NO LIGHTING): Read compressed data and decompress
-
-            // Read compressed block data
-            uint32_t blockDataSize;
-            file.read(reinterpret_cast<char*>(&blockDataSize), sizeof(uint32_t));
-            std::vector<uint8_t> compressedBlocks(blockDataSize);
-            file.read(reinterpret_cast<char*>(compressedBlocks.data()), blockDataSize);
-
-            // Read compressed metadata
-            uint32_t metadataSize;
-            file.read(reinterpret_cast<char*>(&metadataSize), sizeof(uint32_t));
-            std::vector<uint8_t> compressedMetadata(metadataSize);
-            file.read(reinterpret_cast<char*>(compressedMetadata.data()), metadataSize);
-
-            file.close();
-
-            // Decompress data
-            if (!decompressBlocks(compressedBlocks)) {
-                Logger::error() << "Failed to decompress block data for chunk (" << m_x << ", " << m_y << ", " << m_z << ")";
-                return false;
-            }
-            if (!decompressMetadata(compressedMetadata)) {
-                Logger::error() << "Failed to decompress metadata for chunk (" << m_x << ", " << m_y << ", " << m_z << ")";
-                return false;
-            }
-
-            // NOTE: Version 2 doesn't have lighting data, so caller must initialize lighting!
-            Logger::debug() << "Loaded chunk (" << m_x << ", " << m_y << ", " << m_z << ") from RLE format v2 ("
-                           << blockDataSize << "+" << metadataSize << " bytes) - lighting will be calculated";
-
-            // FIXED (2025-11-23): Mark loaded chunks as NOT needing decoration
-            m_needsDecoration = false;
-            return true;
-
-        } else if (version == 3) {
-            // RLE COMPRESSED FORMAT WITH LIGHTING PERSISTENCE: Read all compressed data
-
-            // Read compressed block data
-            uint32_t blockDataSize;
-            file.read(reinterpret_cast<char*>(&blockDataSize), sizeof(uint32_t));
-            std::vector<uint8_t> compressedBlocks(blockDataSize);
-            file.read(reinterpret_cast<char*>(compressedBlocks.data()), blockDataSize);
-
-            // Read compressed metadata
-            uint32_t metadataSize;
-            file.read(reinterpret_cast<char*>(&metadataSize), sizeof(uint32_t));
-            std::vector<uint8_t> compressedMetadata(metadataSize);
-            file.read(reinterpret_cast<char*>(compressedMetadata.data()), metadataSize);
-
-            // Read compressed lighting data (NEW IN VERSION 3!)
-            uint32_t lightingSize;
-            file.read(reinterpret_cast<char*>(&lightingSize), sizeof(uint32_t));
-            std::vector<uint8_t> compressedLighting(lightingSize);
-            file.read(reinterpret_cast<char*>(compressedLighting.data()), lightingSize);
-
-            file.close();
-
-            // Decompress all data
-            if (!decompressBlocks(compressedBlocks)) {
-                Logger::error() << "Failed to decompress block data for chunk (" << m_x << ", " << m_y << ", " << m_z << ")";
-                return false;
-            }
-            if (!decompressMetadata(compressedMetadata)) {
-                Logger::error() << "Failed to decompress metadata for chunk (" << m_x << ", " << m_y << ", " << m_z << ")";
-                return false;
-            }
-            if (!decompressLighting(compressedLighting)) {
-                Logger::error() << "Failed to decompress lighting data for chunk (" << m_x << ", " << m_y << ", " << m_z << ")";
-                return false;
-            }
-
-            // SUCCESS: Chunk loaded with lighting! No need for lighting recalculation!
-            Logger::debug() << "Loaded chunk (" << m_x << ", " << m_y << ", " << m_z << ") from RLE format v3 WITH LIGHTING ("
-                           << blockDataSize << "+" << metadataSize << "+" << lightingSize << " bytes) - instant lighting!";
-
-            // FIXED (2025-11-23): Mark loaded chunks as NOT needing decoration
-            m_needsDecoration = false;
-            // PERFORMANCE FIX (2025-11-23): Mark that chunk has lighting data to skip re-initialization
-            // This prevents double mesh generation for loaded chunks with lighting
-            m_hasLightingData = true;
-            return true;
+        // Read the whole file in one call (files are a few KB), then decode from memory
+        std::vector<uint8_t> data(static_cast<size_t>(file.tellg()));
+        file.seekg(0);
+        file.read(reinterpret_cast<char*>(data.data()), static_cast<std::streamsize>(data.size()));
+        file.close();
 
-        } else {
-            file.close();
-            Logger::error() << "Unsupported chunk file version: " << version;
-            return false;  // Unsupported version
-        }
+        return decode(data);
 
     } catch (const std::exception&) {
         return false;
@@ -0,0 +1,217 @@
+/**
+ * @file chunk_cache.cpp
+ * @brief Tiered LRU chunk cache implementation
+ *
+ * Created: 2025-11-28
+ */
+
+#include "chunk_cache.h"
+#include "chunk.h"
+#include "logger.h"
+
+void ChunkCache::setBudgets(size_t hotBytes, size_t warmBytes) {
+    m_hotBudget = hotBytes;
+    m_warmBudget = warmBytes;
+}
+
+void ChunkCache::insert(std::unique_ptr<Chunk> chunk, bool dirty, std::vector<std::unique_ptr<Chunk>>& released) {
+    if (!chunk) return;
+
+    ChunkCoord coord{chunk->getChunkX(), chunk->getChunkY(), chunk->getChunkZ()};
+
+    // Replace any stale entry for the same coordinate (newest data wins, dirtiness carries over)
+    std::unique_ptr<Chunk> staleChunk;
+    std::vector<uint8_t> staleEncoded;
+    bool staleDirty = false;
+    if (extract(coord, staleChunk, staleEncoded, staleDirty) != ChunkCacheTier::NONE) {
+        if (staleChunk) {
+            released.push_back(std::move(staleChunk));
+        }
+        dirty = dirty || staleDirty;
+    }
+
+    m_hotLru.push_front(coord);
+    HotEntry& entry = m_hot[coord];
+    entry.bytes = chunk->getMemoryUsage();
+    entry.dirty = dirty;
+    entry.lru = m_hotLru.begin();
+    entry.chunk = std::move(chunk);
+    m_hotBytes += entry.bytes;
+
+    enforceHotBudget(released);
+    enforceWarmBudget();
+
+    publishOccupancy();
+}
+
+ChunkCacheTier ChunkCache::take(const ChunkCoord& coord, std::unique_ptr<Chunk>& chunk,
+                                std::vector<uint8_t>& encoded, bool& dirty) {
+    ChunkCacheTier tier = extract(coord, chunk, encoded, dirty);
+    if (tier == ChunkCacheTier::HOT) {
+        m_hotHits.fetch_add(1, std::memory_order_relaxed);
+    } else if (tier == ChunkCacheTier::WARM) {
+        m_warmHits.fetch_add(1, std::memory_order_relaxed);
+    }
+    return tier;
+}
+
+ChunkCacheTier ChunkCache::extract(const ChunkCoord& coord, std::unique_ptr<Chunk>& chunk,
+                                   std::vector<uint8_t>& encoded, bool& dirty) {
+    ChunkCacheTier tier = ChunkCacheTier::NONE;
+
+    auto hotIt = m_hot.find(coord);
+    if (hotIt != m_hot.end()) {
+        chunk = std::move(hotIt->second.chunk);
+        dirty = hotIt->second.dirty;
+        m_hotBytes -= hotIt->second.bytes;
+        m_hotLru.erase(hotIt->second.lru);
+        m_hot.erase(hotIt);
+        tier = ChunkCacheTier::HOT;
+    } else {
+        auto warmIt = m_warm.find(coord);
+        if (warmIt != m_warm.end()) {
+            encoded = std::move(warmIt->second.encoded);
+            dirty = warmIt->second.dirty;
+            m_warmBytes -= encoded.size();
+            m_warmLru.erase(warmIt->second.lru);
+            m_warm.erase(warmIt);
+            tier = ChunkCacheTier::WARM;
+        }
+    }
+
+    if (tier != ChunkCacheTier::NONE) {
+        publishOccupancy();
+    }
+    return tier;
+}
+
+void ChunkCache::publishOccupancy() {
+    m_hotCount.store(m_hot.size(), std::memory_order_relaxed);
+    m_warmCount.store(m_warm.size(), std::memory_order_relaxed);
+    m_hotBytesSnapshot.store(m_hotBytes, std::memory_order_relaxed);
+    m_warmBytesSnapshot.store(m_warmBytes, std::memory_order_relaxed);
+}
+
+void ChunkCache::recordColdLookup(bool found) {
+    if (found) {
+        m_coldHits.fetch_add(1, std::memory_order_relaxed);
+    } else {
+        m_misses.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+void ChunkCache::enforceHotBudget(std::vector<std::unique_ptr<Chunk>>& released) {
+    while (m_hotBytes > m_hotBudget && !m_hotLru.empty()) {
+        ChunkCoord coord = m_hotLru.back();
+        m_hotLru.pop_back();
+
+        auto it = m_hot.find(coord);
+        HotEntry entry = std::move(it->second);
+        m_hot.erase(it);
+        m_hotBytes -= entry.bytes;
+
+        // Clean, undecorated chunks (far LOD terrain) regenerate identically; the codec
+        // can't carry the needs-decoration flag, so drop them rather than demote
+        if (!entry.dirty && entry.chunk->needsDecoration()) {
+            released.push_back(std::move(entry.chunk));
+            m_evictions.fetch_add(1, std::memory_order_relaxed);
+            continue;
+        }
+
+        // Demote: keep the chunk's data as codec bytes, recycle the object
+        std::vector<uint8_t> encoded;
+        entry.chunk->encode(encoded);
+        encoded.shrink_to_fit();
+        insertWarm(coord, std::move(encoded), entry.dirty, entry.chunk->isEmpty());
+        released.push_back(std::move(entry.chunk));
+        m_demotions.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+void ChunkCache::enforceWarmBudget() {
+    while (m_warmBytes > m_warmBudget && !m_warmLru.empty()) {
+        ChunkCoord coord = m_warmLru.back();
+        m_warmLru.pop_back();
+
+        auto it = m_warm.find(coord);
+        // DISK I/O: Only dirty chunks are written - clean ones can be reloaded or regenerated
+        if (it->second.dirty) {
+            if (!m_worldPath.empty() && writeBack(m_worldPath, coord, it->second)) {
+                m_writeBacks.fetch_add(1, std::memory_order_relaxed);
+            } else {
+                Logger::warning() << "Chunk cache: failed to write back dirty chunk (" << coord.x << ", "
+                                  << coord.y << ", " << coord.z << ") - modifications lost";
+            }
+        }
+        m_warmBytes -= it->second.encoded.size();
+        m_warm.erase(it);
+        m_evictions.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+void ChunkCache::insertWarm(const ChunkCoord& coord, std::vector<uint8_t> encoded, bool dirty, bool empty) {
+    m_warmLru.push_front(coord);
+    WarmEntry& entry = m_warm[coord];
+    m_warmBytes += encoded.size();
+    entry.encoded = std::move(encoded);
+    entry.dirty = dirty;
+    entry.empty = empty;
+    entry.lru = m_warmLru.begin();
+}
+
+bool ChunkCache::writeBack(const std::string& worldPath, const ChunkCoord& coord, const WarmEntry& entry) {
+    if (entry.empty) {
+        return Chunk::removeSaved(worldPath, coord.x, coord.y, coord.z);
+    }
+    return Chunk::writeEncoded(worldPath, coord.x, coord.y, coord.z, entry.encoded);
+}
+
+int ChunkCache::saveDirty() {
+    int saved = 0;
+    if (m_worldPath.empty()) return 0;
+
+    for (auto& [coord, entry] : m_hot) {
+        if (entry.dirty && entry.chunk->save(m_worldPath)) {
+            entry.dirty = false;
+            saved++;
+        }
+    }
+    for (auto& [coord, entry] : m_warm) {
+        if (entry.dirty && writeBack(m_worldPath, coord, entry)) {
+            entry.dirty = false;
+            saved++;
+        }
+    }
+    return saved;
+}
+
+std::pair<int, int> ChunkCache::saveAll(const std::string& worldPath) const {
+    int saved = 0;
+    int failed = 0;
+
+    for (const auto& [coord, entry] : m_hot) {
+        if (entry.chunk->save(worldPath)) saved++;
+        else failed++;
+    }
+    for (const auto& [coord, entry] : m_warm) {
+        if (writeBack(worldPath, coord, entry)) saved++;
+        else failed++;
+    }
+    return {saved, failed};
+}
+
+ChunkCacheStats ChunkCache::getStats() const {
+    ChunkCacheStats stats;
+    stats.hotHits = m_hotHits.load(std::memory_order_relaxed);
+    stats.warmHits = m_warmHits.load(std::memory_order_relaxed);
+    stats.coldHits = m_coldHits.load(std::memory_order_relaxed);
+    stats.misses = m_misses.load(std::memory_order_relaxed);
+    stats.demotions = m_demotions.load(std::memory_order_relaxed);
+    stats.evictions = m_evictions.load(std::memory_order_relaxed);
+    stats.writeBacks = m_writeBacks.load(std::memory_order_relaxed);
+    stats.hotChunks = m_hotCount.load(std::memory_order_relaxed);
+    stats.warmChunks = m_warmCount.load(std::memory_order_relaxed);
+    stats.hotBytes = m_hotBytesSnapshot.load(std::memory_order_relaxed);
+    stats.warmBytes = m_warmBytesSnapshot.load(std::memory_order_relaxed);
+    return stats;
+}
@@ -0,0 +1,259 @@
+/**
+ * @file chunk_lod.cpp
+ * @brief Downsampling, coarse meshing and super-chunk LOD selection for far terrain
+ *
+ * Created: 2025-11-27
+ */
+
+#include "chunk_lod.h"
+#include "block_system.h"
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+namespace ChunkLod {
+
+namespace {
+
+/**
+ * Corner offsets per face (0-1 unit cube), in FaceDirection order
+ * (+X, -X, +Y, -Y, +Z, -Z). Vertex order and winding match the cube table in
+ * Chunk::generateMesh so LOD quads light and texture identically.
+ */
+constexpr int kFaceCorners[6][4][3] = {
+    {{1,0,0}, {1,0,1}, {1,1,1}, {1,1,0}},  // +X (right)
+    {{0,0,1}, {0,0,0}, {0,1,0}, {0,1,1}},  // -X (left)
+    {{0,1,0}, {1,1,0}, {1,1,1}, {0,1,1}},  // +Y (top)
+    {{0,0,1}, {1,0,1}, {1,0,0}, {0,0,0}},  // -Y (bottom)
+    {{1,0,1}, {0,0,1}, {0,1,1}, {1,1,1}},  // +Z (back)
+    {{0,0,0}, {1,0,0}, {1,1,0}, {0,1,0}},  // -Z (front)
+};
+
+constexpr int kFaceNormals[6][3] = {
+    { 1, 0, 0}, {-1, 0, 0}, { 0, 1, 0}, { 0,-1, 0}, { 0, 0, 1}, { 0, 0,-1}
+};
+
+// Same corner → UV mapping as the full-resolution mesher
+constexpr uint8_t kSideCorners[4] = {
+    CompressedVertex::CORNER_HEIGHT, CompressedVertex::CORNER_BOTH,
+    CompressedVertex::CORNER_WIDTH, CompressedVertex::CORNER_ORIGIN
+};
+constexpr uint8_t kYFaceCorners[4] = {
+    CompressedVertex::CORNER_ORIGIN, CompressedVertex::CORNER_WIDTH,
+    CompressedVertex::CORNER_BOTH, CompressedVertex::CORNER_HEIGHT
+};
+
+enum class CellKind : uint8_t { Air, Solid, Liquid };
+
+inline CellKind classify(int id, const BlockPropertyTable& props) {
+    const uint8_t flags = props.flags(id);
+    if (!(flags & BlockFlags::VALID)) return CellKind::Air;
+    return (flags & BlockFlags::LIQUID) ? CellKind::Liquid : CellKind::Solid;
+}
+
+}  // namespace
+
+void downsample(const int (&blocks)[Chunk::WIDTH][Chunk::HEIGHT][Chunk::DEPTH],
+                int lodLevel, DownsampledGrid& out) {
+    lodLevel = std::clamp(lodLevel, 1, MAX_LOD_LEVEL);
+    const int cell = 1 << lodLevel;
+    const int dim = Chunk::WIDTH / cell;
+    const int cellVolume = cell * cell * cell;
+
+    out.lodLevel = lodLevel;
+    out.cellSize = cell;
+    out.dim = dim;
+    out.cells.assign(static_cast<size_t>(dim) * dim * dim, 0);
+
+    const BlockPropertyTable& props = BlockRegistry::instance().properties();
+
+    // Per-layer histogram of candidate surface blocks (at most 8x8 = 64 distinct IDs)
+    std::array<int, 64> layerIds{};
+    std::array<int, 64> layerCounts{};
+
+    for (int cx = 0; cx < dim; ++cx) {
+        for (int cy = 0; cy < dim; ++cy) {
+            for (int cz = 0; cz < dim; ++cz) {
+                const int bx = cx * cell;
+                const int by = cy * cell;
+                const int bz = cz * cell;
+
+                int solidCount = 0;
+                int liquidCount = 0;
+                int liquidId = 0;
+                int surfaceLayer = -1;
+
+                // Count solids/liquids and remember the topmost layer containing a solid
+                for (int y = cell - 1; y >= 0; --y) {
+                    for (int x = 0; x < cell; ++x) {
+                        for (int z = 0; z < cell; ++z) {
+                            int id = blocks[bx + x][by + y][bz + z];
+                            CellKind kind = classify(id, props);
+                            if (kind == CellKind::Solid) {
+                                ++solidCount;
+                                if (surfaceLayer < 0) surfaceLayer = y;
+                            } else if (kind == CellKind::Liquid) {
+                                ++liquidCount;
+                                liquidId = id;
+                            }
+                        }
+                    }
+                }
+
+                int result = 0;
+                if (solidCount * 2 >= cellVolume) {
+                    // Most common solid ID on the topmost occupied layer
+                    int distinct = 0;
+                    for (int x = 0; x < cell; ++x) {
+                        for (int z = 0; z < cell; ++z) {
+                            int id = blocks[bx + x][by + surfaceLayer][bz + z];
+                            if (classify(id, props) != CellKind::Solid) continue;
+                            int slot = 0;
+                            while (slot < distinct && layerIds[slot] != id) ++slot;
+                            if (slot == distinct) {
+                                layerIds[distinct] = id;
+                                layerCounts[distinct] = 0;
+                                ++distinct;
+                            }
+                            ++layerCounts[slot];
+                        }
+                    }
+                    int best = 0;
+                    for (int i = 1; i < distinct; ++i) {
+                        if (layerCounts[i] > layerCounts[best]) best = i;
+                    }
+                    result = layerIds[best];
+                } else if (liquidCount > 0 && (solidCount + liquidCount) * 2 >= cellVolume) {
+                    result = liquidId;
+                }
+
+                out.cells[(cx * dim + cy) * dim + cz] = result;
+            }
+        }
+    }
+}
+
+void buildMesh(const DownsampledGrid& grid, int chunkX, int chunkY, int chunkZ,
+               std::vector<CompressedVertex>& verts, std::vector<CompressedVertex>& transparentVerts) {
+    const BlockPropertyTable& props = BlockRegistry::instance().properties();
+
+    const int cell = grid.cellSize;
+    const int dim = grid.dim;
+    const int originX = chunkX * Chunk::WIDTH;
+    const int originY = chunkY * Chunk::HEIGHT;
+    const int originZ = chunkZ * Chunk::DEPTH;
+
+    // Emits one quad. (x0,y0,z0) is the block-space origin of the unit cube the
+    // face belongs to, (sx,sy,sz) its extent along each axis.
+    auto emitQuad = [&](int face, int id, bool liquid,
+                        int x0, int y0, int z0, int sx, int sy, int sz) {
+        auto& targetVerts = liquid ? transparentVerts : verts;
+
+        const bool isYFace = (face == 2 || face == 3);
+        const uint8_t* cornerMap = isYFace ? kYFaceCorners : kSideCorners;
+
+        // UV tiling matches block scale: a cell of N blocks repeats the texture N times
+        uint8_t quadW;
+        uint8_t quadH;
+        if (face <= 1) {            // X faces span Z (width) and Y (height)
+            quadW = static_cast<uint8_t>(sz);
+            quadH = static_cast<uint8_t>(sy);
+        } else if (isYFace) {       // Y faces span X (width) and Z (height)
+            quadW = static_cast<uint8_t>(sx);
+            quadH = static_cast<uint8_t>(sz);
+        } else {                    // Z faces span X (width) and Y (height)
+            quadW = static_cast<uint8_t>(sx);
+            quadH = static_cast<uint8_t>(sy);
+        }
+
+        const uint16_t layer = props.faceLayer(id, face);
+        const uint8_t tint = props.tint(id);
+
+        // Distant terrain is lit as open sky; bottom faces get a fixed AO darkening
+        const uint8_t ao = (face == 3) ? 9 : 15;
+
+        for (int v = 0; v < 4; ++v) {
+            const int* c = kFaceCorners[face][v];
+            CompressedVertex cv = CompressedVertex::pack(
+                static_cast<float>(x0 + c[0] * sx),
+                static_cast<float>(y0 + c[1] * sy),
+                static_cast<float>(z0 + c[2] * sz),
+                quadW, quadH,
+                layer,
+                cornerMap[v],
+                15, 0, 0, ao,
+                tint);
+            cv.packedB |= CompressedVertex::FLAG_FAR_LOD;
+            targetVerts.push_back(cv);
+        }
+    };
+
+    for (int cx = 0; cx < dim; ++cx) {
+        for (int cy = 0; cy < dim; ++cy) {
+            for (int cz = 0; cz < dim; ++cz) {
+                const int id = grid.at(cx, cy, cz);
+                const CellKind kind = classify(id, props);
+                if (kind == CellKind::Air) continue;
+
+                const bool liquid = (kind == CellKind::Liquid);
+                const int x0 = originX + cx * cell;
+                const int y0 = originY + cy * cell;
+                const int z0 = originZ + cz * cell;
+
+                const int aboveId = grid.at(cx, cy + 1, cz);
+                const bool isSurface = (aboveId < 0) || classify(aboveId, props) == CellKind::Air;
+
+                for (int face = 0; face < 6; ++face) {
+                    const int nx = cx + kFaceNormals[face][0];
+                    const int ny = cy + kFaceNormals[face][1];
+                    const int nz = cz + kFaceNormals[face][2];
+                    const int neighborId = grid.at(nx, ny, nz);
+
+                    if (neighborId < 0) {
+                        // Chunk border. Tops are always emitted (the chunk above is air
+                        // in the LOD band); side borders get a skirt on surface cells that
+                        // hangs one cell below the cell so coarser/finer neighbors never
+                        // show a gap. Bottoms are left to the chunk below.
+                        if (face == 2) {
+                            emitQuad(face, id, liquid, x0, y0, z0, cell, cell, cell);
+                        } else if (face != 3 && !liquid && isSurface) {
+                            emitQuad(face, id, liquid, x0, y0 - cell, z0, cell, cell * 2, cell);
+                        }
+                        continue;
+                    }
+
+                    const CellKind neighborKind = classify(neighborId, props);
+                    const bool visible = liquid
+                        ? (neighborKind == CellKind::Air)
+                        : (neighborKind != CellKind::Solid);
+                    if (visible) {
+                        emitQuad(face, id, liquid, x0, y0, z0, cell, cell, cell);
+                    }
+                }
+            }
+        }
+    }
+}
+
+int selectLodLevel(int chunkX, int chunkY, int chunkZ, const glm::vec3& viewerPos, float fullDetailDistance) {
+    for (int level = MAX_LOD_LEVEL; level >= 1; --level) {
+        // Octree node containing this chunk at this level (floor division for negatives)
+        const int nodeChunks = 1 << level;
+        auto nodeOrigin = [nodeChunks](int c) {
+            return (c >= 0 ? c / nodeChunks : -((-c + nodeChunks - 1) / nodeChunks)) * nodeChunks;
+        };
+        const float nodeSize = static_cast<float>(nodeChunks * Chunk::WIDTH);
+        glm::vec3 nodeCenter(
+            nodeOrigin(chunkX) * Chunk::WIDTH + nodeSize * 0.5f,
+            nodeOrigin(chunkY) * Chunk::HEIGHT + nodeSize * 0.5f,
+            nodeOrigin(chunkZ) * Chunk::DEPTH + nodeSize * 0.5f);
+
+        const float threshold = fullDetailDistance * static_cast<float>(1 << (level - 1));
+        if (glm::length(nodeCenter - viewerPos) > threshold) {
+            return level;
+        }
+    }
+    return 0;
+}
+
+}  // namespace ChunkLod
@@ -0,0 +1,83 @@
+/**
+ * @file chunk_map.cpp
+ * @brief Lock-sharded chunk map implementation
+ *
+ * Created: 2025-11-28
+ */
+
+#include "chunk_map.h"
+#include "chunk.h"
+
+ShardedChunkMap::ShardedChunkMap() = default;
+ShardedChunkMap::~ShardedChunkMap() = default;
+
+Chunk* ShardedChunkMap::find(const ChunkCoord& coord) const {
+    const Shard& shard = m_shards[shardIndex(coord)];
+    std::shared_lock<std::shared_mutex> lock(shard.mutex);
+    auto it = shard.chunks.find(coord);
+    return it != shard.chunks.end() ? it->second.get() : nullptr;
+}
+
+bool ShardedChunkMap::insert(const ChunkCoord& coord, std::unique_ptr<Chunk>&& chunk) {
+    if (!chunk) {
+        return false;
+    }
+
+    Shard& shard = m_shards[shardIndex(coord)];
+    std::unique_lock<std::shared_mutex> lock(shard.mutex);
+    auto [it, inserted] = shard.chunks.try_emplace(coord);
+    if (!inserted) {
+        return false;
+    }
+    Chunk* chunkPtr = chunk.get();
+    it->second = std::move(chunk);
+    m_size.fetch_add(1, std::memory_order_relaxed);
+
+    std::lock_guard<std::mutex> listLock(m_listMutex);
+    m_listIndex[chunkPtr] = m_list.size();
+    m_list.push_back(chunkPtr);
+    std::atomic_store(&m_snapshot, Snapshot());
+    return true;
+}
+
+std::unique_ptr<Chunk> ShardedChunkMap::extract(const ChunkCoord& coord) {
+    Shard& shard = m_shards[shardIndex(coord)];
+    std::unique_lock<std::shared_mutex> lock(shard.mutex);
+    auto it = shard.chunks.find(coord);
+    if (it == shard.chunks.end()) {
+        return nullptr;
+    }
+    std::unique_ptr<Chunk> chunk = std::move(it->second);
+    shard.chunks.erase(it);
+    m_size.fetch_sub(1, std::memory_order_relaxed);
+
+    // Swap-and-pop (order doesn't matter) and fix up the moved chunk's index
+    std::lock_guard<std::mutex> listLock(m_listMutex);
+    auto indexIt = m_listIndex.find(chunk.get());
+    if (indexIt != m_listIndex.end()) {
+        const size_t index = indexIt->second;
+        Chunk* last = m_list.back();
+        m_list[index] = last;
+        m_listIndex[last] = index;
+        m_list.pop_back();
+        m_listIndex.erase(chunk.get());
+    }
+    std::atomic_store(&m_snapshot, Snapshot());
+    return chunk;
+}
+
+ShardedChunkMap::Snapshot ShardedChunkMap::snapshot() const {
+    Snapshot current = std::atomic_load(&m_snapshot);
+    if (current) {
+        return current;  // Fast path: nothing changed since the last publish
+    }
+
+    // Rebuild under the list lock so the copy is consistent, then publish
+    std::lock_guard<std::mutex> listLock(m_listMutex);
+    current = std::atomic_load(&m_snapshot);
+    if (!current) {
+        current = std::make_shared<const std::vector<Chunk*>>(m_list);
+        std::atomic_store(&m_snapshot, current);
+    }
+    return current;
+}
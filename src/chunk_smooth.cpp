@@ -0,0 +1,246 @@
+/**
+ * @file chunk_smooth.cpp
+ * @brief Surface-nets kernel for smooth terrain chunks
+ *
+ * Created: 2025-11-28
+ */
+
+#include "chunk_smooth.h"
+#include "block_system.h"
+#include <array>
+
+namespace ChunkSmooth {
+
+namespace {
+
+constexpr int CELLS = PAD - 1;                      ///< Cells per axis (cell c spans samples c..c+1)
+
+// Sample and cell index strides per axis (x-major storage)
+constexpr int kSampleStride[3] = {PAD * PAD, PAD, 1};
+constexpr int kCellStride[3] = {CELLS * CELLS, CELLS, 1};
+
+// Sample offset of cell corner i = (i & 1, i >> 1 & 1, i >> 2 & 1)
+constexpr int kCorners[8] = {
+    0, PAD * PAD, PAD, PAD * PAD + PAD,
+    1, PAD * PAD + 1, PAD + 1, PAD * PAD + PAD + 1
+};
+
+/// Neighbor slot (0..2) of a padded coordinate: -1, this chunk, +1
+int region(int padded) {
+    return padded == 0 ? 0 : (padded == PAD - 1 ? 2 : 1);
+}
+
+/**
+ * Vertex offset inside a cell for each 8-corner occupancy mask: mean of the
+ * midpoints of the edges whose ends differ. Corner i is (i & 1, i >> 1 & 1, i >> 2 & 1).
+ */
+struct CellOffset {
+    float x, y, z;
+    uint8_t ao;  ///< Crevices (more than half the corners inside) darken like cube AO
+};
+
+const std::array<CellOffset, 256>& cellOffsets() {
+    static const std::array<CellOffset, 256> table = [] {
+        std::array<CellOffset, 256> result{};
+        for (int mask = 1; mask < 255; mask++) {
+            float sum[3] = {0.0f, 0.0f, 0.0f};
+            int crossings = 0;
+            for (int corner = 0; corner < 8; corner++) {
+                for (int axis = 0; axis < 3; axis++) {
+                    const int other = corner | (1 << axis);
+                    if (other == corner) continue;  // Each edge once, from its low corner
+                    if (((mask >> corner) & 1) == ((mask >> other) & 1)) continue;
+                    for (int k = 0; k < 3; k++) {
+                        sum[k] += (k == axis) ? 0.5f : static_cast<float>((corner >> k) & 1);
+                    }
+                    crossings++;
+                }
+            }
+            int inside = 0;
+            for (int corner = 0; corner < 8; corner++) inside += (mask >> corner) & 1;
+            const uint8_t ao = static_cast<uint8_t>(inside <= 4 ? 15 : 15 - (inside - 4) * 3);
+            result[mask] = {sum[0] / crossings, sum[1] / crossings, sum[2] / crossings, ao};
+        }
+        return result;
+    }();
+    return table;
+}
+
+/// Cell vertex in world space
+struct CellVertex {
+    float x, y, z;
+    uint8_t ao;
+};
+
+}  // namespace
+
+size_t prepare(SampleGrid& grid) {
+    const BlockPropertyTable& props = BlockRegistry::instance().properties();
+
+    // Kind per block ID, so classifying a sample is one table load
+    thread_local std::vector<uint8_t> idKinds;
+    idKinds.assign(props.size(), 0);
+    for (int id = 0; id < props.size(); id++) {
+        const uint8_t flags = props.flags(id);
+        if ((flags & BlockFlags::SOLID) && (flags & BlockFlags::OPAQUE)) {
+            idKinds[id] = SampleKind::INSIDE | (props.isSmooth(id) ? SampleKind::SMOOTH : 0);
+        }
+    }
+
+    // Classify Z rows, remembering which rows are all inside / all outside
+    enum RowState : uint8_t { ROW_OUTSIDE, ROW_INSIDE, ROW_MIXED };
+    thread_local std::vector<uint8_t> rowStates(PAD * PAD);
+
+    const int* blocks = grid.blocks.data();
+    uint8_t* kinds = grid.kinds.data();
+    const uint8_t* idKind = idKinds.data();
+    const uint32_t idCount = static_cast<uint32_t>(idKinds.size());
+    for (int row = 0; row < PAD * PAD; row++) {
+        uint8_t any = 0;
+        uint8_t all = SampleKind::INSIDE;
+        for (int i = row * PAD; i < (row + 1) * PAD; i++) {
+            const uint32_t id = static_cast<uint32_t>(blocks[i]);
+            const uint8_t kind = (id < idCount) ? idKind[id] : 0;
+            kinds[i] = kind;
+            any |= kind;
+            all &= kind;
+        }
+        rowStates[row] = !(any & SampleKind::INSIDE) ? ROW_OUTSIDE : (all ? ROW_INSIDE : ROW_MIXED);
+
+        // Blocks of cube-meshed neighbor chunks are inside but never smooth
+        if (grid.cubeRegions != 0) {
+            const int rx = region(row / PAD);
+            const int ry = region(row % PAD);
+            const int runs[3][2] = {{0, 1}, {1, PAD - 1}, {PAD - 1, PAD}};
+            for (int rz = 0; rz < 3; rz++) {
+                if (!(grid.cubeRegions & regionBit(rx - 1, ry - 1, rz - 1))) continue;
+                for (int i = row * PAD + runs[rz][0]; i < row * PAD + runs[rz][1]; i++) {
+                    kinds[i] &= static_cast<uint8_t>(~SampleKind::SMOOTH);
+                }
+            }
+        }
+    }
+
+    // Like cube faces, an edge belongs to the chunk of its inside block, so each edge
+    // on a chunk border is emitted exactly once whichever way the neighbor is meshed
+    grid.edges.clear();
+    grid.litSamples.clear();
+    for (int px = 1; px < PAD - 1; px++) {
+        for (int py = 1; py < PAD - 1; py++) {
+            // Open air has no inside blocks, solid rock enclosed by solid rock no surface
+            const int row = px * PAD + py;
+            const uint8_t state = rowStates[row];
+            if (state == ROW_OUTSIDE) continue;
+            if (state == ROW_INSIDE && rowStates[row - PAD] == ROW_INSIDE && rowStates[row + PAD] == ROW_INSIDE &&
+                rowStates[row - 1] == ROW_INSIDE && rowStates[row + 1] == ROW_INSIDE) {
+                continue;
+            }
+
+            const int rowStart = SampleGrid::index(px, py, 1);
+            for (int sample = rowStart; sample < rowStart + Chunk::DEPTH; sample++) {
+                if (!(kinds[sample] & SampleKind::SMOOTH)) continue;  // Outside or cube meshed
+                for (int axis = 0; axis < 3; axis++) {
+                    for (int outside : {sample + kSampleStride[axis], sample - kSampleStride[axis]}) {
+                        if (kinds[outside] & SampleKind::INSIDE) continue;
+
+                        grid.edges.push_back({sample, outside, axis});
+                        if (!(kinds[outside] & SampleKind::LIT)) {
+                            kinds[outside] |= SampleKind::LIT;
+                            grid.litSamples.push_back(outside);
+                        }
+                    }
+                }
+            }
+        }
+    }
+    return grid.edges.size();
+}
+
+void buildMesh(const SampleGrid& grid, int chunkX, int chunkY, int chunkZ,
+               std::vector<CompressedVertex>& verts) {
+    const BlockPropertyTable& props = BlockRegistry::instance().properties();
+    const std::array<CellOffset, 256>& offsets = cellOffsets();
+    const uint8_t* kinds = grid.kinds.data();
+
+    // Cell vertices are computed on first use; the generation stamp replaces clearing.
+    // Storage is reused per mesh worker thread
+    thread_local std::vector<CellVertex> cells(CELLS * CELLS * CELLS);
+    thread_local std::vector<uint32_t> cellStamps(CELLS * CELLS * CELLS, 0);
+    thread_local uint32_t generation = 0;
+    if (++generation == 0) {
+        std::fill(cellStamps.begin(), cellStamps.end(), 0);
+        generation = 1;
+    }
+
+    // Sample p sits at the block center (p - 1) + 0.5, so cell c starts at c - 0.5
+    const float originX = static_cast<float>(chunkX * Chunk::WIDTH) - 0.5f;
+    const float originY = static_cast<float>(chunkY * Chunk::HEIGHT) - 0.5f;
+    const float originZ = static_cast<float>(chunkZ * Chunk::DEPTH) - 0.5f;
+
+    // One vertex per cell at the mean of its crossing edge midpoints (corner bit = x | y << 1 | z << 2)
+    auto cellVertex = [&](int cx, int cy, int cz) -> const CellVertex& {
+        const int cell = (cx * CELLS + cy) * CELLS + cz;
+        CellVertex& vertex = cells[cell];
+        if (cellStamps[cell] == generation) return vertex;
+        cellStamps[cell] = generation;
+
+        const uint8_t* c = kinds + SampleGrid::index(cx, cy, cz);
+        int mask = 0;
+        bool cubeCorner = false;
+        for (int corner = 0; corner < 8; corner++) {
+            const uint8_t kind = c[kCorners[corner]];
+            mask |= (kind & SampleKind::INSIDE) << corner;
+            cubeCorner |= (kind & (SampleKind::INSIDE | SampleKind::SMOOTH)) == SampleKind::INSIDE;
+        }
+
+        // Next to a cube-meshed block the vertex stays on the block corner its cube faces use
+        if (cubeCorner) {
+            vertex.x = originX + static_cast<float>(cx) + 0.5f;
+            vertex.y = originY + static_cast<float>(cy) + 0.5f;
+            vertex.z = originZ + static_cast<float>(cz) + 0.5f;
+            vertex.ao = 15;
+            return vertex;
+        }
+
+        const CellOffset& offset = offsets[mask];
+        vertex.x = originX + static_cast<float>(cx) + offset.x;
+        vertex.y = originY + static_cast<float>(cy) + offset.y;
+        vertex.z = originZ + static_cast<float>(cz) + offset.z;
+        vertex.ao = offset.ao;
+        return vertex;
+    };
+
+    verts.reserve(verts.size() + grid.edges.size() * 4);
+    for (const SurfaceEdge& edge : grid.edges) {
+        // Quads face from the inside sample to the outside one
+        const bool positive = edge.inside < edge.outside;
+        const int sample = positive ? edge.inside : edge.outside;
+        const int p[3] = {sample / (PAD * PAD), (sample / PAD) % PAD, sample % PAD};
+
+        const int id = grid.blocks[edge.inside];
+        const int face = edge.axis * 2 + (positive ? 0 : 1);  // FaceDirection order
+        const uint16_t layer = props.faceLayer(id, face);
+        const uint8_t tint = props.tint(id);
+        const uint8_t light = grid.light[edge.outside];
+
+        // The 4 cells around the edge, in the cube mesher's winding: with (b, c)
+        // following the axis cyclically, +axis walks (-b -c), (-b), (0), (-c)
+        const int b = (edge.axis + 1) % 3;
+        const int c = (edge.axis + 2) % 3;
+        int steps[4][3] = {};
+        steps[0][b] = -1; steps[0][c] = -1;
+        steps[positive ? 1 : 3][b] = -1;
+        steps[positive ? 3 : 1][c] = -1;
+
+        for (const int* step : steps) {
+            const CellVertex& v = cellVertex(p[0] + step[0], p[1] + step[1], p[2] + step[2]);
+            verts.push_back(CompressedVertex::packSmooth(
+                v.x, v.y, v.z,
+                layer,
+                light >> 4, light & 0xF, v.ao,
+                tint));
+        }
+    }
+}
+
+}  // namespace ChunkSmooth
@@ -0,0 +1,382 @@
+/**
+ * @file chunk_trace.cpp
+ * @brief Chunk pipeline latency tracing implementation
+ *
+ * Created: 2025-11-28
+ */
+
+#include "chunk_trace.h"
+#include "chunk.h"
+#include "logger.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <unordered_map>
+
+namespace {
+
+const char* stageName(ChunkTraceStage stage) {
+    switch (stage) {
+        case ChunkTraceStage::LOAD_QUEUE: return "load_queue";
+        case ChunkTraceStage::GENERATE:   return "generate";
+        case ChunkTraceStage::DECORATE:   return "decorate";
+        case ChunkTraceStage::LIGHT:      return "light";
+        case ChunkTraceStage::MESH:       return "mesh";
+        case ChunkTraceStage::UPLOAD:     return "upload";
+        default:                          return "unknown";
+    }
+}
+
+// States where a chunk sits in a queue rather than being worked on
+bool isWaitState(ChunkState state) {
+    return state == ChunkState::GENERATED ||
+           state == ChunkState::AWAITING_MESH ||
+           state == ChunkState::AWAITING_UPLOAD;
+}
+
+uint64_t coordKey(int32_t x, int32_t y, int32_t z) {
+    return (static_cast<uint64_t>(static_cast<uint32_t>(x) & 0x1FFFFF) << 42)
+         | (static_cast<uint64_t>(static_cast<uint32_t>(y) & 0x1FFFFF) << 21)
+         | (static_cast<uint64_t>(static_cast<uint32_t>(z) & 0x1FFFFF));
+}
+
+double percentile(const std::vector<int64_t>& sorted, double p) {
+    if (sorted.empty()) return 0.0;
+    size_t index = static_cast<size_t>(std::ceil(p * sorted.size()));
+    index = std::min(sorted.size() - 1, index > 0 ? index - 1 : 0);
+    return sorted[index] / 1.0e6;
+}
+
+}  // namespace
+
+// ============================================================================
+// Per-thread ring ownership
+// ============================================================================
+
+/**
+ * Thread-local handle to the calling thread's ring. Marks the ring retired when
+ * the thread exits so collect() can release it after the final drain.
+ */
+struct ChunkTraceThreadSlot {
+    std::shared_ptr<ChunkTrace::ThreadRing> ring;
+
+    ~ChunkTraceThreadSlot() {
+        if (ring) {
+            ring->retired.store(true, std::memory_order_release);
+        }
+    }
+};
+
+namespace {
+thread_local ChunkTraceThreadSlot t_traceSlot;
+}
+
+// ============================================================================
+// ChunkTrace
+// ============================================================================
+
+ChunkTrace::ChunkTrace()
+    : m_epoch(std::chrono::steady_clock::now()) {
+}
+
+ChunkTrace& ChunkTrace::instance() {
+    static ChunkTrace instance;
+    return instance;
+}
+
+void ChunkTrace::start() {
+    // Discard anything still sitting in rings from a previous session
+    collect();
+    {
+        std::lock_guard<std::mutex> lock(m_sessionMutex);
+        m_session.clear();
+    }
+    m_dropped.store(0, std::memory_order_relaxed);
+    m_enabled.store(true, std::memory_order_release);
+    Logger::info() << "Chunk trace started";
+}
+
+void ChunkTrace::stop() {
+    m_enabled.store(false, std::memory_order_release);
+    collect();
+    Logger::info() << "Chunk trace stopped (" << getEventCount() << " events, "
+                   << getDroppedCount() << " dropped)";
+}
+
+int64_t ChunkTrace::now() const {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - m_epoch).count();
+}
+
+ChunkTrace::ThreadRing* ChunkTrace::threadRing() {
+    if (!t_traceSlot.ring) {
+        auto ring = std::make_shared<ThreadRing>();
+        std::lock_guard<std::mutex> lock(m_ringsMutex);
+        ring->threadIndex = static_cast<uint8_t>(m_nextThreadIndex++ & 0xFF);
+        m_rings.push_back(ring);
+        t_traceSlot.ring = std::move(ring);
+    }
+    return t_traceSlot.ring.get();
+}
+
+void ChunkTrace::push(const ChunkTraceEvent& event) {
+    ThreadRing* ring = threadRing();
+
+    const uint64_t head = ring->head.load(std::memory_order_relaxed);
+    const uint64_t tail = ring->tail.load(std::memory_order_acquire);
+    if (head - tail >= RING_CAPACITY) {
+        m_dropped.fetch_add(1, std::memory_order_relaxed);
+        return;  // Never block a worker on tracing
+    }
+
+    ChunkTraceEvent& slot = ring->events[head & (RING_CAPACITY - 1)];
+    slot = event;
+    slot.thread = ring->threadIndex;
+    ring->head.store(head + 1, std::memory_order_release);
+}
+
+void ChunkTrace::recordTransition(int x, int y, int z, ChunkState from, ChunkState to) {
+    if (!isEnabled()) return;
+
+    ChunkTraceEvent event{};
+    event.timeNs = now();
+    event.x = x;
+    event.y = y;
+    event.z = z;
+    event.kind = ChunkTraceEvent::Kind::TRANSITION;
+    event.from = static_cast<uint8_t>(from);
+    event.to = static_cast<uint8_t>(to);
+    push(event);
+}
+
+void ChunkTrace::recordSpan(int x, int y, int z, ChunkTraceStage stage, int64_t startNs, int64_t endNs) {
+    if (!isEnabled()) return;
+
+    ChunkTraceEvent event{};
+    event.timeNs = startNs;
+    event.durationNs = std::max<int64_t>(0, endNs - startNs);
+    event.x = x;
+    event.y = y;
+    event.z = z;
+    event.kind = ChunkTraceEvent::Kind::SPAN;
+    event.from = static_cast<uint8_t>(stage);
+    push(event);
+}
+
+void ChunkTrace::collect() {
+    std::lock_guard<std::mutex> ringsLock(m_ringsMutex);
+    if (m_rings.empty()) return;
+
+    std::lock_guard<std::mutex> sessionLock(m_sessionMutex);
+    for (auto it = m_rings.begin(); it != m_rings.end();) {
+        ThreadRing& ring = **it;
+
+        // Read retired BEFORE head: a retired ring receives no further events
+        const bool retired = ring.retired.load(std::memory_order_acquire);
+        const uint64_t head = ring.head.load(std::memory_order_acquire);
+        const uint64_t tail = ring.tail.load(std::memory_order_relaxed);
+
+        for (uint64_t i = tail; i < head; ++i) {
+            if (m_session.size() >= MAX_SESSION_EVENTS) {
+                m_dropped.fetch_add(head - i, std::memory_order_relaxed);
+                break;
+            }
+            m_session.push_back(ring.events[i & (RING_CAPACITY - 1)]);
+        }
+        ring.tail.store(head, std::memory_order_release);
+
+        if (retired) {
+            it = m_rings.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+size_t ChunkTrace::getEventCount() {
+    std::lock_guard<std::mutex> lock(m_sessionMutex);
+    return m_session.size();
+}
+
+std::vector<ChunkTraceStats> ChunkTrace::computeStats() {
+    collect();
+
+    std::vector<ChunkTraceEvent> events;
+    {
+        std::lock_guard<std::mutex> lock(m_sessionMutex);
+        events = m_session;
+    }
+    std::stable_sort(events.begin(), events.end(),
+        [](const ChunkTraceEvent& a, const ChunkTraceEvent& b) { return a.timeNs < b.timeNs; });
+
+    constexpr size_t STATE_COUNT = static_cast<size_t>(ChunkState::UNLOADING) + 1;
+    constexpr size_t STAGE_COUNT = static_cast<size_t>(ChunkTraceStage::COUNT);
+    std::vector<std::vector<int64_t>> stateSamples(STATE_COUNT);
+    std::vector<std::vector<int64_t>> stageSamples(STAGE_COUNT);
+
+    // Time-in-state: distance between a chunk's consecutive transitions
+    struct LastTransition {
+        int64_t timeNs;
+        uint8_t state;
+    };
+    std::unordered_map<uint64_t, LastTransition> lastByChunk;
+
+    for (const auto& event : events) {
+        if (event.kind == ChunkTraceEvent::Kind::SPAN) {
+            if (event.from < STAGE_COUNT) {
+                stageSamples[event.from].push_back(event.durationNs);
+            }
+            continue;
+        }
+
+        const uint64_t key = coordKey(event.x, event.y, event.z);
+        auto it = lastByChunk.find(key);
+        if (it != lastByChunk.end() && it->second.state == event.from && event.from < STATE_COUNT) {
+            stateSamples[event.from].push_back(event.timeNs - it->second.timeNs);
+        }
+        lastByChunk[key] = {event.timeNs, event.to};
+    }
+
+    auto makeStats = [](std::vector<int64_t>& samples, ChunkTraceStats& stats) {
+        std::sort(samples.begin(), samples.end());
+        stats.count = samples.size();
+        stats.p50Ms = percentile(samples, 0.50);
+        stats.p95Ms = percentile(samples, 0.95);
+        stats.p99Ms = percentile(samples, 0.99);
+        stats.maxMs = samples.empty() ? 0.0 : samples.back() / 1.0e6;
+        int64_t total = 0;
+        for (int64_t sample : samples) total += sample;
+        stats.totalMs = total / 1.0e6;
+    };
+
+    std::vector<ChunkTraceStats> result;
+    for (size_t state = 0; state < STATE_COUNT; ++state) {
+        if (stateSamples[state].empty()) continue;
+        ChunkTraceStats stats;
+        stats.name = chunkStateToString(static_cast<ChunkState>(state));
+        stats.isWait = isWaitState(static_cast<ChunkState>(state));
+        makeStats(stateSamples[state], stats);
+        result.push_back(std::move(stats));
+    }
+    for (size_t stage = 0; stage < STAGE_COUNT; ++stage) {
+        if (stageSamples[stage].empty()) continue;
+        ChunkTraceStats stats;
+        stats.name = stageName(static_cast<ChunkTraceStage>(stage));
+        stats.isSpan = true;
+        stats.isWait = (static_cast<ChunkTraceStage>(stage) == ChunkTraceStage::LOAD_QUEUE);
+        makeStats(stageSamples[stage], stats);
+        result.push_back(std::move(stats));
+    }
+    return result;
+}
+
+void ChunkTrace::printReport() {
+    std::vector<ChunkTraceStats> stats = computeStats();
+
+    Logger::info() << "========== CHUNK PIPELINE LATENCY ==========";
+    Logger::info() << "Events: " << getEventCount() << " (dropped: " << getDroppedCount() << ")";
+
+    double waitMs = 0.0;
+    double workMs = 0.0;
+    char line[160];
+    std::snprintf(line, sizeof(line), "%-16s %-5s %8s %9s %9s %9s %9s",
+                  "stage", "type", "count", "p50 ms", "p95 ms", "p99 ms", "max ms");
+    Logger::info() << line;
+
+    for (const auto& s : stats) {
+        const char* type = s.isWait ? "wait" : (s.isSpan ? "span" : "work");
+        std::snprintf(line, sizeof(line), "%-16s %-5s %8zu %9.2f %9.2f %9.2f %9.2f",
+                      s.name.c_str(), type, s.count, s.p50Ms, s.p95Ms, s.p99Ms, s.maxMs);
+        Logger::info() << line;
+
+        // Work spans overlap their states; the load queue span has no state of its own
+        if (!s.isSpan) {
+            (s.isWait ? waitMs : workMs) += s.totalMs;
+        } else if (s.isWait) {
+            waitMs += s.totalMs;
+        }
+    }
+
+    const double total = waitMs + workMs;
+    if (total > 0.0) {
+        std::snprintf(line, sizeof(line), "Queue wait: %.1f%%  Work: %.1f%%  (of %.0f ms chunk-time)",
+                      100.0 * waitMs / total, 100.0 * workMs / total, total);
+        Logger::info() << line;
+    }
+    Logger::info() << "============================================";
+}
+
+bool ChunkTrace::exportChromeTrace(const std::string& path) {
+    collect();
+
+    std::vector<ChunkTraceEvent> events;
+    {
+        std::lock_guard<std::mutex> lock(m_sessionMutex);
+        events = m_session;
+    }
+    std::stable_sort(events.begin(), events.end(),
+        [](const ChunkTraceEvent& a, const ChunkTraceEvent& b) { return a.timeNs < b.timeNs; });
+
+    std::ofstream file(path);
+    if (!file.is_open()) {
+        Logger::error() << "Failed to open chunk trace output: " << path;
+        return false;
+    }
+
+    // Chrome trace timestamps are microseconds
+    auto us = [](int64_t ns) { return ns / 1000.0; };
+    char buffer[256];
+    bool first = true;
+    auto emit = [&](const char* json) {
+        file << (first ? "\n" : ",\n") << json;
+        first = false;
+    };
+
+    file << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+    emit("{\"ph\":\"M\",\"pid\":1,\"name\":\"process_name\",\"args\":{\"name\":\"chunk pipeline\"}}");
+
+    // States become async slices (one track per chunk)
+    struct LastTransition {
+        int64_t timeNs;
+        uint8_t state;
+    };
+    std::unordered_map<uint64_t, LastTransition> lastByChunk;
+
+    for (const auto& event : events) {
+        if (event.kind == ChunkTraceEvent::Kind::SPAN) {
+            std::snprintf(buffer, sizeof(buffer),
+                "{\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"name\":\"%s\",\"ts\":%.3f,\"dur\":%.3f,"
+                "\"args\":{\"chunk\":\"%d,%d,%d\"}}",
+                static_cast<unsigned>(event.thread), stageName(static_cast<ChunkTraceStage>(event.from)),
+                us(event.timeNs), us(event.durationNs), event.x, event.y, event.z);
+            emit(buffer);
+            continue;
+        }
+
+        const uint64_t key = coordKey(event.x, event.y, event.z);
+        auto it = lastByChunk.find(key);
+        if (it != lastByChunk.end() && it->second.state == event.from) {
+            const char* name = chunkStateToString(static_cast<ChunkState>(event.from));
+            std::snprintf(buffer, sizeof(buffer),
+                "{\"ph\":\"b\",\"pid\":1,\"cat\":\"chunk\",\"id\":\"0x%llx\",\"name\":\"%s\",\"ts\":%.3f,"
+                "\"args\":{\"chunk\":\"%d,%d,%d\"}}",
+                static_cast<unsigned long long>(key), name, us(it->second.timeNs), event.x, event.y, event.z);
+            emit(buffer);
+            std::snprintf(buffer, sizeof(buffer),
+                "{\"ph\":\"e\",\"pid\":1,\"cat\":\"chunk\",\"id\":\"0x%llx\",\"name\":\"%s\",\"ts\":%.3f}",
+                static_cast<unsigned long long>(key), name, us(event.timeNs));
+            emit(buffer);
+        }
+        lastByChunk[key] = {event.timeNs, event.to};
+    }
+
+    file << "\n]}\n";
+    if (!file.good()) {
+        Logger::error() << "Failed to write chunk trace: " << path;
+        return false;
+    }
+
+    Logger::info() << "Exported " << events.size() << " chunk trace events to " << path;
+    return true;
+}
@@ -8,6 +8,8 @@
 #include "structure_system.h"
 #include "raycast.h"
 #include "perf_monitor.h"
+#include "chunk_trace.h"
+#include "profiler.h"
 #include "block_system.h"
 #include "biome_system.h"
 #include "editor/skeletal_editor.h"
@@ -173,6 +175,14 @@ void ConsoleCommands::registerAll(Console* console, Player* player, World* world
                            "freeze", cmdFreeze,
                            {});
 
+    registry.registerCommand("chunktrace", "Trace chunk pipeline stage latencies",
+                           "chunktrace <start|stop|report|export> [file]", cmdChunkTrace,
+                           {"start", "stop", "report", "export"});
+
+    registry.registerCommand("profiler", "Zone profiler flame graph and export",
+                           "profiler <show|hide|on|off|pause|resume|export> [file]", cmdProfiler,
+                           {"show", "hide", "on", "off", "pause", "resume", "export"});
+
     // Initialize and register editor commands
     s_skeletalEditor = std::make_unique<SkeletalEditor>();
     s_skeletalEditor->initialize(renderer);
@@ -593,7 +603,8 @@ void ConsoleCommands::cmdReload(const std::vector<std::string>& args) {
         int regeneratedCount = 0;
 
         s_renderer->beginBufferCopyBatch();
-        for (Chunk* chunk : s_world->getChunks()) {
+        const ShardedChunkMap::Snapshot chunks = s_world->getChunks();
+        for (Chunk* chunk : *chunks) {
             if (chunk) {
                 chunk->generateMesh(s_world);
                 chunk->createVertexBufferBatched(s_renderer);
@@ -613,6 +624,9 @@ void ConsoleCommands::cmdReload(const std::vector<std::string>& args) {
             return;
         }
 
+        // Worldgen placement keeps its own copies; swap in one built from the new definitions
+        s_world->reloadStructurePlacement();
+
         s_console->addMessage("Structures reloaded successfully!", ConsoleMessageType::INFO);
     }
 
@@ -1248,6 +1262,103 @@ void ConsoleCommands::cmdFreeze(const std::vector<std::string>& args) {
     }
 }
 
+void ConsoleCommands::cmdChunkTrace(const std::vector<std::string>& args) {
+    if (args.size() < 2) {
+        s_console->addMessage("Usage: chunktrace <start|stop|report|export> [file]", ConsoleMessageType::WARNING);
+        s_console->addMessage("  chunktrace start - Begin recording chunk state transitions", ConsoleMessageType::INFO);
+        s_console->addMessage("  chunktrace stop - Stop recording (keeps the session)", ConsoleMessageType::INFO);
+        s_console->addMessage("  chunktrace report - Show p50/p95/p99 per pipeline stage", ConsoleMessageType::INFO);
+        s_console->addMessage("  chunktrace export [file] - Write Chrome trace JSON (default: chunk_trace.json)", ConsoleMessageType::INFO);
+        return;
+    }
+
+    ChunkTrace& trace = ChunkTrace::instance();
+    std::string subcommand = args[1];
+
+    if (subcommand == "start") {
+        trace.start();
+        s_console->addMessage("Chunk trace started", ConsoleMessageType::INFO);
+    }
+    else if (subcommand == "stop") {
+        trace.stop();
+        s_console->addMessage("Chunk trace stopped: " + std::to_string(trace.getEventCount()) + " events, " +
+                              std::to_string(trace.getDroppedCount()) + " dropped", ConsoleMessageType::INFO);
+    }
+    else if (subcommand == "report") {
+        auto stats = trace.computeStats();
+        if (stats.empty()) {
+            s_console->addMessage("No chunk trace data (run 'chunktrace start' first)", ConsoleMessageType::WARNING);
+            return;
+        }
+
+        s_console->addMessage("Stage              Type   Count    p50 ms    p95 ms    p99 ms", ConsoleMessageType::INFO);
+        for (const auto& s : stats) {
+            std::ostringstream line;
+            line << std::left << std::setw(19) << s.name
+                 << std::setw(7) << (s.isWait ? "wait" : (s.isSpan ? "span" : "work"))
+                 << std::right << std::setw(5) << s.count
+                 << std::fixed << std::setprecision(2)
+                 << std::setw(10) << s.p50Ms << std::setw(10) << s.p95Ms << std::setw(10) << s.p99Ms;
+            s_console->addMessage(line.str(), ConsoleMessageType::INFO);
+        }
+        trace.printReport();
+    }
+    else if (subcommand == "export") {
+        std::string path = args.size() > 2 ? args[2] : "chunk_trace.json";
+        if (trace.exportChromeTrace(path)) {
+            s_console->addMessage("Chunk trace written to " + path + " (open in ui.perfetto.dev)", ConsoleMessageType::INFO);
+        } else {
+            s_console->addMessage("Failed to write chunk trace to " + path, ConsoleMessageType::ERROR);
+        }
+    }
+    else {
+        s_console->addMessage("Unknown chunktrace command: " + subcommand, ConsoleMessageType::ERROR);
+        s_console->addMessage("Available: start, stop, report, export", ConsoleMessageType::INFO);
+    }
+}
+
+void ConsoleCommands::cmdProfiler(const std::vector<std::string>& args) {
+    if (args.size() < 2) {
+        s_console->addMessage("Usage: profiler <show|hide|on|off|pause|resume|export> [file]", ConsoleMessageType::WARNING);
+        s_console->addMessage("  profiler show/hide - Toggle the flame graph window", ConsoleMessageType::INFO);
+        s_console->addMessage("  profiler on/off - Enable or disable zone recording", ConsoleMessageType::INFO);
+        s_console->addMessage("  profiler pause/resume - Freeze the frame history for inspection", ConsoleMessageType::INFO);
+        s_console->addMessage("  profiler export [file] - Write Chrome trace JSON (default: profile.json)", ConsoleMessageType::INFO);
+        return;
+    }
+
+    Profiler& profiler = Profiler::instance();
+    std::string subcommand = args[1];
+
+    if (subcommand == "show" || subcommand == "hide") {
+        DebugState::instance().showProfiler.setValue(subcommand == "show");
+        s_console->addMessage("Profiler window: " + std::string(subcommand == "show" ? "ON" : "OFF"),
+                              ConsoleMessageType::INFO);
+    }
+    else if (subcommand == "on" || subcommand == "off") {
+        profiler.setEnabled(subcommand == "on");
+        s_console->addMessage("Profiler recording: " + std::string(subcommand == "on" ? "ON" : "OFF"),
+                              ConsoleMessageType::INFO);
+    }
+    else if (subcommand == "pause" || subcommand == "resume") {
+        profiler.setPaused(subcommand == "pause");
+        s_console->addMessage(subcommand == "pause" ? "Profiler history paused" : "Profiler history resumed",
+                              ConsoleMessageType::INFO);
+    }
+    else if (subcommand == "export") {
+        std::string path = args.size() > 2 ? args[2] : "profile.json";
+        if (profiler.exportChromeTrace(path)) {
+            s_console->addMessage("Profile written to " + path + " (open in ui.perfetto.dev)", ConsoleMessageType::INFO);
+        } else {
+            s_console->addMessage("Failed to write profile to " + path, ConsoleMessageType::ERROR);
+        }
+    }
+    else {
+        s_console->addMessage("Unknown profiler command: " + subcommand, ConsoleMessageType::ERROR);
+        s_console->addMessage("Available: show, hide, on, off, pause, resume, export", ConsoleMessageType::INFO);
+    }
+}
+
 void ConsoleCommands::cmd3DEditor(const std::vector<std::string>& args) {
     if (!s_skeletalEditor) {
         s_console->addMessage("Error: Skeletal editor not initialized", ConsoleMessageType::ERROR);
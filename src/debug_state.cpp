@@ -6,11 +6,13 @@ DebugState::DebugState()
       drawFPS("debug_drawfps", "Show FPS counter", false, FCVAR_ARCHIVE | FCVAR_NOTIFY),
       showTargetInfo("debug_targetinfo", "Show target information", false, FCVAR_ARCHIVE | FCVAR_NOTIFY),
       showCullingStats("debug_culling", "Show frustum culling statistics", false, FCVAR_ARCHIVE | FCVAR_NOTIFY),
+      showProfiler("debug_profiler", "Show zone profiler flame graph", false, FCVAR_NOTIFY),
       debugCollision("debug_collision", "Show collision detection debug output", false, FCVAR_ARCHIVE | FCVAR_NOTIFY),
       debugWorld("debug_world", "Show world/chunk debug logging", false, FCVAR_ARCHIVE | FCVAR_NOTIFY),
       debugWater("debug_water", "Show water simulation debug logging", false, FCVAR_ARCHIVE | FCVAR_NOTIFY),
       wireframeMode("wireframe", "Enable wireframe rendering mode", false, FCVAR_NOTIFY),
-      lightingEnabled("lighting", "Enable/disable voxel lighting system", true, FCVAR_ARCHIVE | FCVAR_NOTIFY) {
+      lightingEnabled("lighting", "Enable/disable voxel lighting system", true, FCVAR_ARCHIVE | FCVAR_NOTIFY),
+      smoothTerrain("smooth_terrain", "Surface-nets mesh smooth_terrain blocks in every biome", false, FCVAR_ARCHIVE | FCVAR_NOTIFY) {
 }
 
 DebugState& DebugState::instance() {
@@ -516,8 +516,10 @@ void ParticleEditor::renderViewport() {
             ? m_effect.emitters[emitterIdx]
             : m_effect.emitters[0];
 
-        for (const auto& particle : emitter->getParticles()) {
-            if (!particle.isAlive()) continue;
+        const ParticlePool& pool = emitter->getPool();
+        for (size_t i = 0; i < pool.size(); ++i) {
+            if (pool.emitterOf(i) != emitter->getSlot()) continue;
+            const ParticlePool::Sample particle = pool.sample(i);
 
             float screenX = centerX + particle.position.x * m_zoom * 10.0f;
             float screenY = centerY - particle.position.y * m_zoom * 10.0f;  // Y-up in world
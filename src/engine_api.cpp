@@ -5,6 +5,7 @@
 
 #include "engine_api.h"
 #include "world.h"
+#include "block_tick_system.h"
 #include "vulkan_renderer.h"
 #include "player.h"
 #include "block_system.h"
@@ -157,6 +158,27 @@ BlockQueryResult EngineAPI::getBlockAt(const glm::ivec3& pos) {
     return getBlockAt(pos.x, pos.y, pos.z);
 }
 
+int EngineAPI::getBlockID(const glm::ivec3& pos) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (!m_world) return -1;
+
+    const float x = static_cast<float>(pos.x);
+    const float y = static_cast<float>(pos.y);
+    const float z = static_cast<float>(pos.z);
+    if (!m_world->getChunkAtWorldPos(x, y, z)) return -1;
+    return m_world->getBlockAt(x, y, z);
+}
+
+bool EngineAPI::scheduleBlockTick(const glm::ivec3& pos, uint32_t delayTicks) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (!m_world || !m_world->getBlockTickSystem()) return false;
+
+    int blockID = m_world->getBlockAt(static_cast<float>(pos.x),
+                                      static_cast<float>(pos.y),
+                                      static_cast<float>(pos.z));
+    return m_world->getBlockTickSystem()->scheduleTick(pos, blockID, delayTicks);
+}
+
 // ============================================================================
 // Area Operations
 // ============================================================================
@@ -1,4 +1,5 @@
 #include "event_dispatcher.h"
+#include "logger.h"
 #include <algorithm>
 #include <chrono>
 
@@ -15,6 +16,7 @@ EventDispatcher::EventDispatcher()
     , m_eventsProcessed(0)
     , m_eventsCancelled(0)
 {
+    m_listenerTable = std::make_shared<const ListenerTable>();
 }
 
 // Destructor
@@ -56,12 +58,15 @@ bool EventDispatcher::isRunning() const {
     return m_running.load();
 }
 
+// Priority order shared by every listener list (highest first, stable for equal priorities)
+static bool higherPriority(const EventListener& a, const EventListener& b) {
+    return static_cast<int>(a.priority) > static_cast<int>(b.priority);
+}
+
 // Subscribe to events
 ListenerHandle EventDispatcher::subscribe(EventType type, EventCallback callback,
                                          EventPriority priority,
                                          const std::string& owner) {
-    std::lock_guard<std::mutex> lock(m_listenersMutex);
-
     EventListener listener;
     listener.handle = generateHandle();
     listener.type = type;
@@ -69,15 +74,13 @@ ListenerHandle EventDispatcher::subscribe(EventType type, EventCallback callback
     listener.callback = std::move(callback);
     listener.owner = owner;
 
-    m_listeners[type].push_back(std::move(listener));
-
-    // Sort listeners by priority (highest first)
-    std::sort(m_listeners[type].begin(), m_listeners[type].end(),
-        [](const EventListener& a, const EventListener& b) {
-            return static_cast<int>(a.priority) > static_cast<int>(b.priority);
-        });
-
-    return listener.handle;
+    const ListenerHandle handle = listener.handle;
+    updateListeners([&listener](ListenerTable& table) {
+        auto& listeners = table.listeners[static_cast<size_t>(listener.type)];
+        listeners.insert(std::upper_bound(listeners.begin(), listeners.end(), listener, higherPriority),
+                         std::move(listener));
+    });
+    return handle;
 }
 
 // Subscribe with filter
@@ -85,8 +88,6 @@ ListenerHandle EventDispatcher::subscribeFiltered(EventType type, EventCallback
                                                   EventFilter filter,
                                                   EventPriority priority,
                                                   const std::string& owner) {
-    std::lock_guard<std::mutex> lock(m_listenersMutex);
-
     FilteredListener filteredListener;
     filteredListener.listener.handle = generateHandle();
     filteredListener.listener.type = type;
@@ -95,96 +96,103 @@ ListenerHandle EventDispatcher::subscribeFiltered(EventType type, EventCallback
     filteredListener.listener.owner = owner;
     filteredListener.filter = std::move(filter);
 
-    m_filteredListeners[type].push_back(std::move(filteredListener));
+    const ListenerHandle handle = filteredListener.listener.handle;
+    updateListeners([&filteredListener](ListenerTable& table) {
+        auto& listeners = table.filtered[static_cast<size_t>(filteredListener.listener.type)];
+        auto it = std::upper_bound(listeners.begin(), listeners.end(), filteredListener,
+            [](const FilteredListener& a, const FilteredListener& b) {
+                return higherPriority(a.listener, b.listener);
+            });
+        listeners.insert(it, std::move(filteredListener));
+    });
+    return handle;
+}
 
-    // Sort filtered listeners by priority (highest first)
-    std::sort(m_filteredListeners[type].begin(), m_filteredListeners[type].end(),
-        [](const FilteredListener& a, const FilteredListener& b) {
-            return static_cast<int>(a.listener.priority) > static_cast<int>(b.listener.priority);
-        });
+// Subscribe to one block ID
+ListenerHandle EventDispatcher::subscribeBlock(EventType type, int blockID, EventCallback callback,
+                                               EventPriority priority,
+                                               const std::string& owner) {
+    if (blockID < 0) {
+        return subscribe(type, std::move(callback), priority, owner);
+    }
+
+    EventListener listener;
+    listener.handle = generateHandle();
+    listener.type = type;
+    listener.priority = priority;
+    listener.callback = std::move(callback);
+    listener.owner = owner;
+    listener.blockID = blockID;
 
-    return filteredListener.listener.handle;
+    const ListenerHandle handle = listener.handle;
+    updateListeners([&listener](ListenerTable& table) {
+        auto& byBlock = table.blockListeners[static_cast<size_t>(listener.type)];
+        if (static_cast<size_t>(listener.blockID) >= byBlock.size()) {
+            byBlock.resize(listener.blockID + 1);
+        }
+        auto& listeners = byBlock[listener.blockID];
+        listeners.insert(std::upper_bound(listeners.begin(), listeners.end(), listener, higherPriority),
+                         std::move(listener));
+    });
+    return handle;
 }
 
 // Unsubscribe by handle
 void EventDispatcher::unsubscribe(ListenerHandle handle) {
-    std::lock_guard<std::mutex> lock(m_listenersMutex);
-
-    // Search in regular listeners
-    for (auto& pair : m_listeners) {
-        auto& listeners = pair.second;
-        auto it = std::remove_if(listeners.begin(), listeners.end(),
-            [handle](const EventListener& listener) {
-                return listener.handle == handle;
-            });
-
-        if (it != listeners.end()) {
-            listeners.erase(it, listeners.end());
-            return;
+    updateListeners([handle](ListenerTable& table) {
+        auto matches = [handle](const EventListener& listener) { return listener.handle == handle; };
+        for (auto& listeners : table.listeners) {
+            listeners.erase(std::remove_if(listeners.begin(), listeners.end(), matches), listeners.end());
         }
-    }
-
-    // Search in filtered listeners
-    for (auto& pair : m_filteredListeners) {
-        auto& listeners = pair.second;
-        auto it = std::remove_if(listeners.begin(), listeners.end(),
-            [handle](const FilteredListener& listener) {
-                return listener.listener.handle == handle;
-            });
-
-        if (it != listeners.end()) {
-            listeners.erase(it, listeners.end());
-            return;
+        for (auto& listeners : table.filtered) {
+            listeners.erase(std::remove_if(listeners.begin(), listeners.end(),
+                [&matches](const FilteredListener& filtered) { return matches(filtered.listener); }),
+                listeners.end());
         }
-    }
+        for (auto& byBlock : table.blockListeners) {
+            for (auto& listeners : byBlock) {
+                listeners.erase(std::remove_if(listeners.begin(), listeners.end(), matches), listeners.end());
+            }
+        }
+    });
 }
 
 // Unsubscribe all by owner
 void EventDispatcher::unsubscribeAll(const std::string& owner) {
-    std::lock_guard<std::mutex> lock(m_listenersMutex);
-
-    // Remove from regular listeners
-    for (auto& pair : m_listeners) {
-        auto& listeners = pair.second;
-        auto it = std::remove_if(listeners.begin(), listeners.end(),
-            [&owner](const EventListener& listener) {
-                return listener.owner == owner;
-            });
-
-        if (it != listeners.end()) {
-            listeners.erase(it, listeners.end());
+    updateListeners([&owner](ListenerTable& table) {
+        auto matches = [&owner](const EventListener& listener) { return listener.owner == owner; };
+        for (auto& listeners : table.listeners) {
+            listeners.erase(std::remove_if(listeners.begin(), listeners.end(), matches), listeners.end());
         }
-    }
-
-    // Remove from filtered listeners
-    for (auto& pair : m_filteredListeners) {
-        auto& listeners = pair.second;
-        auto it = std::remove_if(listeners.begin(), listeners.end(),
-            [&owner](const FilteredListener& listener) {
-                return listener.listener.owner == owner;
-            });
-
-        if (it != listeners.end()) {
-            listeners.erase(it, listeners.end());
+        for (auto& listeners : table.filtered) {
+            listeners.erase(std::remove_if(listeners.begin(), listeners.end(),
+                [&matches](const FilteredListener& filtered) { return matches(filtered.listener); }),
+                listeners.end());
         }
-    }
+        for (auto& byBlock : table.blockListeners) {
+            for (auto& listeners : byBlock) {
+                listeners.erase(std::remove_if(listeners.begin(), listeners.end(), matches), listeners.end());
+            }
+        }
+    });
 }
 
 // Unsubscribe all by event type
 void EventDispatcher::unsubscribeAll(EventType type) {
-    std::lock_guard<std::mutex> lock(m_listenersMutex);
-
-    // Clear regular listeners
-    auto it = m_listeners.find(type);
-    if (it != m_listeners.end()) {
-        it->second.clear();
-    }
+    const size_t index = static_cast<size_t>(type);
+    updateListeners([index](ListenerTable& table) {
+        table.listeners[index].clear();
+        table.filtered[index].clear();
+        table.blockListeners[index].clear();
+    });
+}
 
-    // Clear filtered listeners
-    auto fit = m_filteredListeners.find(type);
-    if (fit != m_filteredListeners.end()) {
-        fit->second.clear();
-    }
+// Copy-on-write publish of the listener table
+void EventDispatcher::updateListeners(const std::function<void(ListenerTable&)>& mutate) {
+    std::lock_guard<std::mutex> lock(m_listenersMutex);
+    auto next = std::make_shared<ListenerTable>(*std::atomic_load(&m_listenerTable));
+    mutate(*next);
+    std::atomic_store(&m_listenerTable, ListenerSnapshot(std::move(next)));
 }
 
 // Dispatch event asynchronously
@@ -267,37 +275,22 @@ size_t EventDispatcher::getQueueSize() const {
 
 // Get listener count for event type
 size_t EventDispatcher::getListenerCount(EventType type) const {
-    std::lock_guard<std::mutex> lock(m_listenersMutex);
+    const ListenerSnapshot table = listenerSnapshot();
+    const size_t index = static_cast<size_t>(type);
 
-    size_t count = 0;
-
-    auto it = m_listeners.find(type);
-    if (it != m_listeners.end()) {
-        count += it->second.size();
+    size_t count = table->listeners[index].size() + table->filtered[index].size();
+    for (const auto& listeners : table->blockListeners[index]) {
+        count += listeners.size();
     }
-
-    auto fit = m_filteredListeners.find(type);
-    if (fit != m_filteredListeners.end()) {
-        count += fit->second.size();
-    }
-
     return count;
 }
 
 // Get total listener count
 size_t EventDispatcher::getTotalListenerCount() const {
-    std::lock_guard<std::mutex> lock(m_listenersMutex);
-
     size_t count = 0;
-
-    for (const auto& pair : m_listeners) {
-        count += pair.second.size();
+    for (size_t type = 0; type < EVENT_TYPE_COUNT; type++) {
+        count += getListenerCount(static_cast<EventType>(type));
     }
-
-    for (const auto& pair : m_filteredListeners) {
-        count += pair.second.size();
-    }
-
     return count;
 }
 
@@ -350,66 +343,100 @@ void EventDispatcher::eventHandlerThread() {
     }
 }
 
+// Invoke one listener, isolating the dispatcher from callback exceptions
+static void invokeListener(const EventListener& listener, Event& event) {
+    try {
+        listener.callback(event);
+    } catch (const std::exception& e) {
+        // Log and keep going: one broken handler must not starve the rest
+        Logger::error() << "Event listener '" << listener.owner << "' threw: " << e.what();
+    } catch (...) {
+        Logger::error() << "Event listener '" << listener.owner << "' threw an unknown exception";
+    }
+}
+
 // Process a single event
 void EventDispatcher::processEvent(Event& event) {
-    EventType type = event.type;
+    const size_t index = static_cast<size_t>(event.type);
+
+    // RCU snapshot: no lock and no copy; the table can't change under us
+    const ListenerSnapshot table = listenerSnapshot();
+    const std::vector<EventListener>& listeners = table->listeners[index];
+
+    // Per-block listeners for this event's block (all blocks if the event doesn't know it)
+    const std::vector<std::vector<EventListener>>& byBlock = table->blockListeners[index];
+    const std::vector<EventListener>* blockListeners = nullptr;
+    glm::ivec3 position;
+    int blockID = -1;
+    const bool isBlockEvent = !byBlock.empty() && getEventBlockTarget(event, position, blockID);
+    if (isBlockEvent && blockID >= 0 && static_cast<size_t>(blockID) < byBlock.size()) {
+        blockListeners = &byBlock[blockID];
+    }
 
-    // Snapshot listeners so callbacks don't run while holding the mutex.
-    std::vector<EventListener> listenersCopy;
-    {
-        std::lock_guard<std::mutex> lock(m_listenersMutex);
-        auto it = m_listeners.find(type);
-        if (it != m_listeners.end()) {
-            listenersCopy = it->second;
+    // Monitor priority always runs, others stop if cancelled
+    auto stopped = [&event](const EventListener& listener) {
+        return listener.priority != EventPriority::MONITOR && event.isCancelled();
+    };
+
+    if (isBlockEvent && blockID < 0) {
+        // Unknown target block: type-wide listeners and every block's, merged by priority
+        // (rare legacy broadcast, so gathering into one list is fine)
+        std::vector<const EventListener*> merged;
+        merged.reserve(listeners.size());
+        for (const auto& listener : listeners) {
+            merged.push_back(&listener);
+        }
+        for (const auto& perBlock : byBlock) {
+            for (const auto& listener : perBlock) {
+                merged.push_back(&listener);
+            }
+        }
+        // Stable: on equal priority, type-wide listeners run first, as in the per-block merge
+        std::stable_sort(merged.begin(), merged.end(), [](const EventListener* a, const EventListener* b) {
+            return higherPriority(*a, *b);
+        });
+        for (const EventListener* listener : merged) {
+            if (stopped(*listener)) break;
+            invokeListener(*listener, event);
+        }
+    } else if (blockListeners && !blockListeners->empty()) {
+        // Merge the two priority-sorted lists so priorities interleave correctly
+        auto it = listeners.begin();
+        auto blockIt = blockListeners->begin();
+        while (it != listeners.end() || blockIt != blockListeners->end()) {
+            const bool takeBlock = it == listeners.end() ||
+                (blockIt != blockListeners->end() && higherPriority(*blockIt, *it));
+            const EventListener& listener = takeBlock ? *blockIt++ : *it++;
+            if (stopped(listener)) break;
+            invokeListener(listener, event);
+        }
+    } else {
+        for (const auto& listener : listeners) {
+            if (stopped(listener)) break;
+            invokeListener(listener, event);
         }
     }
 
-    for (const auto& listener : listenersCopy) {
-        // Monitor priority always runs, others stop if cancelled
-        if (listener.priority != EventPriority::MONITOR && event.isCancelled()) {
+    // Process filtered listeners
+    for (const auto& filteredListener : table->filtered[index]) {
+        if (stopped(filteredListener.listener)) {
             break;
         }
 
+        // Check filter
         try {
-            // Call the callback
-            listener.callback(event);
+            if (!filteredListener.filter(event)) {
+                continue; // Filter rejected the event
+            }
         } catch (const std::exception& e) {
-            // Log error but continue processing other listeners
-            // In a real implementation, you'd use your logging system here
-            // For now, we'll silently catch to prevent crashes
+            Logger::error() << "Event filter of '" << filteredListener.listener.owner << "' threw: " << e.what();
+            continue; // Skip this listener
         } catch (...) {
-            // Catch all other exceptions
+            Logger::error() << "Event filter of '" << filteredListener.listener.owner << "' threw an unknown exception";
+            continue;
         }
-    }
-
-    // Process filtered listeners
-    auto fit = m_filteredListeners.find(type);
-    if (fit != m_filteredListeners.end()) {
-        for (const auto& filteredListener : fit->second) {
-            // Monitor priority always runs, others stop if cancelled
-            if (filteredListener.listener.priority != EventPriority::MONITOR &&
-                event.isCancelled()) {
-                break;
-            }
-
-            // Check filter
-            try {
-                if (!filteredListener.filter(event)) {
-                    continue; // Filter rejected the event
-                }
-            } catch (...) {
-                continue; // Filter threw exception, skip this listener
-            }
 
-            try {
-                // Call the callback
-                filteredListener.listener.callback(event);
-            } catch (const std::exception& e) {
-                // Log error but continue processing other listeners
-            } catch (...) {
-                // Catch all other exceptions
-            }
-        }
+        invokeListener(filteredListener.listener, event);
     }
 
     // Update statistics
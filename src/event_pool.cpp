@@ -0,0 +1,66 @@
+/**
+ * @file event_pool.cpp
+ * @brief Event allocation pool implementation
+ *
+ * Created: 2025-11-28
+ */
+
+#include "event_pool.h"
+#include <new>
+
+EventPool& EventPool::instance() {
+    // Intentionally leaked: queued events may be freed during static destruction
+    static EventPool* pool = new EventPool();
+    return *pool;
+}
+
+void* EventPool::allocate(size_t size) {
+    m_allocations.fetch_add(1, std::memory_order_relaxed);
+    if (size == 0 || size > MAX_POOLED_SIZE) {
+        m_oversized.fetch_add(1, std::memory_order_relaxed);
+        return ::operator new(size);
+    }
+
+    SizeClass& sizeClass = m_classes[classIndex(size)];
+    {
+        std::lock_guard<std::mutex> lock(sizeClass.mutex);
+        if (FreeNode* node = sizeClass.freeList) {
+            sizeClass.freeList = node->next;
+            return node;
+        }
+    }
+
+    // Refill: carve a slab into slots, keep one, push the rest
+    const size_t slotSize = (classIndex(size) + 1) * SIZE_CLASS;
+    unsigned char* slab;
+    {
+        std::lock_guard<std::mutex> lock(m_slabMutex);
+        m_slabs.emplace_back(new unsigned char[slotSize * SLOTS_PER_SLAB]);
+        slab = m_slabs.back().get();
+    }
+    m_slabRefills.fetch_add(1, std::memory_order_relaxed);
+
+    std::lock_guard<std::mutex> lock(sizeClass.mutex);
+    for (size_t i = 1; i < SLOTS_PER_SLAB; i++) {
+        FreeNode* node = reinterpret_cast<FreeNode*>(slab + i * slotSize);
+        node->next = sizeClass.freeList;
+        sizeClass.freeList = node;
+    }
+    return slab;
+}
+
+void EventPool::deallocate(void* ptr, size_t size) {
+    if (!ptr) {
+        return;
+    }
+    if (size == 0 || size > MAX_POOLED_SIZE) {
+        ::operator delete(ptr);
+        return;
+    }
+
+    SizeClass& sizeClass = m_classes[classIndex(size)];
+    FreeNode* node = static_cast<FreeNode*>(ptr);
+    std::lock_guard<std::mutex> lock(sizeClass.mutex);
+    node->next = sizeClass.freeList;
+    sizeClass.freeList = node;
+}
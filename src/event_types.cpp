@@ -4,6 +4,7 @@
  */
 
 #include "event_types.h"
+#include "event_pool.h"
 #include <chrono>
 
 // Helper function to get current timestamp
@@ -24,6 +25,14 @@ Event::Event(EventType t)
     , timestamp(getCurrentTimestamp())
 {}
 
+void* Event::operator new(std::size_t size) {
+    return EventPool::instance().allocate(size);
+}
+
+void Event::operator delete(void* ptr, std::size_t size) {
+    EventPool::instance().deallocate(ptr, size);
+}
+
 // ============================================================================
 // Block Events
 // ============================================================================
@@ -70,12 +79,13 @@ BlockUpdateEvent::BlockUpdateEvent(glm::ivec3 pos, int block)
 // Neighbor Events
 // ============================================================================
 
-NeighborChangedEvent::NeighborChangedEvent(glm::ivec3 pos, glm::ivec3 neighbor, int oldBlock, int newBlock)
+NeighborChangedEvent::NeighborChangedEvent(glm::ivec3 pos, glm::ivec3 neighbor, int oldBlock, int newBlock, int block)
     : Event(EventType::NEIGHBOR_CHANGED)
     , position(pos)
     , neighborPos(neighbor)
     , oldBlockID(oldBlock)
     , newBlockID(newBlock)
+    , blockID(block)
 {}
 
 // ============================================================================
@@ -140,3 +150,50 @@ CustomEvent::CustomEvent(const std::string& name, std::any eventData)
     , eventName(name)
     , data(std::move(eventData))
 {}
+
+// ============================================================================
+// Helpers
+// ============================================================================
+
+bool getEventBlockTarget(const Event& event, glm::ivec3& position, int& blockID) {
+    switch (event.type) {
+        case EventType::BLOCK_BREAK: {
+            const auto& e = static_cast<const BlockBreakEvent&>(event);
+            position = e.position;
+            blockID = e.blockID;
+            return true;
+        }
+        case EventType::BLOCK_PLACE: {
+            const auto& e = static_cast<const BlockPlaceEvent&>(event);
+            position = e.position;
+            blockID = e.blockID;
+            return true;
+        }
+        case EventType::BLOCK_INTERACT: {
+            const auto& e = static_cast<const BlockInteractEvent&>(event);
+            position = e.position;
+            blockID = e.blockID;
+            return true;
+        }
+        case EventType::BLOCK_STEP: {
+            const auto& e = static_cast<const BlockStepEvent&>(event);
+            position = e.position;
+            blockID = e.blockID;
+            return true;
+        }
+        case EventType::BLOCK_UPDATE: {
+            const auto& e = static_cast<const BlockUpdateEvent&>(event);
+            position = e.position;
+            blockID = e.blockID;
+            return true;
+        }
+        case EventType::NEIGHBOR_CHANGED: {
+            const auto& e = static_cast<const NeighborChangedEvent&>(event);
+            position = e.position;
+            blockID = e.blockID;
+            return true;
+        }
+        default:
+            return false;
+    }
+}
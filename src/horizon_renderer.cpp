@@ -0,0 +1,444 @@
+/**
+ * @file horizon_renderer.cpp
+ * @brief Clipmap heightfield horizon sampled from BiomeMap
+ *
+ * Created: 2025-11-28
+ */
+
+#include "horizon_renderer.h"
+#include "profiler.h"
+#include "biome_map.h"
+#include "map_preview.h"
+#include "vulkan_renderer.h"
+#include "terrain_constants.h"
+#include "logger.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+using namespace TerrainGeneration;
+
+namespace {
+
+constexpr int kFallbackHardwareConcurrency = 4;
+
+// Floor division (tile coordinates must round toward -inf for negative positions)
+inline int floorDiv(int a, int b) {
+    return (a >= 0) ? (a / b) : -((-a + b - 1) / b);
+}
+
+// Converts MapPreview's ABGR8888 (pre-darkened) to RGB565, undoing the darkening
+inline uint16_t toRgb565(uint32_t abgr) {
+    auto channel = [abgr](int shift) {
+        int value = static_cast<int>((abgr >> shift) & 0xFF);
+        return std::min(255, static_cast<int>(value * 1.5f));
+    };
+    const int r = channel(0);
+    const int g = channel(8);
+    const int b = channel(16);
+    return static_cast<uint16_t>(((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3));
+}
+
+}  // namespace
+
+HorizonRenderer::HorizonRenderer(BiomeMap* biomeMap, VulkanRenderer* renderer, int ringCount)
+    : m_biomeMap(biomeMap)
+    , m_renderer(renderer)
+    , m_ringCount(std::clamp(ringCount, 1, MAX_RINGS)) {
+}
+
+HorizonRenderer::~HorizonRenderer() {
+    stop();
+}
+
+void HorizonRenderer::start(int numWorkers) {
+    if (m_running.load() || !m_biomeMap) {
+        return;
+    }
+
+    // Horizon tiles are low priority next to chunk generation - use a small pool
+    if (numWorkers <= 0) {
+        const unsigned int hardwareConcurrency = std::thread::hardware_concurrency();
+        const int hardwareThreads = hardwareConcurrency > 0
+                                       ? static_cast<int>(hardwareConcurrency)
+                                       : kFallbackHardwareConcurrency;
+        numWorkers = std::max(1, hardwareThreads / 4);
+    }
+
+    Logger::info() << "Starting HorizonRenderer with " << m_ringCount << " rings, "
+                   << numWorkers << " tile workers (horizon distance " << getHorizonDistance() << " blocks)";
+
+    m_running.store(true);
+    m_workers.reserve(numWorkers);
+    for (int i = 0; i < numWorkers; ++i) {
+        m_workers.emplace_back(&HorizonRenderer::workerThreadFunction, this);
+    }
+}
+
+void HorizonRenderer::stop() {
+    if (m_running.load()) {
+        m_running.store(false);
+        m_requestCV.notify_all();
+        for (auto& worker : m_workers) {
+            if (worker.joinable()) {
+                worker.join();
+            }
+        }
+        m_workers.clear();
+    }
+
+    for (auto& ring : m_rings) {
+        destroyRingBuffers(ring);
+        ring = RingMesh{};
+    }
+}
+
+float HorizonRenderer::getHorizonDistance() const {
+    // The outermost ring spans 4 tiles either side of a center that lags the
+    // viewer by at most one tile
+    return static_cast<float>(3 * tileSize(m_ringCount - 1));
+}
+
+size_t HorizonRenderer::getCachedTileCount() const {
+    std::lock_guard<std::mutex> lock(m_tileCacheMutex);
+    return m_tileCache.size();
+}
+
+uint64_t HorizonRenderer::tileKey(int ring, int tileX, int tileZ) {
+    return (static_cast<uint64_t>(ring & 0xFF) << 56)
+         | (static_cast<uint64_t>(static_cast<uint32_t>(tileX) & 0x0FFFFFFFu) << 28)
+         | (static_cast<uint64_t>(static_cast<uint32_t>(tileZ) & 0x0FFFFFFFu));
+}
+
+bool HorizonRenderer::isCoveredByInnerRing(int ring, int tileX, int tileZ) const {
+    if (ring == 0 || !m_rings[ring - 1].valid) {
+        return false;
+    }
+
+    // Inner ring spans RING_TILES/2 of its tiles either side of an even center,
+    // which is exactly RING_TILES/4 of this ring's tiles either side of center/2
+    const RingMesh& inner = m_rings[ring - 1];
+    const int half = RING_TILES / 4;
+    const int innerX = inner.centerX / 2;
+    const int innerZ = inner.centerZ / 2;
+    return tileX >= innerX - half && tileX < innerX + half &&
+           tileZ >= innerZ - half && tileZ < innerZ + half;
+}
+
+void HorizonRenderer::generateTile(int ring, int tileX, int tileZ, Tile& out) const {
+    const int step = spacing(ring);
+    const int originX = tileX * tileSize(ring);
+    const int originZ = tileZ * tileSize(ring);
+
+    for (int x = 0; x < TILE_SAMPLES; ++x) {
+        for (int z = 0; z < TILE_SAMPLES; ++z) {
+            const float worldX = static_cast<float>(originX + x * step);
+            const float worldZ = static_cast<float>(originZ + z * step);
+
+            const int height = m_biomeMap->getTerrainHeightAt(worldX, worldZ);
+            const int temperature = static_cast<int>(m_biomeMap->getTemperatureAt(worldX, worldZ));
+            const int moisture = static_cast<int>(m_biomeMap->getMoistureAt(worldX, worldZ));
+
+            // Oceans and lakes render as a flat surface at sea level
+            const size_t index = static_cast<size_t>(x) * TILE_SAMPLES + z;
+            out.heights[index] = static_cast<int16_t>(std::max(height, WATER_LEVEL));
+            out.colors[index] = toRgb565(MapPreview::biomeToColor(temperature, moisture, static_cast<float>(height)));
+        }
+    }
+}
+
+void HorizonRenderer::workerThreadFunction() {
+    Profiler::setThreadName("Horizon Worker");
+
+    while (m_running.load()) {
+        glm::ivec3 request;
+        {
+            std::unique_lock<std::mutex> lock(m_requestMutex);
+            m_requestCV.wait(lock, [this] {
+                return !m_requestQueue.empty() || !m_running.load();
+            });
+            if (!m_running.load()) {
+                break;
+            }
+            request = m_requestQueue.front();
+            m_requestQueue.pop_front();
+        }
+
+        Tile tile;
+        generateTile(request.x, request.y, request.z, tile);
+        tile.lastUsed = m_updateCounter.load();  // Fresh tiles must not be the first evicted
+
+        const uint64_t key = tileKey(request.x, request.y, request.z);
+        {
+            std::lock_guard<std::mutex> lock(m_tileCacheMutex);
+            m_tileCache[key] = tile;
+        }
+        {
+            std::lock_guard<std::mutex> lock(m_requestMutex);
+            m_requested.erase(key);
+        }
+        m_tilesArrived.store(true);
+    }
+}
+
+void HorizonRenderer::update(const glm::vec3& viewerPos) {
+    PROFILE_ZONE("horizon_update");
+
+    if (!m_running.load()) {
+        return;
+    }
+    ++m_updateCounter;
+
+    const bool tilesArrived = m_tilesArrived.exchange(false);
+    const int viewerX = static_cast<int>(std::floor(viewerPos.x));
+    const int viewerZ = static_cast<int>(std::floor(viewerPos.z));
+
+    // Inner rings first: a ring's hole depends on the committed center of the ring inside it
+    for (int ring = 0; ring < m_ringCount; ++ring) {
+        RingMesh& mesh = m_rings[ring];
+
+        // Snap to a grid of two tiles so this ring's edges land on the coarser ring's tiles
+        const int snap = 2 * tileSize(ring);
+        const int targetX = 2 * floorDiv(viewerX + snap / 2, snap);
+        const int targetZ = 2 * floorDiv(viewerZ + snap / 2, snap);
+
+        const bool recentre = !mesh.valid || targetX != mesh.centerX || targetZ != mesh.centerZ;
+        if (!recentre && !mesh.dirty && (mesh.complete || !tilesArrived)) {
+            continue;
+        }
+
+        const int previousX = mesh.centerX;
+        const int previousZ = mesh.centerZ;
+        const bool previousValid = mesh.valid;
+        mesh.centerX = targetX;
+        mesh.centerZ = targetZ;
+        mesh.valid = true;
+
+        if (rebuildRing(ring)) {
+            mesh.dirty = false;
+            mesh.complete = true;
+            // The next coarser ring must re-cut its hole around the new center
+            if (recentre && ring + 1 < m_ringCount) {
+                m_rings[ring + 1].dirty = true;
+            }
+        } else if (previousValid && mesh.indexCount > 0) {
+            // Tiles still in flight - keep showing the old ring until they arrive
+            mesh.centerX = previousX;
+            mesh.centerZ = previousZ;
+            mesh.complete = false;
+        } else {
+            mesh.complete = false;
+        }
+    }
+
+    evictTiles();
+}
+
+bool HorizonRenderer::rebuildRing(int ring) {
+    RingMesh& mesh = m_rings[ring];
+    const int half = RING_TILES / 2;
+    const int step = spacing(ring);
+    const int size = tileSize(ring);
+
+    // Sink below the true surface so streamed chunks win the depth test where they exist
+    const int sink = step / 2;
+    const int skirtDepth = step * 2;
+
+    // Gather tiles (copy out under the lock; tiles are ~1 KB each)
+    struct PlacedTile {
+        int tileX, tileZ;
+        Tile tile;
+    };
+    std::vector<PlacedTile> tiles;
+    tiles.reserve(RING_TILES * RING_TILES);
+    std::vector<glm::ivec3> missing;
+
+    {
+        std::lock_guard<std::mutex> lock(m_tileCacheMutex);
+        for (int tx = mesh.centerX - half; tx < mesh.centerX + half; ++tx) {
+            for (int tz = mesh.centerZ - half; tz < mesh.centerZ + half; ++tz) {
+                if (isCoveredByInnerRing(ring, tx, tz)) {
+                    continue;
+                }
+                auto it = m_tileCache.find(tileKey(ring, tx, tz));
+                if (it == m_tileCache.end()) {
+                    missing.emplace_back(ring, tx, tz);
+                    continue;
+                }
+                it->second.lastUsed = m_updateCounter.load();
+                tiles.push_back({tx, tz, it->second});
+            }
+        }
+    }
+
+    if (!missing.empty()) {
+        {
+            std::lock_guard<std::mutex> lock(m_requestMutex);
+            for (const auto& request : missing) {
+                if (m_requested.insert(tileKey(request.x, request.y, request.z)).second) {
+                    m_requestQueue.push_back(request);
+                }
+            }
+        }
+        m_requestCV.notify_all();
+        return false;
+    }
+
+    m_buildVertices.clear();
+    m_buildIndices.clear();
+
+    auto makeVertex = [](int x, int y, int z, uint16_t color) {
+        CompressedVertex cv = CompressedVertex::pack(
+            static_cast<float>(x), static_cast<float>(y), static_cast<float>(z),
+            0, 0,
+            color,
+            CompressedVertex::CORNER_ORIGIN,
+            15, 0, 0, 15,
+            CompressedVertex::TINT_WHITE);
+        cv.packedB |= CompressedVertex::FLAG_HORIZON;
+        return cv;
+    };
+
+    // Tile edges that border the ring's outer edge or its hole get skirts; edges
+    // shared with another tile of the same ring line up exactly and need none
+    auto isRingBoundary = [&](int tx, int tz) {
+        const bool outside = tx < mesh.centerX - half || tx >= mesh.centerX + half ||
+                             tz < mesh.centerZ - half || tz >= mesh.centerZ + half;
+        return outside || isCoveredByInnerRing(ring, tx, tz);
+    };
+
+    for (const auto& placed : tiles) {
+        const Tile& tile = placed.tile;
+        const int originX = placed.tileX * size;
+        const int originZ = placed.tileZ * size;
+        const uint32_t base = static_cast<uint32_t>(m_buildVertices.size());
+
+        for (int x = 0; x < TILE_SAMPLES; ++x) {
+            for (int z = 0; z < TILE_SAMPLES; ++z) {
+                const size_t index = static_cast<size_t>(x) * TILE_SAMPLES + z;
+                m_buildVertices.push_back(makeVertex(originX + x * step, tile.heights[index] - sink,
+                                                     originZ + z * step, tile.colors[index]));
+            }
+        }
+
+        // Same corner order as chunk top faces: (0,0) (1,0) (1,1) (0,1)
+        for (int x = 0; x < TILE_CELLS; ++x) {
+            for (int z = 0; z < TILE_CELLS; ++z) {
+                const uint32_t v00 = base + x * TILE_SAMPLES + z;
+                const uint32_t v10 = v00 + TILE_SAMPLES;
+                const uint32_t v11 = v10 + 1;
+                const uint32_t v01 = v00 + 1;
+                m_buildIndices.insert(m_buildIndices.end(), {v00, v10, v11, v00, v11, v01});
+            }
+        }
+
+        // Skirts hide T-junction cracks against the next ring (both windings, seen from either side)
+        auto emitSkirt = [&](int x0, int z0, int dx, int dz) {
+            for (int i = 0; i < TILE_CELLS; ++i) {
+                const int ax = x0 + dx * i;
+                const int az = z0 + dz * i;
+                const int bx = ax + dx;
+                const int bz = az + dz;
+                const size_t ia = static_cast<size_t>(ax) * TILE_SAMPLES + az;
+                const size_t ib = static_cast<size_t>(bx) * TILE_SAMPLES + bz;
+                const int ha = tile.heights[ia] - sink;
+                const int hb = tile.heights[ib] - sink;
+
+                const uint32_t s = static_cast<uint32_t>(m_buildVertices.size());
+                m_buildVertices.push_back(makeVertex(originX + ax * step, ha, originZ + az * step, tile.colors[ia]));
+                m_buildVertices.push_back(makeVertex(originX + bx * step, hb, originZ + bz * step, tile.colors[ib]));
+                m_buildVertices.push_back(makeVertex(originX + bx * step, hb - skirtDepth, originZ + bz * step, tile.colors[ib]));
+                m_buildVertices.push_back(makeVertex(originX + ax * step, ha - skirtDepth, originZ + az * step, tile.colors[ia]));
+                m_buildIndices.insert(m_buildIndices.end(), {s, s + 1, s + 2, s, s + 2, s + 3,
+                                                             s, s + 2, s + 1, s, s + 3, s + 2});
+            }
+        };
+
+        if (isRingBoundary(placed.tileX - 1, placed.tileZ)) emitSkirt(0, 0, 0, 1);
+        if (isRingBoundary(placed.tileX + 1, placed.tileZ)) emitSkirt(TILE_CELLS, 0, 0, 1);
+        if (isRingBoundary(placed.tileX, placed.tileZ - 1)) emitSkirt(0, 0, 1, 0);
+        if (isRingBoundary(placed.tileX, placed.tileZ + 1)) emitSkirt(0, TILE_CELLS, 1, 0);
+    }
+
+    // Upload to host-visible buffers (a ring rebuild is rare, so no staging copy)
+    destroyRingBuffers(mesh);
+    if (m_buildIndices.empty()) {
+        return true;
+    }
+
+    VkDevice device = m_renderer->getDevice();
+    const VkDeviceSize vertexSize = sizeof(CompressedVertex) * m_buildVertices.size();
+    const VkDeviceSize indexSize = sizeof(uint32_t) * m_buildIndices.size();
+
+    m_renderer->createBuffer(vertexSize, VK_BUFFER_USAGE_VERTEX_BUFFER_BIT,
+                             VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+                             mesh.vertexBuffer, mesh.vertexMemory);
+    m_renderer->createBuffer(indexSize, VK_BUFFER_USAGE_INDEX_BUFFER_BIT,
+                             VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+                             mesh.indexBuffer, mesh.indexMemory);
+
+    void* data;
+    vkMapMemory(device, mesh.vertexMemory, 0, vertexSize, 0, &data);
+    memcpy(data, m_buildVertices.data(), static_cast<size_t>(vertexSize));
+    vkUnmapMemory(device, mesh.vertexMemory);
+
+    vkMapMemory(device, mesh.indexMemory, 0, indexSize, 0, &data);
+    memcpy(data, m_buildIndices.data(), static_cast<size_t>(indexSize));
+    vkUnmapMemory(device, mesh.indexMemory);
+
+    mesh.indexCount = static_cast<uint32_t>(m_buildIndices.size());
+    return true;
+}
+
+void HorizonRenderer::destroyRingBuffers(RingMesh& mesh) {
+    // Deferred deletion - the previous mesh may still be in flight
+    if (m_renderer) {
+        if (mesh.vertexBuffer != VK_NULL_HANDLE || mesh.vertexMemory != VK_NULL_HANDLE) {
+            m_renderer->queueBufferDeletion(mesh.vertexBuffer, mesh.vertexMemory);
+        }
+        if (mesh.indexBuffer != VK_NULL_HANDLE || mesh.indexMemory != VK_NULL_HANDLE) {
+            m_renderer->queueBufferDeletion(mesh.indexBuffer, mesh.indexMemory);
+        }
+    }
+    mesh.vertexBuffer = VK_NULL_HANDLE;
+    mesh.vertexMemory = VK_NULL_HANDLE;
+    mesh.indexBuffer = VK_NULL_HANDLE;
+    mesh.indexMemory = VK_NULL_HANDLE;
+    mesh.indexCount = 0;
+}
+
+void HorizonRenderer::evictTiles() {
+    std::lock_guard<std::mutex> lock(m_tileCacheMutex);
+    if (m_tileCache.size() <= MAX_CACHED_TILES) {
+        return;
+    }
+
+    // Drop the least recently used quarter
+    std::vector<std::pair<uint64_t, uint64_t>> byAge;  // (lastUsed, key)
+    byAge.reserve(m_tileCache.size());
+    for (const auto& [key, tile] : m_tileCache) {
+        byAge.emplace_back(tile.lastUsed, key);
+    }
+    const size_t removeCount = m_tileCache.size() - MAX_CACHED_TILES * 3 / 4;
+    std::nth_element(byAge.begin(), byAge.begin() + removeCount, byAge.end());
+    for (size_t i = 0; i < removeCount; ++i) {
+        m_tileCache.erase(byAge[i].second);
+    }
+}
+
+void HorizonRenderer::render(VkCommandBuffer commandBuffer) {
+    PROFILE_ZONE("horizon_render");
+
+    for (int ring = 0; ring < m_ringCount; ++ring) {
+        const RingMesh& mesh = m_rings[ring];
+        if (mesh.indexCount == 0) {
+            continue;
+        }
+
+        VkBuffer vertexBuffers[] = {mesh.vertexBuffer};
+        VkDeviceSize offsets[] = {0};
+        vkCmdBindVertexBuffers(commandBuffer, 0, 1, vertexBuffers, offsets);
+        vkCmdBindIndexBuffer(commandBuffer, mesh.indexBuffer, 0, VK_INDEX_TYPE_UINT32);
+        vkCmdDrawIndexed(commandBuffer, mesh.indexCount, 1, 0, 0, 0);
+    }
+}
@@ -1,4 +1,5 @@
 #include "lighting_system.h"
+#include "profiler.h"
 #include "world.h"
 #include "chunk.h"
 #include "block_system.h"
@@ -30,7 +31,8 @@ void LightingSystem::initializeWorldLighting(std::function<void(float)> progress
     Logger::info() << "Initializing world lighting...";
 
     // Get world bounds to iterate through all chunks
-    const auto& chunks = m_world->getChunks();
+    const ShardedChunkMap::Snapshot chunkSnapshot = m_world->getChunks();
+    const std::vector<Chunk*>& chunks = *chunkSnapshot;
     if (chunks.empty()) {
         Logger::info() << "No chunks to light!";
         return;
@@ -55,39 +57,29 @@ void LightingSystem::initializeWorldLighting(std::function<void(float)> progress
     // Scan all chunks for emissive block light sources (torches, lava, etc.)
     Logger::info() << "Scanning for block light sources (torches, lava, etc.)...";
     int emissiveBlockCount = 0;
+    const BlockPropertyTable& props = BlockRegistry::instance().properties();
 
     for (Chunk* chunk : chunks) {
-        // Scan chunk for emissive blocks
-        for (int x = 0; x < Chunk::WIDTH; x++) {
-            for (int y = 0; y < Chunk::HEIGHT; y++) {
-                for (int z = 0; z < Chunk::DEPTH; z++) {
-                    int blockID = chunk->getBlock(x, y, z);
-
-                    // Check if block is emissive (torch, lava, etc.)
-                    if (blockID != BlockID::AIR) {
-                        try {
-                            const auto& blockDef = BlockRegistry::instance().get(blockID);
-                            if (blockDef.isEmissive && blockDef.lightLevel > 0) {
-                                // Found emissive block - add as light source
-                                int worldX = (chunk->getChunkX() << 5) + x;
-                                int worldY = (chunk->getChunkY() << 5) + y;
-                                int worldZ = (chunk->getChunkZ() << 5) + z;
-
-                                glm::ivec3 pos(worldX, worldY, worldZ);
-                                uint8_t lightLevel = blockDef.lightLevel;  // Already 0-15
-
-                                // Set initial light and queue for propagation
-                                setBlockLight(pos, lightLevel);
-                                m_lightAddQueue.emplace_back(pos, lightLevel, false);
-                                emissiveBlockCount++;
-                            }
-                        } catch (...) {
-                            // Unknown block, skip
-                        }
-                    }
-                }
+        // Scan chunk for emissive blocks (all-air 8³ bricks skipped)
+        ChunkBricks::forEachBlock(chunk->getBricks().occupied(), [&](int x, int y, int z) {
+            int blockID = chunk->getBlock(x, y, z);
+
+            // Check if block is emissive (torch, lava, etc.) - air and unknown IDs have no flags
+            if (props.isEmissive(blockID)) {
+                // Found emissive block - add as light source
+                int worldX = (chunk->getChunkX() << 5) + x;
+                int worldY = (chunk->getChunkY() << 5) + y;
+                int worldZ = (chunk->getChunkZ() << 5) + z;
+
+                glm::ivec3 pos(worldX, worldY, worldZ);
+                uint8_t lightLevel = props.lightLevel(blockID);  // Already 0-15
+
+                // Set initial light and queue for propagation
+                setBlockLight(pos, lightLevel);
+                m_lightAddQueue.emplace_back(pos, lightLevel, false);
+                emissiveBlockCount++;
             }
-        }
+        });
     }
 
     Logger::info() << "Found " << emissiveBlockCount << " emissive blocks (torches, lava, etc.)";
@@ -141,6 +133,8 @@ void LightingSystem::initializeWorldLighting(std::function<void(float)> progress
 // ========== Update (Incremental) ==========
 
 void LightingSystem::update(float deltaTime, VulkanRenderer* renderer) {
+    PROFILE_ZONE("lighting_update");
+
     // Process light additions (new torches, sunlight spread, etc.)
     int addCount = 0;
     while (!m_lightAddQueue.empty() && addCount < MAX_LIGHT_ADDS_PER_FRAME) {
@@ -412,14 +406,8 @@ bool LightingSystem::isTransparent(const glm::ivec3& worldPos) const {
         return true;
     }
 
-    // Check block transparency property
-    try {
-        const auto& blockDef = BlockRegistry::instance().get(blockID);
-        return blockDef.transparency > 0.0f;
-    } catch (...) {
-        // Unknown block, treat as opaque
-        return false;
-    }
+    // Check block transparency property (unknown blocks have no flags and read as opaque)
+    return BlockRegistry::instance().properties().isTransparent(blockID);
 }
 
 void LightingSystem::markNeighborChunksDirty(Chunk* chunk, int localX, int localY, int localZ) {
@@ -477,7 +465,7 @@ void LightingSystem::regenerateDirtyChunks(int maxPerFrame, VulkanRenderer* rend
         // LIGHTING FIX: Actually regenerate mesh with updated lighting values
         try {
             // Regenerate mesh with new lighting data
-            chunk->generateMesh(m_world, false);  // Don't hold lock
+            chunk->generateMesh(m_world);
 
             // Upload mesh to GPU (async to prevent frame stalls)
             if (renderer != nullptr) {
@@ -668,8 +656,8 @@ void LightingSystem::removeLightStep(const LightNode& node) {
 std::vector<Chunk*> LightingSystem::getVisibleChunks(const Frustum& frustum) const {
     std::vector<Chunk*> visibleChunks;
 
-    const auto& allChunks = m_world->getChunks();
-    for (Chunk* chunk : allChunks) {
+    const ShardedChunkMap::Snapshot allChunks = m_world->getChunks();
+    for (Chunk* chunk : *allChunks) {
         if (!chunk) continue;
 
         // Use same frustum test as rendering
@@ -33,7 +33,10 @@
 #include "chunk.h"
 #include "world.h"
 #include "world_streaming.h"
+#include "chunk_trace.h"
+#include "horizon_renderer.h"
 #include "lighting_system.h"
+#include "block_tick_system.h"
 #include "block_system.h"
 #include "biome_system.h"
 #include "structure_system.h"
@@ -49,6 +52,8 @@
 #include "editor/editor_background.h"
 #include "debug_state.h"
 #include "perf_monitor.h"
+#include "profiler.h"
+#include "startup_timer.h"
 #include "targeting_system.h"
 #include "raycast.h"
 #include "input_manager.h"
@@ -106,6 +111,8 @@ static void check_vk_result(VkResult err) {
 }
 
 int main(int argc, char* argv[]) {
+    StartupTimer::instance().begin();
+
     // Parse command line arguments
     for (int i = 1; i < argc; i++) {
         std::string arg = argv[i];
@@ -162,6 +169,7 @@ int main(int argc, char* argv[]) {
             glfwTerminate();
             return -1;
         }
+        StartupTimer::instance().mark("Config + window");
         glfwSetFramebufferSizeCallback(window, framebuffer_size_callback);
         glfwSetScrollCallback(window, scroll_callback);
         // Keep mouse free in editor-only mode (debug 2), capture otherwise
@@ -225,6 +233,7 @@ int main(int argc, char* argv[]) {
         // Upload ImGui fonts
         ImGui_ImplVulkan_CreateFontsTexture();
         // Note: ImGui will handle font upload in the next frame
+        StartupTimer::instance().mark("ImGui init");
 
         // ========== EVENT SYSTEM INITIALIZATION ==========
         // Start the event dispatcher thread for async event processing
@@ -480,29 +489,47 @@ int main(int argc, char* argv[]) {
         renderLoadingScreen();
         std::cout << "Loading all registries in parallel..." << '\n';
 
-        // Launch parallel loading tasks
-        auto blockLoadFuture = std::async(std::launch::async, [&renderer]() {
+        // Launch parallel loading tasks (each returns its wall time in ms)
+        // PERFORMANCE (2025-11-28): Each registry also parses its YAML files on a thread pool, and
+        // the block atlas comes from the baked cache/ blob on warm starts (see asset_pipeline.h)
+        using AssetClock = std::chrono::steady_clock;
+        auto assetsStart = AssetClock::now();
+        auto elapsedMs = [](AssetClock::time_point start) {
+            return std::chrono::duration<double, std::milli>(AssetClock::now() - start).count();
+        };
+
+        auto blockLoadFuture = std::async(std::launch::async, [&renderer, elapsedMs]() {
+            auto start = AssetClock::now();
             std::cout << "  [Thread] Loading block registry..." << '\n';
             BlockRegistry::instance().loadBlocks("assets/blocks", &renderer);
             std::cout << "  [Thread] Block registry loaded!" << '\n';
+            return elapsedMs(start);
         });
 
-        auto structureLoadFuture = std::async(std::launch::async, []() {
+        auto structureLoadFuture = std::async(std::launch::async, [elapsedMs]() {
+            auto start = AssetClock::now();
             std::cout << "  [Thread] Loading structure registry..." << '\n';
             StructureRegistry::instance().loadStructures("assets/structures");
             std::cout << "  [Thread] Structure registry loaded!" << '\n';
+            return elapsedMs(start);
         });
 
-        auto biomeLoadFuture = std::async(std::launch::async, []() {
+        auto biomeLoadFuture = std::async(std::launch::async, [elapsedMs]() {
+            auto start = AssetClock::now();
             std::cout << "  [Thread] Loading biome registry..." << '\n';
             BiomeRegistry::getInstance().loadBiomes("assets/biomes");
             std::cout << "  [Thread] Biome registry loaded!" << '\n';
+            return elapsedMs(start);
         });
 
         // Wait for all registries to load (blocks takes longest ~500ms)
-        blockLoadFuture.get();
-        structureLoadFuture.get();
-        biomeLoadFuture.get();
+        double blockMs = blockLoadFuture.get();
+        double structureMs = structureLoadFuture.get();
+        double biomeMs = biomeLoadFuture.get();
+        std::cout << "Assets loaded in " << elapsedMs(assetsStart) << " ms (blocks " << blockMs
+                  << " ms, structures " << structureMs << " ms, biomes " << biomeMs << " ms; "
+                  << (BlockRegistry::instance().isAtlasFromCache() ? "warm start: baked atlas" : "cold start: atlas rebaked")
+                  << ")" << '\n';
         std::cout << "All registries loaded successfully!" << '\n';
 
         // Loading stage 4: Bind textures (25%)
@@ -514,6 +541,12 @@ int main(int argc, char* argv[]) {
             BlockRegistry::instance().getAtlasImageView(),
             BlockRegistry::instance().getAtlasSampler()
         );
+        if (BlockRegistry::instance().getTextureArrayView() != VK_NULL_HANDLE) {
+            renderer.bindBlockTextureArray(
+                BlockRegistry::instance().getTextureArrayView(),
+                BlockRegistry::instance().getTextureArraySampler()
+            );
+        }
 
         // Create ImGui descriptor set for the texture atlas (for inventory icons)
         std::cout << "Creating ImGui atlas descriptor..." << '\n';
@@ -548,7 +581,8 @@ int main(int argc, char* argv[]) {
                 seed = world.getSeed();
                 Chunk::initNoise(seed);  // Re-init with correct seed
 
-                auto& chunks = world.getChunks();
+                const ShardedChunkMap::Snapshot chunkSnapshot = world.getChunks();
+                const std::vector<Chunk*>& chunks = *chunkSnapshot;
                 std::cout << "Loaded " << chunks.size() << " chunks from disk" << '\n';
 
                 // PERFORMANCE FIX: Initialize lighting BEFORE generating meshes
@@ -1110,6 +1144,8 @@ int main(int argc, char* argv[]) {
         // Initialize world streaming for infinite world generation (skip in editor-only mode)
         std::cout << "Starting world streaming system..." << '\n';
         WorldStreaming worldStreaming(&world, world.getBiomeMap(), &renderer);
+        std::unique_ptr<HorizonRenderer> horizon;
+        float farClipDistance = 300.0f;  // Projection far plane (extended for far LOD / horizon)
 
         if (g_debugLevel != 2) {
             // SPAWN ANCHOR (2025-11-25): Keep spawn chunks permanently loaded (like Minecraft)
@@ -1118,7 +1154,27 @@ int main(int argc, char* argv[]) {
             const int ANCHOR_RADIUS = g_debugMode ? 3 : 6;
             worldStreaming.setSpawnAnchor(0, 2, 0, ANCHOR_RADIUS);  // chunk (0,2,0) = world origin surface
 
+            // HIERARCHICAL LOD (2025-11-27): Downsampled terrain out to the far LOD distance
+            // (0 disables far terrain; chunks beyond load distance then stay mesh-less)
+            const float farLodDistance = config.getFloat("Rendering", "far_lod_distance", 512.0f);
+            worldStreaming.setFarLodDistance(farLodDistance);
+            world.setFarLodDistance(farLodDistance);
+            renderer.setFarLodDistance(farLodDistance);
+
             worldStreaming.start();  // Starts worker threads (default: CPU cores - 1)
+
+            // HORIZON (2025-11-28): Heightfield clipmap beyond the streamed chunks (0 rings disables)
+            const int horizonRings = config.getInt("Rendering", "horizon_rings", 4);
+            if (horizonRings > 0) {
+                horizon = std::make_unique<HorizonRenderer>(world.getBiomeMap(), &renderer, horizonRings);
+                horizon->start();
+            }
+
+            // Far terrain must not be clipped before its shader fade distance
+            farClipDistance = std::max(farClipDistance, farLodDistance * 1.05f);
+            if (horizon) {
+                farClipDistance = std::max(farClipDistance, horizon->getHorizonDistance() * 1.05f);
+            }
         }
 
         // Initialize mesh rendering system
@@ -1287,7 +1343,12 @@ int main(int argc, char* argv[]) {
 
         std::cout << "Entering main loop..." << '\n';
 
+        Profiler::setThreadName("Main");
         while (!glfwWindowShouldClose(window) && gameState == GameState::IN_GAME) {
+            // Zone profiler: close the previous frame, then time this one
+            Profiler::instance().frameMark();
+            PROFILE_ZONE("frame");
+
             auto frameStart = std::chrono::high_resolution_clock::now();
             auto checkpoint = frameStart;
 
@@ -1553,11 +1614,7 @@ int main(int argc, char* argv[]) {
                     lightingUpdateTimer = 0.0f;
                     if (DebugState::instance().lightingEnabled.getValue()) {
                         world.getLightingSystem()->update(clampedDeltaTime, &renderer);
-
-                        // PERFORMANCE OPTIMIZATION (2025-11-23): Disabled interpolated lighting
-                        // Was updating 32,768 values per chunk every frame = 40-80M operations/sec!
-                        // Now uses direct lighting values for massive CPU savings on lower-end hardware
-                        // world.updateInterpolatedLighting(clampedDeltaTime);
+                        // Light changes fade in on the GPU (Chunk::getLightTransitionBlend)
                     }
                 }
             }
@@ -1621,6 +1678,9 @@ int main(int argc, char* argv[]) {
             const float renderDistance = 80.0f;  // Reduced from 120 for better performance
             auto afterStreaming = std::chrono::high_resolution_clock::now();
             if (!ConsoleCommands::isFrozen()) {
+                // Camera direction feeds the streaming deadline scheduler (cheap, every frame)
+                worldStreaming.setViewDirection(player.Front);
+
                 static float streamingUpdateTimer = 0.0f;
                 streamingUpdateTimer += clampedDeltaTime;
                 const float STREAMING_UPDATE_INTERVAL = 0.25f;  // 4 times per second
@@ -1630,10 +1690,23 @@ int main(int argc, char* argv[]) {
                     const float loadDistance = renderDistance + 32.0f;     // Load chunks slightly beyond render distance
                     const float unloadDistance = renderDistance + 192.0f;  // Hysteresis: chunks stay loaded longer when moving away
                     worldStreaming.updatePlayerPosition(player.Position, loadDistance, unloadDistance);
+
+                    // Chunks inside the load distance are always resident - hide the horizon there
+                    if (horizon) {
+                        renderer.setHorizonDistances(loadDistance, horizon->getHorizonDistance());
+                    }
+                }
+
+                // Horizon rings recentre independently of the streaming interval (cheap when idle)
+                if (horizon) {
+                    horizon->update(player.Position);
                 }
                 afterStreaming = std::chrono::high_resolution_clock::now();
             }
 
+            // Drain per-thread chunk trace rings (no-op while tracing is off)
+            ChunkTrace::instance().collect();
+
             // Record streaming timing and queue sizes
             {
                 auto streamingDuration = std::chrono::duration_cast<std::chrono::microseconds>(afterStreaming - checkpoint);
@@ -1686,7 +1759,7 @@ int main(int argc, char* argv[]) {
             glfwGetFramebufferSize(window, &width, &height);
             float aspect = float(width) / float(height);
             // Near plane at 0.01 allows getting very close to blocks without clipping
-            glm::mat4 projection = glm::perspective(glm::radians(45.0f), aspect, 0.01f, 300.0f);
+            glm::mat4 projection = glm::perspective(glm::radians(45.0f), aspect, 0.01f, farClipDistance);
             // Flip Y axis for Vulkan (Vulkan's Y axis points down in NDC, OpenGL's points up)
             projection[1][1] *= -1;
 
@@ -1815,6 +1888,11 @@ int main(int argc, char* argv[]) {
                 world.updateWaterSimulation(clampedDeltaTime, &renderer, player.Position, renderDistance);
             }
 
+            // Scheduled + random block ticks (fixed 20 ticks/s, capped catch-up)
+            if (!ConsoleCommands::isFrozen()) {
+                world.getBlockTickSystem()->update(clampedDeltaTime, &renderer, &worldStreaming);
+            }
+
             // Begin rendering
             if (!renderer.beginFrame()) {
                 // Skip this frame (swap chain recreation in progress)
@@ -1840,11 +1918,16 @@ int main(int argc, char* argv[]) {
                 renderer.bindPipelineCached(renderer.getCurrentCommandBuffer(), worldPipeline);
                 vkCmdBindDescriptorSets(renderer.getCurrentCommandBuffer(), VK_PIPELINE_BIND_POINT_GRAPHICS,
                                        renderer.getPipelineLayout(), 0, 1, &currentDescriptorSet, 0, nullptr);
+
+                // Distant horizon shares the chunk pipeline (one draw per clipmap ring)
+                if (horizon) {
+                    horizon->render(renderer.getCurrentCommandBuffer());
+                }
                 world.renderWorld(renderer.getCurrentCommandBuffer(), player.Position, viewProj, renderDistance, &renderer);
                 afterWorldRender = std::chrono::high_resolution_clock::now();
 
                 // Render meshes (shares depth buffer with voxels)
-                meshRenderer.render(renderer.getCurrentCommandBuffer());
+                meshRenderer.render(renderer.getCurrentCommandBuffer(), viewProj);
 
                 // Render block outline with line pipeline
                 if (target.hasTarget) {
@@ -1991,7 +2074,8 @@ int main(int argc, char* argv[]) {
                 ImGui::Begin("Culling Stats", nullptr, ImGuiWindowFlags_NoDecoration | ImGuiWindowFlags_NoInputs |
                             ImGuiWindowFlags_AlwaysAutoResize | ImGuiWindowFlags_NoSavedSettings);
                 ImGui::Text("=== Chunk Culling ===");
-                ImGui::Text("Rendered: %d", DebugState::instance().chunksRendered);
+                ImGui::Text("Rendered: %d (far LOD: %d)", DebugState::instance().chunksRendered,
+                            DebugState::instance().chunksRenderedLod);
                 ImGui::Text("Distance Culled: %d", DebugState::instance().chunksDistanceCulled);
                 ImGui::Text("Frustum Culled: %d", DebugState::instance().chunksFrustumCulled);
                 ImGui::Text("Total in World: %d", DebugState::instance().chunksTotalInWorld);
@@ -2001,9 +2085,26 @@ int main(int argc, char* argv[]) {
                 int totalChunks = DebugState::instance().chunksTotalInWorld;
                 float cullingPercent = (totalChunks > 0) ? (totalCulled * 100.0f / totalChunks) : 0.0f;
                 ImGui::Text("Culled: %.1f%%", cullingPercent);
+
+                const DebugState& debug = DebugState::instance();
+                ImGui::Text("=== Chunk Cache ===");
+                ImGui::Text("Hot: %d (%.0f MB), Warm: %d (%.1f MB)", debug.chunkCacheHotChunks, debug.chunkCacheHotMB,
+                            debug.chunkCacheWarmChunks, debug.chunkCacheWarmMB);
+                ImGui::Text("Hit rate: hot %.1f%%, warm %.1f%%, disk %.1f%%", debug.chunkCacheHotHitRate * 100.0f,
+                            debug.chunkCacheWarmHitRate * 100.0f, debug.chunkCacheColdHitRate * 100.0f);
+                ImGui::Text("Write-backs: %d", debug.chunkCacheWriteBacks);
                 ImGui::End();
             }
 
+            // Render zone profiler window if enabled
+            if (DebugState::instance().showProfiler.getValue()) {
+                bool profilerOpen = true;
+                Profiler::instance().drawWindow(&profilerOpen);
+                if (!profilerOpen) {
+                    DebugState::instance().showProfiler.setValue(false);
+                }
+            }
+
             ImGui::Render();
             ImGui_ImplVulkan_RenderDrawData(ImGui::GetDrawData(), renderer.getCurrentCommandBuffer());
 
@@ -2075,6 +2176,9 @@ int main(int argc, char* argv[]) {
                     // Stop world streaming
                     std::cout << "  Stopping world streaming..." << '\n';
                     worldStreaming.stop();
+                    if (horizon) {
+                        horizon->stop();
+                    }
 
                     // Wait for GPU to finish before cleanup
                     std::cout << "  Waiting for GPU to finish..." << '\n';
@@ -2142,6 +2246,7 @@ int main(int argc, char* argv[]) {
         glfwTerminate();
         std::cout << "  Cleaning up noise..." << '\n';
         Chunk::cleanupNoise();
+        Profiler::instance().shutdown();  // Frees thread rings and the frame history
 
         std::cout << "Shutdown complete." << '\n';
         std::cout << "Exiting main()..." << '\n';
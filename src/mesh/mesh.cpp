@@ -211,31 +211,24 @@ size_t Mesh::getCPUMemoryUsage() const {
 
 // ========== InstanceData ==========
 
+static_assert(sizeof(InstanceData) == 112, "InstanceData must match InstanceRecord in mesh.vert");
+
 VkVertexInputBindingDescription InstanceData::getBindingDescription() {
     VkVertexInputBindingDescription bindingDescription{};
-    bindingDescription.binding = 1;  // Instance buffer is binding 1
-    bindingDescription.stride = sizeof(InstanceData);
+    bindingDescription.binding = 1;  // Visible slot buffer is binding 1
+    bindingDescription.stride = sizeof(uint32_t);
     bindingDescription.inputRate = VK_VERTEX_INPUT_RATE_INSTANCE;
     return bindingDescription;
 }
 
 std::vector<VkVertexInputAttributeDescription> InstanceData::getAttributeDescriptions() {
-    std::vector<VkVertexInputAttributeDescription> attributeDescriptions(5);
-
-    // mat4 transform (takes 4 attribute slots, locations 7-10)
-    // Locations 5-6 are now used by bone data
-    for (uint32_t i = 0; i < 4; i++) {
-        attributeDescriptions[i].binding = 1;
-        attributeDescriptions[i].location = 7 + i;
-        attributeDescriptions[i].format = VK_FORMAT_R32G32B32A32_SFLOAT;
-        attributeDescriptions[i].offset = offsetof(InstanceData, transform) + sizeof(glm::vec4) * i;
-    }
+    std::vector<VkVertexInputAttributeDescription> attributeDescriptions(1);
 
-    // vec4 tintColor (location 11)
-    attributeDescriptions[4].binding = 1;
-    attributeDescriptions[4].location = 11;
-    attributeDescriptions[4].format = VK_FORMAT_R32G32B32A32_SFLOAT;
-    attributeDescriptions[4].offset = offsetof(InstanceData, tintColor);
+    // uint slot into the instance table (location 7; 5-6 are bone data)
+    attributeDescriptions[0].binding = 1;
+    attributeDescriptions[0].location = 7;
+    attributeDescriptions[0].format = VK_FORMAT_R32_UINT;
+    attributeDescriptions[0].offset = 0;
 
     return attributeDescriptions;
 }
@@ -0,0 +1,303 @@
+/**
+ * @file mesh_batch.cpp
+ * @brief Mega-buffer suballocation, instance table dirty tracking and indirect draw building
+ *
+ * Created: 2025-11-28
+ */
+
+#include "mesh/mesh_batch.h"
+#include <algorithm>
+#include <cmath>
+
+// ========== RangeAllocator ==========
+
+RangeAllocator::RangeAllocator(uint32_t capacity)
+    : m_capacity(capacity) {
+    if (capacity > 0) {
+        m_freeRanges[0] = capacity;
+    }
+}
+
+uint32_t RangeAllocator::allocate(uint32_t count) {
+    if (count == 0) {
+        return INVALID_OFFSET;
+    }
+
+    for (auto it = m_freeRanges.begin(); it != m_freeRanges.end(); ++it) {
+        if (it->second < count) continue;
+
+        const uint32_t offset = it->first;
+        const uint32_t remaining = it->second - count;
+        m_freeRanges.erase(it);
+        if (remaining > 0) {
+            m_freeRanges[offset + count] = remaining;
+        }
+        m_used += count;
+        return offset;
+    }
+    return INVALID_OFFSET;
+}
+
+void RangeAllocator::free(uint32_t offset, uint32_t count) {
+    if (count == 0 || offset == INVALID_OFFSET) {
+        return;
+    }
+    m_used -= count;
+
+    auto next = m_freeRanges.lower_bound(offset);
+
+    // Merge with the preceding free range
+    if (next != m_freeRanges.begin()) {
+        auto prev = std::prev(next);
+        if (prev->first + prev->second == offset) {
+            offset = prev->first;
+            count += prev->second;
+            m_freeRanges.erase(prev);
+        }
+    }
+
+    // Merge with the following free range
+    if (next != m_freeRanges.end() && offset + count == next->first) {
+        count += next->second;
+        m_freeRanges.erase(next);
+    }
+
+    m_freeRanges[offset] = count;
+}
+
+void RangeAllocator::grow(uint32_t newCapacity) {
+    if (newCapacity <= m_capacity) {
+        return;
+    }
+    const uint32_t oldCapacity = m_capacity;
+    m_capacity = newCapacity;
+    m_used += newCapacity - oldCapacity;  // free() below subtracts it again
+    free(oldCapacity, newCapacity - oldCapacity);
+}
+
+// ========== MeshBatch ==========
+
+MeshBatch::MeshBatch(uint32_t vertexCapacity, uint32_t indexCapacity, uint32_t instanceCapacity, uint32_t frameCopies)
+    : m_vertices(vertexCapacity)
+    , m_indices(indexCapacity)
+    , m_table(instanceCapacity)
+    , m_slots(instanceCapacity)
+    , m_dirtyFlags(instanceCapacity, 0)
+    , m_pending(std::max(1u, frameCopies)) {
+    // Hand out low slots first so the live part of the table stays compact
+    m_freeSlots.reserve(instanceCapacity);
+    for (uint32_t slot = instanceCapacity; slot > 0; slot--) {
+        m_freeSlots.push_back(slot - 1);
+    }
+}
+
+const MeshBatch::MeshRange* MeshBatch::addMesh(uint32_t meshId, uint32_t vertexCount, uint32_t indexCount,
+                                               const glm::vec3& boundsMin, const glm::vec3& boundsMax) {
+    if (meshId == 0 || m_meshes.count(meshId) != 0) {
+        return nullptr;
+    }
+
+    const uint32_t firstVertex = m_vertices.allocate(vertexCount);
+    if (firstVertex == RangeAllocator::INVALID_OFFSET) {
+        return nullptr;
+    }
+    const uint32_t firstIndex = m_indices.allocate(indexCount);
+    if (firstIndex == RangeAllocator::INVALID_OFFSET) {
+        m_vertices.free(firstVertex, vertexCount);
+        return nullptr;
+    }
+
+    MeshEntry& entry = m_meshes[meshId];
+    entry.range.firstVertex = firstVertex;
+    entry.range.vertexCount = vertexCount;
+    entry.range.firstIndex = firstIndex;
+    entry.range.indexCount = indexCount;
+    entry.range.boundsMin = boundsMin;
+    entry.range.boundsMax = boundsMax;
+    return &entry.range;
+}
+
+void MeshBatch::removeMesh(uint32_t meshId) {
+    auto it = m_meshes.find(meshId);
+    if (it == m_meshes.end()) {
+        return;
+    }
+
+    // Release slots directly (removeInstance would shuffle the list we're walking)
+    for (uint32_t slot : it->second.slots) {
+        m_slots[slot] = SlotInfo{};
+        m_freeSlots.push_back(slot);
+        m_instanceCount--;
+    }
+
+    const MeshRange& range = it->second.range;
+    m_vertices.free(range.firstVertex, range.vertexCount);
+    m_indices.free(range.firstIndex, range.indexCount);
+    m_meshes.erase(it);
+}
+
+const MeshBatch::MeshRange* MeshBatch::mesh(uint32_t meshId) const {
+    auto it = m_meshes.find(meshId);
+    return it != m_meshes.end() ? &it->second.range : nullptr;
+}
+
+void MeshBatch::setMeshBounds(uint32_t meshId, const glm::vec3& boundsMin, const glm::vec3& boundsMax) {
+    auto it = m_meshes.find(meshId);
+    if (it != m_meshes.end()) {
+        it->second.range.boundsMin = boundsMin;
+        it->second.range.boundsMax = boundsMax;
+    }
+}
+
+uint32_t MeshBatch::addInstance(uint32_t meshId, const InstanceData& data) {
+    auto it = m_meshes.find(meshId);
+    if (it == m_meshes.end() || m_freeSlots.empty()) {
+        return INVALID_SLOT;
+    }
+
+    const uint32_t slot = m_freeSlots.back();
+    m_freeSlots.pop_back();
+
+    SlotInfo& info = m_slots[slot];
+    info.meshId = meshId;
+    info.listIndex = static_cast<uint32_t>(it->second.slots.size());
+    info.visible = true;
+    it->second.slots.push_back(slot);
+
+    m_table[slot] = data;
+    markDirty(slot);
+    m_instanceCount++;
+    return slot;
+}
+
+void MeshBatch::removeInstance(uint32_t slot) {
+    if (slot >= m_slots.size() || m_slots[slot].meshId == 0) {
+        return;
+    }
+
+    // Swap-remove from the mesh's slot list
+    std::vector<uint32_t>& slots = m_meshes[m_slots[slot].meshId].slots;
+    const uint32_t listIndex = m_slots[slot].listIndex;
+    slots[listIndex] = slots.back();
+    m_slots[slots[listIndex]].listIndex = listIndex;
+    slots.pop_back();
+
+    m_slots[slot] = SlotInfo{};
+    m_freeSlots.push_back(slot);
+    m_instanceCount--;
+}
+
+InstanceData& MeshBatch::edit(uint32_t slot) {
+    markDirty(slot);
+    return m_table[slot];
+}
+
+void MeshBatch::setVisible(uint32_t slot, bool visible) {
+    if (slot < m_slots.size()) {
+        m_slots[slot].visible = visible;
+    }
+}
+
+bool MeshBatch::isVisible(uint32_t slot) const {
+    return slot < m_slots.size() && m_slots[slot].meshId != 0 && m_slots[slot].visible;
+}
+
+const std::vector<uint32_t>& MeshBatch::meshSlots(uint32_t meshId) const {
+    static const std::vector<uint32_t> empty;
+    auto it = m_meshes.find(meshId);
+    return it != m_meshes.end() ? it->second.slots : empty;
+}
+
+void MeshBatch::markDirty(uint32_t slot) {
+    if (!m_dirtyFlags[slot]) {
+        m_dirtyFlags[slot] = 1;
+        m_dirtySlots.push_back(slot);
+    }
+}
+
+std::vector<MeshBatch::SlotRange> MeshBatch::takeUploads(uint32_t frameCopy) {
+    // Newly dirtied slots go to every copy's queue
+    if (!m_dirtySlots.empty()) {
+        for (std::vector<uint32_t>& pending : m_pending) {
+            pending.insert(pending.end(), m_dirtySlots.begin(), m_dirtySlots.end());
+        }
+        for (uint32_t slot : m_dirtySlots) {
+            m_dirtyFlags[slot] = 0;
+        }
+        m_dirtySlots.clear();
+    }
+
+    std::vector<SlotRange> ranges;
+    std::vector<uint32_t>& pending = m_pending[frameCopy % m_pending.size()];
+    if (pending.empty()) {
+        return ranges;
+    }
+
+    std::sort(pending.begin(), pending.end());
+    pending.erase(std::unique(pending.begin(), pending.end()), pending.end());
+
+    for (uint32_t slot : pending) {
+        if (!ranges.empty() && ranges.back().first + ranges.back().count == slot) {
+            ranges.back().count++;
+        } else {
+            ranges.push_back({slot, 1});
+        }
+    }
+    pending.clear();
+    return ranges;
+}
+
+void MeshBatch::transformBounds(const glm::mat4& transform, const glm::vec3& localMin, const glm::vec3& localMax,
+                                glm::vec3& outMin, glm::vec3& outMax) {
+    // Center/extent form: the world extent is |M3x3| * local extent (Arvo)
+    const glm::vec3 center = (localMin + localMax) * 0.5f;
+    const glm::vec3 extent = (localMax - localMin) * 0.5f;
+
+    const glm::vec3 worldCenter = glm::vec3(transform * glm::vec4(center, 1.0f));
+    glm::vec3 worldExtent(0.0f);
+    for (int axis = 0; axis < 3; axis++) {
+        worldExtent += glm::abs(glm::vec3(transform[axis])) * extent[axis];
+    }
+
+    outMin = worldCenter - worldExtent;
+    outMax = worldCenter + worldExtent;
+}
+
+MeshBatch::DrawStats MeshBatch::buildDraws(const Frustum& frustum,
+                                           std::vector<VkDrawIndexedIndirectCommand>& outCommands,
+                                           std::vector<uint32_t>& outVisibleSlots) const {
+    DrawStats stats;
+    outCommands.clear();
+    outVisibleSlots.clear();
+
+    for (const auto& [meshId, entry] : m_meshes) {
+        const uint32_t firstInstance = static_cast<uint32_t>(outVisibleSlots.size());
+
+        for (uint32_t slot : entry.slots) {
+            if (!m_slots[slot].visible) continue;
+
+            glm::vec3 worldMin, worldMax;
+            transformBounds(m_table[slot].transform, entry.range.boundsMin, entry.range.boundsMax, worldMin, worldMax);
+            if (!frustumAABBIntersect(frustum, worldMin, worldMax, 0.0f)) {
+                stats.frustumCulled++;
+                continue;
+            }
+            outVisibleSlots.push_back(slot);
+        }
+
+        const uint32_t instanceCount = static_cast<uint32_t>(outVisibleSlots.size()) - firstInstance;
+        if (instanceCount == 0) continue;
+
+        VkDrawIndexedIndirectCommand cmd{};
+        cmd.indexCount = entry.range.indexCount;
+        cmd.instanceCount = instanceCount;
+        cmd.firstIndex = entry.range.firstIndex;
+        cmd.vertexOffset = static_cast<int32_t>(entry.range.firstVertex);
+        cmd.firstInstance = firstInstance;
+        outCommands.push_back(cmd);
+    }
+
+    stats.drawCount = static_cast<uint32_t>(outCommands.size());
+    stats.visibleInstances = static_cast<uint32_t>(outVisibleSlots.size());
+    return stats;
+}
@@ -9,15 +9,22 @@
 #include <glm/gtc/matrix_transform.hpp>
 #include <yaml-cpp/yaml.h>
 #include <algorithm>
+#include <array>
+#include <cstring>
 
 // ========== Construction/Destruction ==========
 
 MeshRenderer::MeshRenderer(VulkanRenderer* renderer)
-    : m_renderer(renderer) {
+    : m_renderer(renderer)
+    , m_batch(INITIAL_MEGA_VERTICES, INITIAL_MEGA_INDICES, MAX_INSTANCES, renderer->getFramesInFlight()) {
 
     // Initialize texture resources
     initializeTextureResources();
 
+    // Mega-buffers, instance tables and the bone/instance descriptor sets
+    initializeBoneBuffer();
+    initializeBatchResources();
+
     // Create default material
     PBRMaterial defaultMat = PBRMaterial::createDefault();
     m_defaultMaterialId = createMaterial(defaultMat);
@@ -40,17 +47,9 @@ MeshRenderer::~MeshRenderer() {
     }
     m_pendingDeletions.clear();
 
-    // Destroy all meshes (also destroys buffers)
-    for (auto& [id, meshData] : m_meshes) {
-        if (meshData.mesh.hasGPUBuffers()) {
-            m_renderer->destroyMeshBuffers(meshData.mesh.vertexBuffer, meshData.mesh.indexBuffer,
-                                          meshData.mesh.vertexMemory, meshData.mesh.indexMemory);
-        }
-        if (meshData.instanceBuffer != VK_NULL_HANDLE) {
-            m_renderer->destroyMeshBuffers(meshData.instanceBuffer, VK_NULL_HANDLE,
-                                          meshData.instanceMemory, VK_NULL_HANDLE);
-        }
-    }
+    // Meshes live in the mega-buffers (destroyed with the batch resources)
+    m_meshes.clear();
+    m_instances.clear();
 
     // Destroy all materials
     for (auto& [id, matData] : m_materials) {
@@ -62,6 +61,9 @@ MeshRenderer::~MeshRenderer() {
     // Clean up textures
     cleanupTextures();
 
+    // Clean up mega-buffers, instance tables and descriptor sets
+    cleanupBatchResources();
+
     // Clean up bone buffer
     cleanupBoneBuffer();
 
@@ -131,9 +133,12 @@ uint32_t MeshRenderer::createMesh(const Mesh& mesh) {
     MeshData meshData;
     meshData.mesh = mesh;
     meshData.materialId = mesh.materialIndex;
+    meshData.mesh.calculateBounds();  // Culling bounds (callers may build meshes by hand)
 
-    // Upload mesh to GPU
-    uploadMesh(meshData);
+    // Suballocate and upload geometry into the mega-buffers
+    if (!uploadMesh(meshId, meshData)) {
+        return 0;
+    }
 
     m_meshes[meshId] = std::move(meshData);
 
@@ -155,40 +160,124 @@ void MeshRenderer::removeMesh(uint32_t meshId) {
     // Remove all instances
     for (uint32_t instanceId : meshData.instances) {
         m_instances.erase(instanceId);
-        m_instanceCount--;
     }
 
-    // Destroy GPU resources
-    if (meshData.mesh.hasGPUBuffers()) {
-        m_renderer->destroyMeshBuffers(meshData.mesh.vertexBuffer, meshData.mesh.indexBuffer,
-                                      meshData.mesh.vertexMemory, meshData.mesh.indexMemory);
-    }
-    if (meshData.instanceBuffer != VK_NULL_HANDLE) {
-        m_renderer->destroyMeshBuffers(meshData.instanceBuffer, VK_NULL_HANDLE,
-                                      meshData.instanceMemory, VK_NULL_HANDLE);
-    }
+    // Free the mega-buffer ranges and instance slots
+    m_batch.removeMesh(meshId);
 
     m_meshes.erase(it);
     Logger::info() << "Removed mesh " << meshId;
 }
 
-void MeshRenderer::uploadMesh(MeshData& meshData) {
-    if (meshData.mesh.vertices.empty() || meshData.mesh.indices.empty()) {
+bool MeshRenderer::uploadMesh(uint32_t meshId, MeshData& meshData) {
+    const Mesh& mesh = meshData.mesh;
+    if (mesh.vertices.empty() || mesh.indices.empty()) {
         Logger::error() << "Cannot upload empty mesh";
+        return false;
+    }
+
+    const uint32_t vertexCount = static_cast<uint32_t>(mesh.vertices.size());
+    const uint32_t indexCount = static_cast<uint32_t>(mesh.indices.size());
+
+    const MeshBatch::MeshRange* range = m_batch.addMesh(meshId, vertexCount, indexCount,
+                                                        mesh.boundsMin, mesh.boundsMax);
+    if (range == nullptr) {
+        // Out of space: double whichever mega-buffer is short, then retry once
+        const RangeAllocator& vertices = m_batch.vertexAllocator();
+        const RangeAllocator& indices = m_batch.indexAllocator();
+        bool grown = growMegaBuffer(false, std::max(vertices.capacity() * 2, vertices.used() + vertexCount));
+        grown = growMegaBuffer(true, std::max(indices.capacity() * 2, indices.used() + indexCount)) && grown;
+        if (grown) {
+            range = m_batch.addMesh(meshId, vertexCount, indexCount, mesh.boundsMin, mesh.boundsMax);
+        }
+    }
+
+    if (range == nullptr) {
+        Logger::error() << "Cannot upload mesh " << mesh.name << ": mesh mega-buffer full";
+        return false;
+    }
+
+    writeMeshGeometry(mesh, *range);
+    return true;
+}
+
+void MeshRenderer::writeMeshGeometry(const Mesh& mesh, const MeshBatch::MeshRange& range) {
+    uploadToBuffer(m_megaVertexBuffer, static_cast<VkDeviceSize>(range.firstVertex) * sizeof(MeshVertex),
+                   mesh.vertices.data(), mesh.vertices.size() * sizeof(MeshVertex));
+    uploadToBuffer(m_megaIndexBuffer, static_cast<VkDeviceSize>(range.firstIndex) * sizeof(uint32_t),
+                   mesh.indices.data(), mesh.indices.size() * sizeof(uint32_t));
+}
+
+void MeshRenderer::uploadToBuffer(VkBuffer dst, VkDeviceSize dstOffset, const void* data, VkDeviceSize size) {
+    if (dst == VK_NULL_HANDLE || size == 0) {
         return;
     }
 
-    m_renderer->uploadMeshBuffers(
-        meshData.mesh.vertices.data(),
-        static_cast<uint32_t>(meshData.mesh.vertices.size()),
-        sizeof(MeshVertex),
-        meshData.mesh.indices.data(),
-        static_cast<uint32_t>(meshData.mesh.indices.size()),
-        meshData.mesh.vertexBuffer,
-        meshData.mesh.indexBuffer,
-        meshData.mesh.vertexMemory,
-        meshData.mesh.indexMemory
-    );
+    VkDevice device = m_renderer->getDevice();
+
+    VkBuffer stagingBuffer;
+    VkDeviceMemory stagingMemory;
+    m_renderer->createBuffer(size, VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+                             VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+                             stagingBuffer, stagingMemory);
+
+    void* mapped;
+    vkMapMemory(device, stagingMemory, 0, size, 0, &mapped);
+    memcpy(mapped, data, static_cast<size_t>(size));
+    vkUnmapMemory(device, stagingMemory);
+
+    VkCommandBuffer commandBuffer = m_renderer->beginSingleTimeCommands();
+    VkBufferCopy copyRegion{};
+    copyRegion.srcOffset = 0;
+    copyRegion.dstOffset = dstOffset;
+    copyRegion.size = size;
+    vkCmdCopyBuffer(commandBuffer, stagingBuffer, dst, 1, &copyRegion);
+    m_renderer->endSingleTimeCommands(commandBuffer);
+
+    vkDestroyBuffer(device, stagingBuffer, nullptr);
+    vkFreeMemory(device, stagingMemory, nullptr);
+}
+
+bool MeshRenderer::growMegaBuffer(bool indices, uint32_t minCapacity) {
+    RangeAllocator& allocator = indices ? m_batch.indexAllocator() : m_batch.vertexAllocator();
+    if (minCapacity <= allocator.capacity()) {
+        return true;
+    }
+
+    VkBuffer& buffer = indices ? m_megaIndexBuffer : m_megaVertexBuffer;
+    VkDeviceMemory& memory = indices ? m_megaIndexMemory : m_megaVertexMemory;
+    const VkDeviceSize elementSize = indices ? sizeof(uint32_t) : sizeof(MeshVertex);
+    const VkBufferUsageFlags usage = (indices ? VK_BUFFER_USAGE_INDEX_BUFFER_BIT : VK_BUFFER_USAGE_VERTEX_BUFFER_BIT) |
+                                     VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+
+    VkBuffer newBuffer = VK_NULL_HANDLE;
+    VkDeviceMemory newMemory = VK_NULL_HANDLE;
+    try {
+        m_renderer->createBuffer(minCapacity * elementSize, usage, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
+                                 newBuffer, newMemory);
+    } catch (const std::exception& e) {
+        Logger::error() << "Failed to grow mesh " << (indices ? "index" : "vertex") << " mega-buffer: " << e.what();
+        return false;
+    }
+
+    // Keep existing meshes where they are
+    if (buffer != VK_NULL_HANDLE && allocator.capacity() > 0) {
+        VkCommandBuffer commandBuffer = m_renderer->beginSingleTimeCommands();
+        VkBufferCopy copyRegion{};
+        copyRegion.size = allocator.capacity() * elementSize;
+        vkCmdCopyBuffer(commandBuffer, buffer, newBuffer, 1, &copyRegion);
+        m_renderer->endSingleTimeCommands(commandBuffer);
+    }
+
+    // Frames in flight may still read the old buffer
+    queueBufferDeletion(buffer, memory);
+    buffer = newBuffer;
+    memory = newMemory;
+    allocator.grow(minCapacity);
+
+    Logger::info() << "Mesh " << (indices ? "index" : "vertex") << " mega-buffer grown to "
+                  << minCapacity << " elements";
+    return true;
 }
 
 // ========== Material Management ==========
@@ -223,6 +312,13 @@ void MeshRenderer::updateMaterial(uint32_t materialId, const PBRMaterial& materi
         MaterialUBO ubo(material);
         m_renderer->updateMaterialBuffer(matData.uniformMapped, &ubo);
     }
+
+    // Instances carry a copy of their material
+    for (const auto& [meshId, meshData] : m_meshes) {
+        if (meshData.materialId == materialId) {
+            refreshInstanceMaterials(meshId);
+        }
+    }
 }
 
 void MeshRenderer::setMeshMaterial(uint32_t meshId, uint32_t materialId) {
@@ -239,6 +335,7 @@ void MeshRenderer::setMeshMaterial(uint32_t meshId, uint32_t materialId) {
     }
 
     meshIt->second.materialId = materialId;
+    refreshInstanceMaterials(meshId);
 }
 
 void MeshRenderer::uploadMaterial(MaterialData& materialData) {
@@ -251,6 +348,37 @@ void MeshRenderer::uploadMaterial(MaterialData& materialData) {
     );
 }
 
+void MeshRenderer::applyMaterial(InstanceData& data, uint32_t materialId) const {
+    auto matIt = m_materials.find(materialId);
+    if (matIt == m_materials.end()) {
+        matIt = m_materials.find(m_defaultMaterialId);
+    }
+
+    if (matIt != m_materials.end()) {
+        const PBRMaterial& mat = matIt->second.material;
+        data.albedoTexIndex = mat.albedoTexture;
+        data.normalTexIndex = mat.normalTexture;
+        data.metallic = mat.metallic;
+        data.roughness = mat.roughness;
+    } else {
+        // Default material values (no textures)
+        data.albedoTexIndex = -1;
+        data.normalTexIndex = -1;
+        data.metallic = 0.0f;
+        data.roughness = 0.5f;
+    }
+}
+
+void MeshRenderer::refreshInstanceMaterials(uint32_t meshId) {
+    auto meshIt = m_meshes.find(meshId);
+    if (meshIt == m_meshes.end()) {
+        return;
+    }
+    for (uint32_t slot : m_batch.meshSlots(meshId)) {
+        applyMaterial(m_batch.edit(slot), meshIt->second.materialId);
+    }
+}
+
 // ========== Instance Management ==========
 
 uint32_t MeshRenderer::createInstance(uint32_t meshId, const glm::mat4& transform,
@@ -261,17 +389,25 @@ uint32_t MeshRenderer::createInstance(uint32_t meshId, const glm::mat4& transfor
         return 0;
     }
 
+    InstanceData data;
+    data.transform = transform;
+    data.tintColor = tintColor;
+    applyMaterial(data, meshIt->second.materialId);
+
+    const uint32_t slot = m_batch.addInstance(meshId, data);
+    if (slot == MeshBatch::INVALID_SLOT) {
+        Logger::error() << "Cannot create instance: instance table full (" << MAX_INSTANCES << ")";
+        return 0;
+    }
+
     uint32_t instanceId = m_nextInstanceId++;
 
     InstanceInfo info;
     info.meshId = meshId;
-    info.data.transform = transform;
-    info.data.tintColor = tintColor;
+    info.slot = slot;
 
     m_instances[instanceId] = info;
-    meshIt->second.instances.push_back(instanceId);
-    meshIt->second.instanceBufferDirty = true;
-    m_instanceCount++;
+    meshIt->second.instances.insert(instanceId);
 
     return instanceId;
 }
@@ -283,13 +419,8 @@ void MeshRenderer::updateInstanceTransform(uint32_t instanceId, const glm::mat4&
         return;
     }
 
-    it->second.data.transform = transform;
-
-    // Mark instance buffer as dirty
-    auto meshIt = m_meshes.find(it->second.meshId);
-    if (meshIt != m_meshes.end()) {
-        meshIt->second.instanceBufferDirty = true;
-    }
+    // Marks only this slot dirty
+    m_batch.edit(it->second.slot).transform = transform;
 }
 
 void MeshRenderer::updateInstanceColor(uint32_t instanceId, const glm::vec4& tintColor) {
@@ -299,13 +430,8 @@ void MeshRenderer::updateInstanceColor(uint32_t instanceId, const glm::vec4& tin
         return;
     }
 
-    it->second.data.tintColor = tintColor;
-
-    // Mark instance buffer as dirty
-    auto meshIt = m_meshes.find(it->second.meshId);
-    if (meshIt != m_meshes.end()) {
-        meshIt->second.instanceBufferDirty = true;
-    }
+    // Marks only this slot dirty
+    m_batch.edit(it->second.slot).tintColor = tintColor;
 }
 
 void MeshRenderer::removeInstance(uint32_t instanceId) {
@@ -315,16 +441,14 @@ void MeshRenderer::removeInstance(uint32_t instanceId) {
         return;
     }
 
-    uint32_t meshId = it->second.meshId;
+    const InstanceInfo info = it->second;
     m_instances.erase(it);
-    m_instanceCount--;
+    m_batch.removeInstance(info.slot);
 
     // Remove from mesh's instance list
-    auto meshIt = m_meshes.find(meshId);
+    auto meshIt = m_meshes.find(info.meshId);
     if (meshIt != m_meshes.end()) {
-        auto& instances = meshIt->second.instances;
-        instances.erase(std::remove(instances.begin(), instances.end(), instanceId), instances.end());
-        meshIt->second.instanceBufferDirty = true;
+        meshIt->second.instances.erase(instanceId);
     }
 }
 
@@ -335,15 +459,8 @@ void MeshRenderer::setInstanceVisible(uint32_t instanceId, bool visible) {
         return;
     }
 
-    if (it->second.visible != visible) {
-        it->second.visible = visible;
-
-        // Mark instance buffer as dirty
-        auto meshIt = m_meshes.find(it->second.meshId);
-        if (meshIt != m_meshes.end()) {
-            meshIt->second.instanceBufferDirty = true;
-        }
-    }
+    // Culling-side flag only: nothing to upload
+    m_batch.setVisible(it->second.slot, visible);
 }
 
 bool MeshRenderer::isInstanceVisible(uint32_t instanceId) const {
@@ -351,74 +468,17 @@ bool MeshRenderer::isInstanceVisible(uint32_t instanceId) const {
     if (it == m_instances.end()) {
         return false;
     }
-    return it->second.visible;
-}
-
-void MeshRenderer::updateInstanceBuffer(MeshData& meshData) {
-    if (meshData.instances.empty()) {
-        return;
-    }
-
-    // Collect instance data (only visible instances)
-    std::vector<InstanceData> instanceDataArray;
-    instanceDataArray.reserve(meshData.instances.size());
-
-    for (uint32_t instanceId : meshData.instances) {
-        auto it = m_instances.find(instanceId);
-        if (it != m_instances.end() && it->second.visible) {
-            instanceDataArray.push_back(it->second.data);
-        }
-    }
-
-    if (instanceDataArray.empty()) {
-        // No visible instances - queue buffer for deferred deletion
-        if (meshData.instanceBuffer != VK_NULL_HANDLE) {
-            queueBufferDeletion(meshData.instanceBuffer, meshData.instanceMemory);
-            meshData.instanceBuffer = VK_NULL_HANDLE;
-            meshData.instanceMemory = VK_NULL_HANDLE;
-        }
-        meshData.visibleInstanceCount = 0;
-        meshData.instanceBufferDirty = false;
-        return;
-    }
-
-    // Store visible count for rendering
-    meshData.visibleInstanceCount = static_cast<uint32_t>(instanceDataArray.size());
-
-    // Queue old buffer for deferred deletion (will be deleted after FRAMES_TO_KEEP frames)
-    if (meshData.instanceBuffer != VK_NULL_HANDLE) {
-        queueBufferDeletion(meshData.instanceBuffer, meshData.instanceMemory);
-        meshData.instanceBuffer = VK_NULL_HANDLE;
-        meshData.instanceMemory = VK_NULL_HANDLE;
-    }
-
-    // Create new instance buffer
-    VkBuffer dummyIndexBuffer = VK_NULL_HANDLE;
-    VkDeviceMemory dummyIndexMemory = VK_NULL_HANDLE;
-
-    m_renderer->uploadMeshBuffers(
-        instanceDataArray.data(),
-        static_cast<uint32_t>(instanceDataArray.size()),
-        sizeof(InstanceData),
-        nullptr,  // No indices for instance buffer
-        0,
-        meshData.instanceBuffer,
-        dummyIndexBuffer,  // Will be VK_NULL_HANDLE
-        meshData.instanceMemory,
-        dummyIndexMemory   // Will be VK_NULL_HANDLE
-    );
-
-    meshData.instanceBufferDirty = false;
+    return m_batch.isVisible(it->second.slot);
 }
 
 // ========== Rendering ==========
 
-void MeshRenderer::render(VkCommandBuffer cmd) {
+void MeshRenderer::render(VkCommandBuffer cmd, const glm::mat4& viewProj) {
     // Increment frame counter and process pending deletions
     m_frameNumber++;
     processPendingDeletions();
 
-    if (m_meshes.empty()) {
+    if (m_meshes.empty() || m_frames.empty()) {
         return;
     }
 
@@ -428,78 +488,61 @@ void MeshRenderer::render(VkCommandBuffer cmd) {
         return; // Mesh pipeline not initialized
     }
 
-    // Bind mesh pipeline and its descriptor sets (including textures and bones)
-    m_renderer->bindPipelineCached(cmd, meshPipeline);
-    m_renderer->bindMeshDescriptorSets(cmd, m_textureDescriptorSet, m_boneDescriptorSet);
-
-    // Render each mesh with its instances
-    for (auto& [meshId, meshData] : m_meshes) {
-        if (meshData.instances.empty() || !meshData.mesh.hasGPUBuffers()) {
-            continue;
-        }
-
-        // Update instance buffer if needed
-        if (meshData.instanceBufferDirty) {
-            updateInstanceBuffer(meshData);
-        }
+    const uint32_t frameIndex = m_renderer->getCurrentFrame() % static_cast<uint32_t>(m_frames.size());
+    FrameResources& frame = m_frames[frameIndex];
+    if (frame.descriptorSet == VK_NULL_HANDLE) {
+        return; // Instance table not bound (descriptor setup failed)
+    }
 
-        // Skip if no visible instances or no buffer
-        if (meshData.instanceBuffer == VK_NULL_HANDLE || meshData.visibleInstanceCount == 0) {
-            continue;
-        }
+    // Bring this frame's instance table up to date: only slots written since it was last used
+    const InstanceData* table = m_batch.table();
+    InstanceData* gpuTable = static_cast<InstanceData*>(frame.instanceTableMapped);
+    for (const MeshBatch::SlotRange& range : m_batch.takeUploads(frameIndex)) {
+        memcpy(gpuTable + range.first, table + range.first, range.count * sizeof(InstanceData));
+    }
 
-        // Safety checks: ensure buffers are valid
-        if (meshData.mesh.vertexBuffer == VK_NULL_HANDLE ||
-            meshData.mesh.indexBuffer == VK_NULL_HANDLE) {
-            continue;
-        }
+    // CPU frustum culling per instance, one indirect command per mesh
+    m_drawStats = m_batch.buildDraws(extractFrustum(viewProj), m_drawCommands, m_visibleSlots);
+    if (m_drawCommands.empty()) {
+        return;
+    }
 
-        // Get material and push constants
-        auto matIt = m_materials.find(meshData.materialId);
-        if (matIt == m_materials.end()) {
-            matIt = m_materials.find(m_defaultMaterialId);
-        }
+    memcpy(frame.visibleSlotsMapped, m_visibleSlots.data(), m_visibleSlots.size() * sizeof(uint32_t));
+    memcpy(frame.indirectMapped, m_drawCommands.data(),
+           m_drawCommands.size() * sizeof(VkDrawIndexedIndirectCommand));
 
-        // Push material constants to shader
-        if (matIt != m_materials.end()) {
-            const auto& mat = matIt->second.material;
-            m_renderer->pushMeshMaterialConstants(cmd,
-                mat.albedoTexture,
-                mat.normalTexture,
-                mat.metallic,
-                mat.roughness);
-        } else {
-            // Default material values (no textures)
-            m_renderer->pushMeshMaterialConstants(cmd, -1, -1, 0.0f, 0.5f);
+    // Bind mesh pipeline and its descriptor sets (textures, bones + instance table)
+    m_renderer->bindPipelineCached(cmd, meshPipeline);
+    m_renderer->bindMeshDescriptorSets(cmd, m_textureDescriptorSet, frame.descriptorSet);
+
+    // Binding 0: shared vertices, binding 1: visible instance slots
+    VkBuffer vertexBuffers[] = {m_megaVertexBuffer, frame.visibleSlots};
+    VkDeviceSize offsets[] = {0, 0};
+    vkCmdBindVertexBuffers(cmd, 0, 2, vertexBuffers, offsets);
+    vkCmdBindIndexBuffer(cmd, m_megaIndexBuffer, 0, VK_INDEX_TYPE_UINT32);
+
+    const uint32_t drawCount = static_cast<uint32_t>(m_drawCommands.size());
+    if (m_renderer->supportsMultiDrawIndirect() && m_renderer->supportsIndirectFirstInstance()) {
+        // SINGLE DRAW CALL for every mesh instance
+        vkCmdDrawIndexedIndirect(cmd, frame.indirect, 0, drawCount, sizeof(VkDrawIndexedIndirectCommand));
+    } else {
+        // Fallback without the optional features: same commands, one direct draw each
+        for (const VkDrawIndexedIndirectCommand& draw : m_drawCommands) {
+            vkCmdDrawIndexed(cmd, draw.indexCount, draw.instanceCount, draw.firstIndex,
+                             draw.vertexOffset, draw.firstInstance);
         }
-
-        // Bind vertex buffer (binding 0)
-        VkDeviceSize vertexOffset = 0;
-        vkCmdBindVertexBuffers(cmd, 0, 1, &meshData.mesh.vertexBuffer, &vertexOffset);
-
-        // Bind instance buffer (binding 1)
-        VkDeviceSize instanceOffset = 0;
-        vkCmdBindVertexBuffers(cmd, 1, 1, &meshData.instanceBuffer, &instanceOffset);
-
-        // Bind index buffer
-        vkCmdBindIndexBuffer(cmd, meshData.mesh.indexBuffer, 0, VK_INDEX_TYPE_UINT32);
-
-        // Draw instanced (only visible instances)
-        uint32_t instanceCount = meshData.visibleInstanceCount;
-        uint32_t indexCount = static_cast<uint32_t>(meshData.mesh.indices.size());
-        vkCmdDrawIndexed(cmd, indexCount, instanceCount, 0, 0, 0);
     }
 }
 
 size_t MeshRenderer::getGPUMemoryUsage() const {
     size_t total = 0;
 
-    for (const auto& [id, meshData] : m_meshes) {
-        total += meshData.mesh.getGPUMemoryUsage();
-        if (meshData.instanceBuffer != VK_NULL_HANDLE) {
-            total += meshData.instances.size() * sizeof(InstanceData);
-        }
-    }
+    // Mega-buffers (allocated capacity) and per-frame instance tables / draw lists
+    total += static_cast<size_t>(m_batch.vertexAllocator().capacity()) * sizeof(MeshVertex);
+    total += static_cast<size_t>(m_batch.indexAllocator().capacity()) * sizeof(uint32_t);
+    total += m_frames.size() * MAX_INSTANCES *
+             (sizeof(InstanceData) + sizeof(uint32_t) + sizeof(VkDrawIndexedIndirectCommand));
+    total += sizeof(BonePaletteHeader) + sizeof(glm::mat4) * MAX_BONE_PALETTE;
 
     for (const auto& [id, matData] : m_materials) {
         total += sizeof(MaterialUBO);
@@ -794,17 +837,14 @@ bool MeshRenderer::applySkinningFromRig(uint32_t meshId, const std::string& rigP
             }
         }
 
-        // Re-upload mesh to GPU with new bone weights
-        if (meshData.mesh.hasGPUBuffers()) {
-            // Destroy old buffers
-            m_renderer->destroyMeshBuffers(meshData.mesh.vertexBuffer, meshData.mesh.indexBuffer,
-                                          meshData.mesh.vertexMemory, meshData.mesh.indexMemory);
-            meshData.mesh.vertexBuffer = VK_NULL_HANDLE;
-            meshData.mesh.indexBuffer = VK_NULL_HANDLE;
-            meshData.mesh.vertexMemory = VK_NULL_HANDLE;
-            meshData.mesh.indexMemory = VK_NULL_HANDLE;
+        // Rewrite the mesh's mega-buffer range in place with the new bone weights
+        if (const MeshBatch::MeshRange* range = m_batch.mesh(meshId)) {
+            writeMeshGeometry(meshData.mesh, *range);
+
+            // Culling uses the bind pose; pad it so posed limbs aren't culled
+            const glm::vec3 pad(modelSize * 0.5f);
+            m_batch.setMeshBounds(meshId, meshData.mesh.boundsMin - pad, meshData.mesh.boundsMax + pad);
         }
-        uploadMesh(meshData);
 
         Logger::info() << "Applied automatic skinning to mesh " << meshId
                       << " (" << meshData.mesh.vertices.size() << " vertices)";
@@ -983,17 +1023,17 @@ void MeshRenderer::initializeBoneBuffer() {
 
     VkDevice device = m_renderer->getDevice();
 
-    // Create bone uniform buffer
-    VkDeviceSize bufferSize = sizeof(BoneUBO);
+    // Create bone palette storage buffer (header + every character's matrices)
+    VkDeviceSize bufferSize = sizeof(BonePaletteHeader) + sizeof(glm::mat4) * MAX_BONE_PALETTE;
 
     VkBufferCreateInfo bufferInfo{};
     bufferInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
     bufferInfo.size = bufferSize;
-    bufferInfo.usage = VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT;
+    bufferInfo.usage = VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
     bufferInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
 
     if (vkCreateBuffer(device, &bufferInfo, nullptr, &m_boneBuffer) != VK_SUCCESS) {
-        Logger::error() << "Failed to create bone uniform buffer";
+        Logger::error() << "Failed to create bone palette buffer";
         return;
     }
 
@@ -1020,70 +1060,18 @@ void MeshRenderer::initializeBoneBuffer() {
     vkMapMemory(device, m_boneMemory, 0, bufferSize, 0, &m_boneMapped);
 
     // Initialize to identity matrices (no skinning)
-    BoneUBO initialData;
-    initialData.numBones = 0;
-    for (int i = 0; i < MAX_BONES; ++i) {
-        initialData.boneMatrices[i] = glm::mat4(1.0f);
-    }
-    memcpy(m_boneMapped, &initialData, sizeof(BoneUBO));
+    BonePaletteHeader header;
+    memcpy(m_boneMapped, &header, sizeof(BonePaletteHeader));
+    glm::mat4* palette = getBonePalette();
+    std::fill(palette, palette + MAX_BONE_PALETTE, glm::mat4(1.0f));
 
-    // Create descriptor pool for bone descriptor set
-    VkDescriptorPoolSize poolSize{};
-    poolSize.type = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
-    poolSize.descriptorCount = 1;
-
-    VkDescriptorPoolCreateInfo poolInfo{};
-    poolInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
-    poolInfo.poolSizeCount = 1;
-    poolInfo.pPoolSizes = &poolSize;
-    poolInfo.maxSets = 1;
-
-    if (vkCreateDescriptorPool(device, &poolInfo, nullptr, &m_boneDescriptorPool) != VK_SUCCESS) {
-        Logger::error() << "Failed to create bone descriptor pool";
-        cleanupBoneBuffer();
-        return;
-    }
-
-    // Get the bone descriptor set layout from renderer
-    VkDescriptorSetLayout boneLayout = m_renderer->getMeshBoneDescriptorSetLayout();
-    if (boneLayout == VK_NULL_HANDLE) {
-        Logger::error() << "Bone descriptor set layout not available";
-        cleanupBoneBuffer();
-        return;
-    }
-
-    // Allocate descriptor set
-    VkDescriptorSetAllocateInfo descAllocInfo{};
-    descAllocInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
-    descAllocInfo.descriptorPool = m_boneDescriptorPool;
-    descAllocInfo.descriptorSetCount = 1;
-    descAllocInfo.pSetLayouts = &boneLayout;
-
-    if (vkAllocateDescriptorSets(device, &descAllocInfo, &m_boneDescriptorSet) != VK_SUCCESS) {
-        Logger::error() << "Failed to allocate bone descriptor set";
-        cleanupBoneBuffer();
-        return;
-    }
-
-    // Update descriptor set with bone buffer
-    VkDescriptorBufferInfo boneBufferInfo{};
-    boneBufferInfo.buffer = m_boneBuffer;
-    boneBufferInfo.offset = 0;
-    boneBufferInfo.range = sizeof(BoneUBO);
-
-    VkWriteDescriptorSet descriptorWrite{};
-    descriptorWrite.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
-    descriptorWrite.dstSet = m_boneDescriptorSet;
-    descriptorWrite.dstBinding = 0;
-    descriptorWrite.dstArrayElement = 0;
-    descriptorWrite.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
-    descriptorWrite.descriptorCount = 1;
-    descriptorWrite.pBufferInfo = &boneBufferInfo;
-
-    vkUpdateDescriptorSets(device, 1, &descriptorWrite, 0, nullptr);
+    // The shared palette (updateBoneMatrices) owns the first MAX_BONES matrices
+    m_bonePaletteRanges = RangeAllocator(MAX_BONE_PALETTE);
+    m_bonePaletteRanges.allocate(MAX_BONES);
 
     m_boneBufferInitialized = true;
-    Logger::info() << "Bone buffer initialized (max " << MAX_BONES << " bones)";
+    Logger::info() << "Bone palette initialized (" << MAX_BONE_PALETTE << " matrices, max "
+                  << MAX_BONES << " bones per skeleton)";
 }
 
 void MeshRenderer::cleanupBoneBuffer() {
@@ -1104,15 +1092,139 @@ void MeshRenderer::cleanupBoneBuffer() {
         m_boneMemory = VK_NULL_HANDLE;
     }
 
-    // Destroy descriptor pool (also frees descriptor set)
-    if (m_boneDescriptorPool != VK_NULL_HANDLE) {
-        vkDestroyDescriptorPool(device, m_boneDescriptorPool, nullptr);
-        m_boneDescriptorPool = VK_NULL_HANDLE;
-    }
-    m_boneDescriptorSet = VK_NULL_HANDLE;
     m_boneBufferInitialized = false;
 }
 
+// ========== Batch Resources ==========
+
+void MeshRenderer::initializeBatchResources() {
+    VkDevice device = m_renderer->getDevice();
+
+    // Mega-buffers: every mesh's vertices and indices (TRANSFER_SRC so growth can copy them)
+    const VkBufferUsageFlags transfer = VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+    m_renderer->createBuffer(static_cast<VkDeviceSize>(m_batch.vertexAllocator().capacity()) * sizeof(MeshVertex),
+                             VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | transfer, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
+                             m_megaVertexBuffer, m_megaVertexMemory);
+    m_renderer->createBuffer(static_cast<VkDeviceSize>(m_batch.indexAllocator().capacity()) * sizeof(uint32_t),
+                             VK_BUFFER_USAGE_INDEX_BUFFER_BIT | transfer, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
+                             m_megaIndexBuffer, m_megaIndexMemory);
+
+    // Per frame in flight: instance table, visible slot list and indirect commands.
+    // Host-visible and persistently mapped; each frame only receives its dirty ranges.
+    const VkMemoryPropertyFlags hostVisible = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+    const VkDeviceSize tableSize = static_cast<VkDeviceSize>(MAX_INSTANCES) * sizeof(InstanceData);
+    const VkDeviceSize slotsSize = static_cast<VkDeviceSize>(MAX_INSTANCES) * sizeof(uint32_t);
+    const VkDeviceSize indirectSize = static_cast<VkDeviceSize>(MAX_INSTANCES) * sizeof(VkDrawIndexedIndirectCommand);
+
+    const uint32_t frameCount = m_renderer->getFramesInFlight();
+    m_frames.resize(frameCount);
+    for (FrameResources& frame : m_frames) {
+        m_renderer->createBuffer(tableSize, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, hostVisible,
+                                 frame.instanceTable, frame.instanceTableMemory);
+        m_renderer->createBuffer(slotsSize, VK_BUFFER_USAGE_VERTEX_BUFFER_BIT, hostVisible,
+                                 frame.visibleSlots, frame.visibleSlotsMemory);
+        m_renderer->createBuffer(indirectSize, VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT, hostVisible,
+                                 frame.indirect, frame.indirectMemory);
+
+        vkMapMemory(device, frame.instanceTableMemory, 0, tableSize, 0, &frame.instanceTableMapped);
+        vkMapMemory(device, frame.visibleSlotsMemory, 0, slotsSize, 0, &frame.visibleSlotsMapped);
+        vkMapMemory(device, frame.indirectMemory, 0, indirectSize, 0, &frame.indirectMapped);
+    }
+
+    // Set 2 per frame: shared bone palette (binding 0) + that frame's instance table (binding 1)
+    VkDescriptorSetLayout setLayout = m_renderer->getMeshBoneDescriptorSetLayout();
+    if (setLayout == VK_NULL_HANDLE) {
+        Logger::error() << "Mesh bone/instance descriptor set layout not available";
+        return;
+    }
+
+    VkDescriptorPoolSize poolSize{};
+    poolSize.type = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+    poolSize.descriptorCount = frameCount * 2;  // Bone palette + instance table
+
+    VkDescriptorPoolCreateInfo poolInfo{};
+    poolInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+    poolInfo.poolSizeCount = 1;
+    poolInfo.pPoolSizes = &poolSize;
+    poolInfo.maxSets = frameCount;
+
+    if (vkCreateDescriptorPool(device, &poolInfo, nullptr, &m_instanceDescriptorPool) != VK_SUCCESS) {
+        Logger::error() << "Failed to create mesh instance descriptor pool";
+        return;
+    }
+
+    for (FrameResources& frame : m_frames) {
+        VkDescriptorSetAllocateInfo descAllocInfo{};
+        descAllocInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+        descAllocInfo.descriptorPool = m_instanceDescriptorPool;
+        descAllocInfo.descriptorSetCount = 1;
+        descAllocInfo.pSetLayouts = &setLayout;
+
+        if (vkAllocateDescriptorSets(device, &descAllocInfo, &frame.descriptorSet) != VK_SUCCESS) {
+            Logger::error() << "Failed to allocate mesh instance descriptor set";
+            return;
+        }
+
+        VkDescriptorBufferInfo boneBufferInfo{};
+        boneBufferInfo.buffer = m_boneBuffer;
+        boneBufferInfo.offset = 0;
+        boneBufferInfo.range = VK_WHOLE_SIZE;
+
+        VkDescriptorBufferInfo tableBufferInfo{};
+        tableBufferInfo.buffer = frame.instanceTable;
+        tableBufferInfo.offset = 0;
+        tableBufferInfo.range = tableSize;
+
+        std::array<VkWriteDescriptorSet, 2> writes{};
+        writes[0].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+        writes[0].dstSet = frame.descriptorSet;
+        writes[0].dstBinding = 0;
+        writes[0].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+        writes[0].descriptorCount = 1;
+        writes[0].pBufferInfo = &boneBufferInfo;
+
+        writes[1].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+        writes[1].dstSet = frame.descriptorSet;
+        writes[1].dstBinding = 1;
+        writes[1].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+        writes[1].descriptorCount = 1;
+        writes[1].pBufferInfo = &tableBufferInfo;
+
+        vkUpdateDescriptorSets(device, static_cast<uint32_t>(writes.size()), writes.data(), 0, nullptr);
+    }
+
+    Logger::info() << "Mesh batch initialized: " << m_batch.vertexAllocator().capacity() << " vertices, "
+                  << m_batch.indexAllocator().capacity() << " indices, " << MAX_INSTANCES
+                  << " instances x " << frameCount << " frames";
+}
+
+void MeshRenderer::cleanupBatchResources() {
+    VkDevice device = m_renderer->getDevice();
+
+    for (FrameResources& frame : m_frames) {
+        if (frame.instanceTableMapped != nullptr) vkUnmapMemory(device, frame.instanceTableMemory);
+        if (frame.visibleSlotsMapped != nullptr) vkUnmapMemory(device, frame.visibleSlotsMemory);
+        if (frame.indirectMapped != nullptr) vkUnmapMemory(device, frame.indirectMemory);
+
+        m_renderer->destroyMeshBuffers(frame.instanceTable, frame.visibleSlots,
+                                      frame.instanceTableMemory, frame.visibleSlotsMemory);
+        m_renderer->destroyMeshBuffers(frame.indirect, VK_NULL_HANDLE, frame.indirectMemory, VK_NULL_HANDLE);
+    }
+    m_frames.clear();
+
+    // Destroying the pool frees the per-frame descriptor sets
+    if (m_instanceDescriptorPool != VK_NULL_HANDLE) {
+        vkDestroyDescriptorPool(device, m_instanceDescriptorPool, nullptr);
+        m_instanceDescriptorPool = VK_NULL_HANDLE;
+    }
+
+    m_renderer->destroyMeshBuffers(m_megaVertexBuffer, m_megaIndexBuffer, m_megaVertexMemory, m_megaIndexMemory);
+    m_megaVertexBuffer = VK_NULL_HANDLE;
+    m_megaIndexBuffer = VK_NULL_HANDLE;
+    m_megaVertexMemory = VK_NULL_HANDLE;
+    m_megaIndexMemory = VK_NULL_HANDLE;
+}
+
 void MeshRenderer::updateBoneMatrices(const glm::mat4* matrices, int count) {
     if (!m_boneBufferInitialized) {
         initializeBoneBuffer();
@@ -1125,18 +1237,13 @@ void MeshRenderer::updateBoneMatrices(const glm::mat4* matrices, int count) {
     // Clamp count to max bones
     int actualCount = std::min(count, MAX_BONES);
 
-    // Update the mapped buffer
-    BoneUBO* boneData = static_cast<BoneUBO*>(m_boneMapped);
-    boneData->numBones = actualCount;
-
-    for (int i = 0; i < actualCount; ++i) {
-        boneData->boneMatrices[i] = matrices[i];
-    }
+    // Update the shared palette (first MAX_BONES matrices)
+    static_cast<BonePaletteHeader*>(m_boneMapped)->sharedBoneCount = actualCount;
+    glm::mat4* palette = getBonePalette();
+    std::copy(matrices, matrices + actualCount, palette);
 
     // Fill remaining slots with identity (shouldn't be accessed, but just in case)
-    for (int i = actualCount; i < MAX_BONES; ++i) {
-        boneData->boneMatrices[i] = glm::mat4(1.0f);
-    }
+    std::fill(palette + actualCount, palette + MAX_BONES, glm::mat4(1.0f));
 }
 
 void MeshRenderer::clearBoneMatrices() {
@@ -1144,7 +1251,41 @@ void MeshRenderer::clearBoneMatrices() {
         return;
     }
 
-    // Set numBones to 0 to disable skinning
-    BoneUBO* boneData = static_cast<BoneUBO*>(m_boneMapped);
-    boneData->numBones = 0;
+    // Set the shared bone count to 0 to disable skinning
+    static_cast<BonePaletteHeader*>(m_boneMapped)->sharedBoneCount = 0;
+}
+
+uint32_t MeshRenderer::allocateBonePalette(uint32_t boneCount) {
+    if (boneCount == 0 || boneCount > static_cast<uint32_t>(MAX_BONES) || m_boneMapped == nullptr) {
+        return RangeAllocator::INVALID_OFFSET;
+    }
+
+    const uint32_t base = m_bonePaletteRanges.allocate(boneCount);
+    if (base == RangeAllocator::INVALID_OFFSET) {
+        Logger::error() << "Bone palette full (" << MAX_BONE_PALETTE << " matrices)";
+    }
+    return base;
+}
+
+void MeshRenderer::freeBonePalette(uint32_t base, uint32_t boneCount) {
+    m_bonePaletteRanges.free(base, boneCount);
+}
+
+glm::mat4* MeshRenderer::getBonePalette() {
+    if (m_boneMapped == nullptr) {
+        return nullptr;
+    }
+    return reinterpret_cast<glm::mat4*>(static_cast<char*>(m_boneMapped) + sizeof(BonePaletteHeader));
+}
+
+void MeshRenderer::setInstanceBonePalette(uint32_t instanceId, uint32_t base, uint32_t boneCount) {
+    auto it = m_instances.find(instanceId);
+    if (it == m_instances.end()) {
+        Logger::warning() << "Instance " << instanceId << " not found";
+        return;
+    }
+
+    InstanceData& data = m_batch.edit(it->second.slot);
+    data.boneBase = static_cast<int32_t>(base);
+    data.boneCount = static_cast<int32_t>(boneCount);
 }
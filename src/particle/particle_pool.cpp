@@ -0,0 +1,446 @@
+/**
+ * @file particle_pool.cpp
+ * @brief SoA particle pool: curve baking, SIMD integration, compaction, instance output
+ *
+ * Created: 2025-11-28
+ */
+
+#include "particle/particle_pool.h"
+#include <algorithm>
+#include <cmath>
+
+// SSE is baseline on every x86-64 target; other architectures use the scalar loop
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define PARTICLE_POOL_SSE 1
+#include <emmintrin.h>
+#else
+#define PARTICLE_POOL_SSE 0
+#endif
+
+namespace {
+
+// Parallel blocks are multiples of a cache line of floats (no false sharing at the seams)
+constexpr size_t BLOCK_ALIGN = 16;
+
+glm::vec4 evaluateColor(const EmitterConfig& config, float normalizedAge) {
+    const auto& gradient = config.colorGradient;
+
+    glm::vec4 result;
+
+    // Use simple start/end interpolation if no gradient defined
+    if (gradient.empty()) {
+        result = glm::mix(config.colorStart, config.colorEnd, normalizedAge);
+    }
+    else if (gradient.size() == 1) {
+        result = gradient[0].color;
+    }
+    else {
+        // Find surrounding stops
+        size_t i = 0;
+        while (i < gradient.size() - 1 && gradient[i + 1].time <= normalizedAge) {
+            ++i;
+        }
+
+        if (i >= gradient.size() - 1) {
+            result = gradient.back().color;
+        } else {
+            const ColorStop& a = gradient[i];
+            const ColorStop& b = gradient[i + 1];
+
+            // Guard against division by zero if stops have same time
+            float timeDiff = b.time - a.time;
+            if (timeDiff < 0.0001f) {
+                result = a.color;
+            } else {
+                float t = glm::clamp((normalizedAge - a.time) / timeDiff, 0.0f, 1.0f);
+                result = glm::mix(a.color, b.color, t);
+            }
+        }
+    }
+
+    // Clamp color to valid 0-1 range to prevent crashes from extreme values
+    return glm::clamp(result, glm::vec4(0.0f), glm::vec4(1.0f));
+}
+
+float evaluateCurve(const std::vector<CurveKey>& curve, float t, float defaultValue) {
+    if (curve.empty()) {
+        return defaultValue;
+    }
+
+    if (curve.size() == 1) {
+        return curve[0].value;
+    }
+
+    // Find surrounding keys
+    size_t i = 0;
+    while (i < curve.size() - 1 && curve[i + 1].time <= t) {
+        ++i;
+    }
+
+    if (i >= curve.size() - 1) {
+        return curve.back().value;
+    }
+
+    const CurveKey& a = curve[i];
+    const CurveKey& b = curve[i + 1];
+
+    // Guard against division by zero if keys have same time
+    float timeDiff = b.time - a.time;
+    if (timeDiff < 0.0001f) {
+        return a.value;
+    }
+
+    return glm::mix(a.value, b.value, (t - a.time) / timeDiff);
+}
+
+glm::vec2 evaluateSize(const EmitterConfig& config, float normalizedAge) {
+    // Linear interpolation by default, shaped by the size curve if present
+    float t = evaluateCurve(config.sizeCurve, normalizedAge, normalizedAge);
+    return glm::mix(config.sizeStart, config.sizeEnd, t);
+}
+
+glm::vec4 unpackTint(uint32_t tint) {
+    return glm::vec4(static_cast<float>(tint & 0xFF),
+                     static_cast<float>((tint >> 8) & 0xFF),
+                     static_cast<float>((tint >> 16) & 0xFF),
+                     static_cast<float>(tint >> 24)) * (1.0f / 255.0f);
+}
+
+}  // namespace
+
+ParticlePool::ParticlePool(size_t capacity)
+    : m_capacity(capacity) {
+    for (auto* arr : {&m_posX, &m_posY, &m_posZ, &m_velX, &m_velY, &m_velZ,
+                      &m_accelX, &m_accelY, &m_drag, &m_life, &m_invMaxLife,
+                      &m_rotation, &m_sizeScale}) {
+        arr->resize(capacity);
+    }
+    m_tint.resize(capacity);
+    m_emitter.resize(capacity);
+}
+
+ParticlePool::~ParticlePool() {
+    stopWorkers();
+}
+
+// ========== Emitter Slots ==========
+
+uint16_t ParticlePool::registerEmitter(const EmitterConfig& config) {
+    uint16_t slot;
+    if (!m_freeSlots.empty()) {
+        slot = m_freeSlots.back();
+        m_freeSlots.pop_back();
+    } else {
+        if (m_emitters.size() >= INVALID_EMITTER) {
+            return INVALID_EMITTER;
+        }
+        slot = static_cast<uint16_t>(m_emitters.size());
+        m_emitters.emplace_back();
+    }
+
+    EmitterParams& params = m_emitters[slot];
+    params.active = true;
+    params.liveCount = 0;
+    bakeEmitter(params, config);
+    return slot;
+}
+
+void ParticlePool::updateEmitter(uint16_t slot, const EmitterConfig& config) {
+    if (slot >= m_emitters.size() || !m_emitters[slot].active) return;
+    bakeEmitter(m_emitters[slot], config);
+}
+
+void ParticlePool::releaseEmitter(uint16_t slot) {
+    if (slot >= m_emitters.size() || !m_emitters[slot].active) return;
+    clearEmitter(slot);
+    m_emitters[slot].active = false;
+    m_freeSlots.push_back(slot);
+}
+
+void ParticlePool::clearEmitter(uint16_t slot) {
+    if (slot >= m_emitters.size() || m_emitters[slot].liveCount == 0) return;
+    for (size_t i = 0; i < m_count; i++) {
+        if (m_emitter[i] == slot) {
+            m_life[i] = 0.0f;
+        }
+    }
+    compact();
+}
+
+size_t ParticlePool::liveCount(uint16_t slot) const {
+    return slot < m_emitters.size() ? m_emitters[slot].liveCount : 0;
+}
+
+void ParticlePool::bakeEmitter(EmitterParams& params, const EmitterConfig& config) {
+    // PERFORMANCE: Gradient stop / curve key searches happen here once, not per particle per frame
+    for (int i = 0; i < CURVE_LUT_SIZE; i++) {
+        float age = static_cast<float>(i) / static_cast<float>(CURVE_LUT_SIZE - 1);
+        params.colorLut[i] = evaluateColor(config, age);
+        params.sizeLut[i] = evaluateSize(config, age);
+    }
+    params.gravity = config.gravity;
+    params.drag = std::max(config.drag, 0.0f);
+    params.alignToVelocity = config.alignToVelocity;
+    params.frameIndex = config.texture.frameIndex;
+    params.frameCount = std::max(config.texture.frameCount, 1);
+    params.fps = config.texture.fps;
+}
+
+// ========== Particles ==========
+
+bool ParticlePool::spawn(uint16_t slot, const glm::vec3& position, const glm::vec3& velocity, float lifetime,
+                         float rotation, float sizeScale, uint32_t tint) {
+    if (m_count >= m_capacity || slot >= m_emitters.size() || !m_emitters[slot].active || !(lifetime > 0.0f)) {
+        return false;
+    }
+
+    EmitterParams& params = m_emitters[slot];
+    const size_t i = m_count++;
+    m_posX[i] = position.x;
+    m_posY[i] = position.y;
+    m_posZ[i] = position.z;
+    m_velX[i] = velocity.x;
+    m_velY[i] = velocity.y;
+    m_velZ[i] = velocity.z;
+    m_accelX[i] = params.gravity.x;
+    m_accelY[i] = params.gravity.y;
+    m_drag[i] = params.drag;
+    m_life[i] = lifetime;
+    m_invMaxLife[i] = 1.0f / lifetime;
+    m_rotation[i] = rotation;
+    m_sizeScale[i] = sizeScale;
+    m_tint[i] = tint;
+    m_emitter[i] = slot;
+    params.liveCount++;
+    return true;
+}
+
+void ParticlePool::update(float deltaTime) {
+    if (m_count == 0) return;
+
+    if (m_count >= PARALLEL_THRESHOLD && m_workers.empty()) {
+        startWorkers();
+    }
+
+    if (m_count >= PARALLEL_THRESHOLD && !m_workers.empty()) {
+        {
+            std::lock_guard<std::mutex> lock(m_workMutex);
+            m_workDeltaTime = deltaTime;
+            m_workersPending = static_cast<int>(m_workers.size());
+            m_workGeneration++;
+        }
+        m_workCv.notify_all();
+
+        // The calling thread takes block 0 instead of idling
+        size_t begin, end;
+        blockRange(0, begin, end);
+        integrate(begin, end, deltaTime);
+
+        std::unique_lock<std::mutex> lock(m_workMutex);
+        m_doneCv.wait(lock, [this] { return m_workersPending == 0; });
+    } else {
+        integrate(0, m_count, deltaTime);
+    }
+
+    compact();
+}
+
+void ParticlePool::integrate(size_t begin, size_t end, float deltaTime) {
+    float* posX = m_posX.data();
+    float* posY = m_posY.data();
+    float* posZ = m_posZ.data();
+    float* velX = m_velX.data();
+    float* velY = m_velY.data();
+    float* velZ = m_velZ.data();
+    const float* accelX = m_accelX.data();
+    const float* accelY = m_accelY.data();
+    const float* drag = m_drag.data();
+    float* life = m_life.data();
+
+    size_t i = begin;
+
+#if PARTICLE_POOL_SSE
+    const __m128 dt = _mm_set1_ps(deltaTime);
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 zero = _mm_setzero_ps();
+
+    for (; i + 4 <= end; i += 4) {
+        // Gravity (X/Y only - emitter gravity is 2D)
+        __m128 vx = _mm_add_ps(_mm_loadu_ps(velX + i), _mm_mul_ps(_mm_loadu_ps(accelX + i), dt));
+        __m128 vy = _mm_add_ps(_mm_loadu_ps(velY + i), _mm_mul_ps(_mm_loadu_ps(accelY + i), dt));
+        __m128 vz = _mm_loadu_ps(velZ + i);
+
+        // Drag (clamped so a long frame can't reverse the velocity)
+        __m128 damp = _mm_max_ps(zero, _mm_sub_ps(one, _mm_mul_ps(_mm_loadu_ps(drag + i), dt)));
+        vx = _mm_mul_ps(vx, damp);
+        vy = _mm_mul_ps(vy, damp);
+        vz = _mm_mul_ps(vz, damp);
+
+        _mm_storeu_ps(velX + i, vx);
+        _mm_storeu_ps(velY + i, vy);
+        _mm_storeu_ps(velZ + i, vz);
+
+        _mm_storeu_ps(posX + i, _mm_add_ps(_mm_loadu_ps(posX + i), _mm_mul_ps(vx, dt)));
+        _mm_storeu_ps(posY + i, _mm_add_ps(_mm_loadu_ps(posY + i), _mm_mul_ps(vy, dt)));
+        _mm_storeu_ps(posZ + i, _mm_add_ps(_mm_loadu_ps(posZ + i), _mm_mul_ps(vz, dt)));
+
+        _mm_storeu_ps(life + i, _mm_sub_ps(_mm_loadu_ps(life + i), dt));
+    }
+#endif
+
+    // Scalar tail (and the whole range without SSE)
+    for (; i < end; i++) {
+        velX[i] += accelX[i] * deltaTime;
+        velY[i] += accelY[i] * deltaTime;
+        float damp = std::max(0.0f, 1.0f - drag[i] * deltaTime);
+        velX[i] *= damp;
+        velY[i] *= damp;
+        velZ[i] *= damp;
+        posX[i] += velX[i] * deltaTime;
+        posY[i] += velY[i] * deltaTime;
+        posZ[i] += velZ[i] * deltaTime;
+        life[i] -= deltaTime;
+    }
+}
+
+void ParticlePool::compact() {
+    size_t i = 0;
+    while (i < m_count) {
+        if (m_life[i] > 0.0f) {
+            i++;
+            continue;
+        }
+        m_emitters[m_emitter[i]].liveCount--;
+        m_count--;
+        if (i != m_count) {
+            moveParticle(m_count, i);  // Re-check slot i: the moved particle may be dead too
+        }
+    }
+}
+
+void ParticlePool::moveParticle(size_t from, size_t to) {
+    m_posX[to] = m_posX[from];
+    m_posY[to] = m_posY[from];
+    m_posZ[to] = m_posZ[from];
+    m_velX[to] = m_velX[from];
+    m_velY[to] = m_velY[from];
+    m_velZ[to] = m_velZ[from];
+    m_accelX[to] = m_accelX[from];
+    m_accelY[to] = m_accelY[from];
+    m_drag[to] = m_drag[from];
+    m_life[to] = m_life[from];
+    m_invMaxLife[to] = m_invMaxLife[from];
+    m_rotation[to] = m_rotation[from];
+    m_sizeScale[to] = m_sizeScale[from];
+    m_tint[to] = m_tint[from];
+    m_emitter[to] = m_emitter[from];
+}
+
+void ParticlePool::clear() {
+    m_count = 0;
+    for (auto& params : m_emitters) {
+        params.liveCount = 0;
+    }
+}
+
+int ParticlePool::lutIndex(size_t index) const {
+    float age = std::clamp(1.0f - m_life[index] * m_invMaxLife[index], 0.0f, 1.0f);
+    return static_cast<int>(age * (CURVE_LUT_SIZE - 1) + 0.5f);
+}
+
+size_t ParticlePool::writeInstances(ParticleInstance* dst, size_t maxCount) const {
+    const size_t count = std::min(m_count, maxCount);
+    for (size_t i = 0; i < count; i++) {
+        const EmitterParams& params = m_emitters[m_emitter[i]];
+        const int lut = lutIndex(i);
+
+        float rotation = m_rotation[i];
+        if (params.alignToVelocity && (m_velX[i] * m_velX[i] + m_velY[i] * m_velY[i]) > 1e-6f) {
+            rotation = std::atan2(m_velY[i], m_velX[i]);
+        }
+
+        ParticleInstance& instance = dst[i];
+        instance.positionSize = glm::vec4(m_posX[i], m_posY[i], m_posZ[i], params.sizeLut[lut].x * m_sizeScale[i]);
+        instance.color = m_tint[i] == 0xFFFFFFFFu ? params.colorLut[lut] : params.colorLut[lut] * unpackTint(m_tint[i]);
+        instance.rotation = rotation;
+    }
+    return count;
+}
+
+ParticlePool::Sample ParticlePool::sample(size_t index) const {
+    const EmitterParams& params = m_emitters[m_emitter[index]];
+    const int lut = lutIndex(index);
+
+    Sample s;
+    s.position = glm::vec3(m_posX[index], m_posY[index], m_posZ[index]);
+    s.color = params.colorLut[lut] * unpackTint(m_tint[index]);
+    s.size = params.sizeLut[lut] * m_sizeScale[index];
+    s.rotation = m_rotation[index];
+    if (params.alignToVelocity && (m_velX[index] * m_velX[index] + m_velY[index] * m_velY[index]) > 1e-6f) {
+        s.rotation = std::atan2(m_velY[index], m_velX[index]);
+    }
+
+    // Animate texture frames
+    s.frameIndex = params.frameIndex;
+    if (params.fps > 0.0f && params.frameCount > 1) {
+        float age = 1.0f / m_invMaxLife[index] - m_life[index];
+        int frameOffset = static_cast<int>(age * params.fps);
+        s.frameIndex += frameOffset % params.frameCount;
+    }
+    return s;
+}
+
+// ========== Worker Threads ==========
+
+void ParticlePool::startWorkers() {
+    unsigned int hardwareThreads = std::thread::hardware_concurrency();
+    int workerCount = std::min(3, static_cast<int>(hardwareThreads) - 1);
+    for (int i = 0; i < workerCount; i++) {
+        m_workers.emplace_back(&ParticlePool::workerLoop, this, i);
+    }
+}
+
+void ParticlePool::stopWorkers() {
+    {
+        std::lock_guard<std::mutex> lock(m_workMutex);
+        m_shutdown = true;
+    }
+    m_workCv.notify_all();
+    for (auto& worker : m_workers) {
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+    m_workers.clear();
+}
+
+void ParticlePool::workerLoop(int workerIndex) {
+    uint64_t seenGeneration = 0;
+    while (true) {
+        float deltaTime;
+        {
+            std::unique_lock<std::mutex> lock(m_workMutex);
+            m_workCv.wait(lock, [&] { return m_shutdown || m_workGeneration != seenGeneration; });
+            if (m_shutdown) return;
+            seenGeneration = m_workGeneration;
+            deltaTime = m_workDeltaTime;
+        }
+
+        size_t begin, end;
+        blockRange(workerIndex + 1, begin, end);
+        integrate(begin, end, deltaTime);
+
+        std::lock_guard<std::mutex> lock(m_workMutex);
+        if (--m_workersPending == 0) {
+            m_doneCv.notify_one();
+        }
+    }
+}
+
+void ParticlePool::blockRange(int block, size_t& begin, size_t& end) const {
+    const size_t blocks = m_workers.size() + 1;
+    size_t blockSize = (m_count + blocks - 1) / blocks;
+    blockSize = (blockSize + BLOCK_ALIGN - 1) / BLOCK_ALIGN * BLOCK_ALIGN;
+    begin = std::min(m_count, static_cast<size_t>(block) * blockSize);
+    end = std::min(m_count, begin + blockSize);
+}
@@ -10,10 +10,6 @@
 #include <fstream>
 #include <algorithm>
 
-ParticleSystemRuntime::ParticleSystemRuntime() {
-    m_instanceData.reserve(MAX_PARTICLES);
-}
-
 ParticleSystemRuntime::~ParticleSystemRuntime() {
     // cleanup() should be called explicitly before destruction
 }
@@ -70,15 +66,17 @@ bool ParticleSystemRuntime::initialize(VulkanRenderer* renderer) {
     vkFreeMemory(renderer->getDevice(), stagingMemory, nullptr);
 
     // Create instance buffer (host visible for frequent updates)
-    VkDeviceSize instanceSize = sizeof(ParticleInstanceData) * MAX_PARTICLES;
+    VkDeviceSize instanceSize = sizeof(ParticleInstance) * m_pool.capacity();
     renderer->createBuffer(instanceSize,
         VK_BUFFER_USAGE_VERTEX_BUFFER_BIT,
         VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
         m_particleInstanceBuffer, m_particleInstanceMemory);
 
-    vkMapMemory(renderer->getDevice(), m_particleInstanceMemory, 0, instanceSize, 0, &m_instanceBufferMapped);
+    void* mapped = nullptr;
+    vkMapMemory(renderer->getDevice(), m_particleInstanceMemory, 0, instanceSize, 0, &mapped);
+    m_instanceBufferMapped = static_cast<ParticleInstance*>(mapped);
 
-    Logger::info() << "ParticleSystemRuntime initialized (max " << MAX_PARTICLES << " particles)";
+    Logger::info() << "ParticleSystemRuntime initialized (max " << m_pool.capacity() << " particles)";
     return true;
 }
 
@@ -220,7 +218,7 @@ uint32_t ParticleSystemRuntime::spawnEffect(const std::string& effectName, const
 
     // Create emitters for this instance
     for (const auto& config : effect.emitters) {
-        auto emitter = std::make_unique<ParticleEmitter>(config);
+        auto emitter = std::make_unique<ParticleEmitter>(config, &m_pool);
         emitter->setPosition(position);
         activeEffect->emitters.push_back(std::move(emitter));
     }
@@ -249,7 +247,7 @@ void ParticleSystemRuntime::spawnBurst(const std::string& effectName, const glm:
 
     // Create emitters and trigger burst
     for (const auto& config : effect.emitters) {
-        auto emitter = std::make_unique<ParticleEmitter>(config);
+        auto emitter = std::make_unique<ParticleEmitter>(config, &m_pool);
         emitter->setPosition(position);
         emitter->burst(count);
         activeEffect->emitters.push_back(std::move(emitter));
@@ -274,6 +272,9 @@ void ParticleSystemRuntime::update(float deltaTime) {
         }
     }
 
+    // DATA-ORIENTED (2025-11-28): One SIMD pass over every live particle of every effect
+    m_pool.update(deltaTime);
+
     // Remove finished effects
     m_activeEffects.erase(
         std::remove_if(m_activeEffects.begin(), m_activeEffects.end(),
@@ -297,35 +298,9 @@ void ParticleSystemRuntime::update(float deltaTime) {
 void ParticleSystemRuntime::render(VkCommandBuffer commandBuffer, const glm::mat4& viewProj, const glm::vec3& cameraPos) {
     if (!m_particleVertexBuffer || !m_particleInstanceBuffer) return;
 
-    // Collect all particles into instance data
-    m_instanceData.clear();
-
-    for (const auto& effect : m_activeEffects) {
-        for (const auto& emitter : effect->emitters) {
-            const auto& particles = emitter->getParticles();
-
-            for (const auto& p : particles) {
-                if (!p.isAlive()) continue;
-                if (m_instanceData.size() >= MAX_PARTICLES) break;
-
-                ParticleInstanceData instance;
-                instance.positionSize = glm::vec4(p.position, p.size.x);
-                instance.color = p.color;
-                instance.rotation = p.rotation;
-                m_instanceData.push_back(instance);
-            }
-
-            if (m_instanceData.size() >= MAX_PARTICLES) break;
-        }
-
-        if (m_instanceData.size() >= MAX_PARTICLES) break;
-    }
-
-    if (m_instanceData.empty()) return;
-
-    // Upload instance data to GPU
-    memcpy(m_instanceBufferMapped, m_instanceData.data(),
-           m_instanceData.size() * sizeof(ParticleInstanceData));
+    // Evaluate curves straight into the mapped instance buffer (no staging vector)
+    m_instanceCount = m_pool.writeInstances(m_instanceBufferMapped, m_pool.capacity());
+    if (m_instanceCount == 0) return;
 
     // Note: Actual rendering requires a particle shader and pipeline
     // For now, this sets up the data - the actual draw call would be:
@@ -333,7 +308,7 @@ void ParticleSystemRuntime::render(VkCommandBuffer commandBuffer, const glm::mat
     // VkBuffer buffers[] = {m_particleVertexBuffer, m_particleInstanceBuffer};
     // VkDeviceSize offsets[] = {0, 0};
     // vkCmdBindVertexBuffers(commandBuffer, 0, 2, buffers, offsets);
-    // vkCmdDraw(commandBuffer, 6, m_instanceData.size(), 0, 0);
+    // vkCmdDraw(commandBuffer, 6, m_instanceCount, 0, 0);
 }
 
 size_t ParticleSystemRuntime::getActiveParticleCount() const {
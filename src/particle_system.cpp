@@ -5,31 +5,24 @@
 #include <glm/gtc/constants.hpp>
 
 ParticleSystem::ParticleSystem() {
-    m_particles.reserve(1000);  // Reserve space for efficiency
+    // Splash physics: Earth gravity, no drag, full size, alpha fades 1 -> 0 over lifetime
+    EmitterConfig splash;
+    splash.name = "splash";
+    splash.gravity = glm::vec2(0.0f, -9.8f);
+    splash.drag = 0.0f;
+    splash.sizeStart = glm::vec2(1.0f);
+    splash.sizeEnd = glm::vec2(1.0f);
+    splash.colorStart = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
+    splash.colorEnd = glm::vec4(1.0f, 1.0f, 1.0f, 0.0f);
+    m_splashSlot = m_pool.registerEmitter(splash);
 }
 
 ParticleSystem::~ParticleSystem() {
 }
 
 void ParticleSystem::update(float deltaTime) {
-    // Update all particles
-    for (auto& particle : m_particles) {
-        // Apply gravity
-        particle.velocity.y += m_gravity * deltaTime;
-
-        // Update position
-        particle.position += particle.velocity * deltaTime;
-
-        // Decrease lifetime
-        particle.lifetime -= deltaTime;
-    }
-
-    // Remove dead particles
-    m_particles.erase(
-        std::remove_if(m_particles.begin(), m_particles.end(),
-            [](const Particle& p) { return !p.isAlive(); }),
-        m_particles.end()
-    );
+    // SIMD integration + swap-remove of dead particles for the whole pool
+    m_pool.update(deltaTime);
 }
 
 void ParticleSystem::spawnWaterSplash(const glm::vec3& position, float intensity) {
@@ -202,14 +195,13 @@ bool ParticleSystem::spawnParticleEffect(const std::string& effectName, const gl
 
 void ParticleSystem::spawnParticle(const glm::vec3& position, const glm::vec3& velocity,
                                   const glm::vec3& color, float lifetime, float size) {
-    // Don't spawn if we have too many particles
-    if (m_particles.size() >= 1000) {
-        return;
-    }
-
-    m_particles.emplace_back(position, velocity, color, lifetime, size);
+    // Pool capacity bounds the particle count (spawn fails silently when full)
+    glm::vec3 c = glm::clamp(color, glm::vec3(0.0f), glm::vec3(1.0f)) * 255.0f + 0.5f;
+    uint32_t tint = static_cast<uint32_t>(c.r) | (static_cast<uint32_t>(c.g) << 8) |
+                    (static_cast<uint32_t>(c.b) << 16) | 0xFF000000u;
+    m_pool.spawn(m_splashSlot, position, velocity, lifetime, 0.0f, size, tint);
 }
 
 void ParticleSystem::clear() {
-    m_particles.clear();
+    m_pool.clear();
 }
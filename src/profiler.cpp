@@ -0,0 +1,462 @@
+/**
+ * @file profiler.cpp
+ * @brief Zone profiler implementation
+ *
+ * Created: 2025-11-28
+ */
+
+#include "profiler.h"
+#include "logger.h"
+#include "imgui.h"
+#include <implot.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+
+namespace {
+
+// Zone registry: written once per call site, read by the viewer and exporter
+ProfileZoneInfo g_zones[Profiler::MAX_ZONES] = {{"<overflow>", "", 0}};
+std::atomic<uint16_t> g_zoneCount{1};  // Zone 0 catches registry overflow
+std::mutex g_zoneMutex;
+
+// Cap on events kept per frame so a stalled frame can't grow the history unbounded
+constexpr size_t MAX_EVENTS_PER_FRAME = 65536;
+
+int64_t steadyNowNs() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+ImU32 zoneColor(uint16_t zoneId) {
+    // Golden ratio hue walk keeps neighbouring zone IDs visually distinct
+    float hue = std::fmod(zoneId * 0.618034f, 1.0f);
+    return ImColor::HSV(hue, 0.5f, 0.85f);
+}
+
+std::string escapeJson(const std::string& text) {
+    std::string out;
+    out.reserve(text.size());
+    for (char c : text) {
+        if (c == '"' || c == '\\') out += '\\';
+        out += c;
+    }
+    return out;
+}
+
+}  // namespace
+
+// ============================================================================
+// Per-thread ring ownership
+// ============================================================================
+
+/**
+ * Thread-local handle to the calling thread's ring. Retires the ring when the
+ * thread exits: it is freed then, or by frameMark() after the final drain.
+ */
+struct ProfilerThreadSlot {
+    std::shared_ptr<Profiler::ThreadRing> ring;
+
+    ~ProfilerThreadSlot() {
+        if (ring) {
+            Profiler::instance().retireRing(ring);
+        }
+    }
+};
+
+namespace {
+thread_local ProfilerThreadSlot t_profilerSlot;
+}
+
+// Trivially destructible copy of the slot's ring: the hot path avoids the
+// TLS init wrapper that non-trivial thread_locals pay on every access
+thread_local Profiler::ThreadRing* Profiler::s_threadRing = nullptr;
+
+// ============================================================================
+// Profiler
+// ============================================================================
+
+Profiler::Profiler()
+    : m_threadNames(MAX_THREADS)
+    , m_frames(MAX_FRAMES) {
+    m_calibrationTick = now();
+    m_calibrationNs = steadyNowNs();
+    m_lastFrameTick = m_calibrationTick;
+#if PROFILER_HAS_RDTSC
+    m_msPerTick = 1.0 / 3.0e6;  // Assume 3 GHz until the first calibration
+#endif
+}
+
+Profiler& Profiler::instance() {
+    static Profiler instance;
+    return instance;
+}
+
+uint16_t Profiler::registerZone(const char* name, const char* file, int line) {
+    std::lock_guard<std::mutex> lock(g_zoneMutex);
+    uint16_t id = g_zoneCount.load(std::memory_order_relaxed);
+    if (id >= MAX_ZONES) {
+        Logger::warning() << "Profiler zone registry full, '" << name << "' shares the overflow zone";
+        return 0;
+    }
+    g_zones[id] = {name, file, line};
+    g_zoneCount.store(id + 1, std::memory_order_release);
+    return id;
+}
+
+const char* Profiler::getZoneName(uint16_t zoneId) const {
+    if (zoneId >= g_zoneCount.load(std::memory_order_acquire)) return "<unknown>";
+    return g_zones[zoneId].name;
+}
+
+void Profiler::setThreadName(const char* name) {
+    Profiler& profiler = instance();
+    ThreadRing* ring = profiler.threadRing();
+    std::lock_guard<std::mutex> lock(profiler.m_ringsMutex);
+    profiler.m_threadNames[ring->threadIndex] = name;
+}
+
+std::string Profiler::getThreadName(uint8_t thread) const {
+    std::lock_guard<std::mutex> lock(m_ringsMutex);
+    if (!m_threadNames[thread].empty()) return m_threadNames[thread];
+    return "Thread " + std::to_string(thread);
+}
+
+Profiler::ThreadRing* Profiler::threadRing() {
+    if (s_threadRing) {
+        return s_threadRing;
+    }
+    if (!t_profilerSlot.ring) {
+        auto ring = std::make_shared<ThreadRing>();
+        std::lock_guard<std::mutex> lock(m_ringsMutex);
+        ring->threadIndex = static_cast<uint8_t>(m_nextThreadIndex++ % MAX_THREADS);
+        m_threadNames[ring->threadIndex].clear();  // Index may be reused by a new thread
+        m_rings.push_back(ring);
+        t_profilerSlot.ring = std::move(ring);
+    }
+    s_threadRing = t_profilerSlot.ring.get();
+    return s_threadRing;
+}
+
+void Profiler::retireRing(const std::shared_ptr<ThreadRing>& ring) {
+    std::lock_guard<std::mutex> lock(m_ringsMutex);
+    ring->retired.store(true, std::memory_order_release);
+
+    // Keep undrained events for the next frameMark(); without frame marks (tools,
+    // tests, after shutdown) nothing would ever drain the ring
+    const bool drained = ring->head.load(std::memory_order_acquire) == ring->tail.load(std::memory_order_relaxed);
+    if (drained || !m_framesMarked) {
+        m_rings.erase(std::remove(m_rings.begin(), m_rings.end(), ring), m_rings.end());
+    }
+}
+
+uint8_t Profiler::enterZone() {
+    return instance().threadRing()->depth++;
+}
+
+void Profiler::recordZone(uint16_t zoneId, uint8_t depth, uint64_t startTick, uint64_t endTick) {
+    ThreadRing* ring = threadRing();
+    ring->depth = depth;
+
+    const uint64_t head = ring->head.load(std::memory_order_relaxed);
+    const uint64_t tail = ring->tail.load(std::memory_order_acquire);
+    if (head - tail >= RING_CAPACITY) {
+        m_dropped.fetch_add(1, std::memory_order_relaxed);
+        return;  // Never block a thread on profiling
+    }
+
+    ProfileEvent& event = ring->events[head & (RING_CAPACITY - 1)];
+    event.startTick = startTick;
+    event.endTick = endTick;
+    event.zoneId = zoneId;
+    event.depth = depth;
+    event.thread = ring->threadIndex;
+    ring->head.store(head + 1, std::memory_order_release);
+}
+
+void Profiler::calibrate() {
+#if PROFILER_HAS_RDTSC
+    // Ratio over the whole run: accuracy improves the longer the game runs
+    const int64_t elapsedNs = steadyNowNs() - m_calibrationNs;
+    const uint64_t elapsedTicks = now() - m_calibrationTick;
+    if (elapsedNs > 100000000 && elapsedTicks > 0) {  // 100 ms minimum baseline
+        m_msPerTick = (elapsedNs / 1.0e6) / static_cast<double>(elapsedTicks);
+    }
+#endif
+}
+
+void Profiler::frameMark() {
+    const uint64_t frameEnd = now();
+    calibrate();
+
+    ProfileFrame& frame = m_frames[m_frameCursor];
+    if (!m_paused) {
+        frame.startTick = m_lastFrameTick;
+        frame.endTick = frameEnd;
+        frame.events.clear();
+    }
+    m_lastFrameTick = frameEnd;
+
+    {
+        std::lock_guard<std::mutex> lock(m_ringsMutex);
+        m_framesMarked = true;
+        for (auto it = m_rings.begin(); it != m_rings.end();) {
+            ThreadRing& ring = **it;
+
+            // Read retired BEFORE head: a retired ring receives no further events
+            const bool retired = ring.retired.load(std::memory_order_acquire);
+            const uint64_t head = ring.head.load(std::memory_order_acquire);
+            const uint64_t tail = ring.tail.load(std::memory_order_relaxed);
+
+            if (!m_paused) {
+                for (uint64_t i = tail; i < head; ++i) {
+                    if (frame.events.size() >= MAX_EVENTS_PER_FRAME) {
+                        m_dropped.fetch_add(head - i, std::memory_order_relaxed);
+                        break;
+                    }
+                    frame.events.push_back(ring.events[i & (RING_CAPACITY - 1)]);
+                }
+            }
+            ring.tail.store(head, std::memory_order_release);
+
+            if (retired) {
+                it = m_rings.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
+
+    if (!m_paused) {
+        m_frameCursor = (m_frameCursor + 1) % MAX_FRAMES;
+        m_frameCount = std::min(m_frameCount + 1, MAX_FRAMES);
+    }
+}
+
+void Profiler::shutdown() {
+    setEnabled(false);
+
+    {
+        // Live threads keep their ring through their slot until they exit
+        std::lock_guard<std::mutex> lock(m_ringsMutex);
+        m_rings.clear();
+        m_rings.shrink_to_fit();
+        m_framesMarked = false;
+    }
+
+    for (ProfileFrame& frame : m_frames) {
+        frame.events.clear();
+        frame.events.shrink_to_fit();
+    }
+    m_frameCursor = 0;
+    m_frameCount = 0;
+    m_selectedFrame = -1;
+}
+
+// ============================================================================
+// Viewer
+// ============================================================================
+
+void Profiler::drawWindow(bool* open) {
+    ImGui::SetNextWindowSize(ImVec2(900, 520), ImGuiCond_FirstUseEver);
+    if (!ImGui::Begin("Profiler", open)) {
+        ImGui::End();
+        return;
+    }
+
+    // Create ImPlot context if not already created
+    if (ImPlot::GetCurrentContext() == nullptr) {
+        ImPlot::CreateContext();
+    }
+
+    bool enabled = isEnabled();
+    if (ImGui::Checkbox("Enabled", &enabled)) {
+        setEnabled(enabled);
+    }
+    ImGui::SameLine();
+    bool paused = m_paused;
+    if (ImGui::Checkbox("Pause", &paused)) {
+        setPaused(paused);
+        if (!paused) m_selectedFrame = -1;  // Resume following the latest frame
+    }
+    ImGui::SameLine();
+    ImGui::Text("Zones: %u  Dropped: %llu", static_cast<unsigned>(g_zoneCount.load(std::memory_order_acquire)),
+                static_cast<unsigned long long>(getDroppedCount()));
+
+    if (m_frameCount == 0) {
+        ImGui::Text("No frames recorded");
+        ImGui::End();
+        return;
+    }
+
+    // Chronological index i maps to ring slot (oldest first)
+    const size_t oldestSlot = (m_frameCursor + MAX_FRAMES - m_frameCount) % MAX_FRAMES;
+    auto slotOf = [&](size_t i) { return (oldestSlot + i) % MAX_FRAMES; };
+
+    std::vector<double> frameMs(m_frameCount);
+    for (size_t i = 0; i < m_frameCount; ++i) {
+        const ProfileFrame& f = m_frames[slotOf(i)];
+        frameMs[i] = ticksToMs(f.endTick - f.startTick);
+    }
+
+    int selected = m_selectedFrame;
+    if (selected < 0 || selected >= static_cast<int>(m_frameCount)) {
+        selected = static_cast<int>(m_frameCount) - 1;
+    }
+
+    // Frame time bars (click to select a frame; pause first to keep it still)
+    if (ImPlot::BeginPlot("##ProfilerFrames", ImVec2(-1, 110), ImPlotFlags_NoLegend | ImPlotFlags_NoMenus)) {
+        ImPlot::SetupAxes(nullptr, "ms", ImPlotAxisFlags_NoTickLabels, ImPlotAxisFlags_AutoFit);
+        ImPlot::SetupAxisLimits(ImAxis_X1, -0.5, MAX_FRAMES - 0.5, ImPlotCond_Always);
+        ImPlot::PlotBars("frame", frameMs.data(), static_cast<int>(frameMs.size()), 0.7);
+
+        double selectedX = selected;
+        ImPlot::PlotInfLines("##selected", &selectedX, 1);
+
+        if (ImPlot::IsPlotHovered() && ImGui::IsMouseClicked(ImGuiMouseButton_Left)) {
+            int clicked = static_cast<int>(std::lround(ImPlot::GetPlotMousePos().x));
+            m_selectedFrame = std::clamp(clicked, 0, static_cast<int>(m_frameCount) - 1);
+            setPaused(true);
+        }
+        ImPlot::EndPlot();
+    }
+
+    const ProfileFrame& frame = m_frames[slotOf(static_cast<size_t>(selected))];
+    const double frameLengthMs = frameMs[selected];
+    ImGui::Text("Frame %d: %.2f ms, %zu zones", selected, frameLengthMs, frame.events.size());
+
+    // Lane layout: one lane per thread, one row per nesting depth
+    int laneDepth[MAX_THREADS] = {};
+    bool laneUsed[MAX_THREADS] = {};
+    for (const ProfileEvent& e : frame.events) {
+        laneUsed[e.thread] = true;
+        laneDepth[e.thread] = std::max(laneDepth[e.thread], e.depth + 1);
+    }
+    int laneRow[MAX_THREADS] = {};
+    int totalRows = 0;
+    for (size_t t = 0; t < MAX_THREADS; ++t) {
+        if (!laneUsed[t]) continue;
+        laneRow[t] = totalRows + 1;  // One row for the thread label
+        totalRows += laneDepth[t] + 1;
+    }
+
+    // Flame graph / timeline of the selected frame
+    if (ImPlot::BeginPlot("##ProfilerFlame", ImVec2(-1, -1),
+                          ImPlotFlags_NoLegend | ImPlotFlags_NoMenus | ImPlotFlags_NoBoxSelect)) {
+        ImPlot::SetupAxes("ms", nullptr, ImPlotAxisFlags_None,
+                          ImPlotAxisFlags_Invert | ImPlotAxisFlags_NoTickLabels | ImPlotAxisFlags_NoGridLines);
+        ImPlot::SetupAxisLimits(ImAxis_X1, 0.0, std::max(frameLengthMs, 0.1), ImPlotCond_Once);
+        ImPlot::SetupAxisLimits(ImAxis_Y1, 0.0, std::max(totalRows, 1), ImPlotCond_Always);
+
+        ImPlot::PushPlotClipRect();
+        ImDrawList* drawList = ImPlot::GetPlotDrawList();
+        const ImPlotRect limits = ImPlot::GetPlotLimits();
+        const ImVec2 mouse = ImGui::GetMousePos();
+        const bool hovered = ImPlot::IsPlotHovered();
+        const ProfileEvent* hoveredEvent = nullptr;
+
+        for (size_t t = 0; t < MAX_THREADS; ++t) {
+            if (!laneUsed[t]) continue;
+            ImVec2 labelPos = ImPlot::PlotToPixels(limits.X.Min, laneRow[t] - 1);
+            std::string label = getThreadName(static_cast<uint8_t>(t));
+            drawList->AddText(ImVec2(labelPos.x + 4, labelPos.y + 1), IM_COL32(220, 220, 220, 255), label.c_str());
+        }
+
+        for (const ProfileEvent& e : frame.events) {
+            // Worker zones drained this frame may have started before it
+            const double x0 = (static_cast<double>(e.startTick) - static_cast<double>(frame.startTick)) * m_msPerTick;
+            const double x1 = (static_cast<double>(e.endTick) - static_cast<double>(frame.startTick)) * m_msPerTick;
+            if (x1 < limits.X.Min || x0 > limits.X.Max) continue;
+
+            const int row = laneRow[e.thread] + e.depth;
+            const ImVec2 a = ImPlot::PlotToPixels(x0, row);
+            const ImVec2 b = ImPlot::PlotToPixels(x1, row + 1);
+            const ImVec2 minPx(std::min(a.x, b.x), std::min(a.y, b.y) + 1);
+            const ImVec2 maxPx(std::max(std::max(a.x, b.x), minPx.x + 1.0f), std::max(a.y, b.y));
+
+            drawList->AddRectFilled(minPx, maxPx, zoneColor(e.zoneId));
+
+            const char* name = getZoneName(e.zoneId);
+            const float textWidth = ImGui::CalcTextSize(name).x;
+            if (maxPx.x - minPx.x > textWidth + 6) {
+                drawList->AddText(ImVec2(minPx.x + 3, minPx.y), IM_COL32(20, 20, 20, 255), name);
+            }
+
+            if (hovered && mouse.x >= minPx.x && mouse.x <= maxPx.x && mouse.y >= minPx.y && mouse.y <= maxPx.y) {
+                hoveredEvent = &e;
+            }
+        }
+        ImPlot::PopPlotClipRect();
+
+        if (hoveredEvent) {
+            const ProfileZoneInfo& info = g_zones[hoveredEvent->zoneId];
+            ImGui::BeginTooltip();
+            ImGui::Text("%s", info.name);
+            ImGui::Text("%.3f ms", ticksToMs(hoveredEvent->endTick - hoveredEvent->startTick));
+            ImGui::TextDisabled("%s:%d", info.file, info.line);
+            ImGui::EndTooltip();
+        }
+        ImPlot::EndPlot();
+    }
+
+    ImGui::End();
+}
+
+// ============================================================================
+// Export
+// ============================================================================
+
+bool Profiler::exportChromeTrace(const std::string& path) {
+    std::ofstream file(path);
+    if (!file.is_open()) {
+        Logger::error() << "Failed to open profiler export file: " << path;
+        return false;
+    }
+
+    const size_t oldestSlot = (m_frameCursor + MAX_FRAMES - m_frameCount) % MAX_FRAMES;
+    const uint64_t baseTick = m_frameCount > 0 ? m_frames[oldestSlot].startTick : 0;
+    auto toUs = [&](uint64_t tick) {
+        return (static_cast<double>(tick) - static_cast<double>(baseTick)) * m_msPerTick * 1000.0;
+    };
+
+    bool threadSeen[MAX_THREADS] = {};
+    size_t eventCount = 0;
+    char line[256];
+
+    file << "{\"traceEvents\":[\n";
+    bool first = true;
+    for (size_t i = 0; i < m_frameCount; ++i) {
+        const ProfileFrame& frame = m_frames[(oldestSlot + i) % MAX_FRAMES];
+
+        // Frame markers as instant events on the main timeline
+        std::snprintf(line, sizeof(line),
+                      "%s{\"name\":\"frame\",\"ph\":\"i\",\"s\":\"g\",\"pid\":1,\"tid\":0,\"ts\":%.3f}",
+                      first ? "" : ",\n", toUs(frame.startTick));
+        file << line;
+        first = false;
+
+        for (const ProfileEvent& e : frame.events) {
+            threadSeen[e.thread] = true;
+            std::snprintf(line, sizeof(line),
+                          ",\n{\"name\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f}",
+                          escapeJson(getZoneName(e.zoneId)).c_str(), static_cast<unsigned>(e.thread),
+                          toUs(e.startTick), ticksToMs(e.endTick - e.startTick) * 1000.0);
+            file << line;
+            ++eventCount;
+        }
+    }
+
+    for (size_t t = 0; t < MAX_THREADS; ++t) {
+        if (!threadSeen[t]) continue;
+        file << (first ? "" : ",\n") << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << t
+             << ",\"args\":{\"name\":\"" << escapeJson(getThreadName(static_cast<uint8_t>(t))) << "\"}}";
+        first = false;
+    }
+    file << "\n]}\n";
+
+    Logger::info() << "Exported " << eventCount << " profiler zones (" << m_frameCount
+                   << " frames) to " << path;
+    return file.good();
+}
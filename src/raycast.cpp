@@ -1,5 +1,7 @@
 #include "raycast.h"
 #include "world.h"
+#include "world_utils.h"
+#include "chunk.h"
 #include "block_system.h"
 #include <cmath>
 #include <algorithm>
@@ -67,10 +69,28 @@ RaycastHit Raycast::castRay(World* world, const glm::vec3& origin, const glm::ve
     float totalDist = 0.0f;
     const float maxDist = maxDistance; // Already in block space
 
+    // PERFORMANCE (2025-11-28): Look the chunk up once per chunk crossed (not per voxel)
+    // and skip the block read inside all-air 8³ bricks - long ground probes cross open sky
+    Chunk* chunk = nullptr;
+    glm::ivec3 chunkPos(0);
+    bool chunkResolved = false;
+
     while (totalDist < maxDist) {
         // Check current voxel
         glm::vec3 worldPos(static_cast<float>(mapPos.x), static_cast<float>(mapPos.y), static_cast<float>(mapPos.z));
-        int blockID = world->getBlockAt(worldPos.x, worldPos.y, worldPos.z);
+        auto coords = worldToBlockCoords(worldPos.x, worldPos.y, worldPos.z);
+        const glm::ivec3 currentChunk(coords.chunkX, coords.chunkY, coords.chunkZ);
+        if (!chunkResolved || currentChunk != chunkPos) {
+            chunk = world->getChunkAt(coords.chunkX, coords.chunkY, coords.chunkZ);
+            chunkPos = currentChunk;
+            chunkResolved = true;
+        }
+
+        int blockID = 0;  // Air (outside world bounds or empty brick)
+        if (chunk && (chunk->getBricks().occupied() &
+                      ChunkBricks::bit(ChunkBricks::indexOf(coords.localX, coords.localY, coords.localZ)))) {
+            blockID = chunk->getBlock(coords.localX, coords.localY, coords.localZ);
+        }
 
         if (isSolid(blockID)) { // Hit a solid block (not air)
             result.hit = true;
@@ -4,6 +4,7 @@
  */
 
 #include "script_action.h"
+#include "script_bytecode.h"
 #include "event_dispatcher.h"
 #include "event_types.h"
 #include "block_system.h"
@@ -12,9 +13,9 @@
 #include "command_registry.h"
 #include "logger.h"
 #include <unordered_map>
-#include <random>
 #include <algorithm>
 #include <cctype>
+#include <charconv>
 
 // Forward declarations
 class World; // We'll need this for executing actions
@@ -27,10 +28,6 @@ static std::unordered_map<int, std::vector<ListenerHandle>> g_blockEventHandles;
 // Maps biomeName -> list of listener handles for cleanup
 static std::unordered_map<std::string, std::vector<ListenerHandle>> g_biomeEventHandles;
 
-// Random number generator for probability checks
-static std::random_device g_rd;
-static std::mt19937 g_rng(g_rd());
-
 /**
  * @brief Helper function to normalize string (lowercase, trim whitespace)
  */
@@ -48,19 +45,6 @@ static std::string normalizeString(const std::string& str) {
     return result;
 }
 
-/**
- * @brief Roll a probability check
- * @param probability Percentage chance (0-100)
- * @return true if check passes, false otherwise
- */
-static bool rollProbability(int probability) {
-    if (probability >= 100) return true;
-    if (probability <= 0) return false;
-
-    std::uniform_int_distribution<int> dist(1, 100);
-    return dist(g_rng) <= probability;
-}
-
 /**
  * @brief Parse glm::ivec3 from YAML sequence [x, y, z]
  */
@@ -100,71 +84,127 @@ ScriptVariableRegistry& ScriptVariableRegistry::instance() {
     return instance;
 }
 
+uint32_t ScriptVariableRegistry::resolveSlotLocked(const std::string& name) {
+    auto it = m_slotIndex.find(name);
+    if (it != m_slotIndex.end()) {
+        return it->second;
+    }
+    const uint32_t slot = static_cast<uint32_t>(m_slots.size());
+    m_slots.emplace_back();
+    m_slotIndex.emplace(name, slot);
+    return slot;
+}
+
+int ScriptVariableRegistry::slotNumber(const Slot& slot, int defaultValue) {
+    if (!slot.set) {
+        return defaultValue;
+    }
+    if (slot.numeric) {
+        return slot.number;
+    }
+    try {
+        return std::stoi(slot.text);
+    } catch (const std::exception&) {
+        return defaultValue;
+    }
+}
+
 void ScriptVariableRegistry::setVariable(const std::string& name, const std::string& value) {
     std::lock_guard<std::mutex> lock(m_mutex);
-    m_variables[name] = value;
+    Slot& slot = m_slots[resolveSlotLocked(name)];
+    slot.set = true;
+
+    // Keep canonical integers numeric so getVariable() still returns the exact text
+    int number = 0;
+    auto result = std::from_chars(value.data(), value.data() + value.size(), number);
+    if (result.ec == std::errc() && result.ptr == value.data() + value.size() &&
+        std::to_string(number) == value) {
+        slot.numeric = true;
+        slot.number = number;
+        slot.text.clear();
+    } else {
+        slot.numeric = false;
+        slot.text = value;
+    }
 }
 
 std::string ScriptVariableRegistry::getVariable(const std::string& name, const std::string& defaultValue) {
     std::lock_guard<std::mutex> lock(m_mutex);
-    auto it = m_variables.find(name);
-    if (it != m_variables.end()) {
-        return it->second;
+    auto it = m_slotIndex.find(name);
+    if (it == m_slotIndex.end() || !m_slots[it->second].set) {
+        return defaultValue;
     }
-    return defaultValue;
+    const Slot& slot = m_slots[it->second];
+    return slot.numeric ? std::to_string(slot.number) : slot.text;
 }
 
 void ScriptVariableRegistry::setNumeric(const std::string& name, int value) {
     std::lock_guard<std::mutex> lock(m_mutex);
-    m_variables[name] = std::to_string(value);
+    Slot& slot = m_slots[resolveSlotLocked(name)];
+    slot.set = true;
+    slot.numeric = true;
+    slot.number = value;
+    slot.text.clear();
 }
 
 int ScriptVariableRegistry::getNumeric(const std::string& name, int defaultValue) {
     std::lock_guard<std::mutex> lock(m_mutex);
-    auto it = m_variables.find(name);
-    if (it != m_variables.end()) {
-        try {
-            return std::stoi(it->second);
-        } catch (const std::exception&) {
-            return defaultValue;
-        }
+    auto it = m_slotIndex.find(name);
+    if (it == m_slotIndex.end()) {
+        return defaultValue;
     }
-    return defaultValue;
+    return slotNumber(m_slots[it->second], defaultValue);
 }
 
 void ScriptVariableRegistry::increment(const std::string& name, int amount) {
-    std::lock_guard<std::mutex> lock(m_mutex);
-    int currentValue = 0;
-    auto it = m_variables.find(name);
-    if (it != m_variables.end()) {
-        try {
-            currentValue = std::stoi(it->second);
-        } catch (const std::exception&) {
-            // If parsing fails, treat as 0
-            currentValue = 0;
-        }
-    }
-    m_variables[name] = std::to_string(currentValue + amount);
+    addToSlot(resolveSlot(name), amount);
 }
 
 void ScriptVariableRegistry::decrement(const std::string& name, int amount) {
+    addToSlot(resolveSlot(name), -amount);
+}
+
+void ScriptVariableRegistry::clear() {
     std::lock_guard<std::mutex> lock(m_mutex);
-    int currentValue = 0;
-    auto it = m_variables.find(name);
-    if (it != m_variables.end()) {
-        try {
-            currentValue = std::stoi(it->second);
-        } catch (const std::exception&) {
-            // If parsing fails, treat as 0
-            currentValue = 0;
-        }
+    for (Slot& slot : m_slots) {
+        slot = Slot();
     }
-    m_variables[name] = std::to_string(currentValue - amount);
 }
 
-void ScriptVariableRegistry::clear() {
+uint32_t ScriptVariableRegistry::resolveSlot(const std::string& name) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return resolveSlotLocked(name);
+}
+
+void ScriptVariableRegistry::setSlotNumeric(uint32_t slot, int value) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    Slot& entry = m_slots[slot];
+    entry.set = true;
+    entry.numeric = true;
+    entry.number = value;
+}
+
+void ScriptVariableRegistry::setSlotText(uint32_t slot, const std::string& value) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    Slot& entry = m_slots[slot];
+    entry.set = true;
+    entry.numeric = false;
+    entry.text.assign(value);
+}
+
+int ScriptVariableRegistry::addToSlot(uint32_t slot, int amount) {
     std::lock_guard<std::mutex> lock(m_mutex);
-    m_variables.clear();
+    Slot& entry = m_slots[slot];
+    // Unset or unparsable values count as 0, as before
+    entry.number = slotNumber(entry, 0) + amount;
+    entry.set = true;
+    entry.numeric = true;
+    return entry.number;
+}
+
+int ScriptVariableRegistry::getSlotNumeric(uint32_t slot, int defaultValue) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return slotNumber(m_slots[slot], defaultValue);
 }
 
 // ============================================================================
@@ -353,8 +393,14 @@ ScriptAction ScriptAction::fromYAML(const YAML::Node& node) {
             }
             break;
 
-        case ActionType::BREAK_BLOCK:
         case ActionType::TRIGGER_UPDATE:
+            // Optional delay in game ticks (default 1 = next tick)
+            if (node["delay"]) {
+                action.delayTicks = std::max(1, node["delay"].as<int>());
+            }
+            break;
+
+        case ActionType::BREAK_BLOCK:
             // No additional parameters needed
             break;
     }
@@ -385,6 +431,7 @@ ScriptEventHandler ScriptEventHandler::fromYAML(const std::string& eventType, co
         }
     }
 
+    handler.program = ScriptProgram::compile(handler.actions, eventType);
     return handler;
 }
 
@@ -392,308 +439,15 @@ ScriptEventHandler ScriptEventHandler::fromYAML(const std::string& eventType, co
 // Action Execution
 // ============================================================================
 
-/**
- * @brief Execute a single action at a specific position
- * @param action The action to execute
- * @param position World position where the event occurred
- */
-static void executeAction(const ScriptAction& action, const glm::ivec3& position) {
-    // Check probability
-    if (!rollProbability(action.probability)) {
-        return; // Failed probability check
-    }
-
-    // Calculate target position with offset
-    glm::ivec3 targetPos = position + action.offset;
-
-    Logger::debug() << "Executing action " << actionTypeToString(action.type)
-                   << " at position (" << targetPos.x << ", " << targetPos.y << ", " << targetPos.z << ")";
-
-    switch (action.type) {
-        case ActionType::PLACE_BLOCK: {
-            // Get block ID from name
-            auto& registry = BlockRegistry::instance();
-            int blockID = registry.getID(action.blockName);
-
-            if (blockID < 0) {
-                Logger::warning() << "Unknown block name: " << action.blockName;
-                break;
-            }
-
-            // Place the block using EngineAPI
-            auto& api = EngineAPI::instance();
-            if (api.isInitialized()) {
-                if (api.placeBlock(targetPos, blockID)) {
-                    Logger::debug() << "PLACE_BLOCK: " << action.blockName << " at ("
-                                   << targetPos.x << ", " << targetPos.y << ", " << targetPos.z << ")";
-                } else {
-                    Logger::warning() << "Failed to place block " << action.blockName << " at ("
-                                     << targetPos.x << ", " << targetPos.y << ", " << targetPos.z << ")";
-                }
-            } else {
-                Logger::warning() << "EngineAPI not initialized, cannot place block";
-            }
-            break;
-        }
-
-        case ActionType::BREAK_BLOCK: {
-            // Break the block using EngineAPI
-            auto& api = EngineAPI::instance();
-            if (api.isInitialized()) {
-                if (api.breakBlock(targetPos)) {
-                    Logger::debug() << "BREAK_BLOCK at ("
-                                   << targetPos.x << ", " << targetPos.y << ", " << targetPos.z << ")";
-                } else {
-                    Logger::warning() << "Failed to break block at ("
-                                     << targetPos.x << ", " << targetPos.y << ", " << targetPos.z << ")";
-                }
-            } else {
-                Logger::warning() << "EngineAPI not initialized, cannot break block";
-            }
-            break;
-        }
-
-        case ActionType::SPAWN_STRUCTURE: {
-            // Spawn structure using EngineAPI
-            auto& api = EngineAPI::instance();
-            if (api.isInitialized()) {
-                if (api.spawnStructure(action.structureName, targetPos)) {
-                    Logger::debug() << "SPAWN_STRUCTURE: " << action.structureName << " at ("
-                                   << targetPos.x << ", " << targetPos.y << ", " << targetPos.z << ")";
-                } else {
-                    Logger::warning() << "Failed to spawn structure " << action.structureName << " at ("
-                                     << targetPos.x << ", " << targetPos.y << ", " << targetPos.z << ")";
-                }
-            } else {
-                Logger::warning() << "EngineAPI not initialized, cannot spawn structure";
-            }
-            break;
-        }
-
-        case ActionType::SPAWN_PARTICLES: {
-            // Spawn particle effect using EngineAPI
-            auto& api = EngineAPI::instance();
-            if (api.isInitialized()) {
-                // Convert integer position to float for particle system
-                glm::vec3 particlePos(
-                    static_cast<float>(targetPos.x) + 0.5f,  // Center of block
-                    static_cast<float>(targetPos.y) + 0.5f,
-                    static_cast<float>(targetPos.z) + 0.5f
-                );
-
-                if (api.spawnParticles(action.particleName, particlePos)) {
-                    Logger::debug() << "SPAWN_PARTICLES: " << action.particleName << " at ("
-                                   << targetPos.x << ", " << targetPos.y << ", " << targetPos.z << ")";
-                } else {
-                    Logger::warning() << "Failed to spawn particles '" << action.particleName << "' at ("
-                                     << targetPos.x << ", " << targetPos.y << ", " << targetPos.z
-                                     << "): unknown effect name";
-                }
-            } else {
-                Logger::warning() << "EngineAPI not initialized, cannot spawn particles";
-            }
-            break;
-        }
-
-        case ActionType::PLAY_SOUND: {
-            // TODO: Play sound effect (not yet implemented in EngineAPI)
-            Logger::info() << "PLAY_SOUND: " << action.soundName << " at ("
-                          << targetPos.x << ", " << targetPos.y << ", " << targetPos.z << ")";
-            break;
-        }
-
-        case ActionType::RUN_COMMAND: {
-            Logger::info() << "RUN_COMMAND: " << action.command;
-            bool success = CommandRegistry::instance().executeCommand(action.command);
-            if (!success) {
-                Logger::warning() << "Command failed or not found: " << action.command;
-            }
-            break;
-        }
-
-        case ActionType::SET_METADATA: {
-            auto& api = EngineAPI::instance();
-            if (api.isInitialized()) {
-                // Set block metadata for each key-value pair
-                for (const auto& pair : action.metadata) {
-                    // Parse the value as uint8_t
-                    try {
-                        uint8_t metadataValue = static_cast<uint8_t>(std::stoi(pair.second));
-                        if (api.setBlockMetadata(targetPos, metadataValue)) {
-                            Logger::debug() << "SET_METADATA at ("
-                                           << targetPos.x << ", " << targetPos.y << ", " << targetPos.z
-                                           << "): " << pair.first << " = " << (int)metadataValue;
-                        } else {
-                            Logger::warning() << "Failed to set metadata at ("
-                                             << targetPos.x << ", " << targetPos.y << ", " << targetPos.z << ")";
-                        }
-                    } catch (const std::exception& e) {
-                        Logger::warning() << "Invalid metadata value for " << pair.first
-                                         << ": " << pair.second << " (" << e.what() << ")";
-                    }
-                }
-            } else {
-                Logger::warning() << "EngineAPI not initialized, cannot set metadata";
-            }
-            break;
-        }
-
-        case ActionType::TRIGGER_UPDATE: {
-            // Dispatch a block update event
-            auto& api = EngineAPI::instance();
-            if (api.isInitialized()) {
-                // Get the block ID at the target position
-                auto blockQuery = api.getBlockAt(targetPos);
-                if (blockQuery.valid) {
-                    EventDispatcher::instance().dispatch(
-                        std::make_unique<BlockUpdateEvent>(targetPos, blockQuery.blockID)
-                    );
-                    Logger::debug() << "TRIGGER_UPDATE at ("
-                                   << targetPos.x << ", " << targetPos.y << ", " << targetPos.z << ")";
-                } else {
-                    Logger::warning() << "Failed to trigger update at ("
-                                     << targetPos.x << ", " << targetPos.y << ", " << targetPos.z
-                                     << "): invalid block position";
-                }
-            } else {
-                Logger::warning() << "EngineAPI not initialized, cannot trigger update";
-            }
-            break;
-        }
-
-        case ActionType::SET_VARIABLE: {
-            auto& registry = ScriptVariableRegistry::instance();
-            registry.setVariable(action.variableName, action.variableValue);
-            Logger::debug() << "SET_VARIABLE: " << action.variableName
-                           << " = " << action.variableValue;
-            break;
-        }
-
-        case ActionType::GET_VARIABLE: {
-            auto& registry = ScriptVariableRegistry::instance();
-            std::string value = registry.getVariable(action.variableName, action.variableValue);
-            Logger::debug() << "GET_VARIABLE: " << action.variableName
-                           << " = " << value;
-            // Note: GET_VARIABLE is primarily for future condition checking
-            // For now, it just logs the value
-            break;
-        }
-
-        case ActionType::INCREMENT_VAR: {
-            auto& registry = ScriptVariableRegistry::instance();
-            registry.increment(action.variableName, action.incrementAmount);
-            int newValue = registry.getNumeric(action.variableName);
-            Logger::debug() << "INCREMENT_VAR: " << action.variableName
-                           << " by " << action.incrementAmount
-                           << " (new value: " << newValue << ")";
-            break;
-        }
-
-        case ActionType::DECREMENT_VAR: {
-            auto& registry = ScriptVariableRegistry::instance();
-            registry.decrement(action.variableName, action.incrementAmount);
-            int newValue = registry.getNumeric(action.variableName);
-            Logger::debug() << "DECREMENT_VAR: " << action.variableName
-                           << " by " << action.incrementAmount
-                           << " (new value: " << newValue << ")";
-            break;
-        }
-
-        case ActionType::CONDITIONAL: {
-            // Evaluate the condition
-            bool conditionResult = false;
-
-            switch (action.conditionType) {
-                case ConditionType::BLOCK_IS: {
-                    auto& api = EngineAPI::instance();
-                    if (api.isInitialized()) {
-                        auto blockQuery = api.getBlockAt(targetPos);
-                        if (blockQuery.valid) {
-                            auto& registry = BlockRegistry::instance();
-                            std::string blockName = registry.getBlockName(blockQuery.blockID);
-                            conditionResult = (normalizeString(blockName) == normalizeString(action.conditionValue));
-                        }
-                    }
-                    break;
-                }
-
-                case ConditionType::BLOCK_IS_NOT: {
-                    auto& api = EngineAPI::instance();
-                    if (api.isInitialized()) {
-                        auto blockQuery = api.getBlockAt(targetPos);
-                        if (blockQuery.valid) {
-                            auto& registry = BlockRegistry::instance();
-                            std::string blockName = registry.getBlockName(blockQuery.blockID);
-                            conditionResult = (normalizeString(blockName) != normalizeString(action.conditionValue));
-                        } else {
-                            conditionResult = true; // Invalid position counts as "not matching"
-                        }
-                    }
-                    break;
-                }
-
-                case ConditionType::RANDOM_CHANCE: {
-                    try {
-                        int chance = std::stoi(action.conditionValue);
-                        conditionResult = rollProbability(chance);
-                    } catch (const std::exception& e) {
-                        Logger::warning() << "Invalid random chance value: " << action.conditionValue;
-                        conditionResult = false;
-                    }
-                    break;
-                }
-
-                case ConditionType::TIME_IS_DAY: {
-                    auto& api = EngineAPI::instance();
-                    if (api.isInitialized()) {
-                        // Minecraft-style: daytime is 0-12000 in 24000-tick cycle
-                        float time = api.getTimeOfDay();
-                        conditionResult = (time >= 0.0f && time < 12000.0f);
-                    }
-                    break;
-                }
-
-                case ConditionType::TIME_IS_NIGHT: {
-                    auto& api = EngineAPI::instance();
-                    if (api.isInitialized()) {
-                        // Minecraft-style: nighttime is 12000-24000 in 24000-tick cycle
-                        float time = api.getTimeOfDay();
-                        conditionResult = (time >= 12000.0f && time < 24000.0f);
-                    }
-                    break;
-                }
-            }
-
-            Logger::debug() << "CONDITIONAL: condition evaluated to " << (conditionResult ? "true" : "false");
-
-            // Execute appropriate actions based on condition result
-            if (conditionResult) {
-                for (const auto& thenAction : action.thenActions) {
-                    executeAction(thenAction, position);
-                }
-            } else {
-                for (const auto& elseAction : action.elseActions) {
-                    executeAction(elseAction, position);
-                }
-            }
-            break;
-        }
-    }
-}
-
 /**
  * @brief Execute all actions in a handler
+ *
+ * PERFORMANCE (2025-11-28): Runs the bytecode compiled by fromYAML() instead of
+ * walking the ScriptAction tree per event (see script_bytecode.h).
  */
 static void executeHandler(const ScriptEventHandler& handler, const glm::ivec3& position) {
-    Logger::debug() << "Executing " << handler.actions.size() << " actions for event: " << handler.eventType;
-
-    for (const auto& action : handler.actions) {
-        try {
-            executeAction(action, position);
-        } catch (const std::exception& e) {
-            Logger::warning() << "Error executing action: " << e.what();
-            // Continue executing other actions
-        }
+    if (handler.program) {
+        handler.program->execute(position);
     }
 }
 
@@ -744,66 +498,21 @@ void registerBlockEventHandlers(int blockID, const std::vector<ScriptEventHandle
         try {
             EventType eventType = stringToEventType(handler.eventType);
 
-            // Create a callback that filters by block ID and position
-            auto callback = [blockID, handler](Event& event) {
+            // PERFORMANCE (2025-11-28): Registered in the dispatcher's per-block table, so the
+            // callback only runs for events addressed to this block ID (no per-type broadcast)
+            auto callback = [handler](Event& event) {
                 glm::ivec3 position;
-                int eventBlockID = -1;
-
-                // Extract position and block ID from event
-                switch (event.type) {
-                    case EventType::BLOCK_BREAK: {
-                        auto& e = static_cast<BlockBreakEvent&>(event);
-                        position = e.position;
-                        eventBlockID = e.blockID;
-                        break;
-                    }
-                    case EventType::BLOCK_PLACE: {
-                        auto& e = static_cast<BlockPlaceEvent&>(event);
-                        position = e.position;
-                        eventBlockID = e.blockID;
-                        break;
-                    }
-                    case EventType::BLOCK_STEP: {
-                        auto& e = static_cast<BlockStepEvent&>(event);
-                        position = e.position;
-                        eventBlockID = e.blockID;
-                        break;
-                    }
-                    case EventType::BLOCK_INTERACT: {
-                        auto& e = static_cast<BlockInteractEvent&>(event);
-                        position = e.position;
-                        eventBlockID = e.blockID;
-                        break;
-                    }
-                    case EventType::BLOCK_UPDATE: {
-                        auto& e = static_cast<BlockUpdateEvent&>(event);
-                        position = e.position;
-                        eventBlockID = e.blockID;
-                        break;
-                    }
-                    case EventType::NEIGHBOR_CHANGED: {
-                        auto& e = static_cast<NeighborChangedEvent&>(event);
-                        position = e.position;
-                        // For neighbor events, we need to check the block at position
-                        // TODO: Get block ID from world at position
-                        // For now, we'll skip this check and execute for all neighbor events
-                        eventBlockID = blockID;
-                        break;
-                    }
-                    default:
-                        return; // Unsupported event type for block scripts
-                }
-
-                // Only execute if the event is for this specific block
-                if (eventBlockID == blockID) {
+                int eventBlockID;
+                if (getEventBlockTarget(event, position, eventBlockID)) {
                     executeHandler(handler, position);
                 }
             };
 
             // Subscribe to the event
             std::string ownerStr = "block:" + std::to_string(blockID);
-            ListenerHandle handle = dispatcher.subscribe(
+            ListenerHandle handle = dispatcher.subscribeBlock(
                 eventType,
+                blockID,
                 callback,
                 EventPriority::NORMAL,
                 ownerStr
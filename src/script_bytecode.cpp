@@ -0,0 +1,416 @@
+/**
+ * @file script_bytecode.cpp
+ * @brief Script action compiler and interpreter
+ *
+ * Created: 2025-11-28
+ */
+
+#include "script_bytecode.h"
+#include "script_action.h"
+#include "block_system.h"
+#include "engine_api.h"
+#include "command_registry.h"
+#include "logger.h"
+#include <algorithm>
+#include <cctype>
+#include <random>
+#include <stdexcept>
+
+namespace {
+
+/// Same normalization the tree walker used for block_is (trim + lowercase)
+std::string normalizeName(const std::string& str) {
+    std::string result = str;
+    result.erase(0, result.find_first_not_of(" \t\n\r"));
+    result.erase(result.find_last_not_of(" \t\n\r") + 1);
+    std::transform(result.begin(), result.end(), result.begin(),
+                   [](unsigned char c) { return std::tolower(c); });
+    return result;
+}
+
+bool rollProbability(int probability) {
+    if (probability >= 100) return true;
+    if (probability <= 0) return false;
+
+    // Handlers can run on worker threads; one generator per thread
+    thread_local std::mt19937 rng(std::random_device{}());
+    std::uniform_int_distribution<int> dist(1, 100);
+    return dist(rng) <= probability;
+}
+
+/// Minecraft-style day: 0-12000 of a 24000-tick cycle (same thresholds as the tree walker)
+constexpr float DAY_END = 12000.0f;
+constexpr float NIGHT_END = 24000.0f;
+
+}  // namespace
+
+// ============================================================================
+// Compiler
+// ============================================================================
+
+std::shared_ptr<ScriptProgram> ScriptProgram::compile(const std::vector<ScriptAction>& actions,
+                                                      const std::string& name) {
+    auto program = std::make_shared<ScriptProgram>();
+    program->m_name = name;
+    program->emitActions(actions);
+    program->m_code.shrink_to_fit();
+    return program;
+}
+
+void ScriptProgram::emitActions(const std::vector<ScriptAction>& actions) {
+    for (const ScriptAction& action : actions) {
+        emitAction(action);
+    }
+}
+
+size_t ScriptProgram::emit(ScriptOp op, const glm::ivec3& offset, int32_t a, int32_t b) {
+    ScriptInstruction instruction;
+    instruction.op = op;
+    instruction.offset = offset;
+    instruction.a = a;
+    instruction.b = b;
+    m_code.push_back(instruction);
+    return m_code.size() - 1;
+}
+
+int32_t ScriptProgram::addString(const std::string& value) {
+    m_strings.push_back(value);
+    return static_cast<int32_t>(m_strings.size() - 1);
+}
+
+void ScriptProgram::emitAction(const ScriptAction& action) {
+    if (action.probability <= 0) {
+        return;  // Can never run
+    }
+
+    // Per-action probability: skip past the action's code when the roll fails
+    size_t chanceJump = SIZE_MAX;
+    if (action.probability < 100) {
+        chanceJump = emit(ScriptOp::JUMP_UNLESS_CHANCE, glm::ivec3(0), action.probability);
+    }
+
+    const glm::ivec3& offset = action.offset;
+    switch (action.type) {
+        case ActionType::PLACE_BLOCK: {
+            const int32_t nameIndex = addString(action.blockName);
+            const size_t pc = emit(ScriptOp::PLACE_BLOCK, offset, -1, nameIndex);
+            m_blockRefs.push_back({static_cast<uint32_t>(pc), static_cast<uint32_t>(nameIndex), true});
+            break;
+        }
+
+        case ActionType::BREAK_BLOCK:
+            emit(ScriptOp::BREAK_BLOCK, offset);
+            break;
+
+        case ActionType::SPAWN_STRUCTURE:
+            emit(ScriptOp::SPAWN_STRUCTURE, offset, addString(action.structureName));
+            break;
+
+        case ActionType::SPAWN_PARTICLES:
+            emit(ScriptOp::SPAWN_PARTICLES, offset, addString(action.particleName));
+            break;
+
+        case ActionType::PLAY_SOUND:
+            emit(ScriptOp::PLAY_SOUND, offset, addString(action.soundName));
+            break;
+
+        case ActionType::RUN_COMMAND:
+            emit(ScriptOp::RUN_COMMAND, offset, addString(action.command));
+            break;
+
+        case ActionType::SET_METADATA:
+            for (const auto& pair : action.metadata) {
+                try {
+                    emit(ScriptOp::SET_METADATA, offset, static_cast<uint8_t>(std::stoi(pair.second)));
+                } catch (const std::exception& e) {
+                    Logger::warning() << "Script '" << m_name << "': invalid metadata value for "
+                                      << pair.first << ": " << pair.second << " (" << e.what() << ")";
+                }
+            }
+            break;
+
+        case ActionType::TRIGGER_UPDATE:
+            emit(ScriptOp::TRIGGER_UPDATE, offset, action.delayTicks);
+            break;
+
+        case ActionType::SET_VARIABLE: {
+            const int32_t slot = static_cast<int32_t>(
+                ScriptVariableRegistry::instance().resolveSlot(action.variableName));
+            // Canonical integers are stored as numbers; anything else keeps its text
+            int32_t number = 0;
+            bool isNumber = false;
+            try {
+                number = std::stoi(action.variableValue);
+                isNumber = std::to_string(number) == action.variableValue;
+            } catch (const std::exception&) {
+            }
+            if (isNumber) {
+                emit(ScriptOp::SET_VAR_NUMBER, offset, slot, number);
+            } else {
+                emit(ScriptOp::SET_VAR_TEXT, offset, slot, addString(action.variableValue));
+            }
+            break;
+        }
+
+        case ActionType::GET_VARIABLE:
+            // Only ever logged the value; nothing to run
+            break;
+
+        case ActionType::INCREMENT_VAR:
+        case ActionType::DECREMENT_VAR: {
+            const int32_t slot = static_cast<int32_t>(
+                ScriptVariableRegistry::instance().resolveSlot(action.variableName));
+            const int32_t amount = action.type == ActionType::INCREMENT_VAR
+                ? action.incrementAmount : -action.incrementAmount;
+            emit(ScriptOp::ADD_VAR, offset, slot, amount);
+            break;
+        }
+
+        case ActionType::CONDITIONAL: {
+            size_t test;
+            switch (action.conditionType) {
+                case ConditionType::BLOCK_IS:
+                case ConditionType::BLOCK_IS_NOT: {
+                    const ScriptOp op = action.conditionType == ConditionType::BLOCK_IS
+                        ? ScriptOp::JUMP_UNLESS_BLOCK : ScriptOp::JUMP_UNLESS_NOT_BLOCK;
+                    test = emit(op, offset, -1);
+                    m_blockRefs.push_back({static_cast<uint32_t>(test),
+                                           static_cast<uint32_t>(addString(action.conditionValue)), false});
+                    break;
+                }
+
+                case ConditionType::RANDOM_CHANCE: {
+                    int chance = 0;
+                    try {
+                        chance = std::stoi(action.conditionValue);
+                    } catch (const std::exception&) {
+                        Logger::warning() << "Script '" << m_name << "': invalid random chance value: "
+                                          << action.conditionValue;
+                    }
+                    test = emit(ScriptOp::JUMP_UNLESS_CHANCE, offset, chance);
+                    break;
+                }
+
+                case ConditionType::TIME_IS_DAY:
+                    test = emit(ScriptOp::JUMP_UNLESS_DAY, offset);
+                    break;
+
+                case ConditionType::TIME_IS_NIGHT:
+                default:
+                    test = emit(ScriptOp::JUMP_UNLESS_NIGHT, offset);
+                    break;
+            }
+
+            // Nested actions keep offsets relative to the event position, as before
+            emitActions(action.thenActions);
+            if (action.elseActions.empty()) {
+                patchJump(test);
+            } else {
+                const size_t skipElse = emit(ScriptOp::JUMP, glm::ivec3(0));
+                patchJump(test);
+                emitActions(action.elseActions);
+                patchJump(skipElse);
+            }
+            break;
+        }
+    }
+
+    if (chanceJump != SIZE_MAX) {
+        patchJump(chanceJump);
+    }
+}
+
+void ScriptProgram::link() const {
+    if (m_blockRefs.empty()) {
+        return;
+    }
+
+    auto& registry = BlockRegistry::instance();
+    for (const BlockRef& ref : m_blockRefs) {
+        const std::string& name = m_strings[ref.nameIndex];
+        int blockID = -1;
+        if (ref.exactName) {
+            blockID = registry.getID(name);
+        } else {
+            const std::string wanted = normalizeName(name);
+            for (int id = 0; id < registry.count(); id++) {
+                if (normalizeName(registry.getBlockName(id)) == wanted) {
+                    blockID = id;
+                    break;
+                }
+            }
+        }
+        if (blockID < 0) {
+            Logger::warning() << "Script '" << m_name << "': unknown block name: " << name;
+        }
+        m_code[ref.pc].a = blockID;
+    }
+}
+
+// ============================================================================
+// Interpreter
+// ============================================================================
+
+void ScriptProgram::execute(const glm::ivec3& position) const {
+    std::call_once(m_linkOnce, [this] { link(); });
+
+    auto& api = EngineAPI::instance();
+    auto& variables = ScriptVariableRegistry::instance();
+    const bool engineReady = api.isInitialized();
+
+    const ScriptInstruction* code = m_code.data();
+    const size_t end = m_code.size();
+    size_t pc = 0;
+
+    while (pc < end) {
+        const ScriptInstruction& instruction = code[pc++];
+        const glm::ivec3 target = position + instruction.offset;
+
+        try {
+            switch (instruction.op) {
+                case ScriptOp::PLACE_BLOCK:
+                    if (instruction.a < 0) {
+                        Logger::warning() << "Unknown block name: " << m_strings[instruction.b];
+                    } else if (!engineReady) {
+                        Logger::warning() << "EngineAPI not initialized, cannot place block";
+                    } else if (!api.placeBlock(target, instruction.a)) {
+                        Logger::warning() << "Failed to place block " << m_strings[instruction.b] << " at ("
+                                          << target.x << ", " << target.y << ", " << target.z << ")";
+                    }
+                    break;
+
+                case ScriptOp::BREAK_BLOCK:
+                    if (!engineReady) {
+                        Logger::warning() << "EngineAPI not initialized, cannot break block";
+                    } else if (!api.breakBlock(target)) {
+                        Logger::warning() << "Failed to break block at ("
+                                          << target.x << ", " << target.y << ", " << target.z << ")";
+                    }
+                    break;
+
+                case ScriptOp::SPAWN_STRUCTURE:
+                    if (!engineReady) {
+                        Logger::warning() << "EngineAPI not initialized, cannot spawn structure";
+                    } else if (!api.spawnStructure(m_strings[instruction.a], target)) {
+                        Logger::warning() << "Failed to spawn structure " << m_strings[instruction.a] << " at ("
+                                          << target.x << ", " << target.y << ", " << target.z << ")";
+                    }
+                    break;
+
+                case ScriptOp::SPAWN_PARTICLES: {
+                    if (!engineReady) {
+                        Logger::warning() << "EngineAPI not initialized, cannot spawn particles";
+                        break;
+                    }
+                    // Center of the block
+                    const glm::vec3 particlePos(static_cast<float>(target.x) + 0.5f,
+                                                static_cast<float>(target.y) + 0.5f,
+                                                static_cast<float>(target.z) + 0.5f);
+                    if (!api.spawnParticles(m_strings[instruction.a], particlePos)) {
+                        Logger::warning() << "Failed to spawn particles '" << m_strings[instruction.a] << "' at ("
+                                          << target.x << ", " << target.y << ", " << target.z
+                                          << "): unknown effect name";
+                    }
+                    break;
+                }
+
+                case ScriptOp::PLAY_SOUND:
+                    // TODO: Play sound effect (not yet implemented in EngineAPI)
+                    Logger::info() << "PLAY_SOUND: " << m_strings[instruction.a] << " at ("
+                                   << target.x << ", " << target.y << ", " << target.z << ")";
+                    break;
+
+                case ScriptOp::RUN_COMMAND:
+                    Logger::info() << "RUN_COMMAND: " << m_strings[instruction.a];
+                    if (!CommandRegistry::instance().executeCommand(m_strings[instruction.a])) {
+                        Logger::warning() << "Command failed or not found: " << m_strings[instruction.a];
+                    }
+                    break;
+
+                case ScriptOp::SET_METADATA:
+                    if (!engineReady) {
+                        Logger::warning() << "EngineAPI not initialized, cannot set metadata";
+                    } else if (!api.setBlockMetadata(target, static_cast<uint8_t>(instruction.a))) {
+                        Logger::warning() << "Failed to set metadata at ("
+                                          << target.x << ", " << target.y << ", " << target.z << ")";
+                    }
+                    break;
+
+                case ScriptOp::TRIGGER_UPDATE:
+                    // Schedule a block tick; BlockTickSystem dispatches the BlockUpdateEvent when it's due
+                    if (!engineReady) {
+                        Logger::warning() << "EngineAPI not initialized, cannot trigger update";
+                    } else if (api.getBlockID(target) < 0) {
+                        Logger::warning() << "Failed to trigger update at ("
+                                          << target.x << ", " << target.y << ", " << target.z
+                                          << "): invalid block position";
+                    } else {
+                        // False only if the same tick is already pending (duplicates are merged)
+                        api.scheduleBlockTick(target, static_cast<uint32_t>(instruction.a));
+                    }
+                    break;
+
+                case ScriptOp::SET_VAR_NUMBER:
+                    variables.setSlotNumeric(static_cast<uint32_t>(instruction.a), instruction.b);
+                    break;
+
+                case ScriptOp::SET_VAR_TEXT:
+                    variables.setSlotText(static_cast<uint32_t>(instruction.a), m_strings[instruction.b]);
+                    break;
+
+                case ScriptOp::ADD_VAR:
+                    variables.addToSlot(static_cast<uint32_t>(instruction.a), instruction.b);
+                    break;
+
+                case ScriptOp::JUMP_UNLESS_BLOCK: {
+                    const int blockID = engineReady ? api.getBlockID(target) : -1;
+                    if (blockID < 0 || blockID != instruction.a) {
+                        pc = static_cast<size_t>(instruction.b);
+                    }
+                    break;
+                }
+
+                case ScriptOp::JUMP_UNLESS_NOT_BLOCK: {
+                    // Invalid position counts as "not matching"
+                    bool notMatching = false;
+                    if (engineReady) {
+                        const int blockID = api.getBlockID(target);
+                        notMatching = blockID < 0 || blockID != instruction.a;
+                    }
+                    if (!notMatching) {
+                        pc = static_cast<size_t>(instruction.b);
+                    }
+                    break;
+                }
+
+                case ScriptOp::JUMP_UNLESS_CHANCE:
+                    if (!rollProbability(instruction.a)) {
+                        pc = static_cast<size_t>(instruction.b);
+                    }
+                    break;
+
+                case ScriptOp::JUMP_UNLESS_DAY:
+                case ScriptOp::JUMP_UNLESS_NIGHT: {
+                    bool passed = false;
+                    if (engineReady) {
+                        const float time = api.getTimeOfDay();
+                        passed = instruction.op == ScriptOp::JUMP_UNLESS_DAY
+                            ? (time >= 0.0f && time < DAY_END)
+                            : (time >= DAY_END && time < NIGHT_END);
+                    }
+                    if (!passed) {
+                        pc = static_cast<size_t>(instruction.b);
+                    }
+                    break;
+                }
+
+                case ScriptOp::JUMP:
+                    pc = static_cast<size_t>(instruction.b);
+                    break;
+            }
+        } catch (const std::exception& e) {
+            Logger::warning() << "Error executing script '" << m_name << "': " << e.what();
+            // Continue with the next instruction
+        }
+    }
+}
@@ -0,0 +1,70 @@
+/**
+ * @file startup_timer.cpp
+ * @brief Time-to-first-frame measurement with a per-phase breakdown
+ *
+ * Created: 2025-11-28
+ */
+
+#include "startup_timer.h"
+#include "logger.h"
+#include <iomanip>
+#include <sstream>
+
+StartupTimer& StartupTimer::instance() {
+    static StartupTimer timer;
+    return timer;
+}
+
+StartupTimer::StartupTimer()
+    : m_start(Clock::now())
+    , m_lastMark(m_start) {
+}
+
+void StartupTimer::begin() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_start = Clock::now();
+    m_lastMark = m_start;
+    m_entries.clear();
+    m_reported.store(false, std::memory_order_release);
+}
+
+void StartupTimer::mark(const std::string& phase, const std::string& note) {
+    if (!isActive()) return;
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    Clock::time_point now = Clock::now();
+    double ms = std::chrono::duration<double, std::milli>(now - m_lastMark).count();
+    m_lastMark = now;
+    m_entries.push_back({phase, note, ms, false});
+}
+
+void StartupTimer::detail(const std::string& label, double ms) {
+    if (!isActive()) return;
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_entries.push_back({label, "", ms, true});
+}
+
+void StartupTimer::firstFrame() {
+    if (m_reported.exchange(true, std::memory_order_acq_rel)) return;
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    Clock::time_point now = Clock::now();
+    double total = std::chrono::duration<double, std::milli>(now - m_start).count();
+    double untilFrame = std::chrono::duration<double, std::milli>(now - m_lastMark).count();
+
+    std::ostringstream report;
+    report << std::fixed << std::setprecision(1);
+    report << "Time to first frame: " << total << " ms";
+    auto line = [&](const std::string& label, double ms, bool isDetail, const std::string& note) {
+        report << "\n  " << (isDetail ? "  " : "") << std::left << std::setw(isDetail ? 22 : 24) << label
+               << std::right << std::setw(8) << ms << " ms";
+        if (!note.empty()) report << "   [" << note << "]";
+    };
+    for (const Entry& entry : m_entries) {
+        line(entry.label, entry.ms, entry.isDetail, entry.note);
+    }
+    line("Until first present", untilFrame, false, "");
+
+    Logger::info() << report.str();
+}
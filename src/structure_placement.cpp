@@ -0,0 +1,219 @@
+/**
+ * @file structure_placement.cpp
+ * @brief Generation-time structure layer implementation
+ *
+ * Created: 2025-11-28
+ */
+
+#include "structure_placement.h"
+#include "structure_system.h"
+#include "biome_map.h"
+#include "biome_system.h"
+#include "chunk.h"
+#include "logger.h"
+#include <algorithm>
+#include <limits>
+
+namespace {
+
+/// Floor division (region coordinates of negative world positions round down)
+int floorDiv(int value, int divisor) {
+    int quotient = value / divisor;
+    if ((value % divisor != 0) && ((value < 0) != (divisor < 0))) {
+        quotient--;
+    }
+    return quotient;
+}
+
+/// FNV-1a over the structure name
+uint64_t hashName(const std::string& name) {
+    uint64_t hash = 0xCBF29CE484222325ull;
+    for (char c : name) {
+        hash ^= static_cast<uint8_t>(c);
+        hash *= 0x100000001B3ull;
+    }
+    return hash;
+}
+
+/// Counter-based draws from a region hash (each call is one SplitMix64 step)
+class RegionRandom {
+public:
+    explicit RegionRandom(uint64_t seed) : m_state(seed) {}
+
+    /// Uniform-ish value in [0, bound)
+    int next(uint32_t bound) {
+        m_state += 0x9E3779B97F4A7C15ull;
+        return static_cast<int>(((StructurePlacement::mix64(m_state) >> 32) * bound) >> 32);
+    }
+
+private:
+    uint64_t m_state;
+};
+
+}  // namespace
+
+StructurePlacement::StructurePlacement(int seed, BiomeMap* biomeMap)
+    : m_seed(mix64(static_cast<uint64_t>(static_cast<uint32_t>(seed)) + 55555)), m_biomeMap(biomeMap) {
+}
+
+uint64_t StructurePlacement::mix64(uint64_t value) {
+    value ^= value >> 30;
+    value *= 0xBF58476D1CE4E5B9ull;
+    value ^= value >> 27;
+    value *= 0x94D049BB133111EBull;
+    value ^= value >> 31;
+    return value;
+}
+
+void StructurePlacement::addStructures(const std::vector<const StructureDefinition*>& definitions) {
+    for (const StructureDefinition* def : definitions) {
+        if (!def || !def->generation.enabled || def->variations.empty()) continue;
+
+        Entry entry;
+        entry.salt = hashName(def->name);
+
+        // Names, not Biome pointers: they stay meaningful across `reload biomes`
+        for (const std::string& biomeName : def->generation.biomes) {
+            const Biome* biome = BiomeRegistry::getInstance().getBiome(biomeName);
+            if (biome) {
+                entry.biomes.push_back(biome->name);
+            } else {
+                Logger::warning() << "StructurePlacement: Structure '" << def->name
+                                 << "' lists unknown biome '" << biomeName << "'";
+            }
+        }
+        if (!def->generation.biomes.empty() && entry.biomes.empty()) {
+            Logger::warning() << "StructurePlacement: Structure '" << def->name
+                             << "' has no valid biomes, skipping";
+            continue;
+        }
+
+        // Own copy: sites and workers never point into the registry
+        entry.definition = std::make_shared<const StructureDefinition>(*def);
+
+        // Reach of every variation around the site center, for chunk -> region queries
+        entry.reachMin = glm::ivec3(std::numeric_limits<int>::max());
+        entry.reachMax = glm::ivec3(std::numeric_limits<int>::min());
+        for (const StructureVariation& var : entry.definition->variations) {
+            if (var.compiled.empty()) continue;
+            const glm::ivec3 corner(-(var.length / 2), -var.depth, -(var.width / 2));
+            entry.reachMin = glm::min(entry.reachMin, corner + var.compiled.getMin());
+            entry.reachMax = glm::max(entry.reachMax, corner + var.compiled.getMax());
+        }
+        if (entry.reachMin.x > entry.reachMax.x) continue;  // Every variation is empty
+
+        Logger::info() << "StructurePlacement: '" << def->name << "' every " << def->generation.regionSize
+                      << " blocks (chance " << def->generation.chance << "%)";
+        m_structures.push_back(std::move(entry));
+    }
+}
+
+bool StructurePlacement::rollCandidate(const Entry& entry, int regionX, int regionZ, Candidate& candidate) const {
+    const StructureGenerationRule& rule = entry.definition->generation;
+
+    RegionRandom random(mix64(m_seed ^ entry.salt
+                              ^ static_cast<uint64_t>(static_cast<uint32_t>(regionX)) * 0x9E3779B97F4A7C15ull
+                              ^ static_cast<uint64_t>(static_cast<uint32_t>(regionZ)) * 0xC2B2AE3D27D4EB4Full));
+
+    // Draw order is fixed so a region always resolves the same way
+    if (random.next(100) >= rule.chance) return false;
+
+    const int margin = rule.separation / 2;
+    const int range = std::max(1, rule.regionSize - 2 * margin);
+    candidate.centerX = regionX * rule.regionSize + margin + random.next(static_cast<uint32_t>(range));
+    candidate.centerZ = regionZ * rule.regionSize + margin + random.next(static_cast<uint32_t>(range));
+    candidate.variation = StructureRegistry::pickVariation(*entry.definition, random.next(100));
+    candidate.activityRoll = random.next(100);
+
+    return candidate.variation && !candidate.variation->compiled.empty();
+}
+
+bool StructurePlacement::testCandidate(const Entry& entry, const Candidate& candidate, Site& site) const {
+    const StructureDefinition& def = *entry.definition;
+    const float worldX = static_cast<float>(candidate.centerX);
+    const float worldZ = static_cast<float>(candidate.centerZ);
+
+    const Biome* biome = m_biomeMap->getBiomeAt(worldX, worldZ);
+    if (!biome || candidate.activityRoll >= biome->activity) return false;
+    if (!entry.biomes.empty() &&
+        std::find(entry.biomes.begin(), entry.biomes.end(), biome->name) == entry.biomes.end()) {
+        return false;
+    }
+    if (std::find(biome->blacklisted_structures.begin(), biome->blacklisted_structures.end(), def.name) !=
+        biome->blacklisted_structures.end()) {
+        return false;
+    }
+
+    const int groundY = m_biomeMap->getTerrainHeightAt(worldX, worldZ);
+    if (groundY < def.generation.minHeight || groundY > def.generation.maxHeight) return false;
+
+    // Same anchoring as spawnStructure(): center column, bottom layer `depth` below ground
+    const StructureVariation& var = *candidate.variation;
+    site.definition = &def;
+    site.variation = &var;
+    site.origin = glm::ivec3(candidate.centerX - var.length / 2, groundY + 1 - var.depth,
+                             candidate.centerZ - var.width / 2);
+    return true;
+}
+
+bool StructurePlacement::resolveSite(size_t structureIndex, int regionX, int regionZ, Site& site) const {
+    if (structureIndex >= m_structures.size()) return false;
+    const Entry& entry = m_structures[structureIndex];
+
+    Candidate candidate;
+    return rollCandidate(entry, regionX, regionZ, candidate) && testCandidate(entry, candidate, site);
+}
+
+void StructurePlacement::findSites(int chunkX, int chunkY, int chunkZ, std::vector<Site>& sites) const {
+    const glm::ivec3 chunkMin(chunkX * Chunk::WIDTH, chunkY * Chunk::HEIGHT, chunkZ * Chunk::DEPTH);
+    const glm::ivec3 chunkMax = chunkMin + glm::ivec3(Chunk::WIDTH, Chunk::HEIGHT, Chunk::DEPTH);
+
+    for (const Entry& entry : m_structures) {
+        const int regionSize = entry.definition->generation.regionSize;
+
+        // Site centers whose reach can touch this chunk: (chunkMin - reachMax, chunkMax - reachMin)
+        const int regionX0 = floorDiv(chunkMin.x - entry.reachMax.x + 1, regionSize);
+        const int regionX1 = floorDiv(chunkMax.x - entry.reachMin.x - 1, regionSize);
+        const int regionZ0 = floorDiv(chunkMin.z - entry.reachMax.z + 1, regionSize);
+        const int regionZ1 = floorDiv(chunkMax.z - entry.reachMin.z - 1, regionSize);
+
+        for (int regionX = regionX0; regionX <= regionX1; regionX++) {
+            for (int regionZ = regionZ0; regionZ <= regionZ1; regionZ++) {
+                Candidate candidate;
+                if (!rollCandidate(entry, regionX, regionZ, candidate)) continue;
+
+                // Exact XZ test before touching the BiomeMap
+                const StructureVariation& var = *candidate.variation;
+                const int originX = candidate.centerX - var.length / 2;
+                const int originZ = candidate.centerZ - var.width / 2;
+                if (originX + var.compiled.getMin().x >= chunkMax.x || originX + var.compiled.getMax().x <= chunkMin.x ||
+                    originZ + var.compiled.getMin().z >= chunkMax.z || originZ + var.compiled.getMax().z <= chunkMin.z) {
+                    continue;
+                }
+
+                Site site;
+                if (!testCandidate(entry, candidate, site)) continue;
+                if (site.origin.y + var.compiled.getMin().y >= chunkMax.y ||
+                    site.origin.y + var.compiled.getMax().y <= chunkMin.y) {
+                    continue;
+                }
+                sites.push_back(site);
+            }
+        }
+    }
+}
+
+int StructurePlacement::placeInChunk(Chunk* chunk) const {
+    if (!chunk || m_structures.empty()) return 0;
+
+    std::vector<Site> sites;
+    findSites(chunk->getChunkX(), chunk->getChunkY(), chunk->getChunkZ(), sites);
+
+    const glm::ivec3 chunkOrigin(chunk->getChunkX() * Chunk::WIDTH, chunk->getChunkY() * Chunk::HEIGHT,
+                                 chunk->getChunkZ() * Chunk::DEPTH);
+    int written = 0;
+    for (const Site& site : sites) {
+        written += chunk->blitTemplate(site.variation->compiled, site.origin - chunkOrigin);
+    }
+    return written;
+}
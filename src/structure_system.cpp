@@ -15,8 +15,9 @@
 #include "chunk.h"
 #include "vulkan_renderer.h"
 #include "logger.h"
+#include "asset_pipeline.h"
+#include <algorithm>
 #include <filesystem>
-#include <set>
 #include <yaml-cpp/yaml.h>
 
 StructureRegistry& StructureRegistry::instance() {
@@ -63,10 +64,18 @@ bool StructureRegistry::loadStructures(const std::string& directory) {
         return true;  // Not an error
     }
 
+    // PERFORMANCE (2025-11-28): Parse all files in parallel, then build definitions in file order
+    std::vector<AssetPipeline::ParsedYaml> parsedFiles = AssetPipeline::loadYamlFiles(yamlFiles);
+
     // Load each structure file
-    for (const auto& path : yamlFiles) {
+    for (const auto& parsed : parsedFiles) {
+        const fs::path& path = parsed.path;
         try {
-            YAML::Node doc = YAML::LoadFile(path.string());
+            if (!parsed.error.empty()) {
+                Logger::error() << "Error loading structure from " << path.string() << ": " << parsed.error;
+                continue;
+            }
+            YAML::Node doc = parsed.doc;
 
             if (!doc["name"]) {
                 Logger::error() << "Structure missing 'name' in " << path.string();
@@ -168,10 +177,32 @@ bool StructureRegistry::loadStructures(const std::string& directory) {
                                      << " but structure has " << var.structure.size() << " layers";
                 }
 
-                structDef.variations.push_back(var);
+                var.compiled = StructureTemplate::fromLayers(var.structure);
+
                 Logger::debug() << "  Loaded variation " << i << " for '" << structDef.name
                                << "' (" << var.length << "x" << var.width << "x" << var.height
-                               << ", chance=" << var.chance << "%)";
+                               << ", chance=" << var.chance << "%, " << var.compiled.getBlockCount()
+                               << " blocks in " << var.compiled.getSpanCount() << " spans)";
+                structDef.variations.push_back(std::move(var));
+            }
+
+            // Optional world generation rule
+            if (YAML::Node genNode = doc["generation"]) {
+                StructureGenerationRule& rule = structDef.generation;
+                rule.enabled = true;
+                if (genNode["region_size"]) rule.regionSize = genNode["region_size"].as<int>();
+                if (genNode["separation"]) rule.separation = genNode["separation"].as<int>();
+                if (genNode["chance"]) rule.chance = genNode["chance"].as<int>();
+                if (genNode["min_height"]) rule.minHeight = genNode["min_height"].as<int>();
+                if (genNode["max_height"]) rule.maxHeight = genNode["max_height"].as<int>();
+                if (genNode["biomes"]) rule.biomes = genNode["biomes"].as<std::vector<std::string>>();
+
+                if (rule.regionSize < 16 || rule.separation < 0 || rule.separation >= rule.regionSize) {
+                    Logger::error() << "Structure '" << structDef.name << "' has invalid generation region_size="
+                                   << rule.regionSize << ", separation=" << rule.separation
+                                   << " (need region_size >= 16 and 0 <= separation < region_size)";
+                    rule.enabled = false;
+                }
             }
 
             // Validate total chance
@@ -206,19 +237,21 @@ const StructureDefinition* StructureRegistry::get(const std::string& name) const
 }
 
 const StructureVariation* StructureRegistry::selectVariation(const StructureDefinition& def) {
-    if (def.variations.empty()) {
-        return nullptr;
-    }
-
-    // If only one variation, return it
+    // If only one variation, return it without consuming a roll
     if (def.variations.size() == 1) {
         return &def.variations[0];
     }
 
-    // Random selection based on weighted chances
-    int roll = m_dist(m_rng);  // 0-99
-    int cumulative = 0;
+    return pickVariation(def, m_dist(m_rng));  // 0-99
+}
 
+const StructureVariation* StructureRegistry::pickVariation(const StructureDefinition& def, int roll) {
+    if (def.variations.empty()) {
+        return nullptr;
+    }
+
+    // Weighted selection based on chances
+    int cumulative = 0;
     for (const auto& var : def.variations) {
         cumulative += var.chance;
         if (roll < cumulative) {
@@ -261,45 +294,10 @@ bool StructureRegistry::spawnStructure(const std::string& name, World* world, co
     startPos.z -= halfWidth;
     startPos.y -= var->depth;  // Go down by depth amount
 
-    // Track all affected chunks for mesh regeneration
-    std::set<Chunk*> affectedChunks;
-
-    // Place blocks layer by layer
-    const int structureHeight = static_cast<int>(var->structure.size());
-    for (int y = 0; y < structureHeight; y++) {
-        const auto& layer = var->structure[y];
-        const int layerDepth = static_cast<int>(layer.size());
-
-        for (int z = 0; z < layerDepth; z++) {
-            const auto& row = layer[z];
-            const int rowWidth = static_cast<int>(row.size());
-
-            for (int x = 0; x < rowWidth; x++) {
-                int blockID = row[x];
-
-                // Skip air blocks (ID 0)
-                if (blockID == 0) {
-                    continue;
-                }
-
-                glm::ivec3 blockPos = startPos + glm::ivec3(x, y, z);
-
-                // Place the block in the world
-                // Convert block coordinates to world coordinates (blocks are 1.0 units)
-                float worldX = static_cast<float>(blockPos.x);
-                float worldY = static_cast<float>(blockPos.y);
-                float worldZ = static_cast<float>(blockPos.z);
-
-                world->setBlockAt(worldX, worldY, worldZ, blockID);
-
-                // Track the affected chunk
-                Chunk* chunk = world->getChunkAtWorldPos(worldX, worldY, worldZ);
-                if (chunk) {
-                    affectedChunks.insert(chunk);
-                }
-            }
-        }
-    }
+    // PERFORMANCE (2025-11-28): Blit the precompiled spans chunk by chunk instead of
+    // one setBlockAt() per voxel; only chunks that received blocks are returned
+    std::vector<Chunk*> affectedChunks;
+    world->placeTemplate(var->compiled, startPos, &affectedChunks);
 
     // Regenerate meshes and GPU buffers for all affected chunks
     if (renderer) {
@@ -318,6 +316,21 @@ bool StructureRegistry::spawnStructure(const std::string& name, World* world, co
     return true;
 }
 
+std::vector<const StructureDefinition*> StructureRegistry::getGeneratedStructures() const {
+    std::vector<const StructureDefinition*> result;
+    for (const auto& pair : m_structures) {
+        if (pair.second.generation.enabled) {
+            result.push_back(&pair.second);
+        }
+    }
+
+    // Map order is unspecified; blit order must not depend on it
+    std::sort(result.begin(), result.end(), [](const StructureDefinition* a, const StructureDefinition* b) {
+        return a->name < b->name;
+    });
+    return result;
+}
+
 std::vector<std::string> StructureRegistry::getAllStructureNames() const {
     std::vector<std::string> names;
     names.reserve(m_structures.size());
@@ -0,0 +1,107 @@
+/**
+ * @file structure_template.cpp
+ * @brief StructureTemplate compilation
+ *
+ * Created: 2025-11-28
+ */
+
+#include "structure_template.h"
+#include <algorithm>
+#include <limits>
+
+StructureTemplate StructureTemplate::fromLayers(const std::vector<std::vector<std::vector<int>>>& layers) {
+    std::vector<Voxel> voxels;
+    for (size_t y = 0; y < layers.size(); y++) {
+        for (size_t z = 0; z < layers[y].size(); z++) {
+            const std::vector<int>& row = layers[y][z];
+            for (size_t x = 0; x < row.size(); x++) {
+                if (row[x] != 0) {
+                    voxels.push_back({glm::ivec3(static_cast<int>(x), static_cast<int>(y), static_cast<int>(z)), row[x]});
+                }
+            }
+        }
+    }
+
+    StructureTemplate result;
+    result.build(voxels);
+    return result;
+}
+
+StructureTemplate StructureTemplate::fromVoxels(std::vector<Voxel> voxels) {
+    StructureTemplate result;
+    result.build(voxels);
+    return result;
+}
+
+void StructureTemplate::build(std::vector<Voxel>& voxels) {
+    // Slice order (y, then x, then z); stable so duplicates keep their list order
+    std::stable_sort(voxels.begin(), voxels.end(), [](const Voxel& a, const Voxel& b) {
+        if (a.pos.y != b.pos.y) return a.pos.y < b.pos.y;
+        if (a.pos.x != b.pos.x) return a.pos.x < b.pos.x;
+        return a.pos.z < b.pos.z;
+    });
+
+    // Last write wins for repeated positions, then drop air
+    std::vector<Voxel> unique;
+    unique.reserve(voxels.size());
+    for (size_t i = 0; i < voxels.size(); i++) {
+        const bool lastOfPosition = i + 1 == voxels.size() ||
+            voxels[i + 1].pos.x != voxels[i].pos.x ||
+            voxels[i + 1].pos.y != voxels[i].pos.y ||
+            voxels[i + 1].pos.z != voxels[i].pos.z;
+        if (lastOfPosition && voxels[i].blockID != 0) {
+            unique.push_back(voxels[i]);
+        }
+    }
+
+    m_spans.clear();
+    m_sliceStart.clear();
+    m_blockCount = unique.size();
+    if (unique.empty()) {
+        m_min = m_max = glm::ivec3(0);
+        m_sliceStart.push_back(0);
+        return;
+    }
+
+    m_min = glm::ivec3(std::numeric_limits<int>::max());
+    m_max = glm::ivec3(std::numeric_limits<int>::min());
+    for (const Voxel& voxel : unique) {
+        m_min.x = std::min(m_min.x, voxel.pos.x);
+        m_min.y = std::min(m_min.y, voxel.pos.y);
+        m_min.z = std::min(m_min.z, voxel.pos.z);
+        m_max.x = std::max(m_max.x, voxel.pos.x + 1);
+        m_max.y = std::max(m_max.y, voxel.pos.y + 1);
+        m_max.z = std::max(m_max.z, voxel.pos.z + 1);
+    }
+
+    // Merge consecutive Z neighbours with the same ID into spans
+    const int sliceCount = m_max.y - m_min.y;
+    m_sliceStart.assign(static_cast<size_t>(sliceCount) + 1, 0);
+    int currentSlice = 0;
+    for (const Voxel& voxel : unique) {
+        const int slice = voxel.pos.y - m_min.y;
+        while (currentSlice < slice) {
+            m_sliceStart[++currentSlice] = static_cast<uint32_t>(m_spans.size());
+        }
+
+        if (!m_spans.empty() && m_sliceStart[slice] < m_spans.size()) {
+            TemplateSpan& last = m_spans.back();
+            if (last.x == voxel.pos.x && last.blockID == voxel.blockID &&
+                last.z + last.length == voxel.pos.z &&
+                last.length < std::numeric_limits<uint16_t>::max()) {
+                last.length++;
+                continue;
+            }
+        }
+
+        TemplateSpan span;
+        span.blockID = voxel.blockID;
+        span.x = static_cast<int16_t>(voxel.pos.x);
+        span.z = static_cast<int16_t>(voxel.pos.z);
+        span.length = 1;
+        m_spans.push_back(span);
+    }
+    while (currentSlice < sliceCount) {
+        m_sliceStart[++currentSlice] = static_cast<uint32_t>(m_spans.size());
+    }
+}
@@ -0,0 +1,134 @@
+/**
+ * @file texture_array.cpp
+ * @brief Layer packing and offline mip generation for the block texture array
+ *
+ * Created: 2025-11-28
+ */
+
+#include "texture_array.h"
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+namespace TextureArray {
+
+namespace {
+
+/// sRGB byte -> linear light
+const std::array<float, 256>& srgbToLinear() {
+    static const std::array<float, 256> table = [] {
+        std::array<float, 256> result{};
+        for (int i = 0; i < 256; i++) {
+            const float c = static_cast<float>(i) / 255.0f;
+            result[i] = (c <= 0.04045f) ? c / 12.92f : std::pow((c + 0.055f) / 1.055f, 2.4f);
+        }
+        return result;
+    }();
+    return table;
+}
+
+uint8_t linearToSrgb(float linear) {
+    linear = std::clamp(linear, 0.0f, 1.0f);
+    const float c = (linear <= 0.0031308f) ? linear * 12.92f : 1.055f * std::pow(linear, 1.0f / 2.4f) - 0.055f;
+    return static_cast<uint8_t>(std::lround(c * 255.0f));
+}
+
+}  // namespace
+
+LayerPlan planLayers(const std::vector<int>& refSources, const std::vector<uint8_t>& loaded) {
+    LayerPlan plan;
+    plan.sourceLayers.assign(loaded.size(), -1);
+    plan.refLayers.assign(refSources.size(), -1);
+
+    for (size_t ref = 0; ref < refSources.size(); ref++) {
+        const int source = refSources[ref];
+        if (source < 0 || source >= static_cast<int>(loaded.size()) || !loaded[source]) continue;
+
+        if (plan.sourceLayers[source] < 0) {
+            if (static_cast<int>(plan.layerSources.size()) < MAX_LAYERS) {
+                plan.sourceLayers[source] = static_cast<int>(plan.layerSources.size());
+                plan.layerSources.push_back(source);
+            } else {
+                plan.sourceLayers[source] = 0;
+                plan.droppedSources.push_back(source);
+            }
+        }
+        plan.refLayers[ref] = plan.sourceLayers[source];
+    }
+    return plan;
+}
+
+int chooseLayerSize(const std::vector<int>& sourceEdges) {
+    int largest = 0;
+    for (int edge : sourceEdges) largest = std::max(largest, edge);
+
+    int size = LAYER_SIZE_MIN;
+    while (size < largest && size < LAYER_SIZE_MAX) {
+        size *= 2;
+    }
+    return size;
+}
+
+int mipLevelCount(int layerSize) {
+    int levels = 1;
+    while (layerSize > 1) {
+        layerSize >>= 1;
+        levels++;
+    }
+    return levels;
+}
+
+size_t mipOffset(int layerSize, int level) {
+    size_t offset = 0;
+    for (int i = 0; i < level; i++) {
+        const size_t edge = static_cast<size_t>(std::max(1, layerSize >> i));
+        offset += edge * edge * 4;
+    }
+    return offset;
+}
+
+size_t layerBytes(int layerSize) {
+    return mipOffset(layerSize, mipLevelCount(layerSize));
+}
+
+void buildMipChain(uint8_t* chain, int layerSize) {
+    const std::array<float, 256>& toLinear = srgbToLinear();
+    const int levels = mipLevelCount(layerSize);
+
+    for (int level = 1; level < levels; level++) {
+        const int srcSize = layerSize >> (level - 1);
+        const int dstSize = layerSize >> level;
+        const uint8_t* src = chain + mipOffset(layerSize, level - 1);
+        uint8_t* dst = chain + mipOffset(layerSize, level);
+
+        for (int y = 0; y < dstSize; y++) {
+            for (int x = 0; x < dstSize; x++) {
+                float rgb[3] = {0.0f, 0.0f, 0.0f};
+                float plainRgb[3] = {0.0f, 0.0f, 0.0f};
+                float alphaSum = 0.0f;
+                for (int dy = 0; dy < 2; dy++) {
+                    const uint8_t* row = src + (static_cast<size_t>(y * 2 + dy) * srcSize + x * 2) * 4;
+                    for (int dx = 0; dx < 2; dx++) {
+                        const uint8_t* texel = row + dx * 4;
+                        const float alpha = static_cast<float>(texel[3]) / 255.0f;
+                        for (int c = 0; c < 3; c++) {
+                            const float linear = toLinear[texel[c]];
+                            rgb[c] += linear * alpha;
+                            plainRgb[c] += linear;
+                        }
+                        alphaSum += alpha;
+                    }
+                }
+
+                // Fully transparent blocks keep their (invisible) color instead of going black
+                uint8_t* out = dst + (static_cast<size_t>(y) * dstSize + x) * 4;
+                for (int c = 0; c < 3; c++) {
+                    out[c] = linearToSrgb(alphaSum > 0.0f ? rgb[c] / alphaSum : plainRgb[c] * 0.25f);
+                }
+                out[3] = static_cast<uint8_t>(std::lround(alphaSum * 0.25f * 255.0f));
+            }
+        }
+    }
+}
+
+}  // namespace TextureArray
@@ -42,6 +42,14 @@ void TreeGenerator::generateTreeTemplatesForBiome(Biome* biome) {
             generateLargeTree(tree, logBlockID, leavesBlockID);
         }
 
+        // Later entries win where branches overlap the canopy, as with per-block placement
+        std::vector<StructureTemplate::Voxel> voxels;
+        voxels.reserve(tree.blocks.size());
+        for (const TreeBlock& block : tree.blocks) {
+            voxels.push_back({block.offset, block.blockID});
+        }
+        tree.compiled = StructureTemplate::fromVoxels(std::move(voxels));
+
         biome->tree_templates.push_back(std::move(tree));
     }
 }
@@ -59,41 +67,17 @@ bool TreeGenerator::placeTree(World* world, int blockX, int blockY, int blockZ,
 
     const TreeTemplate& tree = biome->tree_templates[treeType];
 
-    // Check if there's enough space (don't replace existing blocks except air/grass)
-    for (const auto& block : tree.blocks) {
-        int bx = blockX + block.offset.x;
-        int by = blockY + block.offset.y;
-        int bz = blockZ + block.offset.z;
-
-        // Convert block coordinates to world coordinates (1 block = 1.0 world units)
-        float worldX = static_cast<float>(bx);
-        float worldY = static_cast<float>(by);
-        float worldZ = static_cast<float>(bz);
-
-        int existingBlock = world->getBlockAt(worldX, worldY, worldZ);
-
-        // Allow placing over air and grass
-        if (existingBlock != TerrainGeneration::BLOCK_AIR &&
-            existingBlock != TerrainGeneration::BLOCK_GRASS) {
-            return false;  // Can't place tree here
-        }
-    }
-
-    // Place all tree blocks (deferred mesh regeneration for performance)
-    for (const auto& block : tree.blocks) {
-        int bx = blockX + block.offset.x;
-        int by = blockY + block.offset.y;
-        int bz = blockZ + block.offset.z;
+    // PERFORMANCE (2025-11-28): Check and place the compiled spans per chunk instead of
+    // a getBlockAt() + setBlockAt() per tree block
+    const glm::ivec3 base(blockX, blockY, blockZ);
 
-        // Convert block coordinates to world coordinates
-        float worldX = static_cast<float>(bx);
-        float worldY = static_cast<float>(by);
-        float worldZ = static_cast<float>(bz);
-
-        // Don't regenerate mesh for each block - will batch regenerate in decorateWorld()
-        world->setBlockAt(worldX, worldY, worldZ, block.blockID, false);
+    // Check if there's enough space (don't replace existing blocks except air/grass)
+    if (!world->isTemplateClear(tree.compiled, base, TerrainGeneration::BLOCK_GRASS)) {
+        return false;  // Can't place tree here
     }
 
+    // Chunks are only marked dirty - will batch regenerate meshes in decorateWorld()
+    world->placeTemplate(tree.compiled, base);
     return true;
 }
 
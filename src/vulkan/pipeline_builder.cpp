@@ -285,6 +285,11 @@ PipelineBuilder& PipelineBuilder::setPipelineLayout(VkPipelineLayout layout) {
     return *this;
 }
 
+PipelineBuilder& PipelineBuilder::setPipelineCache(VkPipelineCache cache) {
+    m_pipelineCache = cache;
+    return *this;
+}
+
 // ========== Dynamic State ==========
 
 PipelineBuilder& PipelineBuilder::setDynamicViewport() {
@@ -398,7 +403,7 @@ VkPipeline PipelineBuilder::build(VkPipelineLayout* outLayout) {
     pipelineInfo.basePipelineHandle = VK_NULL_HANDLE;
 
     VkPipeline pipeline;
-    if (vkCreateGraphicsPipelines(m_device, VK_NULL_HANDLE, 1, &pipelineInfo,
+    if (vkCreateGraphicsPipelines(m_device, m_pipelineCache, 1, &pipelineInfo,
                                    nullptr, &pipeline) != VK_SUCCESS) {
         throw std::runtime_error("PipelineBuilder: failed to create graphics pipeline!");
     }
@@ -0,0 +1,168 @@
+/**
+ * @file pipeline_cache.cpp
+ * @brief Disk-backed VkPipelineCache: load, validate, save
+ *
+ * Created: 2025-11-28
+ */
+
+#include "vulkan/pipeline_cache.h"
+#include "asset_pipeline.h"
+#include "logger.h"
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+
+namespace {
+
+constexpr uint32_t CACHE_FILE_MAGIC = 0x31435056;  // "VPC1"
+constexpr uint32_t CACHE_FILE_VERSION = 1;
+
+/**
+ * @brief Header written in front of the driver's cache blob
+ */
+struct CacheFileHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t vendorID;
+    uint32_t deviceID;
+    uint32_t driverVersion;
+    uint32_t padding;
+    uint8_t uuid[VK_UUID_SIZE];
+    uint64_t dataSize;
+    uint64_t checksum;  ///< AssetPipeline::hashBytes() (FNV-1a) over the blob
+};
+
+}  // namespace
+
+PipelineCache::PipelineCache(VkDevice device, VkPhysicalDevice physicalDevice, const std::string& path)
+    : m_device(device)
+    , m_path(path)
+{
+    VkPhysicalDeviceProperties props;
+    vkGetPhysicalDeviceProperties(physicalDevice, &props);
+    m_vendorID = props.vendorID;
+    m_deviceID = props.deviceID;
+    m_driverVersion = props.driverVersion;
+    std::memcpy(m_uuid, props.pipelineCacheUUID, VK_UUID_SIZE);
+
+    std::vector<char> initialData = loadFile();
+
+    VkPipelineCacheCreateInfo createInfo{};
+    createInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+    createInfo.initialDataSize = initialData.size();
+    createInfo.pInitialData = initialData.empty() ? nullptr : initialData.data();
+
+    VkResult result = vkCreatePipelineCache(m_device, &createInfo, nullptr, &m_cache);
+    if (result != VK_SUCCESS && !initialData.empty()) {
+        // Driver rejected data that passed our checks - start empty rather than fail
+        Logger::warning() << "Pipeline cache rejected by driver, starting empty";
+        createInfo.initialDataSize = 0;
+        createInfo.pInitialData = nullptr;
+        initialData.clear();
+        result = vkCreatePipelineCache(m_device, &createInfo, nullptr, &m_cache);
+    }
+    if (result != VK_SUCCESS) {
+        throw std::runtime_error("failed to create pipeline cache!");
+    }
+
+    m_loaded = !initialData.empty();
+    m_loadedSize = initialData.size();
+    if (m_loaded) {
+        Logger::info() << "Pipeline cache loaded (" << (m_loadedSize / 1024) << " KB)";
+    } else {
+        Logger::info() << "Pipeline cache empty, pipelines will be compiled from scratch";
+    }
+}
+
+PipelineCache::~PipelineCache() {
+    if (m_cache != VK_NULL_HANDLE) {
+        save();
+        vkDestroyPipelineCache(m_device, m_cache, nullptr);
+        m_cache = VK_NULL_HANDLE;
+    }
+}
+
+std::vector<char> PipelineCache::loadFile() const {
+    std::ifstream file(m_path, std::ios::binary | std::ios::ate);
+    if (!file.is_open()) {
+        return {};
+    }
+
+    const std::streamoff fileSize = file.tellg();
+    if (fileSize < static_cast<std::streamoff>(sizeof(CacheFileHeader))) {
+        Logger::warning() << "Pipeline cache file truncated, ignoring: " << m_path;
+        return {};
+    }
+    file.seekg(0);
+
+    CacheFileHeader header{};
+    file.read(reinterpret_cast<char*>(&header), sizeof(header));
+    if (header.magic != CACHE_FILE_MAGIC || header.version != CACHE_FILE_VERSION) {
+        Logger::warning() << "Pipeline cache file has unknown format, ignoring: " << m_path;
+        return {};
+    }
+    if (header.vendorID != m_vendorID || header.deviceID != m_deviceID ||
+        header.driverVersion != m_driverVersion || std::memcmp(header.uuid, m_uuid, VK_UUID_SIZE) != 0) {
+        Logger::info() << "Pipeline cache built for a different GPU or driver, discarding";
+        return {};
+    }
+    if (header.dataSize != static_cast<uint64_t>(fileSize) - sizeof(header)) {
+        Logger::warning() << "Pipeline cache file size mismatch, ignoring: " << m_path;
+        return {};
+    }
+
+    std::vector<char> data(static_cast<size_t>(header.dataSize));
+    file.read(data.data(), static_cast<std::streamsize>(data.size()));
+    if (!file || AssetPipeline::hashBytes(data.data(), data.size()) != header.checksum) {
+        Logger::warning() << "Pipeline cache file corrupt, ignoring: " << m_path;
+        return {};
+    }
+
+    // The driver's own blob header (VkPipelineCacheHeaderVersionOne) must agree as well
+    VkPipelineCacheHeaderVersionOne blobHeader{};
+    if (data.size() < sizeof(blobHeader)) {
+        return {};
+    }
+    std::memcpy(&blobHeader, data.data(), sizeof(blobHeader));
+    if (blobHeader.headerVersion != VK_PIPELINE_CACHE_HEADER_VERSION_ONE ||
+        blobHeader.vendorID != m_vendorID || blobHeader.deviceID != m_deviceID ||
+        std::memcmp(blobHeader.pipelineCacheUUID, m_uuid, VK_UUID_SIZE) != 0) {
+        Logger::info() << "Pipeline cache blob header mismatch, discarding";
+        return {};
+    }
+
+    return data;
+}
+
+bool PipelineCache::save() {
+    if (m_cache == VK_NULL_HANDLE) {
+        return false;
+    }
+
+    size_t dataSize = 0;
+    if (vkGetPipelineCacheData(m_device, m_cache, &dataSize, nullptr) != VK_SUCCESS || dataSize == 0) {
+        return false;
+    }
+    std::vector<char> data(dataSize);
+    if (vkGetPipelineCacheData(m_device, m_cache, &dataSize, data.data()) != VK_SUCCESS) {
+        return false;
+    }
+    data.resize(dataSize);
+
+    CacheFileHeader header{};
+    header.magic = CACHE_FILE_MAGIC;
+    header.version = CACHE_FILE_VERSION;
+    header.vendorID = m_vendorID;
+    header.deviceID = m_deviceID;
+    header.driverVersion = m_driverVersion;
+    std::memcpy(header.uuid, m_uuid, VK_UUID_SIZE);
+    header.dataSize = data.size();
+    header.checksum = AssetPipeline::hashBytes(data.data(), data.size());
+
+    // Temp file + rename, so a crash mid-write never leaves a torn cache
+    if (!AssetPipeline::writeFileAtomic(m_path, {{&header, sizeof(header)}, {data.data(), data.size()}})) {
+        Logger::warning() << "Failed to write pipeline cache: " << m_path;
+        return false;
+    }
+    return true;
+}
@@ -101,12 +101,13 @@ SkyboxRenderer& SkyboxRenderer::operator=(SkyboxRenderer&& other) noexcept {
 // ============================================================================
 
 void SkyboxRenderer::initialize(VkRenderPass renderPass, VkPipelineLayout pipelineLayout,
-                                VkExtent2D extent) {
+                                VkExtent2D extent, VkPipelineCache pipelineCache) {
     if (m_initialized) {
         return;
     }
 
     m_pipelineLayout = pipelineLayout;
+    m_pipelineCache = pipelineCache;
 
     // Generate procedural cubemaps
     createProceduralDayCubeMap();
@@ -262,6 +263,7 @@ void SkyboxRenderer::createPipeline(VkRenderPass renderPass, VkExtent2D extent)
         .setDepthTest(false, VK_COMPARE_OP_LESS_OR_EQUAL)  // Skybox at max depth
         .setNoBlending()
         .setPipelineLayout(m_pipelineLayout)
+        .setPipelineCache(m_pipelineCache)
         .build();
     builder.destroyShaderModules();
 
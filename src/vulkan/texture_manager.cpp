@@ -58,14 +58,21 @@ void TextureManager::createImage(uint32_t width, uint32_t height, VkFormat forma
                                   VkImageTiling tiling, VkImageUsageFlags usage,
                                   VkMemoryPropertyFlags properties,
                                   VkImage& image, VkDeviceMemory& imageMemory) {
+    createImage(width, height, 1, 1, format, tiling, usage, properties, image, imageMemory);
+}
+
+void TextureManager::createImage(uint32_t width, uint32_t height, uint32_t mipLevels, uint32_t arrayLayers,
+                                  VkFormat format, VkImageTiling tiling, VkImageUsageFlags usage,
+                                  VkMemoryPropertyFlags properties,
+                                  VkImage& image, VkDeviceMemory& imageMemory) {
     VkImageCreateInfo imageInfo{};
     imageInfo.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
     imageInfo.imageType = VK_IMAGE_TYPE_2D;
     imageInfo.extent.width = width;
     imageInfo.extent.height = height;
     imageInfo.extent.depth = 1;
-    imageInfo.mipLevels = 1;
-    imageInfo.arrayLayers = 1;
+    imageInfo.mipLevels = mipLevels;
+    imageInfo.arrayLayers = arrayLayers;
     imageInfo.format = format;
     imageInfo.tiling = tiling;
     imageInfo.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
@@ -113,6 +120,27 @@ VkImageView TextureManager::createImageView(VkImage image, VkFormat format,
     return imageView;
 }
 
+VkImageView TextureManager::createArrayImageView(VkImage image, VkFormat format,
+                                                  uint32_t mipLevels, uint32_t layerCount) {
+    VkImageViewCreateInfo viewInfo{};
+    viewInfo.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
+    viewInfo.image = image;
+    viewInfo.viewType = VK_IMAGE_VIEW_TYPE_2D_ARRAY;
+    viewInfo.format = format;
+    viewInfo.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+    viewInfo.subresourceRange.baseMipLevel = 0;
+    viewInfo.subresourceRange.levelCount = mipLevels;
+    viewInfo.subresourceRange.baseArrayLayer = 0;
+    viewInfo.subresourceRange.layerCount = layerCount;
+
+    VkImageView imageView;
+    if (vkCreateImageView(m_device, &viewInfo, nullptr, &imageView) != VK_SUCCESS) {
+        throw std::runtime_error("failed to create texture array image view!");
+    }
+
+    return imageView;
+}
+
 // ========== Texture Loading ==========
 
 void TextureManager::uploadTexture(const uint8_t* pixels, uint32_t width, uint32_t height,
@@ -216,10 +244,38 @@ VkSampler TextureManager::createLinearSampler(float maxAnisotropy) {
     return sampler;
 }
 
+VkSampler TextureManager::createMipmappedSampler(uint32_t mipLevels) {
+    VkSamplerCreateInfo samplerInfo{};
+    samplerInfo.sType = VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO;
+    samplerInfo.magFilter = VK_FILTER_NEAREST;
+    samplerInfo.minFilter = VK_FILTER_NEAREST;
+    samplerInfo.addressModeU = VK_SAMPLER_ADDRESS_MODE_REPEAT;
+    samplerInfo.addressModeV = VK_SAMPLER_ADDRESS_MODE_REPEAT;
+    samplerInfo.addressModeW = VK_SAMPLER_ADDRESS_MODE_REPEAT;
+    samplerInfo.anisotropyEnable = VK_FALSE;
+    samplerInfo.maxAnisotropy = 1.0f;
+    samplerInfo.borderColor = VK_BORDER_COLOR_INT_OPAQUE_BLACK;
+    samplerInfo.unnormalizedCoordinates = VK_FALSE;
+    samplerInfo.compareEnable = VK_FALSE;
+    samplerInfo.compareOp = VK_COMPARE_OP_ALWAYS;
+    samplerInfo.mipmapMode = VK_SAMPLER_MIPMAP_MODE_LINEAR;
+    samplerInfo.mipLodBias = 0.0f;
+    samplerInfo.minLod = 0.0f;
+    samplerInfo.maxLod = static_cast<float>(mipLevels);
+
+    VkSampler sampler;
+    if (vkCreateSampler(m_device, &samplerInfo, nullptr, &sampler) != VK_SUCCESS) {
+        throw std::runtime_error("failed to create mipmapped texture sampler!");
+    }
+
+    return sampler;
+}
+
 // ========== Layout Transitions ==========
 
 void TextureManager::transitionImageLayout(VkImage image, VkFormat format,
-                                            VkImageLayout oldLayout, VkImageLayout newLayout) {
+                                            VkImageLayout oldLayout, VkImageLayout newLayout,
+                                            uint32_t mipLevels, uint32_t layerCount) {
     VkCommandBuffer commandBuffer = beginSingleTimeCommands();
 
     VkImageMemoryBarrier barrier{};
@@ -231,9 +287,9 @@ void TextureManager::transitionImageLayout(VkImage image, VkFormat format,
     barrier.image = image;
     barrier.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
     barrier.subresourceRange.baseMipLevel = 0;
-    barrier.subresourceRange.levelCount = 1;
+    barrier.subresourceRange.levelCount = mipLevels;
     barrier.subresourceRange.baseArrayLayer = 0;
-    barrier.subresourceRange.layerCount = 1;
+    barrier.subresourceRange.layerCount = layerCount;
 
     VkPipelineStageFlags sourceStage;
     VkPipelineStageFlags destinationStage;
@@ -277,6 +333,16 @@ void TextureManager::copyBufferToImage(VkBuffer buffer, VkImage image,
     endSingleTimeCommands(commandBuffer);
 }
 
+void TextureManager::copyBufferToImage(VkBuffer buffer, VkImage image,
+                                        const std::vector<VkBufferImageCopy>& regions) {
+    VkCommandBuffer commandBuffer = beginSingleTimeCommands();
+
+    vkCmdCopyBufferToImage(commandBuffer, buffer, image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+                           static_cast<uint32_t>(regions.size()), regions.data());
+
+    endSingleTimeCommands(commandBuffer);
+}
+
 // ========== Resource Destruction ==========
 
 void TextureManager::destroyTexture(VkImage& image, VkImageView& imageView, VkDeviceMemory& memory) {
@@ -0,0 +1,138 @@
+/**
+ * @file upload_arena.cpp
+ * @brief Persistently mapped ring buffer for zero-copy mesh uploads
+ *
+ * Created: 2025-11-28
+ */
+
+#include "vulkan/upload_arena.h"
+#include "vulkan/buffer_manager.h"
+#include "logger.h"
+
+void UploadArena::initialize(VkDevice device, VkPhysicalDevice physicalDevice, VkDeviceSize capacity) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    BufferManager bufferManager(device, physicalDevice);
+    bufferManager.createBuffer(capacity, VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+                               VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+                               m_buffer, m_memory);
+
+    // Map ONCE - never unmapped until cleanup (persistent mapping)
+    void* mapped = nullptr;
+    vkMapMemory(device, m_memory, 0, capacity, 0, &mapped);
+    m_mapped = static_cast<uint8_t*>(mapped);
+    m_capacity = capacity;
+    m_records.clear();
+    m_head = 0;
+    m_usedBytes = 0;
+
+    Logger::info() << "[UploadArena] Initialized (" << (capacity / (1024 * 1024)) << " MB, persistently mapped)";
+}
+
+void UploadArena::initializeHost(uint8_t* memory, VkDeviceSize capacity) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    m_buffer = VK_NULL_HANDLE;
+    m_memory = VK_NULL_HANDLE;
+    m_mapped = memory;
+    m_capacity = capacity;
+    m_records.clear();
+    m_head = 0;
+    m_usedBytes = 0;
+}
+
+void UploadArena::cleanup(VkDevice device) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    if (m_mapped != nullptr && m_memory != VK_NULL_HANDLE) {
+        vkUnmapMemory(device, m_memory);
+    }
+    m_mapped = nullptr;
+    if (m_buffer != VK_NULL_HANDLE) {
+        vkDestroyBuffer(device, m_buffer, nullptr);
+        m_buffer = VK_NULL_HANDLE;
+    }
+    if (m_memory != VK_NULL_HANDLE) {
+        vkFreeMemory(device, m_memory, nullptr);
+        m_memory = VK_NULL_HANDLE;
+    }
+    m_capacity = 0;
+    m_records.clear();
+    m_head = 0;
+    m_usedBytes = 0;
+}
+
+bool UploadArena::allocate(VkDeviceSize size, Allocation& out) {
+    size = alignUp(size);
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_mapped == nullptr || size == 0 || size > m_capacity) {
+        return false;
+    }
+
+    VkDeviceSize offset = 0;
+    if (m_records.empty()) {
+        // Ring is empty - start over at the beginning
+        offset = 0;
+    } else {
+        const VkDeviceSize tail = m_records.front().offset;
+        if (m_head > tail) {
+            // Not wrapped: free space is [head, capacity) and [0, tail)
+            if (m_capacity - m_head >= size) {
+                offset = m_head;
+            } else if (tail >= size) {
+                offset = 0;  // Wrap; the gap at the end is reclaimed once the tail passes it
+            } else {
+                return false;
+            }
+        } else {
+            // Wrapped: free space is [head, tail)
+            if (tail - m_head >= size) {
+                offset = m_head;
+            } else {
+                return false;
+            }
+        }
+    }
+
+    const uint64_t id = m_nextId++;
+    m_records.push_back({id, offset, size, false});
+    m_head = offset + size;
+    m_usedBytes += size;
+
+    out.id = id;
+    out.offset = offset;
+    out.size = size;
+    out.ptr = m_mapped + offset;
+    return true;
+}
+
+void UploadArena::release(uint64_t id) {
+    if (id == 0) return;
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    // Slices are usually released oldest-first, so this finds them near the front
+    for (Record& record : m_records) {
+        if (record.id == id) {
+            if (!record.released) {
+                record.released = true;
+                m_usedBytes -= record.size;
+            }
+            break;
+        }
+    }
+
+    // Advance the tail past released slices
+    while (!m_records.empty() && m_records.front().released) {
+        m_records.pop_front();
+    }
+    if (m_records.empty()) {
+        m_head = 0;
+    }
+}
+
+VkDeviceSize UploadArena::getUsedBytes() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_usedBytes;
+}
@@ -16,17 +16,21 @@
  */
 
 #include "vulkan_renderer.h"
+#include "profiler.h"
 #include "vulkan/buffer_manager.h"
 #include "vulkan/descriptor_manager.h"
 #include "vulkan/pipeline_builder.h"
+#include "vulkan/pipeline_cache.h"
 #include "vulkan/skybox_renderer.h"
 #include "vulkan/swapchain_manager.h"
 #include "vulkan/texture_manager.h"
 #include "vulkan/vulkan_context.h"
 #include "chunk.h"
+#include "quad_index.h"
 #include "mesh/mesh.h"
 #include "logger.h"
 #include "block_system.h"
+#include "startup_timer.h"
 #include <stdexcept>
 #include <iostream>
 #include <set>
@@ -35,6 +39,7 @@
 #include <cstring>
 #include <chrono>
 #include <array>
+#include <future>
 
 // ========== StagingBufferPool Implementation (2025-11-25) ==========
 
@@ -224,6 +229,7 @@ VulkanRenderer::VulkanRenderer(GLFWwindow* window) : m_window(window) {
     // Note: presentQueueFamily is obtained from QueueFamilyIndices if needed
     QueueFamilyIndices indices = m_vulkanContext->getQueueFamilies();
     m_presentQueueFamily = indices.presentFamily.value();
+    StartupTimer::instance().mark("Vulkan context");
 
     // Initialize BufferManager after device creation (2025-12-27)
     m_bufferManager = std::make_unique<BufferManager>(m_device, m_physicalDevice);
@@ -235,12 +241,14 @@ VulkanRenderer::VulkanRenderer(GLFWwindow* window) : m_window(window) {
     createImageViews();
     createRenderPass();
     createDescriptorSetLayout();
-    createGraphicsPipeline();
-    createTransparentPipeline();
-    createWireframePipeline();
-    createLinePipeline();
-    createMeshPipeline();
-    createSpherePipeline();
+    StartupTimer::instance().mark("Swapchain + render pass");
+
+    m_pipelineCache = std::make_unique<PipelineCache>(m_device, m_physicalDevice, "cache/pipeline_cache.bin");
+    StartupTimer::instance().mark("Pipeline cache load",
+        m_pipelineCache->wasLoaded() ? std::to_string(m_pipelineCache->loadedSize() / 1024) + " KB" : "cold");
+
+    createPipelineLayouts();
+    createPipelines();
     createCommandPool();
 
     // Initialize TextureManager after command pool creation
@@ -248,7 +256,7 @@ VulkanRenderer::VulkanRenderer(GLFWwindow* window) : m_window(window) {
 
     // Initialize SkyboxRenderer after command pool creation (2025-12-27)
     m_skyboxRenderer = std::make_unique<SkyboxRenderer>(m_device, m_physicalDevice, m_commandPool, m_graphicsQueue);
-    m_skyboxRenderer->initialize(m_renderPass, m_pipelineLayout, m_swapChainExtent);
+    m_skyboxRenderer->initialize(m_renderPass, m_pipelineLayout, m_swapChainExtent, m_pipelineCache->get());
 
     createDepthResources();
     createFramebuffers();
@@ -262,6 +270,16 @@ VulkanRenderer::VulkanRenderer(GLFWwindow* window) : m_window(window) {
 
     // PERF (2025-11-25): Initialize staging buffer pool for efficient GPU uploads
     m_stagingBufferPool.initialize(m_device, m_physicalDevice, STAGING_BUFFER_SIZE, STAGING_BUFFER_COUNT);
+
+    // ZERO-COPY UPLOADS (2025-11-28): Mesh workers write straight into this arena
+    m_uploadArena.initialize(m_device, m_physicalDevice, UPLOAD_ARENA_SIZE);
+    Chunk::setUploadArena(&m_uploadArena);
+
+    // Cold start: persist now so a crash before shutdown doesn't cost the next launch a full compile
+    if (!m_pipelineCache->wasLoaded()) {
+        m_pipelineCache->save();
+    }
+    StartupTimer::instance().mark("Renderer resources");
 }
 
 // Destructor
@@ -469,12 +487,155 @@ void VulkanRenderer::createDescriptorSetLayout() {
     nightCubeMapLayoutBinding.stageFlags = VK_SHADER_STAGE_FRAGMENT_BIT;
     nightCubeMapLayoutBinding.pImmutableSamplers = nullptr;
 
-    std::vector<VkDescriptorSetLayoutBinding> bindings = {uboLayoutBinding, samplerLayoutBinding, cubeMapLayoutBinding, nightCubeMapLayoutBinding};
+    // Block texture array binding (binding 4) for world geometry (sampler2DArray)
+    VkDescriptorSetLayoutBinding textureArrayLayoutBinding{};
+    textureArrayLayoutBinding.binding = 4;
+    textureArrayLayoutBinding.descriptorCount = 1;
+    textureArrayLayoutBinding.descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+    textureArrayLayoutBinding.stageFlags = VK_SHADER_STAGE_FRAGMENT_BIT;
+    textureArrayLayoutBinding.pImmutableSamplers = nullptr;
+
+    std::vector<VkDescriptorSetLayoutBinding> bindings = {uboLayoutBinding, samplerLayoutBinding, cubeMapLayoutBinding,
+                                                          nightCubeMapLayoutBinding, textureArrayLayoutBinding};
 
     // Use DescriptorManager to create the layout
     m_descriptorSetLayout = m_descriptorManager->createLayout(bindings);
 }
 
+// Create the pipeline layouts shared by the voxel and mesh pipelines
+// Layouts outlive pipelines: they are created once here, not on swapchain recreation
+void VulkanRenderer::createPipelineLayouts() {
+    // Voxel layout: set 0 (UBO + textures) + vertex push constants
+    VkPushConstantRange chunkPushConstants{};
+    chunkPushConstants.stageFlags = VK_SHADER_STAGE_VERTEX_BIT;
+    chunkPushConstants.offset = 0;
+    chunkPushConstants.size = sizeof(ChunkPushConstants);
+
+    VkPipelineLayoutCreateInfo layoutInfo{};
+    layoutInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+    layoutInfo.setLayoutCount = 1;
+    layoutInfo.pSetLayouts = &m_descriptorSetLayout;
+    layoutInfo.pushConstantRangeCount = 1;
+    layoutInfo.pPushConstantRanges = &chunkPushConstants;
+
+    if (vkCreatePipelineLayout(m_device, &layoutInfo, nullptr, &m_pipelineLayout) != VK_SUCCESS) {
+        throw std::runtime_error("failed to create pipeline layout!");
+    }
+
+    // Create mesh-specific descriptor set layout for textures (set 1)
+    VkDescriptorSetLayoutBinding textureSamplerBinding{};
+    textureSamplerBinding.binding = 0;
+    textureSamplerBinding.descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+    textureSamplerBinding.descriptorCount = 64;  // Match shader's meshTextures[64]
+    textureSamplerBinding.stageFlags = VK_SHADER_STAGE_FRAGMENT_BIT;
+    textureSamplerBinding.pImmutableSamplers = nullptr;
+
+    VkDescriptorSetLayoutCreateInfo textureLayoutInfo{};
+    textureLayoutInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+    textureLayoutInfo.bindingCount = 1;
+    textureLayoutInfo.pBindings = &textureSamplerBinding;
+
+    if (vkCreateDescriptorSetLayout(m_device, &textureLayoutInfo, nullptr, &m_meshDescriptorSetLayout) != VK_SUCCESS) {
+        throw std::runtime_error("failed to create mesh texture descriptor set layout!");
+    }
+
+    // Create bone + instance table descriptor set layout (set 2)
+    // Binding 0: bone palette for skeletal animation (every character's skinning matrices)
+    // Binding 1: persistent instance table (transform, tint, material per slot)
+    std::array<VkDescriptorSetLayoutBinding, 2> instanceBindings{};
+    instanceBindings[0].binding = 0;
+    instanceBindings[0].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+    instanceBindings[0].descriptorCount = 1;
+    instanceBindings[0].stageFlags = VK_SHADER_STAGE_VERTEX_BIT;
+    instanceBindings[0].pImmutableSamplers = nullptr;
+
+    instanceBindings[1].binding = 1;
+    instanceBindings[1].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+    instanceBindings[1].descriptorCount = 1;
+    instanceBindings[1].stageFlags = VK_SHADER_STAGE_VERTEX_BIT;
+    instanceBindings[1].pImmutableSamplers = nullptr;
+
+    VkDescriptorSetLayoutCreateInfo boneLayoutInfo{};
+    boneLayoutInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+    boneLayoutInfo.bindingCount = static_cast<uint32_t>(instanceBindings.size());
+    boneLayoutInfo.pBindings = instanceBindings.data();
+
+    if (vkCreateDescriptorSetLayout(m_device, &boneLayoutInfo, nullptr, &m_meshBoneDescriptorSetLayout) != VK_SUCCESS) {
+        throw std::runtime_error("failed to create mesh bone descriptor set layout!");
+    }
+
+    // Create mesh pipeline layout with three descriptor sets
+    // Set 0: Camera UBO (from voxel pipeline, reused)
+    // Set 1: Mesh textures
+    // Set 2: Bone palette + instance table
+    // Materials live in the instance table, so there are no push constants: one
+    // indirect draw covers every mesh (see MeshBatch).
+    std::array<VkDescriptorSetLayout, 3> meshSetLayouts = {
+        m_descriptorSetLayout,           // Set 0: Camera UBO
+        m_meshDescriptorSetLayout,       // Set 1: Mesh textures
+        m_meshBoneDescriptorSetLayout    // Set 2: Bone palette + instance table
+    };
+
+    VkPipelineLayoutCreateInfo meshLayoutInfo{};
+    meshLayoutInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+    meshLayoutInfo.setLayoutCount = static_cast<uint32_t>(meshSetLayouts.size());
+    meshLayoutInfo.pSetLayouts = meshSetLayouts.data();
+    meshLayoutInfo.pushConstantRangeCount = 0;
+    meshLayoutInfo.pPushConstantRanges = nullptr;
+
+    if (vkCreatePipelineLayout(m_device, &meshLayoutInfo, nullptr, &m_meshPipelineLayout) != VK_SUCCESS) {
+        throw std::runtime_error("failed to create mesh pipeline layout!");
+    }
+}
+
+// Create all swapchain-dependent pipelines
+void VulkanRenderer::createPipelines() {
+    // PERFORMANCE (2025-11-28): The pipelines only share (already created) layouts, and
+    // vkCreateGraphicsPipelines is free-threaded with an internally synchronized cache,
+    // so compile them on worker threads instead of back to back. Wall time becomes the
+    // slowest pipeline rather than the sum.
+    struct PipelineJob {
+        const char* name;
+        void (VulkanRenderer::*create)();
+    };
+    static constexpr PipelineJob jobs[] = {
+        {"graphics", &VulkanRenderer::createGraphicsPipeline},
+        {"transparent", &VulkanRenderer::createTransparentPipeline},
+        {"wireframe", &VulkanRenderer::createWireframePipeline},
+        {"line", &VulkanRenderer::createLinePipeline},
+        {"mesh", &VulkanRenderer::createMeshPipeline},
+        {"sphere", &VulkanRenderer::createSpherePipeline},
+    };
+
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::future<double>> futures;
+    futures.reserve(std::size(jobs));
+    for (const PipelineJob& job : jobs) {
+        futures.push_back(std::async(std::launch::async, [this, &job]() {
+            auto jobStart = std::chrono::steady_clock::now();
+            (this->*job.create)();
+            return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - jobStart).count();
+        }));
+    }
+
+    // get() rethrows a job's exception; remaining futures still join in their destructors
+    std::vector<double> jobMs;
+    jobMs.reserve(futures.size());
+    for (auto& future : futures) {
+        jobMs.push_back(future.get());
+    }
+    double wallMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    StartupTimer& timer = StartupTimer::instance();
+    if (timer.isActive()) {
+        timer.mark("Pipelines (parallel)", std::to_string(std::size(jobs)) + " pipelines");
+        for (size_t i = 0; i < jobMs.size(); i++) {
+            timer.detail(jobs[i].name, jobMs[i]);
+        }
+    }
+    Logger::info() << "Created " << std::size(jobs) << " pipelines in " << wallMs << " ms";
+}
+
 // Create graphics pipeline
 void VulkanRenderer::createGraphicsPipeline() {
     // Get vertex input descriptions for CompressedVertex
@@ -492,8 +653,9 @@ void VulkanRenderer::createGraphicsPipeline() {
         .setCullMode(VK_CULL_MODE_BACK_BIT, VK_FRONT_FACE_CLOCKWISE)
         .setDepthTest(true, VK_COMPARE_OP_LESS)
         .setAlphaBlending()
-        .setDescriptorSetLayout(m_descriptorSetLayout)
-        .build(&m_pipelineLayout);
+        .setPipelineLayout(m_pipelineLayout)
+        .setPipelineCache(m_pipelineCache->get())
+        .build();
     builder.destroyShaderModules();
 }
 
@@ -515,6 +677,7 @@ void VulkanRenderer::createTransparentPipeline() {
         .setDepthTest(false, VK_COMPARE_OP_LESS)  // Depth test on, write off
         .setAlphaBlending()
         .setPipelineLayout(m_pipelineLayout)  // Reuse existing layout
+        .setPipelineCache(m_pipelineCache->get())
         .build();
     builder.destroyShaderModules();
 }
@@ -538,6 +701,7 @@ void VulkanRenderer::createWireframePipeline() {
         .setDepthTest(true, VK_COMPARE_OP_LESS)
         .setAlphaBlending()
         .setPipelineLayout(m_pipelineLayout)
+        .setPipelineCache(m_pipelineCache->get())
         .build();
     builder.destroyShaderModules();
 }
@@ -569,6 +733,7 @@ void VulkanRenderer::createLinePipeline() {
         .setNoDepthTest()  // Lines always visible on top
         .setAlphaBlending()
         .setPipelineLayout(m_pipelineLayout)
+        .setPipelineCache(m_pipelineCache->get())
         .build();
     builder.destroyShaderModules();
 }
@@ -596,7 +761,7 @@ void VulkanRenderer::createMeshPipeline() {
 
     VkPipelineShaderStageCreateInfo shaderStages[] = {vertShaderStageInfo, fragShaderStageInfo};
 
-    // Vertex input: MeshVertex (binding 0) + InstanceData (binding 1)
+    // Vertex input: MeshVertex (binding 0) + visible instance slots (binding 1)
     auto meshVertexBinding = MeshVertex::getBindingDescription();
     auto meshVertexAttributes = MeshVertex::getAttributeDescriptions();
 
@@ -674,66 +839,7 @@ void VulkanRenderer::createMeshPipeline() {
     colorBlending.attachmentCount = 1;
     colorBlending.pAttachments = &colorBlendAttachment;
 
-    // Create mesh-specific descriptor set layout for textures (set 1)
-    VkDescriptorSetLayoutBinding textureSamplerBinding{};
-    textureSamplerBinding.binding = 0;
-    textureSamplerBinding.descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
-    textureSamplerBinding.descriptorCount = 64;  // Match shader's meshTextures[64]
-    textureSamplerBinding.stageFlags = VK_SHADER_STAGE_FRAGMENT_BIT;
-    textureSamplerBinding.pImmutableSamplers = nullptr;
-
-    VkDescriptorSetLayoutCreateInfo textureLayoutInfo{};
-    textureLayoutInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
-    textureLayoutInfo.bindingCount = 1;
-    textureLayoutInfo.pBindings = &textureSamplerBinding;
-
-    if (vkCreateDescriptorSetLayout(m_device, &textureLayoutInfo, nullptr, &m_meshDescriptorSetLayout) != VK_SUCCESS) {
-        throw std::runtime_error("failed to create mesh texture descriptor set layout!");
-    }
-
-    // Create bone descriptor set layout for skeletal animation (set 2)
-    VkDescriptorSetLayoutBinding boneUBOBinding{};
-    boneUBOBinding.binding = 0;
-    boneUBOBinding.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
-    boneUBOBinding.descriptorCount = 1;
-    boneUBOBinding.stageFlags = VK_SHADER_STAGE_VERTEX_BIT;
-    boneUBOBinding.pImmutableSamplers = nullptr;
-
-    VkDescriptorSetLayoutCreateInfo boneLayoutInfo{};
-    boneLayoutInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
-    boneLayoutInfo.bindingCount = 1;
-    boneLayoutInfo.pBindings = &boneUBOBinding;
-
-    if (vkCreateDescriptorSetLayout(m_device, &boneLayoutInfo, nullptr, &m_meshBoneDescriptorSetLayout) != VK_SUCCESS) {
-        throw std::runtime_error("failed to create mesh bone descriptor set layout!");
-    }
-
-    // Create push constant range for material data
-    VkPushConstantRange pushConstantRange{};
-    pushConstantRange.stageFlags = VK_SHADER_STAGE_FRAGMENT_BIT;
-    pushConstantRange.offset = 0;
-    pushConstantRange.size = sizeof(int32_t) * 2 + sizeof(float) * 2;  // albedoTexIndex, normalTexIndex, metallic, roughness
-
-    // Create mesh pipeline layout with three descriptor sets + push constants
-    // Set 0: Camera UBO (from voxel pipeline, reused)
-    // Set 1: Mesh textures
-    // Set 2: Bone matrices for skeletal animation
-    std::array<VkDescriptorSetLayout, 3> meshSetLayouts = {
-        m_descriptorSetLayout,           // Set 0: Camera UBO
-        m_meshDescriptorSetLayout,       // Set 1: Mesh textures
-        m_meshBoneDescriptorSetLayout    // Set 2: Bone matrices
-    };
-
-    VkPipelineLayoutCreateInfo meshLayoutInfo{};
-    meshLayoutInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
-    meshLayoutInfo.setLayoutCount = static_cast<uint32_t>(meshSetLayouts.size());
-    meshLayoutInfo.pSetLayouts = meshSetLayouts.data();
-    meshLayoutInfo.pushConstantRangeCount = 1;
-    meshLayoutInfo.pPushConstantRanges = &pushConstantRange;
-
-    if (vkCreatePipelineLayout(m_device, &meshLayoutInfo, nullptr, &m_meshPipelineLayout) != VK_SUCCESS) {
-        throw std::runtime_error("failed to create mesh pipeline layout!");
-    }
+    // Layout (sets 0-2, materials in the instance table, no push constants) is created once in createPipelineLayouts()
 
     // Create graphics pipeline
     VkGraphicsPipelineCreateInfo pipelineInfo{};
@@ -753,7 +859,7 @@ void VulkanRenderer::createMeshPipeline() {
     pipelineInfo.subpass = 0;
     pipelineInfo.basePipelineHandle = VK_NULL_HANDLE;
 
-    if (vkCreateGraphicsPipelines(m_device, VK_NULL_HANDLE, 1, &pipelineInfo, nullptr, &m_meshPipeline) != VK_SUCCESS) {
+    if (vkCreateGraphicsPipelines(m_device, m_pipelineCache->get(), 1, &pipelineInfo, nullptr, &m_meshPipeline) != VK_SUCCESS) {
         throw std::runtime_error("failed to create mesh pipeline!");
     }
 
@@ -781,6 +887,7 @@ void VulkanRenderer::createSpherePipeline() {
         .setDepthTest(true, VK_COMPARE_OP_LESS)
         .setNoBlending()
         .setPipelineLayout(m_pipelineLayout)
+        .setPipelineCache(m_pipelineCache->get())
         .build();
     builder.destroyShaderModules();
 
@@ -878,9 +985,9 @@ void VulkanRenderer::createDescriptorPool() {
     poolSizes[0].type = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
     poolSizes[0].descriptorCount = static_cast<uint32_t>(MAX_FRAMES_IN_FLIGHT + EXTRA_SETS);
 
-    // Combined image sampler pool size (for texture atlas + day cube map + night cube map + extras)
+    // Combined image sampler pool size (texture atlas + day cube map + night cube map + texture array + extras)
     poolSizes[1].type = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
-    poolSizes[1].descriptorCount = static_cast<uint32_t>((MAX_FRAMES_IN_FLIGHT + EXTRA_SETS) * 3);
+    poolSizes[1].descriptorCount = static_cast<uint32_t>((MAX_FRAMES_IN_FLIGHT + EXTRA_SETS) * 4);
 
     // Use DescriptorManager to create the pool
     m_descriptorManager->createPool(maxSets, poolSizes);
@@ -907,6 +1014,9 @@ void VulkanRenderer::createDescriptorSets() {
         // Update night cube map sampler (binding 3) using DescriptorManager
         m_descriptorManager->updateCombinedImageSampler(m_descriptorSets[i], 3,
             m_skyboxRenderer->getNightSkyboxView(), m_skyboxRenderer->getSampler());
+
+        // Block texture array (binding 4) - white 1-layer array until bindBlockTextureArray()
+        m_descriptorManager->updateCombinedImageSampler(m_descriptorSets[i], 4, m_defaultTextureArrayView, m_defaultTextureSampler);
     }
 
 }
@@ -1166,6 +1276,9 @@ bool VulkanRenderer::beginFrame() {
     vkCmdBindDescriptorSets(m_commandBuffers[m_currentFrame], VK_PIPELINE_BIND_POINT_GRAPHICS, m_pipelineLayout,
                             0, 1, &m_descriptorSets[m_currentFrame], 0, nullptr);
 
+    // Push constants are undefined until written - default to no light transition
+    pushChunkLightBlend(m_commandBuffers[m_currentFrame], 1.0f);
+
     return true;  // Frame started successfully
 }
 
@@ -1224,6 +1337,10 @@ void VulkanRenderer::endFrame() {
         throw std::runtime_error("failed to present swap chain image!");
     }
 
+    if (m_frameNumber == 0) {
+        StartupTimer::instance().firstFrame();
+    }
+
     // Increment frame counter and flush old resources
     m_frameNumber++;
     flushDeletionQueue();
@@ -1262,16 +1379,16 @@ void VulkanRenderer::updateUniformBuffer(uint32_t currentImage, const glm::mat4&
 
     // Pack liquid properties (from YAML or defaults)
     ubo.liquidFogColor = glm::vec4(liquidFogColor, 1.0f);  // RGB + unused alpha
-    ubo.liquidFogDist = glm::vec4(liquidFogStart, liquidFogEnd, 0.0f, 0.0f);  // Start, end, unused, unused
+    ubo.liquidFogDist = glm::vec4(liquidFogStart, liquidFogEnd, m_horizonInnerRadius, m_horizonDistance);  // Start, end, horizon inner, horizon outer
     ubo.liquidTint = glm::vec4(liquidTintColor, liquidDarkenFactor);  // RGB tint + darken factor
 
     // Atlas info for compressed vertex UV reconstruction
     // .x = atlas grid size (number of cells per row/column)
     // .y = same as .x (square atlas)
     // .z = cell size (1.0 / gridSize, for UV normalization)
-    // .w = unused
+    // .w = far LOD fade distance (0 = disabled)
     float atlasGridSize = static_cast<float>(BlockRegistry::instance().getAtlasGridSize());
-    ubo.atlasInfo = glm::vec4(atlasGridSize, atlasGridSize, 1.0f / atlasGridSize, 0.0f);
+    ubo.atlasInfo = glm::vec4(atlasGridSize, atlasGridSize, 1.0f / atlasGridSize, m_farLodDistance);
 
     memcpy(m_uniformBuffersMapped[currentImage], &ubo, sizeof(ubo));
 }
@@ -1298,6 +1415,12 @@ void VulkanRenderer::bindAtlasTexture(VkImageView atlasView, VkSampler atlasSamp
     }
 }
 
+void VulkanRenderer::bindBlockTextureArray(VkImageView arrayView, VkSampler arraySampler) {
+    for (size_t i = 0; i < MAX_FRAMES_IN_FLIGHT; i++) {
+        m_descriptorManager->updateCombinedImageSampler(m_descriptorSets[i], 4, arrayView, arraySampler);
+    }
+}
+
 
 bool VulkanRenderer::checkDeviceExtensionSupport(VkPhysicalDevice device) {
     uint32_t extensionCount;
@@ -1421,14 +1544,27 @@ void VulkanRenderer::createImage(uint32_t width, uint32_t height, VkFormat forma
     m_textureManager->createImage(width, height, format, tiling, usage, properties, image, imageMemory);
 }
 
+void VulkanRenderer::createImage(uint32_t width, uint32_t height, uint32_t mipLevels, uint32_t arrayLayers,
+                                 VkFormat format, VkImageTiling tiling, VkImageUsageFlags usage,
+                                 VkMemoryPropertyFlags properties, VkImage& image, VkDeviceMemory& imageMemory) {
+    // Delegate to TextureManager
+    m_textureManager->createImage(width, height, mipLevels, arrayLayers, format, tiling, usage, properties, image, imageMemory);
+}
+
 VkImageView VulkanRenderer::createImageView(VkImage image, VkFormat format, VkImageAspectFlags aspectFlags) {
     // Delegate to TextureManager
     return m_textureManager->createImageView(image, format, aspectFlags);
 }
 
-void VulkanRenderer::transitionImageLayout(VkImage image, VkFormat format, VkImageLayout oldLayout, VkImageLayout newLayout) {
+VkImageView VulkanRenderer::createArrayImageView(VkImage image, VkFormat format, uint32_t mipLevels, uint32_t layerCount) {
+    // Delegate to TextureManager
+    return m_textureManager->createArrayImageView(image, format, mipLevels, layerCount);
+}
+
+void VulkanRenderer::transitionImageLayout(VkImage image, VkFormat format, VkImageLayout oldLayout, VkImageLayout newLayout,
+                                           uint32_t mipLevels, uint32_t layerCount) {
     // Delegate to TextureManager
-    m_textureManager->transitionImageLayout(image, format, oldLayout, newLayout);
+    m_textureManager->transitionImageLayout(image, format, oldLayout, newLayout, mipLevels, layerCount);
 }
 
 void VulkanRenderer::copyBufferToImage(VkBuffer buffer, VkImage image, uint32_t width, uint32_t height) {
@@ -1436,6 +1572,11 @@ void VulkanRenderer::copyBufferToImage(VkBuffer buffer, VkImage image, uint32_t
     m_textureManager->copyBufferToImage(buffer, image, width, height);
 }
 
+void VulkanRenderer::copyBufferToImage(VkBuffer buffer, VkImage image, const std::vector<VkBufferImageCopy>& regions) {
+    // Delegate to TextureManager
+    m_textureManager->copyBufferToImage(buffer, image, regions);
+}
+
 VkSampler VulkanRenderer::createTextureSampler() {
     // Delegate to TextureManager - createNearestSampler provides nearest filtering for pixelated look
     return m_textureManager->createNearestSampler();
@@ -1446,6 +1587,11 @@ VkSampler VulkanRenderer::createLinearTextureSampler() {
     return m_textureManager->createLinearSampler(4.0f);
 }
 
+VkSampler VulkanRenderer::createMipmappedSampler(uint32_t mipLevels) {
+    // Delegate to TextureManager - nearest texels, blended mip levels, REPEAT for tiled quads
+    return m_textureManager->createMipmappedSampler(mipLevels);
+}
+
 void VulkanRenderer::uploadMeshTexture(const uint8_t* pixels, uint32_t width, uint32_t height,
                                         VkImage& outImage, VkDeviceMemory& outMemory) {
     VkDeviceSize imageSize = width * height * 4;  // RGBA
@@ -1531,6 +1677,7 @@ void VulkanRenderer::createDefaultTexture() {
 
     // Create image view and sampler
     m_defaultTextureView = createImageView(m_defaultTextureImage, VK_FORMAT_R8G8B8A8_SRGB, VK_IMAGE_ASPECT_COLOR_BIT);
+    m_defaultTextureArrayView = createArrayImageView(m_defaultTextureImage, VK_FORMAT_R8G8B8A8_SRGB, 1, 1);
     m_defaultTextureSampler = createTextureSampler();
 
     std::cout << "Created default 1x1 white texture for fallback rendering" << '\n';
@@ -1748,13 +1895,18 @@ void VulkanRenderer::beginAsyncChunkUpload() {
     m_batchIsAsync = true;  // Mark as async
 }
 
-void VulkanRenderer::batchCopyBuffer(VkBuffer srcBuffer, VkBuffer dstBuffer, VkDeviceSize size) {
+void VulkanRenderer::batchCopyBuffer(VkBuffer srcBuffer, VkBuffer dstBuffer, VkDeviceSize size, VkDeviceSize srcOffset) {
     // Record copy command into batch command buffer
     VkBufferCopy copyRegion{};
+    copyRegion.srcOffset = srcOffset;
     copyRegion.size = size;
     vkCmdCopyBuffer(m_batchCommandBuffer, srcBuffer, dstBuffer, 1, &copyRegion);
 }
 
+void VulkanRenderer::releaseUploadArenaAfterBatch(uint64_t allocationId) {
+    m_batchArenaAllocations.push_back(allocationId);
+}
+
 void VulkanRenderer::submitBufferCopyBatch(bool async) {
     // Check if async parameter overrides batch flag
     bool isAsync = async || m_batchIsAsync;
@@ -1799,7 +1951,9 @@ void VulkanRenderer::submitBufferCopyBatch(bool async) {
         }
 
         // Store pending upload (no staging buffers yet - will be added by submitAsyncChunkUpload)
-        m_pendingUploads.push_back({fence, m_batchCommandBuffer, {}});
+        // Arena slices read by this batch are released when its fence signals
+        m_pendingUploads.push_back({fence, m_batchCommandBuffer, {}, std::move(m_batchArenaAllocations)});
+        m_batchArenaAllocations.clear();
         m_batchCommandBuffer = VK_NULL_HANDLE;
     } else {
         // SYNC MODE: Wait for completion (original behavior)
@@ -1811,6 +1965,11 @@ void VulkanRenderer::submitBufferCopyBatch(bool async) {
                                    ? m_transferCommandPool : m_commandPool;
         vkFreeCommandBuffers(m_device, cleanupPool, 1, &m_batchCommandBuffer);
         m_batchCommandBuffer = VK_NULL_HANDLE;
+
+        for (uint64_t allocationId : m_batchArenaAllocations) {
+            m_uploadArena.release(allocationId);
+        }
+        m_batchArenaAllocations.clear();
     }
 }
 
@@ -1827,25 +1986,15 @@ void VulkanRenderer::submitAsyncChunkUpload(Chunk* chunk) {
         if (chunk->m_vertexStagingBuffer != VK_NULL_HANDLE) {
             upload.stagingBuffers.push_back({chunk->m_vertexStagingBuffer, chunk->m_vertexStagingBufferMemory});
         }
-        if (chunk->m_indexStagingBuffer != VK_NULL_HANDLE) {
-            upload.stagingBuffers.push_back({chunk->m_indexStagingBuffer, chunk->m_indexStagingBufferMemory});
-        }
         if (chunk->m_transparentVertexStagingBuffer != VK_NULL_HANDLE) {
             upload.stagingBuffers.push_back({chunk->m_transparentVertexStagingBuffer, chunk->m_transparentVertexStagingBufferMemory});
         }
-        if (chunk->m_transparentIndexStagingBuffer != VK_NULL_HANDLE) {
-            upload.stagingBuffers.push_back({chunk->m_transparentIndexStagingBuffer, chunk->m_transparentIndexStagingBufferMemory});
-        }
 
         // Clear chunk's staging buffer references (ownership transferred)
         chunk->m_vertexStagingBuffer = VK_NULL_HANDLE;
         chunk->m_vertexStagingBufferMemory = VK_NULL_HANDLE;
-        chunk->m_indexStagingBuffer = VK_NULL_HANDLE;
-        chunk->m_indexStagingBufferMemory = VK_NULL_HANDLE;
         chunk->m_transparentVertexStagingBuffer = VK_NULL_HANDLE;
         chunk->m_transparentVertexStagingBufferMemory = VK_NULL_HANDLE;
-        chunk->m_transparentIndexStagingBuffer = VK_NULL_HANDLE;
-        chunk->m_transparentIndexStagingBufferMemory = VK_NULL_HANDLE;
     }
 }
 
@@ -1867,28 +2016,20 @@ void VulkanRenderer::addChunkToBatch(Chunk* chunk) {
     if (chunk->m_vertexStagingBuffer != VK_NULL_HANDLE) {
         m_batchStagingBuffers.push_back({chunk->m_vertexStagingBuffer, chunk->m_vertexStagingBufferMemory});
     }
-    if (chunk->m_indexStagingBuffer != VK_NULL_HANDLE) {
-        m_batchStagingBuffers.push_back({chunk->m_indexStagingBuffer, chunk->m_indexStagingBufferMemory});
-    }
     if (chunk->m_transparentVertexStagingBuffer != VK_NULL_HANDLE) {
         m_batchStagingBuffers.push_back({chunk->m_transparentVertexStagingBuffer, chunk->m_transparentVertexStagingBufferMemory});
     }
-    if (chunk->m_transparentIndexStagingBuffer != VK_NULL_HANDLE) {
-        m_batchStagingBuffers.push_back({chunk->m_transparentIndexStagingBuffer, chunk->m_transparentIndexStagingBufferMemory});
-    }
 
     // Clear chunk's staging buffer references (ownership transferred to batch)
     chunk->m_vertexStagingBuffer = VK_NULL_HANDLE;
     chunk->m_vertexStagingBufferMemory = VK_NULL_HANDLE;
-    chunk->m_indexStagingBuffer = VK_NULL_HANDLE;
-    chunk->m_indexStagingBufferMemory = VK_NULL_HANDLE;
     chunk->m_transparentVertexStagingBuffer = VK_NULL_HANDLE;
     chunk->m_transparentVertexStagingBufferMemory = VK_NULL_HANDLE;
-    chunk->m_transparentIndexStagingBuffer = VK_NULL_HANDLE;
-    chunk->m_transparentIndexStagingBufferMemory = VK_NULL_HANDLE;
 }
 
 void VulkanRenderer::submitBatchedChunkUploads() {
+    PROFILE_ZONE("submit_chunk_uploads");
+
     // Submit all uploads in a single vkQueueSubmit call
     submitBufferCopyBatch(true);
 
@@ -1949,6 +2090,9 @@ void VulkanRenderer::processAsyncUploads() {
                 vkDestroyBuffer(m_device, stagingBuffer.first, nullptr);
                 vkFreeMemory(m_device, stagingBuffer.second, nullptr);
             }
+            for (uint64_t allocationId : it->arenaAllocations) {
+                m_uploadArena.release(allocationId);
+            }
 
             // Remove from pending list
             it = m_pendingUploads.erase(it);
@@ -2166,14 +2310,9 @@ void VulkanRenderer::recreateSwapChain() {
     createDepthResources();
     createFramebuffers();
 
-    // Recreate pipelines with new viewport/scissor dimensions
-    createGraphicsPipeline();
-    createTransparentPipeline();
-    createWireframePipeline();
-    createLinePipeline();
+    // Recreate pipelines with new viewport/scissor dimensions (warm cache: mostly cache hits)
+    createPipelines();
     m_skyboxRenderer->recreate(m_renderPass, m_swapChainExtent);
-    createMeshPipeline();
-    createSpherePipeline();
 }
 
 // ========== Mesh Buffer Management ==========
@@ -2340,6 +2479,7 @@ void VulkanRenderer::cleanup() {
     // Cleanup default texture
     vkDestroySampler(m_device, m_defaultTextureSampler, nullptr);
     vkDestroyImageView(m_device, m_defaultTextureView, nullptr);
+    vkDestroyImageView(m_device, m_defaultTextureArrayView, nullptr);
     vkDestroyImage(m_device, m_defaultTextureImage, nullptr);
     vkFreeMemory(m_device, m_defaultTextureMemory, nullptr);
 
@@ -2362,9 +2502,12 @@ void VulkanRenderer::cleanup() {
     m_descriptorSetLayout = VK_NULL_HANDLE;
 
     std::cout << "    Cleaning up pipeline layout..." << '\n';
-    // Pipelines are already destroyed in cleanupSwapChain()
+    // Pipelines are already destroyed in cleanupSwapChain() (skybox in m_skyboxRenderer.reset())
     vkDestroyPipelineLayout(m_device, m_pipelineLayout, nullptr);
 
+    // Writes the cache file for the next launch
+    m_pipelineCache.reset();
+
     // Destroy mesh-specific resources
     if (m_meshPipelineLayout != VK_NULL_HANDLE && m_meshPipelineLayout != m_pipelineLayout) {
         vkDestroyPipelineLayout(m_device, m_meshPipelineLayout, nullptr);
@@ -2390,18 +2533,14 @@ void VulkanRenderer::cleanup() {
         vkDestroyBuffer(m_device, m_megaVertexBuffer, nullptr);
         vkFreeMemory(m_device, m_megaVertexBufferMemory, nullptr);
     }
-    if (m_megaIndexBuffer != VK_NULL_HANDLE) {
-        vkDestroyBuffer(m_device, m_megaIndexBuffer, nullptr);
-        vkFreeMemory(m_device, m_megaIndexBufferMemory, nullptr);
+    if (m_quadIndexBuffer != VK_NULL_HANDLE) {
+        vkDestroyBuffer(m_device, m_quadIndexBuffer, nullptr);
+        vkFreeMemory(m_device, m_quadIndexBufferMemory, nullptr);
     }
     if (m_megaTransparentVertexBuffer != VK_NULL_HANDLE) {
         vkDestroyBuffer(m_device, m_megaTransparentVertexBuffer, nullptr);
         vkFreeMemory(m_device, m_megaTransparentVertexBufferMemory, nullptr);
     }
-    if (m_megaTransparentIndexBuffer != VK_NULL_HANDLE) {
-        vkDestroyBuffer(m_device, m_megaTransparentIndexBuffer, nullptr);
-        vkFreeMemory(m_device, m_megaTransparentIndexBufferMemory, nullptr);
-    }
     if (m_indirectDrawBuffer != VK_NULL_HANDLE) {
         vkDestroyBuffer(m_device, m_indirectDrawBuffer, nullptr);
         vkFreeMemory(m_device, m_indirectDrawBufferMemory, nullptr);
@@ -2428,6 +2567,10 @@ void VulkanRenderer::cleanup() {
     std::cout << "    Cleaning up staging buffer pool..." << '\n';
     m_stagingBufferPool.cleanup(m_device);
 
+    // Chunks may outlive the renderer - stop them writing into the arena first
+    Chunk::setUploadArena(nullptr);
+    m_uploadArena.cleanup(m_device);
+
     std::cout << "    Cleaning up command pools..." << '\n';
     vkDestroyCommandPool(m_device, m_commandPool, nullptr);
     vkDestroyCommandPool(m_device, m_transferCommandPool, nullptr);  // PERF (2025-11-24): Transfer command pool
@@ -2516,14 +2659,6 @@ void VulkanRenderer::initializeMegaBuffers() {
         m_megaVertexBufferMemory
     );
 
-    // Create opaque index mega-buffer
-    createMegaBuffer(
-        MEGA_BUFFER_INDEX_SIZE,
-        VK_BUFFER_USAGE_INDEX_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
-        m_megaIndexBuffer,
-        m_megaIndexBufferMemory
-    );
-
     // Create transparent vertex mega-buffer
     createMegaBuffer(
         MEGA_BUFFER_VERTEX_SIZE,
@@ -2532,13 +2667,33 @@ void VulkanRenderer::initializeMegaBuffers() {
         m_megaTransparentVertexBufferMemory
     );
 
-    // Create transparent index mega-buffer
-    createMegaBuffer(
-        MEGA_BUFFER_INDEX_SIZE,
-        VK_BUFFER_USAGE_INDEX_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
-        m_megaTransparentIndexBuffer,
-        m_megaTransparentIndexBufferMemory
-    );
+    // QUAD INDEX ELIMINATION (2025-11-28): Every chunk quad is {0,1,2,0,2,3} + 4q, so one
+    // static 16-bit buffer serves all chunk draws (firstIndex 0, vertexOffset = base vertex)
+    {
+        const std::vector<QuadIndex::Index> quadIndices = QuadIndex::buildSharedIndices();
+        const VkDeviceSize quadIndexSize = QuadIndex::SHARED_BUFFER_BYTES;
+
+        VkBuffer stagingBuffer;
+        VkDeviceMemory stagingBufferMemory;
+        createBuffer(quadIndexSize,
+                     VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+                     VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+                     stagingBuffer, stagingBufferMemory);
+
+        void* data;
+        vkMapMemory(m_device, stagingBufferMemory, 0, quadIndexSize, 0, &data);
+        memcpy(data, quadIndices.data(), static_cast<size_t>(quadIndexSize));
+        vkUnmapMemory(m_device, stagingBufferMemory);
+
+        createBuffer(quadIndexSize,
+                     VK_BUFFER_USAGE_INDEX_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+                     VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
+                     m_quadIndexBuffer, m_quadIndexBufferMemory);
+        copyBuffer(stagingBuffer, m_quadIndexBuffer, quadIndexSize);
+
+        vkDestroyBuffer(m_device, stagingBuffer, nullptr);
+        vkFreeMemory(m_device, stagingBufferMemory, nullptr);
+    }
 
     // Create indirect command buffers (max 4096 chunks per draw)
     VkDeviceSize indirectBufferSize = sizeof(VkDrawIndexedIndirectCommand) * 4096;
@@ -2561,54 +2716,33 @@ void VulkanRenderer::initializeMegaBuffers() {
 
     std::cout << "Mega-buffers initialized successfully!" << '\n';
     std::cout << "  Vertex buffer: " << (MEGA_BUFFER_VERTEX_SIZE / 1024 / 1024) << " MB" << '\n';
-    std::cout << "  Index buffer: " << (MEGA_BUFFER_INDEX_SIZE / 1024 / 1024) << " MB" << '\n';
+    std::cout << "  Shared quad index buffer: " << (QuadIndex::SHARED_BUFFER_BYTES / 1024) << " KB" << '\n';
 }
 
-bool VulkanRenderer::allocateMegaBufferSpace(VkDeviceSize vertexSize, VkDeviceSize indexSize,
-                                              bool transparent,
-                                              VkDeviceSize& outVertexOffset, VkDeviceSize& outIndexOffset) {
+bool VulkanRenderer::allocateMegaBufferSpace(VkDeviceSize vertexSize, bool transparent,
+                                              VkDeviceSize& outVertexOffset) {
     std::lock_guard<std::mutex> lock(m_megaBufferMutex);
 
-    if (transparent) {
-        // Check if there's enough space in transparent mega-buffers
-        if (m_megaTransparentVertexOffset + vertexSize > MEGA_BUFFER_VERTEX_SIZE ||
-            m_megaTransparentIndexOffset + indexSize > MEGA_BUFFER_INDEX_SIZE) {
-            std::cerr << "Warning: Transparent mega-buffer full!" << '\n';
-            return false;
-        }
-
-        outVertexOffset = m_megaTransparentVertexOffset;
-        outIndexOffset = m_megaTransparentIndexOffset;
-
-        m_megaTransparentVertexOffset += vertexSize;
-        m_megaTransparentIndexOffset += indexSize;
-    } else {
-        // Check if there's enough space in opaque mega-buffers
-        if (m_megaVertexOffset + vertexSize > MEGA_BUFFER_VERTEX_SIZE ||
-            m_megaIndexOffset + indexSize > MEGA_BUFFER_INDEX_SIZE) {
-            std::cerr << "Warning: Opaque mega-buffer full!" << '\n';
-            return false;
-        }
-
-        outVertexOffset = m_megaVertexOffset;
-        outIndexOffset = m_megaIndexOffset;
+    VkDeviceSize& writeOffset = transparent ? m_megaTransparentVertexOffset : m_megaVertexOffset;
 
-        m_megaVertexOffset += vertexSize;
-        m_megaIndexOffset += indexSize;
+    // Check if there's enough space in the mega-buffer
+    if (writeOffset + vertexSize > MEGA_BUFFER_VERTEX_SIZE) {
+        std::cerr << "Warning: " << (transparent ? "Transparent" : "Opaque") << " mega-buffer full!" << '\n';
+        return false;
     }
 
+    outVertexOffset = writeOffset;
+    writeOffset += vertexSize;
+
     return true;
 }
 
 void VulkanRenderer::uploadToMegaBuffer(const void* vertexData, VkDeviceSize vertexSize,
-                                        const void* indexData, VkDeviceSize indexSize,
-                                        VkDeviceSize vertexOffset, VkDeviceSize indexOffset,
-                                        bool transparent) {
-    // Create staging buffers
-    VkBuffer vertexStagingBuffer, indexStagingBuffer;
-    VkDeviceMemory vertexStagingMemory, indexStagingMemory;
-
-    // Vertex staging buffer
+                                        VkDeviceSize vertexOffset, bool transparent) {
+    // Create staging buffer
+    VkBuffer vertexStagingBuffer;
+    VkDeviceMemory vertexStagingMemory;
+
     createBuffer(
         vertexSize,
         VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
@@ -2617,26 +2751,13 @@ void VulkanRenderer::uploadToMegaBuffer(const void* vertexData, VkDeviceSize ver
         vertexStagingMemory
     );
 
-    // Index staging buffer
-    createBuffer(
-        indexSize,
-        VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
-        VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
-        indexStagingBuffer,
-        indexStagingMemory
-    );
-
-    // Copy data to staging buffers
+    // Copy data to staging buffer
     void* data;
     vkMapMemory(m_device, vertexStagingMemory, 0, vertexSize, 0, &data);
     memcpy(data, vertexData, vertexSize);
     vkUnmapMemory(m_device, vertexStagingMemory);
 
-    vkMapMemory(m_device, indexStagingMemory, 0, indexSize, 0, &data);
-    memcpy(data, indexData, indexSize);
-    vkUnmapMemory(m_device, indexStagingMemory);
-
-    // Copy staging buffers to mega-buffers at specified offsets
+    // Copy staging buffer to mega-buffer at specified offset
     VkCommandBuffer commandBuffer = beginSingleTimeCommands();
 
     VkBufferCopy vertexCopyRegion{};
@@ -2644,26 +2765,15 @@ void VulkanRenderer::uploadToMegaBuffer(const void* vertexData, VkDeviceSize ver
     vertexCopyRegion.dstOffset = vertexOffset;
     vertexCopyRegion.size = vertexSize;
 
-    VkBufferCopy indexCopyRegion{};
-    indexCopyRegion.srcOffset = 0;
-    indexCopyRegion.dstOffset = indexOffset;
-    indexCopyRegion.size = indexSize;
-
     vkCmdCopyBuffer(commandBuffer, vertexStagingBuffer,
                    transparent ? m_megaTransparentVertexBuffer : m_megaVertexBuffer,
                    1, &vertexCopyRegion);
-    
-    vkCmdCopyBuffer(commandBuffer, indexStagingBuffer,
-                   transparent ? m_megaTransparentIndexBuffer : m_megaIndexBuffer,
-                   1, &indexCopyRegion);
 
     endSingleTimeCommands(commandBuffer);
 
-    // Cleanup staging buffers
+    // Cleanup staging buffer
     vkDestroyBuffer(m_device, vertexStagingBuffer, nullptr);
     vkFreeMemory(m_device, vertexStagingMemory, nullptr);
-    vkDestroyBuffer(m_device, indexStagingBuffer, nullptr);
-    vkFreeMemory(m_device, indexStagingMemory, nullptr);
 }
 
 void VulkanRenderer::bindPipelineCached(VkCommandBuffer commandBuffer, VkPipeline pipeline) {
@@ -2677,6 +2787,21 @@ void VulkanRenderer::resetPipelineCache() {
     m_currentlyBoundPipeline = VK_NULL_HANDLE;
 }
 
+void VulkanRenderer::pushChunkLightBlend(VkCommandBuffer commandBuffer, float lightBlend) {
+    ChunkPushConstants constants;
+    constants.lightBlend = lightBlend;
+    vkCmdPushConstants(commandBuffer, m_pipelineLayout, VK_SHADER_STAGE_VERTEX_BIT,
+                       0, sizeof(ChunkPushConstants), &constants);
+}
+
+bool VulkanRenderer::supportsMultiDrawIndirect() const {
+    return m_vulkanContext && m_vulkanContext->getEnabledFeatures().multiDrawIndirect == VK_TRUE;
+}
+
+bool VulkanRenderer::supportsIndirectFirstInstance() const {
+    return m_vulkanContext && m_vulkanContext->getEnabledFeatures().drawIndirectFirstInstance == VK_TRUE;
+}
+
 void VulkanRenderer::bindMeshDescriptorSets(VkCommandBuffer cmd, VkDescriptorSet textureDescriptorSet,
                                             VkDescriptorSet boneDescriptorSet) {
     // Bind the camera descriptor set (set 0)
@@ -2689,34 +2814,16 @@ void VulkanRenderer::bindMeshDescriptorSets(VkCommandBuffer cmd, VkDescriptorSet
                                 1, 1, &textureDescriptorSet, 0, nullptr);
     }
 
-    // Bind the bone descriptor set (set 2) if provided for skeletal animation
+    // Bind the bone + instance table descriptor set (set 2)
     if (boneDescriptorSet != VK_NULL_HANDLE) {
         vkCmdBindDescriptorSets(cmd, VK_PIPELINE_BIND_POINT_GRAPHICS, m_meshPipelineLayout,
                                 2, 1, &boneDescriptorSet, 0, nullptr);
     }
 }
 
-void VulkanRenderer::pushMeshMaterialConstants(VkCommandBuffer cmd, int32_t albedoTexIndex, int32_t normalTexIndex,
-                                                float metallic, float roughness) {
-    struct MaterialPushConstant {
-        int32_t albedoTexIndex;
-        int32_t normalTexIndex;
-        float metallic;
-        float roughness;
-    } pushData;
-
-    pushData.albedoTexIndex = albedoTexIndex;
-    pushData.normalTexIndex = normalTexIndex;
-    pushData.metallic = metallic;
-    pushData.roughness = roughness;
-
-    vkCmdPushConstants(cmd, m_meshPipelineLayout, VK_SHADER_STAGE_FRAGMENT_BIT, 0, sizeof(pushData), &pushData);
-}
-
-void VulkanRenderer::batchCopyToMegaBuffer(VkBuffer srcVertexBuffer, VkBuffer srcIndexBuffer,
-                                           VkDeviceSize vertexSize, VkDeviceSize indexSize,
-                                           VkDeviceSize vertexOffset, VkDeviceSize indexOffset,
-                                           bool transparent) {
+void VulkanRenderer::batchCopyToMegaBuffer(VkBuffer srcVertexBuffer, VkDeviceSize vertexSize,
+                                           VkDeviceSize vertexOffset, bool transparent,
+                                           VkDeviceSize srcVertexOffset) {
     if (m_batchCommandBuffer == VK_NULL_HANDLE) {
         std::cerr << "Error: No batch command buffer active. Call beginBufferCopyBatch() first." << '\n';
         return;
@@ -2724,23 +2831,13 @@ void VulkanRenderer::batchCopyToMegaBuffer(VkBuffer srcVertexBuffer, VkBuffer sr
 
     // Copy vertex data to mega-buffer at offset
     VkBufferCopy vertexCopyRegion{};
-    vertexCopyRegion.srcOffset = 0;
+    vertexCopyRegion.srcOffset = srcVertexOffset;
     vertexCopyRegion.dstOffset = vertexOffset;
     vertexCopyRegion.size = vertexSize;
 
     vkCmdCopyBuffer(m_batchCommandBuffer, srcVertexBuffer,
                    transparent ? m_megaTransparentVertexBuffer : m_megaVertexBuffer,
                    1, &vertexCopyRegion);
-
-    // Copy index data to mega-buffer at offset
-    VkBufferCopy indexCopyRegion{};
-    indexCopyRegion.srcOffset = 0;
-    indexCopyRegion.dstOffset = indexOffset;
-    indexCopyRegion.size = indexSize;
-
-    vkCmdCopyBuffer(m_batchCommandBuffer, srcIndexBuffer,
-                   transparent ? m_megaTransparentIndexBuffer : m_megaIndexBuffer,
-                   1, &indexCopyRegion);
 }
 
 void VulkanRenderer::resetMegaBuffers() {
@@ -2750,9 +2847,7 @@ void VulkanRenderer::resetMegaBuffers() {
     
     // Reset allocation offsets to beginning
     m_megaVertexOffset = 0;
-    m_megaIndexOffset = 0;
     m_megaTransparentVertexOffset = 0;
-    m_megaTransparentIndexOffset = 0;
     
     Logger::info() << "Mega-buffers reset complete - all space reclaimed";
 }
@@ -255,7 +255,7 @@ bool WaterSimulation::isNaturalWater(int y) const {
     return y <= TerrainGeneration::WATER_LEVEL;
 }
 
-void WaterSimulation::triggerWaterFlow(int brokenX, int brokenY, int brokenZ, World* world, bool lockHeld) {
+void WaterSimulation::triggerWaterFlow(int brokenX, int brokenY, int brokenZ, World* world) {
     if (!world) return;
 
     std::cerr << "[DEBUG] triggerWaterFlow called at (" << brokenX << ", " << brokenY << ", " << brokenZ << ")" << std::endl;
@@ -263,26 +263,13 @@ void WaterSimulation::triggerWaterFlow(int brokenX, int brokenY, int brokenZ, Wo
     constexpr int BLOCK_WATER = 5;
     glm::ivec3 brokenPos(brokenX, brokenY, brokenZ);
 
-    // Helper lambdas to use safe or unsafe methods based on lockHeld
-    // IMPORTANT: When lockHeld=true, caller already holds World's chunk mutex
-    // Using the locking versions would cause deadlock (recursive lock on shared_mutex)
-    auto getBlock = [world, lockHeld](int x, int y, int z) -> int {
-        float fx = static_cast<float>(x);
-        float fy = static_cast<float>(y);
-        float fz = static_cast<float>(z);
-        return lockHeld ? world->getBlockAtUnsafe(fx, fy, fz)
-                       : world->getBlockAt(fx, fy, fz);
+    // Helper lambdas for integer block coordinates (World lookups lock one chunk map shard each)
+    auto getBlock = [world](int x, int y, int z) -> int {
+        return world->getBlockAt(static_cast<float>(x), static_cast<float>(y), static_cast<float>(z));
     };
 
-    auto setBlock = [world, lockHeld](int x, int y, int z, int blockID) {
-        float fx = static_cast<float>(x);
-        float fy = static_cast<float>(y);
-        float fz = static_cast<float>(z);
-        if (lockHeld) {
-            world->setBlockAtUnsafe(fx, fy, fz, blockID);
-        } else {
-            world->setBlockAt(fx, fy, fz, blockID, false);
-        }
+    auto setBlock = [world](int x, int y, int z, int blockID) {
+        world->setBlockAt(static_cast<float>(x), static_cast<float>(y), static_cast<float>(z), blockID, false);
     };
 
     // Check all 6 adjacent blocks for water
@@ -356,10 +343,10 @@ void WaterSimulation::triggerWaterFlow(int brokenX, int brokenY, int brokenZ, Wo
         // CRITICAL: Queue for spread so water continues flowing!
         queueSpread(brokenPos);
 
-        // Sync to chunk and mark dirty (pass lockHeld through to avoid deadlock)
+        // Sync to chunk and mark dirty
         Logger::info() << "WATER FLOW: Placing water at (" << brokenX << "," << brokenY << "," << brokenZ
                        << ") level=" << (int)newLevel << " visualLevel=" << (int)(LEVEL_SOURCE - newLevel);
-        syncToChunk(brokenPos, newLevel, world, lockHeld);
+        syncToChunk(brokenPos, newLevel, world);
         markChunkDirtyAt(brokenPos);
 
         // Also mark adjacent chunks dirty for face updates
@@ -682,7 +669,7 @@ void WaterSimulation::removeWaterCell(const glm::ivec3& pos, World* world) {
     markChunkDirtyAt(pos);
 }
 
-void WaterSimulation::syncToChunk(const glm::ivec3& pos, uint8_t level, World* world, bool lockHeld) {
+void WaterSimulation::syncToChunk(const glm::ivec3& pos, uint8_t level, World* world) {
     if (!world) return;
 
     // =========================================================================
@@ -704,22 +691,13 @@ void WaterSimulation::syncToChunk(const glm::ivec3& pos, uint8_t level, World* w
 
     if (level > 0) {
         // Place water block if not already water
-        int currentBlock = lockHeld ? world->getBlockAtUnsafe(worldX, worldY, worldZ)
-                                    : world->getBlockAt(worldX, worldY, worldZ);
+        int currentBlock = world->getBlockAt(worldX, worldY, worldZ);
         if (currentBlock == 0) {  // Only place water in air blocks
-            if (lockHeld) {
-                world->setBlockAtUnsafe(worldX, worldY, worldZ, BLOCK_WATER);
-            } else {
-                world->setBlockAt(worldX, worldY, worldZ, BLOCK_WATER, false);
-            }
+            world->setBlockAt(worldX, worldY, worldZ, BLOCK_WATER, false);
         }
 
         // Set metadata using World's method (handles coordinates correctly)
-        if (lockHeld) {
-            world->setBlockMetadataAtUnsafe(worldX, worldY, worldZ, visualLevel);
-        } else {
-            world->setBlockMetadataAt(worldX, worldY, worldZ, visualLevel);
-        }
+        world->setBlockMetadataAt(worldX, worldY, worldZ, visualLevel);
 
         std::cerr << "[DEBUG] syncToChunk: Set metadata at (" << pos.x << "," << pos.y << "," << pos.z
                   << ") level=" << (int)level << " visualLevel=" << (int)visualLevel << std::endl;
@@ -737,11 +715,8 @@ bool WaterSimulation::isBlockSolid(int x, int y, int z, World* world) const {
     int blockID = world->getBlockAt(x, y, z);
     if (blockID == 0) return false;  // Air
 
-    auto& registry = BlockRegistry::instance();
-    if (blockID < 0 || blockID >= registry.count()) return false;
-
-    const BlockDefinition& blockDef = registry.get(blockID);
-    return !blockDef.isLiquid;
+    // Solid = registered, not air, not liquid (unknown IDs have no flags)
+    return BlockRegistry::instance().properties().isSolid(blockID);
 }
 
 bool WaterSimulation::canWaterFlowTo(int x, int y, int z, World* world) const {
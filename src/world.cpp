@@ -14,19 +14,27 @@
  */
 
 #include "world.h"
+#include "profiler.h"
 #include "world_utils.h"
 #include <iostream>
 #include "world_constants.h"
 #include "world_streaming.h"
+#include "chunk_trace.h"
 #include "terrain_constants.h"
 #include "vulkan_renderer.h"
+#include "quad_index.h"
 #include "frustum.h"
 #include "debug_state.h"
+#include "convar.h"
 #include "logger.h"
 #include "block_system.h"
 #include "biome_system.h"
 #include "lighting_system.h"
+#include "block_tick_system.h"
 #include "tree_generator.h"
+#include "structure_template.h"
+#include "structure_placement.h"
+#include "structure_system.h"
 #include <glm/glm.hpp>
 #include <thread>
 #include <future>
@@ -53,6 +61,24 @@
 constexpr bool ENABLE_NATURAL_OCEANS = true;
 constexpr int OCEAN_DEPTH_THRESHOLD = 8;  // Blocks below water level to trigger ocean
 
+// ========== CHUNK CACHE BUDGETS ==========
+
+namespace {
+
+ConVar<int> g_chunkCacheHotMB(
+    "chunk_cache_hot_mb",
+    "RAM budget for unloaded chunks kept as full chunk objects (MB)",
+    256,
+    FCVAR_ARCHIVE | FCVAR_NOTIFY);
+
+ConVar<int> g_chunkCacheWarmMB(
+    "chunk_cache_warm_mb",
+    "RAM budget for unloaded chunks kept RLE-encoded (MB)",
+    128,
+    FCVAR_ARCHIVE | FCVAR_NOTIFY);
+
+} // namespace
+
 // ====================================================
 
 World::World(int width, int height, int depth, int seed, float tempBias, float moistBias, float ageBias)
@@ -98,6 +124,9 @@ World::World(int width, int height, int depth, int seed, float tempBias, float m
     BiomeRegistry::getInstance().generateTreeTemplates(m_treeGenerator.get());
     Logger::info() << "Generated unique tree templates for each biome";
 
+    // Worldgen structures (StructureRegistry must be loaded before the world is created)
+    reloadStructurePlacement();
+
     // Initialize water simulation and particle systems
     m_waterSimulation = std::make_unique<WaterSimulation>();
     m_particleSystem = std::make_unique<ParticleSystem>();
@@ -107,16 +136,20 @@ World::World(int width, int height, int depth, int seed, float tempBias, float m
     // Initialize lighting system
     m_lightingSystem = std::make_unique<LightingSystem>(this);
     Logger::info() << "Lighting system initialized";
+
+    // Initialize block tick system (pending ticks live in each chunk's timing wheel)
+    m_blockTickSystem = std::make_unique<BlockTickSystem>(this);
+    Logger::info() << "Block tick system initialized";
 }
 
 World::~World() {
     Logger::info() << "Destroying World...";
 
     // unique_ptr in m_chunkMap automatically cleans up - no manual delete needed
-    // m_chunks vector only contains non-owning pointers, so no cleanup needed
+    // Snapshots only contain non-owning pointers, so no cleanup needed
     // This could take time with many chunks (e.g., 128x3x128 = 49,152 chunks)
 
-    Logger::info() << "World destroyed (" << m_chunks.size() << " chunks)";
+    Logger::info() << "World destroyed (" << m_chunkMap.size() << " chunks)";
 }
 
 void World::generateSpawnChunks(int centerChunkX, int centerChunkY, int centerChunkZ, int radius) {
@@ -154,10 +187,8 @@ void World::generateSpawnChunks(int centerChunkX, int centerChunkY, int centerCh
     std::vector<Chunk*> innerChunks;        // Within spawn radius (for decoration)
     std::vector<Chunk*> innerSurfaceChunks; // Inner surface chunks needing decoration
 
-    // THREAD SAFETY: Acquire unique lock for chunk creation
+    // THREAD SAFETY: Each lookup/insert locks only the coordinate's shard
     {
-        std::unique_lock<std::shared_mutex> lock(m_chunkMapMutex);
-
         for (int dx = -TERRAIN_BUFFER_RADIUS; dx <= TERRAIN_BUFFER_RADIUS; dx++) {
             // Y range: surface up to TERRAIN_BUFFER_RADIUS, underground down to UNDERGROUND_DEPTH
             for (int dy = -UNDERGROUND_DEPTH; dy <= TERRAIN_BUFFER_RADIUS; dy++) {
@@ -168,15 +199,16 @@ void World::generateSpawnChunks(int centerChunkX, int centerChunkY, int centerCh
 
                     // Create chunk if it doesn't exist (using chunk pool!)
                     ChunkCoord coord{chunkX, chunkY, chunkZ};
-                    if (m_chunkMap.find(coord) == m_chunkMap.end()) {
+                    Chunk* chunkPtr = m_chunkMap.find(coord);
+                    if (!chunkPtr) {
                         auto chunk = acquireChunk(chunkX, chunkY, chunkZ);
-                        Chunk* chunkPtr = chunk.get();
-                        m_chunkMap[coord] = std::move(chunk);
-                        m_chunks.push_back(chunkPtr);
+                        chunkPtr = chunk.get();
+                        if (!m_chunkMap.insert(coord, std::move(chunk))) {
+                            releaseChunk(std::move(chunk));  // Inserted concurrently
+                            chunkPtr = m_chunkMap.find(coord);
+                        }
                     }
 
-                    Chunk* chunkPtr = m_chunkMap[coord].get();
-
                     // Split by surface/underground for parallel generation
                     if (chunkY >= 0) {
                         surfaceChunks.push_back(chunkPtr);
@@ -222,6 +254,7 @@ void World::generateSpawnChunks(int centerChunkX, int centerChunkY, int centerCh
             size_t idx = terrainIndex.fetch_add(1, std::memory_order_relaxed);
             if (idx < surfaceChunks.size()) {
                 surfaceChunks[idx]->generate(biomeMapPtr);
+                placeGeneratedStructures(surfaceChunks[idx]);
                 terrainGenerated++;
                 continue;
             }
@@ -270,6 +303,7 @@ void World::generateSpawnChunks(int centerChunkX, int centerChunkY, int centerCh
             }
 
             undergroundChunks[idx]->generate(biomeMapPtr);
+            placeGeneratedStructures(undergroundChunks[idx]);
             chunksGenerated++;
         }
 
@@ -317,9 +351,8 @@ void World::generateWorld() {
     Logger::warning() << "generateWorld() called - this is slow for large worlds!";
     Logger::warning() << "Consider using generateSpawnChunks() + WorldStreaming for better performance";
 
-    if (m_chunks.empty()) {
+    if (m_chunkMap.empty()) {
         Logger::info() << "Creating all chunks for world bounds (test mode)";
-        std::unique_lock<std::shared_mutex> lock(m_chunkMapMutex);
 
         int halfWidth = m_width / 2;
         int halfHeight = m_height / 2;
@@ -328,24 +361,25 @@ void World::generateWorld() {
         for (int x = -halfWidth; x < m_width - halfWidth; x++) {
             for (int y = -halfHeight; y < m_height - halfHeight; y++) {
                 for (int z = -halfDepth; z < m_depth - halfDepth; z++) {
-                    auto chunk = acquireChunk(x, y, z);
-                    Chunk* chunkPtr = chunk.get();
-                    m_chunkMap[{x, y, z}] = std::move(chunk);
-                    m_chunks.push_back(chunkPtr);
+                    m_chunkMap.insert(ChunkCoord{x, y, z}, acquireChunk(x, y, z));
                 }
             }
         }
-        Logger::info() << "Created " << m_chunks.size() << " chunks";
+        Logger::info() << "Created " << m_chunkMap.size() << " chunks";
     }
 
+    // One snapshot for both passes (no chunks are added or removed meanwhile)
+    const ShardedChunkMap::Snapshot chunkSnapshot = m_chunkMap.snapshot();
+    const std::vector<Chunk*>& chunks = *chunkSnapshot;
+
     // Parallel chunk generation for better performance
     unsigned int numThreads = std::thread::hardware_concurrency();
     if (numThreads == 0) {
         // hardware_concurrency() can return 0 in containers/CI environments
-        numThreads = std::min<unsigned int>(static_cast<unsigned int>(m_chunks.size()), 4);
+        numThreads = std::min<unsigned int>(static_cast<unsigned int>(chunks.size()), 4);
         Logger::warning() << "hardware_concurrency() returned 0, using fallback: " << numThreads << " threads";
     }
-    const size_t chunksPerThread = (m_chunks.size() + numThreads - 1) / numThreads;
+    const size_t chunksPerThread = (chunks.size() + numThreads - 1) / numThreads;
 
     std::vector<std::thread> threads;
     threads.reserve(numThreads);
@@ -354,13 +388,14 @@ void World::generateWorld() {
     BiomeMap* biomeMapPtr = m_biomeMap.get();
     for (unsigned int i = 0; i < numThreads; ++i) {
         size_t startIdx = i * chunksPerThread;
-        size_t endIdx = std::min(startIdx + chunksPerThread, m_chunks.size());
+        size_t endIdx = std::min(startIdx + chunksPerThread, chunks.size());
 
-        if (startIdx >= m_chunks.size()) break;
+        if (startIdx >= chunks.size()) break;
 
-        threads.emplace_back([this, biomeMapPtr, startIdx, endIdx]() {
+        threads.emplace_back([this, &chunks, biomeMapPtr, startIdx, endIdx]() {
             for (size_t j = startIdx; j < endIdx; ++j) {
-                m_chunks[j]->generate(biomeMapPtr);
+                chunks[j]->generate(biomeMapPtr);
+                placeGeneratedStructures(chunks[j]);
             }
         });
     }
@@ -375,13 +410,13 @@ void World::generateWorld() {
     threads.clear();
     for (unsigned int i = 0; i < numThreads; ++i) {
         size_t startIdx = i * chunksPerThread;
-        size_t endIdx = std::min(startIdx + chunksPerThread, m_chunks.size());
+        size_t endIdx = std::min(startIdx + chunksPerThread, chunks.size());
 
-        if (startIdx >= m_chunks.size()) break;
+        if (startIdx >= chunks.size()) break;
 
-        threads.emplace_back([this, startIdx, endIdx]() {
+        threads.emplace_back([this, &chunks, startIdx, endIdx]() {
             for (size_t j = startIdx; j < endIdx; ++j) {
-                m_chunks[j]->generateMesh(this);
+                chunks[j]->generateMesh(this);
             }
         });
     }
@@ -414,9 +449,8 @@ void World::decorateWorld() {
     // Get all surface chunks (Y > 0) that exist in the world
     std::vector<Chunk*> surfaceChunks;
     {
-        std::shared_lock<std::shared_mutex> lock(m_chunkMapMutex);
-        for (const auto& pair : m_chunkMap) {
-            Chunk* chunk = pair.second.get();
+        const ShardedChunkMap::Snapshot chunks = m_chunkMap.snapshot();
+        for (Chunk* chunk : *chunks) {
             if (chunk->getChunkY() >= 0) {  // Surface chunks only
                 surfaceChunks.push_back(chunk);
             }
@@ -515,9 +549,8 @@ void World::decorateWorld() {
     // Get all underground chunks for underground decoration
     std::vector<Chunk*> undergroundChunks;
     {
-        std::shared_lock<std::shared_mutex> lock(m_chunkMapMutex);
-        for (const auto& pair : m_chunkMap) {
-            Chunk* chunk = pair.second.get();
+        const ShardedChunkMap::Snapshot chunks = m_chunkMap.snapshot();
+        for (Chunk* chunk : *chunks) {
             if (chunk->getChunkY() < 0) {  // Underground chunks only
                 undergroundChunks.push_back(chunk);
             }
@@ -596,7 +629,7 @@ void World::decorateWorld() {
     }
 
     Logger::info() << "Regenerated " << modifiedChunksVec.size() << " chunk meshes in parallel (out of "
-                   << m_chunks.size() << " total chunks)";
+                   << m_chunkMap.size() << " total chunks)";
 }
 
 bool World::hasHorizontalNeighbors(Chunk* chunk) {
@@ -645,7 +678,22 @@ bool World::hasHorizontalNeighbors(Chunk* chunk) {
     return northOk && southOk && eastOk && westOk;
 }
 
+void World::queueDecoration(Chunk* chunk) {
+    if (!chunk || !chunk->needsDecoration() || chunk->getChunkY() < 0) {
+        return;  // Decorated already, or underground (never decorated)
+    }
+
+    // DEADLOCK FIX (2025-11-24): Track when chunk was added to queue for timeout-based processing
+    std::lock_guard<std::mutex> lock(m_pendingDecorationsMutex);
+    if (m_pendingDecorations.find(chunk) == m_pendingDecorations.end()) {
+        m_pendingDecorations.insert(chunk);
+        m_pendingDecorationTimestamps[chunk] = std::chrono::steady_clock::now();
+    }
+}
+
 void World::processPendingDecorations(VulkanRenderer* renderer, WorldStreaming* streaming, int maxChunks) {
+    PROFILE_ZONE("process_pending_decorations");
+
     // ============================================================================
     // ASYNC DECORATION PIPELINE (2025-11-24): NEVER block main thread!
     // ============================================================================
@@ -861,7 +909,32 @@ void World::processPendingDecorations(VulkanRenderer* renderer, WorldStreaming*
     // Next frame will pick up completed work in PHASE 1
 }
 
+void World::placeGeneratedStructures(Chunk* chunk) {
+    // Snapshot: a concurrent reloadStructurePlacement() can't free it under us
+    const std::shared_ptr<const StructurePlacement> placement = std::atomic_load(&m_structurePlacement);
+    if (!chunk || !placement) return;
+
+    PROFILE_ZONE("place_structures");
+
+    // PERFORMANCE (2025-11-28): Sites are a pure function of (seed, region, BiomeMap), so
+    // each chunk resolves and blits its own slice with no cross-chunk locking or ordering
+    if (placement->placeInChunk(chunk) > 0) {
+        markChunkDirty(chunk->getChunkX(), chunk->getChunkY(), chunk->getChunkZ());
+    }
+}
+
+void World::reloadStructurePlacement() {
+    // Built from copies of the registry definitions, then published whole
+    auto placement = std::make_shared<StructurePlacement>(m_seed, m_biomeMap.get());
+    placement->addStructures(StructureRegistry::instance().getGeneratedStructures());
+    Logger::info() << "Structure placement initialized with " << placement->getStructureCount()
+                   << " worldgen structure(s)";
+    std::atomic_store(&m_structurePlacement, std::shared_ptr<const StructurePlacement>(std::move(placement)));
+}
+
 void World::decorateChunk(Chunk* chunk) {
+    PROFILE_ZONE("decorate_chunk");
+
     using namespace TerrainGeneration;
 
     if (!chunk || chunk->getChunkY() < 0) {
@@ -873,6 +946,7 @@ void World::decorateChunk(Chunk* chunk) {
     int chunkX = chunk->getChunkX();
     int chunkY = chunk->getChunkY();
     int chunkZ = chunk->getChunkZ();
+    ChunkTraceSpan span(ChunkTraceStage::DECORATE, chunkX, chunkY, chunkZ);
 
     // Hash chunk coords into seed (same chunk coords always give same seed)
     uint64_t chunkSeed = m_seed + 77777;  // Decoration offset
@@ -970,6 +1044,8 @@ void World::decorateChunk(Chunk* chunk) {
 }
 
 void World::initializeChunkLighting(Chunk* chunk) {
+    PROFILE_ZONE("initialize_chunk_lighting");
+
     if (!chunk || !m_lightingSystem) return;
 
     // ========== OPTIMIZATION (2025-11-25): SKIP SCAN IF NO EMISSIVE BLOCKS EXIST ==========
@@ -985,100 +1061,73 @@ void World::initializeChunkLighting(Chunk* chunk) {
 
     // FAST PATH: No emissive blocks defined - skip entire scan!
     if (emissiveBlockIDs.empty()) {
-        chunk->initializeInterpolatedLighting();
         return;
     }
 
     // SLOW PATH: Emissive blocks exist - scan only for those specific block IDs
-    // Build a fast lookup set for O(1) checking
-    std::unordered_set<int> emissiveSet(emissiveBlockIDs.begin(), emissiveBlockIDs.end());
+    // PERFORMANCE (2025-11-28): One byte load from the flat property table per block
+    // (was an unordered_set hash lookup plus registry.get() per emissive hit)
+    const BlockPropertyTable& props = BlockRegistry::instance().properties();
 
+    // PERFORMANCE (2025-11-28): Only 8³ bricks holding non-air blocks are scanned
     int foundCount = 0;
-    for (int x = 0; x < Chunk::WIDTH; x++) {
-        for (int y = 0; y < Chunk::HEIGHT; y++) {
-            for (int z = 0; z < Chunk::DEPTH; z++) {
-                int blockID = chunk->getBlock(x, y, z);
+    ChunkBricks::forEachBlock(chunk->getBricks().occupied(), [&](int x, int y, int z) {
+        int blockID = chunk->getBlock(x, y, z);
 
-                // Only check if this block ID is in our emissive set
-                if (emissiveSet.count(blockID)) {
-                    try {
-                        const auto& blockDef = BlockRegistry::instance().get(blockID);
-                        // Found emissive block - add as block light source
-                        int worldX = (chunk->getChunkX() << 5) + x;
-                        int worldY = (chunk->getChunkY() << 5) + y;
-                        int worldZ = (chunk->getChunkZ() << 5) + z;
-
-                        m_lightingSystem->addLightSource(
-                            glm::vec3(worldX, worldY, worldZ),
-                            blockDef.lightLevel
-                        );
-                        foundCount++;
-                    } catch (...) {
-                        // Unknown block, skip
-                    }
-                }
-            }
+        // Only check if this block ID is emissive
+        if (props.isEmissive(blockID)) {
+            // Found emissive block - add as block light source
+            int worldX = (chunk->getChunkX() << 5) + x;
+            int worldY = (chunk->getChunkY() << 5) + y;
+            int worldZ = (chunk->getChunkZ() << 5) + z;
+
+            m_lightingSystem->addLightSource(
+                glm::vec3(worldX, worldY, worldZ),
+                props.lightLevel(blockID)
+            );
+            foundCount++;
         }
-    }
+    });
 
     if (foundCount > 0) {
         Logger::debug() << "Chunk (" << chunk->getChunkX() << ", " << chunk->getChunkY()
                        << ", " << chunk->getChunkZ() << ") has " << foundCount << " light sources";
     }
-
-    // Initialize interpolated lighting values to match target values
-    // This prevents fade-in effect on newly loaded chunks
-    chunk->initializeInterpolatedLighting();
-}
-
-void World::updateInterpolatedLighting(float deltaTime) {
-    // Update interpolated lighting for all loaded chunks
-    // This creates smooth, natural lighting transitions over time
-    std::shared_lock<std::shared_mutex> lock(m_chunkMapMutex);
-
-    for (auto& chunk : m_chunks) {
-        if (chunk) {
-            chunk->updateInterpolatedLighting(deltaTime);
-        }
-    }
 }
 
 void World::registerWaterInChunk(Chunk* chunk) {
     if (!chunk) return;
 
-    auto& registry = BlockRegistry::instance();
+    const BlockPropertyTable& props = BlockRegistry::instance().properties();
     int chunkX = chunk->getChunkX();
     int chunkY = chunk->getChunkY();
     int chunkZ = chunk->getChunkZ();
 
-    // Scan all blocks in chunk
-    for (int localX = 0; localX < Chunk::WIDTH; localX++) {
-        for (int localY = 0; localY < Chunk::HEIGHT; localY++) {
-            for (int localZ = 0; localZ < Chunk::DEPTH; localZ++) {
-                int blockID = chunk->getBlock(localX, localY, localZ);
-
-                // Check if this is a liquid block
-                if (blockID > 0 && blockID < registry.count() && registry.get(blockID).isLiquid) {
-                    // Calculate world coordinates
-                    int worldX = chunkX * Chunk::WIDTH + localX;
-                    int worldY = chunkY * Chunk::HEIGHT + localY;
-                    int worldZ = chunkZ * Chunk::DEPTH + localZ;
-
-                    // Register with simulation system
-                    m_waterSimulation->setWaterLevel(worldX, worldY, worldZ, 255, 1);
-
-                    // FIXED (2025-11-23): Mark naturally generated water as sources so they flow
-                    // Water blocks with metadata=0 are source blocks (oceans, lakes, placed water)
-                    // This makes them maintain their level and flow continuously like Minecraft
-                    uint8_t metadata = chunk->getBlockMetadata(localX, localY, localZ);
-                    if (metadata == 0) {
-                        glm::ivec3 waterPos(worldX, worldY, worldZ);
-                        m_waterSimulation->addWaterSource(waterPos, 1);
-                    }
-                }
+    // Scan the 8³ bricks that can hold liquid: not all air, not all solid (liquids are never solid)
+    const ChunkBricks& bricks = chunk->getBricks();
+    ChunkBricks::forEachBlock(bricks.occupied() & ~bricks.opaque(), [&](int localX, int localY, int localZ) {
+        int blockID = chunk->getBlock(localX, localY, localZ);
+
+        // Check if this is a liquid block
+        if (props.isLiquid(blockID)) {
+            // Calculate world coordinates
+            int worldX = chunkX * Chunk::WIDTH + localX;
+            int worldY = chunkY * Chunk::HEIGHT + localY;
+            int worldZ = chunkZ * Chunk::DEPTH + localZ;
+
+            // Register with simulation system
+            m_waterSimulation->setWaterLevel(worldX, worldY, worldZ, 255, 1);
+
+            // FIXED (2025-11-23): Mark naturally generated water as sources so they flow
+            // Water blocks with metadata=0 are source blocks (oceans, lakes, placed water)
+            // This makes them maintain their level and flow continuously like Minecraft
+            uint8_t metadata = chunk->getBlockMetadata(localX, localY, localZ);
+            if (metadata == 0) {
+                glm::ivec3 waterPos(worldX, worldY, worldZ);
+                m_waterSimulation->addWaterSource(waterPos, 1);
             }
         }
-    }
+    });
 }
 
 void World::registerWaterBlocks() {
@@ -1087,10 +1136,10 @@ void World::registerWaterBlocks() {
     int waterBlocksFound = 0;
     int waterSourcesCreated = 0;
 
-    std::shared_lock<std::shared_mutex> lock(m_chunkMapMutex);
+    const ShardedChunkMap::Snapshot chunks = m_chunkMap.snapshot();
 
     // Register water in all existing chunks
-    for (auto& chunk : m_chunks) {
+    for (Chunk* chunk : *chunks) {
         size_t beforeSize = m_waterSimulation->getActiveWaterChunks().size();
         registerWaterInChunk(chunk);
         size_t afterSize = m_waterSimulation->getActiveWaterChunks().size();
@@ -1099,15 +1148,15 @@ void World::registerWaterBlocks() {
         waterBlocksFound += (afterSize - beforeSize) * 64;  // Rough estimate
     }
 
-    Logger::info() << "Registered water blocks in " << m_chunks.size() << " chunks with simulation";
+    Logger::info() << "Registered water blocks in " << chunks->size() << " chunks with simulation";
 }
 
 void World::createBuffers(VulkanRenderer* renderer) {
-    std::shared_lock<std::shared_mutex> lock(m_chunkMapMutex);
+    const ShardedChunkMap::Snapshot chunks = m_chunkMap.snapshot();
 
     renderer->beginBufferCopyBatch();
 
-    for (auto& chunk : m_chunks) {
+    for (Chunk* chunk : *chunks) {
         if (chunk->getVertexCount() > 0 || chunk->getTransparentVertexCount() > 0) {
             chunk->createVertexBufferBatched(renderer);
         }
@@ -1115,7 +1164,7 @@ void World::createBuffers(VulkanRenderer* renderer) {
 
     renderer->submitBufferCopyBatch();
 
-    for (auto& chunk : m_chunks) {
+    for (Chunk* chunk : *chunks) {
         if (chunk->getVertexCount() > 0 || chunk->getTransparentVertexCount() > 0) {
             chunk->cleanupStagingBuffers(renderer);
         }
@@ -1123,14 +1172,15 @@ void World::createBuffers(VulkanRenderer* renderer) {
 }
 
 void World::cleanup(VulkanRenderer* renderer) {
-    std::shared_lock<std::shared_mutex> lock(m_chunkMapMutex);
-
-    for (auto& chunk : m_chunks) {
+    const ShardedChunkMap::Snapshot chunks = m_chunkMap.snapshot();
+    for (Chunk* chunk : *chunks) {
         chunk->destroyBuffers(renderer);
     }
 }
 
 void World::renderWorld(VkCommandBuffer commandBuffer, const glm::vec3& cameraPos, const glm::mat4& viewProj, float renderDistance, VulkanRenderer* renderer) {
+    PROFILE_ZONE("render_world");
+
     // Validate camera position for NaN/Inf to prevent rendering errors
     if (!std::isfinite(cameraPos.x) || !std::isfinite(cameraPos.y) || !std::isfinite(cameraPos.z)) {
         return; // Skip rendering if camera position is invalid
@@ -1148,27 +1198,69 @@ void World::renderWorld(VkCommandBuffer commandBuffer, const glm::vec3& cameraPo
     const float renderDistanceWithMargin = fragmentDiscardDistance + CHUNK_HALF_DIAGONAL;
     const float renderDistanceSquared = renderDistanceWithMargin * renderDistanceWithMargin;
 
+    // HIERARCHICAL LOD (2025-11-27): Downsampled far chunks are drawn out to the LOD distance
+    const float lodDistanceWithMargin = std::max(fragmentDiscardDistance, m_farLodDistance * FRAGMENT_DISCARD_MARGIN)
+                                        + CHUNK_HALF_DIAGONAL;
+    const float lodDistanceSquared = lodDistanceWithMargin * lodDistanceWithMargin;
+    auto cullDistanceSquared = [&](const Chunk* chunk) {
+        return chunk->getLodLevel() > 0 ? lodDistanceSquared : renderDistanceSquared;
+    };
+
     // Frustum margin: add extra padding to prevent edge-case popping
     const float frustumMargin = CHUNK_HALF_DIAGONAL + FRUSTUM_CULLING_PADDING;
 
     int renderedCount = 0;
     int distanceCulled = 0;
     int frustumCulled = 0;
+    int lodRenderedCount = 0;
 
     // Store transparent chunks for second pass (sorted back-to-front)
     std::vector<std::pair<Chunk*, float>> transparentChunks;
 
-    // THREAD SAFETY: Acquire shared lock for reading m_chunks
-    // Prevents iterator invalidation while other threads modify the chunk list
-    std::shared_lock<std::shared_mutex> lock(m_chunkMapMutex);
+    // LIGHT TRANSITIONS (2025-11-28): Chunks remeshed after a block light change fade in
+    // their new light on the GPU. Their blend factor is a push constant, so they are
+    // drawn in their own indirect draws; everything else stays batched at blend 1.0.
+    const auto frameTime = std::chrono::steady_clock::now();
+#if USE_INDIRECT_DRAWING
+    auto drawIndirectRuns = [&](VkBuffer indirectBuffer, const std::vector<float>& blends) {
+        float currentBlend = 1.0f;
+        size_t first = 0;
+        while (first < blends.size()) {
+            size_t last = first + 1;
+            if (blends[first] >= 1.0f) {
+                while (last < blends.size() && blends[last] >= 1.0f) last++;
+            }
+            if (blends[first] != currentBlend) {
+                currentBlend = blends[first];
+                renderer->pushChunkLightBlend(commandBuffer, currentBlend);
+            }
+            vkCmdDrawIndexedIndirect(commandBuffer, indirectBuffer,
+                                    first * sizeof(VkDrawIndexedIndirectCommand),
+                                    static_cast<uint32_t>(last - first),
+                                    sizeof(VkDrawIndexedIndirectCommand));
+            first = last;
+        }
+        if (currentBlend != 1.0f) {
+            renderer->pushChunkLightBlend(commandBuffer, 1.0f);
+        }
+    };
+#endif
+
+    // THREAD SAFETY (2025-11-28): Iterate an immutable snapshot instead of holding a
+    // world lock for the whole frame. Chunks are only removed on this (main) thread,
+    // so every pointer in the snapshot stays valid until the frame is recorded.
+    const ShardedChunkMap::Snapshot chunkSnapshot = m_chunkMap.snapshot();
+    const std::vector<Chunk*>& chunks = *chunkSnapshot;
 
     // ========== PASS 1: RENDER OPAQUE GEOMETRY ==========
 #if USE_INDIRECT_DRAWING
     // GPU OPTIMIZATION: Build indirect draw commands for all visible chunks
     std::vector<VkDrawIndexedIndirectCommand> opaqueDrawCommands;
-    opaqueDrawCommands.reserve(m_chunks.size());  // Preallocate for performance
+    opaqueDrawCommands.reserve(chunks.size());  // Preallocate for performance
+    std::vector<VkDrawIndexedIndirectCommand> transitionDrawCommands;  // Appended after the batch
+    std::vector<float> opaqueBlends;
 
-    for (auto& chunk : m_chunks) {
+    for (Chunk* chunk : chunks) {
         // Skip chunks with no opaque vertices
         if (chunk->getVertexCount() == 0) {
             // Still need to check for transparent geometry
@@ -1177,7 +1269,7 @@ void World::renderWorld(VkCommandBuffer commandBuffer, const glm::vec3& cameraPo
                 glm::vec3 delta = chunk->getCenter() - cameraPos;
                 float distanceSquared = glm::dot(delta, delta);
 
-                if (distanceSquared <= renderDistanceSquared) {
+                if (distanceSquared <= cullDistanceSquared(chunk)) {
                     // Stage 2: Frustum culling
                     glm::vec3 chunkMin = chunk->getMin();
                     glm::vec3 chunkMax = chunk->getMax();
@@ -1198,7 +1290,7 @@ void World::renderWorld(VkCommandBuffer commandBuffer, const glm::vec3& cameraPo
         glm::vec3 delta = chunk->getCenter() - cameraPos;
         float distanceSquared = glm::dot(delta, delta);
 
-        if (distanceSquared > renderDistanceSquared) {
+        if (distanceSquared > cullDistanceSquared(chunk)) {
             distanceCulled++;
             continue;
         }
@@ -1213,15 +1305,29 @@ void World::renderWorld(VkCommandBuffer commandBuffer, const glm::vec3& cameraPo
         }
 
         // Chunk passed culling - add to indirect draw command buffer
-        VkDrawIndexedIndirectCommand cmd{};
-        cmd.indexCount = chunk->getIndexCount();
-        cmd.instanceCount = 1;
-        cmd.firstIndex = static_cast<uint32_t>(chunk->getMegaBufferIndexOffset() / sizeof(uint32_t));
-        cmd.vertexOffset = static_cast<int32_t>(chunk->getMegaBufferBaseVertex());
-        cmd.firstInstance = 0;
-        opaqueDrawCommands.push_back(cmd);
+        // (shared quad index buffer: firstIndex 0, one command per 16k quads)
+        const float lightBlend = chunk->getLightTransitionBlend(frameTime);
+        QuadIndex::forEachDraw(chunk->getVertexCount(), static_cast<int32_t>(chunk->getMegaBufferBaseVertex()),
+                               [&](uint32_t indexCount, int32_t vertexOffset) {
+            VkDrawIndexedIndirectCommand cmd{};
+            cmd.indexCount = indexCount;
+            cmd.instanceCount = 1;
+            cmd.firstIndex = 0;
+            cmd.vertexOffset = vertexOffset;
+            cmd.firstInstance = 0;
+
+            if (lightBlend < 1.0f) {
+                transitionDrawCommands.push_back(cmd);
+                opaqueBlends.push_back(lightBlend);
+            } else {
+                opaqueDrawCommands.push_back(cmd);
+            }
+        });
 
         renderedCount++;
+        if (chunk->getLodLevel() > 0) {
+            lodRenderedCount++;
+        }
 
         // If chunk has transparent geometry, add to transparent list
         if (chunk->getTransparentVertexCount() > 0) {
@@ -1229,6 +1335,10 @@ void World::renderWorld(VkCommandBuffer commandBuffer, const glm::vec3& cameraPo
         }
     }
 
+    // Batched chunks first (blend 1.0), then one draw per chunk mid-transition
+    opaqueBlends.insert(opaqueBlends.begin(), opaqueDrawCommands.size(), 1.0f);
+    opaqueDrawCommands.insert(opaqueDrawCommands.end(), transitionDrawCommands.begin(), transitionDrawCommands.end());
+
     // Execute single indirect draw call for all opaque chunks
     if (!opaqueDrawCommands.empty() && renderer != nullptr) {
         // Upload draw commands to indirect buffer
@@ -1246,17 +1356,18 @@ void World::renderWorld(VkCommandBuffer commandBuffer, const glm::vec3& cameraPo
         VkBuffer vertexBuffers[] = {renderer->getMegaVertexBuffer()};
         VkDeviceSize offsets[] = {0};
         vkCmdBindVertexBuffers(commandBuffer, 0, 1, vertexBuffers, offsets);
-        vkCmdBindIndexBuffer(commandBuffer, renderer->getMegaIndexBuffer(), 0, VK_INDEX_TYPE_UINT32);
+        vkCmdBindIndexBuffer(commandBuffer, renderer->getQuadIndexBuffer(), 0, VK_INDEX_TYPE_UINT16);
 
-        // SINGLE DRAW CALL for all opaque chunks!
-        vkCmdDrawIndexedIndirect(commandBuffer, indirectBuffer, 0,
-                                static_cast<uint32_t>(opaqueDrawCommands.size()),
-                                sizeof(VkDrawIndexedIndirectCommand));
+        // SINGLE DRAW CALL for all opaque chunks! (plus one per light transition)
+        drawIndirectRuns(indirectBuffer, opaqueBlends);
     }
 
 #else
-    // LEGACY PATH: Per-chunk draw calls
-    for (auto& chunk : m_chunks) {
+    // LEGACY PATH: Per-chunk draw calls (chunks share the quad index buffer)
+    if (renderer != nullptr) {
+        vkCmdBindIndexBuffer(commandBuffer, renderer->getQuadIndexBuffer(), 0, VK_INDEX_TYPE_UINT16);
+    }
+    for (Chunk* chunk : chunks) {
         // Skip chunks with no opaque vertices
         if (chunk->getVertexCount() == 0) {
             // Still need to check for transparent geometry
@@ -1265,7 +1376,7 @@ void World::renderWorld(VkCommandBuffer commandBuffer, const glm::vec3& cameraPo
                 glm::vec3 delta = chunk->getCenter() - cameraPos;
                 float distanceSquared = glm::dot(delta, delta);
 
-                if (distanceSquared <= renderDistanceSquared) {
+                if (distanceSquared <= cullDistanceSquared(chunk)) {
                     // Stage 2: Frustum culling
                     glm::vec3 chunkMin = chunk->getMin();
                     glm::vec3 chunkMax = chunk->getMax();
@@ -1286,7 +1397,7 @@ void World::renderWorld(VkCommandBuffer commandBuffer, const glm::vec3& cameraPo
         glm::vec3 delta = chunk->getCenter() - cameraPos;
         float distanceSquared = glm::dot(delta, delta);
 
-        if (distanceSquared > renderDistanceSquared) {
+        if (distanceSquared > cullDistanceSquared(chunk)) {
             distanceCulled++;
             continue;
         }
@@ -1301,8 +1412,18 @@ void World::renderWorld(VkCommandBuffer commandBuffer, const glm::vec3& cameraPo
         }
 
         // Chunk passed all culling tests - render opaque geometry
+        const float lightBlend = (renderer != nullptr) ? chunk->getLightTransitionBlend(frameTime) : 1.0f;
+        if (lightBlend < 1.0f) {
+            renderer->pushChunkLightBlend(commandBuffer, lightBlend);
+        }
         chunk->render(commandBuffer, false);  // false = opaque
+        if (lightBlend < 1.0f) {
+            renderer->pushChunkLightBlend(commandBuffer, 1.0f);
+        }
         renderedCount++;
+        if (chunk->getLodLevel() > 0) {
+            lodRenderedCount++;
+        }
 
         // If chunk has transparent geometry, add to transparent list
         if (chunk->getTransparentVertexCount() > 0) {
@@ -1336,16 +1457,24 @@ void World::renderWorld(VkCommandBuffer commandBuffer, const glm::vec3& cameraPo
         // Build indirect draw commands for transparent geometry
         std::vector<VkDrawIndexedIndirectCommand> transparentDrawCommands;
         transparentDrawCommands.reserve(transparentChunks.size());
+        std::vector<float> transparentBlends;
+        transparentBlends.reserve(transparentChunks.size());
 
         for (const auto& pair : transparentChunks) {
             Chunk* chunk = pair.first;
-            VkDrawIndexedIndirectCommand cmd{};
-            cmd.indexCount = chunk->getTransparentIndexCount();
-            cmd.instanceCount = 1;
-            cmd.firstIndex = static_cast<uint32_t>(chunk->getMegaBufferTransparentIndexOffset() / sizeof(uint32_t));
-            cmd.vertexOffset = static_cast<int32_t>(chunk->getMegaBufferTransparentBaseVertex());
-            cmd.firstInstance = 0;
-            transparentDrawCommands.push_back(cmd);
+            const float lightBlend = chunk->getLightTransitionBlend(frameTime);
+            QuadIndex::forEachDraw(chunk->getTransparentVertexCount(),
+                                   static_cast<int32_t>(chunk->getMegaBufferTransparentBaseVertex()),
+                                   [&](uint32_t indexCount, int32_t vertexOffset) {
+                VkDrawIndexedIndirectCommand cmd{};
+                cmd.indexCount = indexCount;
+                cmd.instanceCount = 1;
+                cmd.firstIndex = 0;
+                cmd.vertexOffset = vertexOffset;
+                cmd.firstInstance = 0;
+                transparentDrawCommands.push_back(cmd);
+                transparentBlends.push_back(lightBlend);
+            });
         }
 
         if (!transparentDrawCommands.empty()) {
@@ -1364,26 +1493,45 @@ void World::renderWorld(VkCommandBuffer commandBuffer, const glm::vec3& cameraPo
             VkBuffer vertexBuffers[] = {renderer->getMegaTransparentVertexBuffer()};
             VkDeviceSize offsets[] = {0};
             vkCmdBindVertexBuffers(commandBuffer, 0, 1, vertexBuffers, offsets);
-            vkCmdBindIndexBuffer(commandBuffer, renderer->getMegaTransparentIndexBuffer(), 0, VK_INDEX_TYPE_UINT32);
+            vkCmdBindIndexBuffer(commandBuffer, renderer->getQuadIndexBuffer(), 0, VK_INDEX_TYPE_UINT16);
 
-            // SINGLE DRAW CALL for all transparent chunks!
-            vkCmdDrawIndexedIndirect(commandBuffer, transparentIndirectBuffer, 0,
-                                    static_cast<uint32_t>(transparentDrawCommands.size()),
-                                    sizeof(VkDrawIndexedIndirectCommand));
+            // SINGLE DRAW CALL for all transparent chunks! (split only around light transitions,
+            // keeping the back-to-front order)
+            drawIndirectRuns(transparentIndirectBuffer, transparentBlends);
         }
 #else
         // Legacy: Render transparent chunks individually
+        vkCmdBindIndexBuffer(commandBuffer, renderer->getQuadIndexBuffer(), 0, VK_INDEX_TYPE_UINT16);
         for (const auto& pair : transparentChunks) {
+            const float lightBlend = pair.first->getLightTransitionBlend(frameTime);
+            if (lightBlend < 1.0f) {
+                renderer->pushChunkLightBlend(commandBuffer, lightBlend);
+            }
             pair.first->render(commandBuffer, true);  // true = transparent
+            if (lightBlend < 1.0f) {
+                renderer->pushChunkLightBlend(commandBuffer, 1.0f);
+            }
         }
 #endif
     }
 
     // Store stats in DebugState for display
     DebugState::instance().chunksRendered = renderedCount;
+    DebugState::instance().chunksRenderedLod = lodRenderedCount;
     DebugState::instance().chunksDistanceCulled = distanceCulled;
     DebugState::instance().chunksFrustumCulled = frustumCulled;
-    DebugState::instance().chunksTotalInWorld = static_cast<int>(m_chunks.size());
+    DebugState::instance().chunksTotalInWorld = static_cast<int>(chunks.size());
+
+    ChunkCacheStats cacheStats = m_chunkCache.getStats();
+    const float cacheLookups = static_cast<float>(std::max<uint64_t>(cacheStats.lookups(), 1));
+    DebugState::instance().chunkCacheHotHitRate = cacheStats.hotHits / cacheLookups;
+    DebugState::instance().chunkCacheWarmHitRate = cacheStats.warmHits / cacheLookups;
+    DebugState::instance().chunkCacheColdHitRate = cacheStats.coldHits / cacheLookups;
+    DebugState::instance().chunkCacheHotChunks = static_cast<int>(cacheStats.hotChunks);
+    DebugState::instance().chunkCacheWarmChunks = static_cast<int>(cacheStats.warmChunks);
+    DebugState::instance().chunkCacheHotMB = cacheStats.hotBytes / (1024.0f * 1024.0f);
+    DebugState::instance().chunkCacheWarmMB = cacheStats.warmBytes / (1024.0f * 1024.0f);
+    DebugState::instance().chunkCacheWriteBacks = static_cast<int>(cacheStats.writeBacks);
 
     // Debug output periodically (roughly once per second at 60 FPS)
     // Gated behind debug_world ConVar - use console command: "debug_world 1" to enable
@@ -1393,52 +1541,33 @@ void World::renderWorld(VkCommandBuffer commandBuffer, const glm::vec3& cameraPo
         Logger::debug() << "Rendered: " << renderedCount << " chunks | "
                         << "Distance culled: " << distanceCulled << " | "
                         << "Frustum culled: " << frustumCulled << " | "
-                        << "Total: " << m_chunks.size() << " chunks";
+                        << "Total: " << chunks.size() << " chunks";
     }
 }
 
-Chunk* World::getChunkAtUnsafe(int chunkX, int chunkY, int chunkZ) {
-    // ============================================================================
-    // WARNING: UNSAFE - NO LOCKING!
-    // Caller MUST hold m_chunkMapMutex (shared or unique lock) before calling!
-    // Calling this without holding the lock will cause race conditions and crashes!
-    // ============================================================================
-    // O(1) hash map lookup instead of O(n) linear search
-    auto it = m_chunkMap.find(ChunkCoord{chunkX, chunkY, chunkZ});
-    if (it != m_chunkMap.end()) {
-        return it->second.get();
-    }
-    return nullptr;
-}
-
 Chunk* World::getChunkAt(int chunkX, int chunkY, int chunkZ) {
-    // THREAD SAFETY: Shared lock for concurrent reads
-    std::shared_lock<std::shared_mutex> lock(m_chunkMapMutex);
-    return getChunkAtUnsafe(chunkX, chunkY, chunkZ);
+    // THREAD SAFETY: Shared lock on the coordinate's shard only
+    return m_chunkMap.find(ChunkCoord{chunkX, chunkY, chunkZ});
 }
 
 std::vector<ChunkCoord> World::getAllChunkCoords() const {
-    // THREAD SAFETY: Shared lock for concurrent reads
-    std::shared_lock<std::shared_mutex> lock(m_chunkMapMutex);
-
+    // THREAD SAFETY: Shared lock per shard while it is visited
     std::vector<ChunkCoord> coords;
     coords.reserve(m_chunkMap.size());
 
-    for (const auto& pair : m_chunkMap) {
-        coords.push_back(pair.first);
-    }
+    m_chunkMap.forEach([&coords](const ChunkCoord& coord, Chunk*) {
+        coords.push_back(coord);
+    });
 
     return coords;
 }
 
 void World::forEachChunkCoord(const std::function<void(const ChunkCoord&)>& callback) const {
-    // THREAD SAFETY: Shared lock for concurrent reads
+    // THREAD SAFETY: Shared lock per shard while it is visited
     // Zero-copy iteration - avoids allocating vector of 432 coords
-    std::shared_lock<std::shared_mutex> lock(m_chunkMapMutex);
-
-    for (const auto& pair : m_chunkMap) {
-        callback(pair.first);
-    }
+    m_chunkMap.forEach([&callback](const ChunkCoord& coord, Chunk*) {
+        callback(coord);
+    });
 }
 
 int World::getBlockAt(float worldX, float worldY, float worldZ) {
@@ -1453,16 +1582,6 @@ int World::getBlockAt(float worldX, float worldY, float worldZ) {
     return chunk->getBlock(coords.localX, coords.localY, coords.localZ);
 }
 
-Chunk* World::getChunkAtWorldPosUnsafe(float worldX, float worldY, float worldZ) {
-    // ============================================================================
-    // WARNING: UNSAFE - NO LOCKING!
-    // Caller MUST hold m_chunkMapMutex (shared or unique lock) before calling!
-    // Calling this without holding the lock will cause race conditions and crashes!
-    // ============================================================================
-    auto coords = worldToBlockCoords(worldX, worldY, worldZ);
-    return getChunkAtUnsafe(coords.chunkX, coords.chunkY, coords.chunkZ);
-}
-
 Chunk* World::getChunkAtWorldPos(float worldX, float worldY, float worldZ) {
     // Convert world coordinates to chunk coordinates
     auto coords = worldToBlockCoords(worldX, worldY, worldZ);
@@ -1478,24 +1597,14 @@ bool World::addStreamedChunk(std::unique_ptr<Chunk> chunk, VulkanRenderer* rende
     int chunkY = chunk->getChunkY();
     int chunkZ = chunk->getChunkZ();
 
-    // Thread-safe insertion
-    std::unique_lock<std::shared_mutex> lock(m_chunkMapMutex);
-
+    // Thread-safe insertion (exclusive lock on one shard; duplicates are rejected)
     ChunkCoord coord{chunkX, chunkY, chunkZ};
-
-    // Check for duplicates
-    if (m_chunkMap.find(coord) != m_chunkMap.end()) {
+    Chunk* chunkPtr = chunk.get();
+    if (!m_chunkMap.insert(coord, std::move(chunk))) {
         Logger::warning() << "Chunk (" << chunkX << ", " << chunkY << ", " << chunkZ << ") already exists, discarding streamed chunk";
         return false;
     }
 
-    // Add to map
-    Chunk* chunkPtr = chunk.get();
-    m_chunkMap[coord] = std::move(chunk);
-    m_chunks.push_back(chunkPtr);
-
-    lock.unlock();  // Release lock before decoration (can be slow)
-
     // LOD TIER (2025-11-25): Skip decoration for non-FULL LOD chunks
     // MESH_ONLY: Skip decoration (fog hides trees anyway)
     // TERRAIN_ONLY: Skip decoration AND mesh (beyond render distance)
@@ -1519,23 +1628,16 @@ bool World::addStreamedChunk(std::unique_ptr<Chunk> chunk, VulkanRenderer* rende
                 // This prevents trees from being placed with missing neighbor data
                 if (hasHorizontalNeighbors(chunkPtr)) {
                     // Step 1: Add decorations (trees, structures)
+                    chunkPtr->tryTransition(ChunkState::GENERATED, ChunkState::DECORATING);
                     decorateChunk(chunkPtr);
                     chunkPtr->setNeedsDecoration(false);  // Mark as decorated
+                    chunkPtr->tryTransition(ChunkState::DECORATING, ChunkState::AWAITING_MESH);
                 } else {
                     // Neighbors not ready yet - defer decoration until later
-                    // DEADLOCK FIX (2025-11-24): Track when chunk was added to queue for timeout-based processing
-                    size_t pendingCount;
-                    {
-                        std::lock_guard<std::mutex> lock(m_pendingDecorationsMutex);
-                        if (m_pendingDecorations.find(chunkPtr) == m_pendingDecorations.end()) {
-                            m_pendingDecorations.insert(chunkPtr);
-                            m_pendingDecorationTimestamps[chunkPtr] = std::chrono::steady_clock::now();
-                        }
-                        pendingCount = m_pendingDecorations.size();
-                    }
+                    queueDecoration(chunkPtr);
                     Logger::debug() << "Chunk (" << chunkX << ", " << chunkY << ", " << chunkZ
                                    << ") waiting for neighbors before decoration (pending: "
-                                   << pendingCount << ")";
+                                   << getPendingDecorationCount() << ")";
                 }
             } else {
                 Logger::debug() << "Chunk (" << chunkX << ", " << chunkY << ", " << chunkZ
@@ -1602,16 +1704,15 @@ bool World::addStreamedChunk(std::unique_ptr<Chunk> chunk, VulkanRenderer* rende
         Logger::debug() << "LOD skip for chunk (" << chunkX << ", " << chunkY << ", " << chunkZ
                        << ") - LOD=" << static_cast<int>(lod) << " (skipping decoration)";
 
-        // Mark as "decorated" since we're intentionally skipping - don't re-queue
-        if (chunkPtr->needsDecoration()) {
+        // Mark MESH_ONLY as "decorated" since we're intentionally skipping - don't re-queue
+        // TERRAIN_ONLY keeps the flag: far LOD chunks stay resident, and WorldStreaming
+        // queues their decoration when they refine to full detail
+        if (lod == ChunkLOD::MESH_ONLY && chunkPtr->needsDecoration()) {
             chunkPtr->setNeedsDecoration(false);
         }
 
-        // Initialize basic lighting for visual consistency (even if mesh deferred)
-        chunkPtr->initializeInterpolatedLighting();
-
         // Mesh generation deferred to worker threads for MESH_ONLY
-        // TERRAIN_ONLY chunks don't need mesh at all (beyond render distance)
+        // TERRAIN_ONLY chunks are meshed at a coarse LOD by the streaming mesh workers
         if (!deferMeshGeneration && lod == ChunkLOD::MESH_ONLY) {
             chunkPtr->generateMesh(this);
         }
@@ -1638,26 +1739,25 @@ bool World::addStreamedChunk(std::unique_ptr<Chunk> chunk, VulkanRenderer* rende
 }
 
 bool World::removeChunk(int chunkX, int chunkY, int chunkZ, VulkanRenderer* renderer, bool skipWaterCleanup) {
-    // Thread-safe removal
-    std::unique_lock<std::shared_mutex> lock(m_chunkMapMutex);
-
     ChunkCoord coord{chunkX, chunkY, chunkZ};
 
     // Find chunk
-    auto it = m_chunkMap.find(coord);
-    if (it == m_chunkMap.end()) {
+    if (!m_chunkMap.find(coord)) {
         return false;  // Chunk doesn't exist
     }
 
-    // Remove from vector (order doesn't matter, so use swap-and-pop for O(1))
-    Chunk* chunkPtr = it->second.get();
-
-    // Fire ChunkUnloadEvent before removing the chunk
+    // Fire ChunkUnloadEvent before removing the chunk (no lock held - handlers may query the world)
     ChunkUnloadEvent unloadEvent(chunkX, chunkY, chunkZ);
-    // Release lock temporarily for event dispatch to prevent deadlock
-    lock.unlock();
     EventDispatcher::instance().dispatchImmediate(unloadEvent);
-    lock.lock();
+
+    // Thread-safe removal: exclusive lock on one shard; also drops the chunk from
+    // the next render snapshot. The current frame's snapshot is already recorded
+    // (removal and rendering both happen on the main thread).
+    std::unique_ptr<Chunk> chunk = m_chunkMap.extract(coord);
+    if (!chunk) {
+        return false;  // Removed by an event handler
+    }
+    Chunk* chunkPtr = chunk.get();
 
     // DECORATION FIX: Remove from pending decorations if present
     {
@@ -1665,11 +1765,6 @@ bool World::removeChunk(int chunkX, int chunkY, int chunkZ, VulkanRenderer* rend
         m_pendingDecorations.erase(chunkPtr);
         m_pendingDecorationTimestamps.erase(chunkPtr);  // Clean up timestamp
     }
-    auto vecIt = std::find(m_chunks.begin(), m_chunks.end(), chunkPtr);
-    if (vecIt != m_chunks.end()) {
-        std::swap(*vecIt, m_chunks.back());
-        m_chunks.pop_back();
-    }
 
     // CRITICAL: Notify lighting system before destroying chunk
     // This prevents dangling pointers in the lighting dirty chunks set
@@ -1689,13 +1784,16 @@ bool World::removeChunk(int chunkX, int chunkY, int chunkZ, VulkanRenderer* rend
         chunkPtr->destroyBuffers(renderer);
     }
 
+    // UPLOAD ARENA (2025-11-28): A mesh still waiting for upload pins the arena's ring tail
+    // (destroyBuffers is a no-op with indirect drawing) - free it, the chunk is remeshed on reload
+    chunkPtr->discardPendingMesh();
+
     // EMPTY CHUNK CULLING: Don't cache empty chunks (they're free to regenerate!)
     // This saves RAM for sky chunks and fully-mined chunks
     if (chunkPtr->isEmpty()) {
         Logger::debug() << "Skipping cache for empty chunk (" << chunkX << ", " << chunkY << ", " << chunkZ
                        << "), returning to pool instead";
-        releaseChunk(std::move(it->second));
-        m_chunkMap.erase(it);
+        releaseChunk(std::move(chunk));
         {
             std::lock_guard<std::mutex> dirtyLock(m_dirtyChunksMutex);
             m_dirtyChunks.erase(coord);  // Remove from dirty set if present
@@ -1704,98 +1802,32 @@ bool World::removeChunk(int chunkX, int chunkY, int chunkZ, VulkanRenderer* rend
     }
 
     // Move chunk to cache instead of deleting (RAM cache for fast reload)
-    // MEMORY OPTIMIZATION (2025-11-25): Deallocate interpolated lighting before caching
-    // Saves 256KB per cached chunk since smooth transitions not needed when unloaded
-    it->second->deallocateInterpolatedLighting();
-    m_unloadedChunksCache[coord] = std::move(it->second);
-    m_chunkMap.erase(it);
-
-    // Check cache size limit and evict oldest chunks if needed
-    if (m_unloadedChunksCache.size() > m_maxCachedChunks) {
-        // Evict first chunk found (simple eviction, could use LRU later)
-        auto evictIt = m_unloadedChunksCache.begin();
-        ChunkCoord evictCoord = evictIt->first;
-
-        // DISK I/O FIX: Don't save on eviction - let autosave handle it (every 5 min)
-        // This prevents constant disk writes during fast movement
-        // Modified chunks will be saved during next autosave or manual save
-        // If they're modified again before autosave, that's fine - we'll save the latest version
-        {
-            std::lock_guard<std::mutex> dirtyLock(m_dirtyChunksMutex);
-            if (m_dirtyChunks.count(evictCoord) > 0) {
-                Logger::debug() << "Evicted dirty chunk (" << evictCoord.x << ", " << evictCoord.y << ", " << evictCoord.z
-                               << ") - will save during next autosave";
-                // Keep chunk in dirty set for next autosave
-            }
-        }
-
-        // Return evicted chunk to pool for reuse (CHUNK POOLING)
-        std::unique_ptr<Chunk> evictedChunk = std::move(evictIt->second);
-        m_unloadedChunksCache.erase(evictIt);
-        releaseChunk(std::move(evictedChunk));
-        Logger::debug() << "Evicted cached chunk to stay under limit (" << m_maxCachedChunks << ")";
+    // TIERED CACHE (2025-11-28): Dirty state travels with the chunk so eviction can write it back
+    bool dirty = false;
+    {
+        std::lock_guard<std::mutex> dirtyLock(m_dirtyChunksMutex);
+        dirty = m_dirtyChunks.erase(coord) > 0;
     }
 
-    Logger::debug() << "Moved chunk (" << chunkX << ", " << chunkY << ", " << chunkZ
-                   << ") to cache (total cached: " << m_unloadedChunksCache.size() << ")";
-
-    return true;
-}
-
-int World::getBlockAtUnsafe(float worldX, float worldY, float worldZ) {
-    // ============================================================================
-    // WARNING: UNSAFE - NO LOCKING!
-    // Caller MUST hold m_chunkMapMutex (shared or unique lock) before calling!
-    // Calling this without holding the lock will cause race conditions and crashes!
-    // ============================================================================
-    auto coords = worldToBlockCoords(worldX, worldY, worldZ);
-    Chunk* chunk = getChunkAtUnsafe(coords.chunkX, coords.chunkY, coords.chunkZ);
-    if (chunk == nullptr) {
-        return 0; // Air (outside world bounds)
+    std::vector<std::unique_ptr<Chunk>> demoted;
+    size_t cachedCount = 0;
+    {
+        std::lock_guard<std::mutex> cacheLock(m_chunkCacheMutex);
+        m_chunkCache.setBudgets(static_cast<size_t>(std::max(g_chunkCacheHotMB.getValue(), 0)) * 1024 * 1024,
+                                static_cast<size_t>(std::max(g_chunkCacheWarmMB.getValue(), 0)) * 1024 * 1024);
+        m_chunkCache.insert(std::move(chunk), dirty, demoted);
+        cachedCount = m_chunkCache.size();
     }
-    return chunk->getBlock(coords.localX, coords.localY, coords.localZ);
-}
 
-void World::setBlockAtUnsafe(float worldX, float worldY, float worldZ, int blockID) {
-    // ============================================================================
-    // WARNING: UNSAFE - NO LOCKING!
-    // Caller MUST hold m_chunkMapMutex (unique lock) before calling!
-    // Calling this without holding the lock will cause race conditions and crashes!
-    // ============================================================================
-    auto coords = worldToBlockCoords(worldX, worldY, worldZ);
-    Chunk* chunk = getChunkAtUnsafe(coords.chunkX, coords.chunkY, coords.chunkZ);
-    if (chunk == nullptr) {
-        return; // Outside world bounds, do nothing
+    // Chunks demoted to the warm tier live on as encoded bytes - recycle the objects (CHUNK POOLING)
+    for (auto& demotedChunk : demoted) {
+        releaseChunk(std::move(demotedChunk));
     }
-    chunk->setBlock(coords.localX, coords.localY, coords.localZ, blockID);
-}
 
-uint8_t World::getBlockMetadataAtUnsafe(float worldX, float worldY, float worldZ) {
-    // ============================================================================
-    // WARNING: UNSAFE - NO LOCKING!
-    // Caller MUST hold m_chunkMapMutex (shared or unique lock) before calling!
-    // Calling this without holding the lock will cause race conditions and crashes!
-    // ============================================================================
-    auto coords = worldToBlockCoords(worldX, worldY, worldZ);
-    Chunk* chunk = getChunkAtUnsafe(coords.chunkX, coords.chunkY, coords.chunkZ);
-    if (chunk == nullptr) {
-        return 0; // Out of bounds
-    }
-    return chunk->getBlockMetadata(coords.localX, coords.localY, coords.localZ);
-}
+    Logger::debug() << "Moved chunk (" << chunkX << ", " << chunkY << ", " << chunkZ
+                   << ") to cache (total cached: " << cachedCount << ")";
 
-void World::setBlockMetadataAtUnsafe(float worldX, float worldY, float worldZ, uint8_t metadata) {
-    // ============================================================================
-    // WARNING: UNSAFE - NO LOCKING!
-    // Caller MUST hold m_chunkMapMutex (unique lock) before calling!
-    // Calling this without holding the lock will cause race conditions and crashes!
-    // ============================================================================
-    auto coords = worldToBlockCoords(worldX, worldY, worldZ);
-    Chunk* chunk = getChunkAtUnsafe(coords.chunkX, coords.chunkY, coords.chunkZ);
-    if (chunk == nullptr) {
-        return; // Outside world bounds, do nothing
-    }
-    chunk->setBlockMetadata(coords.localX, coords.localY, coords.localZ, metadata);
+    return true;
 }
 
 void World::setBlockAt(float worldX, float worldY, float worldZ, int blockID, bool regenerateMesh) {
@@ -1851,46 +1883,89 @@ void World::setBlockMetadataAt(float worldX, float worldY, float worldZ, uint8_t
     chunk->setBlockMetadata(coords.localX, coords.localY, coords.localZ, metadata);
 }
 
+// ========== Template Placement ==========
+
+int World::placeTemplate(const StructureTemplate& tmpl, const glm::ivec3& origin,
+                         std::vector<Chunk*>* touchedChunks) {
+    if (tmpl.empty()) return 0;
+
+    // Chunk range covered by the AABB (>> 5 floors negatives, as in worldToBlockCoords)
+    const glm::ivec3 low = origin + tmpl.getMin();
+    const glm::ivec3 high = origin + tmpl.getMax() - glm::ivec3(1);
+    int written = 0;
+    for (int cx = low.x >> 5; cx <= (high.x >> 5); cx++) {
+        for (int cy = low.y >> 5; cy <= (high.y >> 5); cy++) {
+            for (int cz = low.z >> 5; cz <= (high.z >> 5); cz++) {
+                Chunk* chunk = getChunkAt(cx, cy, cz);
+                if (!chunk) continue;
+
+                const glm::ivec3 chunkOrigin(cx * Chunk::WIDTH, cy * Chunk::HEIGHT, cz * Chunk::DEPTH);
+                const int blocks = chunk->blitTemplate(tmpl, origin - chunkOrigin);
+                if (blocks > 0) {
+                    written += blocks;
+                    markChunkDirty(cx, cy, cz);
+                    if (touchedChunks) touchedChunks->push_back(chunk);
+                }
+            }
+        }
+    }
+    return written;
+}
+
+bool World::isTemplateClear(const StructureTemplate& tmpl, const glm::ivec3& origin, int replaceableID) {
+    if (tmpl.empty()) return true;
+
+    const glm::ivec3 low = origin + tmpl.getMin();
+    const glm::ivec3 high = origin + tmpl.getMax() - glm::ivec3(1);
+    for (int cx = low.x >> 5; cx <= (high.x >> 5); cx++) {
+        for (int cy = low.y >> 5; cy <= (high.y >> 5); cy++) {
+            for (int cz = low.z >> 5; cz <= (high.z >> 5); cz++) {
+                Chunk* chunk = getChunkAt(cx, cy, cz);
+                if (!chunk) continue;
+
+                const glm::ivec3 chunkOrigin(cx * Chunk::WIDTH, cy * Chunk::HEIGHT, cz * Chunk::DEPTH);
+                if (!chunk->isTemplateClear(tmpl, origin - chunkOrigin, replaceableID)) {
+                    return false;
+                }
+            }
+        }
+    }
+    return true;
+}
+
 void World::breakBlock(float worldX, float worldY, float worldZ, VulkanRenderer* renderer) {
     // DEBUG: Confirm breakBlock is being called
     std::cerr << "[DEBUG] breakBlock called at (" << worldX << ", " << worldY << ", " << worldZ << ")" << std::endl;
 
-    // THREAD SAFETY: Acquire unique lock for exclusive write access
-    // This prevents race conditions when multiple threads break blocks simultaneously
-    std::unique_lock<std::shared_mutex> lock(m_chunkMapMutex);
-
-    // Check if block is water (use UNSAFE version - we already hold lock)
-    int blockID = getBlockAtUnsafe(worldX, worldY, worldZ);
+    // THREAD SAFETY (2025-11-28): No world-wide lock. Every chunk lookup below takes
+    // a shared lock on one shard of m_chunkMap; block edits happen on the main thread.
+    int blockID = getBlockAt(worldX, worldY, worldZ);
 
     // Fire BlockBreakEvent (can be cancelled)
     glm::ivec3 pos(static_cast<int>(floor(worldX)), static_cast<int>(floor(worldY)), static_cast<int>(floor(worldZ)));
     BlockBreakEvent event(pos, blockID, BreakCause::PLAYER, 0);
-
-    // Release lock temporarily for event dispatch to prevent deadlock
-    lock.unlock();
     EventDispatcher::instance().dispatchImmediate(event);
-    lock.lock();
 
     if (event.isCancelled()) {
         return;  // Don't break the block
     }
 
     // Re-read blockID in case it changed during event dispatch
-    blockID = getBlockAtUnsafe(worldX, worldY, worldZ);
+    blockID = getBlockAt(worldX, worldY, worldZ);
     auto& registry = BlockRegistry::instance();
 
     // Bounds check before registry access to prevent crash
     if (blockID != 0 && blockID >= 0 && blockID < registry.count() && registry.get(blockID).isLiquid) {
         // Only allow breaking source blocks (level 0)
-        uint8_t waterLevel = getBlockMetadataAtUnsafe(worldX, worldY, worldZ);
+        uint8_t waterLevel = getBlockMetadataAt(worldX, worldY, worldZ);
         if (waterLevel > 0) {
             // This is flowing water, can't break it directly
             return;
         }
 
         // It's a source block - break it and remove all connected flowing water
-        setBlockAtUnsafe(worldX, worldY, worldZ, 0);
-        setBlockMetadataAtUnsafe(worldX, worldY, worldZ, 0);
+        setBlockAt(worldX, worldY, worldZ, 0, false);
+        setBlockMetadataAt(worldX, worldY, worldZ, 0);
 
         // Unregister water from simulation
         glm::ivec3 waterPos(static_cast<int>(worldX), static_cast<int>(worldY), static_cast<int>(worldZ));
@@ -1930,13 +2005,13 @@ void World::breakBlock(float worldX, float worldY, float worldZ, VulkanRenderer*
             };
 
             for (const auto& neighborPos : neighbors) {
-                int neighborBlock = getBlockAtUnsafe(neighborPos.x, neighborPos.y, neighborPos.z);
+                int neighborBlock = getBlockAt(neighborPos.x, neighborPos.y, neighborPos.z);
                 // Bounds check before registry access to prevent crash
                 if (neighborBlock != 0 && neighborBlock >= 0 && neighborBlock < registry.count() && registry.get(neighborBlock).isLiquid) {
-                    uint8_t neighborLevel = getBlockMetadataAtUnsafe(neighborPos.x, neighborPos.y, neighborPos.z);
+                    uint8_t neighborLevel = getBlockMetadataAt(neighborPos.x, neighborPos.y, neighborPos.z);
                     if (neighborLevel > 0) {  // It's flowing water
-                        setBlockAtUnsafe(neighborPos.x, neighborPos.y, neighborPos.z, 0);
-                        setBlockMetadataAtUnsafe(neighborPos.x, neighborPos.y, neighborPos.z, 0);
+                        setBlockAt(neighborPos.x, neighborPos.y, neighborPos.z, 0, false);
+                        setBlockMetadataAt(neighborPos.x, neighborPos.y, neighborPos.z, 0);
 
                         // Unregister from simulation
                         m_waterSimulation->setWaterLevel(
@@ -1953,16 +2028,11 @@ void World::breakBlock(float worldX, float worldY, float worldZ, VulkanRenderer*
             }
         }
     } else {
-        // Normal block - just break it
-        setBlockAtUnsafe(worldX, worldY, worldZ, 0);
+        // Normal block - just break it (setBlockAt marks the chunk dirty so the change is saved)
+        setBlockAt(worldX, worldY, worldZ, 0, false);
     }
 
-    // FIX: Mark chunk as dirty so block changes are saved
-    auto coords = worldToBlockCoords(worldX, worldY, worldZ);
-    markChunkDirtyUnsafe(coords.chunkX, coords.chunkY, coords.chunkZ);
-
     // LIGHTING FIX: Store lighting info BEFORE calling lighting system
-    // (we'll call lighting methods AFTER releasing the lock to avoid deadlock)
     bool needsLightingUpdate = false;
     bool wasEmissive = false;
     uint8_t lightLevel = 0;
@@ -1977,67 +2047,16 @@ void World::breakBlock(float worldX, float worldY, float worldZ, VulkanRenderer*
         needsLightingUpdate = wasEmissive || wasOpaque;  // Need update if emissive or opaque block removed
     }
 
-    // Update the affected chunk and all adjacent chunks
+    // Update the affected chunk and every neighbor whose mesh reads this block
     // Must regenerate MESH (not just vertex buffer) because face culling needs updating
-    Chunk* affectedChunk = getChunkAtWorldPosUnsafe(worldX, worldY, worldZ);
-    if (affectedChunk) {
-        try {
-            // Pass true to indicate we already hold the lock (prevents deadlock)
-            affectedChunk->generateMesh(this, true);
-
-            // Upload to GPU (async to prevent frame stalls)
-            renderer->beginAsyncChunkUpload();
-            affectedChunk->createVertexBufferBatched(renderer);
-            renderer->submitAsyncChunkUpload(affectedChunk);
-        } catch (const std::exception& e) {
-            Logger::error() << "Failed to update chunk after breaking block: " << e.what();
-            // Mesh is already generated, just buffer creation failed
-            // Chunk will still render with old buffer until next update
-        }
-    }
-
-    // CRITICAL FIX (2025-11-24): Collect chunks to update, then release lock BEFORE mesh generation
-    // Old code did mesh+GPU upload while holding lock → deadlock + GPU stalls blocking world access!
-    // New code: collect chunks → unlock → mesh → GPU upload
-
-    // Collect neighbor chunks while holding lock
     std::vector<Chunk*> chunksToUpdate;
-    chunksToUpdate.push_back(affectedChunk);
-
-    Chunk* neighbors[6] = {
-        getChunkAtWorldPosUnsafe(worldX - 1.0f, worldY, worldZ),  // -X
-        getChunkAtWorldPosUnsafe(worldX + 1.0f, worldY, worldZ),  // +X
-        getChunkAtWorldPosUnsafe(worldX, worldY - 1.0f, worldZ),  // -Y (below)
-        getChunkAtWorldPosUnsafe(worldX, worldY + 1.0f, worldZ),  // +Y (above)
-        getChunkAtWorldPosUnsafe(worldX, worldY, worldZ - 1.0f),  // -Z
-        getChunkAtWorldPosUnsafe(worldX, worldY, worldZ + 1.0f)   // +Z
-    };
-
-    for (int i = 0; i < 6; i++) {
-        if (neighbors[i] && neighbors[i] != affectedChunk) {
-            // Skip duplicates
-            bool alreadyAdded = false;
-            for (Chunk* existing : chunksToUpdate) {
-                if (existing == neighbors[i]) {
-                    alreadyAdded = true;
-                    break;
-                }
-            }
-            if (!alreadyAdded) {
-                chunksToUpdate.push_back(neighbors[i]);
-            }
-        }
-    }
+    collectChunksReadingBlock(worldX, worldY, worldZ, chunksToUpdate);
 
-    // IMPORTANT: Release lock BEFORE mesh generation and GPU upload!
-    lock.unlock();
-
-    // Now regenerate meshes WITHOUT holding lock (much safer!)
     for (Chunk* chunk : chunksToUpdate) {
         try {
-            chunk->generateMesh(this);  // Mesh generation acquires its own locks as needed
+            chunk->generateMesh(this);  // Neighbor lookups lock one shard at a time
 
-            // Upload to GPU
+            // Upload to GPU (async to prevent frame stalls)
             renderer->beginAsyncChunkUpload();
             chunk->createVertexBufferBatched(renderer);
             renderer->submitAsyncChunkUpload(chunk);
@@ -2054,13 +2073,12 @@ void World::breakBlock(float worldX, float worldY, float worldZ, VulkanRenderer*
         glm::ivec3 neighborPos = pos + offset;
         int neighborBlock = getBlockAt(neighborPos.x, neighborPos.y, neighborPos.z);
         if (neighborBlock != 0) {  // Not air
-            NeighborChangedEvent neighborEvent(neighborPos, pos, blockID, 0);
+            NeighborChangedEvent neighborEvent(neighborPos, pos, blockID, 0, neighborBlock);
             EventDispatcher::instance().dispatch(std::make_unique<NeighborChangedEvent>(neighborEvent));
         }
     }
 
-    // LIGHTING FIX: Update lighting AFTER releasing lock
-    // The lighting system methods call getChunkAtWorldPos() which acquires locks
+    // LIGHTING FIX: Update lighting after the meshes are rebuilt
     if (needsLightingUpdate) {
         // If broken block was emissive (torch, lava), remove its light source
         if (wasEmissive) {
@@ -2074,15 +2092,16 @@ void World::breakBlock(float worldX, float worldY, float worldZ, VulkanRenderer*
         }
     }
 
+    // Unsupported gravity blocks above start falling
+    m_blockTickSystem->onBlockChanged(pos);
+
     // Trigger water flow from adjacent water blocks
     // Uses heightmap approach: water at/below sea level is treated as infinite source
-    // NOTE: Lock was released at line 1958, so we pass lockHeld=false
     m_waterSimulation->triggerWaterFlow(
         static_cast<int>(worldX),
         static_cast<int>(worldY),
         static_cast<int>(worldZ),
-        this,
-        false  // lockHeld=false - lock was already released
+        this
     );
 
     // IMPORTANT: Regenerate mesh AFTER water is placed so it's immediately visible
@@ -2100,6 +2119,42 @@ void World::breakBlock(float worldX, float worldY, float worldZ, VulkanRenderer*
     }
 }
 
+void World::collectChunksReadingBlock(float worldX, float worldY, float worldZ, std::vector<Chunk*>& chunks) {
+    chunks.clear();
+    auto addUnique = [&chunks](Chunk* chunk) {
+        if (chunk && std::find(chunks.begin(), chunks.end(), chunk) == chunks.end()) {
+            chunks.push_back(chunk);
+        }
+    };
+
+    // The block's 3x3x3 neighborhood touches at most 2 chunks per axis (8 in total)
+    Chunk* affectedChunk = getChunkAtWorldPos(worldX, worldY, worldZ);
+    addUnique(affectedChunk);
+    for (int dx = -1; dx <= 1; dx++) {
+        for (int dy = -1; dy <= 1; dy++) {
+            for (int dz = -1; dz <= 1; dz++) {
+                addUnique(getChunkAtWorldPos(worldX + dx, worldY + dy, worldZ + dz));
+            }
+        }
+    }
+
+    // SMOOTH TERRAIN (2025-11-28): surface-nets cells on a chunk edge or corner sample
+    // the diagonal neighbors, which would keep stale vertices (cracks) if not remeshed
+    for (Chunk* chunk : chunks) {
+        if (chunk->isSmoothTerrain(this)) {
+            return;
+        }
+    }
+
+    // Cube meshes only cull against face neighbors
+    chunks.clear();
+    addUnique(affectedChunk);
+    const float faceOffsets[6][3] = {{-1, 0, 0}, {1, 0, 0}, {0, -1, 0}, {0, 1, 0}, {0, 0, -1}, {0, 0, 1}};
+    for (const auto& offset : faceOffsets) {
+        addUnique(getChunkAtWorldPos(worldX + offset[0], worldY + offset[1], worldZ + offset[2]));
+    }
+}
+
 void World::breakBlock(const glm::vec3& position, VulkanRenderer* renderer) {
     breakBlock(position.x, position.y, position.z, renderer);
 }
@@ -2113,9 +2168,8 @@ void World::breakBlock(const glm::ivec3& coords, VulkanRenderer* renderer) {
 }
 
 void World::placeBlock(float worldX, float worldY, float worldZ, int blockID, VulkanRenderer* renderer) {
-    // THREAD SAFETY: Acquire unique lock for exclusive write access
-    // This prevents race conditions when multiple threads place blocks simultaneously
-    std::unique_lock<std::shared_mutex> lock(m_chunkMapMutex);
+    // THREAD SAFETY (2025-11-28): No world-wide lock. Every chunk lookup below takes
+    // a shared lock on one shard of m_chunkMap; block edits happen on the main thread.
 
     // Don't place air blocks (use breakBlock for that)
     // Bounds check to prevent crash from invalid block IDs
@@ -2123,37 +2177,28 @@ void World::placeBlock(float worldX, float worldY, float worldZ, int blockID, Vu
     if (blockID <= 0 || blockID >= registry.count()) return;
 
     // Check if there's already a block here (don't place over existing blocks)
-    // Use UNSAFE version - we already hold lock
-    int existingBlock = getBlockAtUnsafe(worldX, worldY, worldZ);
+    int existingBlock = getBlockAt(worldX, worldY, worldZ);
     if (existingBlock != 0) return;
 
     // Fire BlockPlaceEvent (can be cancelled)
     glm::ivec3 pos(static_cast<int>(floor(worldX)), static_cast<int>(floor(worldY)), static_cast<int>(floor(worldZ)));
     BlockPlaceEvent event(pos, blockID, 0, glm::ivec3(0));  // placerEntityID=0, placedAgainst=origin for now
-
-    // Release lock temporarily for event dispatch to prevent deadlock
-    lock.unlock();
     EventDispatcher::instance().dispatchImmediate(event);
-    lock.lock();
 
     if (event.isCancelled()) {
         return;  // Don't place the block
     }
 
     // Re-check that the position is still empty after event dispatch
-    existingBlock = getBlockAtUnsafe(worldX, worldY, worldZ);
+    existingBlock = getBlockAt(worldX, worldY, worldZ);
     if (existingBlock != 0) return;
 
-    // Place the block
-    setBlockAtUnsafe(worldX, worldY, worldZ, blockID);
-
-    // FIX: Mark chunk as dirty so block changes are saved
-    auto coords = worldToBlockCoords(worldX, worldY, worldZ);
-    markChunkDirtyUnsafe(coords.chunkX, coords.chunkY, coords.chunkZ);
+    // Place the block (setBlockAt marks the chunk dirty so the change is saved)
+    setBlockAt(worldX, worldY, worldZ, blockID, false);
 
     // If placing water, set metadata to 0 (source block) and register with simulation
     if (registry.get(blockID).isLiquid) {
-        setBlockMetadataAtUnsafe(worldX, worldY, worldZ, 0);  // Level 0 = source block
+        setBlockMetadataAt(worldX, worldY, worldZ, 0);  // Level 0 = source block
 
         // Register water block with simulation system so it can flow
         glm::ivec3 waterPos(static_cast<int>(worldX), static_cast<int>(worldY), static_cast<int>(worldZ));
@@ -2170,7 +2215,6 @@ void World::placeBlock(float worldX, float worldY, float worldZ, int blockID, Vu
     }
 
     // LIGHTING FIX: Store lighting info BEFORE calling lighting system
-    // (we'll call lighting methods AFTER releasing the lock to avoid deadlock)
     const auto& blockDef = registry.get(blockID);
     glm::ivec3 blockPos(static_cast<int>(worldX), static_cast<int>(worldY), static_cast<int>(worldZ));
     bool isEmissive = blockDef.isEmissive && blockDef.lightLevel > 0;
@@ -2179,50 +2223,14 @@ void World::placeBlock(float worldX, float worldY, float worldZ, int blockID, Vu
     bool isOpaque = (blockDef.transparency < 0.5f);  // Opaque if transparency < 50%
     bool needsOpacityUpdate = (wasOpaque != isOpaque);
 
-    // Collect all chunks that need mesh updates while holding lock
+    // Collect all chunks that need mesh updates (face neighbors, or all 26 around smooth terrain)
     std::vector<Chunk*> chunksToUpdate;
+    collectChunksReadingBlock(worldX, worldY, worldZ, chunksToUpdate);
 
-    Chunk* affectedChunk = getChunkAtWorldPosUnsafe(worldX, worldY, worldZ);
-    if (affectedChunk) {
-        chunksToUpdate.push_back(affectedChunk);
-    }
-
-    // Always update all 6 adjacent chunks (not just on boundaries)
-    // Note: Using unsafe version since we already hold unique_lock
-    Chunk* neighbors[6] = {
-        getChunkAtWorldPosUnsafe(worldX - 1.0f, worldY, worldZ),  // -X
-        getChunkAtWorldPosUnsafe(worldX + 1.0f, worldY, worldZ),  // +X
-        getChunkAtWorldPosUnsafe(worldX, worldY - 1.0f, worldZ),  // -Y (below)
-        getChunkAtWorldPosUnsafe(worldX, worldY + 1.0f, worldZ),  // +Y (above)
-        getChunkAtWorldPosUnsafe(worldX, worldY, worldZ - 1.0f),  // -Z
-        getChunkAtWorldPosUnsafe(worldX, worldY, worldZ + 1.0f)   // +Z
-    };
-
-    // Collect unique neighbor chunks
-    for (int i = 0; i < 6; i++) {
-        if (neighbors[i] && neighbors[i] != affectedChunk) {
-            // Skip if already in list (deduplicate)
-            bool alreadyInList = false;
-            for (Chunk* chunk : chunksToUpdate) {
-                if (chunk == neighbors[i]) {
-                    alreadyInList = true;
-                    break;
-                }
-            }
-            if (!alreadyInList) {
-                chunksToUpdate.push_back(neighbors[i]);
-            }
-        }
-    }
-
-    // CRITICAL FIX: Release lock BEFORE mesh generation!
-    // generateMesh() calls getBlockAt() on neighbors, which needs locks
-    lock.unlock();
-
-    // Now regenerate meshes and upload to GPU WITHOUT holding lock
+    // Regenerate meshes and upload to GPU
     for (Chunk* chunk : chunksToUpdate) {
         try {
-            chunk->generateMesh(this);  // Acquires locks as needed
+            chunk->generateMesh(this);  // Neighbor lookups lock one shard at a time
 
             // Upload to GPU (async to prevent frame stalls)
             renderer->beginAsyncChunkUpload();
@@ -2242,13 +2250,12 @@ void World::placeBlock(float worldX, float worldY, float worldZ, int blockID, Vu
         glm::ivec3 neighborPos = pos + offset;
         int neighborBlock = getBlockAt(neighborPos.x, neighborPos.y, neighborPos.z);
         if (neighborBlock != 0) {  // Not air
-            NeighborChangedEvent neighborEvent(neighborPos, pos, 0, blockID);  // oldBlockID=0 (was air), newBlockID=blockID
+            NeighborChangedEvent neighborEvent(neighborPos, pos, 0, blockID, neighborBlock);  // oldBlockID=0 (was air), newBlockID=blockID
             EventDispatcher::instance().dispatch(std::make_unique<NeighborChangedEvent>(neighborEvent));
         }
     }
 
-    // LIGHTING FIX: Update lighting AFTER releasing lock
-    // The lighting system methods call getChunkAtWorldPos() which acquires locks
+    // LIGHTING FIX: Update lighting after the meshes are rebuilt
     // If placed block is emissive (torch, lava), add its light source
     if (isEmissive) {
         m_lightingSystem->addLightSource(glm::vec3(blockPos), lightLevel);
@@ -2258,6 +2265,9 @@ void World::placeBlock(float worldX, float worldY, float worldZ, int blockID, Vu
     if (needsOpacityUpdate) {
         m_lightingSystem->onBlockChanged(blockPos, wasOpaque, isOpaque);
     }
+
+    // Gravity blocks placed over air start falling
+    m_blockTickSystem->onBlockChanged(pos);
 }
 
 void World::placeBlock(const glm::vec3& position, int blockID, VulkanRenderer* renderer) {
@@ -2265,6 +2275,8 @@ void World::placeBlock(const glm::vec3& position, int blockID, VulkanRenderer* r
 }
 
 void World::updateLiquids(VulkanRenderer* renderer) {
+    PROFILE_ZONE("update_liquids");
+
     // Simplified Minecraft-style water flow implementation
     // - Level 0: Source block (infinite water, doesn't disappear)
     // - Levels 1-7: Flowing water (spreads horizontally with level decay)
@@ -2272,7 +2284,7 @@ void World::updateLiquids(VulkanRenderer* renderer) {
     // - Horizontal spread: up to 7 blocks from source
     // Water height rendering: IMPLEMENTED in chunk.cpp:552-558 (uses metadata to adjust height)
 
-    auto& registry = BlockRegistry::instance();
+    const BlockPropertyTable& props = BlockRegistry::instance().properties();
     std::unordered_set<Chunk*> chunksToUpdate;
 
     // Track water blocks that need updating
@@ -2285,15 +2297,9 @@ void World::updateLiquids(VulkanRenderer* renderer) {
     // Pass 1: Process all water blocks and schedule flows
     // Performance optimization: Only check chunks that exist
     // Water-containing chunks: TRACKED via WaterSimulation::m_activeChunks
-    std::vector<Chunk*> allChunks;
-    {
-        std::shared_lock<std::shared_mutex> lock(m_chunkMapMutex);
-        for (const auto& pair : m_chunkMap) {
-            allChunks.push_back(pair.second.get());
-        }
-    }
+    const ShardedChunkMap::Snapshot allChunks = m_chunkMap.snapshot();
 
-    for (Chunk* chunk : allChunks) {
+    for (Chunk* chunk : *allChunks) {
         // Early skip: If chunk has no vertices, it's likely empty
         if (chunk->getVertexCount() == 0 && chunk->getTransparentVertexCount() == 0) continue;
 
@@ -2308,11 +2314,8 @@ void World::updateLiquids(VulkanRenderer* renderer) {
                     int blockID = chunk->getBlock(localX, localY, localZ);
                     if (blockID == 0) continue;
 
-                    // Bounds check before registry access to prevent crash
-                    if (blockID < 0 || blockID >= registry.count()) continue;
-
-                    const BlockDefinition& def = registry.get(blockID);
-                    if (!def.isLiquid) continue;
+                    // Unknown IDs have no flags (no bounds check needed)
+                    if (!props.isLiquid(blockID)) continue;
 
                     // Calculate world position
                     float worldX = static_cast<float>(chunkX * Chunk::WIDTH + localX);
@@ -2331,7 +2334,7 @@ void World::updateLiquids(VulkanRenderer* renderer) {
                         waterToAdd.push_back({worldX, belowY, worldZ, 0});
                         chunksToUpdate.insert(getChunkAtWorldPos(worldX, belowY, worldZ));
                         continue;
-                    } else if (blockBelow >= 0 && blockBelow < registry.count() && !registry.get(blockBelow).isLiquid) {
+                    } else if (props.isSolid(blockBelow)) {
                         // Solid block below - try horizontal spread
                         if (waterLevel < 7) {
                             uint8_t newLevel = waterLevel + 1;
@@ -2354,7 +2357,7 @@ void World::updateLiquids(VulkanRenderer* renderer) {
                                 if (neighborBlock == 0) {
                                     waterToAdd.push_back({nx, ny, nz, newLevel});
                                     chunksToUpdate.insert(getChunkAtWorldPos(nx, ny, nz));
-                                } else if (neighborBlock >= 0 && neighborBlock < registry.count() && registry.get(neighborBlock).isLiquid) {
+                                } else if (props.isLiquid(neighborBlock)) {
                                     uint8_t neighborLevel = getBlockMetadataAt(nx, ny, nz);
                                     if (newLevel < neighborLevel) {
                                         setBlockMetadataAt(nx, ny, nz, newLevel);
@@ -2376,7 +2379,7 @@ void World::updateLiquids(VulkanRenderer* renderer) {
             // Only place if still empty
             setBlockAt(water.x, water.y, water.z, 5); // Water block ID
             setBlockMetadataAt(water.x, water.y, water.z, water.level);
-        } else if (existing >= 0 && existing < registry.count() && registry.get(existing).isLiquid) {
+        } else if (props.isLiquid(existing)) {
             // Update level if better (lower level = stronger flow)
             uint8_t existingLevel = getBlockMetadataAt(water.x, water.y, water.z);
             if (water.level < existingLevel) {
@@ -2390,7 +2393,7 @@ void World::updateLiquids(VulkanRenderer* renderer) {
     for (const auto& water : waterToAdd) {
         if (water.level >= 7) {  // Level 7 = edge water, evaporates
             int blockID = getBlockAt(water.x, water.y, water.z);
-            if (blockID != 0 && blockID >= 0 && blockID < registry.count() && registry.get(blockID).isLiquid) {
+            if (props.isLiquid(blockID)) {
                 uint8_t level = getBlockMetadataAt(water.x, water.y, water.z);
                 if (level >= 7) {  // Double-check it's actually level 7
                     blocksToEvaporate.push_back(glm::vec3(water.x, water.y, water.z));
@@ -2473,6 +2476,7 @@ bool World::saveWorld(const std::string& worldPath) const {
         // Store world name and path for chunk streaming persistence
         const_cast<World*>(this)->m_worldName = fs::path(worldPath).filename().string();
         const_cast<World*>(this)->m_worldPath = worldPath;
+        const_cast<World*>(this)->m_chunkCache.setWorldPath(worldPath);
 
         // Create world directory
         fs::create_directories(worldPath);
@@ -2515,7 +2519,8 @@ bool World::saveWorld(const std::string& worldPath) const {
         int savedChunks = 0;
         int skippedChunks = 0;
 
-        for (const auto& [coord, chunk] : m_chunkMap) {
+        const ShardedChunkMap::Snapshot chunks = m_chunkMap.snapshot();
+        for (Chunk* chunk : *chunks) {
             if (chunk && chunk->save(worldPath)) {
                 savedChunks++;
             } else {
@@ -2524,13 +2529,11 @@ bool World::saveWorld(const std::string& worldPath) const {
         }
 
         // Also save cached chunks (includes unloaded but modified chunks)
-        for (const auto& [coord, chunk] : m_unloadedChunksCache) {
-            if (chunk && chunk->save(worldPath)) {
-                savedChunks++;
-            } else {
-                skippedChunks++;
-            }
-        }
+        std::unique_lock<std::mutex> cacheLock(m_chunkCacheMutex);
+        auto [savedCached, skippedCached] = m_chunkCache.saveAll(worldPath);
+        cacheLock.unlock();
+        savedChunks += savedCached;
+        skippedChunks += skippedCached;
 
         Logger::info() << "World save complete - " << savedChunks << " chunks saved, "
                       << skippedChunks << " chunks skipped";
@@ -2548,36 +2551,40 @@ int World::saveModifiedChunks() {
         return 0;
     }
 
-    // THREAD SAFETY FIX: Lock while accessing m_dirtyChunks, m_chunkMap, and m_unloadedChunksCache
-    // Without this, concurrent chunk loading/unloading during autosave causes crashes
-    std::unique_lock<std::shared_mutex> lock(m_chunkMapMutex);
+    // THREAD SAFETY (2025-11-28): Take the dirty set up front, then look chunks up
+    // shard by shard. Chunks are only unloaded on the main thread (which runs autosave),
+    // so a found chunk stays alive while it is written.
+    std::unordered_set<ChunkCoord> dirtyChunks;
+    {
+        std::lock_guard<std::mutex> dirtyLock(m_dirtyChunksMutex);
+        dirtyChunks.swap(m_dirtyChunks);
+    }
 
     int savedCount = 0;
+    std::vector<ChunkCoord> failedChunks;
 
-    // Save dirty chunks from active chunks
-    for (const auto& coord : m_dirtyChunks) {
-        // Check active chunks first
-        auto activeIt = m_chunkMap.find(coord);
-        if (activeIt != m_chunkMap.end() && activeIt->second) {
-            if (activeIt->second->save(m_worldPath)) {
+    // Save dirty chunks from active chunks (unloaded ones moved their dirty flag into the cache)
+    for (const auto& coord : dirtyChunks) {
+        if (Chunk* chunk = m_chunkMap.find(coord)) {
+            if (chunk->save(m_worldPath)) {
                 savedCount++;
+            } else {
+                failedChunks.push_back(coord);
             }
-            continue;
         }
+    }
 
-        // Check cache
-        auto cacheIt = m_unloadedChunksCache.find(coord);
-        if (cacheIt != m_unloadedChunksCache.end() && cacheIt->second) {
-            if (cacheIt->second->save(m_worldPath)) {
-                savedCount++;
-            }
-        }
+    // Failed saves stay dirty so the next autosave retries them
+    if (!failedChunks.empty()) {
+        Logger::warning() << "Autosave: failed to save " << failedChunks.size() << " chunks - will retry";
+        std::lock_guard<std::mutex> dirtyLock(m_dirtyChunksMutex);
+        m_dirtyChunks.insert(failedChunks.begin(), failedChunks.end());
     }
 
-    // Clear dirty flags after successful save
+    // Cached chunks carry their own dirty flags (warm entries are written without decoding)
     {
-        std::lock_guard<std::mutex> dirtyLock(m_dirtyChunksMutex);
-        m_dirtyChunks.clear();
+        std::lock_guard<std::mutex> cacheLock(m_chunkCacheMutex);
+        savedCount += m_chunkCache.saveDirty();
     }
 
     if (savedCount > 0) {
@@ -2596,35 +2603,44 @@ void World::markChunkDirty(int chunkX, int chunkY, int chunkZ) {
     m_dirtyChunks.insert(coord);
 }
 
-void World::markChunkDirtyUnsafe(int chunkX, int chunkY, int chunkZ) {
-    // NOTE (2025-11-23): Now safe to call even with m_chunkMapMutex held
-    // m_dirtyChunks has its own dedicated mutex, no deadlock risk
-    std::lock_guard<std::mutex> lock(m_dirtyChunksMutex);
-    ChunkCoord coord{chunkX, chunkY, chunkZ};
-    m_dirtyChunks.insert(coord);
-}
-
 std::unique_ptr<Chunk> World::getChunkFromCache(int chunkX, int chunkY, int chunkZ) {
-    std::unique_lock<std::shared_mutex> lock(m_chunkMapMutex);
-
     ChunkCoord coord{chunkX, chunkY, chunkZ};
-    auto it = m_unloadedChunksCache.find(coord);
+    std::unique_ptr<Chunk> chunk;
+    std::vector<uint8_t> encoded;
+    bool dirty = false;
+    ChunkCacheTier tier;
+
+    {
+        std::lock_guard<std::mutex> lock(m_chunkCacheMutex);
+        tier = m_chunkCache.take(coord, chunk, encoded, dirty);
+    }
 
-    if (it != m_unloadedChunksCache.end()) {
-        // Move chunk out of cache (caller takes ownership)
-        std::unique_ptr<Chunk> chunk = std::move(it->second);
-        m_unloadedChunksCache.erase(it);
+    if (tier == ChunkCacheTier::NONE) {
+        return nullptr;  // Cache miss
+    }
 
-        // FIXED (2025-11-23): Mark cached chunks as NOT needing decoration
-        // These chunks were already decorated before being cached
-        chunk->setNeedsDecoration(false);
+    if (tier == ChunkCacheTier::WARM) {
+        // Decode outside the cache lock (~0.1 ms RLE decode into a pooled chunk)
+        chunk = acquireChunk(chunkX, chunkY, chunkZ);
+        if (!chunk->decode(encoded)) {
+            Logger::error() << "Failed to decode cached chunk (" << chunkX << ", " << chunkY << ", " << chunkZ << ")";
+            releaseChunk(std::move(chunk));
+            return nullptr;
+        }
+    }
 
-        Logger::debug() << "Cache hit! Retrieved chunk (" << chunkX << ", " << chunkY << ", " << chunkZ
-                       << ") from RAM cache (remaining cached: " << m_unloadedChunksCache.size() << ")";
-        return chunk;
+    // Unsaved modifications stay tracked once the chunk is back in the world
+    if (dirty) {
+        markChunkDirty(chunkX, chunkY, chunkZ);
     }
 
-    return nullptr;  // Cache miss
+    // FIXED (2025-11-23): Mark cached chunks as NOT needing decoration
+    // These chunks were already decorated before being cached
+    chunk->setNeedsDecoration(false);
+
+    Logger::debug() << "Cache hit (" << (tier == ChunkCacheTier::HOT ? "hot" : "warm") << ")! Retrieved chunk ("
+                   << chunkX << ", " << chunkY << ", " << chunkZ << ") from RAM cache";
+    return chunk;
 }
 
 /**
@@ -2758,14 +2774,13 @@ bool World::loadWorld(const std::string& worldPath) {
 
         // Store world path for chunk streaming persistence
         m_worldPath = worldPath;
+        m_chunkCache.setWorldPath(worldPath);
 
         // FIXED: Discover and load all chunk files from disk
         int loadedChunks = 0;
         fs::path chunksDir = fs::path(worldPath) / "chunks";
 
         if (fs::exists(chunksDir) && fs::is_directory(chunksDir)) {
-            std::unique_lock<std::shared_mutex> lock(m_chunkMapMutex);
-
             for (const auto& entry : fs::directory_iterator(chunksDir)) {
                 if (entry.path().extension() == ".chunk") {
                     // Parse chunk filename: "chunk_x_y_z.chunk"
@@ -2786,10 +2801,12 @@ bool World::loadWorld(const std::string& worldPath) {
                             // This prevents deadlock where old chunks wait forever for old neighbors
                             chunk->setTerrainReady(true);
 
-                            Chunk* chunkPtr = chunk.get();
-                            m_chunkMap[coord] = std::move(chunk);
-                            m_chunks.push_back(chunkPtr);
-                            loadedChunks++;
+                            if (m_chunkMap.insert(coord, std::move(chunk))) {
+                                loadedChunks++;
+                            }
+                        }
+                        if (chunk) {
+                            releaseChunk(std::move(chunk));  // Failed to load, or already loaded
                         }
                     }
                 }
@@ -2802,7 +2819,8 @@ bool World::loadWorld(const std::string& worldPath) {
         // This handles worlds saved before the terrainReady flag existed
         // Without this, old worlds would have all chunks stuck in decoration deadlock
         int migratedChunks = 0;
-        for (Chunk* chunk : m_chunks) {
+        const ShardedChunkMap::Snapshot chunks = m_chunkMap.snapshot();
+        for (Chunk* chunk : *chunks) {
             if (chunk && !chunk->isTerrainReady()) {
                 chunk->setTerrainReady(true);
                 migratedChunks++;
@@ -6,8 +6,11 @@
  */
 
 #include "world_streaming.h"
+#include "profiler.h"
 #include "world.h"
 #include "chunk.h"
+#include "chunk_lod.h"
+#include "chunk_trace.h"
 #include "vulkan_renderer.h"
 #include "biome_map.h"
 #include "config.h"
@@ -29,15 +32,34 @@ ConVar<int> g_meshWorkerOverride(
     -1,
     FCVAR_ARCHIVE | FCVAR_NOTIFY);
 
+// Deadline scheduling (2025-11-28)
+constexpr float kChunkBoundingRadius = 27.7f;             // Half-diagonal of a 32^3 chunk
+constexpr float kViewHalfAngle = 1.0f;                    // Radians; ~70 degree vertical FOV at 16:9
+constexpr float kCameraTurnRate = 3.14159265f;            // Radians/sec of a brisk mouse turn
+constexpr float kMinClosingSpeed = 0.5f;                  // Blocks/sec below which the player is not approaching
+constexpr float kMaxPredictedSpeed = 200.0f;              // Faster position samples are teleports, not motion
+constexpr float kDeadlineSecondsPerBlock = 1.0f / 256.0f; // Tie-break: nearer first at equal slack
+constexpr float kLatencySmoothing = 0.05f;                // Moving-average weight of a new latency sample
+constexpr float kNeighborMargin = 64.0f;                  // Matches NEIGHBOR_MARGIN in updatePlayerPosition()
+
 int clampMeshWorkerCount(int requested) {
     return std::clamp(requested, kMinMeshWorkers, kMaxMeshWorkers);
 }
+
+// Advances the pipeline state for the chunk trace. Fresh chunks come from
+// GENERATED (decoration may still be pending); re-meshes come from ACTIVE.
+void markAwaitingMesh(Chunk* chunk) {
+    if (chunk && !chunk->tryTransition(ChunkState::GENERATED, ChunkState::AWAITING_MESH)) {
+        chunk->tryTransition(ChunkState::ACTIVE, ChunkState::AWAITING_MESH);
+    }
+}
 }  // namespace
 
 WorldStreaming::WorldStreaming(World* world, BiomeMap* biomeMap, VulkanRenderer* renderer)
     : m_world(world)
     , m_biomeMap(biomeMap)
     , m_renderer(renderer)
+    , m_uploadTarget(renderer)
     , m_running(false)
     , m_activeWorkers(0)
     , m_meshWorkersRunning(false)
@@ -157,6 +179,7 @@ void WorldStreaming::stop() {
         m_previousPlayerPos = glm::vec3(0.0f);
         m_lastVelocityUpdate = std::chrono::high_resolution_clock::now();
         m_playerVelocity = 0.0f;
+        m_playerVelocityVec = glm::vec3(0.0f);
     }
 
     // Wake up all workers
@@ -186,9 +209,7 @@ void WorldStreaming::stop() {
     // Clear all pending state to avoid stale entries on restart
     {
         std::lock_guard<std::mutex> lock(m_loadQueueMutex);
-        // Clear priority queue by swapping with empty queue
-        std::priority_queue<ChunkLoadRequest> emptyQueue;
-        m_loadQueue.swap(emptyQueue);
+        m_loadQueue.clear();
         m_chunksInFlight.clear();
     }
 
@@ -226,6 +247,11 @@ void WorldStreaming::stop() {
 void WorldStreaming::updatePlayerPosition(const glm::vec3& playerPos,
                                           float loadDistance,
                                           float unloadDistance) {
+    PROFILE_ZONE("streaming_update_player_position");
+
+    // Full-detail radius before any speed reduction (LOD level selection reference)
+    m_fullDetailDistance = loadDistance;
+
     // Calculate player velocity and adjust load distance if moving fast
     float velocity = 0.0f;
     {
@@ -244,6 +270,10 @@ void WorldStreaming::updatePlayerPosition(const glm::vec3& playerPos,
 
             m_playerVelocity = velocity;
             m_lastVelocityUpdate = now;
+
+            // DEADLINE SCHEDULING (2025-11-28): Direction matters for time-to-visible;
+            // a teleport-sized jump is not motion the player will continue
+            m_playerVelocityVec = velocity <= kMaxPredictedSpeed ? delta / deltaTime : glm::vec3(0.0f);
         }
 
         // Update last position after velocity calculation to preserve previous sample
@@ -279,10 +309,32 @@ void WorldStreaming::updatePlayerPosition(const glm::vec3& playerPos,
     }
 
     // Early exit if player hasn't crossed chunk boundary - nothing to stream!
+    // DEADLINE SCHEDULING (2025-11-28): A turn still changes which queued chunks are
+    // about to be seen, so re-key the queue (no new requests needed)
     if (!crossedChunkBoundary) {
+        bool turned = false;
+        {
+            std::lock_guard<std::mutex> lock(m_playerPosMutex);
+            if (glm::dot(m_viewForward, m_viewForward) > 0.0f &&
+                glm::dot(m_viewForward, m_rekeyedForward) < std::cos(REKEY_TURN_ANGLE)) {
+                m_rekeyedForward = m_viewForward;
+                turned = true;
+            }
+        }
+        if (turned) {
+            const ViewState view = captureViewState();
+            std::lock_guard<std::mutex> lock(m_loadQueueMutex);
+            rekeyLoadQueueLocked(view, unloadDistance);
+        }
         return;
     }
 
+    const ViewState view = captureViewState();
+    {
+        std::lock_guard<std::mutex> lock(m_playerPosMutex);
+        m_rekeyedForward = m_viewForward;
+    }
+
     // Calculate chunk load radius
     int loadRadiusChunks = static_cast<int>(std::ceil(loadDistance / (CHUNK_SIZE * BLOCK_SIZE)));
 
@@ -304,6 +356,15 @@ void WorldStreaming::updatePlayerPosition(const glm::vec3& playerPos,
     std::vector<ChunkCoord> chunksToUnload;
     float unloadDistanceSquared = unloadDistance * unloadDistance;
 
+    // HIERARCHICAL LOD (2025-11-27): Surface-band chunks stay resident out to the far LOD distance
+    const bool farLodEnabled = m_farLodDistance > effectiveLoadDistance;
+    const float lodUnloadDistance = std::max(unloadDistance, m_farLodDistance + NEIGHBOR_MARGIN);
+    const float lodUnloadDistanceSquared = lodUnloadDistance * lodUnloadDistance;
+    auto inLodBand = [](int chunkY) {
+        return chunkY >= ChunkLod::LOD_MIN_CHUNK_Y && chunkY <= ChunkLod::LOD_MAX_CHUNK_Y;
+    };
+    std::vector<ChunkCoord> lodCandidates;
+
     m_world->forEachChunkCoord([&](const ChunkCoord& coord) {
         loadedChunks.insert(coord);
 
@@ -317,8 +378,11 @@ void WorldStreaming::updatePlayerPosition(const glm::vec3& playerPos,
         glm::vec3 delta = chunkCenter - playerPos;
         float distanceSquared = glm::dot(delta, delta);
 
-        if (distanceSquared > unloadDistanceSquared) {
+        const bool lodBand = farLodEnabled && inLodBand(coord.y);
+        if (distanceSquared > (lodBand ? lodUnloadDistanceSquared : unloadDistanceSquared)) {
             chunksToUnload.push_back(coord);
+        } else if (lodBand) {
+            lodCandidates.push_back(coord);
         }
     });
 
@@ -339,30 +403,67 @@ void WorldStreaming::updatePlayerPosition(const glm::vec3& playerPos,
                     // Check if chunk already exists (O(1) hash lookup, no lock!)
                     ChunkCoord coord{chunkX, chunkY, chunkZ};
                     if (loadedChunks.find(coord) == loadedChunks.end()) {
-                        // Calculate priority (distance)
-                        float priority = calculateChunkPriority(chunkX, chunkY, chunkZ, playerPos);
+                        float distanceSquared = calculateChunkPriority(chunkX, chunkY, chunkZ, playerPos);
 
                         // LOD TIER (2025-11-25): Determine detail level based on distance
                         // - FULL (0-48 blocks): Full decoration + mesh (trees visible)
                         // - MESH_ONLY (48-80 blocks): Mesh only, skip decoration (fog hides trees)
-                        // - TERRAIN_ONLY (>80 blocks): No mesh, no decoration (beyond render)
+                        // - TERRAIN_ONLY (>80 blocks): No decoration, far LOD mesh (beyond render)
+                        // BUG FIX (2025-11-27): compare linear distance, not squared
+                        const float distance = std::sqrt(distanceSquared);
                         ChunkLOD lod = ChunkLOD::FULL;
-                        if (priority > loadDistance) {
+                        if (distance > loadDistance) {
                             lod = ChunkLOD::TERRAIN_ONLY;  // Beyond render distance
-                        } else if (priority > loadDistance * 0.6f) {
+                        } else if (distance > loadDistance * 0.6f) {
                             lod = ChunkLOD::MESH_ONLY;     // In fog zone, skip decoration
                         }
 
-                        newRequests.push_back({chunkX, chunkY, chunkZ, priority, lod});
+                        newRequests.push_back({chunkX, chunkY, chunkZ,
+                                               calculateChunkDeadline(chunkX, chunkY, chunkZ, lod, view), lod});
                     }
                 }
             }
         }
     }
 
-    // Add new requests to load queue (with deduplication)
-    if (!newRequests.empty()) {
+    // ============================================================================
+    // HIERARCHICAL LOD (2025-11-27): Far terrain ring out to m_farLodDistance
+    // ============================================================================
+    // Only the surface band is requested - caves and sky beyond the load distance
+    // are invisible at these distances. Far requests have the most slack, so the
+    // bounded load queue evicts them first under pressure.
+    // ============================================================================
+    if (farLodEnabled) {
+        const int lodRadiusChunks = static_cast<int>(std::ceil(m_farLodDistance / (CHUNK_SIZE * BLOCK_SIZE)));
+        const float effectiveLoadDistanceSquared = effectiveLoadDistance * effectiveLoadDistance;
+        const float farLodDistanceSquared = m_farLodDistance * m_farLodDistance;
+
+        for (int dx = -lodRadiusChunks; dx <= lodRadiusChunks; ++dx) {
+            for (int dz = -lodRadiusChunks; dz <= lodRadiusChunks; ++dz) {
+                for (int chunkY = ChunkLod::LOD_MIN_CHUNK_Y; chunkY <= ChunkLod::LOD_MAX_CHUNK_Y; ++chunkY) {
+                    int chunkX = playerChunkX + dx;
+                    int chunkZ = playerChunkZ + dz;
+
+                    float distanceSquared = calculateChunkPriority(chunkX, chunkY, chunkZ, playerPos);
+                    if (distanceSquared <= effectiveLoadDistanceSquared || distanceSquared > farLodDistanceSquared) {
+                        continue;  // Handled by the full-detail sphere, or beyond LOD range
+                    }
+                    if (loadedChunks.find(ChunkCoord{chunkX, chunkY, chunkZ}) != loadedChunks.end()) {
+                        continue;
+                    }
+                    newRequests.push_back({chunkX, chunkY, chunkZ,
+                                           calculateChunkDeadline(chunkX, chunkY, chunkZ, ChunkLOD::TERRAIN_ONLY, view),
+                                           ChunkLOD::TERRAIN_ONLY});
+                }
+            }
+        }
+    }
+
+    // Re-key what is already queued against the new position, cancel what the player
+    // left behind, then add new requests (with deduplication)
+    {
         std::lock_guard<std::mutex> lock(m_loadQueueMutex);
+        rekeyLoadQueueLocked(view, unloadDistance);
 
         bool enqueued = false;
         for (const auto& request : newRequests) {
@@ -416,7 +517,8 @@ void WorldStreaming::updatePlayerPosition(const glm::vec3& playerPos,
                                 request.chunkX = chunkX;
                                 request.chunkY = chunkY;
                                 request.chunkZ = chunkZ;
-                                request.priority = 50.0f;  // High priority for look-ahead
+                                request.priority = calculateChunkDeadline(chunkX, chunkY, chunkZ,
+                                                                          ChunkLOD::FULL, view);
                                 request.lod = ChunkLOD::FULL;
 
                                 if (enqueueLoadRequestLocked(request)) {
@@ -474,11 +576,52 @@ void WorldStreaming::updatePlayerPosition(const glm::vec3& playerPos,
         }
     }
 
+    // ============================================================================
+    // HIERARCHICAL LOD (2025-11-27): Re-tier resident surface chunks
+    // ============================================================================
+    // Chunks refine to full detail as the player approaches and coarsen as the
+    // player leaves. Levels come from super-chunk (octree node) distance, so whole
+    // nodes switch together instead of chunk-by-chunk.
+    // ============================================================================
+    if (farLodEnabled) {
+        for (const auto& coord : lodCandidates) {
+            float distance = std::sqrt(calculateChunkPriority(coord.x, coord.y, coord.z, playerPos));
+            int desiredLevel = 0;
+            if (distance > m_fullDetailDistance) {
+                desiredLevel = std::max(1, ChunkLod::selectLodLevel(coord.x, coord.y, coord.z,
+                                                                    playerPos, m_fullDetailDistance));
+            }
+
+            Chunk* chunk = m_world->getChunkAt(coord.x, coord.y, coord.z);
+            if (!chunk || chunk->getLodLevel() == desiredLevel) {
+                continue;
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(m_chunksMeshingMutex);
+                if (m_chunksBeingMeshed.count(coord) > 0) {
+                    continue;  // Picked up again on the next boundary crossing
+                }
+            }
+
+            chunk->setLodLevel(desiredLevel);
+            queueChunkForMeshing(coord.x, coord.y, coord.z);
+
+            // Far chunks were loaded undecorated - trees appear once they reach full detail
+            // (processPendingDecorations re-queues the mesh after decorating)
+            if (desiredLevel == 0 && chunk->needsDecoration()) {
+                m_world->queueDecoration(chunk);
+            }
+        }
+    }
+
     // Retry failed chunks with exponential backoff
     retryFailedChunks();
 }
 
 void WorldStreaming::processCompletedChunks(int maxChunksPerFrame, float maxMilliseconds) {
+    PROFILE_ZONE("streaming_process_completed");
+
     auto startTime = std::chrono::high_resolution_clock::now();
 
     std::vector<CompletedChunk> chunksToAdd;
@@ -512,9 +655,16 @@ void WorldStreaming::processCompletedChunks(int maxChunksPerFrame, float maxMill
     // LOD Tiers:
     //   FULL: Close chunks - decoration + mesh (visible)
     //   MESH_ONLY: Medium chunks - mesh only, skip decoration (fog hides trees)
-    //   TERRAIN_ONLY: Far chunks - no mesh, no decoration (beyond render distance)
+    //   TERRAIN_ONLY: Far chunks - no decoration, downsampled LOD mesh (far LOD enabled)
     // ============================================================================
 
+    glm::vec3 viewerPos;
+    {
+        std::lock_guard<std::mutex> lock(m_playerPosMutex);
+        viewerPos = m_lastPlayerPos;
+    }
+    const bool farLodEnabled = m_farLodDistance > m_fullDetailDistance;
+
     for (auto& completed : chunksToAdd) {
         if (completed.chunk) {
             try {
@@ -523,8 +673,15 @@ void WorldStreaming::processCompletedChunks(int maxChunksPerFrame, float maxMill
                 int chunkZ = completed.chunk->getChunkZ();
                 ChunkLOD lod = completed.lod;
 
+                // HIERARCHICAL LOD (2025-11-27): Far chunks mesh from a downsampled grid
+                if (lod == ChunkLOD::TERRAIN_ONLY && farLodEnabled) {
+                    completed.chunk->setLodLevel(std::max(1, ChunkLod::selectLodLevel(
+                        chunkX, chunkY, chunkZ, viewerPos, m_fullDetailDistance)));
+                }
+
                 // Add chunk to world with DEFERRED mesh generation AND GPU upload
                 // LOD determines whether decoration/mesh is skipped
+                Chunk* chunkPtr = completed.chunk.get();
                 bool added = m_world->addStreamedChunk(std::move(completed.chunk), m_renderer, true, true, lod);
 
                 // Remove from in-flight tracking
@@ -539,13 +696,15 @@ void WorldStreaming::processCompletedChunks(int maxChunksPerFrame, float maxMill
                     m_totalChunksLoaded++;
 
                     // LOD TIER (2025-11-25): Only queue mesh for visible chunks
-                    // TERRAIN_ONLY chunks are beyond render distance - no mesh needed!
-                    if (lod != ChunkLOD::TERRAIN_ONLY) {
+                    // TERRAIN_ONLY chunks are beyond render distance - they only get a
+                    // (coarse) mesh when far LOD terrain is enabled
+                    if (lod != ChunkLOD::TERRAIN_ONLY || farLodEnabled) {
                         // CRITICAL BUG FIX: Track chunk to prevent deletion during meshing
                         {
                             std::lock_guard<std::mutex> lock(m_chunksMeshingMutex);
                             m_chunksBeingMeshed.insert(ChunkCoord{chunkX, chunkY, chunkZ});
                         }
+                        markAwaitingMesh(chunkPtr);
 
                         // Queue mesh generation work for thread pool
                         {
@@ -613,7 +772,7 @@ void WorldStreaming::processCompletedChunks(int maxChunksPerFrame, float maxMill
         // - Use recommended count based on pending uploads
         // - Skip entirely if severely backlogged (prevents 1000ms+ stalls)
         // ============================================================================
-        size_t maxUploads = m_renderer ? m_renderer->getRecommendedUploadCount() : 1;
+        size_t maxUploads = m_uploadTarget ? m_uploadTarget->getRecommendedUploadCount() : 1;
 
         // Log backlog state periodically for debugging
         static int backlogLogCounter = 0;
@@ -664,16 +823,21 @@ void WorldStreaming::processCompletedChunks(int maxChunksPerFrame, float maxMill
         }
     }
 
-    if (!chunksToUpload.empty() && m_renderer) {
+    if (!chunksToUpload.empty() && m_uploadTarget) {
         try {
             Logger::info() << "Beginning batched GPU upload for " << chunksToUpload.size() << " chunks";
 
-            m_renderer->beginBatchedChunkUploads();
+            m_uploadTarget->beginBatchedChunkUploads();
 
+            std::vector<Chunk*> batchedChunks;
+            batchedChunks.reserve(chunksToUpload.size());
             for (const auto& [chunkX, chunkY, chunkZ] : chunksToUpload) {
                 Chunk* chunkPtr = m_world->getChunkAt(chunkX, chunkY, chunkZ);
                 if (chunkPtr) {
-                    m_renderer->addChunkToBatch(chunkPtr);
+                    ChunkTraceSpan span(ChunkTraceStage::UPLOAD, chunkX, chunkY, chunkZ);
+                    chunkPtr->tryTransition(ChunkState::AWAITING_UPLOAD, ChunkState::UPLOADING);
+                    m_uploadTarget->addChunkToBatch(chunkPtr);
+                    batchedChunks.push_back(chunkPtr);
                 }
 
                 // Check time budget during upload loop
@@ -687,7 +851,10 @@ void WorldStreaming::processCompletedChunks(int maxChunksPerFrame, float maxMill
                 }
             }
 
-            m_renderer->submitBatchedChunkUploads();
+            m_uploadTarget->submitBatchedChunkUploads();
+            for (Chunk* chunkPtr : batchedChunks) {
+                chunkPtr->tryTransition(ChunkState::UPLOADING, ChunkState::ACTIVE);
+            }
 
             Logger::info() << "Completed batched GPU upload for " << chunksToUpload.size()
                           << " chunks in single vkQueueSubmit";
@@ -707,6 +874,11 @@ size_t WorldStreaming::getCompletedChunkCount() const {
     return m_completedChunks.size();
 }
 
+size_t WorldStreaming::getUploadQueueSize() const {
+    std::lock_guard<std::mutex> lock(m_readyForUploadMutex);
+    return m_chunksReadyForUpload.size();
+}
+
 std::tuple<size_t, size_t, int> WorldStreaming::getStats() const {
     return std::make_tuple(
         getPendingLoadCount(),
@@ -724,6 +896,7 @@ void WorldStreaming::queueChunkForMeshing(int chunkX, int chunkY, int chunkZ) {
         std::lock_guard<std::mutex> lock(m_chunksMeshingMutex);
         m_chunksBeingMeshed.insert(ChunkCoord{chunkX, chunkY, chunkZ});
     }
+    markAwaitingMesh(m_world->getChunkAt(chunkX, chunkY, chunkZ));
 
     // Queue mesh generation work for thread pool
     {
@@ -741,6 +914,8 @@ void WorldStreaming::queueChunkForMeshing(int chunkX, int chunkY, int chunkZ) {
 }
 
 void WorldStreaming::workerThreadFunction() {
+    Profiler::setThreadName("Chunk Worker");
+
     m_activeWorkers.fetch_add(1);
 
     Logger::debug() << "Worker thread started (ID: " << std::this_thread::get_id() << ")";
@@ -765,17 +940,25 @@ void WorldStreaming::workerThreadFunction() {
 
             // Get work item
             if (!m_loadQueue.empty()) {
-                request = m_loadQueue.top();
-                m_loadQueue.pop();
+                request = m_loadQueue.pop().value;
                 hasWork = true;
             }
         }
 
         // Process chunk generation (outside lock)
         if (hasWork) {
+            if (request.queuedAtNs >= 0) {
+                ChunkTrace& trace = ChunkTrace::instance();
+                trace.recordSpan(request.chunkX, request.chunkY, request.chunkZ,
+                                 ChunkTraceStage::LOAD_QUEUE, request.queuedAtNs, trace.now());
+            }
+
             try {
                 // Generate chunk (CPU-only operations)
+                auto generateStart = std::chrono::steady_clock::now();
                 auto chunk = generateChunk(request.chunkX, request.chunkY, request.chunkZ);
+                recordLatency(m_generateLatencyMs, std::chrono::duration<float, std::milli>(
+                    std::chrono::steady_clock::now() - generateStart).count());
 
                 // Add to completed queue (with LOD tier)
                 {
@@ -808,6 +991,8 @@ void WorldStreaming::workerThreadFunction() {
 }
 
 void WorldStreaming::meshWorkerThreadFunction() {
+    Profiler::setThreadName("Mesh Worker");
+
     Logger::debug() << "Mesh worker thread started (ID: " << std::this_thread::get_id() << ")";
 
     while (m_meshWorkersRunning.load()) {
@@ -878,6 +1063,8 @@ void WorldStreaming::meshWorkerThreadFunction() {
             try {
                 Chunk* chunkPtr = m_world->getChunkAt(chunkX, chunkY, chunkZ);
                 if (chunkPtr) {
+                    chunkPtr->tryTransition(ChunkState::AWAITING_MESH, ChunkState::MESHING);
+
                     // ============================================================================
                     // OCCLUSION SKIP (2025-11-25): Skip mesh generation for fully occluded chunks
                     // ============================================================================
@@ -885,7 +1072,7 @@ void WorldStreaming::meshWorkerThreadFunction() {
                     // Skip expensive mesh generation entirely - saves ~1-2ms per chunk!
                     // Check only for underground chunks (Y < 0) to avoid surface pop-in.
                     // ============================================================================
-                    if (chunkY < 0 && chunkPtr->isFullyOccluded(m_world, false)) {
+                    if (chunkY < 0 && chunkPtr->isFullyOccluded(m_world)) {
                         Logger::debug() << "Skipping occluded underground chunk ("
                                        << chunkX << ", " << chunkY << ", " << chunkZ << ")";
 
@@ -894,6 +1081,7 @@ void WorldStreaming::meshWorkerThreadFunction() {
                             std::lock_guard<std::mutex> lock(m_chunksMeshingMutex);
                             m_chunksBeingMeshed.erase(ChunkCoord{chunkX, chunkY, chunkZ});
                         }
+                        chunkPtr->tryTransition(ChunkState::MESHING, ChunkState::ACTIVE);
 
                         continue;  // Skip to next chunk
                     }
@@ -903,12 +1091,22 @@ void WorldStreaming::meshWorkerThreadFunction() {
                     // 1. If no emissive blocks exist (common case), this is instant
                     // 2. If emissive blocks exist, we only scan for those specific IDs
                     // 3. Lighting system's addLightSource is thread-safe
-                    if (!chunkPtr->hasLightingData()) {
+                    // Far LOD meshes are unlit, so they skip lighting entirely
+                    auto meshStart = std::chrono::steady_clock::now();
+                    const int lodLevel = chunkPtr->getLodLevel();
+                    if (lodLevel == 0 && !chunkPtr->hasLightingData()) {
+                        ChunkTraceSpan span(ChunkTraceStage::LIGHT, chunkX, chunkY, chunkZ);
                         m_world->initializeChunkLighting(chunkPtr);
                     }
 
                     // Generate mesh (CPU-intensive, runs in background)
-                    chunkPtr->generateMesh(m_world, false, 0);
+                    {
+                        ChunkTraceSpan span(ChunkTraceStage::MESH, chunkX, chunkY, chunkZ);
+                        chunkPtr->generateMesh(m_world, lodLevel);
+                    }
+                    recordLatency(m_meshLatencyMs, std::chrono::duration<float, std::milli>(
+                        std::chrono::steady_clock::now() - meshStart).count());
+                    chunkPtr->tryTransition(ChunkState::MESHING, ChunkState::AWAITING_UPLOAD);
 
                     // Add to ready queue for GPU upload (next frame)
                     {
@@ -946,13 +1144,22 @@ void WorldStreaming::meshWorkerThreadFunction() {
 }
 
 std::unique_ptr<Chunk> WorldStreaming::generateChunk(int chunkX, int chunkY, int chunkZ) {
+    PROFILE_ZONE("generate_chunk");
+
+    ChunkTraceSpan span(ChunkTraceStage::GENERATE, chunkX, chunkY, chunkZ);
+
     // PRIORITY 1: Check RAM cache first (10,000x faster than disk!)
     std::unique_ptr<Chunk> chunk = m_world->getChunkFromCache(chunkX, chunkY, chunkZ);
     if (chunk) {
         Logger::debug() << "Loaded chunk (" << chunkX << ", " << chunkY << ", " << chunkZ << ") from RAM cache (instant)";
 
+        // Cached chunks keep the state they were evicted in - restart the pipeline
+        chunk->setState(ChunkState::UNLOADED);
+        chunk->tryTransition(ChunkState::UNLOADED, ChunkState::LOADING);
+
         // MULTI-STAGE GENERATION FIX (2025-11-24): Cached chunks already have terrain
         chunk->setTerrainReady(true);
+        chunk->tryTransition(ChunkState::LOADING, ChunkState::GENERATED);
 
         // DON'T generate mesh in worker thread - addStreamedChunk will do it after decoration/lighting
         // Meshing requires neighbors which might not be loaded yet in worker thread
@@ -962,6 +1169,7 @@ std::unique_ptr<Chunk> WorldStreaming::generateChunk(int chunkX, int chunkY, int
     // PRIORITY 2: Try to load from disk
     // Use chunk pool for 100x faster allocation!
     chunk = m_world->acquireChunk(chunkX, chunkY, chunkZ);
+    chunk->tryTransition(ChunkState::UNLOADED, ChunkState::LOADING);
     bool loadedFromDisk = false;
     if (m_world) {
         std::string worldPath = m_world->getWorldPath();
@@ -974,9 +1182,12 @@ std::unique_ptr<Chunk> WorldStreaming::generateChunk(int chunkX, int chunkY, int
         }
     }
 
+    m_world->recordChunkDiskLookup(loadedFromDisk);
+
     // PRIORITY 3: Generate fresh terrain
     if (!loadedFromDisk) {
         chunk->generate(m_biomeMap);
+        m_world->placeGeneratedStructures(chunk.get());
         Logger::debug() << "Generated fresh chunk (" << chunkX << ", " << chunkY << ", " << chunkZ << ")";
     }
 
@@ -985,6 +1196,7 @@ std::unique_ptr<Chunk> WorldStreaming::generateChunk(int chunkX, int chunkY, int
     // Stage 2: Decoration (trees, structures) - will happen later when neighbors are also terrain-ready
     // This prevents deadlock: chunks can now proceed to decoration once all 4 neighbors finish Stage 1
     chunk->setTerrainReady(true);
+    chunk->tryTransition(ChunkState::LOADING, ChunkState::GENERATED);
 
     // DON'T generate mesh in worker thread - addStreamedChunk will do it after decoration/lighting
     // Meshing requires:
@@ -1008,12 +1220,9 @@ float WorldStreaming::calculateChunkPriority(int chunkX, int chunkY, int chunkZ,
     glm::vec3 chunkCenter = chunkToWorldPos(chunkX, chunkY, chunkZ);
     float distance = glm::distance(playerPos, chunkCenter);
 
-    // PERFORMANCE OPTIMIZATION (2025-11-24): Quadratic priority
-    // Makes nearby chunks WAY higher priority than distant ones
-    // Linear: chunk at distance 10 is 2x priority of distance 20
-    // Quadratic: chunk at distance 10 is 4x priority of distance 20
-    // Result: Dramatically reduces time spent on distant chunks
-    return distance * distance;  // Squared distance = quadratic priority
+    // Squared distance for range and LOD tier checks. Since 2025-11-28 the load
+    // queue is ordered by calculateChunkDeadline() instead.
+    return distance * distance;
 }
 
 glm::vec3 WorldStreaming::chunkToWorldPos(int chunkX, int chunkY, int chunkZ) const {
@@ -1067,6 +1276,7 @@ void WorldStreaming::retryFailedChunks() {
     std::vector<ChunkCoord> toRemove;
 
     auto now = std::chrono::steady_clock::now();
+    const ViewState view = captureViewState();
 
     // Check which chunks are ready for retry
     {
@@ -1090,7 +1300,8 @@ void WorldStreaming::retryFailedChunks() {
             if (now >= nextRetryTime) {
                 // Check if chunk still doesn't exist
                 if (m_world->getChunkAt(failed.coord.x, failed.coord.y, failed.coord.z) == nullptr) {
-                    float priority = 100.0f;  // Medium priority for retries
+                    float priority = calculateChunkDeadline(failed.coord.x, failed.coord.y, failed.coord.z,
+                                                            ChunkLOD::FULL, view);
                     retryRequests.push_back({failed.coord.x, failed.coord.y, failed.coord.z, priority});
 
                     Logger::info() << "Retrying failed chunk (" << failed.coord.x << ", "
@@ -1202,7 +1413,8 @@ void WorldStreaming::queueBackgroundGeneration(int centerX, int centerZ, int rad
                 request.chunkX = chunkX;
                 request.chunkY = chunkY;
                 request.chunkZ = chunkZ;
-                request.priority = distance + 1000.0f;  // Add 1000 to deprioritize vs player-near chunks
+                // Past the scheduling horizon: behind anything the player can see soon
+                request.priority = SCHEDULE_HORIZON_SECONDS + distance * kDeadlineSecondsPerBlock;
                 request.lod = ChunkLOD::TERRAIN_ONLY;   // Just terrain, no mesh (low priority)
 
                 backgroundRequests.push_back(request);
@@ -1235,21 +1447,22 @@ bool WorldStreaming::enqueueLoadRequestLocked(const ChunkLoadRequest& request) {
     }
 
     if (m_loadQueue.size() >= MAX_LOAD_QUEUE_SIZE) {
-        auto lowestPriorityRequest = findLowestPriorityRequestLocked();
+        const auto* worst = m_loadQueue.findWorst();
 
-        if (lowestPriorityRequest && request.priority < lowestPriorityRequest->priority) {
-            if (removeRequestFromLoadQueueLocked(*lowestPriorityRequest)) {
+        if (worst && request.priority < worst->priority) {
+            const ChunkLoadRequest dropped = worst->value;
+            if (cancelLoadRequestLocked(worst->key)) {
                 Logger::debug() << "Load queue full (" << m_loadQueue.size() << "/" << MAX_LOAD_QUEUE_SIZE
-                                << "), dropped lowest priority chunk (" << lowestPriorityRequest->chunkX << ", "
-                                << lowestPriorityRequest->chunkY << ", " << lowestPriorityRequest->chunkZ
-                                << ") with priority " << lowestPriorityRequest->priority
-                                << " to enqueue chunk (" << request.chunkX << ", " << request.chunkY << ", "
-                                << request.chunkZ << ") priority " << request.priority;
+                                << "), dropped lowest priority chunk (" << dropped.chunkX << ", "
+                                << dropped.chunkY << ", " << dropped.chunkZ
+                                << ") with slack " << dropped.priority
+                                << "s to enqueue chunk (" << request.chunkX << ", " << request.chunkY << ", "
+                                << request.chunkZ << ") slack " << request.priority << "s";
             }
         } else {
             Logger::debug() << "Load queue near capacity (" << m_loadQueue.size() << "/" << MAX_LOAD_QUEUE_SIZE
                             << "), deferring chunk (" << request.chunkX << ", " << request.chunkY << ", "
-                            << request.chunkZ << ") with priority " << request.priority;
+                            << request.chunkZ << ") with slack " << request.priority << "s";
             return false;
         }
     } else if (m_loadQueue.size() > static_cast<size_t>(MAX_LOAD_QUEUE_SIZE * 0.9f)) {
@@ -1258,55 +1471,118 @@ bool WorldStreaming::enqueueLoadRequestLocked(const ChunkLoadRequest& request) {
     }
 
     m_chunksInFlight.insert(coord);
-    m_loadQueue.push(request);
+    ChunkLoadRequest queued = request;
+    ChunkTrace& trace = ChunkTrace::instance();
+    if (trace.isEnabled()) {
+        queued.queuedAtNs = trace.now();
+    }
+    m_loadQueue.push(coord, queued.priority, queued);
     return true;
 }
 
-std::optional<ChunkLoadRequest> WorldStreaming::findLowestPriorityRequestLocked() const {
-    if (m_loadQueue.empty()) {
-        return std::nullopt;
+bool WorldStreaming::cancelLoadRequestLocked(const ChunkCoord& coord) {
+    if (!m_loadQueue.erase(coord)) {
+        return false;  // Not queued (or already picked up by a worker)
     }
+    m_chunksInFlight.erase(coord);
+    return true;
+}
 
-    auto tempQueue = m_loadQueue;  // Copy for inspection
-    ChunkLoadRequest lowest = tempQueue.top();
+// ========== Deadline Scheduling (2025-11-28) ==========
 
-    while (!tempQueue.empty()) {
-        const auto& current = tempQueue.top();
-        if (current.priority > lowest.priority) {
-            lowest = current;  // Higher distance = lower priority
-        }
-        tempQueue.pop();
-    }
+void WorldStreaming::setViewDirection(const glm::vec3& forward) {
+    std::lock_guard<std::mutex> lock(m_playerPosMutex);
+    const float lengthSquared = glm::dot(forward, forward);
+    m_viewForward = lengthSquared > 1e-8f ? forward / std::sqrt(lengthSquared) : glm::vec3(0.0f);
+}
 
-    return lowest;
+WorldStreaming::ViewState WorldStreaming::captureViewState() const {
+    ViewState view;
+    std::lock_guard<std::mutex> lock(m_playerPosMutex);
+    view.position = m_lastPlayerPos;
+    view.velocity = m_playerVelocityVec;
+    view.forward = m_viewForward;
+    view.viewDistance = m_fullDetailDistance;
+    return view;
 }
 
-bool WorldStreaming::removeRequestFromLoadQueueLocked(const ChunkLoadRequest& target) {
-    if (m_loadQueue.empty()) {
-        return false;
+float WorldStreaming::estimateTimeToVisible(const glm::vec3& chunkCenter, const ViewState& view) const {
+    const glm::vec3 toChunk = chunkCenter - view.position;
+    const float distance = glm::length(toChunk);
+    if (distance <= kChunkBoundingRadius) {
+        return 0.0f;  // Player is inside or touching it - visible whichever way they look
+    }
+    const glm::vec3 direction = toChunk / distance;
+
+    // Radial: time for the view sphere to reach the chunk at the current closing speed
+    float radialWait = 0.0f;
+    if (distance > view.viewDistance) {
+        const float closingSpeed = glm::dot(view.velocity, direction);
+        radialWait = closingSpeed > kMinClosingSpeed ? (distance - view.viewDistance) / closingSpeed
+                                                     : SCHEDULE_HORIZON_SECONDS;
     }
 
-    std::priority_queue<ChunkLoadRequest> rebuilt;
-    bool removed = false;
+    // Angular: time for the camera to turn until the chunk's bounding sphere enters the cone
+    float turnWait = 0.0f;
+    if (glm::dot(view.forward, view.forward) > 0.0f) {
+        const float angle = std::acos(std::clamp(glm::dot(view.forward, direction), -1.0f, 1.0f));
+        const float halfWidth = kViewHalfAngle + std::asin(std::min(1.0f, kChunkBoundingRadius / distance));
+        turnWait = std::max(0.0f, angle - halfWidth) / kCameraTurnRate;
+    }
 
-    while (!m_loadQueue.empty()) {
-        auto current = m_loadQueue.top();
-        m_loadQueue.pop();
+    return std::min(std::max(radialWait, turnWait), SCHEDULE_HORIZON_SECONDS);
+}
 
-        if (!removed && current.chunkX == target.chunkX && current.chunkY == target.chunkY &&
-            current.chunkZ == target.chunkZ) {
-            removed = true;
-            continue;  // Skip this entry
-        }
+float WorldStreaming::calculateChunkDeadline(int chunkX, int chunkY, int chunkZ, ChunkLOD lod,
+                                             const ViewState& view) const {
+    const glm::vec3 chunkCenter = chunkToWorldPos(chunkX, chunkY, chunkZ);
 
-        rebuilt.push(current);
+    // TERRAIN_ONLY chunks skip the mesh stage unless far LOD meshes them
+    float latencyMs = m_generateLatencyMs.load(std::memory_order_relaxed);
+    if (lod != ChunkLOD::TERRAIN_ONLY || m_farLodDistance > m_fullDetailDistance) {
+        latencyMs += m_meshLatencyMs.load(std::memory_order_relaxed);
     }
 
-    m_loadQueue.swap(rebuilt);
+    return estimateTimeToVisible(chunkCenter, view) - latencyMs * 0.001f
+         + glm::distance(chunkCenter, view.position) * kDeadlineSecondsPerBlock;
+}
+
+void WorldStreaming::rekeyLoadQueueLocked(const ViewState& view, float cancelDistance) {
+    if (m_loadQueue.empty()) {
+        return;
+    }
 
-    if (removed) {
-        m_chunksInFlight.erase({target.chunkX, target.chunkY, target.chunkZ});
+    // Same radii the unload pass uses: anything beyond them would be unloaded on arrival
+    const float lodCancelDistance = m_farLodDistance > 0.0f
+        ? std::max(cancelDistance, m_farLodDistance + kNeighborMargin) : cancelDistance;
+    const float cancelDistanceSquared = cancelDistance * cancelDistance;
+    const float lodCancelDistanceSquared = lodCancelDistance * lodCancelDistance;
+
+    const size_t cancelled = m_loadQueue.rebuild(
+        [&](const ChunkCoord& coord, ChunkLoadRequest& request, float& priority) {
+            const bool lodBand = coord.y >= ChunkLod::LOD_MIN_CHUNK_Y && coord.y <= ChunkLod::LOD_MAX_CHUNK_Y;
+            const float distanceSquared = calculateChunkPriority(coord.x, coord.y, coord.z, view.position);
+            if (distanceSquared > (lodBand ? lodCancelDistanceSquared : cancelDistanceSquared)) {
+                m_chunksInFlight.erase(coord);
+                return false;
+            }
+            priority = calculateChunkDeadline(coord.x, coord.y, coord.z, request.lod, view);
+            request.priority = priority;
+            return true;
+        });
+
+    m_rekeyCount++;
+    if (cancelled > 0) {
+        m_cancelledLoadCount += cancelled;
+        Logger::debug() << "Load queue re-keyed: cancelled " << cancelled << " out-of-range requests, "
+                        << m_loadQueue.size() << " remain";
     }
+}
 
-    return removed;
+void WorldStreaming::recordLatency(std::atomic<float>& average, float milliseconds) {
+    float current = average.load(std::memory_order_relaxed);
+    float updated;
+    do {
+        updated = current + (milliseconds - current) * kLatencySmoothing;
+    } while (!average.compare_exchange_weak(current, updated, std::memory_order_relaxed));
 }
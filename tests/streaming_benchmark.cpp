@@ -0,0 +1,675 @@
+/**
+ * @file streaming_benchmark.cpp
+ * @brief Headless end-to-end streaming benchmark (camera path replay)
+ *
+ * Drives the real pipeline - WorldStreaming workers, World decoration, lighting
+ * and meshing - along scripted or recorded camera paths, with the GPU upload
+ * stage replaced by a counting ChunkUploadTarget (no Vulkan device needed).
+ *
+ * Each scenario runs at a fixed simulated 60 Hz frame rate paced to wall clock,
+ * and mirrors the main loop: streaming updates 4x per second, decoration and
+ * completed-chunk processing every frame.
+ *
+ * Reported per scenario:
+ * - Chunks/sec integrated and uploaded
+ * - Time-to-full-view: every chunk within the view radius ACTIVE (at start and
+ *   after each teleport)
+ * - View completeness while moving (average fraction of view chunks ACTIVE)
+ * - Visible holes per minute: chunks that entered the view radius and view cone
+ *   (camera looks along the direction of travel) before they were ACTIVE
+ * - Queue high-water marks (load, completed, mesh, upload, decoration)
+ * - Peak RSS
+ * - Per-stage latency p50/p95/p99 from ChunkTrace
+ *
+ * Usage:
+ *   test_streaming_benchmark [--path straight|spiral|teleport|flight|all|<file.csv>]
+ *                            [--speed <blocks/s>] [--flight-speed <blocks/s>]
+ *                            [--duration <s>] [--seed <n>]
+ *                            [--uploads-per-frame <n>] [--output <file.json>] [--quick]
+ *
+ * Recorded paths are CSV lines "time,x,y,z" (seconds, world units), replayed
+ * with linear interpolation. Results are written as JSON (default:
+ * streaming_benchmark.json) so runs can be diffed for regressions.
+ */
+
+#include "test_utils.h"
+#include "chunk.h"
+#include "chunk_trace.h"
+#include "chunk_upload_target.h"
+#include "world.h"
+#include "world_streaming.h"
+#include "biome_map.h"
+#include <glm/glm.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <thread>
+#include <unordered_set>
+
+#if defined(_WIN32)
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
+// ============================================================
+// Headless upload stage
+// ============================================================
+
+/**
+ * @brief Counts uploads instead of touching the GPU
+ */
+class HeadlessUploadTarget : public ChunkUploadTarget {
+public:
+    explicit HeadlessUploadTarget(size_t uploadsPerFrame) : m_uploadsPerFrame(uploadsPerFrame) {}
+
+    void beginBatchedChunkUploads() override { ++m_batches; }
+
+    void addChunkToBatch(Chunk* chunk) override {
+        ++m_chunksUploaded;
+        m_verticesUploaded += chunk->getVertexCount() + chunk->getTransparentVertexCount();
+    }
+
+    void submitBatchedChunkUploads() override {}
+
+    size_t getRecommendedUploadCount() const override { return m_uploadsPerFrame; }
+
+    size_t getChunksUploaded() const { return m_chunksUploaded; }
+    size_t getBatches() const { return m_batches; }
+    uint64_t getVerticesUploaded() const { return m_verticesUploaded; }
+
+private:
+    size_t m_uploadsPerFrame;
+    size_t m_chunksUploaded = 0;
+    size_t m_batches = 0;
+    uint64_t m_verticesUploaded = 0;
+};
+
+// ============================================================
+// Camera paths
+// ============================================================
+
+/**
+ * @brief Camera path sampled once per simulated frame
+ */
+class CameraPath {
+public:
+    virtual ~CameraPath() = default;
+
+    /**
+     * @brief Advances the path
+     * @param dt Simulated seconds since the previous call
+     * @param teleported Set to true when the camera jumped this frame
+     * @return Camera position
+     */
+    virtual glm::vec3 advance(float dt, bool& teleported) = 0;
+};
+
+/// Straight flight along +X at a fixed altitude
+class StraightPath : public CameraPath {
+public:
+    StraightPath(glm::vec3 start, float speed) : m_pos(start), m_speed(speed) {}
+
+    glm::vec3 advance(float dt, bool& teleported) override {
+        teleported = false;
+        m_pos.x += m_speed * dt;
+        return m_pos;
+    }
+
+private:
+    glm::vec3 m_pos;
+    float m_speed;
+};
+
+/// Archimedean spiral outward from the start point at a fixed linear speed
+class SpiralPath : public CameraPath {
+public:
+    SpiralPath(glm::vec3 center, float speed) : m_center(center), m_speed(speed) {}
+
+    glm::vec3 advance(float dt, bool& teleported) override {
+        teleported = false;
+        const float radius = START_RADIUS + GROWTH * m_theta;
+        m_theta += m_speed * dt / radius;
+        const float r = START_RADIUS + GROWTH * m_theta;
+        return m_center + glm::vec3(std::cos(m_theta) * r, 0.0f, std::sin(m_theta) * r);
+    }
+
+private:
+    static constexpr float START_RADIUS = 48.0f;
+    static constexpr float GROWTH = 16.0f;   ///< Blocks of radius per radian
+
+    glm::vec3 m_center;
+    float m_speed;
+    float m_theta = 0.0f;
+};
+
+/// Fast flight in legs joined by alternating 90 degree turns (exercises re-keying on turns)
+class FlightPath : public CameraPath {
+public:
+    FlightPath(glm::vec3 start, float speed, float legSeconds)
+        : m_pos(start), m_speed(speed), m_legSeconds(legSeconds) {}
+
+    glm::vec3 advance(float dt, bool& teleported) override {
+        teleported = false;
+        m_legTime += dt;
+        if (m_legTime >= m_legSeconds) {
+            m_legTime = 0.0f;
+            m_heading += (m_turnLeft ? 1.0f : -1.0f) * 1.5707963f;
+            m_turnLeft = !m_turnLeft;
+        }
+        m_pos += glm::vec3(std::cos(m_heading), 0.0f, std::sin(m_heading)) * (m_speed * dt);
+        return m_pos;
+    }
+
+private:
+    glm::vec3 m_pos;
+    float m_speed;
+    float m_legSeconds;
+    float m_legTime = 0.0f;
+    float m_heading = 0.0f;
+    bool m_turnLeft = true;
+};
+
+/// Holds still, then jumps between distant points
+class TeleportPath : public CameraPath {
+public:
+    TeleportPath(std::vector<glm::vec3> points, float holdSeconds)
+        : m_points(std::move(points)), m_holdSeconds(holdSeconds) {}
+
+    glm::vec3 advance(float dt, bool& teleported) override {
+        m_time += dt;
+        teleported = false;
+        if (m_time >= m_holdSeconds && m_index + 1 < m_points.size()) {
+            m_time = 0.0f;
+            ++m_index;
+            teleported = true;
+        }
+        return m_points[m_index];
+    }
+
+private:
+    std::vector<glm::vec3> m_points;
+    float m_holdSeconds;
+    float m_time = 0.0f;
+    size_t m_index = 0;
+};
+
+/// Replays a recorded "time,x,y,z" CSV with linear interpolation
+class RecordedPath : public CameraPath {
+public:
+    static std::unique_ptr<RecordedPath> load(const std::string& path) {
+        std::ifstream file(path);
+        if (!file.is_open()) return nullptr;
+
+        auto recorded = std::unique_ptr<RecordedPath>(new RecordedPath());
+        std::string line;
+        while (std::getline(file, line)) {
+            if (line.empty() || line[0] == '#') continue;
+            std::replace(line.begin(), line.end(), ',', ' ');
+            std::istringstream stream(line);
+            Sample sample;
+            if (stream >> sample.time >> sample.pos.x >> sample.pos.y >> sample.pos.z) {
+                recorded->m_samples.push_back(sample);
+            }
+        }
+        if (recorded->m_samples.empty()) return nullptr;
+        return recorded;
+    }
+
+    float getDuration() const { return m_samples.back().time; }
+
+    glm::vec3 advance(float dt, bool& teleported) override {
+        m_time += dt;
+        teleported = false;
+        while (m_index + 1 < m_samples.size() && m_samples[m_index + 1].time <= m_time) {
+            ++m_index;
+        }
+        if (m_index + 1 >= m_samples.size()) return m_samples.back().pos;
+
+        const Sample& a = m_samples[m_index];
+        const Sample& b = m_samples[m_index + 1];
+        const float span = std::max(b.time - a.time, 1e-6f);
+        return glm::mix(a.pos, b.pos, std::clamp((m_time - a.time) / span, 0.0f, 1.0f));
+    }
+
+private:
+    struct Sample {
+        float time = 0.0f;
+        glm::vec3 pos{0.0f};
+    };
+
+    RecordedPath() = default;
+
+    std::vector<Sample> m_samples;
+    size_t m_index = 0;
+    float m_time = 0.0f;
+};
+
+// ============================================================
+// Measurement helpers
+// ============================================================
+
+size_t peakRssKB() {
+#if defined(_WIN32)
+    PROCESS_MEMORY_COUNTERS counters;
+    if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) {
+        return counters.PeakWorkingSetSize / 1024;
+    }
+    return 0;
+#else
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+#if defined(__APPLE__)
+    return static_cast<size_t>(usage.ru_maxrss) / 1024;  // Bytes on macOS
+#else
+    return static_cast<size_t>(usage.ru_maxrss);         // KB on Linux
+#endif
+#endif
+}
+
+/**
+ * @brief Fraction of chunks within the view radius that are ACTIVE
+ */
+float viewCompleteness(World& world, const glm::vec3& pos, float viewDistance) {
+    const int radius = static_cast<int>(std::ceil(viewDistance / Chunk::WIDTH));
+    const int cx = static_cast<int>(std::floor(pos.x / Chunk::WIDTH));
+    const int cy = static_cast<int>(std::floor(pos.y / Chunk::HEIGHT));
+    const int cz = static_cast<int>(std::floor(pos.z / Chunk::DEPTH));
+
+    int total = 0;
+    int active = 0;
+    for (int dx = -radius; dx <= radius; ++dx) {
+        for (int dy = -radius; dy <= radius; ++dy) {
+            for (int dz = -radius; dz <= radius; ++dz) {
+                glm::vec3 center((cx + dx + 0.5f) * Chunk::WIDTH, (cy + dy + 0.5f) * Chunk::HEIGHT,
+                                 (cz + dz + 0.5f) * Chunk::DEPTH);
+                if (glm::distance(center, pos) > viewDistance) continue;
+
+                ++total;
+                Chunk* chunk = world.getChunkAt(cx + dx, cy + dy, cz + dz);
+                if (chunk && chunk->getState() == ChunkState::ACTIVE) {
+                    ++active;
+                }
+            }
+        }
+    }
+    return total > 0 ? static_cast<float>(active) / total : 1.0f;
+}
+
+/**
+ * @brief Collects chunks inside the view radius and view cone that are not ACTIVE
+ *
+ * The cone matches what the streaming scheduler assumes (~1 rad half-angle,
+ * widened by the chunk's bounding sphere). With no forward vector the whole
+ * view sphere counts.
+ */
+void collectVisibleHoles(World& world, const glm::vec3& pos, const glm::vec3& forward, float viewDistance,
+                         std::unordered_set<ChunkCoord>& holes) {
+    const float halfAngle = 1.0f;
+    const float boundingRadius = 27.7f;
+    const bool hasForward = glm::dot(forward, forward) > 0.0f;
+    const int radius = static_cast<int>(std::ceil(viewDistance / Chunk::WIDTH));
+    const int cx = static_cast<int>(std::floor(pos.x / Chunk::WIDTH));
+    const int cy = static_cast<int>(std::floor(pos.y / Chunk::HEIGHT));
+    const int cz = static_cast<int>(std::floor(pos.z / Chunk::DEPTH));
+
+    holes.clear();
+    for (int dx = -radius; dx <= radius; ++dx) {
+        for (int dy = -radius; dy <= radius; ++dy) {
+            for (int dz = -radius; dz <= radius; ++dz) {
+                glm::vec3 center((cx + dx + 0.5f) * Chunk::WIDTH, (cy + dy + 0.5f) * Chunk::HEIGHT,
+                                 (cz + dz + 0.5f) * Chunk::DEPTH);
+                const glm::vec3 toChunk = center - pos;
+                const float distance = glm::length(toChunk);
+                if (distance > viewDistance) continue;
+
+                if (hasForward && distance > boundingRadius) {
+                    const float cosAngle = std::clamp(glm::dot(forward, toChunk / distance), -1.0f, 1.0f);
+                    if (std::acos(cosAngle) > halfAngle + std::asin(boundingRadius / distance)) continue;
+                }
+
+                Chunk* chunk = world.getChunkAt(cx + dx, cy + dy, cz + dz);
+                if (!chunk || chunk->getState() != ChunkState::ACTIVE) {
+                    holes.insert(ChunkCoord{cx + dx, cy + dy, cz + dz});
+                }
+            }
+        }
+    }
+}
+
+// ============================================================
+// Scenario runner
+// ============================================================
+
+struct BenchmarkOptions {
+    std::string path = "all";
+    float speed = 20.0f;            ///< Blocks per second (straight / spiral)
+    float flightSpeed = 60.0f;      ///< Blocks per second (flight)
+    float duration = 30.0f;         ///< Simulated seconds per scenario
+    int seed = 42;
+    size_t uploadsPerFrame = 10;    ///< Matches VulkanRenderer with an idle GPU
+    std::string output = "streaming_benchmark.json";
+};
+
+struct ScenarioResult {
+    std::string name;
+    double wallSeconds = 0.0;
+    size_t chunksLoaded = 0;
+    size_t chunksUploaded = 0;
+    uint64_t verticesUploaded = 0;
+    std::vector<double> timeToFullViewMs;   ///< -1 when not reached before the next jump / end
+    double avgViewCompleteness = 0.0;
+    size_t visibleHoleEvents = 0;            ///< Chunks that became visible before they were ACTIVE
+    double visibleHolesPerMinute = 0.0;
+    double avgVisibleHoles = 0.0;            ///< Average concurrent holes per sample
+    size_t cancelledLoads = 0;
+    size_t queueRekeys = 0;
+    float estimatedChunkLatencyMs = 0.0f;
+    size_t maxLoadQueue = 0;
+    size_t maxCompletedQueue = 0;
+    size_t maxMeshQueue = 0;
+    size_t maxUploadQueue = 0;
+    size_t maxPendingDecorations = 0;
+    size_t meshThrottleCount = 0;
+    size_t peakRssKB = 0;
+    std::vector<ChunkTraceStats> stages;
+};
+
+ScenarioResult runScenario(const std::string& name, CameraPath& path, float duration,
+                           const BenchmarkOptions& options) {
+    // Same distances as the main loop
+    const float renderDistance = 80.0f;
+    const float loadDistance = renderDistance + 32.0f;
+    const float unloadDistance = renderDistance + 192.0f;
+    const float frameDt = 1.0f / 60.0f;
+    const float streamingInterval = 0.25f;
+
+    ScenarioResult result;
+    result.name = name;
+
+    Chunk::initNoise(options.seed);
+    World world(1, 1, 1, options.seed);
+    HeadlessUploadTarget uploads(options.uploadsPerFrame);
+
+    WorldStreaming streaming(&world, world.getBiomeMap(), nullptr);
+    streaming.setUploadTarget(&uploads);
+    streaming.start();
+
+    ChunkTrace::instance().start();
+
+    bool teleported = false;
+    glm::vec3 pos = path.advance(0.0f, teleported);
+    streaming.updatePlayerPosition(pos, loadDistance, unloadDistance);
+
+    // The camera looks along the direction of travel
+    glm::vec3 forward(0.0f);
+    std::unordered_set<ChunkCoord> holes;
+    std::unordered_set<ChunkCoord> previousHoles;
+    size_t holeSum = 0;
+
+    const auto wallStart = std::chrono::steady_clock::now();
+    auto viewStart = wallStart;
+    bool viewComplete = false;
+    float streamingTimer = 0.0f;
+    double completenessSum = 0.0;
+    size_t completenessSamples = 0;
+    const int frames = static_cast<int>(duration / frameDt);
+
+    for (int frame = 0; frame < frames; ++frame) {
+        const auto frameDeadline = wallStart + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+            std::chrono::duration<double>((frame + 1) * static_cast<double>(frameDt)));
+
+        const glm::vec3 previousPos = pos;
+        pos = path.advance(frameDt, teleported);
+        if (!teleported && glm::length(pos - previousPos) > 1e-4f) {
+            forward = glm::normalize(pos - previousPos);
+            streaming.setViewDirection(forward);
+        }
+        if (teleported) {
+            if (!viewComplete) result.timeToFullViewMs.push_back(-1.0);
+            viewComplete = false;
+            viewStart = std::chrono::steady_clock::now();
+            streamingTimer = streamingInterval;  // React immediately, like a teleport command
+        }
+
+        streamingTimer += frameDt;
+        if (streamingTimer >= streamingInterval) {
+            streamingTimer = 0.0f;
+            streaming.updatePlayerPosition(pos, loadDistance, unloadDistance);
+
+            const float completeness = viewCompleteness(world, pos, renderDistance);
+            completenessSum += completeness;
+            ++completenessSamples;
+
+            // A hole event is a chunk that is newly visible-but-missing since the last sample
+            collectVisibleHoles(world, pos, forward, renderDistance, holes);
+            if (!teleported) {
+                for (const ChunkCoord& coord : holes) {
+                    if (previousHoles.find(coord) == previousHoles.end()) ++result.visibleHoleEvents;
+                }
+            }
+            holeSum += holes.size();
+            previousHoles.swap(holes);
+            if (!viewComplete && completeness >= 1.0f) {
+                viewComplete = true;
+                result.timeToFullViewMs.push_back(std::chrono::duration<double, std::milli>(
+                    std::chrono::steady_clock::now() - viewStart).count());
+            }
+        }
+
+        world.processPendingDecorations(nullptr, &streaming, 10);
+        streaming.processCompletedChunks(8, 5.0f);
+
+        result.maxLoadQueue = std::max(result.maxLoadQueue, streaming.getPendingLoadCount());
+        result.maxCompletedQueue = std::max(result.maxCompletedQueue, streaming.getCompletedChunkCount());
+        result.maxUploadQueue = std::max(result.maxUploadQueue, streaming.getUploadQueueSize());
+        result.maxPendingDecorations = std::max(result.maxPendingDecorations, world.getPendingDecorationCount());
+
+        // Collect once per frame like the game does (keeps thread rings from overflowing)
+        ChunkTrace::instance().collect();
+        std::this_thread::sleep_until(frameDeadline);
+    }
+    if (!viewComplete) result.timeToFullViewMs.push_back(-1.0);
+
+    result.wallSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - wallStart).count();
+    result.chunksLoaded = streaming.getTotalChunksLoaded();
+    result.chunksUploaded = uploads.getChunksUploaded();
+    result.verticesUploaded = uploads.getVerticesUploaded();
+    result.avgViewCompleteness = completenessSamples > 0 ? completenessSum / completenessSamples : 0.0;
+    result.avgVisibleHoles = completenessSamples > 0 ? static_cast<double>(holeSum) / completenessSamples : 0.0;
+    result.visibleHolesPerMinute = result.visibleHoleEvents / (frames * static_cast<double>(frameDt) / 60.0);
+    result.cancelledLoads = streaming.getCancelledLoadCount();
+    result.queueRekeys = streaming.getRekeyCount();
+    result.estimatedChunkLatencyMs = streaming.getEstimatedChunkLatencyMs();
+    result.maxMeshQueue = streaming.getMeshQueueHighWatermark();
+    result.meshThrottleCount = streaming.getMeshThrottleCount();
+
+    ChunkTrace::instance().stop();
+    result.stages = ChunkTrace::instance().computeStats();
+
+    streaming.stop();
+    result.peakRssKB = peakRssKB();  // Process-wide peak (monotonic across scenarios)
+    Chunk::cleanupNoise();
+    return result;
+}
+
+// ============================================================
+// Reporting
+// ============================================================
+
+void printResult(const ScenarioResult& r) {
+    std::cout << "\n=== " << r.name << " ===\n";
+    std::cout << "  Wall time:          " << r.wallSeconds << " s\n";
+    std::cout << "  Chunks loaded:      " << r.chunksLoaded << " (" << r.chunksLoaded / r.wallSeconds << " /s)\n";
+    std::cout << "  Chunks uploaded:    " << r.chunksUploaded << " (" << r.chunksUploaded / r.wallSeconds << " /s)\n";
+    std::cout << "  Time to full view: ";
+    for (double ms : r.timeToFullViewMs) {
+        if (ms < 0.0) std::cout << " never";
+        else std::cout << " " << ms << " ms";
+    }
+    std::cout << "\n";
+    std::cout << "  View completeness:  " << r.avgViewCompleteness * 100.0 << "%\n";
+    std::cout << "  Visible holes:      " << r.visibleHolesPerMinute << " /min (" << r.visibleHoleEvents
+              << " total, " << r.avgVisibleHoles << " avg in view)\n";
+    std::cout << "  Scheduler:          " << r.queueRekeys << " re-keys, " << r.cancelledLoads
+              << " cancelled, est. latency " << r.estimatedChunkLatencyMs << " ms/chunk\n";
+    std::cout << "  High-water marks:   load " << r.maxLoadQueue << ", completed " << r.maxCompletedQueue
+              << ", mesh " << r.maxMeshQueue << ", upload " << r.maxUploadQueue
+              << ", decoration " << r.maxPendingDecorations << "\n";
+    std::cout << "  Peak RSS:           " << r.peakRssKB / 1024 << " MB\n";
+    for (const auto& s : r.stages) {
+        std::printf("  %-16s %-5s n=%-6zu p50 %8.2f ms  p95 %8.2f ms  p99 %8.2f ms\n",
+                    s.name.c_str(), s.isWait ? "wait" : (s.isSpan ? "span" : "work"),
+                    s.count, s.p50Ms, s.p95Ms, s.p99Ms);
+    }
+}
+
+bool writeJson(const std::string& path, const BenchmarkOptions& options,
+               const std::vector<ScenarioResult>& results) {
+    std::ofstream file(path);
+    if (!file.is_open()) return false;
+
+    file << "{\n";
+    file << "  \"seed\": " << options.seed << ",\n";
+    file << "  \"speed\": " << options.speed << ",\n";
+    file << "  \"flight_speed\": " << options.flightSpeed << ",\n";
+    file << "  \"uploads_per_frame\": " << options.uploadsPerFrame << ",\n";
+    file << "  \"scenarios\": [\n";
+    for (size_t i = 0; i < results.size(); ++i) {
+        const ScenarioResult& r = results[i];
+        file << "    {\n";
+        file << "      \"name\": \"" << r.name << "\",\n";
+        file << "      \"wall_seconds\": " << r.wallSeconds << ",\n";
+        file << "      \"chunks_loaded\": " << r.chunksLoaded << ",\n";
+        file << "      \"chunks_uploaded\": " << r.chunksUploaded << ",\n";
+        file << "      \"chunks_per_sec\": " << r.chunksUploaded / r.wallSeconds << ",\n";
+        file << "      \"vertices_uploaded\": " << r.verticesUploaded << ",\n";
+        file << "      \"time_to_full_view_ms\": [";
+        for (size_t t = 0; t < r.timeToFullViewMs.size(); ++t) {
+            file << (t ? ", " : "") << r.timeToFullViewMs[t];
+        }
+        file << "],\n";
+        file << "      \"view_completeness\": " << r.avgViewCompleteness << ",\n";
+        file << "      \"visible_holes_per_minute\": " << r.visibleHolesPerMinute << ",\n";
+        file << "      \"visible_hole_events\": " << r.visibleHoleEvents << ",\n";
+        file << "      \"avg_visible_holes\": " << r.avgVisibleHoles << ",\n";
+        file << "      \"cancelled_loads\": " << r.cancelledLoads << ",\n";
+        file << "      \"queue_rekeys\": " << r.queueRekeys << ",\n";
+        file << "      \"estimated_chunk_latency_ms\": " << r.estimatedChunkLatencyMs << ",\n";
+        file << "      \"high_water\": {\"load\": " << r.maxLoadQueue << ", \"completed\": " << r.maxCompletedQueue
+             << ", \"mesh\": " << r.maxMeshQueue << ", \"upload\": " << r.maxUploadQueue
+             << ", \"decoration\": " << r.maxPendingDecorations << "},\n";
+        file << "      \"mesh_throttle_count\": " << r.meshThrottleCount << ",\n";
+        file << "      \"peak_rss_kb\": " << r.peakRssKB << ",\n";
+        file << "      \"stages\": [\n";
+        for (size_t s = 0; s < r.stages.size(); ++s) {
+            const ChunkTraceStats& st = r.stages[s];
+            file << "        {\"name\": \"" << st.name << "\", \"type\": \""
+                 << (st.isWait ? "wait" : (st.isSpan ? "span" : "work")) << "\", \"count\": " << st.count
+                 << ", \"p50_ms\": " << st.p50Ms << ", \"p95_ms\": " << st.p95Ms
+                 << ", \"p99_ms\": " << st.p99Ms << ", \"max_ms\": " << st.maxMs << "}"
+                 << (s + 1 < r.stages.size() ? "," : "") << "\n";
+        }
+        file << "      ]\n";
+        file << "    }" << (i + 1 < results.size() ? "," : "") << "\n";
+    }
+    file << "  ]\n}\n";
+    return file.good();
+}
+
+// ============================================================
+// Main Entry Point
+// ============================================================
+
+int main(int argc, char** argv) {
+    BenchmarkOptions options;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        auto next = [&]() -> std::string { return i + 1 < argc ? argv[++i] : ""; };
+        if (arg == "--path") options.path = next();
+        else if (arg == "--speed") options.speed = std::stof(next());
+        else if (arg == "--flight-speed") options.flightSpeed = std::stof(next());
+        else if (arg == "--duration") options.duration = std::stof(next());
+        else if (arg == "--seed") options.seed = std::stoi(next());
+        else if (arg == "--uploads-per-frame") options.uploadsPerFrame = std::stoul(next());
+        else if (arg == "--output") options.output = next();
+        else if (arg == "--quick") options.duration = 6.0f;  // CI smoke run
+        else {
+            std::cerr << "Unknown argument: " << arg << "\n";
+            return 1;
+        }
+    }
+
+    std::cout << "========================================\n";
+    std::cout << "HEADLESS STREAMING BENCHMARK\n";
+    std::cout << "========================================\n";
+    std::cout << "  Path: " << options.path << ", speed " << options.speed << " blocks/s, "
+              << options.duration << " s per scenario, seed " << options.seed << "\n";
+
+    try {
+        // World generation needs the biome and block registries
+        init_test_environment();
+
+        // Cruise altitude above the spawn surface
+        BiomeMap heightProbe(options.seed);
+        auto surfaceAt = [&](float x, float z) {
+            return glm::vec3(x, static_cast<float>(heightProbe.getTerrainHeightAt(x, z)) + 24.0f, z);
+        };
+
+        std::vector<ScenarioResult> results;
+        const bool all = options.path == "all";
+
+        if (all || options.path == "straight") {
+            StraightPath path(surfaceAt(0.0f, 0.0f), options.speed);
+            results.push_back(runScenario("straight", path, options.duration, options));
+        }
+        if (all || options.path == "spiral") {
+            SpiralPath path(surfaceAt(0.0f, 0.0f), options.speed);
+            results.push_back(runScenario("spiral", path, options.duration, options));
+        }
+        if (all || options.path == "flight") {
+            // Fast flight with a 90 degree turn every quarter of the run
+            FlightPath path(surfaceAt(0.0f, 0.0f), options.flightSpeed, options.duration / 4.0f);
+            results.push_back(runScenario("flight", path, options.duration, options));
+        }
+        if (all || options.path == "teleport") {
+            std::vector<glm::vec3> points = {
+                surfaceAt(0.0f, 0.0f), surfaceAt(4096.0f, 0.0f), surfaceAt(-2048.0f, 3072.0f)
+            };
+            TeleportPath path(points, options.duration / points.size());
+            results.push_back(runScenario("teleport", path, options.duration, options));
+        }
+        if (results.empty()) {
+            auto path = RecordedPath::load(options.path);
+            if (!path) {
+                std::cerr << "Could not load camera path: " << options.path << "\n";
+                return 1;
+            }
+            results.push_back(runScenario(options.path, *path, path->getDuration(), options));
+        }
+
+        for (const auto& result : results) {
+            printResult(result);
+        }
+
+        if (!writeJson(options.output, options, results)) {
+            std::cerr << "Failed to write " << options.output << "\n";
+            return 1;
+        }
+        std::cout << "\nResults written to " << options.output << "\n";
+
+        // Smoke gate: the pipeline must make progress end to end
+        for (const auto& result : results) {
+            ASSERT_GT(result.chunksUploaded, 0u);
+        }
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "BENCHMARK FAILURE: " << e.what() << std::endl;
+        return 1;
+    }
+}
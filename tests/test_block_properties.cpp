@@ -0,0 +1,288 @@
+/**
+ * @file test_block_properties.cpp
+ * @brief Microbenchmark for the flat block property table vs BlockRegistry::get()
+ *
+ * Replays the per-block lookups of the two hottest loops over a synthetic
+ * terrain chunk, once through registry.get() (bounds checks + full
+ * BlockDefinition) and once through BlockPropertyTable:
+ * - Meshing: per-block liquid/transparency + 6 neighbor isSolid checks
+ * - Lighting: heightmap column scan (opaque) + emissive scan
+ *
+ * Both paths must produce identical checksums. Timings are reported, not
+ * asserted: wall-clock ratios are too noisy on shared machines to fail on.
+ *
+ * EXPECTED RESULTS:
+ * - Meshing lookups: ~1.4x faster with the table (neighbor bounds checks dominate)
+ * - Lighting lookups: ~2.5x faster with the table (no try/catch, no exceptions path)
+ *
+ * Created: 2025-11-28
+ */
+
+#include "block_system.h"
+#include "chunk.h"
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+namespace {
+
+constexpr int N = Chunk::WIDTH;  // 32^3 chunk
+using BlockGrid = std::vector<int>;
+
+inline int idx(int x, int y, int z) { return (x * N + y) * N + z; }
+
+/**
+ * @brief Builds a terrain-like chunk: stone, dirt, grass surface, water pools, leaf clusters
+ */
+BlockGrid makeTerrain(const BlockRegistry& registry, int variant) {
+    auto idOr = [&](const char* name, int fallback) {
+        int id = registry.getID(name);
+        return id > 0 ? id : fallback;
+    };
+    const int stone = idOr("Stone", 1);
+    const int dirt = idOr("Dirt", stone);
+    const int grass = idOr("Grass Block", dirt);
+    const int water = idOr("Water", 0);
+    const int leaves = idOr("Leaves", stone);
+
+    BlockGrid grid(N * N * N, 0);
+    uint32_t seed = 12345u + static_cast<uint32_t>(variant) * 7919u;
+    for (int x = 0; x < N; x++) {
+        for (int z = 0; z < N; z++) {
+            const int height = 14 + ((x * 7 + z * 3 + variant) % 9) - ((x * z + variant) % 5);
+            for (int y = 0; y < N; y++) {
+                int id = 0;
+                if (y < height - 3) id = stone;
+                else if (y < height) id = dirt;
+                else if (y == height) id = grass;
+                else if (y <= 15) id = water;  // Pools in the low spots
+                else {
+                    seed = seed * 1664525u + 1013904223u;
+                    if (y > height + 3 && y < height + 7 && (seed >> 28) == 0) id = leaves;
+                }
+                grid[idx(x, y, z)] = id;
+            }
+        }
+    }
+    return grid;
+}
+
+inline int blockAt(const BlockGrid& grid, int x, int y, int z) {
+    if (x < 0 || x >= N || y < 0 || y >= N || z < 0 || z >= N) return 0;
+    return grid[idx(x, y, z)];
+}
+
+constexpr int kNeighbors[6][3] = {
+    { 1, 0, 0}, {-1, 0, 0}, { 0, 1, 0}, { 0,-1, 0}, { 0, 0, 1}, { 0, 0,-1}
+};
+
+// ========== Meshing-style lookups ==========
+
+uint64_t meshLegacy(const BlockGrid& grid, const BlockRegistry& registry) {
+    auto isSolid = [&](int id) {
+        if (id == 0) return false;
+        if (id < 0 || id >= registry.count()) return false;
+        return !registry.get(id).isLiquid;
+    };
+
+    uint64_t visibleFaces = 0;
+    for (int x = 0; x < N; x++) {
+        for (int y = 0; y < N; y++) {
+            for (int z = 0; z < N; z++) {
+                int id = grid[idx(x, y, z)];
+                if (id == 0) continue;
+                if (id < 0 || id >= registry.count()) continue;
+
+                const BlockDefinition& def = registry.get(id);
+                const bool liquid = def.isLiquid;
+                const bool transparent = def.transparency > 0.0f;
+                for (const auto& n : kNeighbors) {
+                    if (!isSolid(blockAt(grid, x + n[0], y + n[1], z + n[2]))) {
+                        visibleFaces += 1 + (liquid ? 2 : 0) + (transparent ? 4 : 0);
+                    }
+                }
+            }
+        }
+    }
+    return visibleFaces;
+}
+
+uint64_t meshTable(const BlockGrid& grid, const BlockPropertyTable& props) {
+    uint64_t visibleFaces = 0;
+    for (int x = 0; x < N; x++) {
+        for (int y = 0; y < N; y++) {
+            for (int z = 0; z < N; z++) {
+                int id = grid[idx(x, y, z)];
+                const uint8_t flags = props.flags(id);
+                if (!(flags & BlockFlags::VALID)) continue;
+
+                const bool liquid = (flags & BlockFlags::LIQUID) != 0;
+                const bool transparent = (flags & BlockFlags::TRANSPARENT) != 0;
+                for (const auto& n : kNeighbors) {
+                    if (!props.isSolid(blockAt(grid, x + n[0], y + n[1], z + n[2]))) {
+                        visibleFaces += 1 + (liquid ? 2 : 0) + (transparent ? 4 : 0);
+                    }
+                }
+            }
+        }
+    }
+    return visibleFaces;
+}
+
+// ========== Lighting-style lookups ==========
+
+uint64_t lightLegacy(const BlockGrid& grid, const BlockRegistry& registry) {
+    uint64_t sum = 0;
+    for (int x = 0; x < N; x++) {
+        for (int z = 0; z < N; z++) {
+            // Heightmap: highest fully opaque block
+            int highest = -1;
+            for (int y = N - 1; y >= 0; y--) {
+                int id = grid[idx(x, y, z)];
+                if (id == 0) continue;
+                if (id >= 0 && id < registry.count()) {
+                    if (registry.get(id).transparency == 0.0f) { highest = y; break; }
+                } else {
+                    highest = y;
+                    break;
+                }
+            }
+            sum += static_cast<uint64_t>(highest + 1);
+
+            // Emissive scan
+            for (int y = 0; y < N; y++) {
+                int id = grid[idx(x, y, z)];
+                if (id == 0) continue;
+                try {
+                    const BlockDefinition& def = registry.get(id);
+                    if (def.isEmissive && def.lightLevel > 0) sum += def.lightLevel;
+                } catch (...) {
+                }
+            }
+        }
+    }
+    return sum;
+}
+
+uint64_t lightTable(const BlockGrid& grid, const BlockPropertyTable& props) {
+    uint64_t sum = 0;
+    for (int x = 0; x < N; x++) {
+        for (int z = 0; z < N; z++) {
+            int highest = -1;
+            for (int y = N - 1; y >= 0; y--) {
+                int id = grid[idx(x, y, z)];
+                if (id == 0) continue;
+                const uint8_t flags = props.flags(id);
+                if (!(flags & BlockFlags::VALID) || (flags & BlockFlags::OPAQUE)) { highest = y; break; }
+            }
+            sum += static_cast<uint64_t>(highest + 1);
+
+            for (int y = 0; y < N; y++) {
+                int id = grid[idx(x, y, z)];
+                if (props.isEmissive(id)) sum += props.lightLevel(id);
+            }
+        }
+    }
+    return sum;
+}
+
+/**
+ * @brief Times fn(grid) over a rotation of chunks (distinct inputs keep the optimizer honest)
+ */
+template <typename Fn>
+double timeMs(int iterations, const std::vector<BlockGrid>& grids, uint64_t& checksum, Fn&& fn) {
+    auto start = std::chrono::high_resolution_clock::now();
+    uint64_t result = 0;
+    for (int i = 0; i < iterations; ++i) {
+        result += fn(grids[i % grids.size()]);
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    checksum = result;
+    return std::chrono::duration_cast<std::chrono::microseconds>(end - start).count() / 1000.0;
+}
+
+/**
+ * @brief Checks every table entry against its BlockDefinition
+ */
+bool verifyTable(const BlockRegistry& registry) {
+    const BlockPropertyTable& props = registry.properties();
+    if (props.size() != registry.count()) return false;
+
+    for (int id = 1; id < registry.count(); id++) {
+        const BlockDefinition* def = nullptr;
+        try {
+            def = &registry.get(id);
+        } catch (...) {
+            if (props.flags(id) != 0) return false;  // Gaps must read as air
+            continue;
+        }
+        if (props.isLiquid(id) != def->isLiquid) return false;
+        if (props.isSolid(id) != !def->isLiquid) return false;
+        if (props.isOpaque(id) != (def->transparency == 0.0f)) return false;
+        if (props.isTransparent(id) != (def->transparency > 0.0f)) return false;
+        if (props.isEmissive(id) != (def->isEmissive && def->lightLevel > 0)) return false;
+        if (props.lightLevel(id) != def->lightLevel) return false;
+    }
+    // Air and out-of-range IDs never throw and carry no flags
+    return props.flags(0) == 0 && props.flags(-1) == 0 && props.flags(registry.count()) == 0;
+}
+
+}  // namespace
+
+int main() {
+    const int ITERATIONS = 200;
+    const int WARMUP_ITERATIONS = 20;
+
+    std::cout << "=== Block Property Table Microbenchmark ===" << std::endl;
+
+    auto& registry = BlockRegistry::instance();
+    if (!registry.loadBlocks("assets/blocks", nullptr)) {
+        std::cout << "✗ FAILURE: Could not load assets/blocks" << std::endl;
+        return 1;
+    }
+    const BlockPropertyTable& props = registry.properties();
+
+    if (!verifyTable(registry)) {
+        std::cout << "✗ FAILURE: Property table does not match block definitions" << std::endl;
+        return 1;
+    }
+    std::cout << "Table matches " << registry.count() << " block definitions" << std::endl;
+
+    std::vector<BlockGrid> grids;
+    for (int variant = 0; variant < 8; variant++) {
+        grids.push_back(makeTerrain(registry, variant));
+    }
+    uint64_t checksum = 0;
+
+    std::cout << "Warming up..." << std::endl;
+    timeMs(WARMUP_ITERATIONS, grids, checksum, [&](const BlockGrid& g) { return meshLegacy(g, registry); });
+    timeMs(WARMUP_ITERATIONS, grids, checksum, [&](const BlockGrid& g) { return meshTable(g, props); });
+
+    uint64_t meshLegacySum = 0, meshTableSum = 0, lightLegacySum = 0, lightTableSum = 0;
+    double meshLegacyMs = timeMs(ITERATIONS, grids, meshLegacySum, [&](const BlockGrid& g) { return meshLegacy(g, registry); });
+    double meshTableMs = timeMs(ITERATIONS, grids, meshTableSum, [&](const BlockGrid& g) { return meshTable(g, props); });
+    double lightLegacyMs = timeMs(ITERATIONS, grids, lightLegacySum, [&](const BlockGrid& g) { return lightLegacy(g, registry); });
+    double lightTableMs = timeMs(ITERATIONS, grids, lightTableSum, [&](const BlockGrid& g) { return lightTable(g, props); });
+
+    std::cout << "\n=== Results (" << ITERATIONS << " chunks) ===" << std::endl;
+    std::cout << "Meshing  registry.get(): " << meshLegacyMs << " ms" << std::endl;
+    std::cout << "Meshing  property table: " << meshTableMs << " ms ("
+              << (meshTableMs > 0.0 ? meshLegacyMs / meshTableMs : 0.0) << "x)" << std::endl;
+    std::cout << "Lighting registry.get(): " << lightLegacyMs << " ms" << std::endl;
+    std::cout << "Lighting property table: " << lightTableMs << " ms ("
+              << (lightTableMs > 0.0 ? lightLegacyMs / lightTableMs : 0.0) << "x)" << std::endl;
+
+    if (meshLegacySum != meshTableSum || lightLegacySum != lightTableSum) {
+        std::cout << "\n✗ FAILURE: Checksums differ (mesh " << meshLegacySum << " vs " << meshTableSum
+                  << ", light " << lightLegacySum << " vs " << lightTableSum << ")" << std::endl;
+        return 1;
+    }
+
+    // Reported only: a loaded machine can stall either pass
+    const bool tableFaster = meshTableMs <= meshLegacyMs && lightTableMs <= lightLegacyMs;
+    std::cout << "Target (table not slower): " << (tableFaster ? "met" : "missed on this machine") << std::endl;
+
+    std::cout << "\n✓ SUCCESS: Identical results" << std::endl;
+    return 0;
+}
@@ -0,0 +1,310 @@
+/**
+ * @file test_block_tick.cpp
+ * @brief Correctness and throughput test for the per-chunk block tick wheel
+ *
+ * Tests:
+ * 1. Random schedules (short delays up to past the overflow horizon) against a
+ *    brute-force reference: every tick fires exactly on its due tick
+ * 2. Duplicate (index, block) schedules are merged, serialize()/deserialize()
+ *    round-trip preserves remaining delays
+ * 3. Throughput: schedule + advance cost per tick at chunk-save scale
+ * 4. ChunkBricks random-tick mask follows block writes and rebuilds
+ * 5. BlockTickSystem on a World: sand falls to the floor, a tick in every chunk
+ *    runs on the collect workers, idle chunks are skipped afterwards
+ *
+ * Created: 2025-11-28
+ */
+
+#include "test_utils.h"
+#include "block_tick.h"
+#include "block_tick_system.h"
+#include "block_properties.h"
+#include "block_system.h"
+#include "chunk.h"
+#include "chunk_bricks.h"
+#include "world.h"
+#include <algorithm>
+#include <chrono>
+#include <map>
+#include <random>
+#include <set>
+#include <tuple>
+#include <vector>
+
+namespace {
+
+using Key = std::pair<uint16_t, uint16_t>;  // (localIndex, blockID)
+
+/// Brute-force reference: key -> due tick (delay 1 fires on the next advance)
+struct ReferenceWheel {
+    std::map<Key, uint32_t> pending;
+    uint32_t now = 0;
+
+    bool schedule(uint16_t index, uint16_t block, uint32_t delay) {
+        return pending.emplace(Key{index, block}, now + std::max(delay, 1u) - 1).second;
+    }
+
+    std::set<Key> advance() {
+        std::set<Key> fired;
+        for (auto it = pending.begin(); it != pending.end();) {
+            if (it->second == now) {
+                fired.insert(it->first);
+                it = pending.erase(it);
+            } else {
+                ++it;
+            }
+        }
+        now++;
+        return fired;
+    }
+};
+
+std::set<Key> toKeys(const std::vector<ScheduledTick>& ticks) {
+    std::set<Key> keys;
+    for (const ScheduledTick& tick : ticks) keys.insert({tick.localIndex, tick.blockID});
+    return keys;
+}
+
+}  // namespace
+
+// ============================================================
+// Test 1: Reference Comparison
+// ============================================================
+
+TEST(ReferenceComparison) {
+    std::mt19937 rng(4242);
+    std::uniform_int_distribution<int> indexDist(0, 255);
+    std::uniform_int_distribution<int> blockDist(1, 4);
+    std::uniform_int_distribution<int> kindDist(0, 99);
+
+    ChunkTickWheel wheel;
+    ReferenceWheel reference;
+    std::vector<ScheduledTick> due;
+
+    // Enough ticks to cascade level 2 and pull from overflow at least once
+    const uint32_t totalTicks = ChunkTickWheel::HORIZON + 5000;
+    for (uint32_t step = 0; step < totalTicks; step++) {
+        // Schedule mostly near-term ticks, some far ones, a few beyond the horizon
+        if (step < ChunkTickWheel::HORIZON / 2 || kindDist(rng) < 5) {
+            const int kind = kindDist(rng);
+            uint32_t delay;
+            if (kind < 70)      delay = static_cast<uint32_t>(kindDist(rng));          // 0-99 (0 -> 1)
+            else if (kind < 95) delay = static_cast<uint32_t>(rng() % 5000);           // level 1/2
+            else                delay = ChunkTickWheel::HORIZON + rng() % 1000;        // overflow
+            if (step % 97 == 0) {
+                const uint16_t index = static_cast<uint16_t>(indexDist(rng));
+                const uint16_t block = static_cast<uint16_t>(blockDist(rng));
+                ASSERT_EQ(wheel.schedule(index, block, delay), reference.schedule(index, block, delay));
+            }
+        }
+
+        due.clear();
+        wheel.advance(due);
+        const std::set<Key> fired = toKeys(due);
+        ASSERT_EQ(due.size(), fired.size());  // No duplicates
+        ASSERT_TRUE(fired == reference.advance());
+        ASSERT_EQ(wheel.size(), reference.pending.size());
+    }
+
+    std::cout << "✓ Reference comparison over " << totalTicks << " ticks\n";
+}
+
+// ============================================================
+// Test 2: Duplicates and Round Trip
+// ============================================================
+
+TEST(DuplicatesAndRoundTrip) {
+    std::vector<ScheduledTick> due;
+    ChunkTickWheel next;
+    ASSERT_TRUE(next.schedule(1, 1, 1));
+    next.advance(due);
+    ASSERT_EQ(due.size(), 1u);  // Delay 1 is the next tick
+    due.clear();
+
+    ChunkTickWheel wheel;
+    ASSERT_TRUE(wheel.schedule(10, 3, 5));
+    ASSERT_FALSE(wheel.schedule(10, 3, 50));  // Duplicate merged
+    ASSERT_TRUE(wheel.schedule(10, 4, 5));    // Different block at the same index
+    ASSERT_TRUE(wheel.schedule(11, 3, 70000));
+    ASSERT_TRUE(wheel.schedule(12, 3, ChunkTickWheel::HORIZON + 7));
+
+    // Advance part-way so the saved delays are remaining, not original
+    for (int i = 0; i < 3; i++) wheel.advance(due);
+    ASSERT_TRUE(due.empty());
+
+    std::vector<uint8_t> bytes;
+    wheel.serialize(bytes);
+    ASSERT_EQ(bytes.size(), 4 + 8 * wheel.size());
+
+    ChunkTickWheel loaded;
+    ASSERT_TRUE(loaded.deserialize(bytes.data(), bytes.size()));
+    ASSERT_EQ(loaded.size(), wheel.size());
+    ASSERT_FALSE(loaded.deserialize(bytes.data(), bytes.size() - 1));  // Truncated
+    ASSERT_TRUE(loaded.empty());                                       // Failed load leaves nothing
+    ASSERT_TRUE(loaded.deserialize(nullptr, 0));                       // Empty section
+    ASSERT_TRUE(loaded.empty());
+
+    loaded.deserialize(bytes.data(), bytes.size());
+    std::vector<ScheduledTick> original, restored;
+    for (uint32_t i = 0; i < ChunkTickWheel::HORIZON + 10; i++) {
+        wheel.advance(original);
+        loaded.advance(restored);
+        ASSERT_TRUE(toKeys(original) == toKeys(restored));
+        original.clear();
+        restored.clear();
+    }
+    ASSERT_TRUE(wheel.empty());
+    ASSERT_TRUE(loaded.empty());
+
+    std::cout << "✓ Duplicates merged, serialize round-trip keeps due ticks\n";
+}
+
+// ============================================================
+// Test 3: Throughput
+// ============================================================
+
+TEST(Throughput) {
+    const int ticksPerRound = 100000;
+    std::mt19937 rng(7);
+    ChunkTickWheel wheel;
+    std::vector<ScheduledTick> due;
+
+    auto start = std::chrono::steady_clock::now();
+    size_t fired = 0;
+    for (int i = 0; i < ticksPerRound; i++) {
+        // Steady state: ~8 new ticks per game tick, mostly short (falling blocks, redstone-like delays)
+        for (int j = 0; j < 8; j++) {
+            wheel.schedule(static_cast<uint16_t>(rng() & 0x7FFF), static_cast<uint16_t>(1 + (rng() & 7)),
+                           static_cast<uint32_t>(1 + rng() % 200));
+        }
+        due.clear();
+        wheel.advance(due);
+        fired += due.size();
+    }
+    const double us = std::chrono::duration<double, std::micro>(
+        std::chrono::steady_clock::now() - start).count() / ticksPerRound;
+
+    ASSERT_GT(fired, 0u);
+
+    std::cout << "✓ Throughput: " << us << " us per tick (8 schedules + advance, "
+              << wheel.size() << " pending, " << fired << " fired)\n";
+}
+
+// ============================================================
+// Test 4: Random-Tick Brick Mask
+// ============================================================
+
+TEST(RandomTickBrickMask) {
+    // 1 = stone-like, 2 = crop-like (random_tick)
+    std::vector<BlockDefinition> defs(3);
+    for (int i = 0; i < 3; i++) defs[i].id = i;
+    defs[1].name = "stone";
+    defs[2].name = "crop";
+    defs[2].randomTick = true;
+    BlockPropertyTable props;
+    props.build(defs, 1);
+
+    ChunkBricks bricks;
+    ASSERT_EQ(bricks.randomTick(), 0u);
+
+    const uint64_t cropBrick = ChunkBricks::bit(ChunkBricks::indexOf(9, 17, 30));
+    bricks.update(props, 9, 17, 30, 0, 1);
+    ASSERT_EQ(bricks.randomTick(), 0u);  // Ordinary blocks don't set it
+    bricks.update(props, 9, 17, 30, 1, 2);
+    ASSERT_EQ(bricks.randomTick(), cropBrick);
+    bricks.update(props, 10, 17, 30, 0, 2);
+    bricks.update(props, 9, 17, 30, 2, 0);
+    ASSERT_EQ(bricks.randomTick(), cropBrick);  // Second crop keeps the brick flagged
+    bricks.update(props, 10, 17, 30, 2, 1);
+    ASSERT_EQ(bricks.randomTick(), 0u);
+    ASSERT_EQ(bricks.occupied(), cropBrick);  // Stone still there
+
+    // Bulk rebuild: one crop in two far-apart bricks
+    std::vector<int> blocks(ChunkBricks::CHUNK_SIZE * ChunkBricks::CHUNK_SIZE * ChunkBricks::CHUNK_SIZE, 1);
+    auto at = [&](int x, int y, int z) -> int& {
+        return blocks[(x * ChunkBricks::CHUNK_SIZE + y) * ChunkBricks::CHUNK_SIZE + z];
+    };
+    at(0, 0, 0) = 2;
+    at(31, 31, 31) = 2;
+    bricks.rebuild(props, blocks.data());
+    ASSERT_EQ(bricks.randomTick(), ChunkBricks::bit(0) | ChunkBricks::bit(ChunkBricks::COUNT - 1));
+    ASSERT_EQ(bricks.opaque(), ~uint64_t{0});
+
+    std::cout << "✓ Random-tick brick mask follows updates and rebuilds\n";
+}
+
+// ============================================================
+// Test 5: Tick System on a World
+// ============================================================
+
+TEST(TickSystemOnWorld) {
+    const int sandID = BlockRegistry::instance().getID("Sand");
+    const int stoneID = BlockRegistry::instance().getID("Stone");
+    ASSERT_GT(sandID, 0);
+    ASSERT_GT(stoneID, 0);
+
+    // 4x2x4 chunks: blocks x/z in [-64, 64), y in [-32, 32)
+    World world(4, 2, 4);
+    world.generateWorld();
+    BlockTickSystem* ticks = world.getBlockTickSystem();
+    ASSERT_TRUE(ticks != nullptr);
+    const float tickInterval = 1.0f / BlockTickSystem::TICKS_PER_SECOND;
+
+    // Sand dropped down a shaft crossing the chunk boundary at y = 0
+    const int x = 5, z = 5, top = 20, floor = -20;
+    for (int y = top; y > floor; y--) world.setBlockAt(x, y, z, 0, false);
+    world.setBlockAt(x, floor, z, stoneID, false);
+    world.setBlockAt(x, top, z, sandID, false);
+    ticks->onBlockChanged(glm::ivec3(x, top, z));
+
+    // One step every FALL_DELAY ticks: one tick short it is still a block above the floor
+    const int steps = top - (floor + 1);
+    const uint64_t landingTick = ticks->getTickCount() + steps * BlockTickSystem::FALL_DELAY;
+    while (ticks->getTickCount() + 1 < landingTick) {
+        ticks->update(tickInterval, nullptr, nullptr);  // No streaming: sync re-mesh
+    }
+    ASSERT_EQ(world.getBlockAt(x, floor + 2, z), sandID);
+    ticks->update(tickInterval, nullptr, nullptr);
+    ASSERT_EQ(world.getBlockAt(x, floor + 1, z), sandID);
+    for (uint32_t i = 0; i < BlockTickSystem::FALL_DELAY; i++) {
+        ticks->update(tickInterval, nullptr, nullptr);  // Its last tick finds the floor and stops
+    }
+    ASSERT_EQ(world.getBlockAt(x, floor + 1, z), sandID);
+    for (int y = floor + 2; y <= top; y++) ASSERT_EQ(world.getBlockAt(x, y, z), 0);
+
+    // One due tick in each of the 32 chunks: above the parallel threshold, so the workers collect
+    int scheduled = 0;
+    for (int cx = -2; cx < 2; cx++) {
+        for (int cy = -1; cy < 1; cy++) {
+            for (int cz = -2; cz < 2; cz++) {
+                const glm::ivec3 pos(cx * Chunk::WIDTH + 3, cy * Chunk::HEIGHT + 3, cz * Chunk::DEPTH + 3);
+                world.setBlockAt(pos.x, pos.y, pos.z, stoneID, false);
+                scheduled += ticks->scheduleTick(pos, stoneID, 1);
+            }
+        }
+    }
+    ASSERT_EQ(scheduled, 32);
+    ticks->update(tickInterval, nullptr, nullptr);
+    ASSERT_EQ(ticks->getLastActiveChunks(), 32u);
+    ASSERT_EQ(ticks->getLastUpdateCount(), 32u);  // One BlockUpdateEvent per chunk
+
+    // Nothing pending and no random-tick blocks: no chunk is visited
+    ticks->update(tickInterval, nullptr, nullptr);
+    ASSERT_EQ(ticks->getLastActiveChunks(), 0u);
+
+    std::cout << "✓ Sand fell " << steps << " blocks, 32 chunks collected in parallel, idle chunks skipped\n";
+}
+
+// ============================================================
+// Main Entry Point
+// ============================================================
+
+int main() {
+    try {
+        run_all_tests();
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "TEST FAILURE: " << e.what() << std::endl;
+        return 1;
+    }
+}
@@ -0,0 +1,285 @@
+/**
+ * @file test_brick_occupancy.cpp
+ * @brief Correctness and throughput test for 8³ brick occupancy (chunk_bricks.h)
+ *
+ * Chunks keep per-brick non-air / opaque counts that every block write updates.
+ *
+ * Tests:
+ * 1. Brick opacity of assets/blocks (stone and leaves opaque, water not)
+ * 2. Incremental updates (setBlock, blitTemplate, decode) match a full recount;
+ *    isEmpty() and the brick-accelerated heightmap match brute-force scans
+ * 3. buried() marks exactly the OPAQUE bricks enclosed by OPAQUE bricks
+ * 4. Skipping bricks never drops a face: a 1-block hole anywhere inside a stone
+ *    chunk adds exactly its 6 faces to the mesh
+ * 5. generateMesh() throughput for a sky chunk with one tree and a stone chunk with one cave
+ *
+ * Created: 2025-11-28
+ */
+
+#include "test_utils.h"
+#include "chunk_bricks.h"
+#include "chunk.h"
+#include "block_system.h"
+#include "structure_template.h"
+#include <chrono>
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace {
+
+// Block IDs from assets/blocks (Block_ID_Index.md)
+const int STONE = 1;
+const int DIRT = 2;
+const int WATER = 5;
+const int OAK_LOG = 6;
+const int LEAVES = 7;
+
+/// Recounts a chunk's bricks from getBlock()
+ChunkBricks recount(const Chunk& chunk) {
+    std::vector<int> blocks(Chunk::WIDTH * Chunk::HEIGHT * Chunk::DEPTH);
+    for (int x = 0; x < Chunk::WIDTH; x++)
+        for (int y = 0; y < Chunk::HEIGHT; y++)
+            for (int z = 0; z < Chunk::DEPTH; z++)
+                blocks[(x * Chunk::HEIGHT + y) * Chunk::DEPTH + z] = chunk.getBlock(x, y, z);
+    ChunkBricks bricks;
+    bricks.rebuild(BlockRegistry::instance().properties(), blocks.data());
+    return bricks;
+}
+
+bool matchesRecount(const Chunk& chunk) {
+    const ChunkBricks expected = recount(chunk);
+    return chunk.getBricks().occupied() == expected.occupied() && chunk.getBricks().opaque() == expected.opaque();
+}
+
+/// Highest opaque (or unknown) block per column, without bricks
+bool heightmapMatches(const Chunk& chunk) {
+    const BlockPropertyTable& props = BlockRegistry::instance().properties();
+    for (int x = 0; x < Chunk::WIDTH; x++) {
+        for (int z = 0; z < Chunk::DEPTH; z++) {
+            int expected = -1;
+            for (int y = Chunk::HEIGHT - 1; y >= 0 && expected < 0; y--) {
+                const int id = chunk.getBlock(x, y, z);
+                if (id != 0 && (props.isOpaque(id) || !(props.flags(id) & BlockFlags::VALID))) expected = y;
+            }
+            if (chunk.getHeightAt(x, z) != expected) return false;
+        }
+    }
+    return true;
+}
+
+void fillStone(Chunk& chunk) {
+    for (int x = 0; x < Chunk::WIDTH; x++)
+        for (int y = 0; y < Chunk::HEIGHT; y++)
+            for (int z = 0; z < Chunk::DEPTH; z++)
+                chunk.setBlock(x, y, z, STONE);
+}
+
+}  // namespace
+
+// ============================================================
+// Test 1: Opacity Flags
+// ============================================================
+
+TEST(OpacityFlags) {
+    const BlockPropertyTable& props = BlockRegistry::instance().properties();
+    ASSERT_TRUE(ChunkBricks::isOpaque(props, STONE));
+    ASSERT_TRUE(ChunkBricks::isOpaque(props, LEAVES));  // leaves.yaml: transparency 0.0
+    ASSERT_FALSE(ChunkBricks::isOpaque(props, WATER));
+
+    std::cout << "✓ Brick opacity matches assets/blocks\n";
+}
+
+// ============================================================
+// Test 2: Incremental Updates
+// ============================================================
+
+TEST(IncrementalUpdates) {
+    auto chunk = std::make_unique<Chunk>(0, 0, 0);
+    ASSERT_TRUE(chunk->isEmpty());
+    ASSERT_EQ(chunk->getBricks().occupied(), 0u);
+
+    chunk->setBlock(9, 17, 30, LEAVES);
+    ASSERT_FALSE(chunk->isEmpty());
+    ASSERT_EQ(chunk->getBricks().state(ChunkBricks::indexOf(9, 17, 30)), BrickState::MIXED);
+    chunk->setBlock(9, 17, 30, 0);
+    ASSERT_TRUE(chunk->isEmpty());
+
+    // A 16³ stone corner, then random edits that leave brick (0, 0, 0) OPAQUE and
+    // bricks with x < 8 above the corner EMPTY
+    for (int x = 0; x < 16; x++)
+        for (int y = 0; y < 16; y++)
+            for (int z = 0; z < 16; z++)
+                chunk->setBlock(x, y, z, STONE);
+    std::mt19937 rng(47);
+    const int palette[] = {0, STONE, STONE, DIRT, WATER, LEAVES, OAK_LOG};
+    for (int i = 0; i < 20000; i++) {
+        const int x = 8 + static_cast<int>(rng() % 24);
+        const int y = static_cast<int>(rng() % 32);
+        const int z = static_cast<int>(rng() % 32);
+        chunk->setBlock(x, y, z, palette[rng() % 7]);
+    }
+    ASSERT_TRUE(matchesRecount(*chunk));
+    ASSERT_TRUE(heightmapMatches(*chunk));
+
+    // Template blits update bricks span by span
+    std::vector<std::vector<std::vector<int>>> layers(12, std::vector<std::vector<int>>(20, std::vector<int>(20, 0)));
+    for (int y = 0; y < 12; y++)
+        for (int z = 0; z < 20; z++)
+            for (int x = 0; x < 20; x++)
+                if (y < 2 || x == 0 || z == 19 || (x + z) % 5 == 0) layers[y][z][x] = (y % 3 == 0) ? LEAVES : STONE;
+    const StructureTemplate tmpl = StructureTemplate::fromLayers(layers);
+    chunk->blitTemplate(tmpl, glm::ivec3(14, 10, 20));
+    chunk->blitTemplate(tmpl, glm::ivec3(-6, 25, -3));
+    ASSERT_TRUE(matchesRecount(*chunk));
+    ASSERT_TRUE(heightmapMatches(*chunk));
+
+    // Encode/decode rebuilds bricks from the decoded blocks
+    std::vector<uint8_t> encoded;
+    chunk->encode(encoded);
+    auto loaded = std::make_unique<Chunk>(0, 0, 0);
+    ASSERT_TRUE(loaded->decode(encoded));
+    ASSERT_EQ(loaded->getBricks().occupied(), chunk->getBricks().occupied());
+    ASSERT_EQ(loaded->getBricks().opaque(), chunk->getBricks().opaque());
+
+    int states[3] = {0, 0, 0};
+    for (int brick = 0; brick < ChunkBricks::COUNT; brick++) states[static_cast<int>(chunk->getBricks().state(brick))]++;
+    ASSERT_GT(states[0], 0);  // Edits produce all three brick states
+    ASSERT_GT(states[1], 0);
+    ASSERT_GT(states[2], 0);
+    std::cout << "✓ Incremental updates match a recount (" << states[0] << " empty, " << states[1] << " opaque, "
+              << states[2] << " mixed bricks)\n";
+}
+
+// ============================================================
+// Test 3: Buried
+// ============================================================
+
+TEST(Buried) {
+    auto chunk = std::make_unique<Chunk>(0, 0, 0);
+    fillStone(*chunk);
+    ASSERT_EQ(chunk->getBricks().opaque(), ~uint64_t{0});
+
+    const uint64_t allOpaque[6] = {~0ull, ~0ull, ~0ull, ~0ull, ~0ull, ~0ull};
+    ASSERT_EQ(chunk->getBricks().buried(allOpaque), ~uint64_t{0});
+
+    // Missing neighbor on each side exposes exactly that face layer
+    const uint64_t layers[6] = {ChunkBricks::LAYER_X3, ChunkBricks::LAYER_X0, ChunkBricks::LAYER_Y3,
+                                ChunkBricks::LAYER_Y0, ChunkBricks::LAYER_Z3, ChunkBricks::LAYER_Z0};
+    for (int side = 0; side < 6; side++) {
+        uint64_t neighbors[6] = {~0ull, ~0ull, ~0ull, ~0ull, ~0ull, ~0ull};
+        neighbors[side] = 0;
+        ASSERT_EQ(chunk->getBricks().buried(neighbors), ~layers[side]);
+    }
+
+    // A cave block un-buries its brick and the 6 face neighbors, nothing else
+    chunk->setBlock(12, 20, 3, 0);
+    const uint64_t buried = chunk->getBricks().buried(allOpaque);
+    uint64_t expected = ~uint64_t{0};
+    const int bx = 1, by = 2, bz = 0;
+    const int offsets[7][3] = {{0, 0, 0}, {1, 0, 0}, {-1, 0, 0}, {0, 1, 0}, {0, -1, 0}, {0, 0, 1}, {0, 0, -1}};
+    for (const auto& o : offsets) {
+        if (bz + o[2] < 0) continue;  // Neighbor chunk brick: not part of this mask
+        expected &= ~ChunkBricks::bit(ChunkBricks::brickIndex(bx + o[0], by + o[1], bz + o[2]));
+    }
+    ASSERT_EQ(buried, expected);
+    std::cout << "✓ Buried bricks exclude exposed layers and the cave neighborhood\n";
+}
+
+// ============================================================
+// Test 4: No Lost Faces
+// ============================================================
+
+TEST(NoLostFaces) {
+    // The stone chunk meshes its 6 outer sides (no neighbors); every 1-block hole must
+    // add exactly its 6 inner faces, wherever it sits relative to brick borders
+    auto solid = std::make_unique<Chunk>(0, 0, 0);
+    fillStone(*solid);
+    solid->generateMesh(nullptr, 0);
+    const uint32_t baseVertices = solid->getVertexCount();
+
+    ASSERT_GT(baseVertices, 0u);
+
+    int holes = 0;
+    for (int x : {1, 7, 8, 15, 16, 24, 30}) {
+        for (int y : {1, 8, 23}) {
+            for (int z : {7, 16, 30}) {
+                auto chunk = std::make_unique<Chunk>(0, 0, 0);
+                fillStone(*chunk);
+                chunk->setBlock(x, y, z, 0);
+                chunk->generateMesh(nullptr, 0);
+                ASSERT_EQ(chunk->getVertexCount(), baseVertices + 6 * 4);
+                holes++;
+            }
+        }
+    }
+    std::cout << "✓ " << holes << " holes each add exactly 6 faces\n";
+}
+
+// ============================================================
+// Test 5: Meshing Throughput
+// ============================================================
+
+TEST(MeshingThroughput) {
+    // Sky chunk with one tree
+    auto sky = std::make_unique<Chunk>(0, 3, 0);
+    for (int y = 0; y < 9; y++) sky->setBlock(16, y, 16, OAK_LOG);
+    for (int x = 13; x <= 19; x++)
+        for (int y = 6; y <= 11; y++)
+            for (int z = 13; z <= 19; z++)
+                if (sky->getBlock(x, y, z) == 0 && (x - 16) * (x - 16) + (y - 9) * (y - 9) + (z - 16) * (z - 16) <= 10)
+                    sky->setBlock(x, y, z, LEAVES);
+
+    // Stone chunk with one winding cave
+    auto cave = std::make_unique<Chunk>(0, -2, 0);
+    fillStone(*cave);
+    for (int t = 0; t < 40; t++) {
+        const int cx = 4 + t * 6 / 10, cy = 12 + (t % 7), cz = 6 + (t * t) % 20;
+        for (int x = cx - 1; x <= cx + 1; x++)
+            for (int y = cy - 1; y <= cy + 1; y++)
+                for (int z = cz - 1; z <= cz + 1; z++)
+                    cave->setBlock(x, y, z, 0);
+    }
+
+    auto time = [](Chunk& chunk) {
+        chunk.generateMesh(nullptr, 0);  // Warm the mesh buffer pool
+        const int rounds = 50;
+        auto start = std::chrono::steady_clock::now();
+        for (int round = 0; round < rounds; round++) chunk.generateMesh(nullptr, 0);
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / rounds;
+    };
+    auto skipped = [](const Chunk& chunk) {
+        int count = 0;
+        for (int brick = 0; brick < ChunkBricks::COUNT; brick++)
+            count += chunk.getBricks().state(brick) == BrickState::EMPTY;
+        return count;
+    };
+
+    const double skyMs = time(*sky);
+    const double caveMs = time(*cave);
+    const uint64_t noNeighbors[6] = {0, 0, 0, 0, 0, 0};
+    int buried = 0;
+    for (int brick = 0; brick < ChunkBricks::COUNT; brick++)
+        buried += (cave->getBricks().buried(noNeighbors) & ChunkBricks::bit(brick)) != 0;
+
+    ASSERT_GT(sky->getVertexCount(), 0u);
+    ASSERT_GT(cave->getVertexCount(), 0u);
+
+    std::cout << "✓ generateMesh: sky + tree " << skyMs << " ms (" << skipped(*sky) << "/64 bricks empty, "
+              << sky->getVertexCount() << " verts), stone + cave " << caveMs << " ms (" << buried
+              << "/64 bricks buried without neighbors, " << cave->getVertexCount() << " verts)\n";
+}
+
+// ============================================================
+// Main Entry Point
+// ============================================================
+
+int main() {
+    try {
+        run_all_tests();
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "TEST FAILURE: " << e.what() << std::endl;
+        return 1;
+    }
+}
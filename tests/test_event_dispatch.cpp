@@ -0,0 +1,294 @@
+/**
+ * @file test_event_dispatch.cpp
+ * @brief Correctness and throughput test for block event dispatch
+ *
+ * Block scripts used to be type-wide listeners that compared the event's block
+ * ID inside the callback, and every dispatch copied the listener vector under a
+ * mutex. EventDispatcher now reads an RCU listener snapshot and looks block
+ * handlers up by ID.
+ *
+ * Tests:
+ * 1. Per-block delivery, unknown-block broadcast, unsubscribeAll(owner)
+ * 2. Priority merge of type-wide and per-block listeners, cancellation
+ * 3. Unknown-block broadcast: same priority merge, cancel stops every block's listeners
+ * 4. A throwing listener doesn't stop the dispatch
+ * 5. Subscribing from inside a callback (no self-deadlock on the listener lock)
+ * 6. EventPool slot reuse
+ * 7. Events/sec with 100 scripted block types: legacy copy + broadcast vs table lookup
+ *
+ * Created: 2025-11-28
+ */
+
+#include "test_utils.h"
+#include "event_dispatcher.h"
+#include "event_pool.h"
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+
+constexpr int BLOCK_TYPES = 100;
+
+/// Previous dispatch path: copy the type's listener vector under a mutex, run every block's callback
+struct LegacyDispatcher {
+    std::mutex mutex;
+    std::vector<EventListener> listeners;
+
+    void process(Event& event) {
+        std::vector<EventListener> copy;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            copy = listeners;
+        }
+        for (const auto& listener : copy) {
+            listener.callback(event);
+        }
+    }
+};
+
+}  // namespace
+
+// ============================================================
+// Test 1: Per-Block Delivery
+// ============================================================
+
+TEST(BlockDelivery) {
+    auto& dispatcher = EventDispatcher::instance();
+    std::vector<int> calls(BLOCK_TYPES, 0);
+    for (int id = 0; id < BLOCK_TYPES; id++) {
+        dispatcher.subscribeBlock(EventType::BLOCK_UPDATE, id, [&calls, id](Event&) { calls[id]++; },
+                                  EventPriority::NORMAL, "test:block");
+    }
+
+    for (int id = 0; id < BLOCK_TYPES; id++) {
+        BlockUpdateEvent event(glm::ivec3(id, 0, 0), id);
+        dispatcher.dispatchImmediate(event);
+    }
+    for (int id = 0; id < BLOCK_TYPES; id++) {
+        ASSERT_EQ(calls[id], 1);  // Never another block's event
+    }
+
+    // Unknown target block reaches every block's handlers
+    NeighborChangedEvent unknown(glm::ivec3(0), glm::ivec3(1, 0, 0), 0, 1);
+    dispatcher.subscribeBlock(EventType::NEIGHBOR_CHANGED, 3, [&calls](Event&) { calls[3] += 10; },
+                              EventPriority::NORMAL, "test:block");
+    dispatcher.dispatchImmediate(unknown);
+    ASSERT_EQ(calls[3], 11);
+
+    NeighborChangedEvent known(glm::ivec3(0), glm::ivec3(1, 0, 0), 0, 1, 4);
+    dispatcher.dispatchImmediate(known);
+    ASSERT_EQ(calls[3], 11);  // Block 4's neighbor event skips block 3
+
+    dispatcher.unsubscribeAll(std::string("test:block"));
+    BlockUpdateEvent after(glm::ivec3(0), 5);
+    dispatcher.dispatchImmediate(after);
+    ASSERT_EQ(calls[5], 1);
+    ASSERT_EQ(dispatcher.getTotalListenerCount(), 0u);
+
+    std::cout << "✓ Block handlers receive only their block's events\n";
+}
+
+// ============================================================
+// Test 2: Priority and Cancellation
+// ============================================================
+
+TEST(PriorityAndCancel) {
+    auto& dispatcher = EventDispatcher::instance();
+    std::string order;
+    dispatcher.subscribe(EventType::BLOCK_BREAK, [&order](Event&) { order += 'H'; }, EventPriority::HIGH, "test:prio");
+    dispatcher.subscribe(EventType::BLOCK_BREAK, [&order](Event&) { order += 'L'; }, EventPriority::LOW, "test:prio");
+    dispatcher.subscribeBlock(EventType::BLOCK_BREAK, 7, [&order](Event&) { order += 'N'; },
+                              EventPriority::NORMAL, "test:prio");
+    dispatcher.subscribeBlock(EventType::BLOCK_BREAK, 7, [&order](Event&) { order += 'X'; },
+                              EventPriority::HIGHEST, "test:prio");
+
+    BlockBreakEvent event(glm::ivec3(0), 7, BreakCause::PLAYER);
+    dispatcher.dispatchImmediate(event);
+    ASSERT_EQ(order, std::string("XHNL"));
+
+    // Cancel from a HIGH listener: NORMAL and LOW must not run
+    order.clear();
+    dispatcher.subscribe(EventType::BLOCK_BREAK, [](Event& e) { e.cancel(); }, EventPriority::HIGH, "test:prio");
+    BlockBreakEvent cancelled(glm::ivec3(0), 7, BreakCause::PLAYER);
+    dispatcher.dispatchImmediate(cancelled);
+    ASSERT_TRUE(cancelled.isCancelled());
+    ASSERT_EQ(order.find('N'), std::string::npos);
+    ASSERT_EQ(order.find('L'), std::string::npos);
+
+    dispatcher.unsubscribeAll(std::string("test:prio"));
+    std::cout << "✓ Type-wide and per-block listeners merged by priority, cancel stops lower ones\n";
+}
+
+// ============================================================
+// Test 3: Unknown-Block Broadcast
+// ============================================================
+
+TEST(BroadcastPriorityAndCancel) {
+    auto& dispatcher = EventDispatcher::instance();
+    std::string order;
+    dispatcher.subscribe(EventType::NEIGHBOR_CHANGED, [&order](Event&) { order += 'h'; },
+                         EventPriority::HIGH, "test:broadcast");
+    dispatcher.subscribe(EventType::NEIGHBOR_CHANGED, [&order](Event&) { order += 'l'; },
+                         EventPriority::LOW, "test:broadcast");
+    dispatcher.subscribeBlock(EventType::NEIGHBOR_CHANGED, 2, [&order](Event&) { order += 'n'; },
+                              EventPriority::NORMAL, "test:broadcast");
+    dispatcher.subscribeBlock(EventType::NEIGHBOR_CHANGED, 9, [&order](Event&) { order += 'x'; },
+                              EventPriority::HIGHEST, "test:broadcast");
+    dispatcher.subscribeBlock(EventType::NEIGHBOR_CHANGED, 9, [&order](Event&) { order += 'w'; },
+                              EventPriority::LOWEST, "test:broadcast");
+
+    NeighborChangedEvent unknown(glm::ivec3(0), glm::ivec3(1, 0, 0), 0, 1);
+    dispatcher.dispatchImmediate(unknown);
+    ASSERT_EQ(order, std::string("xhnlw"));  // Not type-wide first, then block by block
+
+    // Block 2 cancels: no lower listener runs, including block 9's
+    order.clear();
+    dispatcher.subscribeBlock(EventType::NEIGHBOR_CHANGED, 2, [](Event& e) { e.cancel(); },
+                              EventPriority::NORMAL, "test:broadcast");
+    NeighborChangedEvent cancelled(glm::ivec3(0), glm::ivec3(1, 0, 0), 0, 1);
+    dispatcher.dispatchImmediate(cancelled);
+    ASSERT_TRUE(cancelled.isCancelled());
+    ASSERT_EQ(order.find('l'), std::string::npos);
+    ASSERT_EQ(order.find('w'), std::string::npos);
+    ASSERT_EQ(order.substr(0, 2), std::string("xh"));
+
+    dispatcher.unsubscribeAll(std::string("test:broadcast"));
+    std::cout << "✓ Unknown-block broadcast merged by priority, cancel stops every block's listeners\n";
+}
+
+// ============================================================
+// Test 4: Throwing Listener
+// ============================================================
+
+TEST(ThrowingListener) {
+    auto& dispatcher = EventDispatcher::instance();
+    int after = 0;
+    dispatcher.subscribe(EventType::BLOCK_UPDATE, [](Event&) { throw std::runtime_error("test listener failure"); },
+                         EventPriority::HIGH, "test:throw");
+    dispatcher.subscribe(EventType::BLOCK_UPDATE, [](Event&) { throw 42; }, EventPriority::HIGH, "test:throw");
+    dispatcher.subscribe(EventType::BLOCK_UPDATE, [&after](Event&) { after++; }, EventPriority::LOW, "test:throw");
+
+    BlockUpdateEvent event(glm::ivec3(0), 1);
+    dispatcher.dispatchImmediate(event);  // Logs two errors
+    ASSERT_EQ(after, 1);
+
+    dispatcher.unsubscribeAll(std::string("test:throw"));
+    std::cout << "✓ Throwing listeners are logged and skipped\n";
+}
+
+// ============================================================
+// Test 5: Subscribe During Dispatch
+// ============================================================
+
+TEST(SubscribeDuringDispatch) {
+    auto& dispatcher = EventDispatcher::instance();
+
+    // Must not deadlock and must not affect the running dispatch
+    int late = 0;
+    ListenerHandle nested = dispatcher.subscribe(EventType::BLOCK_STEP, [&dispatcher, &late](Event&) {
+        dispatcher.subscribe(EventType::BLOCK_STEP, [&late](Event&) { late++; }, EventPriority::NORMAL, "test:nested");
+    }, EventPriority::NORMAL, "test:nested");
+    BlockStepEvent step(glm::ivec3(0), 1, 0);
+    dispatcher.dispatchImmediate(step);
+    ASSERT_EQ(late, 0);
+    dispatcher.unsubscribe(nested);
+    dispatcher.dispatchImmediate(step);
+    ASSERT_EQ(late, 1);
+
+    dispatcher.unsubscribeAll(std::string("test:nested"));
+    std::cout << "✓ Listener added mid-dispatch runs from the next dispatch on\n";
+}
+
+// ============================================================
+// Test 6: Event Pool Reuse
+// ============================================================
+
+TEST(PoolReuse) {
+    auto& pool = EventPool::instance();
+    void* first = pool.allocate(sizeof(BlockUpdateEvent));
+    pool.deallocate(first, sizeof(BlockUpdateEvent));
+    void* second = pool.allocate(sizeof(BlockUpdateEvent));
+    ASSERT_TRUE(first == second);  // Freed slot reused
+    pool.deallocate(second, sizeof(BlockUpdateEvent));
+
+    const uint64_t refills = pool.getSlabRefills();
+    for (int i = 0; i < 1000; i++) {
+        auto event = std::make_unique<BlockUpdateEvent>(glm::ivec3(i, 0, 0), i % BLOCK_TYPES);
+        ASSERT_EQ(event->blockID, i % BLOCK_TYPES);
+    }
+    ASSERT_EQ(pool.getSlabRefills(), refills);  // Steady-state make_unique never hits the heap
+
+    std::cout << "✓ Event pool reuses freed slots\n";
+}
+
+// ============================================================
+// Test 7: Throughput
+// ============================================================
+
+TEST(Throughput) {
+    const int events = 200000;
+    volatile int sink = 0;
+
+    LegacyDispatcher legacy;
+    for (int id = 0; id < BLOCK_TYPES; id++) {
+        EventListener listener;
+        listener.handle = static_cast<ListenerHandle>(id + 1);
+        listener.type = EventType::BLOCK_UPDATE;
+        listener.priority = EventPriority::NORMAL;
+        listener.owner = "block:" + std::to_string(id);
+        listener.callback = [id, &sink](Event& event) {
+            if (static_cast<BlockUpdateEvent&>(event).blockID == id) sink = sink + 1;
+        };
+        legacy.listeners.push_back(std::move(listener));
+    }
+
+    auto& dispatcher = EventDispatcher::instance();
+    for (int id = 0; id < BLOCK_TYPES; id++) {
+        dispatcher.subscribeBlock(EventType::BLOCK_UPDATE, id, [&sink](Event&) { sink = sink + 1; },
+                                  EventPriority::NORMAL, "block:" + std::to_string(id));
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < events; i++) {
+        std::unique_ptr<Event> event = std::make_unique<BlockUpdateEvent>(glm::ivec3(i, 0, 0), i % BLOCK_TYPES);
+        legacy.process(*event);
+    }
+    const double legacySeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < events; i++) {
+        std::unique_ptr<Event> event = std::make_unique<BlockUpdateEvent>(glm::ivec3(i, 0, 0), i % BLOCK_TYPES);
+        dispatcher.dispatchImmediate(*event);
+    }
+    const double tableSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    ASSERT_EQ(static_cast<int>(sink), 2 * events);
+    for (int id = 0; id < BLOCK_TYPES; id++) {
+        dispatcher.unsubscribeAll("block:" + std::to_string(id));
+    }
+
+    const double legacyRate = events / legacySeconds;
+    const double tableRate = events / tableSeconds;
+    std::cout << "✓ " << BLOCK_TYPES << " scripted block types: legacy copy+broadcast "
+              << static_cast<long long>(legacyRate) << " events/s, per-block table "
+              << static_cast<long long>(tableRate) << " events/s ("
+              << (legacyRate > 0.0 ? tableRate / legacyRate : 0.0) << "x)\n";
+}
+
+// ============================================================
+// Main Entry Point
+// ============================================================
+
+int main() {
+    try {
+        run_all_tests();
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "TEST FAILURE: " << e.what() << std::endl;
+        return 1;
+    }
+}
@@ -0,0 +1,190 @@
+/**
+ * @file test_indexed_heap.cpp
+ * @brief Correctness and eviction-cost test for the streaming load queue heap
+ *
+ * WorldStreaming keys its load queue by ChunkCoord so requests can be re-keyed
+ * when the player turns and cancelled when left behind.
+ *
+ * Tests:
+ * 1. Random push / pop / update / erase / rebuild against a brute-force reference,
+ *    findWorst() must return the maximum, drain must come out sorted
+ * 2. Eviction cost at MAX_LOAD_QUEUE_SIZE: previous copy-and-drain scan of a
+ *    std::priority_queue vs findWorst() + erase()
+ *
+ * Created: 2025-11-28
+ */
+
+#include "test_utils.h"
+#include "indexed_heap.h"
+#include "chunk_coord.h"
+#include <chrono>
+#include <queue>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+
+using Heap = IndexedMinHeap<ChunkCoord, int>;
+
+float referenceMin(const std::unordered_map<ChunkCoord, float>& reference) {
+    float best = 1e30f;
+    for (const auto& [coord, priority] : reference) best = std::min(best, priority);
+    return best;
+}
+
+float referenceMax(const std::unordered_map<ChunkCoord, float>& reference) {
+    float worst = -1e30f;
+    for (const auto& [coord, priority] : reference) worst = std::max(worst, priority);
+    return worst;
+}
+
+struct LegacyRequest {
+    ChunkCoord coord;
+    float priority;
+    bool operator<(const LegacyRequest& other) const { return priority > other.priority; }
+};
+
+}  // namespace
+
+// ============================================================
+// Test 1: Random Operations
+// ============================================================
+
+TEST(RandomOperations) {
+    std::mt19937 rng(1234);
+    std::uniform_int_distribution<int> coordDist(-20, 20);
+    std::uniform_real_distribution<float> priorityDist(-5.0f, 30.0f);
+    std::uniform_int_distribution<int> opDist(0, 99);
+
+    Heap heap;
+    std::unordered_map<ChunkCoord, float> reference;
+
+    for (int step = 0; step < 200000; step++) {
+        const ChunkCoord coord{coordDist(rng), coordDist(rng) / 4, coordDist(rng)};
+        const int op = opDist(rng);
+
+        if (op < 45) {
+            const float priority = priorityDist(rng);
+            const bool pushed = heap.push(coord, priority, coord.x);
+            ASSERT_EQ(pushed, reference.find(coord) == reference.end());  // Duplicates rejected
+            if (pushed) reference[coord] = priority;
+        } else if (op < 65) {
+            const float priority = priorityDist(rng);
+            const bool updated = heap.update(coord, priority);
+            ASSERT_EQ(updated, reference.find(coord) != reference.end());  // Unknown keys rejected
+            if (updated) reference[coord] = priority;
+        } else if (op < 80) {
+            const bool erased = heap.erase(coord);
+            ASSERT_EQ(erased, reference.erase(coord) > 0);
+        } else if (op < 99) {
+            if (!heap.empty()) {
+                ASSERT_EQ(heap.top().priority, referenceMin(reference));
+                const Heap::Entry entry = heap.pop();
+                ASSERT_EQ(reference.erase(entry.key), 1u);
+            }
+        } else {
+            // Re-key everything, dropping one octant (a turn plus a boundary crossing)
+            heap.rebuild([&](const ChunkCoord& key, int&, float& priority) {
+                if (key.x > 10 && key.z > 10) {
+                    reference.erase(key);
+                    return false;
+                }
+                priority = static_cast<float>(key.x * key.x + key.z * key.z) * 0.01f;
+                reference[key] = priority;
+                return true;
+            });
+        }
+
+        ASSERT_EQ(heap.size(), reference.size());
+        if (!heap.empty() && step % 64 == 0) {
+            ASSERT_EQ(heap.findWorst()->priority, referenceMax(reference));
+        }
+    }
+
+    // Drain: must come out sorted
+    float previous = -1e30f;
+    while (!heap.empty()) {
+        const Heap::Entry entry = heap.pop();
+        ASSERT_GE(entry.priority, previous);
+        previous = entry.priority;
+    }
+
+    std::cout << "✓ 200000 random operations match the reference\n";
+}
+
+// ============================================================
+// Test 2: Eviction Cost
+// ============================================================
+
+TEST(EvictionCost) {
+    const size_t capacity = 2048;  // WorldStreaming::MAX_LOAD_QUEUE_SIZE
+    const int evictions = 2000;
+    std::mt19937 rng(99);
+    std::uniform_real_distribution<float> priorityDist(0.0f, 30.0f);
+
+    std::priority_queue<LegacyRequest> legacy;
+    Heap heap;
+    heap.reserve(capacity);
+    for (size_t i = 0; i < capacity; i++) {
+        const ChunkCoord coord{static_cast<int>(i % 64), static_cast<int>(i / 4096), static_cast<int>(i / 64)};
+        const float priority = priorityDist(rng);
+        legacy.push({coord, priority});
+        heap.push(coord, priority, 0);
+    }
+
+    // Previous: copy the queue to find the worst, then drain and rebuild to remove it
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < evictions; i++) {
+        auto scan = legacy;
+        LegacyRequest worst = scan.top();
+        while (!scan.empty()) {
+            if (scan.top().priority > worst.priority) worst = scan.top();
+            scan.pop();
+        }
+        std::priority_queue<LegacyRequest> rebuilt;
+        bool removed = false;
+        while (!legacy.empty()) {
+            LegacyRequest current = legacy.top();
+            legacy.pop();
+            if (!removed && current.coord == worst.coord) {
+                removed = true;
+                continue;
+            }
+            rebuilt.push(current);
+        }
+        legacy.swap(rebuilt);
+        legacy.push({ChunkCoord{1000 + i, 0, 0}, priorityDist(rng)});
+    }
+    const double legacyUs = std::chrono::duration<double, std::micro>(
+        std::chrono::steady_clock::now() - start).count() / evictions;
+
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < evictions; i++) {
+        const ChunkCoord worst = heap.findWorst()->key;
+        heap.erase(worst);
+        heap.push(ChunkCoord{1000 + i, 0, 0}, priorityDist(rng), 0);
+    }
+    const double heapUs = std::chrono::duration<double, std::micro>(
+        std::chrono::steady_clock::now() - start).count() / evictions;
+
+    ASSERT_EQ(heap.size(), capacity);  // Eviction must not change the queue size
+
+    std::cout << "✓ Eviction at " << capacity << " requests: priority_queue copy+rebuild "
+              << legacyUs << " us, indexed heap " << heapUs << " us ("
+              << (heapUs > 0.0 ? legacyUs / heapUs : 0.0) << "x)\n";
+}
+
+// ============================================================
+// Main Entry Point
+// ============================================================
+
+int main() {
+    try {
+        run_all_tests();
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "TEST FAILURE: " << e.what() << std::endl;
+        return 1;
+    }
+}
@@ -0,0 +1,296 @@
+/**
+ * @file test_mesh_batch.cpp
+ * @brief CPU tests for batched mesh rendering bookkeeping (mesh_batch.h)
+ *
+ * Tests:
+ * 1. RangeAllocator places first fit, coalesces freed neighbours and grows in place
+ * 2. Instance slots are reused, capped at the table size and freed with their mesh
+ * 3. takeUploads() returns only dirtied slots, coalesced, once per frame copy
+ * 4. buildDraws() culls per instance and emits one indirect command per mesh
+ *    whose firstInstance/instanceCount index the visible slot list
+ * 5. transformBounds() gives the exact AABB of a rotated, scaled, translated box
+ * 6. Per-frame cost for 16K instances with 1% of them moving
+ *
+ * Created: 2025-11-28
+ */
+
+#include "test_utils.h"
+#include "mesh/mesh_batch.h"
+#include <chrono>
+#include <cmath>
+#include <vector>
+
+namespace {
+
+bool near(float value, float expected) {
+    return std::fabs(value - expected) < 1e-4f;
+}
+
+bool sameRanges(const std::vector<MeshBatch::SlotRange>& ranges,
+                const std::vector<std::pair<uint32_t, uint32_t>>& expected) {
+    if (ranges.size() != expected.size()) return false;
+    for (size_t i = 0; i < ranges.size(); i++) {
+        if (ranges[i].first != expected[i].first || ranges[i].count != expected[i].second) return false;
+    }
+    return true;
+}
+
+/// Axis-aligned box as a frustum (planes face inward)
+Frustum boxFrustum(float halfSize) {
+    Frustum frustum;
+    const float normals[6][3] = {{1, 0, 0}, {-1, 0, 0}, {0, 1, 0}, {0, -1, 0}, {0, 0, 1}, {0, 0, -1}};
+    for (int i = 0; i < 6; i++) {
+        frustum.planes[i] = Plane{normals[i][0], normals[i][1], normals[i][2], halfSize};
+    }
+    return frustum;
+}
+
+InstanceData instanceAt(float x, float y, float z) {
+    InstanceData data;
+    data.transform = glm::mat4(1.0f);
+    data.transform[3] = glm::vec4(x, y, z, 1.0f);
+    return data;
+}
+
+}  // namespace
+
+// ============================================================
+// Test 1: Range Allocator
+// ============================================================
+
+TEST(RangeAllocator) {
+    RangeAllocator allocator(100);
+    const uint32_t a = allocator.allocate(30);
+    const uint32_t b = allocator.allocate(30);
+    const uint32_t c = allocator.allocate(40);
+    ASSERT_EQ(a, 0u);
+    ASSERT_EQ(b, 30u);
+    ASSERT_EQ(c, 60u);
+    ASSERT_EQ(allocator.allocate(1), RangeAllocator::INVALID_OFFSET);
+    ASSERT_EQ(allocator.allocate(0), RangeAllocator::INVALID_OFFSET);
+
+    allocator.free(b, 30);
+    ASSERT_EQ(allocator.allocate(20), 30);
+    allocator.free(a, 30);
+    allocator.free(30, 20);
+    ASSERT_EQ(allocator.freeRangeCount(), 1);
+    allocator.free(c, 40);
+    ASSERT_EQ(allocator.freeRangeCount(), 1);
+    ASSERT_EQ(allocator.used(), 0);
+    ASSERT_EQ(allocator.allocate(100), 0);
+
+    // Growth appends the new tail without moving existing ranges
+    allocator.grow(150);
+    ASSERT_EQ(allocator.capacity(), 150);
+    ASSERT_EQ(allocator.used(), 100);
+    ASSERT_EQ(allocator.allocate(50), 100);
+
+    std::cout << "✓ RangeAllocator: first fit, coalescing and growth\n";
+}
+
+// ============================================================
+// Test 2: Instance Slots
+// ============================================================
+
+TEST(InstanceSlots) {
+    MeshBatch batch(1000, 3000, 4, 2);
+    const glm::vec3 bmin(-1.0f), bmax(1.0f);
+    const MeshBatch::MeshRange* first = batch.addMesh(1, 100, 300, bmin, bmax);
+    const MeshBatch::MeshRange* second = batch.addMesh(2, 50, 120, bmin, bmax);
+    ASSERT_NOT_NULL(first);
+    ASSERT_NOT_NULL(second);
+    ASSERT_EQ(second->firstVertex, 100u);
+    ASSERT_EQ(second->firstIndex, 300u);
+    ASSERT_EQ(batch.addMesh(1, 10, 10, bmin, bmax), nullptr);
+    ASSERT_EQ(batch.addMesh(3, 2000, 10, bmin, bmax), nullptr);
+    ASSERT_EQ(batch.vertexAllocator().used(), 150);
+    ASSERT_EQ(batch.indexAllocator().used(), 420);
+
+    const uint32_t s0 = batch.addInstance(1, instanceAt(0, 0, 0));
+    const uint32_t s1 = batch.addInstance(1, instanceAt(1, 0, 0));
+    const uint32_t s2 = batch.addInstance(2, instanceAt(2, 0, 0));
+    const uint32_t s3 = batch.addInstance(1, instanceAt(3, 0, 0));
+    ASSERT_EQ(s0, 0u);
+    ASSERT_EQ(s1, 1u);
+    ASSERT_EQ(s2, 2u);
+    ASSERT_EQ(s3, 3u);
+    ASSERT_EQ(batch.addInstance(1, instanceAt(4, 0, 0)), MeshBatch::INVALID_SLOT);
+    ASSERT_EQ(batch.addInstance(9, instanceAt(0, 0, 0)), MeshBatch::INVALID_SLOT);
+    ASSERT_EQ(batch.meshSlots(1).size(), 3u);
+    ASSERT_EQ(batch.instanceCount(), 4);
+
+    batch.removeInstance(s1);
+    ASSERT_EQ(batch.meshSlots(1).size(), 2u);
+    ASSERT_EQ(batch.instanceCount(), 3);
+    ASSERT_EQ(batch.addInstance(2, instanceAt(5, 0, 0)), s1);
+    ASSERT_EQ(batch.instance(s1).transform[3].x, 5.0f);
+
+    batch.removeMesh(1);
+    ASSERT_NULL(batch.mesh(1));
+    ASSERT_TRUE(batch.meshSlots(1).empty());
+    ASSERT_EQ(batch.instanceCount(), 2);
+    ASSERT_FALSE(batch.isVisible(s0));
+    ASSERT_EQ(batch.vertexAllocator().used(), 50);
+
+    std::cout << "✓ Instance slots: reuse, overflow and mesh removal\n";
+}
+
+// ============================================================
+// Test 3: Uploads
+// ============================================================
+
+TEST(Uploads) {
+    MeshBatch batch(1000, 1000, 16, 2);
+    batch.addMesh(1, 10, 30, glm::vec3(-1.0f), glm::vec3(1.0f));
+    for (int i = 0; i < 6; i++) {
+        batch.addInstance(1, instanceAt(static_cast<float>(i), 0, 0));
+    }
+
+    ASSERT_TRUE(sameRanges(batch.takeUploads(0), {{0, 6}}));
+    ASSERT_TRUE(batch.takeUploads(0).empty());
+
+    // Copy 1 still owes the creation; the edits join it
+    batch.edit(1).tintColor = glm::vec4(1.0f, 0.0f, 0.0f, 1.0f);
+    batch.edit(4).transform[3].y = 2.0f;
+    batch.edit(4).transform[3].z = 3.0f;
+    ASSERT_TRUE(sameRanges(batch.takeUploads(1), {{0, 6}}));
+    ASSERT_TRUE(sameRanges(batch.takeUploads(0), {{1, 1}, {4, 1}}));
+    ASSERT_TRUE(batch.takeUploads(1).empty());
+    ASSERT_TRUE(batch.takeUploads(0).empty());
+
+    // Neighbouring edits coalesce; hiding an instance uploads nothing
+    batch.edit(2);
+    batch.edit(3);
+    batch.setVisible(5, false);
+    ASSERT_TRUE(sameRanges(batch.takeUploads(0), {{2, 2}}));
+    ASSERT_TRUE(sameRanges(batch.takeUploads(1), {{2, 2}}));
+
+    std::cout << "✓ Uploads: per-copy dirty ranges\n";
+}
+
+// ============================================================
+// Test 4: Draws
+// ============================================================
+
+TEST(Draws) {
+    MeshBatch batch(1000, 1000, 16, 1);
+    const MeshBatch::MeshRange* rock = batch.addMesh(1, 24, 36, glm::vec3(-1.0f), glm::vec3(1.0f));
+    const MeshBatch::MeshRange* lamp = batch.addMesh(2, 8, 12, glm::vec3(-0.5f), glm::vec3(0.5f));
+    batch.addMesh(3, 8, 12, glm::vec3(-0.5f), glm::vec3(0.5f));  // No instances: no command
+
+    const uint32_t rockCenter = batch.addInstance(1, instanceAt(0, 0, 0));
+    batch.addInstance(1, instanceAt(50, 0, 0));                            // Outside
+    const uint32_t rockEdge = batch.addInstance(1, instanceAt(10.5f, 0, 0));  // Straddles x = 10
+    const uint32_t lampSlot = batch.addInstance(2, instanceAt(0, 5, 0));
+    const uint32_t hidden = batch.addInstance(2, instanceAt(0, 0, 0));
+    batch.setVisible(hidden, false);
+
+    std::vector<VkDrawIndexedIndirectCommand> commands;
+    std::vector<uint32_t> visibleSlots;
+    const MeshBatch::DrawStats stats = batch.buildDraws(boxFrustum(10.0f), commands, visibleSlots);
+
+    ASSERT_EQ(commands.size(), 2u);
+    ASSERT_EQ(stats.drawCount, 2u);
+    ASSERT_EQ(stats.visibleInstances, 3u);
+    ASSERT_EQ(stats.frustumCulled, 1u);
+    ASSERT_EQ(visibleSlots, std::vector<uint32_t>({rockCenter, rockEdge, lampSlot}));
+
+    ASSERT_EQ(commands[0].firstInstance, 0u);
+    ASSERT_EQ(commands[0].instanceCount, 2u);
+    ASSERT_EQ(commands[0].firstIndex, rock->firstIndex);
+    ASSERT_EQ(commands[0].indexCount, rock->indexCount);
+    ASSERT_EQ(commands[0].vertexOffset, static_cast<int32_t>(rock->firstVertex));
+    ASSERT_EQ(commands[1].firstInstance, 2u);
+    ASSERT_EQ(commands[1].instanceCount, 1u);
+    ASSERT_EQ(commands[1].firstIndex, lamp->firstIndex);
+    ASSERT_EQ(commands[1].vertexOffset, 24);
+
+    // Moving an instance into view only needs its slot edited
+    batch.edit(1).transform[3].x = -5.0f;
+    batch.buildDraws(boxFrustum(10.0f), commands, visibleSlots);
+    ASSERT_FALSE(commands.empty());
+    ASSERT_EQ(commands[0].instanceCount, 3u);
+
+    std::cout << "✓ Draws: " << stats.drawCount << " commands, " << stats.visibleInstances << " visible, "
+              << stats.frustumCulled << " culled\n";
+}
+
+// ============================================================
+// Test 5: Transform Bounds
+// ============================================================
+
+TEST(TransformBounds) {
+    // Scale 2, rotate 90 degrees about Z, translate (1, 2, 3)
+    glm::mat4 transform(1.0f);
+    transform[0] = glm::vec4(0.0f, 2.0f, 0.0f, 0.0f);
+    transform[1] = glm::vec4(-2.0f, 0.0f, 0.0f, 0.0f);
+    transform[2] = glm::vec4(0.0f, 0.0f, 2.0f, 0.0f);
+    transform[3] = glm::vec4(1.0f, 2.0f, 3.0f, 1.0f);
+
+    glm::vec3 worldMin, worldMax;
+    MeshBatch::transformBounds(transform, glm::vec3(0.0f), glm::vec3(1.0f, 2.0f, 3.0f), worldMin, worldMax);
+    ASSERT_TRUE(near(worldMin.x, -3.0f));
+    ASSERT_TRUE(near(worldMin.y, 2.0f));
+    ASSERT_TRUE(near(worldMin.z, 3.0f));
+    ASSERT_TRUE(near(worldMax.x, 1.0f));
+    ASSERT_TRUE(near(worldMax.y, 4.0f));
+    ASSERT_TRUE(near(worldMax.z, 9.0f));
+
+    std::cout << "✓ Transform bounds: exact AABB of a rotated, scaled, translated box\n";
+}
+
+// ============================================================
+// Test 6: Frame Cost
+// ============================================================
+
+TEST(FrameCost) {
+    const uint32_t meshCount = 64;
+    const uint32_t instanceCount = 16384;
+    MeshBatch batch(meshCount * 1000, meshCount * 3000, instanceCount, 3);
+    for (uint32_t mesh = 1; mesh <= meshCount; mesh++) {
+        batch.addMesh(mesh, 1000, 3000, glm::vec3(-1.0f), glm::vec3(1.0f));
+    }
+    for (uint32_t i = 0; i < instanceCount; i++) {
+        const float x = static_cast<float>(i % 128) - 64.0f;
+        const float z = static_cast<float>(i / 128) - 64.0f;
+        batch.addInstance(1 + i % meshCount, instanceAt(x, 0.0f, z));
+    }
+    for (uint32_t frame = 0; frame < 3; frame++) batch.takeUploads(frame);
+
+    std::vector<VkDrawIndexedIndirectCommand> commands;
+    std::vector<uint32_t> visibleSlots;
+    const Frustum frustum = boxFrustum(32.0f);
+    const int frames = 100;
+    size_t uploaded = 0;
+
+    auto start = std::chrono::steady_clock::now();
+    for (int frame = 0; frame < frames; frame++) {
+        for (uint32_t i = 0; i < instanceCount / 100; i++) {
+            batch.edit((i * 97 + frame * 31) % instanceCount).transform[3].y += 0.01f;
+        }
+        for (const MeshBatch::SlotRange& range : batch.takeUploads(frame % 3)) {
+            uploaded += range.count;
+        }
+        batch.buildDraws(frustum, commands, visibleSlots);
+    }
+    const double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    ASSERT_EQ(commands.size(), meshCount);
+    std::cout << "✓ Frame: " << instanceCount << " instances, " << commands.size() << " draws, "
+              << visibleSlots.size() << " visible, " << uploaded / frames << " slots uploaded/frame, "
+              << ms / frames << " ms/frame\n";
+}
+
+// ============================================================
+// Main Entry Point
+// ============================================================
+
+int main() {
+    try {
+        run_all_tests();
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "TEST FAILURE: " << e.what() << std::endl;
+        return 1;
+    }
+}
@@ -34,11 +34,10 @@ double benchmarkWithoutPooling(int iterations) {
         for (int j = 0; j < 30000; ++j) {
             vertices.push_back(CompressedVertex::pack(
                 0.0f, 0.0f, 0.0f,  // position
-                0,                  // normal
                 1, 1,              // quad width/height
-                0, 0,              // atlas x/y
+                0,                 // texture layer
                 0,                 // corner
-                15, 0, 15,         // sky, block, ao
+                15, 0, 0, 15,      // sky, block, prev block, ao
                 0                  // tint
             ));
         }
@@ -74,11 +73,10 @@ double benchmarkWithPooling(int iterations) {
         for (int j = 0; j < 30000; ++j) {
             vertices.push_back(CompressedVertex::pack(
                 0.0f, 0.0f, 0.0f,  // position
-                0,                  // normal
                 1, 1,              // quad width/height
-                0, 0,              // atlas x/y
+                0,                 // texture layer
                 0,                 // corner
-                15, 0, 15,         // sky, block, ao
+                15, 0, 0, 15,      // sky, block, prev block, ao
                 0                  // tint
             ));
         }
@@ -0,0 +1,265 @@
+/**
+ * @file test_particle_pool.cpp
+ * @brief Correctness and throughput test for the SoA particle pool
+ *
+ * Compares ParticlePool against the previous array-of-structs emitter update
+ * (per-particle gravity/drag/lifetime + gradient search for color and size):
+ * - Physics: positions after 60 frames must match the AoS reference
+ * - Curves: baked LUT colors/sizes must match direct evaluation within one LUT step
+ * - Compaction: dead particles are removed and per-emitter counts stay exact
+ * - Throughput: 100k particles, update + instance output per frame
+ *
+ * EXPECTED RESULTS:
+ * - 100k particles: ~0.3 ms update, ~1 ms with instance write (single core for the write)
+ * - ~2.5x faster than the AoS loop (SIMD kernel, no per-particle curve searches)
+ *
+ * Created: 2025-11-28
+ */
+
+#include "particle/particle_pool.h"
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <vector>
+
+namespace {
+
+constexpr size_t BENCH_PARTICLES = 100000;
+
+/**
+ * @brief The previous per-emitter particle (AoS)
+ */
+struct LegacyParticle {
+    glm::vec3 position;
+    glm::vec3 velocity;
+    glm::vec4 color;
+    glm::vec2 size;
+    float lifetime;
+    float maxLifetime;
+};
+
+glm::vec4 legacyColor(const EmitterConfig& config, float age) {
+    const auto& gradient = config.colorGradient;
+    if (gradient.empty()) return glm::mix(config.colorStart, config.colorEnd, age);
+    size_t i = 0;
+    while (i < gradient.size() - 1 && gradient[i + 1].time <= age) ++i;
+    if (i >= gradient.size() - 1) return gradient.back().color;
+    float t = glm::clamp((age - gradient[i].time) / (gradient[i + 1].time - gradient[i].time), 0.0f, 1.0f);
+    return glm::mix(gradient[i].color, gradient[i + 1].color, t);
+}
+
+void legacyUpdate(std::vector<LegacyParticle>& particles, const EmitterConfig& config, float dt) {
+    for (auto& p : particles) {
+        p.velocity.x += config.gravity.x * dt;
+        p.velocity.y += config.gravity.y * dt;
+        if (config.drag > 0.0f) p.velocity *= (1.0f - config.drag * dt);
+        p.position += p.velocity * dt;
+        p.lifetime -= dt;
+        float age = 1.0f - p.lifetime / p.maxLifetime;
+        p.color = legacyColor(config, age);
+        p.size = glm::mix(config.sizeStart, config.sizeEnd, age);
+    }
+}
+
+EmitterConfig makeConfig() {
+    EmitterConfig config;
+    config.gravity = glm::vec2(0.5f, -9.8f);
+    config.drag = 0.3f;
+    config.sizeStart = glm::vec2(1.0f, 1.0f);
+    config.sizeEnd = glm::vec2(0.2f, 0.2f);
+    config.colorGradient = {
+        {0.0f, glm::vec4(1.0f, 0.9f, 0.2f, 1.0f)},
+        {0.3f, glm::vec4(1.0f, 0.4f, 0.0f, 0.9f)},
+        {0.7f, glm::vec4(0.4f, 0.4f, 0.4f, 0.5f)},
+        {1.0f, glm::vec4(0.2f, 0.2f, 0.2f, 0.0f)},
+    };
+    return config;
+}
+
+struct SpawnData {
+    glm::vec3 position;
+    glm::vec3 velocity;
+    float lifetime;
+};
+
+std::vector<SpawnData> makeSpawns(size_t count, float minLife, float maxLife) {
+    std::mt19937 rng(1234);
+    std::uniform_real_distribution<float> pos(-50.0f, 50.0f);
+    std::uniform_real_distribution<float> vel(-5.0f, 5.0f);
+    std::uniform_real_distribution<float> life(minLife, maxLife);
+    std::vector<SpawnData> spawns(count);
+    for (auto& s : spawns) {
+        s.position = glm::vec3(pos(rng), pos(rng), pos(rng));
+        s.velocity = glm::vec3(vel(rng), vel(rng), vel(rng));
+        s.lifetime = life(rng);
+    }
+    return spawns;
+}
+
+bool near(float a, float b, float eps) { return std::fabs(a - b) <= eps; }
+
+/**
+ * @brief Physics and curves match the AoS reference while nothing dies (order preserved)
+ */
+bool testMatchesLegacy() {
+    const EmitterConfig config = makeConfig();
+    const auto spawns = makeSpawns(1003, 5.0f, 10.0f);  // Odd count exercises the scalar tail
+
+    ParticlePool pool(2048);
+    uint16_t slot = pool.registerEmitter(config);
+    std::vector<LegacyParticle> legacy;
+    for (const auto& s : spawns) {
+        pool.spawn(slot, s.position, s.velocity, s.lifetime);
+        legacy.push_back({s.position, s.velocity, glm::vec4(1.0f), glm::vec2(1.0f), s.lifetime, s.lifetime});
+    }
+
+    const float dt = 1.0f / 60.0f;
+    for (int frame = 0; frame < 60; frame++) {
+        pool.update(dt);
+        legacyUpdate(legacy, config, dt);
+    }
+
+    if (pool.size() != legacy.size()) return false;
+    const float lutStep = 1.0f / (ParticlePool::CURVE_LUT_SIZE - 1);
+    for (size_t i = 0; i < legacy.size(); i++) {
+        ParticlePool::Sample s = pool.sample(i);
+        const LegacyParticle& p = legacy[i];
+        if (!near(s.position.x, p.position.x, 1e-3f) || !near(s.position.y, p.position.y, 1e-3f) ||
+            !near(s.position.z, p.position.z, 1e-3f)) {
+            std::cout << "  position mismatch at " << i << std::endl;
+            return false;
+        }
+        // Nearest LUT sample: within half a step of age, colors move at most ~2.5/step here
+        if (!near(s.color.r, p.color.r, 2.0f * lutStep) || !near(s.color.a, p.color.a, 2.0f * lutStep) ||
+            !near(s.size.x, p.size.x, lutStep)) {
+            std::cout << "  curve mismatch at " << i << std::endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Dead particles are compacted away and counts stay exact per emitter
+ */
+bool testCompaction() {
+    ParticlePool pool(4096);
+    EmitterConfig config = makeConfig();
+    uint16_t a = pool.registerEmitter(config);
+    uint16_t b = pool.registerEmitter(config);
+
+    // Short-lived particles interleaved with long-lived ones
+    for (int i = 0; i < 1000; i++) {
+        pool.spawn(a, glm::vec3(0.0f), glm::vec3(0.0f), (i % 2) ? 0.05f : 10.0f);
+        pool.spawn(b, glm::vec3(0.0f), glm::vec3(0.0f), (i % 3) ? 10.0f : 0.05f);
+    }
+    pool.update(0.1f);
+
+    size_t countA = 0, countB = 0;
+    for (size_t i = 0; i < pool.size(); i++) {
+        (pool.emitterOf(i) == a ? countA : countB)++;
+    }
+    if (countA != 500 || pool.liveCount(a) != 500) return false;
+    if (countB != 666 || pool.liveCount(b) != 666) return false;
+
+    pool.releaseEmitter(a);
+    if (pool.size() != 666 || pool.liveCount(a) != 0) return false;
+
+    // Released slots are reused; full pools refuse spawns
+    uint16_t c = pool.registerEmitter(config);
+    if (c != a) return false;
+    size_t spawned = 0;
+    while (pool.spawn(c, glm::vec3(0.0f), glm::vec3(0.0f), 1.0f)) spawned++;
+    return pool.size() == pool.capacity() && spawned == pool.capacity() - 666;
+}
+
+template <typename Fn>
+double timeMs(int iterations, Fn&& fn) {
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < iterations; ++i) {
+        fn();
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration_cast<std::chrono::microseconds>(end - start).count() / 1000.0 / iterations;
+}
+
+}  // namespace
+
+int main() {
+    const int ITERATIONS = 100;
+
+    std::cout << "=== Particle Pool Test ===" << std::endl;
+
+    if (!testMatchesLegacy()) {
+        std::cout << "✗ FAILURE: Pool simulation differs from the AoS reference" << std::endl;
+        return 1;
+    }
+    std::cout << "Physics and curves match the AoS reference" << std::endl;
+
+    if (!testCompaction()) {
+        std::cout << "✗ FAILURE: Compaction or emitter counts incorrect" << std::endl;
+        return 1;
+    }
+    std::cout << "Compaction and emitter counts correct" << std::endl;
+
+    // ========== Throughput (lifetimes long enough that nothing dies mid-benchmark) ==========
+    const EmitterConfig config = makeConfig();
+    const auto spawns = makeSpawns(BENCH_PARTICLES, 1000.0f, 2000.0f);
+    const float dt = 1.0f / 60.0f;
+
+    std::vector<LegacyParticle> legacy;
+    legacy.reserve(spawns.size());
+    ParticlePool pool(BENCH_PARTICLES);
+    uint16_t slot = pool.registerEmitter(config);
+    for (const auto& s : spawns) {
+        legacy.push_back({s.position, s.velocity, glm::vec4(1.0f), glm::vec2(1.0f), s.lifetime, s.lifetime});
+        pool.spawn(slot, s.position, s.velocity, s.lifetime);
+    }
+    std::vector<ParticleInstance> instances(BENCH_PARTICLES);
+
+    // Legacy render gathered alive particles into a staging vector, then copied it
+    std::vector<ParticleInstance> staging;
+    staging.reserve(BENCH_PARTICLES);
+    double legacyMs = timeMs(ITERATIONS, [&] {
+        legacyUpdate(legacy, config, dt);
+        staging.clear();
+        for (const auto& p : legacy) {
+            if (p.lifetime <= 0.0f) continue;
+            ParticleInstance instance;
+            instance.positionSize = glm::vec4(p.position, p.size.x);
+            instance.color = p.color;
+            instance.rotation = 0.0f;
+            staging.push_back(instance);
+        }
+        std::copy(staging.begin(), staging.end(), instances.begin());
+    });
+
+    size_t written = 0;
+    double updateMs = timeMs(ITERATIONS, [&] { pool.update(dt); });
+    double writeMs = timeMs(ITERATIONS, [&] { written = pool.writeInstances(instances.data(), instances.size()); });
+    double poolMs = updateMs + writeMs;
+
+    std::cout << "\n=== Results (" << BENCH_PARTICLES << " particles, per frame) ===" << std::endl;
+    std::cout << "AoS update + gather:     " << legacyMs << " ms" << std::endl;
+    std::cout << "SoA update:              " << updateMs << " ms" << std::endl;
+    std::cout << "SoA instance write:      " << writeMs << " ms" << std::endl;
+    std::cout << "SoA total:               " << poolMs << " ms ("
+              << (poolMs > 0.0 ? legacyMs / poolMs : 0.0) << "x)" << std::endl;
+    std::cout << "Target (1 ms):           " << (poolMs <= 1.0 ? "met" : "missed on this machine") << std::endl;
+
+    if (written != BENCH_PARTICLES) {
+        std::cout << "\n✗ FAILURE: Wrote " << written << " instances, expected " << BENCH_PARTICLES << std::endl;
+        return 1;
+    }
+
+    // Allow timer noise on loaded CI machines; a genuinely slower pool is a regression
+    if (poolMs > legacyMs * 1.25) {
+        std::cout << "\n✗ FAILURE: SoA pool slower than the AoS update" << std::endl;
+        return 1;
+    }
+
+    std::cout << "\n✓ SUCCESS: Pool matches the reference and is faster" << std::endl;
+    return 0;
+}
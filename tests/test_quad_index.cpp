@@ -0,0 +1,227 @@
+/**
+ * @file test_quad_index.cpp
+ * @brief Round-trip test for implicit quad indexing of chunk meshes
+ *
+ * Chunk meshes no longer carry indices: the renderer draws them through one shared
+ * 16-bit quad index buffer with firstIndex 0 and vertexOffset = base vertex.
+ *
+ * Tests:
+ * 1. Shared buffer layout (size, full 16-bit range)
+ * 2. Round trip: the explicit index list the meshers used to emit is recognised as an
+ *    implicit quad list, and shared buffer + forEachDraw() draws reproduce the same
+ *    absolute vertex indices, including meshes split across several draws
+ * 3. Non-pattern index lists are rejected
+ * 4. Chunk::generateMesh() output is a quad list the shared pattern draws correctly
+ * 5. Per-quad GPU bytes before/after
+ *
+ * Created: 2025-11-28
+ */
+
+#include "test_utils.h"
+#include "chunk.h"
+#include "quad_index.h"
+#include <cstdint>
+#include <vector>
+
+namespace {
+
+// The index list Chunk::generateMesh / ChunkLod::buildMesh emitted per quad
+std::vector<uint32_t> legacyIndices(uint32_t quadCount) {
+    std::vector<uint32_t> indices;
+    indices.reserve(static_cast<size_t>(quadCount) * 6);
+    for (uint32_t q = 0; q < quadCount; q++) {
+        const uint32_t baseIndex = q * 4;
+        indices.push_back(baseIndex + 0);
+        indices.push_back(baseIndex + 1);
+        indices.push_back(baseIndex + 2);
+        indices.push_back(baseIndex + 0);
+        indices.push_back(baseIndex + 2);
+        indices.push_back(baseIndex + 3);
+    }
+    return indices;
+}
+
+// What the GPU fetches: shared[firstIndex + i] + vertexOffset for every draw
+std::vector<uint32_t> decodeDraws(const std::vector<QuadIndex::Index>& shared, uint32_t vertexCount,
+                                  int32_t baseVertex, size_t* drawCount) {
+    std::vector<uint32_t> resolved;
+    *drawCount = 0;
+    QuadIndex::forEachDraw(vertexCount, baseVertex, [&](uint32_t indexCount, int32_t vertexOffset) {
+        (*drawCount)++;
+        for (uint32_t i = 0; i < indexCount && i < shared.size(); i++) {
+            resolved.push_back(static_cast<uint32_t>(shared[i] + vertexOffset));
+        }
+    });
+    return resolved;
+}
+
+void checkRoundTrip(uint32_t quadCount, int32_t baseVertex) {
+    static const std::vector<QuadIndex::Index> shared = QuadIndex::buildSharedIndices();
+    const uint32_t vertexCount = quadCount * QuadIndex::VERTICES_PER_QUAD;
+    const std::vector<uint32_t> indices = legacyIndices(quadCount);
+
+    ASSERT_TRUE(QuadIndex::isImplicitQuadList(indices.data(), indices.size(), vertexCount));
+    ASSERT_EQ(QuadIndex::indexCountForVertices(vertexCount), indices.size());
+
+    size_t drawCount = 0;
+    const std::vector<uint32_t> resolved = decodeDraws(shared, vertexCount, baseVertex, &drawCount);
+    ASSERT_EQ(resolved.size(), indices.size());
+    for (size_t i = 0; i < indices.size(); i++) {
+        ASSERT_EQ(resolved[i], indices[i] + static_cast<uint32_t>(baseVertex));
+    }
+
+    const size_t expectedDraws = (quadCount + QuadIndex::MAX_QUADS_PER_DRAW - 1) / QuadIndex::MAX_QUADS_PER_DRAW;
+    ASSERT_EQ(drawCount, expectedDraws);
+
+    std::cout << "  " << quadCount << " quads @ base " << baseVertex << ": " << drawCount << " draw(s)\n";
+}
+
+struct Int3 {
+    int64_t x, y, z;
+};
+
+Int3 decodePosition(const CompressedVertex& v) {
+    return {static_cast<int16_t>(v.posXY & 0xFFFF), static_cast<int16_t>(v.posXY >> 16),
+            static_cast<int16_t>(v.posZAtlas & 0xFFFF)};
+}
+
+Int3 sub(const Int3& a, const Int3& b) { return {a.x - b.x, a.y - b.y, a.z - b.z}; }
+Int3 cross(const Int3& a, const Int3& b) {
+    return {a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x};
+}
+int64_t dot(const Int3& a, const Int3& b) { return a.x * b.x + a.y * b.y + a.z * b.z; }
+
+}  // namespace
+
+// ============================================================
+// Test 1: Shared Buffer Layout
+// ============================================================
+
+TEST(SharedBufferLayout) {
+    const std::vector<QuadIndex::Index> shared = QuadIndex::buildSharedIndices();
+    ASSERT_EQ(shared.size() * sizeof(QuadIndex::Index), QuadIndex::SHARED_BUFFER_BYTES);
+    ASSERT_EQ(shared.back(), 65535);  // Full 16-bit range
+
+    std::cout << "✓ Shared buffer: " << (QuadIndex::SHARED_BUFFER_BYTES / 1024) << " KB\n";
+}
+
+// ============================================================
+// Test 2: Round Trip
+// ============================================================
+
+TEST(RoundTrip) {
+    checkRoundTrip(0, 0);
+    checkRoundTrip(1, 0);
+    checkRoundTrip(2500, 123456);                             // Typical surface chunk
+    checkRoundTrip(QuadIndex::MAX_QUADS_PER_DRAW, 4096);      // Exactly one full draw
+    checkRoundTrip(QuadIndex::MAX_QUADS_PER_DRAW + 1, 4096);  // Split into two
+    checkRoundTrip(98304, 50000000);                          // 32³ checkerboard worst case
+
+    std::cout << "✓ Shared buffer draws reproduce the explicit index lists\n";
+}
+
+// ============================================================
+// Test 3: Rejection
+// ============================================================
+
+TEST(RejectsNonPatternLists) {
+    std::vector<uint32_t> indices = legacyIndices(8);
+    ASSERT_TRUE(QuadIndex::isImplicitQuadList(indices.data(), indices.size(), 32));
+
+    std::vector<uint32_t> flipped = indices;
+    flipped[4 * 6 + 2] = 4 * 4 + 3;  // Other diagonal on quad 4
+    ASSERT_FALSE(QuadIndex::isImplicitQuadList(flipped.data(), flipped.size(), 32));
+
+    ASSERT_FALSE(QuadIndex::isImplicitQuadList(indices.data(), indices.size() - 6, 32));  // Short list
+    ASSERT_FALSE(QuadIndex::isImplicitQuadList(indices.data(), indices.size(), 30));      // Partial quad
+
+    std::cout << "✓ Non-pattern index lists rejected\n";
+}
+
+// ============================================================
+// Test 4: Mesher Output
+// ============================================================
+
+TEST(MesherOutputIsQuadList) {
+    const int stoneID = BlockRegistry::instance().getID("Stone");
+    const int blockID = stoneID > 0 ? stoneID : 1;
+
+    // Rolling terrain with overhangs and holes: greedy quads of many sizes on all six faces
+    Chunk chunk(0, 0, 0);
+    for (int x = 0; x < Chunk::WIDTH; x++) {
+        for (int z = 0; z < Chunk::DEPTH; z++) {
+            const int height = 8 + (x * 7 + z * 3) % 11;
+            for (int y = 0; y < height; y++) {
+                if ((x * 5 + y * 3 + z) % 13 != 0) {
+                    chunk.setBlock(x, y, z, blockID);
+                }
+            }
+            if ((x + z) % 9 == 0) {
+                chunk.setBlock(x, height + 4, z, blockID);  // Floating block
+            }
+        }
+    }
+    chunk.generateMesh(nullptr, 0);
+
+    // No renderer, no upload arena: the mesh stays on the CPU
+    const std::vector<CompressedVertex>& verts = chunk.getVertices();
+    ASSERT_GT(verts.size(), 0u);
+    ASSERT_EQ(verts.size(), chunk.getVertexCount());
+    ASSERT_EQ(verts.size() % QuadIndex::VERTICES_PER_QUAD, 0u);
+    ASSERT_EQ(chunk.getIndexCount(), QuadIndex::indexCountForVertices(chunk.getVertexCount()));
+
+    // The shared pattern draws {0,1,2} {0,2,3}: vertices 0/2 and 1/3 must be opposite corners,
+    // and both triangles must be non-degenerate, coplanar and wound the same way
+    for (size_t q = 0; q < verts.size(); q += QuadIndex::VERTICES_PER_QUAD) {
+        uint32_t corners[4];
+        Int3 p[4];
+        uint32_t seen = 0;
+        for (int i = 0; i < 4; i++) {
+            corners[i] = (verts[q + i].packedB >> 14) & 0x3;
+            p[i] = decodePosition(verts[q + i]);
+            seen |= 1u << corners[i];
+        }
+        ASSERT_EQ(seen, 0xFu);
+        ASSERT_EQ(corners[0] ^ corners[2], 3u);
+        ASSERT_EQ(corners[1] ^ corners[3], 3u);
+
+        const Int3 n0 = cross(sub(p[1], p[0]), sub(p[2], p[0]));
+        const Int3 n1 = cross(sub(p[2], p[0]), sub(p[3], p[0]));
+        ASSERT_GT(dot(n0, n0), 0);
+        ASSERT_GT(dot(n1, n1), 0);
+        ASSERT_GT(dot(n0, n1), 0);
+        ASSERT_EQ(dot(n0, sub(p[3], p[0])), 0);
+    }
+
+    std::cout << "✓ generateMesh: " << verts.size() / QuadIndex::VERTICES_PER_QUAD
+              << " quads drawable through the shared index buffer\n";
+}
+
+// ============================================================
+// Test 5: Bytes Per Quad
+// ============================================================
+
+TEST(BytesPerQuad) {
+    // 4 vertices + 6 x uint32 indices before, vertices only now
+    const size_t before = QuadIndex::VERTICES_PER_QUAD * sizeof(CompressedVertex) +
+                          QuadIndex::INDICES_PER_QUAD * sizeof(uint32_t);
+    const size_t after = QuadIndex::VERTICES_PER_QUAD * sizeof(CompressedVertex);
+    ASSERT_EQ(3 * (before - after), before);  // 24 of 72 bytes: a third less memory and upload
+
+    std::cout << "✓ Bytes per quad: " << before << " -> " << after << " ("
+              << (100 * (before - after) / before) << "% less chunk memory and upload)\n";
+}
+
+// ============================================================
+// Main Entry Point
+// ============================================================
+
+int main() {
+    try {
+        run_all_tests();
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "TEST FAILURE: " << e.what() << std::endl;
+        return 1;
+    }
+}
@@ -0,0 +1,297 @@
+/**
+ * @file test_script_vm.cpp
+ * @brief Correctness and throughput test for compiled script actions
+ *
+ * Event handlers used to walk the ScriptAction tree per event; they now run
+ * the flat bytecode from ScriptProgram::compile().
+ *
+ * Tests:
+ * 1. Jump layout for conditionals, per-action probability and no-op actions
+ * 2. Variable semantics through slots match the string registry API
+ * 3. Branch selection without a world (EngineAPI not initialized)
+ * 4. Handlers/sec on a variable + conditional script: tree walker vs bytecode
+ *
+ * Created: 2025-11-28
+ */
+
+#include "test_utils.h"
+#include "script_action.h"
+#include "script_bytecode.h"
+#include "logger.h"
+#include <chrono>
+#include <mutex>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+
+ScriptAction makeAction(ActionType type) {
+    ScriptAction action;
+    action.type = type;
+    return action;
+}
+
+ScriptAction setVar(const std::string& name, const std::string& value) {
+    ScriptAction action = makeAction(ActionType::SET_VARIABLE);
+    action.variableName = name;
+    action.variableValue = value;
+    return action;
+}
+
+ScriptAction addVar(const std::string& name, int amount) {
+    ScriptAction action = makeAction(amount >= 0 ? ActionType::INCREMENT_VAR : ActionType::DECREMENT_VAR);
+    action.variableName = name;
+    action.incrementAmount = amount >= 0 ? amount : -amount;
+    return action;
+}
+
+ScriptAction conditional(ConditionType condition, const std::string& value,
+                         std::vector<ScriptAction> thenActions, std::vector<ScriptAction> elseActions = {}) {
+    ScriptAction action = makeAction(ActionType::CONDITIONAL);
+    action.conditionType = condition;
+    action.conditionValue = value;
+    action.thenActions = std::move(thenActions);
+    action.elseActions = std::move(elseActions);
+    return action;
+}
+
+// ----- Previous execution path, for the benchmark -----
+
+/// String-keyed variable store as ScriptVariableRegistry used to keep it
+struct LegacyVariables {
+    std::unordered_map<std::string, std::string> values;
+    std::mutex mutex;
+
+    void set(const std::string& name, const std::string& value) {
+        std::lock_guard<std::mutex> lock(mutex);
+        values[name] = value;
+    }
+
+    int get(const std::string& name) {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = values.find(name);
+        if (it == values.end()) return 0;
+        try { return std::stoi(it->second); } catch (const std::exception&) { return 0; }
+    }
+
+    void add(const std::string& name, int amount) {
+        std::lock_guard<std::mutex> lock(mutex);
+        int current = 0;
+        auto it = values.find(name);
+        if (it != values.end()) {
+            try { current = std::stoi(it->second); } catch (const std::exception&) { current = 0; }
+        }
+        values[name] = std::to_string(current + amount);
+    }
+};
+
+/// Tree walker: per-action debug stream, stoi per chance roll, string variables
+void legacyExecute(const ScriptAction& action, const glm::ivec3& position,
+                   LegacyVariables& variables, std::mt19937& rng) {
+    std::uniform_int_distribution<int> dist(1, 100);
+    if (action.probability < 100 && (action.probability <= 0 || dist(rng) > action.probability)) return;
+
+    const glm::ivec3 target = position + action.offset;
+    Logger::debug() << "Executing action " << actionTypeToString(action.type)
+                    << " at position (" << target.x << ", " << target.y << ", " << target.z << ")";
+
+    switch (action.type) {
+        case ActionType::SET_VARIABLE:
+            variables.set(action.variableName, action.variableValue);
+            Logger::debug() << "SET_VARIABLE: " << action.variableName << " = " << action.variableValue;
+            break;
+        case ActionType::INCREMENT_VAR:
+        case ActionType::DECREMENT_VAR: {
+            variables.add(action.variableName, action.type == ActionType::INCREMENT_VAR
+                                                   ? action.incrementAmount : -action.incrementAmount);
+            const int value = variables.get(action.variableName);
+            Logger::debug() << actionTypeToString(action.type) << ": " << action.variableName
+                            << " (new value: " << value << ")";
+            break;
+        }
+        case ActionType::CONDITIONAL: {
+            bool result = false;
+            try {
+                const int chance = std::stoi(action.conditionValue);
+                result = chance >= 100 || (chance > 0 && dist(rng) <= chance);
+            } catch (const std::exception&) {
+            }
+            Logger::debug() << "CONDITIONAL: condition evaluated to " << (result ? "true" : "false");
+            for (const auto& nested : result ? action.thenActions : action.elseActions) {
+                legacyExecute(nested, position, variables, rng);
+            }
+            break;
+        }
+        default:
+            break;
+    }
+}
+
+}  // namespace
+
+// ============================================================
+// Test 1: Jump Layout
+// ============================================================
+
+TEST(JumpLayout) {
+    // if (chance 50) { a += 1 } else { a -= 1 }; b = 3 at 25%; get_variable (no-op); never (probability 0)
+    ScriptAction chanceBody = setVar("vm_b", "3");
+    chanceBody.probability = 25;
+    ScriptAction never = addVar("vm_a", 100);
+    never.probability = 0;
+    ScriptAction get = makeAction(ActionType::GET_VARIABLE);
+    get.variableName = "vm_a";
+
+    auto program = ScriptProgram::compile(
+        {conditional(ConditionType::RANDOM_CHANCE, "50", {addVar("vm_a", 1)}, {addVar("vm_a", -1)}),
+         chanceBody, get, never},
+        "layout");
+
+    const auto& code = program->getCode();
+    ASSERT_EQ(code.size(), 6u);
+    ASSERT_TRUE(code[0].op == ScriptOp::JUMP_UNLESS_CHANCE);  // Condition test jumps to the else branch
+    ASSERT_EQ(code[0].a, 50);
+    ASSERT_EQ(code[0].b, 3);
+    ASSERT_TRUE(code[1].op == ScriptOp::ADD_VAR);             // Then branch
+    ASSERT_EQ(code[1].b, 1);
+    ASSERT_TRUE(code[2].op == ScriptOp::JUMP);                // Then branch jumps past else
+    ASSERT_EQ(code[2].b, 4);
+    ASSERT_TRUE(code[3].op == ScriptOp::ADD_VAR);             // decrement_var negated
+    ASSERT_EQ(code[3].b, -1);
+    ASSERT_TRUE(code[4].op == ScriptOp::JUMP_UNLESS_CHANCE);  // Probability skips its action
+    ASSERT_EQ(code[4].a, 25);
+    ASSERT_EQ(code[4].b, 6);
+    ASSERT_TRUE(code[5].op == ScriptOp::SET_VAR_NUMBER);      // Integer constant pre-parsed
+    ASSERT_EQ(code[5].b, 3);
+    ASSERT_LE(sizeof(ScriptInstruction), 24u);
+
+    std::cout << "✓ Conditionals, probabilities and no-ops compile to the expected jumps\n";
+}
+
+// ============================================================
+// Test 2: Variable Slots
+// ============================================================
+
+TEST(VariableSlots) {
+    auto& registry = ScriptVariableRegistry::instance();
+    registry.clear();
+
+    auto program = ScriptProgram::compile(
+        {setVar("vm_count", "5"), addVar("vm_count", 2), addVar("vm_count", -10),
+         setVar("vm_label", "007"), setVar("vm_word", "hello"), addVar("vm_word", 4)},
+        "variables");
+    program->execute(glm::ivec3(0));
+
+    ASSERT_EQ(registry.getNumeric("vm_count"), -3);
+    ASSERT_EQ(registry.getVariable("vm_count"), std::string("-3"));
+    ASSERT_EQ(registry.getVariable("vm_label"), std::string("007"));  // Non-canonical number keeps its text
+    ASSERT_EQ(registry.getNumeric("vm_label"), 7);
+    ASSERT_EQ(registry.getNumeric("vm_word"), 4);                     // Non-numeric text counts as 0
+
+    // String API and slots see the same storage
+    registry.setVariable("vm_count", "40");
+    registry.increment("vm_count");
+    program->execute(glm::ivec3(0));
+    ASSERT_EQ(registry.getNumeric("vm_count"), -3);  // set_variable resets the slot
+
+    registry.clear();
+    ASSERT_EQ(registry.getVariable("vm_count", "none"), std::string("none"));
+    registry.increment("vm_count", 2);
+    ASSERT_EQ(registry.getNumeric("vm_count"), 2);  // Slot still usable after clear()
+    registry.clear();
+
+    std::cout << "✓ Variable slots match the string registry API\n";
+}
+
+// ============================================================
+// Test 3: Branch Selection
+// ============================================================
+
+TEST(BranchSelection) {
+    auto& registry = ScriptVariableRegistry::instance();
+    registry.clear();
+
+    // No world here: time and block checks are false, as in the tree walker
+    auto program = ScriptProgram::compile(
+        {conditional(ConditionType::RANDOM_CHANCE, "100", {addVar("vm_then", 1)}, {addVar("vm_else", 1)}),
+         conditional(ConditionType::RANDOM_CHANCE, "0", {addVar("vm_then", 10)}, {addVar("vm_else", 10)}),
+         conditional(ConditionType::RANDOM_CHANCE, "lots", {addVar("vm_then", 100)}),
+         conditional(ConditionType::TIME_IS_DAY, "", {addVar("vm_then", 1000)}, {addVar("vm_else", 100)}),
+         conditional(ConditionType::RANDOM_CHANCE, "100",
+                     {conditional(ConditionType::RANDOM_CHANCE, "0", {addVar("vm_then", 10000)},
+                                  {addVar("vm_else", 1000)})})},
+        "branches");
+    for (int i = 0; i < 3; i++) program->execute(glm::ivec3(i, 0, 0));
+
+    ASSERT_EQ(registry.getNumeric("vm_then"), 3);
+    ASSERT_EQ(registry.getNumeric("vm_else"), 3 * 1110);
+    registry.clear();
+
+    std::cout << "✓ Branch selection matches the tree walker\n";
+}
+
+// ============================================================
+// Test 4: Throughput
+// ============================================================
+
+TEST(Throughput) {
+    // Typical counter/state-machine handler: 6-7 actions per event
+    ScriptAction rare = addVar("bench_rare", 1);
+    rare.probability = 10;
+    const std::vector<ScriptAction> actions = {
+        addVar("bench_steps", 1),
+        conditional(ConditionType::RANDOM_CHANCE, "50", {setVar("bench_mode", "on")}, {setVar("bench_mode", "off")}),
+        addVar("bench_budget", -2),
+        conditional(ConditionType::RANDOM_CHANCE, "100", {addVar("bench_hits", 1), setVar("bench_last", "7")}),
+        rare,
+    };
+
+    const int events = 200000;
+    LegacyVariables legacyVariables;
+    std::mt19937 rng(99);
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < events; i++) {
+        for (const auto& action : actions) {
+            legacyExecute(action, glm::ivec3(i, 64, 0), legacyVariables, rng);
+        }
+    }
+    const double legacySeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    auto& registry = ScriptVariableRegistry::instance();
+    registry.clear();
+    auto program = ScriptProgram::compile(actions, "bench");
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < events; i++) {
+        program->execute(glm::ivec3(i, 64, 0));
+    }
+    const double vmSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    ASSERT_EQ(legacyVariables.get("bench_steps"), events);
+    ASSERT_EQ(registry.getNumeric("bench_steps"), events);
+    ASSERT_EQ(registry.getNumeric("bench_hits"), events);  // Certain branch never skipped
+    ASSERT_EQ(registry.getNumeric("bench_budget"), -2 * events);
+    registry.clear();
+
+    const double legacyRate = events / legacySeconds;
+    const double vmRate = events / vmSeconds;
+    std::cout << "✓ " << program->size() << "-instruction handler: tree walker "
+              << static_cast<long long>(legacyRate) << " events/s, bytecode "
+              << static_cast<long long>(vmRate) << " events/s ("
+              << (legacyRate > 0.0 ? vmRate / legacyRate : 0.0) << "x)\n";
+}
+
+// ============================================================
+// Main Entry Point
+// ============================================================
+
+int main() {
+    try {
+        run_all_tests();
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "TEST FAILURE: " << e.what() << std::endl;
+        return 1;
+    }
+}
@@ -0,0 +1,347 @@
+/**
+ * @file test_smooth_mesh.cpp
+ * @brief Correctness and throughput test for surface-nets smooth terrain
+ *
+ * Smooth terrain chunks mesh smooth_terrain blocks with ChunkSmooth (naive
+ * surface nets over a 34³ padded sample grid) instead of cube faces.
+ *
+ * Tests:
+ * 1. smooth_terrain flags are loaded from assets/blocks
+ * 2. A blob straddling 8 chunks meshes into a closed, consistently wound surface
+ *    (every directed edge is matched by its reverse), so chunk seams have no cracks
+ * 3. Mixed borders: the same blob with smooth and cube chunks in a checkerboard and
+ *    a log column through it; smooth quads plus the cube faces are still closed
+ * 4. A flat floor lands exactly on the block tops, uses the top face texture and
+ *    winds like the cube mesher's top faces; logs are left to the cube mesher;
+ *    packSmooth() positions round-trip to 1/16 block
+ * 5. Chunk::generateMesh() throughput: smooth terrain mode vs the cube mesher
+ *
+ * Created: 2025-11-28
+ */
+
+#include "test_utils.h"
+#include "chunk_smooth.h"
+#include "chunk.h"
+#include "chunk_face_config.h"
+#include "block_system.h"
+#include "debug_state.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <functional>
+#include <map>
+#include <memory>
+#include <tuple>
+#include <vector>
+
+namespace {
+
+// Block IDs from assets/blocks (Block_ID_Index.md)
+const int STONE = 1;
+const int DIRT = 2;
+const int GRASS = 3;
+const int WATER = 5;
+const int OAK_LOG = 6;
+
+using BlockFn = std::function<int(int, int, int)>;  // World block position -> block ID
+using Position = std::tuple<int, int, int>;          // Vertex position in 1/16 blocks
+
+void gatherSamples(ChunkSmooth::SampleGrid& grid, const BlockFn& blockAt, int chunkX, int chunkY, int chunkZ,
+                   uint32_t cubeRegions) {
+    using ChunkSmooth::PAD;
+    grid.resize();
+    grid.cubeRegions = cubeRegions;
+    for (int px = 0; px < PAD; px++)
+        for (int py = 0; py < PAD; py++)
+            for (int pz = 0; pz < PAD; pz++)
+                grid.blocks[ChunkSmooth::SampleGrid::index(px, py, pz)] =
+                    blockAt(chunkX * Chunk::WIDTH + px - 1, chunkY * Chunk::HEIGHT + py - 1, chunkZ * Chunk::DEPTH + pz - 1);
+    ChunkSmooth::prepare(grid);
+    for (int sample : grid.litSamples) grid.light[sample] = 0xF0;  // Open sky
+}
+
+std::vector<CompressedVertex> meshChunk(const BlockFn& blockAt, int chunkX, int chunkY, int chunkZ,
+                                        uint32_t cubeRegions = 0) {
+    ChunkSmooth::SampleGrid grid;
+    gatherSamples(grid, blockAt, chunkX, chunkY, chunkZ, cubeRegions);
+    std::vector<CompressedVertex> verts;
+    ChunkSmooth::buildMesh(grid, chunkX, chunkY, chunkZ, verts);
+    return verts;
+}
+
+bool isInside(int id) {
+    const uint8_t flags = BlockRegistry::instance().properties().flags(id);
+    return (flags & BlockFlags::SOLID) && (flags & BlockFlags::OPAQUE);
+}
+
+/**
+ * Unmerged cube faces of the chunk's blocks that pass isCube, at the positions and
+ * winding the cube mesher uses (block corners, (v1 - v0) x (v2 - v0) points inward)
+ */
+void appendCubeFaces(const BlockFn& blockAt, int chunkX, int chunkY, int chunkZ,
+                     const std::function<bool(int)>& isCube, std::vector<CompressedVertex>& verts) {
+    const int base[3] = {chunkX * Chunk::WIDTH, chunkY * Chunk::HEIGHT, chunkZ * Chunk::DEPTH};
+    for (int x = base[0]; x < base[0] + Chunk::WIDTH; x++) {
+        for (int y = base[1]; y < base[1] + Chunk::HEIGHT; y++) {
+            for (int z = base[2]; z < base[2] + Chunk::DEPTH; z++) {
+                const int id = blockAt(x, y, z);
+                if (!isInside(id) || !isCube(id)) continue;
+                for (int face = 0; face < 6; face++) {
+                    const int axis = face / 2;
+                    const bool positive = (face & 1) == 0;
+                    int block[3] = {x, y, z};
+                    int next[3] = {x, y, z};
+                    next[axis] += positive ? 1 : -1;
+                    if (isInside(blockAt(next[0], next[1], next[2]))) continue;
+
+                    // (b, c) follow the axis cyclically; the face plane is the far side of the lower block
+                    const int b = (axis + 1) % 3;
+                    const int c = (axis + 2) % 3;
+                    const int corners[4][2] = {{0, 0}, {positive ? 0 : 1, positive ? 1 : 0}, {1, 1},
+                                               {positive ? 1 : 0, positive ? 0 : 1}};
+                    for (const auto& corner : corners) {
+                        float position[3];
+                        position[axis] = static_cast<float>(std::min(block[axis], next[axis]) + 1);
+                        position[b] = static_cast<float>(block[b] + corner[0]);
+                        position[c] = static_cast<float>(block[c] + corner[1]);
+                        verts.push_back(CompressedVertex::packSmooth(position[0], position[1], position[2],
+                                                                     0, 15, 0, 15, 0));
+                    }
+                }
+            }
+        }
+    }
+}
+
+Position decode(const CompressedVertex& v) {
+    const int x = static_cast<int16_t>(v.posXY & 0xFFFF);
+    const int y = static_cast<int16_t>(v.posXY >> 16);
+    const int z = static_cast<int16_t>(v.posZAtlas & 0xFFFF);
+    return {x * 16 + static_cast<int>(v.packedB & 0xF), y * 16 + static_cast<int>((v.packedB >> 4) & 0xF),
+            z * 16 + static_cast<int>((v.packedB >> 8) & 0xF)};
+}
+
+/// Every directed quad edge must be matched by as many reverse edges (closed, consistent winding)
+bool isClosedSurface(const std::vector<CompressedVertex>& verts) {
+    std::map<std::pair<Position, Position>, int> edges;
+    for (size_t quad = 0; quad < verts.size(); quad += 4) {
+        for (int i = 0; i < 4; i++) {
+            const Position a = decode(verts[quad + i]);
+            const Position b = decode(verts[quad + (i + 1) % 4]);
+            if (a != b) edges[{a, b}]++;
+        }
+    }
+    for (const auto& entry : edges) {
+        auto reverse = edges.find({entry.first.second, entry.first.first});
+        if (reverse == edges.end() || reverse->second != entry.second) return false;
+    }
+    return !edges.empty();
+}
+
+BlockFn bumpyBlob(float centerX, float centerY, float centerZ, float radius) {
+    return [=](int x, int y, int z) {
+        const float dx = x + 0.5f - centerX, dy = y + 0.5f - centerY, dz = z + 0.5f - centerZ;
+        const float distance = std::sqrt(dx * dx + dy * dy + dz * dz) + 1.5f * std::sin(x * 0.7f) * std::cos(z * 0.5f);
+        if (distance >= radius) return 0;
+        return distance > radius - 1.0f ? GRASS : (distance > radius - 3.0f ? DIRT : STONE);
+    };
+}
+
+int rollingTerrain(int x, int y, int z) {
+    const float height = 40.0f + 8.0f * std::sin(x * 0.11f) + 6.0f * std::cos(z * 0.07f + x * 0.03f);
+    if (y > height) return y < 38 ? WATER : 0;
+    if (std::sin(x * 0.3f) * std::cos(y * 0.35f) * std::sin(z * 0.28f) > 0.6f) return 0;  // Caves
+    if ((x & 15) == 7 && (z & 15) == 9 && y < height + 5) return OAK_LOG;
+    return y > height - 1.0f ? GRASS : (y > height - 4.0f ? DIRT : STONE);
+}
+
+}  // namespace
+
+// ============================================================
+// Test 1: Smooth Flags
+// ============================================================
+
+TEST(SmoothFlags) {
+    const BlockPropertyTable& props = BlockRegistry::instance().properties();
+    ASSERT_TRUE(props.isSmooth(STONE));
+    ASSERT_TRUE(props.isSmooth(GRASS));
+    ASSERT_FALSE(props.isSmooth(OAK_LOG));
+    ASSERT_FALSE(props.isSmooth(WATER));
+
+    std::cout << "✓ smooth_terrain flags loaded from assets/blocks\n";
+}
+
+// ============================================================
+// Test 2: Closed Surface
+// ============================================================
+
+TEST(ClosedSurface) {
+    // Blob centered on a chunk corner: every seam and corner is crossed, also at negative coords
+    for (int corner : {32, 0}) {
+        const BlockFn blob = bumpyBlob(static_cast<float>(corner), static_cast<float>(corner), static_cast<float>(corner), 20.0f);
+        std::vector<CompressedVertex> verts;
+        for (int i = 0; i < 8; i++) {
+            const int base = corner / 32 - 1;
+            const std::vector<CompressedVertex> chunkVerts = meshChunk(blob, base + (i & 1), base + ((i >> 1) & 1), base + (i >> 2));
+            verts.insert(verts.end(), chunkVerts.begin(), chunkVerts.end());
+        }
+        ASSERT_EQ(verts.size() % 4, 0u);  // Quad list
+        ASSERT_TRUE(isClosedSurface(verts));
+        std::cout << "✓ Closed surface across 8 chunks at " << corner << " (" << verts.size() / 4 << " quads)\n";
+    }
+}
+
+// ============================================================
+// Test 3: Mixed Borders
+// ============================================================
+
+TEST(MixedBorders) {
+    // Smooth and cube chunks alternate, so every seam between the 8 chunks is mixed.
+    // A log column runs through a smooth chunk next to a seam and pokes out of the top
+    const BlockFn blob = bumpyBlob(32.0f, 32.0f, 32.0f, 20.0f);
+    const BlockFn blockAt = [&blob](int x, int y, int z) {
+        return (x == 31 && z == 33 && y >= 25 && y < 56) ? OAK_LOG : blob(x, y, z);
+    };
+    auto smoothChunk = [](int cx, int cy, int cz) { return ((cx + cy + cz) & 1) == 0; };
+    const BlockPropertyTable& props = BlockRegistry::instance().properties();
+
+    std::vector<CompressedVertex> verts;
+    size_t smoothQuads = 0;
+    for (int i = 0; i < 8; i++) {
+        const int cx = i & 1, cy = (i >> 1) & 1, cz = i >> 2;
+        if (smoothChunk(cx, cy, cz)) {
+            uint32_t cubeRegions = 0;
+            for (int dx = -1; dx <= 1; dx++)
+                for (int dy = -1; dy <= 1; dy++)
+                    for (int dz = -1; dz <= 1; dz++)
+                        if (!smoothChunk(cx + dx, cy + dy, cz + dz)) cubeRegions |= ChunkSmooth::regionBit(dx, dy, dz);
+
+            const std::vector<CompressedVertex> chunkVerts = meshChunk(blockAt, cx, cy, cz, cubeRegions);
+            smoothQuads += chunkVerts.size() / 4;
+            verts.insert(verts.end(), chunkVerts.begin(), chunkVerts.end());
+            appendCubeFaces(blockAt, cx, cy, cz, [&props](int id) { return !props.isSmooth(id); }, verts);
+        } else {
+            appendCubeFaces(blockAt, cx, cy, cz, [](int) { return true; }, verts);
+        }
+    }
+
+    ASSERT_GT(smoothQuads, 0u);
+    ASSERT_LT(smoothQuads, verts.size() / 4);
+    ASSERT_TRUE(isClosedSurface(verts));
+
+    std::cout << "✓ Mixed smooth/cube chunks + log column: closed (" << smoothQuads << " smooth, "
+              << verts.size() / 4 - smoothQuads << " cube quads)\n";
+}
+
+// ============================================================
+// Test 4: Flat Floor
+// ============================================================
+
+TEST(FlatFloor) {
+    const BlockPropertyTable& props = BlockRegistry::instance().properties();
+    const uint16_t topLayer = props.faceLayer(GRASS, static_cast<int>(FaceDirection::PosY));
+
+    auto floor = [](int, int y, int) { return y < 10 ? STONE : (y == 10 ? GRASS : 0); };
+    std::vector<CompressedVertex> verts = meshChunk(floor, 0, 0, 0);
+    ASSERT_EQ(verts.size(), static_cast<size_t>(Chunk::WIDTH * Chunk::DEPTH * 4));  // One quad per column
+
+    for (size_t quad = 0; quad < verts.size(); quad += 4) {
+        for (int i = 0; i < 4; i++) {
+            ASSERT_EQ(std::get<1>(decode(verts[quad + i])), 11 * 16);  // On the block tops
+            ASSERT_EQ(verts[quad + i].posZAtlas >> 16, topLayer);       // Top face texture
+        }
+        // Cube top faces go BL, BR, TR, TL: (v1 - v0) x (v2 - v0) points down
+        const Position a = decode(verts[quad]), b = decode(verts[quad + 1]), c = decode(verts[quad + 2]);
+        const long ux = std::get<0>(b) - std::get<0>(a), uz = std::get<2>(b) - std::get<2>(a);
+        const long vx = std::get<0>(c) - std::get<0>(a), vz = std::get<2>(c) - std::get<2>(a);
+        ASSERT_LT(uz * vx - ux * vz, 0);
+    }
+
+    // A log standing in the floor stays a cube: its column gets no smooth quad
+    auto withLog = [&floor](int x, int y, int z) { return (x == 5 && z == 5 && y >= 10 && y < 15) ? OAK_LOG : floor(x, y, z); };
+    verts = meshChunk(withLog, 0, 0, 0);
+    ASSERT_EQ(verts.size(), static_cast<size_t>((Chunk::WIDTH * Chunk::DEPTH - 1) * 4));
+
+    // Packing round trip: 1/16 block, negative coordinates floor correctly
+    for (float value : {-37.97f, -0.03f, 0.0f, 12.5f, 12.97f, 511.0625f}) {
+        const CompressedVertex v = CompressedVertex::packSmooth(value, value, value, 3, 15, 0, 15, 0);
+        const float decoded = std::get<0>(decode(v)) / 16.0f;
+        ASSERT_LE(std::abs(decoded - value), 1.0f / 32.0f);
+        ASSERT_EQ(v.packedB & CompressedVertex::FLAG_SMOOTH, CompressedVertex::FLAG_SMOOTH);
+    }
+
+    std::cout << "✓ Flat floor on the block tops, cube-meshed log, packing round trip\n";
+}
+
+// ============================================================
+// Test 5: Mesher Throughput
+// ============================================================
+
+TEST(MesherThroughput) {
+    // 4x2x4 chunks of rolling terrain with caves, water and logs
+    std::vector<std::unique_ptr<Chunk>> chunks;
+    for (int cx = 0; cx < 4; cx++) {
+        for (int cy = 0; cy < 2; cy++) {
+            for (int cz = 0; cz < 4; cz++) {
+                auto chunk = std::make_unique<Chunk>(cx, cy, cz);
+                for (int x = 0; x < Chunk::WIDTH; x++)
+                    for (int y = 0; y < Chunk::HEIGHT; y++)
+                        for (int z = 0; z < Chunk::DEPTH; z++)
+                            chunk->setBlock(x, y, z, rollingTerrain(cx * Chunk::WIDTH + x, cy * Chunk::HEIGHT + y,
+                                                                    cz * Chunk::DEPTH + z));
+                chunks.push_back(std::move(chunk));
+            }
+        }
+    }
+
+    auto& smoothTerrain = DebugState::instance().smoothTerrain;
+    const bool previous = smoothTerrain.getValue();
+    auto run = [&chunks, &smoothTerrain](bool smooth, uint64_t& vertices) {
+        smoothTerrain.setValue(smooth);
+        vertices = 0;
+        auto start = std::chrono::steady_clock::now();
+        for (auto& chunk : chunks) {
+            chunk->generateMesh(nullptr, 0);
+            vertices += chunk->getVertexCount();
+        }
+        const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        return chunks.size() / seconds;
+    };
+
+    // Interleave the two meshers and keep each one's best pass, so load spikes on a
+    // shared machine hit both sides instead of skewing the ratio
+    const int rounds = 10;
+    uint64_t cubeVertices = 0;
+    uint64_t smoothVertices = 0;
+    run(false, cubeVertices);  // Warm the mesh buffer pool
+    run(true, smoothVertices);
+    double cubeRate = 0.0;
+    double smoothRate = 0.0;
+    for (int round = 0; round < rounds; round++) {
+        cubeRate = std::max(cubeRate, run(false, cubeVertices));
+        smoothRate = std::max(smoothRate, run(true, smoothVertices));
+    }
+    smoothTerrain.setValue(previous);
+
+    const double ratio = smoothRate / cubeRate;
+    ASSERT_GT(smoothVertices, 0u);
+    ASSERT_GE(ratio, 1.0);  // Smooth terrain must mesh at least as fast as the cube pass it replaces
+
+    std::cout << "✓ generateMesh (" << chunks.size() << " chunks): cube " << cubeRate << " chunks/s ("
+              << cubeVertices / chunks.size() << " verts), smooth " << smoothRate << " chunks/s ("
+              << smoothVertices / chunks.size() << " verts, " << ratio << "x of cube)\n";
+}
+
+// ============================================================
+// Main Entry Point
+// ============================================================
+
+int main() {
+    try {
+        run_all_tests();
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "TEST FAILURE: " << e.what() << std::endl;
+        return 1;
+    }
+}
@@ -0,0 +1,360 @@
+/**
+ * @file test_structure_placement.cpp
+ * @brief Determinism and chunk-independence test for worldgen structure placement
+ *
+ * StructurePlacement resolves one candidate site per region from a hash and the
+ * BiomeMap, and every chunk places its own slice of the sites that overlap it.
+ *
+ * Tests:
+ * 1. Every chunk a site overlaps reports that site with the same origin, and
+ *    summing placeInChunk() over a site's chunks writes every block exactly once
+ * 2. A second BiomeMap warmed with different queries resolves identical sites
+ * 3. Sites in neighbouring regions respect the separation distance
+ * 4. Rewriting the source definitions (`reload structures`) leaves a built
+ *    placement unchanged
+ * 5. findSites() cost per chunk
+ *
+ * Created: 2025-11-28
+ */
+
+#include "test_utils.h"
+#include "structure_placement.h"
+#include "structure_system.h"
+#include "biome_map.h"
+#include "biome_system.h"
+#include "chunk.h"
+#include <chrono>
+#include <climits>
+#include <cstdlib>
+#include <memory>
+#include <set>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace {
+
+const int SEED = 1337;
+const int REGIONS = 12;  // Regions [-REGIONS, REGIONS) on both axes
+
+StructureVariation makeVariation(int size, int height, int depth, int chance) {
+    StructureVariation var;
+    var.length = size;
+    var.width = size;
+    var.height = height;
+    var.depth = depth;
+    var.chance = chance;
+    var.structure.assign(height, std::vector<std::vector<int>>(size, std::vector<int>(size, 0)));
+    for (int y = 0; y < height; y++) {
+        for (int z = 0; z < size; z++) {
+            for (int x = 0; x < size; x++) {
+                const bool wall = x == 0 || z == 0 || x == size - 1 || z == size - 1;
+                if (y == 0 || wall) var.structure[y][z][x] = 1 + (y % 3);
+            }
+        }
+    }
+    var.compiled = StructureTemplate::fromLayers(var.structure);
+    return var;
+}
+
+std::vector<StructureDefinition> makeDefinitions() {
+    std::vector<StructureDefinition> defs(2);
+
+    // Village-sized: wider than a chunk and sunk below ground
+    defs[0].name = "Test Village";
+    defs[0].variations.push_back(makeVariation(41, 9, 3, 60));
+    defs[0].variations.push_back(makeVariation(25, 6, 1, 40));
+    defs[0].generation.enabled = true;
+    defs[0].generation.regionSize = 96;
+    defs[0].generation.separation = 24;
+    defs[0].generation.chance = 100;
+    defs[0].generation.minHeight = INT_MIN;
+
+    defs[1].name = "Test Dungeon";
+    defs[1].variations.push_back(makeVariation(9, 7, 20, 100));
+    defs[1].generation.enabled = true;
+    defs[1].generation.regionSize = 64;
+    defs[1].generation.separation = 16;
+    defs[1].generation.chance = 70;
+    defs[1].generation.minHeight = INT_MIN;
+    return defs;
+}
+
+std::unique_ptr<BiomeMap> makeBiomeMap() {
+    auto& registry = BiomeRegistry::getInstance();
+    auto [minTemp, maxTemp] = registry.getTemperatureRange();
+    auto [minMoisture, maxMoisture] = registry.getMoistureRange();
+    return std::make_unique<BiomeMap>(SEED, 0.0f, 0.0f, 0.0f, minTemp, maxTemp, minMoisture, maxMoisture);
+}
+
+using SiteKey = std::tuple<std::string, int, int, int>;  // structure name + origin
+
+SiteKey keyOf(const StructurePlacement::Site& site) {
+    return {site.definition->name, site.origin.x, site.origin.y, site.origin.z};
+}
+
+int floorDiv32(int value) { return value >> 5; }
+
+std::vector<StructurePlacement::Site> resolveAll(const StructurePlacement& placement) {
+    std::vector<StructurePlacement::Site> sites;
+    for (size_t i = 0; i < placement.getStructureCount(); i++) {
+        for (int rx = -REGIONS; rx < REGIONS; rx++) {
+            for (int rz = -REGIONS; rz < REGIONS; rz++) {
+                StructurePlacement::Site site;
+                if (placement.resolveSite(i, rx, rz, site)) sites.push_back(site);
+            }
+        }
+    }
+    return sites;
+}
+
+/// Shared by every test: two generated structures, one placement, every site in range
+struct Fixture {
+    std::vector<StructureDefinition> definitions = makeDefinitions();
+    std::vector<const StructureDefinition*> defs;
+    std::unique_ptr<BiomeMap> biomeMap = makeBiomeMap();
+    std::unique_ptr<StructurePlacement> placement;
+    std::vector<StructurePlacement::Site> sites;
+
+    Fixture() {
+        for (const StructureDefinition& def : definitions) defs.push_back(&def);
+        placement = std::make_unique<StructurePlacement>(SEED, biomeMap.get());
+        placement->addStructures(defs);
+        sites = resolveAll(*placement);
+    }
+};
+
+Fixture& fixture() {
+    static Fixture instance;
+    return instance;
+}
+
+}  // namespace
+
+// ============================================================
+// Test 1: Chunk Agreement
+// ============================================================
+
+TEST(ChunkAgreement) {
+    const StructurePlacement& placement = *fixture().placement;
+    const std::vector<StructurePlacement::Site>& sites = fixture().sites;
+    ASSERT_EQ(placement.getStructureCount(), 2u);
+    ASSERT_GT(sites.size(), 20u);  // Enough sites to test anything
+
+    // Each site must be reported by every chunk its blocks overlap, and placing
+    // those chunks one by one must write every block of the site exactly once
+    int chunkQueries = 0;
+    int checkedSites = 0;
+    for (const StructurePlacement::Site& site : sites) {
+        const StructureTemplate& tmpl = site.variation->compiled;
+        const glm::ivec3 lo = site.origin + tmpl.getMin();
+        const glm::ivec3 hi = site.origin + tmpl.getMax() - glm::ivec3(1);
+
+        bool reported = true;
+        bool countable = checkedSites < 40;
+        int written = 0;
+        for (int cx = floorDiv32(lo.x); cx <= floorDiv32(hi.x); cx++) {
+            for (int cy = floorDiv32(lo.y); cy <= floorDiv32(hi.y); cy++) {
+                for (int cz = floorDiv32(lo.z); cz <= floorDiv32(hi.z); cz++) {
+                    std::vector<StructurePlacement::Site> found;
+                    placement.findSites(cx, cy, cz, found);
+                    chunkQueries++;
+
+                    bool match = false;
+                    int others = 0;
+                    for (const StructurePlacement::Site& other : found) {
+                        if (keyOf(other) == keyOf(site)) match = true;
+                        else others++;
+                    }
+                    reported = reported && match;
+
+                    // Only count sites whose chunks hold no other site
+                    countable = countable && others == 0;
+                    if (countable) {
+                        auto chunk = std::make_unique<Chunk>(cx, cy, cz);
+                        written += placement.placeInChunk(chunk.get());
+                    }
+                }
+            }
+        }
+        ASSERT_TRUE(reported);  // Every chunk overlapping the site reports it
+        if (countable) {
+            ASSERT_EQ(written, static_cast<int>(tmpl.getBlockCount()));  // No block lost or duplicated
+            checkedSites++;
+        }
+    }
+
+    // Conversely, chunks must not report sites outside the resolved set
+    std::set<SiteKey> known;
+    for (const StructurePlacement::Site& site : sites) known.insert(keyOf(site));
+    const int blockRange = REGIONS * 64 - 128;  // Stay well inside the resolved regions
+    for (int cx = -blockRange / 32; cx < blockRange / 32; cx += 3) {
+        for (int cz = -blockRange / 32; cz < blockRange / 32; cz += 3) {
+            for (int cy = 0; cy < 5; cy++) {
+                std::vector<StructurePlacement::Site> found;
+                placement.findSites(cx, cy, cz, found);
+                chunkQueries++;
+                for (const StructurePlacement::Site& site : found) {
+                    ASSERT_EQ(known.count(keyOf(site)), 1u);
+                }
+            }
+        }
+    }
+
+    std::cout << "✓ Chunk agreement: " << sites.size() << " sites, " << chunkQueries << " chunk queries, "
+              << checkedSites << " sites placed\n";
+}
+
+// ============================================================
+// Test 2: Order Independence
+// ============================================================
+
+TEST(OrderIndependence) {
+    const std::vector<const StructureDefinition*>& defs = fixture().defs;
+    const std::vector<StructurePlacement::Site>& sites = fixture().sites;
+
+    // Warm a fresh BiomeMap from odd positions in reverse order, so every cache
+    // cell is first filled by a different query than in the first map
+    auto biomeMap = makeBiomeMap();
+    const int blockRange = REGIONS * 96;
+    for (int x = blockRange; x > -blockRange; x -= 7) {
+        for (int z = blockRange; z > -blockRange; z -= 7) {
+            biomeMap->getBiomeAt(x + 0.5f, z + 1.5f);
+            biomeMap->getTerrainHeightAt(x + 1.0f, z + 0.5f);
+        }
+    }
+
+    StructurePlacement placement(SEED, biomeMap.get());
+    placement.addStructures(defs);
+    const std::vector<StructurePlacement::Site> again = resolveAll(placement);
+
+    std::set<SiteKey> first, second;
+    for (const StructurePlacement::Site& site : sites) first.insert(keyOf(site));
+    for (const StructurePlacement::Site& site : again) second.insert(keyOf(site));
+    ASSERT_TRUE(first == second);  // Independent of BiomeMap query order
+
+    // Different seed, different layout
+    StructurePlacement other(SEED + 1, biomeMap.get());
+    other.addStructures(defs);
+    std::set<SiteKey> third;
+    for (const StructurePlacement::Site& site : resolveAll(other)) third.insert(keyOf(site));
+    ASSERT_TRUE(third != first);
+
+    std::cout << "✓ Sites independent of BiomeMap query order, seed changes the layout\n";
+}
+
+// ============================================================
+// Test 3: Separation
+// ============================================================
+
+TEST(Separation) {
+    const std::vector<StructurePlacement::Site>& sites = fixture().sites;
+
+    int pairs = 0;
+    for (size_t i = 0; i < sites.size(); i++) {
+        for (size_t j = i + 1; j < sites.size(); j++) {
+            if (sites[i].definition != sites[j].definition) continue;
+            const StructureGenerationRule& rule = sites[i].definition->generation;
+            const glm::ivec3 a = sites[i].origin + glm::ivec3(sites[i].variation->length / 2, 0, sites[i].variation->width / 2);
+            const glm::ivec3 b = sites[j].origin + glm::ivec3(sites[j].variation->length / 2, 0, sites[j].variation->width / 2);
+            const int distance = std::max(std::abs(a.x - b.x), std::abs(a.z - b.z));
+            if (distance < rule.regionSize) pairs++;
+            ASSERT_GE(distance, rule.separation);
+        }
+    }
+    std::cout << "✓ Separation respected by " << pairs << " close pairs\n";
+}
+
+// ============================================================
+// Test 4: Definition Reload
+// ============================================================
+
+TEST(DefinitionReload) {
+    // Built like World does from the registry: pointers to definitions that
+    // `reload structures` later overwrites in place
+    std::vector<StructureDefinition> definitions = makeDefinitions();
+    std::vector<const StructureDefinition*> defs;
+    for (const StructureDefinition& def : definitions) defs.push_back(&def);
+    auto biomeMap = makeBiomeMap();
+    StructurePlacement placement(SEED, biomeMap.get());
+    placement.addStructures(defs);
+
+    std::set<SiteKey> before;
+    for (const StructurePlacement::Site& site : resolveAll(placement)) before.insert(keyOf(site));
+    const StructurePlacement::Site& probe = fixture().sites.front();
+    const glm::ivec3 chunkPos(floorDiv32(probe.origin.x), floorDiv32(probe.origin.y), floorDiv32(probe.origin.z));
+    auto chunkBefore = std::make_unique<Chunk>(chunkPos.x, chunkPos.y, chunkPos.z);
+    const int writtenBefore = placement.placeInChunk(chunkBefore.get());
+    ASSERT_GT(writtenBefore, 0);
+
+    // Reload: new variations (reallocated storage) and new rules under the same names
+    for (StructureDefinition& def : definitions) {
+        StructureDefinition reloaded;
+        reloaded.name = def.name;
+        reloaded.variations.push_back(makeVariation(3, 2, 0, 100));
+        reloaded.generation = def.generation;
+        reloaded.generation.chance = 1;
+        def = reloaded;
+    }
+
+    std::set<SiteKey> after;
+    for (const StructurePlacement::Site& site : resolveAll(placement)) after.insert(keyOf(site));
+    ASSERT_TRUE(before == after);
+    auto chunkAfter = std::make_unique<Chunk>(chunkPos.x, chunkPos.y, chunkPos.z);
+    ASSERT_EQ(placement.placeInChunk(chunkAfter.get()), writtenBefore);
+
+    // A placement rebuilt from the reloaded definitions (World::reloadStructurePlacement) uses them
+    StructurePlacement rebuilt(SEED, biomeMap.get());
+    rebuilt.addStructures(defs);
+    std::set<SiteKey> fresh;
+    for (const StructurePlacement::Site& site : resolveAll(rebuilt)) fresh.insert(keyOf(site));
+    ASSERT_LT(fresh.size(), before.size());
+
+    std::cout << "✓ Built placement unaffected by reloaded definitions (" << before.size()
+              << " sites), rebuilt one uses them (" << fresh.size() << " sites)\n";
+}
+
+// ============================================================
+// Test 5: Find Sites Throughput
+// ============================================================
+
+TEST(FindSitesThroughput) {
+    const StructurePlacement& placement = *fixture().placement;
+
+    // Warm caches first: terrain generation has already filled them for real chunks
+    std::vector<StructurePlacement::Site> found;
+    const int range = 16;
+    for (int cx = -range; cx < range; cx++)
+        for (int cz = -range; cz < range; cz++)
+            placement.findSites(cx, 2, cz, found);
+
+    found.clear();
+    const int rounds = 5;
+    auto start = std::chrono::steady_clock::now();
+    for (int round = 0; round < rounds; round++) {
+        for (int cx = -range; cx < range; cx++) {
+            for (int cz = -range; cz < range; cz++) {
+                found.clear();
+                placement.findSites(cx, 2, cz, found);
+            }
+        }
+    }
+    const double perChunkUs = std::chrono::duration<double, std::micro>(
+        std::chrono::steady_clock::now() - start).count() / (rounds * 4 * range * range);
+    std::cout << "✓ findSites: " << perChunkUs << " us per chunk (" << placement.getStructureCount()
+              << " structure types)\n";
+}
+
+// ============================================================
+// Main Entry Point
+// ============================================================
+
+int main() {
+    try {
+        run_all_tests();
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "TEST FAILURE: " << e.what() << std::endl;
+        return 1;
+    }
+}
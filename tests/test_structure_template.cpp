@@ -0,0 +1,240 @@
+/**
+ * @file test_structure_template.cpp
+ * @brief Correctness and throughput test for compiled structure templates
+ *
+ * Structures and trees used to be placed one setBlockAt() per voxel. They are
+ * now compiled into Z spans and blitted per chunk.
+ *
+ * Tests:
+ * 1. fromLayers()/fromVoxels() spans expand back to exactly the source blocks
+ * 2. Chunk::blitTemplate() at origins straddling every chunk face matches
+ *    per-voxel Chunk::setBlock(), including heightmap columns;
+ *    Chunk::isTemplateClear() only accepts air and the replaceable ID
+ * 3. Placement time for a 64^3 prefab across 27 chunks: per-voxel vs span blit
+ *
+ * Created: 2025-11-28
+ */
+
+#include "test_utils.h"
+#include "structure_template.h"
+#include "chunk.h"
+#include <chrono>
+#include <map>
+#include <memory>
+#include <random>
+#include <tuple>
+#include <vector>
+
+namespace {
+
+using VoxelMap = std::map<std::tuple<int, int, int>, int>;  // (x, y, z) -> block ID
+
+VoxelMap expand(const StructureTemplate& tmpl) {
+    VoxelMap result;
+    if (tmpl.empty()) return result;
+    for (int y = tmpl.getMin().y; y < tmpl.getMax().y; y++) {
+        for (const TemplateSpan* span = tmpl.sliceBegin(y); span != tmpl.sliceEnd(y); ++span) {
+            for (int i = 0; i < span->length; i++) {
+                result[{span->x, y, span->z + i}] = span->blockID;
+            }
+        }
+    }
+    return result;
+}
+
+/// Castle-like prefab: solid floor every 8 layers, hollow walls, random interior props
+std::vector<std::vector<std::vector<int>>> makePrefab(int size, std::mt19937& rng) {
+    std::vector<std::vector<std::vector<int>>> layers(size, std::vector<std::vector<int>>(size, std::vector<int>(size, 0)));
+    for (int y = 0; y < size; y++) {
+        for (int z = 0; z < size; z++) {
+            for (int x = 0; x < size; x++) {
+                const bool wall = x == 0 || z == 0 || x == size - 1 || z == size - 1;
+                if (y % 8 == 0) layers[y][z][x] = 1;
+                else if (wall) layers[y][z][x] = (y % 4 == 2 && x % 6 == 3) ? 0 : 2;  // Windows
+                else if (rng() % 50 == 0) layers[y][z][x] = 3 + static_cast<int>(rng() % 4);
+            }
+        }
+    }
+    return layers;
+}
+
+}  // namespace
+
+// ============================================================
+// Test 1: Compile
+// ============================================================
+
+TEST(Compile) {
+    std::mt19937 rng(17);
+
+    // Ragged rows and air are handled; AABB covers only non-air blocks
+    std::vector<std::vector<std::vector<int>>> layers = {
+        {{0, 0, 0}, {0, 5, 5, 5}},
+        {},
+        {{0}, {0, 7}, {9, 9, 9}},
+    };
+    StructureTemplate small = StructureTemplate::fromLayers(layers);
+    VoxelMap expected = {{{1, 0, 1}, 5}, {{2, 0, 1}, 5}, {{3, 0, 1}, 5},
+                         {{1, 2, 1}, 7}, {{0, 2, 2}, 9}, {{1, 2, 2}, 9}, {{2, 2, 2}, 9}};
+    ASSERT_EQ(expand(small), expected);
+    ASSERT_TRUE(small.getMin() == glm::ivec3(0, 0, 1));  // AABB of non-air blocks only
+    ASSERT_TRUE(small.getMax() == glm::ivec3(4, 3, 3));
+    ASSERT_EQ(small.sliceBegin(1), small.sliceEnd(1));
+
+    auto prefab = makePrefab(64, rng);
+    StructureTemplate compiled = StructureTemplate::fromLayers(prefab);
+    VoxelMap reference;
+    for (int y = 0; y < 64; y++)
+        for (int z = 0; z < 64; z++)
+            for (int x = 0; x < 64; x++)
+                if (prefab[y][z][x] != 0) reference[{x, y, z}] = prefab[y][z][x];
+    ASSERT_EQ(expand(compiled), reference);
+    ASSERT_EQ(compiled.getBlockCount(), reference.size());
+    ASSERT_LT(compiled.getSpanCount() * 4, compiled.getBlockCount());  // Run-length compressed
+
+    // Last entry wins for duplicate positions (tree branches over canopy)
+    StructureTemplate tree = StructureTemplate::fromVoxels({
+        {glm::ivec3(0, 0, 0), 1}, {glm::ivec3(0, 1, 0), 2}, {glm::ivec3(-1, 1, 0), 2},
+        {glm::ivec3(0, 1, 0), 1}, {glm::ivec3(0, 0, 0), 0}});
+    VoxelMap treeExpected = {{{0, 1, 0}, 1}, {{-1, 1, 0}, 2}};
+    ASSERT_EQ(expand(tree), treeExpected);  // Duplicate voxels resolved last-wins
+    ASSERT_EQ(tree.getMin().x, -1);
+    ASSERT_EQ(tree.getMin().y, 1);
+
+    std::cout << "✓ Compile + expand: " << compiled.getBlockCount() << " blocks -> "
+              << compiled.getSpanCount() << " spans\n";
+}
+
+// ============================================================
+// Test 2: Blit
+// ============================================================
+
+TEST(Blit) {
+    std::mt19937 rng(5);
+    std::vector<StructureTemplate::Voxel> voxels;
+    for (int i = 0; i < 3000; i++) {
+        voxels.push_back({glm::ivec3(static_cast<int>(rng() % 20) - 10, static_cast<int>(rng() % 20) - 10,
+                                     static_cast<int>(rng() % 20) - 10),
+                          1 + static_cast<int>(rng() % 3)});
+    }
+    const StructureTemplate tmpl = StructureTemplate::fromVoxels(voxels);
+    const VoxelMap blocks = expand(tmpl);
+
+    // Origins inside, on every face/corner, and fully outside the chunk
+    const int coords[] = {-15, -3, 0, 5, 16, 28, 31, 40};
+    int cases = 0;
+    for (int ox : coords) {
+        for (int oy : coords) {
+            for (int oz : coords) {
+                auto blitted = std::make_unique<Chunk>(0, 0, 0);
+                auto reference = std::make_unique<Chunk>(0, 0, 0);
+                // Second blit overlaps the first so it also overwrites existing column tops
+                int written = 0;
+                int expectedWritten = 0;
+                for (const glm::ivec3& origin : {glm::ivec3(ox, oy, oz), glm::ivec3(ox + 3, oy - 2, oz + 1)}) {
+                    written += blitted->blitTemplate(tmpl, origin);
+                    for (const auto& entry : blocks) {
+                        const int x = std::get<0>(entry.first) + origin.x;
+                        const int y = std::get<1>(entry.first) + origin.y;
+                        const int z = std::get<2>(entry.first) + origin.z;
+                        if (x >= 0 && x < Chunk::WIDTH && y >= 0 && y < Chunk::HEIGHT && z >= 0 && z < Chunk::DEPTH) {
+                            reference->setBlock(x, y, z, entry.second);
+                            expectedWritten++;
+                        }
+                    }
+                }
+                ASSERT_EQ(written, expectedWritten);
+
+                for (int x = 0; x < Chunk::WIDTH; x++) {
+                    for (int z = 0; z < Chunk::DEPTH; z++) {
+                        for (int y = 0; y < Chunk::HEIGHT; y++) {
+                            ASSERT_EQ(blitted->getBlock(x, y, z), reference->getBlock(x, y, z));
+                        }
+                        ASSERT_EQ(blitted->getHeightAt(x, z), reference->getHeightAt(x, z));  // No stale column
+                    }
+                }
+                cases++;
+            }
+        }
+    }
+
+    // Clear check: air and the replaceable ID pass, anything else fails
+    auto chunk = std::make_unique<Chunk>(0, 0, 0);
+    StructureTemplate pillar = StructureTemplate::fromVoxels({{glm::ivec3(0, 0, 0), 1}, {glm::ivec3(0, 1, 0), 1}});
+    ASSERT_TRUE(chunk->isTemplateClear(pillar, glm::ivec3(4, 4, 4), 3));
+    chunk->setBlock(4, 5, 4, 3);
+    ASSERT_TRUE(chunk->isTemplateClear(pillar, glm::ivec3(4, 4, 4), 3));
+    chunk->setBlock(4, 4, 4, 2);
+    ASSERT_FALSE(chunk->isTemplateClear(pillar, glm::ivec3(4, 4, 4), 3));
+    ASSERT_TRUE(chunk->isTemplateClear(pillar, glm::ivec3(4, 40, 4), 3));
+
+    std::cout << "✓ Chunk blit matches per-voxel setBlock at " << cases << " origins\n";
+}
+
+// ============================================================
+// Test 3: Placement Throughput
+// ============================================================
+
+TEST(PlacementThroughput) {
+    std::mt19937 rng(23);
+    const int size = 64;
+    const auto prefab = makePrefab(size, rng);
+    const StructureTemplate compiled = StructureTemplate::fromLayers(prefab);
+
+    // 3x3x3 chunk block; the prefab starts mid-chunk so it straddles all 27
+    std::vector<std::unique_ptr<Chunk>> chunks;
+    for (int i = 0; i < 27; i++) chunks.push_back(std::make_unique<Chunk>(i % 3, (i / 3) % 3, i / 9));
+    auto chunkAt = [&chunks](int cx, int cy, int cz) { return chunks[cx + cy * 3 + cz * 9].get(); };
+    const glm::ivec3 origin(13, 9, 17);
+    const int rounds = 20;
+
+    // Per voxel: chunk lookup + setBlock (lock + heightmap rescan) for each block
+    auto start = std::chrono::steady_clock::now();
+    for (int round = 0; round < rounds; round++) {
+        for (int y = 0; y < size; y++) {
+            for (int z = 0; z < size; z++) {
+                for (int x = 0; x < size; x++) {
+                    const int blockID = prefab[y][z][x];
+                    if (blockID == 0) continue;
+                    const int wx = origin.x + x, wy = origin.y + y, wz = origin.z + z;
+                    chunkAt(wx >> 5, wy >> 5, wz >> 5)->setBlock(wx & 31, wy & 31, wz & 31, blockID);
+                }
+            }
+        }
+    }
+    const double voxelMs = std::chrono::duration<double, std::milli>(
+        std::chrono::steady_clock::now() - start).count() / rounds;
+
+    start = std::chrono::steady_clock::now();
+    int written = 0;
+    for (int round = 0; round < rounds; round++) {
+        written = 0;
+        for (int cz = 0; cz < 3; cz++)
+            for (int cy = 0; cy < 3; cy++)
+                for (int cx = 0; cx < 3; cx++)
+                    written += chunkAt(cx, cy, cz)->blitTemplate(
+                        compiled, origin - glm::ivec3(cx * Chunk::WIDTH, cy * Chunk::HEIGHT, cz * Chunk::DEPTH));
+    }
+    const double blitMs = std::chrono::duration<double, std::milli>(
+        std::chrono::steady_clock::now() - start).count() / rounds;
+
+    ASSERT_EQ(written, static_cast<int>(compiled.getBlockCount()));  // No blocks lost across chunk seams
+
+    std::cout << "✓ 64^3 prefab (" << compiled.getBlockCount() << " blocks, 27 chunks): per-voxel "
+              << voxelMs << " ms, span blit " << blitMs << " ms ("
+              << (blitMs > 0.0 ? voxelMs / blitMs : 0.0) << "x)\n";
+}
+
+// ============================================================
+// Main Entry Point
+// ============================================================
+
+int main() {
+    try {
+        run_all_tests();
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "TEST FAILURE: " << e.what() << std::endl;
+        return 1;
+    }
+}
@@ -0,0 +1,189 @@
+/**
+ * @file test_texture_array.cpp
+ * @brief CPU tests for the block texture array (texture_array.h)
+ *
+ * Tests:
+ * 1. planLayers() gives each loaded source one layer in first-reference order,
+ *    shares layers between faces and skips sources that failed to load; sources
+ *    past MAX_LAYERS fall back to layer 0 and are listed as dropped; with no
+ *    loaded source the plan is empty (no array is uploaded)
+ * 2. chooseLayerSize() clamps to 64-128 and rounds up to a power of two;
+ *    mip offsets tile the chain exactly (64 -> 7 levels, 4/3 of level 0)
+ * 3. buildMipChain() keeps flat colors exact, averages in linear light, and
+ *    ignores transparent texels' color (no dark fringes on cutouts)
+ * 4. Mip generation throughput for a 128-layer 128px array
+ *
+ * Created: 2025-11-28
+ */
+
+#include "test_utils.h"
+#include "texture_array.h"
+#include <chrono>
+#include <cstdlib>
+#include <vector>
+
+namespace {
+
+bool near(int value, int expected, int tolerance = 1) {
+    return std::abs(value - expected) <= tolerance;
+}
+
+}  // namespace
+
+// ============================================================
+// Test 1: Layer Plan
+// ============================================================
+
+TEST(LayerPlan) {
+    // Sources: 0 grass_top, 1 dirt, 2 grass_side, 3 missing.png, 4 stone (never referenced)
+    // References: a grass cube map (top, bottom, 4 sides), dirt, a broken block, dirt again
+    const std::vector<int> refSources = {0, 1, 2, 2, 2, 2, 1, 3, 1};
+    const std::vector<uint8_t> loaded = {1, 1, 1, 0, 1};
+    const TextureArray::LayerPlan plan = TextureArray::planLayers(refSources, loaded);
+
+    ASSERT_EQ(plan.layerSources, std::vector<int>({0, 1, 2}));
+    ASSERT_EQ(plan.sourceLayers, std::vector<int>({0, 1, 2, -1, -1}));
+    ASSERT_EQ(plan.refLayers, std::vector<int>({0, 1, 2, 2, 2, 2, 1, -1, 1}));
+
+    // More sources than the guaranteed layer limit fall back to layer 0 and are reported
+    std::vector<int> manyRefs;
+    for (int i = 0; i < TextureArray::MAX_LAYERS + 10; i++) manyRefs.push_back(i);
+    const std::vector<uint8_t> allLoaded(manyRefs.size(), 1);
+    const TextureArray::LayerPlan capped = TextureArray::planLayers(manyRefs, allLoaded);
+    ASSERT_EQ(static_cast<int>(capped.layerSources.size()), TextureArray::MAX_LAYERS);
+    ASSERT_EQ(capped.refLayers.back(), 0);
+    ASSERT_EQ(capped.droppedSources.size(), 10u);
+    ASSERT_EQ(capped.droppedSources.front(), TextureArray::MAX_LAYERS);
+    ASSERT_TRUE(plan.droppedSources.empty());
+
+    // Nothing loaded: no layers, so BlockRegistry skips the upload and the default array stays bound
+    const TextureArray::LayerPlan empty = TextureArray::planLayers({0, 1, 0}, {0, 0});
+    ASSERT_TRUE(empty.layerSources.empty());
+    ASSERT_EQ(empty.refLayers, std::vector<int>({-1, -1, -1}));
+
+    std::cout << "✓ Layer plan: 9 references -> " << plan.layerSources.size() << " layers, none loaded -> 0\n";
+}
+
+// ============================================================
+// Test 2: Layer Size
+// ============================================================
+
+TEST(LayerSize) {
+    ASSERT_EQ(TextureArray::chooseLayerSize({}), 64);
+    ASSERT_EQ(TextureArray::chooseLayerSize({16, 64}), 64);
+    ASSERT_EQ(TextureArray::chooseLayerSize({64, 96}), 128);
+    ASSERT_EQ(TextureArray::chooseLayerSize({64, 1024}), 128);
+
+    ASSERT_EQ(TextureArray::mipLevelCount(64), 7);
+    ASSERT_EQ(TextureArray::mipLevelCount(128), 8);
+    ASSERT_EQ(TextureArray::mipOffset(64, 0), 0);
+    ASSERT_EQ(TextureArray::mipOffset(64, 1), 64 * 64 * 4);
+    ASSERT_EQ(TextureArray::mipOffset(64, 2), (64 * 64 + 32 * 32) * 4);
+
+    // 4/3 of level 0, rounded down per level, plus the 1x1 tail
+    size_t expected = 0;
+    for (int edge = 128; edge >= 1; edge /= 2) expected += static_cast<size_t>(edge) * edge * 4;
+    ASSERT_EQ(TextureArray::layerBytes(128), expected);
+
+    std::cout << "✓ Layer size clamped to 64-128, mip offsets tile the chain\n";
+}
+
+// ============================================================
+// Test 3: Mip Chain
+// ============================================================
+
+TEST(MipChain) {
+    const int size = 64;
+    const size_t bytes = TextureArray::layerBytes(size);
+
+    // Flat color stays exact at every level
+    std::vector<uint8_t> flat(bytes, 0);
+    for (int i = 0; i < size * size; i++) {
+        flat[i * 4 + 0] = 200; flat[i * 4 + 1] = 120; flat[i * 4 + 2] = 30; flat[i * 4 + 3] = 255;
+    }
+    TextureArray::buildMipChain(flat.data(), size);
+    for (int level = 1; level < TextureArray::mipLevelCount(size); level++) {
+        const uint8_t* texel = flat.data() + TextureArray::mipOffset(size, level);
+        ASSERT_EQ(texel[0], 200);
+        ASSERT_EQ(texel[1], 120);
+        ASSERT_EQ(texel[2], 30);
+        ASSERT_EQ(texel[3], 255);
+    }
+
+    // Black / white checkerboard averages in linear light: sRGB ~188, not 128
+    std::vector<uint8_t> checker(bytes, 0);
+    for (int y = 0; y < size; y++) {
+        for (int x = 0; x < size; x++) {
+            const uint8_t v = ((x + y) & 1) ? 255 : 0;
+            uint8_t* texel = &checker[(y * size + x) * 4];
+            texel[0] = texel[1] = texel[2] = v;
+            texel[3] = 255;
+        }
+    }
+    TextureArray::buildMipChain(checker.data(), size);
+    const uint8_t* grey = checker.data() + TextureArray::mipOffset(size, 1);
+    ASSERT_TRUE(near(grey[0], 188));
+    ASSERT_EQ(grey[3], 255);
+    const uint8_t* last = checker.data() + TextureArray::mipOffset(size, TextureArray::mipLevelCount(size) - 1);
+    ASSERT_TRUE(near(last[0], 188));
+
+    // Cutout: transparent black around opaque green keeps the green, halves alpha
+    std::vector<uint8_t> cutout(bytes, 0);
+    for (int y = 0; y < size; y++) {
+        for (int x = 0; x < size; x++) {
+            if (x & 1) {
+                uint8_t* texel = &cutout[(y * size + x) * 4];
+                texel[1] = 160;
+                texel[3] = 255;
+            }
+        }
+    }
+    TextureArray::buildMipChain(cutout.data(), size);
+    const uint8_t* leaf = cutout.data() + TextureArray::mipOffset(size, 1);
+    ASSERT_EQ(leaf[0], 0);
+    ASSERT_EQ(leaf[1], 160);
+    ASSERT_TRUE(near(leaf[3], 128));
+
+    std::cout << "✓ Mip chain: flat exact, checkerboard -> " << static_cast<int>(grey[0])
+              << ", cutout -> (" << static_cast<int>(leaf[1]) << ", a=" << static_cast<int>(leaf[3]) << ")\n";
+}
+
+// ============================================================
+// Test 4: Mip Throughput
+// ============================================================
+
+TEST(MipThroughput) {
+    const int size = 128;
+    const int layers = 128;
+    const size_t bytesPerLayer = TextureArray::layerBytes(size);
+    std::vector<uint8_t> pixels(bytesPerLayer * layers);
+    uint32_t state = 12345;
+    for (int layer = 0; layer < layers; layer++) {
+        for (int i = 0; i < size * size * 4; i++) {
+            state = state * 1664525u + 1013904223u;
+            pixels[layer * bytesPerLayer + i] = static_cast<uint8_t>(state >> 24);
+        }
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    for (int layer = 0; layer < layers; layer++) {
+        TextureArray::buildMipChain(&pixels[layer * bytesPerLayer], size);
+    }
+    const double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    std::cout << "✓ buildMipChain: " << layers << " layers of " << size << "x" << size << " in " << ms
+              << " ms (" << pixels.size() / 1024 << " KB baked)\n";
+}
+
+// ============================================================
+// Main Entry Point
+// ============================================================
+
+int main() {
+    try {
+        run_all_tests();
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "TEST FAILURE: " << e.what() << std::endl;
+        return 1;
+    }
+}